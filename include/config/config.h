@@ -14,6 +14,12 @@ typedef enum {
     LAYER_OVERLAY = 1
 } layer_type_t;
 
+typedef enum {
+    OVERLAY_SIZE_SCREEN = 0,
+    OVERLAY_SIZE_BAR = 1,
+    OVERLAY_SIZE_CAT = 2
+} overlay_size_t;
+
 typedef struct {
     int hour;
     int min;
@@ -29,7 +35,15 @@ typedef struct {
     int screen_width;
     char *output_name;
     int bar_height;
-    const char *asset_paths[NUM_FRAMES];
+    char *asset_paths[NUM_FRAMES];  // Custom frame images, NULL for the embedded art
+    char *animation_sheet;          // Sprite sheet replacing the four frames, NULL if unset
+    int animation_sheet_frames;
+    int animation_sheet_columns;    // Frames per sheet row, 0 for a single row
+    char *animation_gif;            // Animated GIF streamed as the typing animation, NULL if unset
+    int animation_gif_cache_kb;     // Decoded GIF frames kept resident
+    char *idle_sequence;            // "frame[:ms],..." per state, NULL for the default
+    char *typing_sequence;
+    char *sleep_sequence;
     char **keyboard_devices;
     int num_keyboard_devices;
     int cat_x_offset;
@@ -43,8 +57,11 @@ typedef struct {
     int fps;
     int overlay_opacity;
     int enable_debug;
+    int enable_prerender;
+    int enable_compositor_scaling;
     layer_type_t layer;
     overlay_position_t overlay_position;
+    overlay_size_t overlay_size;
 
     int enable_scheduled_sleep;
     config_time_t sleep_begin;
@@ -56,6 +73,7 @@ typedef struct {
 bongocat_error_t load_config(config_t *config, const char *config_file_path);
 void config_cleanup(void);
 void config_cleanup_full(config_t *config);
+void config_free_animation(config_t *config);
 int get_screen_width(void);
 
 #endif // CONFIG_H
\ No newline at end of file
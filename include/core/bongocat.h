@@ -20,13 +20,12 @@
 #define _POSIX_C_SOURCE 200809L
 #include <wayland-client.h>
 
-#include "../lib/stb_image.h"
-
 // Version
 #define BONGOCAT_VERSION "1.2.5"
 
 // Common constants
 #define NUM_FRAMES 4
+#define MAX_FRAMES 256 // Sprite sheet animations
 #define DEFAULT_SCREEN_WIDTH 1920
 #define DEFAULT_BAR_HEIGHT 40
 #define MAX_OUTPUTS 8 // Maximum monitor outputs to store
@@ -59,6 +58,9 @@ typedef struct {
     uint32_t name;         // Registry name
     char name_str[128];   // From xdg-output
     bool name_received;
+    int32_t scale;         // wl_output integer scale
+    int32_t logical_width; // From xdg-output, 0 until received
+    int32_t logical_height;
 } output_ref_t;
 
 // Config watcher function declarations
@@ -4,20 +4,85 @@
 #include "core/bongocat.h"
 #include "config/config.h"
 #include "utils/error.h"
+#include "utils/memory.h"
 
 extern unsigned char *anim_imgs[NUM_FRAMES];
 extern int anim_width[NUM_FRAMES], anim_height[NUM_FRAMES];
 extern int anim_index;
+extern long anim_input_time_us;  // Press shown by the next frame change, 0 if none; anim_lock
 extern pthread_mutex_t anim_lock;
 
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} anim_rect_t;
+
+// Run of non-transparent pixels within one row of a cached frame
+typedef struct {
+    uint16_t x;
+    uint16_t length;
+    unsigned int offset : 31;  // First pixel of the run in the frame's pixel array
+    unsigned int opaque : 1;   // Fully opaque runs are copied, the rest blended
+} anim_span_t;
+
+// Frame stored as per-row span lists; fully transparent pixels are dropped.
+// Points into the cache atlas.
+typedef struct {
+    const int *row_spans;      // height + 1 indices into spans
+    const anim_span_t *spans;
+    const uint32_t *pixels;    // Premultiplied ARGB8888, runs back to back
+    uint32_t num_spans;
+    uint32_t num_pixels;
+    anim_rect_t bounds;        // Box around every non-transparent pixel
+} anim_rle_frame_t;
+
+struct anim_stream;
+
+// Output scales are in 120ths, as wp_fractional_scale_v1 reports them
+#define ANIM_SCALE_ONE 120
+
+// Frames pre-scaled to cat_height at one output scale, without background, in the ARGB8888
+// layout wl_shm expects so drawing only touches the cat's own pixels.
+// Descriptors, diffs and every frame's spans and pixels share one atlas,
+// each block starting on its own cache line. Streamed caches only keep the
+// descriptors there; a frame's pixels are NULL until it has been decoded.
+typedef struct {
+    int width;                   // Buffer pixels
+    int height;
+    int scale;                   // Output scale the frames were rendered for
+    int num_frames;
+    anim_rle_frame_t *frames;
+    anim_rect_t *frame_diff;     // num_frames^2 bounds of pixels differing between two frames,
+                                 // NULL for large animations
+    memory_pool_t *atlas;
+    struct anim_stream *stream;  // Decodes GIF frames on demand, NULL when all are resident
+    unsigned int generation;     // Changes whenever another cache becomes active
+} anim_frame_cache_t;
+
+extern anim_frame_cache_t anim_frame_cache;
+
 bongocat_error_t animation_init(config_t *config);
+bongocat_error_t animation_wait_ready(void);
 bongocat_error_t animation_start(void);
 void animation_cleanup(void);
+void animation_update_config(config_t *config);
+// Wakes the animation thread to take the queued key presses
 void animation_trigger(void);
 
-void blit_image_scaled(uint8_t *dest, int dest_w, int dest_h,
-                      unsigned char *src, int src_w, int src_h,
-                      int offset_x, int offset_y, int target_w, int target_h);
+// Switches to frames rendered for the given output scale, building them in
+// the background the first time; the cat is redrawn once they are active
+void animation_set_scale(int scale);
+
+// Area that changes when switching between two cached frames
+anim_rect_t anim_frame_cache_diff(int from, int to);
+
+// Composites a cached frame over what is already in dest
+void blit_cached_frame(uint8_t *dest, int dest_w, int dest_h, int frame,
+                       int offset_x, int offset_y);
+void blit_cached_frame_region(uint8_t *dest, int dest_w, int dest_h, int frame,
+                              int offset_x, int offset_y, const anim_rect_t *region);
 
 void draw_rect(uint8_t *dest, int width, int height, int x, int y, 
                int w, int h, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
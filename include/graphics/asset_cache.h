@@ -0,0 +1,25 @@
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "utils/error.h"
+
+// Pre-scaled frames of user asset packs, kept under $XDG_CACHE_HOME/bongocat
+// and keyed by source content hash, target size and pixel format
+typedef struct {
+    void *map;
+    size_t map_size;
+    const uint32_t *pixels;  // width * height premultiplied ARGB8888
+} asset_cache_entry_t;
+
+uint64_t asset_cache_hash(const void *data, size_t size);
+
+// Maps a cached frame read-only; returns false on a miss
+bool asset_cache_lookup(uint64_t hash, int width, int height, asset_cache_entry_t *entry);
+void asset_cache_release(asset_cache_entry_t *entry);
+
+bongocat_error_t asset_cache_store(uint64_t hash, int width, int height, const uint32_t *pixels);
+
+#endif // ASSET_CACHE_H
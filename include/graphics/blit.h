@@ -0,0 +1,31 @@
+#ifndef BLIT_H
+#define BLIT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Pixel kernels for the ARGB8888 buffers shared with the compositor.
+// Pixels are handled as native uint32_t values (0xAARRGGBB), which is the
+// byte layout wl_shm defines on little-endian hosts. Like wl_shm, the
+// destination is premultiplied alpha.
+typedef struct {
+    const char *name;
+
+    // Writes count copies of value
+    void (*fill)(uint32_t *dest, uint32_t value, size_t count);
+
+    // Composites premultiplied src over dest (Porter-Duff "over")
+    void (*blend_over)(uint32_t *dest, const uint32_t *src, size_t count);
+} blit_ops_t;
+
+// Returns the fastest implementation supported by the running CPU
+const blit_ops_t *blit_get_ops(void);
+
+// Portable reference implementation
+const blit_ops_t *blit_get_scalar_ops(void);
+
+static inline uint32_t blit_pack_argb(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return ((uint32_t)a << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+#endif // BLIT_H
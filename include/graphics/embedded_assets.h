@@ -2,18 +2,20 @@
 #define EMBEDDED_ASSETS_H
 
 #include <stddef.h>
+#include <stdint.h>
 
-// Embedded asset data
-extern const unsigned char bongo_cat_both_up_png[];
-extern const size_t bongo_cat_both_up_png_size;
-
-extern const unsigned char bongo_cat_left_down_png[];
-extern const size_t bongo_cat_left_down_png_size;
+// Decoded RGBA image, run-length encoded as (count, 0xAABBGGRR) pairs
+typedef struct {
+    int width;
+    int height;
+    const uint32_t *runs;
+    size_t num_runs;
+} embedded_asset_t;
 
-extern const unsigned char bongo_cat_right_down_png[];
-extern const size_t bongo_cat_right_down_png_size;
-
-extern const unsigned char bongo_cat_both_down_png[];
-extern const size_t bongo_cat_both_down_png_size;
+// Embedded asset data
+extern const embedded_asset_t bongo_cat_both_up_png;
+extern const embedded_asset_t bongo_cat_left_down_png;
+extern const embedded_asset_t bongo_cat_right_down_png;
+extern const embedded_asset_t bongo_cat_both_down_png;
 
 #endif // EMBEDDED_ASSETS_H
@@ -0,0 +1,36 @@
+#ifndef GIF_STREAM_H
+#define GIF_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "utils/error.h"
+
+struct gif_stream_decoder;
+
+// Animated GIF decoded one frame at a time from a caller-owned buffer. Each
+// frame is composited over the previous ones, so only the canvas is kept
+// rather than every frame; going back to an earlier frame restarts from the
+// first one.
+typedef struct {
+    const unsigned char *data;
+    size_t size;
+    int width;
+    int height;
+    int num_frames;
+    long *frame_duration_us;            // Per frame display time from the file
+    int next_frame;                     // Frame the decoder produces next
+    struct gif_stream_decoder *decoder;
+} gif_stream_t;
+
+bool gif_stream_is_gif(const unsigned char *data, size_t size);
+
+// Walks the block structure to count frames and read their delays without
+// decompressing any pixel data
+bongocat_error_t gif_stream_open(gif_stream_t *stream, const unsigned char *data, size_t size);
+void gif_stream_close(gif_stream_t *stream);
+
+// Composited RGBA canvas (width * height * 4) of frame index, valid until the
+// next call; NULL if the file is corrupt
+const unsigned char *gif_stream_decode(gif_stream_t *stream, int index);
+
+#endif // GIF_STREAM_H
@@ -0,0 +1,63 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include "config/config.h"
+#include "utils/error.h"
+
+// Named animation states, each playing its own frame sequence
+typedef enum {
+    TIMELINE_STATE_IDLE,
+    TIMELINE_STATE_TYPING,
+    TIMELINE_STATE_SLEEP,
+    TIMELINE_NUM_STATES
+} timeline_state_t;
+
+typedef enum {
+    TIMELINE_EVENT_KEY,      // Key press or test animation
+    TIMELINE_EVENT_RELEASE,  // Key hold elapsed
+    TIMELINE_EVENT_SLEEP,    // Scheduled or idle sleep began
+    TIMELINE_EVENT_WAKE,     // Sleep ended
+    TIMELINE_NUM_EVENTS
+} timeline_event_t;
+
+typedef struct {
+    int frame;
+    long duration_us;  // 0 holds the frame until the next event
+} timeline_step_t;
+
+// Every state's sequence flattened into one step array. The successor of each
+// step and the entry step of each state are precomputed, so advancing costs
+// one table lookup whatever the sequence length.
+typedef struct {
+    timeline_step_t *steps;
+    int *next;                              // Following step, wrapping within the state
+    int first[TIMELINE_NUM_STATES];
+    int length[TIMELINE_NUM_STATES];
+    long cycle_us[TIMELINE_NUM_STATES];     // Whole sequence duration, 0 if a step holds
+    int num_steps;
+} timeline_t;
+
+// Playback position; only valid for the timeline it was reset against
+typedef struct {
+    timeline_state_t state;
+    int step;
+    long step_until_us;                     // End of the current step, 0 while it holds
+    int last_typing_step;                   // Typing resumes after this step
+} timeline_cursor_t;
+
+// Builds the sequences from the *_sequence config keys ("frame[:ms],...");
+// frames at or past num_frames are dropped with a warning. frame_duration_us
+// holds each frame's own display time for animations that carry one, or NULL.
+bongocat_error_t timeline_build(timeline_t *timeline, const config_t *config, int num_frames,
+                                const long *frame_duration_us);
+void timeline_free(timeline_t *timeline);
+
+void timeline_reset(const timeline_t *timeline, timeline_cursor_t *cursor,
+                    timeline_state_t state, long now_us);
+void timeline_dispatch(const timeline_t *timeline, timeline_cursor_t *cursor,
+                       timeline_event_t event, long now_us);
+
+// Advances past elapsed steps; returns the frame to show
+int timeline_tick(const timeline_t *timeline, timeline_cursor_t *cursor, long now_us);
+
+#endif // TIMELINE_H
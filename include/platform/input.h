@@ -4,10 +4,19 @@
 #include "core/bongocat.h"
 #include "utils/error.h"
 
-extern int *any_key_pressed;
+// One key press, queued in the order the devices reported them
+typedef struct {
+    long time_us;       // evdev timestamp, CLOCK_MONOTONIC
+    uint16_t device;    // Index among the monitored devices
+    uint16_t keycode;
+} input_key_event_t;
 
 bongocat_error_t input_start_monitoring(char **device_paths, int num_devices, int enable_debug);
 bongocat_error_t input_restart_monitoring(char **device_paths, int num_devices, int enable_debug);
 void input_cleanup(void);
 
+// Takes the oldest queued press; only the animation thread consumes
+bool input_pop_key_event(input_key_event_t *event);
+bool input_has_key_events(void);
+
 #endif // INPUT_H
\ No newline at end of file
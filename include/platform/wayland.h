@@ -16,9 +16,7 @@ extern struct zwlr_layer_shell_v1 *layer_shell;
 extern struct xdg_wm_base *xdg_wm_base;
 extern struct wl_output *output;
 extern struct wl_surface *surface;
-extern struct wl_buffer *buffer;
 extern struct zwlr_layer_surface_v1 *layer_surface;
-extern uint8_t *pixels;
 extern bool configured;
 extern bool fullscreen_detected;
 
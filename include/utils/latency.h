@@ -0,0 +1,30 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+
+// Log-linear histogram of microsecond latencies in the style of HdrHistogram:
+// each power of two is split into LATENCY_SUB_BUCKETS buckets, so every
+// recorded value keeps about 3% precision from 1 us up to two minutes
+#define LATENCY_SUB_BUCKET_BITS 5
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BUCKET_BITS)
+#define LATENCY_MAGNITUDES 22
+#define LATENCY_NUM_BUCKETS ((LATENCY_MAGNITUDES + 1) * LATENCY_SUB_BUCKETS)
+
+typedef struct {
+    uint32_t counts[LATENCY_NUM_BUCKETS];
+    uint64_t total;
+    long max_us;
+} latency_histogram_t;
+
+// Values past the last bucket count in it; negative values count as 0
+void latency_record(latency_histogram_t *histogram, long value_us);
+void latency_reset(latency_histogram_t *histogram);
+
+// Highest value equivalent to the given rank, permille in 0..1000; 0 when empty
+long latency_percentile(const latency_histogram_t *histogram, int permille);
+
+// Logs count, p50, p99 and max at info level
+void latency_log_summary(const latency_histogram_t *histogram, const char *name);
+
+#endif // LATENCY_H
@@ -0,0 +1,129 @@
+/* qoi.h - decoder for the "Quite OK Image" format (https://qoiformat.org)
+
+   Decode only, always to 8-bit RGBA. Single header in the style of stb:
+
+      #define QOI_IMPLEMENTATION
+      #include "qoi.h"
+
+   in *one* C file. #define QOI_MALLOC before the include to use another
+   allocator; the returned buffer is released with its matching free.
+
+   The format is specified at https://qoiformat.org/qoi-specification.pdf
+*/
+
+#ifndef QOI_H
+#define QOI_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns width * height * 4 bytes of RGBA, or NULL if data is not a valid image
+unsigned char *qoi_decode_rgba(const unsigned char *data, size_t size, int *width, int *height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QOI_H
+
+#ifdef QOI_IMPLEMENTATION
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef QOI_MALLOC
+#include <stdlib.h>
+#define QOI_MALLOC(size) malloc(size)
+#endif
+
+#define QOI_OP_INDEX 0x00  // 00xxxxxx
+#define QOI_OP_DIFF  0x40  // 01xxxxxx
+#define QOI_OP_LUMA  0x80  // 10xxxxxx
+#define QOI_OP_RUN   0xc0  // 11xxxxxx
+#define QOI_OP_RGB   0xfe  // 11111110
+#define QOI_OP_RGBA  0xff  // 11111111
+#define QOI_MASK_2   0xc0
+
+#define QOI_HEADER_SIZE 14
+#define QOI_PADDING_SIZE 8
+#define QOI_PIXELS_MAX 400000000u
+
+static uint32_t qoi__read_be32(const unsigned char *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+unsigned char *qoi_decode_rgba(const unsigned char *data, size_t size, int *width, int *height) {
+    if (!data || size < QOI_HEADER_SIZE + QOI_PADDING_SIZE || memcmp(data, "qoif", 4) != 0) {
+        return NULL;
+    }
+
+    const uint32_t w = qoi__read_be32(data + 4);
+    const uint32_t h = qoi__read_be32(data + 8);
+    const unsigned char channels = data[12];
+    const unsigned char colorspace = data[13];
+    if (w == 0 || h == 0 || channels < 3 || channels > 4 || colorspace > 1 ||
+        h >= QOI_PIXELS_MAX / w) {
+        return NULL;
+    }
+
+    const size_t total = (size_t)w * h;
+    unsigned char *pixels = QOI_MALLOC(total * 4);
+    if (!pixels) {
+        return NULL;
+    }
+
+    unsigned char index[64][4];
+    unsigned char px[4] = {0, 0, 0, 255};
+    memset(index, 0, sizeof(index));
+
+    // Every op reads at most 5 bytes; the 8 byte end marker keeps that in bounds
+    const size_t chunks_len = size - QOI_PADDING_SIZE;
+    size_t p = QOI_HEADER_SIZE;
+    unsigned int run = 0;
+
+    for (size_t i = 0; i < total; i++) {
+        if (run > 0) {
+            run--;
+        } else if (p < chunks_len) {
+            const unsigned char b1 = data[p++];
+
+            if (b1 == QOI_OP_RGB) {
+                px[0] = data[p++];
+                px[1] = data[p++];
+                px[2] = data[p++];
+            } else if (b1 == QOI_OP_RGBA) {
+                px[0] = data[p++];
+                px[1] = data[p++];
+                px[2] = data[p++];
+                px[3] = data[p++];
+            } else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+                memcpy(px, index[b1], 4);
+            } else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+                px[0] = (unsigned char)(px[0] + ((b1 >> 4) & 0x03) - 2);
+                px[1] = (unsigned char)(px[1] + ((b1 >> 2) & 0x03) - 2);
+                px[2] = (unsigned char)(px[2] + (b1 & 0x03) - 2);
+            } else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+                const unsigned char b2 = data[p++];
+                const int vg = (b1 & 0x3f) - 32;
+                px[0] = (unsigned char)(px[0] + vg - 8 + ((b2 >> 4) & 0x0f));
+                px[1] = (unsigned char)(px[1] + vg);
+                px[2] = (unsigned char)(px[2] + vg - 8 + (b2 & 0x0f));
+            } else {
+                run = b1 & 0x3f;
+            }
+
+            memcpy(index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64], px, 4);
+        }
+
+        memcpy(pixels + i * 4, px, 4);
+    }
+
+    *width = (int)w;
+    *height = (int)h;
+    return pixels;
+}
+
+#endif // QOI_IMPLEMENTATION
@@ -0,0 +1,178 @@
+// Host tool: measures the packed frame cache at 4, 32 and 256 frames. Writes
+// a sprite sheet of that many cells cut from the embedded art, each shifted
+// a little so every frame differs, builds it through the animation module
+// and reports the atlas size, the build time and the cost of compositing
+// each frame in turn. Disk cache entries go to a scratch directory.
+//
+// Usage: bench_atlas   (see `make bench-atlas`)
+
+#define _XOPEN_SOURCE 700
+#include "graphics/animation.h"
+#include "platform/input.h"
+#include "platform/wayland.h"
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_CELL_WIDTH 216   // A quarter of the embedded art
+#define BENCH_CELL_HEIGHT 90
+#define BENCH_COLUMNS 16
+#define BENCH_BUILD_ROUNDS 5
+#define BENCH_DRAWS 20000
+
+// The animation module draws through the Wayland layer and takes key
+// presses from the input thread; neither runs here
+void draw_bar(void) {}
+bool input_pop_key_event(input_key_event_t *event) {
+    (void)event;
+    return false;
+}
+bool input_has_key_events(void) {
+    return false;
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Cell i is embedded frame i % NUM_FRAMES, subsampled and moved right by
+// i / NUM_FRAMES pixels
+static bool write_sheet(const char *path, int num_frames) {
+    const int columns = num_frames < BENCH_COLUMNS ? num_frames : BENCH_COLUMNS;
+    const int rows = (num_frames + columns - 1) / columns;
+    const int width = columns * BENCH_CELL_WIDTH;
+    const int height = rows * BENCH_CELL_HEIGHT;
+    unsigned char *pixels = calloc((size_t)width * height, 4);
+    if (!pixels) {
+        return false;
+    }
+
+    for (int i = 0; i < num_frames; i++) {
+        const int f = i % NUM_FRAMES;
+        const int shift = i / NUM_FRAMES;
+        const int x0 = (i % columns) * BENCH_CELL_WIDTH;
+        const int y0 = (i / columns) * BENCH_CELL_HEIGHT;
+        for (int y = 0; y < BENCH_CELL_HEIGHT; y++) {
+            const int sy = y * anim_height[f] / BENCH_CELL_HEIGHT;
+            for (int x = shift; x < BENCH_CELL_WIDTH; x++) {
+                const int sx = (x - shift) * anim_width[f] / BENCH_CELL_WIDTH;
+                memcpy(pixels + ((size_t)(y0 + y) * width + x0 + x) * 4,
+                       anim_imgs[f] + ((size_t)sy * anim_width[f] + sx) * 4, 4);
+            }
+        }
+    }
+
+    FILE *file = fopen(path, "wb");
+    bool ok = file != NULL;
+    if (ok) {
+        fprintf(file, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n",
+                width, height);
+        ok = fwrite(pixels, 4, (size_t)width * height, file) == (size_t)width * height;
+        ok = fclose(file) == 0 && ok;
+    }
+    free(pixels);
+    return ok;
+}
+
+static int remove_entry(const char *path, const struct stat *st, int flag, struct FTW *ftw) {
+    (void)st;
+    (void)flag;
+    (void)ftw;
+    return remove(path);
+}
+
+static int bench(config_t *config, int num_frames, int cat_height) {
+    config->animation_sheet_frames = num_frames;
+    config->animation_sheet_columns = num_frames < BENCH_COLUMNS ? num_frames : BENCH_COLUMNS;
+    config->cat_height = cat_height;
+
+    // The first build fills the disk cache; the best one reads it back
+    double build_us = 0;
+    for (int round = 0; round < BENCH_BUILD_ROUNDS; round++) {
+        const double start = now_us();
+        animation_update_config(config);
+        const double elapsed = now_us() - start;
+        if (round == 0 || elapsed < build_us) {
+            build_us = elapsed;
+        }
+    }
+
+    pthread_mutex_lock(&anim_lock);
+    const int width = anim_frame_cache.width;
+    const int height = anim_frame_cache.height;
+    const int frames = anim_frame_cache.num_frames;
+    const size_t atlas_bytes = anim_frame_cache.atlas ? anim_frame_cache.atlas->used : 0;
+    pthread_mutex_unlock(&anim_lock);
+    if (frames != num_frames) {
+        fprintf(stderr, "Built %d frames instead of %d\n", frames, num_frames);
+        return 1;
+    }
+
+    uint8_t *buffer = calloc((size_t)width * height, 4);
+    if (!buffer) {
+        return 1;
+    }
+    const double start = now_us();
+    for (int i = 0; i < BENCH_DRAWS; i++) {
+        blit_cached_frame(buffer, width, height, i % frames, 0, 0);
+    }
+    const double draw_ns = (now_us() - start) * 1e3 / BENCH_DRAWS;
+    free(buffer);
+
+    char size[32];
+    snprintf(size, sizeof(size), "%dx%d", width, height);
+    printf("  %-8s %6d %12zu B %9.2f ms %10.0f ns\n", size, frames, atlas_bytes, build_us / 1e3,
+           draw_ns);
+    return 0;
+}
+
+int main(void) {
+    static const int frame_counts[] = {4, 32, 256};
+    static const int heights[] = {40, 200};
+
+    char dir[] = "/tmp/bongocat-bench-XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    char sheet[sizeof(dir) + 16];
+    snprintf(sheet, sizeof(sheet), "%s/sheet.pam", dir);
+    setenv("XDG_CACHE_HOME", dir, 1);
+
+    config_t config;
+    int status = 1;
+    if (load_config(&config, "/dev/null") != BONGOCAT_SUCCESS ||
+        animation_init(&config) != BONGOCAT_SUCCESS ||
+        animation_wait_ready() != BONGOCAT_SUCCESS) {
+        fprintf(stderr, "Cannot set up the animation module\n");
+        nftw(dir, remove_entry, 8, FTW_DEPTH | FTW_PHYS);
+        return 1;
+    }
+    bongocat_error_init(0);
+    config.animation_sheet = strdup(sheet);
+
+    printf("Sprite sheet frames, best of %d builds, %d draws cycling every frame\n",
+           BENCH_BUILD_ROUNDS, BENCH_DRAWS);
+    printf("  %-8s %6s %14s %12s %13s\n", "cat", "frames", "atlas", "build", "draw/frame");
+    status = 0;
+    for (size_t n = 0; n < sizeof(frame_counts) / sizeof(frame_counts[0]) && status == 0; n++) {
+        if (!config.animation_sheet || !write_sheet(sheet, frame_counts[n])) {
+            fprintf(stderr, "Cannot write %s\n", sheet);
+            status = 1;
+            break;
+        }
+        for (size_t h = 0; h < sizeof(heights) / sizeof(heights[0]) && status == 0; h++) {
+            status = bench(&config, frame_counts[n], heights[h]);
+        }
+    }
+
+    animation_cleanup();
+    config_cleanup_full(&config);
+    nftw(dir, remove_entry, 8, FTW_DEPTH | FTW_PHYS);
+    return status;
+}
@@ -0,0 +1,188 @@
+// Host tool: compares decode throughput of PNG (stb_image), QOI and raw PAM
+// for the given images. QOI and PAM versions are encoded in memory from the
+// PNGs, and each decode is checked against the PNG pixels.
+//
+// Usage: bench_decode <image.png>...   (see `make bench-decode`)
+
+#define _POSIX_C_SOURCE 200809L
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#define QOI_IMPLEMENTATION
+#include "qoi.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ROUNDS 50
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static unsigned char *read_file(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char *data = len > 0 ? malloc((size_t)len) : NULL;
+    if (data && fread(data, 1, (size_t)len, file) != (size_t)len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = (size_t)len;
+    return data;
+}
+
+// Reference QOI encoder (https://qoiformat.org), RGBA input
+static unsigned char *qoi_encode_rgba(const unsigned char *px_in, int w, int h, size_t *out_size) {
+    const size_t total = (size_t)w * h;
+    unsigned char *out = malloc(14 + total * 5 + 8);
+    size_t p = 0;
+    memcpy(out, "qoif", 4);
+    p = 4;
+    for (int shift = 24; shift >= 0; shift -= 8) out[p++] = (unsigned char)((uint32_t)w >> shift);
+    for (int shift = 24; shift >= 0; shift -= 8) out[p++] = (unsigned char)((uint32_t)h >> shift);
+    out[p++] = 4;
+    out[p++] = 0;
+
+    unsigned char index[64][4] = {{0}};
+    unsigned char prev[4] = {0, 0, 0, 255};
+    int run = 0;
+    for (size_t i = 0; i < total; i++) {
+        const unsigned char *px = px_in + i * 4;
+        if (memcmp(px, prev, 4) == 0) {
+            run++;
+            if (run == 62 || i == total - 1) {
+                out[p++] = (unsigned char)(0xc0 | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            out[p++] = (unsigned char)(0xc0 | (run - 1));
+            run = 0;
+        }
+
+        int hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+        if (memcmp(index[hash], px, 4) == 0) {
+            out[p++] = (unsigned char)hash;
+        } else {
+            memcpy(index[hash], px, 4);
+            if (px[3] == prev[3]) {
+                int vr = px[0] - prev[0], vg = px[1] - prev[1], vb = px[2] - prev[2];
+                vr = (signed char)vr; vg = (signed char)vg; vb = (signed char)vb;
+                int vg_r = vr - vg, vg_b = vb - vg;
+                if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+                    out[p++] = (unsigned char)(0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+                } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+                    out[p++] = (unsigned char)(0x80 | (vg + 32));
+                    out[p++] = (unsigned char)((vg_r + 8) << 4 | (vg_b + 8));
+                } else {
+                    out[p++] = 0xfe;
+                    memcpy(out + p, px, 3);
+                    p += 3;
+                }
+            } else {
+                out[p++] = 0xff;
+                memcpy(out + p, px, 4);
+                p += 4;
+            }
+        }
+        memcpy(prev, px, 4);
+    }
+    static const unsigned char padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+    memcpy(out + p, padding, 8);
+    *out_size = p + 8;
+    return out;
+}
+
+static unsigned char *pam_encode_rgba(const unsigned char *px, int w, int h, size_t *out_size) {
+    char header[128];
+    int n = snprintf(header, sizeof(header),
+                     "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", w, h);
+    size_t bytes = (size_t)w * h * 4;
+    unsigned char *out = malloc((size_t)n + bytes);
+    memcpy(out, header, (size_t)n);
+    memcpy(out + n, px, bytes);
+    *out_size = (size_t)n + bytes;
+    return out;
+}
+
+static void report(const char *name, size_t file_size, double ms, size_t pixel_bytes, int ok) {
+    printf("  %-4s %8zu bytes  %8.3f ms  %8.1f MB/s%s\n", name, file_size, ms,
+           pixel_bytes / (ms * 1e3), ok ? "" : "  MISMATCH");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <image.png>...\n", argv[0]);
+        return 1;
+    }
+
+    int status = 0;
+    for (int a = 1; a < argc; a++) {
+        size_t png_size;
+        unsigned char *png = read_file(argv[a], &png_size);
+        int w, h;
+        unsigned char *ref = png ? stbi_load_from_memory(png, (int)png_size, &w, &h, NULL, 4) : NULL;
+        if (!ref) {
+            fprintf(stderr, "%s: cannot decode\n", argv[a]);
+            free(png);
+            status = 1;
+            continue;
+        }
+        const size_t pixel_bytes = (size_t)w * h * 4;
+
+        size_t qoi_size, pam_size;
+        unsigned char *qoi = qoi_encode_rgba(ref, w, h, &qoi_size);
+        unsigned char *pam = pam_encode_rgba(ref, w, h, &pam_size);
+        double best_png = 1e9, best_qoi = 1e9, best_pam = 1e9;
+        int ok_png = 1, ok_qoi = 1, ok_pam = 1;
+
+        for (int round = 0; round < BENCH_ROUNDS; round++) {
+            int dw, dh;
+            double t0 = now_ms();
+            unsigned char *d = stbi_load_from_memory(png, (int)png_size, &dw, &dh, NULL, 4);
+            double t1 = now_ms();
+            ok_png &= d && memcmp(d, ref, pixel_bytes) == 0;
+            stbi_image_free(d);
+            if (t1 - t0 < best_png) best_png = t1 - t0;
+
+            t0 = now_ms();
+            d = qoi_decode_rgba(qoi, qoi_size, &dw, &dh);
+            t1 = now_ms();
+            ok_qoi &= d && memcmp(d, ref, pixel_bytes) == 0;
+            free(d);
+            if (t1 - t0 < best_qoi) best_qoi = t1 - t0;
+
+            // Raw pixels are used in place; time one pass reading them
+            t0 = now_ms();
+            const unsigned char *raw = pam + (pam_size - pixel_bytes);
+            uint32_t sum = 0;
+            for (size_t i = 0; i < pixel_bytes; i += 4) sum += raw[i + 3];
+            t1 = now_ms();
+            ok_pam &= memcmp(raw, ref, pixel_bytes) == 0 && sum != 0xFFFFFFFFu;
+            if (t1 - t0 < best_pam) best_pam = t1 - t0;
+        }
+
+        printf("%s (%dx%d), best of %d:\n", argv[a], w, h, BENCH_ROUNDS);
+        report("png", png_size, best_png, pixel_bytes, ok_png);
+        report("qoi", qoi_size, best_qoi, pixel_bytes, ok_qoi);
+        report("pam", pam_size, best_pam, pixel_bytes, ok_pam);
+        status |= !(ok_png && ok_qoi && ok_pam);
+
+        free(png);
+        free(qoi);
+        free(pam);
+        stbi_image_free(ref);
+    }
+    return status;
+}
@@ -0,0 +1,99 @@
+// Host tool: shows that resampling the cat is paid when the frame cache is
+// built, not when a frame is drawn. Builds the embedded frames at several
+// cat heights through animation_update_config(), which resamples, encodes
+// and packs every frame, and compares that with compositing a cached frame
+// the way the overlay does on every change.
+//
+// Usage: bench_resample   (see `make bench-resample`)
+
+#define _POSIX_C_SOURCE 200809L
+#include "graphics/animation.h"
+#include "platform/input.h"
+#include "platform/wayland.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_BUILD_ROUNDS 5
+#define BENCH_DRAW_ROUNDS 20000
+
+// The animation module draws through the Wayland layer and takes key
+// presses from the input thread; neither runs here
+void draw_bar(void) {}
+bool input_pop_key_event(input_key_event_t *event) {
+    (void)event;
+    return false;
+}
+bool input_has_key_events(void) {
+    return false;
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main(void) {
+    static const int heights[] = {40, 60, 120, 200};
+
+    config_t config;
+    if (load_config(&config, "/dev/null") != BONGOCAT_SUCCESS ||
+        animation_init(&config) != BONGOCAT_SUCCESS ||
+        animation_wait_ready() != BONGOCAT_SUCCESS) {
+        fprintf(stderr, "Cannot set up the animation module\n");
+        return 1;
+    }
+    bongocat_error_init(0);
+
+    printf("Embedded frames, best of %d builds, %d draws per size\n", BENCH_BUILD_ROUNDS,
+           BENCH_DRAW_ROUNDS);
+    printf("  %-9s %12s %14s %10s\n", "cat", "build (load)", "draw (frame)", "ratio");
+
+    int status = 0;
+    for (size_t h = 0; h < sizeof(heights) / sizeof(heights[0]); h++) {
+        config.cat_height = heights[h];
+
+        double build_us = 0;
+        for (int round = 0; round < BENCH_BUILD_ROUNDS; round++) {
+            const double start = now_us();
+            animation_update_config(&config);
+            const double elapsed = now_us() - start;
+            if (round == 0 || elapsed < build_us) {
+                build_us = elapsed;
+            }
+        }
+
+        pthread_mutex_lock(&anim_lock);
+        const int width = anim_frame_cache.width;
+        const int height = anim_frame_cache.height;
+        const int num_frames = anim_frame_cache.num_frames;
+        pthread_mutex_unlock(&anim_lock);
+
+        uint8_t *buffer = calloc((size_t)width * height, 4);
+        if (!buffer || num_frames <= 0) {
+            fprintf(stderr, "No frame cache at height %d\n", heights[h]);
+            free(buffer);
+            status = 1;
+            continue;
+        }
+
+        // The overlay composites the new frame over the cleared cat area
+        const double start = now_us();
+        for (int i = 0; i < BENCH_DRAW_ROUNDS; i++) {
+            blit_cached_frame(buffer, width, height, i % num_frames, 0, 0);
+        }
+        const double draw_us = (now_us() - start) / BENCH_DRAW_ROUNDS;
+        free(buffer);
+
+        char size[32];
+        snprintf(size, sizeof(size), "%dx%d", width, height);
+        printf("  %-9s %9.2f ms %11.2f us %9.0fx\n", size, build_us / 1e3, draw_us,
+               build_us / (draw_us * num_frames));
+    }
+    printf("ratio: building one frame vs drawing it once\n");
+
+    animation_cleanup();
+    config_cleanup_full(&config);
+    return status;
+}
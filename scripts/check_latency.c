@@ -0,0 +1,73 @@
+// Host tool: checks the latency histogram's bucket bounds and percentiles,
+// including values at and past the last magnitude (2^27 us and up), which
+// all land in the last bucket. Built with sanitizers so an out-of-range
+// bucket index fails loudly.
+//
+// Usage: check_latency   (see `make check-latency`)
+
+#include "utils/latency.h"
+#include <limits.h>
+#include <stdio.h>
+
+static int failures = 0;
+
+static void expect(long got, long want, const char *what) {
+    if (got != want) {
+        fprintf(stderr, "FAIL %s: got %ld, want %ld\n", what, got, want);
+        failures++;
+    }
+}
+
+// Every recorded value must come back within one bucket width (1/32) above
+static void check_precision(latency_histogram_t *histogram, long value) {
+    latency_reset(histogram);
+    latency_record(histogram, value);
+    latency_record(histogram, value + value / 2 + 1);  // Keeps the max from clamping p50
+
+    const long p50 = latency_percentile(histogram, 500);
+    if (p50 < value || p50 > value + value / LATENCY_SUB_BUCKETS) {
+        fprintf(stderr, "FAIL precision of %ld: p50 %ld\n", value, p50);
+        failures++;
+    }
+}
+
+int main(void) {
+    static latency_histogram_t histogram;
+
+    for (long value = 0; value < (1L << 27); value = value * 5 / 4 + 1) {
+        check_precision(&histogram, value);
+    }
+
+    // At and past the last magnitude: clamped into the last bucket, and the
+    // percentiles fall back to the exact maximum
+    const long past_range[] = {
+        (1L << 27) - 1, 1L << 27, (1L << 27) + 1, 200000000L, 1L << 28, 1L << 40, LONG_MAX,
+    };
+    for (size_t i = 0; i < sizeof(past_range) / sizeof(past_range[0]); i++) {
+        latency_reset(&histogram);
+        latency_record(&histogram, past_range[i]);
+        expect(latency_percentile(&histogram, 500), past_range[i], "p50 of one large value");
+        expect(latency_percentile(&histogram, 1000), past_range[i], "p100 of one large value");
+    }
+
+    latency_reset(&histogram);
+    for (int i = 0; i < 99; i++) {
+        latency_record(&histogram, 1000);
+    }
+    latency_record(&histogram, 300000000L);  // Screen locked for five minutes
+    expect(histogram.counts[LATENCY_NUM_BUCKETS - 1], 1, "last bucket count");
+    expect(latency_percentile(&histogram, 990) <= 1000 + 1000 / LATENCY_SUB_BUCKETS, 1, "p99 bound");
+    expect(latency_percentile(&histogram, 1000), 300000000L, "p100 with outlier");
+
+    latency_reset(&histogram);
+    latency_record(&histogram, -5);
+    expect(histogram.counts[0], 1, "negative value bucket");
+    expect(latency_percentile(&histogram, 500), 0, "p50 of a negative value");
+
+    if (failures) {
+        fprintf(stderr, "%d latency histogram check(s) failed\n", failures);
+        return 1;
+    }
+    printf("Latency histogram checks passed\n");
+    return 0;
+}
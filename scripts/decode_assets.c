@@ -0,0 +1,51 @@
+// Host tool used by embed_assets.sh: decodes a PNG and prints it as C source
+// holding run-length encoded RGBA pixels, so the binary does no inflate work.
+//
+// Usage: decode_assets <image.png> <c_identifier>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <image.png> <c_identifier>\n", argv[0]);
+        return 1;
+    }
+
+    int width, height;
+    unsigned char *pixels = stbi_load(argv[1], &width, &height, NULL, 4);
+    if (!pixels) {
+        fprintf(stderr, "%s: %s\n", argv[1], stbi_failure_reason());
+        return 1;
+    }
+
+    // Runs are (count, 0xAABBGGRR) pairs
+    const size_t total = (size_t)width * height;
+    size_t num_runs = 0;
+    printf("static const uint32_t %s_runs[] = {\n", argv[2]);
+    for (size_t i = 0; i < total;) {
+        const unsigned char *p = pixels + i * 4;
+        uint32_t value = (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+                         ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        size_t count = 1;
+        while (i + count < total && memcmp(p, p + count * 4, 4) == 0) {
+            count++;
+        }
+        printf("%s0x%zx, 0x%08x,", num_runs % 4 == 0 ? "  " : " ", count, value);
+        if (++num_runs % 4 == 0) {
+            printf("\n");
+        }
+        i += count;
+    }
+    printf("%s};\n\n", num_runs % 4 == 0 ? "" : "\n");
+
+    printf("const embedded_asset_t %s = {\n", argv[2]);
+    printf("    .width = %d,\n    .height = %d,\n", width, height);
+    printf("    .runs = %s_runs,\n    .num_runs = %zu,\n};\n\n", argv[2], num_runs);
+
+    stbi_image_free(pixels);
+    return 0;
+}
@@ -1,45 +1,54 @@
-# Script to convert PNG assets to C header files for embedding
+# Script to convert PNG assets to pre-decoded C arrays for embedding
 # NOTE: This script should be run manually when assets change.
 # The generated files are committed to git and not generated during build.
 
 ASSETS_DIR="assets"
 OUTPUT_DIR="include/graphics"
 OUTPUT_FILE="$OUTPUT_DIR/embedded_assets.h"
+DECODER_SRC="scripts/decode_assets.c"
+DECODER="$(mktemp)"
+
+trap 'rm -f "$DECODER"' EXIT
+
+echo "Building asset decoder..."
+${HOST_CC:-cc} -O2 -Ilib -o "$DECODER" "$DECODER_SRC" -lm || exit 1
 
 echo "Generating embedded assets header..."
 
 # Create header file
-cat > "$OUTPUT_FILE" << 'EOF'
+cat > "$OUTPUT_FILE" << 'EOF_H'
 #ifndef EMBEDDED_ASSETS_H
 #define EMBEDDED_ASSETS_H
 
 #include <stddef.h>
+#include <stdint.h>
 
-// Embedded asset data
-extern const unsigned char bongo_cat_both_up_png[];
-extern const size_t bongo_cat_both_up_png_size;
-
-extern const unsigned char bongo_cat_left_down_png[];
-extern const size_t bongo_cat_left_down_png_size;
+// Decoded RGBA image, run-length encoded as (count, 0xAABBGGRR) pairs
+typedef struct {
+    int width;
+    int height;
+    const uint32_t *runs;
+    size_t num_runs;
+} embedded_asset_t;
 
-extern const unsigned char bongo_cat_right_down_png[];
-extern const size_t bongo_cat_right_down_png_size;
-
-extern const unsigned char bongo_cat_both_down_png[];
-extern const size_t bongo_cat_both_down_png_size;
+// Embedded asset data
+extern const embedded_asset_t bongo_cat_both_up_png;
+extern const embedded_asset_t bongo_cat_left_down_png;
+extern const embedded_asset_t bongo_cat_right_down_png;
+extern const embedded_asset_t bongo_cat_both_down_png;
 
 #endif // EMBEDDED_ASSETS_H
-EOF
+EOF_H
 
 # Create source file with embedded data
 OUTPUT_C_FILE="src/graphics/embedded_assets.c"
 
-cat > "$OUTPUT_C_FILE" << 'EOF'
+cat > "$OUTPUT_C_FILE" << 'EOF_C'
 #include "graphics/embedded_assets.h"
 
-EOF
+EOF_C
 
-# Convert each PNG to C array
+# Decode each PNG into run-length encoded pixels
 for asset in "bongo-cat-both-up.png" "bongo-cat-left-down.png" "bongo-cat-right-down.png" "bongo-cat-both-down.png"; do
     if [ -f "$ASSETS_DIR/$asset" ]; then
         echo "Embedding $asset..."
@@ -47,14 +56,7 @@ for asset in "bongo-cat-both-up.png" "bongo-cat-left-down.png" "bongo-cat-right-
         # Convert filename to C identifier
         c_name=$(echo "$asset" | sed 's/[^a-zA-Z0-9]/_/g')
         
-        # Generate C array using xxd
-        xxd -i "$ASSETS_DIR/$asset" | sed "s/unsigned char.*\[\]/const unsigned char ${c_name}[]/" >> "$OUTPUT_C_FILE"
-        echo "" >> "$OUTPUT_C_FILE"
-        
-        # Add size variable
-        size=$(stat -c%s "$ASSETS_DIR/$asset")
-        echo "const size_t ${c_name}_size = $size;" >> "$OUTPUT_C_FILE"
-        echo "" >> "$OUTPUT_C_FILE"
+        "$DECODER" "$ASSETS_DIR/$asset" "$c_name" >> "$OUTPUT_C_FILE" || exit 1
     else
         echo "Warning: $ASSETS_DIR/$asset not found"
     fi
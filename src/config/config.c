@@ -17,6 +17,8 @@
 #define MIN_DURATION 10
 #define MAX_DURATION 5000
 #define MAX_INTERVAL 3600
+#define MIN_SHEET_FRAMES 1
+#define MAX_GIF_CACHE_KB (1024 * 1024)
 
 // =============================================================================
 // GLOBAL STATE FOR DEVICE MANAGEMENT
@@ -58,10 +60,23 @@ static void config_validate_appearance(config_t *config) {
     // Validate opacity
     config_clamp_int(&config->overlay_opacity, 0, 255, "overlay_opacity");
 
-    // Validate idle frame
-    if (config->idle_frame < 0 || config->idle_frame >= NUM_FRAMES) {
+    if (config->animation_sheet) {
+        config_clamp_int(&config->animation_sheet_frames, MIN_SHEET_FRAMES, MAX_FRAMES,
+                         "animation_sheet_frames");
+        config_clamp_int(&config->animation_sheet_columns, 0, config->animation_sheet_frames,
+                         "animation_sheet_columns");
+    }
+
+    config_clamp_int(&config->animation_gif_cache_kb, 0, MAX_GIF_CACHE_KB, "animation_gif_cache_kb");
+
+    // Validate idle frame; a GIF's frame count is only known once it is opened
+    int num_frames = config->animation_sheet ? config->animation_sheet_frames : NUM_FRAMES;
+    if (config->animation_gif) {
+        num_frames = MAX_FRAMES;
+    }
+    if (config->idle_frame < 0 || config->idle_frame >= num_frames) {
         bongocat_log_warning("idle_frame %d out of range [0-%d], resetting to 0",
-                           config->idle_frame, NUM_FRAMES - 1);
+                           config->idle_frame, num_frames - 1);
         config->idle_frame = 0;
     }
 }
@@ -78,6 +93,13 @@ static void config_validate_enums(config_t *config) {
         bongocat_log_warning("Invalid overlay_position %d, resetting to top", config->overlay_position);
         config->overlay_position = POSITION_TOP;
     }
+
+    // Validate overlay_size
+    if (config->overlay_size != OVERLAY_SIZE_SCREEN && config->overlay_size != OVERLAY_SIZE_BAR &&
+        config->overlay_size != OVERLAY_SIZE_CAT) {
+        bongocat_log_warning("Invalid overlay_size %d, resetting to screen", config->overlay_size);
+        config->overlay_size = OVERLAY_SIZE_SCREEN;
+    }
 }
 
 static void config_validate_positioning(config_t *config) {
@@ -107,6 +129,8 @@ static bongocat_error_t config_validate(config_t *config) {
     // Normalize boolean values
     config->enable_debug = config->enable_debug ? 1 : 0;
     config->enable_scheduled_sleep = config->enable_scheduled_sleep ? 1 : 0;
+    config->enable_prerender = config->enable_prerender ? 1 : 0;
+    config->enable_compositor_scaling = config->enable_compositor_scaling ? 1 : 0;
 
     config_validate_dimensions(config);
     config_validate_timing(config);
@@ -201,10 +225,20 @@ static bongocat_error_t config_parse_integer_key(config_t *config, const char *k
         config->overlay_opacity = int_value;
     } else if (strcmp(key, "enable_debug") == 0) {
         config->enable_debug = int_value;
+    } else if (strcmp(key, "enable_prerender") == 0) {
+        config->enable_prerender = int_value;
+    } else if (strcmp(key, "enable_compositor_scaling") == 0) {
+        config->enable_compositor_scaling = int_value;
     } else if (strcmp(key, "enable_scheduled_sleep") == 0) {
         config->enable_scheduled_sleep = int_value;
     } else if (strcmp(key, "idle_sleep_timeout") == 0) {
         config->idle_sleep_timeout_sec = int_value;
+    } else if (strcmp(key, "animation_sheet_frames") == 0) {
+        config->animation_sheet_frames = int_value;
+    } else if (strcmp(key, "animation_sheet_columns") == 0) {
+        config->animation_sheet_columns = int_value;
+    } else if (strcmp(key, "animation_gif_cache_kb") == 0) {
+        config->animation_gif_cache_kb = int_value;
     } else {
         return BONGOCAT_ERROR_INVALID_PARAM; // Unknown key
     }
@@ -231,6 +265,17 @@ static bongocat_error_t config_parse_enum_key(config_t *config, const char *key,
             bongocat_log_warning("Invalid overlay_position '%s', using 'top'", value);
             config->overlay_position = POSITION_TOP;
         }
+    } else if (strcmp(key, "overlay_size") == 0) {
+        if (strcmp(value, "screen") == 0) {
+            config->overlay_size = OVERLAY_SIZE_SCREEN;
+        } else if (strcmp(value, "bar") == 0) {
+            config->overlay_size = OVERLAY_SIZE_BAR;
+        } else if (strcmp(value, "cat") == 0) {
+            config->overlay_size = OVERLAY_SIZE_CAT;
+        } else {
+            bongocat_log_warning("Invalid overlay_size '%s', using 'screen'", value);
+            config->overlay_size = OVERLAY_SIZE_SCREEN;
+        }
     } else if (strcmp(key, "cat_align") == 0) {
         if (strcmp(value, "left") == 0) {
             config->cat_align = ALIGN_LEFT;
@@ -277,8 +322,42 @@ static bongocat_error_t config_parse_time_key(config_t *config, const char *key,
     return BONGOCAT_SUCCESS;
 }
 
+// Config keys of the custom frame images, indexed like asset_paths
+static const char *const config_asset_keys[NUM_FRAMES] = {
+    [BONGOCAT_FRAME_BOTH_UP] = "asset_both_up",
+    [BONGOCAT_FRAME_LEFT_DOWN] = "asset_left_down",
+    [BONGOCAT_FRAME_RIGHT_DOWN] = "asset_right_down",
+    [BONGOCAT_FRAME_BOTH_DOWN] = "asset_both_down",
+};
+
+static bongocat_error_t config_set_string(char **field, const char *key, const char *value) {
+    *field = realloc(*field, strlen(value) + 1);
+    if (!*field) {
+        bongocat_log_error("Failed to allocate memory for %s", key);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    strcpy(*field, value);
+    return BONGOCAT_SUCCESS;
+}
+
 static bongocat_error_t config_parse_string_key(config_t *config, const char *key, const char *value) {
-    if (strcmp(key, "monitor") == 0) {
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        if (strcmp(key, config_asset_keys[i]) == 0) {
+            return config_set_string(&config->asset_paths[i], key, value);
+        }
+    }
+
+    if (strcmp(key, "animation_sheet") == 0) {
+        return config_set_string(&config->animation_sheet, key, value);
+    } else if (strcmp(key, "animation_gif") == 0) {
+        return config_set_string(&config->animation_gif, key, value);
+    } else if (strcmp(key, "idle_sequence") == 0) {
+        return config_set_string(&config->idle_sequence, key, value);
+    } else if (strcmp(key, "typing_sequence") == 0) {
+        return config_set_string(&config->typing_sequence, key, value);
+    } else if (strcmp(key, "sleep_sequence") == 0) {
+        return config_set_string(&config->sleep_sequence, key, value);
+    } else if (strcmp(key, "monitor") == 0) {
         // Reallocate new name for monitor output
         config->output_name = realloc(config->output_name, strlen(value) + 1);
         if (!config->output_name) {
@@ -392,12 +471,15 @@ static void config_set_defaults(config_t *config) {
         .screen_width = DEFAULT_SCREEN_WIDTH,  // Will be updated by Wayland detection
         .output_name = NULL, // Will default to automatic one if kept null
         .bar_height = DEFAULT_BAR_HEIGHT,
-        .asset_paths = {
-            "assets/bongo-cat-both-up.png",
-            "assets/bongo-cat-left-down.png",
-            "assets/bongo-cat-right-down.png",
-            "assets/bongo-cat-both-down.png"
-        },
+        .asset_paths = {NULL}, // Embedded art unless overridden
+        .animation_sheet = NULL,
+        .animation_sheet_frames = NUM_FRAMES,
+        .animation_sheet_columns = 0,
+        .animation_gif = NULL,
+        .animation_gif_cache_kb = 4096,
+        .idle_sequence = NULL,
+        .typing_sequence = NULL,
+        .sleep_sequence = NULL,
         .keyboard_devices = NULL,
         .num_keyboard_devices = 0,
         .cat_x_offset = 100,
@@ -411,8 +493,11 @@ static void config_set_defaults(config_t *config) {
         .fps = 60,
         .overlay_opacity = 150,
         .enable_debug = 1,
+        .enable_prerender = 0,
+        .enable_compositor_scaling = 0,
         .layer = LAYER_TOP,  // Default to TOP for broader compatibility
         .overlay_position = POSITION_TOP,
+        .overlay_size = OVERLAY_SIZE_SCREEN,
         .cat_align = ALIGN_CENTER,
         .enable_scheduled_sleep = 0,
         .sleep_begin = (config_time_t){0, 0},
@@ -445,7 +530,22 @@ static void config_log_summary(const config_t *config) {
                       config->cat_x_offset, config->cat_y_offset);
     bongocat_log_debug("  FPS: %d, Opacity: %d", config->fps, config->overlay_opacity);
     bongocat_log_debug("  Position: %s", config->overlay_position == POSITION_TOP ? "top" : "bottom");
+    bongocat_log_debug("  Size: %s", config->overlay_size == OVERLAY_SIZE_CAT ? "cat" :
+                                     config->overlay_size == OVERLAY_SIZE_BAR ? "bar" : "screen");
     bongocat_log_debug("  Layer: %s", config->layer == LAYER_TOP ? "top" : "overlay");
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        if (config->asset_paths[i]) {
+            bongocat_log_debug("  Frame %d: %s", i, config->asset_paths[i]);
+        }
+    }
+    if (config->animation_sheet) {
+        bongocat_log_debug("  Sheet: %s (%d frames)", config->animation_sheet,
+                           config->animation_sheet_frames);
+    }
+    if (config->animation_gif) {
+        bongocat_log_debug("  GIF: %s (%d KB cache)", config->animation_gif,
+                           config->animation_gif_cache_kb);
+    }
 }
 
 // =============================================================================
@@ -506,6 +606,25 @@ void config_cleanup_full(config_t *config) {
         free(config->output_name);
         config->output_name = NULL;
     }
+
+    config_free_animation(config);
+}
+
+void config_free_animation(config_t *config) {
+    if (!config) return;
+
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        free(config->asset_paths[i]);
+        config->asset_paths[i] = NULL;
+    }
+
+    char **strings[] = {&config->animation_sheet, &config->animation_gif,
+                        &config->idle_sequence, &config->typing_sequence,
+                        &config->sleep_sequence};
+    for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+        free(*strings[i]);
+        *strings[i] = NULL;
+    }
 }
 
 int get_screen_width(void) {
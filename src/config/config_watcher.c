@@ -6,12 +6,21 @@
 #include <string.h>
 #include <unistd.h>
 #include <time.h>
+#include <signal.h>
 #include <sys/select.h>
 
 static void *config_watcher_thread(void *arg) {
     ConfigWatcher *watcher = (ConfigWatcher *)arg;
     char buffer[INOTIFY_BUF_LEN];
     time_t last_reload_time = 0;
+
+    // Leave shutdown signals to the main thread, which blocks in poll()
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGCHLD);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
     
     bongocat_log_info("Config watcher started for: %s", watcher->config_path);
     
@@ -8,7 +8,6 @@
 #include "utils/error.h"
 #include "utils/memory.h"
 #include <signal.h>
-#include <sys/wait.h>
 #include <stdbool.h>
 #include <sys/file.h>
 #include <unistd.h>
@@ -159,10 +158,6 @@ static void signal_handler(int sig) {
             bongocat_log_info("Received signal %d, shutting down gracefully", sig);
             running = 0;
             break;
-        case SIGCHLD:
-            // Handle child process termination
-            while (waitpid(-1, NULL, WNOHANG) > 0);
-            break;
         default:
             bongocat_log_warning("Received unexpected signal %d", sig);
             break;
@@ -187,11 +182,6 @@ static bongocat_error_t signal_setup_handlers(void) {
         return BONGOCAT_ERROR_THREAD;
     }
     
-    if (sigaction(SIGCHLD, &sa, NULL) == -1) {
-        bongocat_log_error("Failed to setup SIGCHLD handler: %s", strerror(errno));
-        return BONGOCAT_ERROR_THREAD;
-    }
-    
     // Ignore SIGPIPE
     signal(SIGPIPE, SIG_IGN);
     
@@ -237,6 +227,9 @@ static void config_reload_callback(const char *config_path) {
         return;
     }
     
+    // The startup asset load reads g_config; let it finish before the swap
+    animation_wait_ready();
+
     // If successful, check if input devices changed before updating config
     bool devices_changed = config_devices_changed(&g_config, &temp_config);
     
@@ -248,12 +241,18 @@ static void config_reload_callback(const char *config_path) {
         free(g_config.output_name);
     }
     
+    // Asset paths and sequences may still be read by a cache build until the update below
+    config_t old_config = g_config;
+    
     // Update the global config
     g_config = temp_config;
     
     // Update the running systems with new config
+    animation_update_config(&g_config);
     wayland_update_config(&g_config);
     
+    config_free_animation(&old_config);
+    
     // Check if input devices changed and restart monitoring if needed
     if (devices_changed) {
         bongocat_log_info("Input devices changed, restarting input monitoring");
@@ -291,6 +290,13 @@ static bongocat_error_t config_setup_watcher(const char *config_file) {
 static bongocat_error_t system_initialize_components(void) {
     bongocat_error_t result;
     
+    // Initialize animation system first so asset decoding overlaps Wayland setup
+    result = animation_init(&g_config);
+    if (result != BONGOCAT_SUCCESS) {
+        bongocat_log_error("Failed to initialize animation system: %s", bongocat_error_string(result));
+        return result;
+    }
+    
     // Initialize Wayland
     result = wayland_init(&g_config);
     if (result != BONGOCAT_SUCCESS) {
@@ -298,12 +304,17 @@ static bongocat_error_t system_initialize_components(void) {
         return result;
     }
     
-    // Initialize animation system
-    result = animation_init(&g_config);
+    // Usually already joined by the first configure
+    result = animation_wait_ready();
     if (result != BONGOCAT_SUCCESS) {
-        bongocat_log_error("Failed to initialize animation system: %s", bongocat_error_string(result));
+        bongocat_log_error("Failed to load animation assets: %s", bongocat_error_string(result));
         return result;
     }
+
+    // A sprite sheet's or GIF's cat width is only known once it is loaded
+    if (g_config.animation_sheet || g_config.animation_gif) {
+        wayland_update_config(&g_config);
+    }
     
     // Start input monitoring
     result = input_start_monitoring(g_config.keyboard_devices, g_config.num_keyboard_devices, g_config.enable_debug);
@@ -1,11 +1,26 @@
-#define _POSIX_C_SOURCE 199309L
-#define STB_IMAGE_IMPLEMENTATION
+#define _POSIX_C_SOURCE 200809L
+#define STBI_NO_STDIO
+#include "../lib/stb_image.h"
 #include "graphics/animation.h"
 #include "platform/wayland.h"
 #include "platform/input.h"
 #include "utils/memory.h"
 #include "graphics/embedded_assets.h"
+#include "graphics/blit.h"
+#include "graphics/asset_cache.h"
+#include "graphics/timeline.h"
+#include "graphics/gif_stream.h"
+#define QOI_IMPLEMENTATION
+#define QOI_MALLOC(size) BONGOCAT_MALLOC(size)
+#include "../lib/qoi.h"
 #include <time.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <limits.h>
+#include <ctype.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 // =============================================================================
 // GLOBAL STATE AND CONFIGURATION
@@ -15,70 +30,1703 @@
 unsigned char *anim_imgs[NUM_FRAMES];
 int anim_width[NUM_FRAMES], anim_height[NUM_FRAMES];
 int anim_index = 0;
+long anim_input_time_us = 0;
 pthread_mutex_t anim_lock = PTHREAD_MUTEX_INITIALIZER;
 
+// Frames scaled to the configured cat size, ready to be copied into the buffer
+anim_frame_cache_t anim_frame_cache;
+
+// Frame sequences of the idle, typing and sleep states, swapped with the cache
+static timeline_t anim_timeline;
+
 // Animation system state
 static config_t *current_config;
 static pthread_t anim_thread;
 static volatile bool animation_running = false;
 
-// =============================================================================
-// DRAWING OPERATIONS MODULE
-// =============================================================================
+// Startup asset loading, joined by animation_wait_ready() on the first
+// configure, or by a config reload before it replaces the config the loader reads
+static pthread_t anim_loader_thread;
+static pthread_mutex_t anim_loader_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool anim_loader_pending = false;  // Guarded by anim_loader_lock
+static long anim_loader_start_us;
+static bongocat_error_t anim_loader_result = BONGOCAT_SUCCESS;
+static pthread_mutex_t anim_build_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Frames for the output scales the surface was on recently, most recent
+// first, so moving between outputs swaps caches instead of resampling.
+// Guarded by anim_lock like the active cache.
+#define ANIM_MAX_SCALES 4
+static anim_frame_cache_t anim_scaled_caches[ANIM_MAX_SCALES - 1];
+static int anim_scale = ANIM_SCALE_ONE;          // Scale the surface asks for
+static unsigned int anim_cache_generation = 0;   // Last generation handed out
+static unsigned int anim_timeline_generation = 0;
+static unsigned int anim_config_epoch = 0;       // Bumped when a config reload starts
+static unsigned int anim_built_epoch = 0;        // Epoch the timeline was built for
+
+// Builds caches for new scales, started on demand and joined at cleanup
+static pthread_t anim_scale_thread;
+static bool anim_scale_thread_started = false;
+static bool anim_scale_building = false;
+
+// Defined with the thread management below, used by the GIF stream thread
+static void anim_wake(void);
+static void anim_block_signals(void);
+
+static long anim_get_current_time_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000L + now.tv_nsec / 1000;
+}
+
+// =============================================================================
+// DRAWING OPERATIONS MODULE
+// =============================================================================
+
+void draw_rect(uint8_t *dest, int width, int height, int x, int y, int w, int h, 
+               uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + w > width ? width : x + w;
+    int y1 = y + h > height ? height : y + h;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const blit_ops_t *ops = blit_get_ops();
+    uint32_t pixel = blit_pack_argb(r, g, b, a);
+    for (int j = y0; j < y1; j++) {
+        ops->fill((uint32_t *)(dest + ((size_t)j * width + x0) * 4), pixel, (size_t)(x1 - x0));
+    }
+}
+
+void blit_cached_frame_region(uint8_t *dest, int dest_w, int dest_h, int frame,
+                              int offset_x, int offset_y, const anim_rect_t *region) {
+    if (frame < 0 || frame >= anim_frame_cache.num_frames || !anim_frame_cache.frames[frame].pixels) {
+        return;
+    }
+
+    // Clip the region of the cached frame against the destination buffer
+    int x0 = offset_x + region->x;
+    int y0 = offset_y + region->y;
+    int x1 = x0 + region->width;
+    int y1 = y0 + region->height;
+    if (x0 < offset_x) x0 = offset_x;
+    if (y0 < offset_y) y0 = offset_y;
+    if (x1 > offset_x + anim_frame_cache.width) x1 = offset_x + anim_frame_cache.width;
+    if (y1 > offset_y + anim_frame_cache.height) y1 = offset_y + anim_frame_cache.height;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > dest_w) x1 = dest_w;
+    if (y1 > dest_h) y1 = dest_h;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const anim_rle_frame_t *rle = &anim_frame_cache.frames[frame];
+    const blit_ops_t *ops = blit_get_ops();
+    const int left = x0 - offset_x;
+    const int right = x1 - offset_x;
+
+    for (int y = y0; y < y1; y++) {
+        const int row = y - offset_y;
+        uint32_t *dest_row = (uint32_t *)(dest + (size_t)y * dest_w * 4);
+
+        for (int s = rle->row_spans[row]; s < rle->row_spans[row + 1]; s++) {
+            const anim_span_t *span = &rle->spans[s];
+            if (span->x >= right) {
+                break;
+            }
+
+            int sx0 = span->x > left ? span->x : left;
+            int sx1 = span->x + span->length < right ? span->x + span->length : right;
+            if (sx0 >= sx1) {
+                continue;
+            }
+
+            const uint32_t *src = rle->pixels + span->offset + (sx0 - span->x);
+            if (span->opaque) {
+                memcpy(dest_row + offset_x + sx0, src, (size_t)(sx1 - sx0) * 4);
+            } else {
+                ops->blend_over(dest_row + offset_x + sx0, src, (size_t)(sx1 - sx0));
+            }
+        }
+    }
+}
+
+void blit_cached_frame(uint8_t *dest, int dest_w, int dest_h, int frame,
+                       int offset_x, int offset_y) {
+    anim_rect_t full = {0, 0, anim_frame_cache.width, anim_frame_cache.height};
+    blit_cached_frame_region(dest, dest_w, dest_h, frame, offset_x, offset_y, &full);
+}
+
+static anim_rect_t anim_rect_union(const anim_rect_t *a, const anim_rect_t *b) {
+    if (a->width <= 0 || a->height <= 0) return *b;
+    if (b->width <= 0 || b->height <= 0) return *a;
+
+    int x0 = a->x < b->x ? a->x : b->x;
+    int y0 = a->y < b->y ? a->y : b->y;
+    int x1 = a->x + a->width > b->x + b->width ? a->x + a->width : b->x + b->width;
+    int y1 = a->y + a->height > b->y + b->height ? a->y + a->height : b->y + b->height;
+    return (anim_rect_t){x0, y0, x1 - x0, y1 - y0};
+}
+
+anim_rect_t anim_frame_cache_diff(int from, int to) {
+    const anim_frame_cache_t *cache = &anim_frame_cache;
+    if (from < 0 || to < 0 || from >= cache->num_frames || to >= cache->num_frames) {
+        return (anim_rect_t){0, 0, cache->width, cache->height};
+    }
+    if (cache->frame_diff) {
+        return cache->frame_diff[(size_t)from * cache->num_frames + to];
+    }
+    if (from == to) {
+        return (anim_rect_t){0, 0, 0, 0};
+    }
+
+    // Outside both frames' bounds every pixel is transparent in each
+    return anim_rect_union(&cache->frames[from].bounds, &cache->frames[to].bounds);
+}
+
+// =============================================================================
+// RESAMPLING MODULE
+// =============================================================================
+
+// Filter weights are Q14 fixed point and sum to exactly one per output pixel
+#define RESAMPLE_WEIGHT_BITS 14
+#define RESAMPLE_WEIGHT_ONE (1 << RESAMPLE_WEIGHT_BITS)
+
+// Horizontal pass results keep 8 fractional bits for the vertical pass
+#define RESAMPLE_MID_SHIFT (RESAMPLE_WEIGHT_BITS - 8)
+#define RESAMPLE_OUT_SHIFT (RESAMPLE_WEIGHT_BITS + 8)
+
+typedef struct {
+    int taps;          // Weights per output pixel
+    int *first;        // First source pixel of each output pixel
+    int32_t *weights;  // dst_len * taps weights
+} resample_filter_t;
+
+static void resample_filter_free(resample_filter_t *filter) {
+    if (filter->first) {
+        BONGOCAT_FREE(filter->first);
+        filter->first = NULL;
+    }
+    if (filter->weights) {
+        BONGOCAT_FREE(filter->weights);
+        filter->weights = NULL;
+    }
+}
+
+// Area average when shrinking, bilinear when enlarging
+static bongocat_error_t resample_filter_build(resample_filter_t *filter, int src_len, int dst_len) {
+    const double scale = (double)src_len / dst_len;
+    int taps = scale > 1.0 ? (int)ceil(scale) + 1 : 2;
+    if (taps > src_len) {
+        taps = src_len;
+    }
+
+    *filter = (resample_filter_t){ .taps = taps };
+    filter->first = BONGOCAT_MALLOC((size_t)dst_len * sizeof(int));
+    filter->weights = BONGOCAT_MALLOC((size_t)dst_len * taps * sizeof(int32_t));
+    double *coverage = BONGOCAT_MALLOC((size_t)taps * sizeof(double));
+    if (!filter->first || !filter->weights || !coverage) {
+        resample_filter_free(filter);
+        if (coverage) {
+            BONGOCAT_FREE(coverage);
+        }
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
+    for (int i = 0; i < dst_len; i++) {
+        int first;
+        if (scale > 1.0) {
+            // Overlap of each source pixel with [start, end)
+            double start = i * scale;
+            double end = start + scale;
+            first = (int)floor(start);
+            for (int t = 0; t < taps; t++) {
+                double lo = fmax(start, first + t);
+                double hi = fmin(end, first + t + 1);
+                coverage[t] = (first + t < src_len && hi > lo) ? hi - lo : 0.0;
+            }
+        } else {
+            // Distance to the two nearest source pixel centres
+            double center = fmax((i + 0.5) * scale - 0.5, 0.0);
+            first = (int)floor(center);
+            double frac = center - first;
+            if (first >= src_len - 1) {
+                first = src_len - 1;
+                frac = 0.0;
+            }
+            coverage[0] = 1.0 - frac;
+            for (int t = 1; t < taps; t++) {
+                coverage[t] = t == 1 ? frac : 0.0;
+            }
+        }
+
+        // Keep the window inside the source; taps past the edge carry no weight
+        int shift = first + taps > src_len ? first + taps - src_len : 0;
+        first -= shift;
+
+        double total = 0.0;
+        for (int t = 0; t < taps; t++) {
+            total += coverage[t];
+        }
+
+        // Quantize, then hand the rounding error to the heaviest tap so the sum is exact
+        int32_t *w = filter->weights + (size_t)i * taps;
+        int32_t sum = 0;
+        int heaviest = shift;
+        for (int t = 0; t < taps; t++) {
+            w[t] = t < shift ? 0 : (int32_t)lround(coverage[t - shift] / total * RESAMPLE_WEIGHT_ONE);
+            sum += w[t];
+            if (w[t] > w[heaviest]) {
+                heaviest = t;
+            }
+        }
+        w[heaviest] += RESAMPLE_WEIGHT_ONE - sum;
+        filter->first[i] = first;
+    }
+
+    BONGOCAT_FREE(coverage);
+    return BONGOCAT_SUCCESS;
+}
+
+// Returns a dst_w x dst_h premultiplied ARGB8888 copy of an RGBA image whose rows
+// are src_stride pixels apart, or NULL
+static uint32_t *resample_image(const unsigned char *src, int src_w, int src_h, int src_stride,
+                                int dst_w, int dst_h) {
+    resample_filter_t fx = {0}, fy = {0};
+    uint8_t *premul = NULL;
+    uint16_t *mid = NULL;
+    uint32_t *out = NULL;
+
+    if (resample_filter_build(&fx, src_w, dst_w) != BONGOCAT_SUCCESS ||
+        resample_filter_build(&fy, src_h, dst_h) != BONGOCAT_SUCCESS) {
+        goto done;
+    }
+
+    premul = BONGOCAT_MALLOC((size_t)src_w * src_h * 4);
+    mid = BONGOCAT_MALLOC((size_t)dst_w * src_h * 4 * sizeof(uint16_t));
+    out = BONGOCAT_MALLOC((size_t)dst_w * dst_h * sizeof(uint32_t));
+    if (!premul || !mid || !out) {
+        if (out) {
+            BONGOCAT_FREE(out);
+            out = NULL;
+        }
+        goto done;
+    }
+
+    // Filter premultiplied colour so transparent pixels don't bleed into edges
+    for (int y = 0; y < src_h; y++) {
+        const unsigned char *row = src + (size_t)y * src_stride * 4;
+        uint8_t *q = premul + (size_t)y * src_w * 4;
+        for (int x = 0; x < src_w; x++, q += 4) {
+            const unsigned char *p = row + (size_t)x * 4;
+            uint32_t a = p[3];
+            q[0] = (uint8_t)((p[2] * a + 127) / 255); // B
+            q[1] = (uint8_t)((p[1] * a + 127) / 255); // G
+            q[2] = (uint8_t)((p[0] * a + 127) / 255); // R
+            q[3] = (uint8_t)a;
+        }
+    }
+
+    // Horizontal pass: src_w -> dst_w for every source row
+    for (int y = 0; y < src_h; y++) {
+        for (int x = 0; x < dst_w; x++) {
+            const uint8_t *p = premul + ((size_t)y * src_w + fx.first[x]) * 4;
+            const int32_t *w = fx.weights + (size_t)x * fx.taps;
+            uint32_t acc[4] = {0, 0, 0, 0};
+            for (int t = 0; t < fx.taps; t++) {
+                for (int c = 0; c < 4; c++) {
+                    acc[c] += (uint32_t)w[t] * p[t * 4 + c];
+                }
+            }
+            uint16_t *m = mid + ((size_t)y * dst_w + x) * 4;
+            for (int c = 0; c < 4; c++) {
+                m[c] = (uint16_t)((acc[c] + (1u << (RESAMPLE_MID_SHIFT - 1))) >> RESAMPLE_MID_SHIFT);
+            }
+        }
+    }
+
+    // Vertical pass: src_h -> dst_h
+    for (int y = 0; y < dst_h; y++) {
+        const int32_t *w = fy.weights + (size_t)y * fy.taps;
+        for (int x = 0; x < dst_w; x++) {
+            const uint16_t *m = mid + ((size_t)fy.first[y] * dst_w + x) * 4;
+            uint32_t acc[4] = {0, 0, 0, 0};
+            for (int t = 0; t < fy.taps; t++) {
+                for (int c = 0; c < 4; c++) {
+                    acc[c] += (uint32_t)w[t] * m[(size_t)t * dst_w * 4 + c];
+                }
+            }
+            uint32_t px = 0;
+            for (int c = 0; c < 4; c++) {
+                px |= ((acc[c] + (1u << (RESAMPLE_OUT_SHIFT - 1))) >> RESAMPLE_OUT_SHIFT) << (c * 8);
+            }
+            out[(size_t)y * dst_w + x] = px;
+        }
+    }
+
+done:
+    if (premul) {
+        BONGOCAT_FREE(premul);
+    }
+    if (mid) {
+        BONGOCAT_FREE(mid);
+    }
+    resample_filter_free(&fx);
+    resample_filter_free(&fy);
+    return out;
+}
+
+// =============================================================================
+// IMAGE LOADING MODULE
+// =============================================================================
+
+typedef struct {
+    const embedded_asset_t *asset;
+    const char *name;
+} embedded_image_t;
+
+static embedded_image_t embedded_images[NUM_FRAMES];
+
+static void init_embedded_images(void) {
+    embedded_images[BONGOCAT_FRAME_BOTH_UP] = (embedded_image_t){&bongo_cat_both_up_png, "embedded bongo-cat-both-up.png"};
+    embedded_images[BONGOCAT_FRAME_LEFT_DOWN] = (embedded_image_t){&bongo_cat_left_down_png, "embedded bongo-cat-left-down.png"};
+    embedded_images[BONGOCAT_FRAME_RIGHT_DOWN] = (embedded_image_t){&bongo_cat_right_down_png, "embedded bongo-cat-right-down.png"};
+    embedded_images[BONGOCAT_FRAME_BOTH_DOWN] = (embedded_image_t){&bongo_cat_both_down_png, "embedded bongo-cat-both-down.png"};
+}
+
+static void anim_cleanup_loaded_images(int count) {
+    for (int i = 0; i < count; i++) {
+        if (anim_imgs[i]) {
+            BONGOCAT_FREE(anim_imgs[i]);
+            anim_imgs[i] = NULL;
+        }
+    }
+}
+
+// Expands the run-length encoded pixels generated by scripts/embed_assets.sh
+static unsigned char *anim_expand_asset(const embedded_asset_t *asset) {
+    const size_t total = (size_t)asset->width * asset->height;
+    unsigned char *pixels = BONGOCAT_MALLOC(total * 4);
+    if (!pixels) {
+        return NULL;
+    }
+
+    const blit_ops_t *ops = blit_get_ops();
+    size_t pos = 0;
+    for (size_t r = 0; r < asset->num_runs; r++) {
+        const size_t count = asset->runs[r * 2];
+        const uint32_t value = asset->runs[r * 2 + 1];
+        const unsigned char rgba[4] = {
+            (unsigned char)value, (unsigned char)(value >> 8),
+            (unsigned char)(value >> 16), (unsigned char)(value >> 24)
+        };
+        if (count > total - pos) {
+            BONGOCAT_FREE(pixels);
+            return NULL;
+        }
+
+        // Same bytes in memory whatever the host byte order
+        uint32_t pixel;
+        memcpy(&pixel, rgba, 4);
+        ops->fill((uint32_t *)pixels + pos, pixel, count);
+        pos += count;
+    }
+
+    if (pos != total) {
+        BONGOCAT_FREE(pixels);
+        return NULL;
+    }
+    return pixels;
+}
+
+static bongocat_error_t anim_load_embedded_image(int i) {
+    const embedded_image_t *img = &embedded_images[i];
+
+    bongocat_log_debug("Loading embedded image: %s", img->name);
+
+    anim_imgs[i] = anim_expand_asset(img->asset);
+    if (!anim_imgs[i]) {
+        bongocat_log_error("Failed to load embedded image: %s", img->name);
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+    anim_width[i] = img->asset->width;
+    anim_height[i] = img->asset->height;
+
+    bongocat_log_debug("Loaded %dx%d embedded image", anim_width[i], anim_height[i]);
+    return BONGOCAT_SUCCESS;
+}
+
+// Maps a whole file read-only; returns NULL on failure
+static const unsigned char *anim_map_file(const char *path, size_t *size) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        bongocat_log_warning("Cannot open %s: %s", path, strerror(errno));
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        bongocat_log_warning("Cannot read %s", path);
+        close(fd);
+        return NULL;
+    }
+
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        bongocat_log_warning("Cannot map %s: %s", path, strerror(errno));
+        return NULL;
+    }
+
+    *size = (size_t)st.st_size;
+    return data;
+}
+
+// RGBA pixels of a custom asset, either decoded or read in place from the file
+typedef struct {
+    const unsigned char *pixels;
+    int width;
+    int height;
+    unsigned char *owned;  // Decoded buffer behind pixels, NULL when mapped
+} anim_image_t;
+
+static void anim_image_free(anim_image_t *image) {
+    if (image->owned) {
+        BONGOCAT_FREE(image->owned);
+    }
+    *image = (anim_image_t){0};
+}
+
+static bool anim_has_signature(const unsigned char *data, size_t size, const char *signature) {
+    size_t len = strlen(signature);
+    return size >= len && memcmp(data, signature, len) == 0;
+}
+
+// Reads the next whitespace separated token of a PAM header
+static size_t anim_pam_token(const unsigned char *data, size_t size, size_t pos,
+                             char *out, size_t out_size) {
+    size_t n = 0;
+    while (pos < size && (isspace(data[pos]) || data[pos] == '#')) {
+        if (data[pos] == '#') {
+            while (pos < size && data[pos] != '\n') pos++;
+        } else {
+            pos++;
+        }
+    }
+    while (pos < size && !isspace(data[pos]) && n + 1 < out_size) {
+        out[n++] = (char)data[pos++];
+    }
+    out[n] = '\0';
+    return pos;
+}
+
+// Raw 8-bit RGBA in a netpbm PAM (P7, TUPLTYPE RGB_ALPHA) file. The pixels
+// are used straight from the mapping, so there is nothing to decode.
+static bool anim_load_pam(const unsigned char *data, size_t size, anim_image_t *image) {
+    long width = 0, height = 0, depth = 0, maxval = 0;
+    char token[32];
+    size_t pos = 3;
+
+    for (;;) {
+        pos = anim_pam_token(data, size, pos, token, sizeof(token));
+        if (token[0] == '\0') {
+            return false;
+        }
+        if (strcmp(token, "ENDHDR") == 0) {
+            break;
+        }
+
+        char value[32];
+        pos = anim_pam_token(data, size, pos, value, sizeof(value));
+        if (strcmp(token, "WIDTH") == 0) width = strtol(value, NULL, 10);
+        else if (strcmp(token, "HEIGHT") == 0) height = strtol(value, NULL, 10);
+        else if (strcmp(token, "DEPTH") == 0) depth = strtol(value, NULL, 10);
+        else if (strcmp(token, "MAXVAL") == 0) maxval = strtol(value, NULL, 10);
+        else if (strcmp(token, "TUPLTYPE") == 0 && strcmp(value, "RGB_ALPHA") != 0) return false;
+    }
+
+    // ENDHDR is followed by exactly one newline
+    pos++;
+    if (width <= 0 || height <= 0 || width > 16384 || height > 16384 ||
+        depth != 4 || maxval != 255 || pos > size ||
+        size - pos < (size_t)width * height * 4) {
+        return false;
+    }
+
+    *image = (anim_image_t){ .pixels = data + pos, .width = (int)width, .height = (int)height };
+    return true;
+}
+
+// Picks a decoder from the file signature: QOI and PAM have fast paths,
+// everything else (PNG, ...) goes through stb_image
+static bongocat_error_t anim_decode_image(const unsigned char *data, size_t size,
+                                         const char *name, anim_image_t *image) {
+    *image = (anim_image_t){0};
+
+    if (anim_has_signature(data, size, "P7\n")) {
+        if (!anim_load_pam(data, size, image)) {
+            bongocat_log_warning("Cannot decode %s: unsupported PAM file (need 8-bit RGB_ALPHA)", name);
+            return BONGOCAT_ERROR_FILE_IO;
+        }
+        return BONGOCAT_SUCCESS;
+    }
+
+    if (anim_has_signature(data, size, "qoif")) {
+        image->owned = qoi_decode_rgba(data, size, &image->width, &image->height);
+        if (!image->owned) {
+            bongocat_log_warning("Cannot decode %s: invalid QOI file", name);
+            return BONGOCAT_ERROR_FILE_IO;
+        }
+        image->pixels = image->owned;
+        return BONGOCAT_SUCCESS;
+    }
+
+    if (size > INT_MAX) {
+        bongocat_log_warning("Cannot decode %s: file too large", name);
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+
+    int width, height;
+    unsigned char *decoded = stbi_load_from_memory(data, (int)size, &width, &height, NULL, 4);
+    if (!decoded) {
+        bongocat_log_warning("Cannot decode %s: %s", name, stbi_failure_reason());
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+
+    // Hand back memory owned by our allocator
+    size_t bytes = (size_t)width * height * 4;
+    image->owned = BONGOCAT_MALLOC(bytes);
+    if (image->owned) {
+        memcpy(image->owned, decoded, bytes);
+    }
+    stbi_image_free(decoded);
+    if (!image->owned) {
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
+    *image = (anim_image_t){ .pixels = image->owned, .width = width, .height = height,
+                             .owned = image->owned };
+    return BONGOCAT_SUCCESS;
+}
+
+// Dimensions from the header alone, to size the cat before any frame is decoded
+static bool anim_probe_image(const unsigned char *data, size_t size, int *width, int *height) {
+    if (anim_has_signature(data, size, "P7\n")) {
+        anim_image_t image;
+        if (!anim_load_pam(data, size, &image)) {
+            return false;
+        }
+        *width = image.width;
+        *height = image.height;
+        return true;
+    }
+
+    if (anim_has_signature(data, size, "qoif")) {
+        if (size < 12) {
+            return false;
+        }
+        // Big-endian width and height follow the magic
+        const uint32_t w = (uint32_t)data[4] << 24 | (uint32_t)data[5] << 16 |
+                           (uint32_t)data[6] << 8 | data[7];
+        const uint32_t h = (uint32_t)data[8] << 24 | (uint32_t)data[9] << 16 |
+                           (uint32_t)data[10] << 8 | data[11];
+        if (w == 0 || h == 0 || w > INT_MAX || h > INT_MAX) {
+            return false;
+        }
+        *width = (int)w;
+        *height = (int)h;
+        return true;
+    }
+
+    return size <= INT_MAX && stbi_info_from_memory(data, (int)size, width, height, NULL) != 0;
+}
+
+// =============================================================================
+// FRAME CACHE MODULE
+// =============================================================================
+
+// Exact pairwise diffs cost num_frames^2 full-frame compares; larger
+// animations use the frames' bounds instead
+#define ANIM_MAX_DIFF_FRAMES 16
+#define ANIM_MAX_WORKERS 16
+
+// Every atlas block starts on its own cache line
+#define ANIM_ATLAS_ALIGNMENT 64
+#define ANIM_MAX_CAT_WIDTH UINT16_MAX   // Span positions are 16 bit
+#define ANIM_MAX_SPAN_LENGTH UINT16_MAX
+
+// Width of a cat cat_height pixels tall with the given image's aspect ratio
+static int anim_cat_width(int cat_height, int image_width, int image_height) {
+    const long long width = (long long)cat_height * image_width / image_height;
+    if (width < 1) {
+        return 1;
+    }
+    return width > ANIM_MAX_CAT_WIDTH ? ANIM_MAX_CAT_WIDTH : (int)width;
+}
+
+// Custom frames all take the aspect ratio of the first one; frames left to
+// the built-in art are scaled to match. Returns 0 when there is none.
+static int anim_custom_cat_width(const config_t *config, int cat_height) {
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        if (!config->asset_paths[i]) {
+            continue;
+        }
+
+        size_t size;
+        const unsigned char *data = anim_map_file(config->asset_paths[i], &size);
+        if (!data) {
+            continue;
+        }
+        int width, height;
+        const bool probed = anim_probe_image(data, size, &width, &height);
+        munmap((void *)data, size);
+        if (probed) {
+            return anim_cat_width(cat_height, width, height);
+        }
+    }
+    return 0;
+}
+
+// Frame encoded by a worker, copied into the atlas once every frame is done
+typedef struct {
+    int *row_spans;
+    anim_span_t *spans;
+    uint32_t *pixels;
+    size_t num_spans;
+    size_t num_pixels;
+    anim_rect_t bounds;
+} anim_encoded_frame_t;
+
+static void anim_free_encoded_frame(anim_encoded_frame_t *frame) {
+    if (frame->row_spans) {
+        BONGOCAT_FREE(frame->row_spans);
+    }
+    if (frame->spans) {
+        BONGOCAT_FREE(frame->spans);
+    }
+    if (frame->pixels) {
+        BONGOCAT_FREE(frame->pixels);
+    }
+    *frame = (anim_encoded_frame_t){0};
+}
+
+static void anim_stream_destroy(struct anim_stream *stream);
+
+static void anim_free_frame_cache(anim_frame_cache_t *cache) {
+    // Streamed frames are released with the stream, the rest lives in the atlas
+    if (cache->stream) {
+        anim_stream_destroy(cache->stream);
+        cache->stream = NULL;
+    }
+    memory_pool_destroy(cache->atlas);
+    cache->atlas = NULL;
+    cache->frames = NULL;
+    cache->frame_diff = NULL;
+    cache->num_frames = 0;
+    cache->width = 0;
+    cache->height = 0;
+}
+
+static size_t anim_frame_cache_bytes(const anim_frame_cache_t *cache) {
+    return cache->atlas ? cache->atlas->used : 0;
+}
+
+// Emits the runs of one row that are all opaque or all translucent, skipping
+// fully transparent pixels; with no storage allocated yet it only counts them
+static void anim_encode_row(anim_encoded_frame_t *frame, const uint32_t *row, int width) {
+    int x = 0;
+    while (x < width) {
+        if ((row[x] >> 24) == 0) {
+            x++;
+            continue;
+        }
+
+        const bool opaque = (row[x] >> 24) == 0xFF;
+        const int start = x;
+        while (x < width && x - start < ANIM_MAX_SPAN_LENGTH && (row[x] >> 24) != 0 &&
+               ((row[x] >> 24) == 0xFF) == opaque) {
+            x++;
+        }
+
+        if (frame->spans) {
+            frame->spans[frame->num_spans] = (anim_span_t){
+                .x = (uint16_t)start, .length = (uint16_t)(x - start),
+                .offset = (unsigned int)frame->num_pixels, .opaque = opaque,
+            };
+            memcpy(frame->pixels + frame->num_pixels, row + start, (size_t)(x - start) * 4);
+        }
+        frame->num_spans++;
+        frame->num_pixels += (size_t)(x - start);
+    }
+}
+
+static bongocat_error_t anim_encode_frame(anim_encoded_frame_t *frame, const uint32_t *pixels,
+                                          int width, int height) {
+    *frame = (anim_encoded_frame_t){0};
+    for (int y = 0; y < height; y++) {
+        anim_encode_row(frame, pixels + (size_t)y * width, width);
+    }
+
+    const size_t num_spans = frame->num_spans;
+    const size_t num_pixels = frame->num_pixels;
+    frame->row_spans = BONGOCAT_MALLOC((size_t)(height + 1) * sizeof(int));
+    frame->spans = BONGOCAT_MALLOC((num_spans ? num_spans : 1) * sizeof(anim_span_t));
+    frame->pixels = BONGOCAT_MALLOC((num_pixels ? num_pixels : 1) * sizeof(uint32_t));
+    if (!frame->row_spans || !frame->spans || !frame->pixels) {
+        anim_free_encoded_frame(frame);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
+    frame->num_spans = 0;
+    frame->num_pixels = 0;
+    int min_x = width, min_y = height, max_x = 0, max_y = 0;
+    for (int y = 0; y < height; y++) {
+        const int first = (int)frame->num_spans;
+        frame->row_spans[y] = first;
+        anim_encode_row(frame, pixels + (size_t)y * width, width);
+
+        if ((int)frame->num_spans > first) {
+            const anim_span_t *last = &frame->spans[frame->num_spans - 1];
+            if (frame->spans[first].x < min_x) min_x = frame->spans[first].x;
+            if (last->x + last->length > max_x) max_x = last->x + last->length;
+            if (y < min_y) min_y = y;
+            max_y = y + 1;
+        }
+    }
+    frame->row_spans[height] = (int)frame->num_spans;
+    frame->bounds = max_x > min_x ? (anim_rect_t){min_x, min_y, max_x - min_x, max_y - min_y}
+                                  : (anim_rect_t){0, 0, 0, 0};
+    return BONGOCAT_SUCCESS;
+}
+
+static anim_rect_t anim_diff_frames(const uint32_t *pa, const uint32_t *pb, int width, int height) {
+    int min_x = width, min_y = height, max_x = -1, max_y = -1;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (pa[y * width + x] != pb[y * width + x]) {
+                if (x < min_x) min_x = x;
+                if (x > max_x) max_x = x;
+                if (y < min_y) min_y = y;
+                max_y = y;
+            }
+        }
+    }
+
+    if (max_x < 0) {
+        return (anim_rect_t){0, 0, 0, 0};
+    }
+    return (anim_rect_t){min_x, min_y, max_x - min_x + 1, max_y - min_y + 1};
+}
+
+static void anim_build_frame_diffs(anim_frame_cache_t *cache, const uint32_t *const *scaled) {
+    const int n = cache->num_frames;
+    for (int a = 0; a < n; a++) {
+        for (int b = a; b < n; b++) {
+            anim_rect_t diff = {0, 0, cache->width, cache->height};
+            if (a == b) {
+                diff = (anim_rect_t){0, 0, 0, 0};
+            } else if (scaled[a] && scaled[b]) {
+                diff = anim_diff_frames(scaled[a], scaled[b], cache->width, cache->height);
+            }
+            cache->frame_diff[(size_t)a * n + b] = diff;
+            cache->frame_diff[(size_t)b * n + a] = diff;
+        }
+    }
+}
+
+// Sprite sheet decoded once and shared read-only by the frame workers
+typedef struct {
+    const unsigned char *data;  // Mapped file, may back image.pixels
+    size_t size;
+    uint64_t hash;
+    anim_image_t image;
+    int num_frames;
+    int columns;
+    int cell_width;
+    int cell_height;
+} anim_sheet_t;
+
+static void anim_close_sheet(anim_sheet_t *sheet) {
+    anim_image_free(&sheet->image);
+    if (sheet->data) {
+        munmap((void *)sheet->data, sheet->size);
+    }
+    *sheet = (anim_sheet_t){0};
+}
+
+// Frames are laid out left to right, top to bottom in equally sized cells
+static bongocat_error_t anim_open_sheet(anim_sheet_t *sheet, const config_t *config) {
+    const char *path = config->animation_sheet;
+    *sheet = (anim_sheet_t){0};
+
+    sheet->data = anim_map_file(path, &sheet->size);
+    if (!sheet->data) {
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+
+    bongocat_error_t result = anim_decode_image(sheet->data, sheet->size, path, &sheet->image);
+    if (result != BONGOCAT_SUCCESS) {
+        anim_close_sheet(sheet);
+        return result;
+    }
+
+    sheet->hash = asset_cache_hash(sheet->data, sheet->size);
+    sheet->num_frames = config->animation_sheet_frames;
+    sheet->columns = config->animation_sheet_columns > 0 ? config->animation_sheet_columns
+                                                         : sheet->num_frames;
+    const int rows = (sheet->num_frames + sheet->columns - 1) / sheet->columns;
+    sheet->cell_width = sheet->image.width / sheet->columns;
+    sheet->cell_height = sheet->image.height / rows;
+    if (sheet->cell_width <= 0 || sheet->cell_height <= 0) {
+        bongocat_log_warning("%s (%dx%d) is too small for %d frames in %d columns", path,
+                             sheet->image.width, sheet->image.height, sheet->num_frames,
+                             sheet->columns);
+        anim_close_sheet(sheet);
+        return BONGOCAT_ERROR_INVALID_PARAM;
+    }
+
+    bongocat_log_info("Loaded sprite sheet %s: %d frames of %dx%d", path, sheet->num_frames,
+                      sheet->cell_width, sheet->cell_height);
+    return BONGOCAT_SUCCESS;
+}
+
+// One frame of a cache build; each worker only touches its own jobs and frames
+typedef struct {
+    int index;
+    int width;
+    int height;
+    const char *path;           // Custom asset, NULL for the embedded one
+    const anim_sheet_t *sheet;  // Cut the frame from this sheet instead
+    bool keep_dense;            // Dense frame is still needed for the diff pass
+    const uint32_t *scaled;
+    uint32_t *owned;            // Backs scaled unless it comes from the disk cache
+    asset_cache_entry_t cached;
+    anim_encoded_frame_t encoded;
+    bongocat_error_t result;
+} anim_frame_job_t;
+
+// Custom assets go through the disk cache, so a pack is decoded and scaled
+// only once per cat size
+static bongocat_error_t anim_load_custom_frame(anim_frame_job_t *job) {
+    size_t size;
+    const unsigned char *data = anim_map_file(job->path, &size);
+    if (!data) {
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+
+    const uint64_t hash = asset_cache_hash(data, size);
+    if (asset_cache_lookup(hash, job->width, job->height, &job->cached)) {
+        munmap((void *)data, size);
+        job->scaled = job->cached.pixels;
+        return BONGOCAT_SUCCESS;
+    }
+
+    // Raw images are resampled straight from the mapping
+    anim_image_t image;
+    bongocat_error_t result = anim_decode_image(data, size, job->path, &image);
+    if (result == BONGOCAT_SUCCESS) {
+        job->owned = resample_image(image.pixels, image.width, image.height, image.width,
+                                    job->width, job->height);
+        anim_image_free(&image);
+    }
+    munmap((void *)data, size);
+    if (result != BONGOCAT_SUCCESS) {
+        return result;
+    }
+    if (!job->owned) {
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    job->scaled = job->owned;
+
+    // Failing to write the cache only costs the next start another decode
+    asset_cache_store(hash, job->width, job->height, job->owned);
+    return BONGOCAT_SUCCESS;
+}
+
+static bongocat_error_t anim_load_sheet_frame(anim_frame_job_t *job) {
+    const anim_sheet_t *sheet = job->sheet;
+
+    // Cached per cell, keyed by the sheet contents and its layout
+    const uint64_t key[4] = {sheet->hash, (uint64_t)sheet->num_frames,
+                             (uint64_t)sheet->columns, (uint64_t)job->index};
+    const uint64_t hash = asset_cache_hash(key, sizeof(key));
+    if (asset_cache_lookup(hash, job->width, job->height, &job->cached)) {
+        job->scaled = job->cached.pixels;
+        return BONGOCAT_SUCCESS;
+    }
+
+    const int x = (job->index % sheet->columns) * sheet->cell_width;
+    const int y = (job->index / sheet->columns) * sheet->cell_height;
+    const unsigned char *cell = sheet->image.pixels + ((size_t)y * sheet->image.width + x) * 4;
+    job->owned = resample_image(cell, sheet->cell_width, sheet->cell_height, sheet->image.width,
+                                job->width, job->height);
+    if (!job->owned) {
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    job->scaled = job->owned;
+
+    asset_cache_store(hash, job->width, job->height, job->owned);
+    return BONGOCAT_SUCCESS;
+}
+
+static void anim_release_dense_frame(anim_frame_job_t *job) {
+    if (job->owned) {
+        BONGOCAT_FREE(job->owned);
+        job->owned = NULL;
+    }
+    asset_cache_release(&job->cached);
+    job->scaled = NULL;
+}
+
+static void anim_run_frame_job(anim_frame_job_t *job) {
+    const int i = job->index;
+
+    job->result = BONGOCAT_SUCCESS;
+    if (job->sheet) {
+        job->result = anim_load_sheet_frame(job);
+        if (job->result != BONGOCAT_SUCCESS) {
+            return;
+        }
+    } else if (job->path && anim_load_custom_frame(job) != BONGOCAT_SUCCESS) {
+        bongocat_log_warning("Falling back to the embedded image for frame %d", i);
+    }
+
+    if (!job->scaled) {
+        // Embedded frames are expanded once and kept for later rebuilds
+        if (!anim_imgs[i]) {
+            job->result = anim_load_embedded_image(i);
+            if (job->result != BONGOCAT_SUCCESS) {
+                return;
+            }
+        }
+
+        job->owned = resample_image(anim_imgs[i], anim_width[i], anim_height[i], anim_width[i],
+                                    job->width, job->height);
+        if (!job->owned) {
+            job->result = BONGOCAT_ERROR_MEMORY;
+            return;
+        }
+        job->scaled = job->owned;
+    }
+
+    // Keep only the non-transparent runs; the background is drawn separately
+    job->result = anim_encode_frame(&job->encoded, job->scaled, job->width, job->height);
+    if (!job->keep_dense) {
+        anim_release_dense_frame(job);
+    }
+}
+
+// Each worker takes every stride-th job, so no job is shared between threads
+typedef struct {
+    anim_frame_job_t *jobs;
+    int first;
+    int count;
+    int stride;
+} anim_frame_worker_t;
+
+static void *anim_frame_worker(void *arg) {
+    const anim_frame_worker_t *worker = arg;
+    for (int i = worker->first; i < worker->count; i += worker->stride) {
+        anim_run_frame_job(&worker->jobs[i]);
+    }
+    return NULL;
+}
+
+static int anim_frame_worker_count(int num_jobs) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int count = cpus > 0 ? (int)cpus : 1;
+    if (count > ANIM_MAX_WORKERS) {
+        count = ANIM_MAX_WORKERS;
+    }
+    return count < num_jobs ? count : num_jobs;
+}
+
+static size_t anim_atlas_block(size_t bytes) {
+    return (bytes + ANIM_ATLAS_ALIGNMENT - 1) & ~(size_t)(ANIM_ATLAS_ALIGNMENT - 1);
+}
+
+// Copies the encoded frames into one allocation: the descriptor table, the
+// diff table, then each frame's row index, spans and pixels back to back, so
+// a frame switch only touches the next frame's own lines
+static bongocat_error_t anim_pack_atlas(anim_frame_cache_t *cache, const anim_frame_job_t *jobs,
+                                        bool with_diffs) {
+    const size_t n = (size_t)cache->num_frames;
+    const size_t rows_bytes = (size_t)(cache->height + 1) * sizeof(int);
+
+    size_t size = anim_atlas_block(n * sizeof(anim_rle_frame_t));
+    if (with_diffs) {
+        size += anim_atlas_block(n * n * sizeof(anim_rect_t));
+    }
+    for (size_t i = 0; i < n; i++) {
+        const anim_encoded_frame_t *src = &jobs[i].encoded;
+        size += anim_atlas_block(rows_bytes) +
+                anim_atlas_block((src->num_spans ? src->num_spans : 1) * sizeof(anim_span_t)) +
+                anim_atlas_block((src->num_pixels ? src->num_pixels : 1) * sizeof(uint32_t));
+    }
+
+    cache->atlas = memory_pool_create(size, ANIM_ATLAS_ALIGNMENT);
+    if (!cache->atlas) {
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
+    // Sized exactly above, so no allocation below can fail
+    cache->frames = memory_pool_alloc(cache->atlas, n * sizeof(anim_rle_frame_t));
+    if (with_diffs) {
+        cache->frame_diff = memory_pool_alloc(cache->atlas, n * n * sizeof(anim_rect_t));
+    }
+    for (size_t i = 0; i < n; i++) {
+        const anim_encoded_frame_t *src = &jobs[i].encoded;
+        const size_t span_bytes = (src->num_spans ? src->num_spans : 1) * sizeof(anim_span_t);
+        const size_t pixel_bytes = (src->num_pixels ? src->num_pixels : 1) * sizeof(uint32_t);
+        int *row_spans = memory_pool_alloc(cache->atlas, rows_bytes);
+        anim_span_t *spans = memory_pool_alloc(cache->atlas, span_bytes);
+        uint32_t *pixels = memory_pool_alloc(cache->atlas, pixel_bytes);
+
+        memcpy(row_spans, src->row_spans, rows_bytes);
+        memcpy(spans, src->spans, span_bytes);
+        memcpy(pixels, src->pixels, pixel_bytes);
+        cache->frames[i] = (anim_rle_frame_t){
+            .row_spans = row_spans, .spans = spans, .pixels = pixels,
+            .num_spans = (uint32_t)src->num_spans, .num_pixels = (uint32_t)src->num_pixels,
+            .bounds = src->bounds,
+        };
+    }
+    return BONGOCAT_SUCCESS;
+}
+
+// =============================================================================
+// GIF STREAMING MODULE
+// =============================================================================
+
+// Animated GIFs are decoded on a background thread as playback approaches
+// each frame, and frames are evicted again once the resident ones outgrow
+// animation_gif_cache_kb. Eviction takes the frames playback reaches last;
+// the frame on screen and the idle and sleep poses always stay.
+typedef struct anim_stream {
+    gif_stream_t gif;
+    const unsigned char *data;         // Mapped file the decoder reads from
+    size_t size;
+    int width;
+    int height;
+    int num_frames;
+    anim_rle_frame_t *frames;          // Descriptors in the cache atlas, changed under anim_lock
+    anim_encoded_frame_t *resident;    // Backs the descriptors; only the stream thread touches it
+    bool *pinned;
+    size_t budget;
+    size_t resident_bytes;
+    int resident_count;
+
+    pthread_t thread;
+    bool thread_started;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int wanted;                        // Frame playback shows next, guarded by lock
+    unsigned int requests;             // Bumped whenever wanted changes
+    bool stopping;
+} anim_stream_t;
+
+static size_t anim_encoded_frame_bytes(const anim_encoded_frame_t *frame, int height) {
+    return (size_t)(height + 1) * sizeof(int) + frame->num_spans * sizeof(anim_span_t) +
+           frame->num_pixels * sizeof(uint32_t);
+}
+
+static anim_rle_frame_t anim_encoded_frame_view(const anim_encoded_frame_t *frame) {
+    return (anim_rle_frame_t){
+        .row_spans = frame->row_spans, .spans = frame->spans, .pixels = frame->pixels,
+        .num_spans = (uint32_t)frame->num_spans, .num_pixels = (uint32_t)frame->num_pixels,
+        .bounds = frame->bounds,
+    };
+}
+
+static bongocat_error_t anim_stream_encode(anim_stream_t *stream, int index,
+                                           anim_encoded_frame_t *frame) {
+    const unsigned char *canvas = gif_stream_decode(&stream->gif, index);
+    if (!canvas) {
+        return BONGOCAT_ERROR_ANIMATION;
+    }
+
+    uint32_t *scaled = resample_image(canvas, stream->gif.width, stream->gif.height,
+                                      stream->gif.width, stream->width, stream->height);
+    if (!scaled) {
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    bongocat_error_t result = anim_encode_frame(frame, scaled, stream->width, stream->height);
+    BONGOCAT_FREE(scaled);
+    return result;
+}
+
+// Frames from the playhead on in playback order, as far as the budget reaches;
+// the wanted frame and the one after it are always fetched. -1 if all are in.
+static int anim_stream_next_missing(const anim_stream_t *stream, int wanted) {
+    const size_t average = stream->resident_count > 0
+                               ? stream->resident_bytes / (size_t)stream->resident_count : 0;
+    size_t window = 0;
+
+    for (int k = 0; k < stream->num_frames; k++) {
+        const int frame = (wanted + k) % stream->num_frames;
+        const anim_encoded_frame_t *resident = &stream->resident[frame];
+        const size_t bytes = resident->pixels ? anim_encoded_frame_bytes(resident, stream->height)
+                                              : average;
+        if (k >= 2 && window + bytes > stream->budget) {
+            return -1;
+        }
+        if (!resident->pixels) {
+            return frame;
+        }
+        window += bytes;
+    }
+    return -1;
+}
+
+// Makes room for frame and publishes it. Victims are picked under anim_lock so
+// the animation thread cannot switch to one in between. Returns false if the
+// frame would only fit by evicting something needed sooner.
+static bool anim_stream_install(anim_stream_t *stream, int frame, int wanted,
+                                anim_encoded_frame_t *encoded) {
+    const int n = stream->num_frames;
+    const int distance = (frame - wanted + n) % n;
+    const size_t bytes = anim_encoded_frame_bytes(encoded, stream->height);
+    int victims[MAX_FRAMES];
+    int num_victims = 0;
+    size_t freed = 0;
+    bool installed = false;
+
+    pthread_mutex_lock(&anim_lock);
+    while (stream->resident_bytes - freed + bytes > stream->budget) {
+        int victim = -1;
+        for (int k = n - 1; k > distance && victim < 0; k--) {
+            const int candidate = (wanted + k) % n;
+            bool taken = false;
+            for (int v = 0; v < num_victims; v++) {
+                taken = taken || victims[v] == candidate;
+            }
+            if (stream->resident[candidate].pixels && !stream->pinned[candidate] &&
+                candidate != anim_index && !taken) {
+                victim = candidate;
+            }
+        }
+        if (victim < 0) {
+            break;
+        }
+        victims[num_victims++] = victim;
+        freed += anim_encoded_frame_bytes(&stream->resident[victim], stream->height);
+    }
+
+    // Over budget anyway is fine for what is about to be shown
+    if (stream->resident_bytes - freed + bytes <= stream->budget || distance < 2) {
+        for (int v = 0; v < num_victims; v++) {
+            // Bounds stay valid for damage tracking after the pixels go
+            const anim_rect_t bounds = stream->frames[victims[v]].bounds;
+            stream->frames[victims[v]] = (anim_rle_frame_t){ .bounds = bounds };
+        }
+        stream->frames[frame] = anim_encoded_frame_view(encoded);
+        installed = true;
+    } else {
+        num_victims = 0;
+    }
+    pthread_mutex_unlock(&anim_lock);
+
+    for (int v = 0; v < num_victims; v++) {
+        anim_free_encoded_frame(&stream->resident[victims[v]]);
+        stream->resident_count--;
+    }
+    if (!installed) {
+        anim_free_encoded_frame(encoded);
+        return false;
+    }
+
+    stream->resident[frame] = *encoded;
+    stream->resident_bytes = stream->resident_bytes - freed + bytes;
+    stream->resident_count++;
+    return true;
+}
+
+static void *anim_stream_main(void *arg) {
+    anim_block_signals();
+
+    anim_stream_t *stream = arg;
+    unsigned int handled = 0;
+
+    pthread_mutex_lock(&stream->lock);
+    while (!stream->stopping) {
+        // Sleep until playback moves once everything in reach is decoded
+        if (stream->requests == handled) {
+            pthread_cond_wait(&stream->cond, &stream->lock);
+            continue;
+        }
+        const unsigned int request = stream->requests;
+        const int wanted = stream->wanted;
+        pthread_mutex_unlock(&stream->lock);
+
+        const int frame = anim_stream_next_missing(stream, wanted);
+        anim_encoded_frame_t encoded;
+        bool installed = false;
+        if (frame >= 0 && anim_stream_encode(stream, frame, &encoded) == BONGOCAT_SUCCESS) {
+            installed = anim_stream_install(stream, frame, wanted, &encoded);
+        }
+
+        pthread_mutex_lock(&stream->lock);
+        if (!installed) {
+            handled = request;
+        } else if (frame == stream->wanted) {
+            // The animation thread kept the previous frame up; switch now
+            anim_wake();
+        }
+    }
+    pthread_mutex_unlock(&stream->lock);
+    return NULL;
+}
+
+// Called by the animation thread with anim_lock held; never blocks on decoding
+static void anim_stream_request(anim_stream_t *stream, int frame) {
+    pthread_mutex_lock(&stream->lock);
+    if (stream->wanted != frame) {
+        stream->wanted = frame;
+        stream->requests++;
+        pthread_cond_signal(&stream->cond);
+    }
+    pthread_mutex_unlock(&stream->lock);
+}
+
+static void anim_stream_destroy(anim_stream_t *stream) {
+    if (stream->thread_started) {
+        pthread_mutex_lock(&stream->lock);
+        stream->stopping = true;
+        pthread_cond_signal(&stream->cond);
+        pthread_mutex_unlock(&stream->lock);
+        pthread_join(stream->thread, NULL);
+    }
+
+    if (stream->resident) {
+        for (int i = 0; i < stream->num_frames; i++) {
+            anim_free_encoded_frame(&stream->resident[i]);
+        }
+        BONGOCAT_FREE(stream->resident);
+    }
+    if (stream->pinned) {
+        BONGOCAT_FREE(stream->pinned);
+    }
+    gif_stream_close(&stream->gif);
+    if (stream->data) {
+        munmap((void *)stream->data, stream->size);
+    }
+    pthread_cond_destroy(&stream->cond);
+    pthread_mutex_destroy(&stream->lock);
+    BONGOCAT_FREE(stream);
+}
+
+static bongocat_error_t anim_stream_open(anim_stream_t **out, const config_t *config,
+                                         int cat_height) {
+    const char *path = config->animation_gif;
+    anim_stream_t *stream = BONGOCAT_MALLOC(sizeof(anim_stream_t));
+    if (!stream) {
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    *stream = (anim_stream_t){ .budget = (size_t)config->animation_gif_cache_kb * 1024 };
+    pthread_mutex_init(&stream->lock, NULL);
+    pthread_cond_init(&stream->cond, NULL);
+
+    stream->data = anim_map_file(path, &stream->size);
+    if (!stream->data) {
+        anim_stream_destroy(stream);
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+    if (gif_stream_open(&stream->gif, stream->data, stream->size) != BONGOCAT_SUCCESS) {
+        bongocat_log_warning("Cannot open %s: not an animated GIF", path);
+        anim_stream_destroy(stream);
+        return BONGOCAT_ERROR_INVALID_PARAM;
+    }
+
+    stream->num_frames = stream->gif.num_frames;
+    if (stream->num_frames > MAX_FRAMES) {
+        bongocat_log_warning("%s has %d frames, playing the first %d", path,
+                             stream->num_frames, MAX_FRAMES);
+        stream->num_frames = MAX_FRAMES;
+    }
+    stream->height = cat_height;
+    stream->width = anim_cat_width(cat_height, stream->gif.width, stream->gif.height);
+
+    stream->resident = BONGOCAT_MALLOC((size_t)stream->num_frames * sizeof(anim_encoded_frame_t));
+    stream->pinned = BONGOCAT_MALLOC((size_t)stream->num_frames * sizeof(bool));
+    if (!stream->resident || !stream->pinned) {
+        anim_stream_destroy(stream);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    memset(stream->resident, 0, (size_t)stream->num_frames * sizeof(anim_encoded_frame_t));
+    memset(stream->pinned, 0, (size_t)stream->num_frames * sizeof(bool));
 
-static bool drawing_is_pixel_in_bounds(int x, int y, int width, int height) {
-    return (x >= 0 && y >= 0 && x < width && y < height);
+    bongocat_log_info("Streaming %s: %d frames of %dx%d, %d KB cache", path, stream->num_frames,
+                      stream->gif.width, stream->gif.height, config->animation_gif_cache_kb);
+    *out = stream;
+    return BONGOCAT_SUCCESS;
 }
 
-static void drawing_copy_pixel(uint8_t *dest, const unsigned char *src, int dest_idx, int src_idx) {
-    dest[dest_idx + 0] = src[src_idx + 2]; // B
-    dest[dest_idx + 1] = src[src_idx + 1]; // G
-    dest[dest_idx + 2] = src[src_idx + 0]; // R
-    dest[dest_idx + 3] = src[src_idx + 3]; // A
+// Pins the frames every state rests on, and frame 0 the animation falls back
+// to when caches are swapped, then starts prefetching from the first
+static bongocat_error_t anim_stream_start(anim_stream_t *stream, const timeline_t *timeline) {
+    stream->pinned[0] = true;
+    for (int s = 0; s < TIMELINE_NUM_STATES; s++) {
+        if (s != TIMELINE_STATE_TYPING) {
+            stream->pinned[timeline->steps[timeline->first[s]].frame] = true;
+        }
+    }
+    stream->wanted = timeline->steps[timeline->first[TIMELINE_STATE_IDLE]].frame;
+    stream->requests = 1;
+
+    if (pthread_create(&stream->thread, NULL, anim_stream_main, stream) != 0) {
+        bongocat_log_error("Failed to create GIF streaming thread");
+        return BONGOCAT_ERROR_THREAD;
+    }
+    stream->thread_started = true;
+    return BONGOCAT_SUCCESS;
 }
 
-void blit_image_scaled(uint8_t *dest, int dest_w, int dest_h,
-                       unsigned char *src, int src_w, int src_h,
-                       int offset_x, int offset_y, int target_w, int target_h) {
-    for (int y = 0; y < target_h; y++) {
-        for (int x = 0; x < target_w; x++) {
-            int dx = x + offset_x;
-            int dy = y + offset_y;
-            
-            if (!drawing_is_pixel_in_bounds(dx, dy, dest_w, dest_h)) {
-                continue;
+// Only the descriptors go into the atlas; the first frame is decoded right
+// away so the cat is visible as soon as the cache is
+static bongocat_error_t anim_build_stream_cache(anim_frame_cache_t *cache, const config_t *config,
+                                                int cat_height, int scale) {
+    anim_stream_t *stream;
+    bongocat_error_t result = anim_stream_open(&stream, config, cat_height);
+    if (result != BONGOCAT_SUCCESS) {
+        return result;
+    }
+
+    const size_t n = (size_t)stream->num_frames;
+    *cache = (anim_frame_cache_t){
+        .width = stream->width, .height = stream->height, .scale = scale,
+        .num_frames = stream->num_frames,
+    };
+    cache->atlas = memory_pool_create(n * sizeof(anim_rle_frame_t), ANIM_ATLAS_ALIGNMENT);
+    if (!cache->atlas) {
+        anim_stream_destroy(stream);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    cache->frames = memory_pool_alloc(cache->atlas, n * sizeof(anim_rle_frame_t));
+    for (size_t i = 0; i < n; i++) {
+        cache->frames[i] = (anim_rle_frame_t){ .bounds = {0, 0, cache->width, cache->height} };
+    }
+    stream->frames = cache->frames;
+    cache->stream = stream;
+
+    // The stream thread is not running yet, so the frame goes straight in
+    result = anim_stream_encode(stream, 0, &stream->resident[0]);
+    if (result != BONGOCAT_SUCCESS) {
+        anim_free_frame_cache(cache);
+        return result;
+    }
+    cache->frames[0] = anim_encoded_frame_view(&stream->resident[0]);
+    stream->resident_bytes = anim_encoded_frame_bytes(&stream->resident[0], stream->height);
+    stream->resident_count = 1;
+    return BONGOCAT_SUCCESS;
+}
+
+static bongocat_error_t anim_build_frame_cache(anim_frame_cache_t *cache, const config_t *config,
+                                               int scale) {
+    int cat_height = (config->cat_height * scale + ANIM_SCALE_ONE / 2) / ANIM_SCALE_ONE;
+    if (cat_height < 1) {
+        cat_height = 1;
+    }
+    int cat_width = (cat_height * CAT_IMAGE_WIDTH) / CAT_IMAGE_HEIGHT;
+    int num_frames = NUM_FRAMES;
+    anim_sheet_t sheet = {0};
+
+    if (config->animation_gif) {
+        if (anim_build_stream_cache(cache, config, cat_height, scale) == BONGOCAT_SUCCESS) {
+            return BONGOCAT_SUCCESS;
+        }
+        bongocat_log_warning("Falling back to the %s", config->animation_sheet ? "sprite sheet"
+                                                                               : "built-in frames");
+    }
+
+    if (config->animation_sheet) {
+        if (anim_open_sheet(&sheet, config) == BONGOCAT_SUCCESS) {
+            num_frames = sheet.num_frames;
+            cat_width = anim_cat_width(cat_height, sheet.cell_width, sheet.cell_height);
+        } else {
+            bongocat_log_warning("Falling back to the built-in frames");
+        }
+    }
+    if (!sheet.data) {
+        const int custom_width = anim_custom_cat_width(config, cat_height);
+        if (custom_width > 0) {
+            cat_width = custom_width;
+        }
+    }
+
+    *cache = (anim_frame_cache_t){
+        .width = cat_width, .height = cat_height, .scale = scale, .num_frames = num_frames,
+    };
+    anim_frame_job_t *jobs = BONGOCAT_MALLOC((size_t)num_frames * sizeof(anim_frame_job_t));
+    const uint32_t **scaled = BONGOCAT_MALLOC((size_t)num_frames * sizeof(*scaled));
+    if (!jobs || !scaled) {
+        if (jobs) BONGOCAT_FREE(jobs);
+        if (scaled) BONGOCAT_FREE((void *)scaled);
+        anim_close_sheet(&sheet);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
+    const bool keep_dense = num_frames <= ANIM_MAX_DIFF_FRAMES;
+    for (int i = 0; i < num_frames; i++) {
+        jobs[i] = (anim_frame_job_t){
+            .index = i, .width = cat_width, .height = cat_height,
+            .path = sheet.data ? NULL : config->asset_paths[i],
+            .sheet = sheet.data ? &sheet : NULL,
+            .keep_dense = keep_dense,
+        };
+    }
+
+    // Frames are independent, so decode and scale them in parallel
+    pthread_t threads[ANIM_MAX_WORKERS];
+    anim_frame_worker_t workers[ANIM_MAX_WORKERS];
+    bool spawned[ANIM_MAX_WORKERS];
+    const int num_workers = anim_frame_worker_count(num_frames);
+    for (int w = 0; w < num_workers; w++) {
+        workers[w] = (anim_frame_worker_t){ jobs, w, num_frames, num_workers };
+        spawned[w] = pthread_create(&threads[w], NULL, anim_frame_worker, &workers[w]) == 0;
+        if (!spawned[w]) {
+            anim_frame_worker(&workers[w]);
+        }
+    }
+
+    bongocat_error_t result = BONGOCAT_SUCCESS;
+    for (int w = 0; w < num_workers; w++) {
+        if (spawned[w]) {
+            pthread_join(threads[w], NULL);
+        }
+    }
+    for (int i = 0; i < num_frames; i++) {
+        if (jobs[i].result != BONGOCAT_SUCCESS && result == BONGOCAT_SUCCESS) {
+            result = jobs[i].result;
+        }
+        scaled[i] = jobs[i].scaled;
+    }
+
+    if (result == BONGOCAT_SUCCESS) {
+        result = anim_pack_atlas(cache, jobs, keep_dense);
+    }
+
+    // Diffs need the dense frames, which are dropped afterwards
+    if (result != BONGOCAT_SUCCESS) {
+        anim_free_frame_cache(cache);
+    } else if (keep_dense) {
+        anim_build_frame_diffs(cache, scaled);
+    }
+
+    for (int i = 0; i < num_frames; i++) {
+        anim_release_dense_frame(&jobs[i]);
+        anim_free_encoded_frame(&jobs[i].encoded);
+    }
+    BONGOCAT_FREE(jobs);
+    BONGOCAT_FREE((void *)scaled);
+    anim_close_sheet(&sheet);
+    return result;
+}
+
+// Makes cache the active one; called with anim_lock held
+static void anim_activate_cache(const anim_frame_cache_t *cache) {
+    anim_frame_cache = *cache;
+    anim_frame_cache.generation = ++anim_cache_generation;
+
+    // Frame 0 is always resident, even when streaming
+    if (anim_index >= anim_frame_cache.num_frames || !anim_frame_cache.frames[anim_index].pixels) {
+        anim_index = 0;
+    }
+}
+
+// Keeps an inactive cache as the most recent one; returns the cache it
+// displaced, which the caller frees once anim_lock is released
+static anim_frame_cache_t anim_stash_cache(const anim_frame_cache_t *cache) {
+    anim_frame_cache_t evicted = anim_scaled_caches[ANIM_MAX_SCALES - 2];
+    memmove(&anim_scaled_caches[1], &anim_scaled_caches[0],
+            (ANIM_MAX_SCALES - 2) * sizeof(anim_frame_cache_t));
+    anim_scaled_caches[0] = *cache;
+    return evicted;
+}
+
+// Activates the cache built for scale if there is one; called with anim_lock held
+static bool anim_use_scale(int scale) {
+    if (anim_frame_cache.atlas && anim_frame_cache.scale == scale) {
+        return true;
+    }
+
+    for (int i = 0; i < ANIM_MAX_SCALES - 1; i++) {
+        if (anim_scaled_caches[i].atlas && anim_scaled_caches[i].scale == scale) {
+            const anim_frame_cache_t previous = anim_frame_cache;
+            anim_activate_cache(&anim_scaled_caches[i]);
+            memmove(&anim_scaled_caches[i], &anim_scaled_caches[i + 1],
+                    (size_t)(ANIM_MAX_SCALES - 2 - i) * sizeof(anim_frame_cache_t));
+            anim_scaled_caches[ANIM_MAX_SCALES - 2] = (anim_frame_cache_t){0};
+            if (previous.atlas) {
+                anim_stash_cache(&previous);  // A slot was just freed, nothing is displaced
             }
+            bongocat_log_debug("Switched to frames for scale %d/%d", scale, ANIM_SCALE_ONE);
+            return true;
+        }
+    }
+    return false;
+}
 
-            // Map destination pixel to source pixel
-            int sx = (x * src_w) / target_w;
-            int sy = (y * src_h) / target_h;
+// Builds caches until one matches the scale the surface wants. Each build
+// only swaps frames, the timeline stays, so a config reload in between makes
+// the result stale; the reload builds at the wanted scale itself.
+static void *anim_scale_main(void *arg __attribute__((unused))) {
+    anim_block_signals();
 
-            int dest_idx = (dy * dest_w + dx) * 4;
-            int src_idx = (sy * src_w + sx) * 4;
+    for (;;) {
+        pthread_mutex_lock(&anim_build_lock);
+        pthread_mutex_lock(&anim_lock);
+        const int scale = anim_scale;
+        const unsigned int epoch = anim_config_epoch;
+        const bool done = anim_use_scale(scale) || epoch != anim_built_epoch;
+        pthread_mutex_unlock(&anim_lock);
+        if (done) {
+            pthread_mutex_unlock(&anim_build_lock);
+            break;
+        }
 
-            // Only draw non-transparent pixels
-            if (src[src_idx + 3] > 128) {
-                drawing_copy_pixel(dest, src, dest_idx, src_idx);
+        long start_us = anim_get_current_time_us();
+        anim_frame_cache_t cache;
+        bongocat_error_t result = anim_build_frame_cache(&cache, current_config, scale);
+        if (result == BONGOCAT_SUCCESS && cache.stream) {
+            result = anim_stream_start(cache.stream, &anim_timeline);
+            if (result != BONGOCAT_SUCCESS) {
+                anim_free_frame_cache(&cache);
             }
         }
+        if (result != BONGOCAT_SUCCESS) {
+            pthread_mutex_unlock(&anim_build_lock);
+            bongocat_log_error("Failed to build frames for scale %d/%d: %s", scale,
+                               ANIM_SCALE_ONE, bongocat_error_string(result));
+            break;
+        }
+
+        // The built frames only fit the timeline if the same animation loaded
+        pthread_mutex_lock(&anim_lock);
+        anim_frame_cache_t unused = cache;
+        const bool fits = epoch == anim_config_epoch &&
+                          cache.num_frames == anim_frame_cache.num_frames;
+        if (fits) {
+            unused = anim_stash_cache(&cache);
+        }
+        pthread_mutex_unlock(&anim_lock);
+        anim_free_frame_cache(&unused);
+        pthread_mutex_unlock(&anim_build_lock);
+
+        if (!fits) {
+            bongocat_log_warning("Discarding frames for scale %d/%d, the animation changed",
+                                 scale, ANIM_SCALE_ONE);
+            break;
+        }
+        bongocat_log_debug("Built frames for scale %d/%d: %dx%d in %ld us", scale, ANIM_SCALE_ONE,
+                           cache.width, cache.height, anim_get_current_time_us() - start_us);
     }
+
+    pthread_mutex_lock(&anim_lock);
+    anim_scale_building = false;
+    pthread_mutex_unlock(&anim_lock);
+
+    anim_wake();
+    return NULL;
 }
 
-void draw_rect(uint8_t *dest, int width, int height, int x, int y, int w, int h, 
-               uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    for (int j = y; j < y + h; j++) {
-        for (int i = x; i < x + w; i++) {
-            if (!drawing_is_pixel_in_bounds(i, j, width, height)) {
-                continue;
+// Starts a build for the wanted scale unless its frames exist or one runs
+static void anim_request_scale(void) {
+    pthread_mutex_lock(&anim_lock);
+    const bool ready = anim_use_scale(anim_scale);
+    const bool start = !ready && anim_frame_cache.atlas && !anim_scale_building;
+    const bool join = start && anim_scale_thread_started;
+    if (start) {
+        anim_scale_building = true;
+        anim_scale_thread_started = false;
+    }
+    pthread_mutex_unlock(&anim_lock);
+
+    if (ready) {
+        anim_wake();
+    }
+    if (!start) {
+        return;
+    }
+
+    // The previous builder has already finished its last build
+    if (join) {
+        pthread_join(anim_scale_thread, NULL);
+    }
+
+    const bool created = pthread_create(&anim_scale_thread, NULL, anim_scale_main, NULL) == 0;
+    pthread_mutex_lock(&anim_lock);
+    anim_scale_thread_started = created;
+    anim_scale_building = created;
+    pthread_mutex_unlock(&anim_lock);
+    if (!created) {
+        bongocat_log_error("Failed to create frame builder thread, keeping the current scale");
+    }
+}
+
+static bongocat_error_t anim_rebuild_frame_cache(const config_t *config) {
+    // A config reload may arrive while the startup build is still running
+    pthread_mutex_lock(&anim_build_lock);
+
+    pthread_mutex_lock(&anim_lock);
+    const int scale = anim_scale;
+    const unsigned int epoch = anim_config_epoch;
+    pthread_mutex_unlock(&anim_lock);
+
+    long start_us = anim_get_current_time_us();
+    anim_frame_cache_t new_cache;
+    timeline_t new_timeline = {0};
+    bongocat_error_t result = anim_build_frame_cache(&new_cache, config, scale);
+    if (result == BONGOCAT_SUCCESS) {
+        const long *durations = new_cache.stream ? new_cache.stream->gif.frame_duration_us : NULL;
+        result = timeline_build(&new_timeline, config, new_cache.num_frames, durations);
+        if (result == BONGOCAT_SUCCESS && new_cache.stream) {
+            result = anim_stream_start(new_cache.stream, &new_timeline);
+            if (result != BONGOCAT_SUCCESS) {
+                timeline_free(&new_timeline);
             }
-            
-            int idx = (j * width + i) * 4;
-            dest[idx + 0] = b;
-            dest[idx + 1] = g;
-            dest[idx + 2] = r;
-            dest[idx + 3] = a;
         }
+        if (result != BONGOCAT_SUCCESS) {
+            anim_free_frame_cache(&new_cache);
+        }
+    }
+    if (result != BONGOCAT_SUCCESS) {
+        pthread_mutex_unlock(&anim_build_lock);
+        bongocat_log_error("Failed to build frame cache: %s", bongocat_error_string(result));
+        return result;
     }
+
+    // The animation thread resets its timeline cursor when the timeline
+    // generation changes. Caches for other scales hold the old frames.
+    pthread_mutex_lock(&anim_lock);
+    anim_frame_cache_t old_caches[ANIM_MAX_SCALES];
+    old_caches[0] = anim_frame_cache;
+    memcpy(&old_caches[1], anim_scaled_caches, sizeof(anim_scaled_caches));
+    memset(anim_scaled_caches, 0, sizeof(anim_scaled_caches));
+    timeline_t old_timeline = anim_timeline;
+    anim_activate_cache(&new_cache);
+    anim_timeline = new_timeline;
+    anim_timeline_generation++;
+    anim_built_epoch = epoch;
+    pthread_mutex_unlock(&anim_lock);
+
+    for (int i = 0; i < ANIM_MAX_SCALES; i++) {
+        anim_free_frame_cache(&old_caches[i]);
+    }
+    timeline_free(&old_timeline);
+
+    bongocat_log_debug("Frame cache built: %d frames at %dx%d in %ld us (%zu bytes, %zu dense)",
+                       new_cache.num_frames, new_cache.width, new_cache.height,
+                       anim_get_current_time_us() - start_us, anim_frame_cache_bytes(&new_cache),
+                       (size_t)new_cache.num_frames * new_cache.width * new_cache.height * 4);
+    pthread_mutex_unlock(&anim_build_lock);
+
+    // The surface may have moved to another scale meanwhile
+    anim_request_scale();
+    return BONGOCAT_SUCCESS;
 }
 
 // =============================================================================
@@ -87,18 +1735,15 @@ void draw_rect(uint8_t *dest, int width, int height, int x, int y, int w, int h,
 
 typedef struct {
     long hold_until;
-    int test_counter;
-    int test_interval_frames;
-    long frame_time_ns;
+    long next_test_us;
+    long frame_time_us;
     long last_key_pressed_timestamp;
+    bool scheduled_sleep;        // Evaluated once per wakeup
+    bool keys_pending;           // Presses left for the next frames
+    timeline_cursor_t cursor;
+    unsigned int generation;     // Timeline the cursor belongs to
 } animation_state_t;
 
-static long anim_get_current_time_us(void) {
-    struct timeval now;
-    gettimeofday(&now, NULL);
-    return now.tv_sec * 1000000 + now.tv_usec;
-}
-
 static bool anim_is_sleep_time(const config_t *config) {
     time_t raw_time;
     struct tm time_info;
@@ -116,18 +1761,36 @@ static bool anim_is_sleep_time(const config_t *config) {
                         : (now_minutes >= begin || now_minutes < end));
 }
 
-static int anim_get_random_active_frame(void) {
-    return (rand() % 2) + 1; // Frame 1 or 2 (active frames)
-}
+// Wall-clock time of the next sleep_begin or sleep_end, whichever comes first
+static time_t anim_next_sleep_transition(const config_t *config) {
+    time_t now = time(NULL);
+    struct tm today;
+    localtime_r(&now, &today);
 
-static void anim_trigger_frame_change(int new_frame, long duration_us, long current_time_us, 
-                                     animation_state_t *state) {
-    if (current_config->enable_debug) {
-        bongocat_log_debug("Animation frame change: %d (duration: %ld us)", new_frame, duration_us);
+    const config_time_t *edges[2] = {&config->sleep_begin, &config->sleep_end};
+    time_t next = 0;
+    for (int i = 0; i < 2; i++) {
+        struct tm edge = today;
+        edge.tm_hour = edges[i]->hour;
+        edge.tm_min = edges[i]->min;
+        edge.tm_sec = 0;
+        edge.tm_isdst = -1;
+
+        time_t when = mktime(&edge);
+        if (when <= now) {
+            edge = today;
+            edge.tm_mday += 1;
+            edge.tm_hour = edges[i]->hour;
+            edge.tm_min = edges[i]->min;
+            edge.tm_sec = 0;
+            edge.tm_isdst = -1;
+            when = mktime(&edge);
+        }
+        if (next == 0 || when < next) {
+            next = when;
+        }
     }
-    
-    anim_index = new_frame;
-    state->hold_until = current_time_us + duration_us;
+    return next;
 }
 
 static void anim_handle_test_animation(animation_state_t *state, long current_time_us) {
@@ -135,157 +1798,278 @@ static void anim_handle_test_animation(animation_state_t *state, long current_ti
         return;
     }
     
-    state->test_counter++;
-    if (state->test_counter > state->test_interval_frames) {
-        int new_frame = anim_get_random_active_frame();
-        long duration_us = current_config->test_animation_duration * 1000;
-        
+    if (current_time_us >= state->next_test_us) {
         bongocat_log_debug("Test animation trigger");
-        anim_trigger_frame_change(new_frame, duration_us, current_time_us, state);
-        state->test_counter = 0;
+        timeline_dispatch(&anim_timeline, &state->cursor, TIMELINE_EVENT_KEY, current_time_us);
+        state->hold_until = current_time_us + current_config->test_animation_duration * 1000L;
+        state->next_test_us = current_time_us + current_config->test_animation_interval * 1000000L;
     }
 }
 
+// Takes one press per update so each shows its own typing frame; the fps cap
+// spaces out a burst instead of collapsing it into one frame
 static void anim_handle_key_press(animation_state_t *state, long current_time_us) {
-    if (!*any_key_pressed) {
-        return;
-    }
-
-    if (!current_config->enable_scheduled_sleep || !anim_is_sleep_time(current_config)) {
-        int new_frame = anim_get_random_active_frame();
-        long duration_us = current_config->keypress_duration * 1000;
+    input_key_event_t event;
+    while (input_pop_key_event(&event)) {
+        // Nothing to show while asleep, and a press older than its hold is already over
+        if (state->scheduled_sleep ||
+            current_time_us - event.time_us > current_config->keypress_duration * 1000L) {
+            continue;
+        }
 
-        bongocat_log_debug("Key press detected - switching to frame %d", new_frame);
-        anim_trigger_frame_change(new_frame, duration_us, current_time_us, state);
+        if (current_config->enable_debug) {
+            bongocat_log_debug("Key press detected: device=%d, code=%d, delay=%ld us",
+                               event.device, event.keycode, current_time_us - event.time_us);
+        }
+        timeline_dispatch(&anim_timeline, &state->cursor, TIMELINE_EVENT_KEY, current_time_us);
+        state->hold_until = current_time_us + current_config->keypress_duration * 1000L;
+        if (anim_input_time_us == 0) {
+            anim_input_time_us = event.time_us;  // The oldest press not drawn yet is measured
+        }
 
-        *any_key_pressed = 0;
-        state->test_counter = 0; // Reset test counter
+        state->next_test_us = current_time_us + current_config->test_animation_interval * 1000000L;
         state->last_key_pressed_timestamp = current_time_us;
+        break;
     }
+    state->keys_pending = input_has_key_events();
 }
 
 static void anim_handle_idle_return(animation_state_t *state, long current_time_us) {
-    int show_sleep_frame = 0;
-    // Sleep Mode
-    if (current_config->enable_scheduled_sleep) {
-        if (anim_is_sleep_time(current_config)) {
-            show_sleep_frame = 1;
-        }
-    }
+    bool sleeping = state->scheduled_sleep;
     // Idle Sleep
     if (current_config->idle_sleep_timeout_sec > 0 && state->last_key_pressed_timestamp > 0) {
-        if (anim_get_current_time_us() - state->last_key_pressed_timestamp >= current_config->idle_sleep_timeout_sec*1000000L) {
-            show_sleep_frame = 1;
+        if (current_time_us - state->last_key_pressed_timestamp >= current_config->idle_sleep_timeout_sec*1000000L) {
+            sleeping = true;
         }
     }
 
-    if (show_sleep_frame) {
-		if (anim_index != BONGOCAT_FRAME_BOTH_DOWN) {
-        	bongocat_log_debug("Returning to sleep frame");
-        	anim_index = BONGOCAT_FRAME_BOTH_DOWN;
-		}
-        return;
+    if (sleeping) {
+        if (state->cursor.state != TIMELINE_STATE_SLEEP) {
+            bongocat_log_debug("Entering sleep state");
+            timeline_dispatch(&anim_timeline, &state->cursor, TIMELINE_EVENT_SLEEP, current_time_us);
+        }
+    } else if (state->cursor.state == TIMELINE_STATE_SLEEP) {
+        bongocat_log_debug("Waking up");
+        timeline_dispatch(&anim_timeline, &state->cursor, TIMELINE_EVENT_WAKE, current_time_us);
+    } else if (state->cursor.state == TIMELINE_STATE_TYPING && current_time_us > state->hold_until) {
+        bongocat_log_debug("Returning to idle state");
+        timeline_dispatch(&anim_timeline, &state->cursor, TIMELINE_EVENT_RELEASE, current_time_us);
+    }
+}
+
+// Earliest monotonic time at which the state can change without input, 0 if none
+static long anim_next_deadline(const animation_state_t *state, long current_time_us) {
+    if (state->keys_pending) {
+        return current_time_us;
     }
 
-    if (current_time_us <= state->hold_until) {
-        return;
+    long deadline = 0;
+
+    if (state->cursor.state == TIMELINE_STATE_TYPING && state->hold_until >= current_time_us) {
+        deadline = state->hold_until + 1;
     }
 
-    if (anim_index != current_config->idle_frame) {
-        bongocat_log_debug("Returning to idle frame %d", current_config->idle_frame);
-        anim_index = current_config->idle_frame;
+    // Next step of the current sequence
+    if (state->cursor.step_until_us > 0 &&
+        (deadline == 0 || state->cursor.step_until_us < deadline)) {
+        deadline = state->cursor.step_until_us;
     }
+
+    if (current_config->test_animation_interval > 0 &&
+        (deadline == 0 || state->next_test_us < deadline)) {
+        deadline = state->next_test_us;
+    }
+
+    if (current_config->idle_sleep_timeout_sec > 0 && state->last_key_pressed_timestamp > 0) {
+        long idle_deadline = state->last_key_pressed_timestamp +
+                             current_config->idle_sleep_timeout_sec * 1000000L;
+        if (idle_deadline > current_time_us && (deadline == 0 || idle_deadline < deadline)) {
+            deadline = idle_deadline;
+        }
+    }
+
+    return deadline;
 }
 
-static void anim_update_state(animation_state_t *state) {
+static long anim_update_state(animation_state_t *state) {
     long current_time_us = anim_get_current_time_us();
+    state->scheduled_sleep = current_config->enable_scheduled_sleep && anim_is_sleep_time(current_config);
     
     pthread_mutex_lock(&anim_lock);
 
+    // Step indices only hold for the timeline the cursor was reset against
+    if (state->generation != anim_timeline_generation) {
+        timeline_reset(&anim_timeline, &state->cursor, state->cursor.state, current_time_us);
+        state->generation = anim_timeline_generation;
+    }
+
     anim_handle_test_animation(state, current_time_us);
     anim_handle_key_press(state, current_time_us);
     anim_handle_idle_return(state, current_time_us);
+
+    int frame = timeline_tick(&anim_timeline, &state->cursor, current_time_us);
+
+    // Streamed frames may still be decoding; the last one stays up meanwhile
+    if (anim_frame_cache.stream) {
+        anim_stream_request(anim_frame_cache.stream, frame);
+        if (!anim_frame_cache.frames[frame].pixels) {
+            frame = anim_index;
+        }
+    }
+    if (frame != anim_index && current_config->enable_debug) {
+        bongocat_log_debug("Animation frame change: %d", frame);
+    }
+    anim_index = frame;
     
     pthread_mutex_unlock(&anim_lock);
+
+    return anim_next_deadline(state, current_time_us);
 }
 
 // =============================================================================
 // ANIMATION THREAD MANAGEMENT MODULE
 // =============================================================================
 
+// Key presses and shutdown wake the thread through an eventfd; every
+// time-based transition is one absolute timerfd deadline, so an idle cat
+// never wakes up.
+static int anim_wake_fd = -1;
+static int anim_timer_fd = -1;         // CLOCK_MONOTONIC: hold, test and idle deadlines
+static int anim_schedule_fd = -1;      // CLOCK_REALTIME: next sleep_begin/sleep_end
+
+static void anim_wake(void) {
+    if (anim_wake_fd >= 0) {
+        uint64_t one = 1;
+        if (write(anim_wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+            bongocat_log_warning("Failed to wake animation thread: %s", strerror(errno));
+        }
+    }
+}
+
+static void anim_drain_fd(int fd) {
+    uint64_t count;
+    // Realtime timers fail with ECANCELED on clock changes, which just means re-arm
+    while (read(fd, &count, sizeof(count)) > 0) {
+    }
+}
+
+static void anim_arm_timer(int fd, int flags, long sec, long nsec) {
+    struct itimerspec spec = {
+        .it_interval = {0, 0},
+        .it_value = {sec, nsec},
+    };
+    if (timerfd_settime(fd, flags, &spec, NULL) < 0 && errno != ECANCELED) {
+        bongocat_log_warning("Failed to arm animation timer: %s", strerror(errno));
+    }
+}
+
+static void anim_arm_timers(long deadline_us) {
+    // A zero it_value disarms the timer
+    anim_arm_timer(anim_timer_fd, TFD_TIMER_ABSTIME, deadline_us / 1000000L,
+                   (deadline_us % 1000000L) * 1000);
+
+    long transition = current_config->enable_scheduled_sleep
+                          ? (long)anim_next_sleep_transition(current_config) : 0;
+    anim_arm_timer(anim_schedule_fd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, transition, 0);
+}
+
+static void anim_close_fds(void) {
+    int *fds[] = {&anim_wake_fd, &anim_timer_fd, &anim_schedule_fd};
+    for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+        if (*fds[i] >= 0) {
+            close(*fds[i]);
+            *fds[i] = -1;
+        }
+    }
+}
+
+static bongocat_error_t anim_create_fds(void) {
+    anim_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    anim_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    anim_schedule_fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (anim_wake_fd < 0 || anim_timer_fd < 0 || anim_schedule_fd < 0) {
+        bongocat_log_error("Failed to create animation timers: %s", strerror(errno));
+        anim_close_fds();
+        return BONGOCAT_ERROR_THREAD;
+    }
+    return BONGOCAT_SUCCESS;
+}
+
 static void anim_init_state(animation_state_t *state) {
+    long now = anim_get_current_time_us();
     state->hold_until = 0;
-    state->test_counter = 0;
-    state->test_interval_frames = current_config->test_animation_interval * current_config->fps;
-    state->frame_time_ns = 1000000000L / current_config->fps;
-    state->last_key_pressed_timestamp = anim_get_current_time_us();
+    state->next_test_us = now + current_config->test_animation_interval * 1000000L;
+    state->frame_time_us = 1000000L / current_config->fps;
+    state->last_key_pressed_timestamp = now;
+    state->scheduled_sleep = false;
+    state->keys_pending = false;
+    state->cursor = (timeline_cursor_t){ .state = TIMELINE_STATE_IDLE };
+    state->generation = 0;  // Never a built timeline's, so the first update resets the cursor
+}
+
+// Leave shutdown signals to the main thread, which blocks in poll()
+static void anim_block_signals(void) {
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGCHLD);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
 }
 
 static void *anim_thread_main(void *arg __attribute__((unused))) {
+    anim_block_signals();
+
     animation_state_t state;
     anim_init_state(&state);
-    
-    struct timespec frame_delay = {0, state.frame_time_ns};
+
+    struct pollfd fds[] = {
+        {.fd = anim_wake_fd, .events = POLLIN},
+        {.fd = anim_timer_fd, .events = POLLIN},
+        {.fd = anim_schedule_fd, .events = POLLIN},
+    };
     
     animation_running = true;
     bongocat_log_debug("Animation thread main loop started");
     
     while (animation_running) {
-        anim_update_state(&state);
+        int previous_frame = anim_index;
+        long deadline_us = anim_update_state(&state);
         draw_bar();
-        nanosleep(&frame_delay, NULL);
-    }
-    
-    bongocat_log_debug("Animation thread main loop exited");
-    return NULL;
-}
-
-// =============================================================================
-// IMAGE LOADING MODULE
-// =============================================================================
-
-typedef struct {
-    const unsigned char *data;
-    size_t size;
-    const char *name;
-} embedded_image_t;
-
-static embedded_image_t embedded_images[NUM_FRAMES];
+        anim_arm_timers(deadline_us);
 
-static void init_embedded_images(void) {
-    embedded_images[BONGOCAT_FRAME_BOTH_UP] = (embedded_image_t){bongo_cat_both_up_png, bongo_cat_both_up_png_size, "embedded bongo-cat-both-up.png"};
-    embedded_images[BONGOCAT_FRAME_LEFT_DOWN] = (embedded_image_t){bongo_cat_left_down_png, bongo_cat_left_down_png_size, "embedded bongo-cat-left-down.png"};
-    embedded_images[BONGOCAT_FRAME_RIGHT_DOWN] = (embedded_image_t){bongo_cat_right_down_png, bongo_cat_right_down_png_size, "embedded bongo-cat-right-down.png"};
-    embedded_images[BONGOCAT_FRAME_BOTH_DOWN] = (embedded_image_t){bongo_cat_both_down_png, bongo_cat_both_down_png_size, "embedded bongo-cat-both-down.png"};
-}
+        // Cap the rate of frame changes at fps while the cat is active
+        if (anim_index != previous_frame) {
+            struct timespec frame_delay = {0, state.frame_time_us * 1000};
+            nanosleep(&frame_delay, NULL);
+        }
 
-static void anim_cleanup_loaded_images(int count) {
-    for (int i = 0; i < count; i++) {
-        if (anim_imgs[i]) {
-            stbi_image_free(anim_imgs[i]);
-            anim_imgs[i] = NULL;
+        if (poll(fds, sizeof(fds) / sizeof(fds[0]), -1) < 0) {
+            if (errno == EINTR) continue;
+            bongocat_log_error("Animation poll failed: %s", strerror(errno));
+            break;
         }
-    }
-}
 
-static bongocat_error_t anim_load_embedded_images(void) {
-    for (int i = 0; i < NUM_FRAMES; i++) {
-        const embedded_image_t *img = &embedded_images[i];
-        
-        bongocat_log_debug("Loading embedded image: %s", img->name);
-        
-        anim_imgs[i] = stbi_load_from_memory(img->data, img->size, 
-                                           &anim_width[i], &anim_height[i], NULL, 4);
-        if (!anim_imgs[i]) {
-            bongocat_log_error("Failed to load embedded image: %s", img->name);
-            anim_cleanup_loaded_images(i);
-            return BONGOCAT_ERROR_FILE_IO;
+        for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+            if (fds[i].revents & POLLIN) {
+                anim_drain_fd(fds[i].fd);
+            }
         }
-        
-        bongocat_log_debug("Loaded %dx%d embedded image", anim_width[i], anim_height[i]);
     }
     
-    return BONGOCAT_SUCCESS;
+    bongocat_log_debug("Animation thread main loop exited");
+    return NULL;
+}
+
+// Startup asset loading runs while Wayland connects; the frame workers it
+// spawns inherit its signal mask
+static void *anim_loader_main(void *arg) {
+    anim_block_signals();
+
+    const config_t *config = arg;
+    anim_loader_result = anim_rebuild_frame_cache(config);
+    return NULL;
 }
 
 // =============================================================================
@@ -298,19 +2082,50 @@ bongocat_error_t animation_init(config_t *config) {
     current_config = config;
     bongocat_log_info("Initializing animation system");
     
-    // Initialize embedded images data
-    init_embedded_images();
-    
-    bongocat_error_t result = anim_load_embedded_images();
+    // Created before input monitoring starts; its thread wakes us through anim_wake_fd
+    bongocat_error_t result = anim_create_fds();
     if (result != BONGOCAT_SUCCESS) {
         return result;
     }
-    
-    bongocat_log_info("Animation system initialized successfully with embedded assets");
+
+    // Initialize embedded images data
+    init_embedded_images();
+
+    // Decode and scale in the background; joined at the first configure
+    pthread_mutex_lock(&anim_loader_lock);
+    anim_loader_start_us = anim_get_current_time_us();
+    const bool started = pthread_create(&anim_loader_thread, NULL, anim_loader_main, config) == 0;
+    anim_loader_pending = started;
+    pthread_mutex_unlock(&anim_loader_lock);
+    if (!started) {
+        bongocat_log_warning("Failed to create asset loader thread, loading synchronously");
+        anim_loader_result = anim_rebuild_frame_cache(config);
+    }
+
+    bongocat_log_info("Animation system initialized, loading embedded assets");
     return BONGOCAT_SUCCESS;
 }
 
+bongocat_error_t animation_wait_ready(void) {
+    // The main thread and the config watcher may both wait
+    pthread_mutex_lock(&anim_loader_lock);
+    if (anim_loader_pending) {
+        pthread_join(anim_loader_thread, NULL);
+        anim_loader_pending = false;
+        bongocat_log_debug("Embedded assets ready %ld us after animation_init",
+                           anim_get_current_time_us() - anim_loader_start_us);
+    }
+    const bongocat_error_t result = anim_loader_result;
+    pthread_mutex_unlock(&anim_loader_lock);
+    return result;
+}
+
 bongocat_error_t animation_start(void) {
+    bongocat_error_t ready = animation_wait_ready();
+    if (ready != BONGOCAT_SUCCESS) {
+        return ready;
+    }
+
     bongocat_log_info("Starting animation thread");
     
     int result = pthread_create(&anim_thread, NULL, anim_thread_main, NULL);
@@ -327,14 +2142,27 @@ void animation_cleanup(void) {
     if (animation_running) {
         bongocat_log_debug("Stopping animation thread");
         animation_running = false;
+        anim_wake();
         
         // Wait for thread to finish gracefully
         pthread_join(anim_thread, NULL);
         bongocat_log_debug("Animation thread stopped");
     }
+
+    animation_wait_ready();
+    if (anim_scale_thread_started) {
+        pthread_join(anim_scale_thread, NULL);
+        anim_scale_thread_started = false;
+    }
     
     // Cleanup loaded images
     anim_cleanup_loaded_images(NUM_FRAMES);
+    anim_free_frame_cache(&anim_frame_cache);
+    for (int i = 0; i < ANIM_MAX_SCALES - 1; i++) {
+        anim_free_frame_cache(&anim_scaled_caches[i]);
+    }
+    timeline_free(&anim_timeline);
+    anim_close_fds();
     
     // Cleanup mutex
     pthread_mutex_destroy(&anim_lock);
@@ -342,6 +2170,40 @@ void animation_cleanup(void) {
     bongocat_log_debug("Animation cleanup complete");
 }
 
+void animation_update_config(config_t *config) {
+    if (!config) {
+        bongocat_log_error("Cannot update animation config: config is NULL");
+        return;
+    }
+
+    // Builds for other scales still running belong to the old config
+    pthread_mutex_lock(&anim_lock);
+    anim_config_epoch++;
+    pthread_mutex_unlock(&anim_lock);
+
+    current_config = config;
+    anim_rebuild_frame_cache(config);
+
+    // Timeouts may have changed, recompute the deadlines
+    anim_wake();
+}
+
 void animation_trigger(void) {
-    *any_key_pressed = 1;
+    anim_wake();
+}
+
+void animation_set_scale(int scale) {
+    if (scale <= 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&anim_lock);
+    const bool changed = scale != anim_scale;
+    anim_scale = scale;
+    pthread_mutex_unlock(&anim_lock);
+
+    if (changed) {
+        bongocat_log_info("Output scale is now %d/%d", scale, ANIM_SCALE_ONE);
+        anim_request_scale();
+    }
 }
\ No newline at end of file
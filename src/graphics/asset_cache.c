@@ -0,0 +1,179 @@
+#define _POSIX_C_SOURCE 200809L
+#include "graphics/asset_cache.h"
+#include "utils/error.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Bump when the resampler or the pixel layout changes
+#define ASSET_CACHE_VERSION 1
+#define ASSET_CACHE_MAGIC 0x43464342u  // "BCFC"
+#define ASSET_CACHE_FORMAT "argb8888p"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t hash;
+    int32_t width;
+    int32_t height;
+    char format[16];
+} asset_cache_header_t;
+
+// =============================================================================
+// PATH MANAGEMENT
+// =============================================================================
+
+static bool asset_cache_dir(char *out, size_t out_size) {
+    const char *xdg = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    int n;
+
+    if (xdg && xdg[0] == '/') {
+        n = snprintf(out, out_size, "%s/bongocat", xdg);
+    } else if (home && home[0]) {
+        n = snprintf(out, out_size, "%s/.cache/bongocat", home);
+    } else {
+        return false;
+    }
+    return n > 0 && (size_t)n < out_size;
+}
+
+static bool asset_cache_path(char *out, size_t out_size, uint64_t hash, int width, int height) {
+    char dir[PATH_MAX];
+    if (!asset_cache_dir(dir, sizeof(dir))) {
+        return false;
+    }
+    int n = snprintf(out, out_size, "%s/%016llx-%dx%d-%s.bin", dir,
+                     (unsigned long long)hash, width, height, ASSET_CACHE_FORMAT);
+    return n > 0 && (size_t)n < out_size;
+}
+
+// mkdir -p for the cache directory
+static bool asset_cache_ensure_dir(void) {
+    char dir[PATH_MAX];
+    if (!asset_cache_dir(dir, sizeof(dir))) {
+        return false;
+    }
+
+    for (char *p = dir + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+                return false;
+            }
+            *p = '/';
+        }
+    }
+    return mkdir(dir, 0755) == 0 || errno == EEXIST;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+// 64-bit FNV-1a
+uint64_t asset_cache_hash(const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+bool asset_cache_lookup(uint64_t hash, int width, int height, asset_cache_entry_t *entry) {
+    char path[PATH_MAX];
+    *entry = (asset_cache_entry_t){0};
+    if (!asset_cache_path(path, sizeof(path), hash, width, height)) {
+        return false;
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    const size_t expected = sizeof(asset_cache_header_t) + (size_t)width * height * 4;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size != expected) {
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, expected, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    const asset_cache_header_t *header = map;
+    if (header->magic != ASSET_CACHE_MAGIC || header->version != ASSET_CACHE_VERSION ||
+        header->hash != hash || header->width != width || header->height != height ||
+        strncmp(header->format, ASSET_CACHE_FORMAT, sizeof(header->format)) != 0) {
+        munmap(map, expected);
+        return false;
+    }
+
+    entry->map = map;
+    entry->map_size = expected;
+    entry->pixels = (const uint32_t *)(header + 1);
+    bongocat_log_debug("Frame cache hit: %s", path);
+    return true;
+}
+
+void asset_cache_release(asset_cache_entry_t *entry) {
+    if (entry->map) {
+        munmap(entry->map, entry->map_size);
+    }
+    *entry = (asset_cache_entry_t){0};
+}
+
+bongocat_error_t asset_cache_store(uint64_t hash, int width, int height, const uint32_t *pixels) {
+    char path[PATH_MAX];
+    char tmp_path[PATH_MAX + 16];
+    if (!asset_cache_ensure_dir() || !asset_cache_path(path, sizeof(path), hash, width, height)) {
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+    snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", path);
+
+    asset_cache_header_t header = {
+        .magic = ASSET_CACHE_MAGIC,
+        .version = ASSET_CACHE_VERSION,
+        .hash = hash,
+        .width = width,
+        .height = height,
+    };
+    strncpy(header.format, ASSET_CACHE_FORMAT, sizeof(header.format) - 1);
+
+    int fd = mkstemp(tmp_path);
+    FILE *file = fd >= 0 ? fdopen(fd, "wb") : NULL;
+    if (!file) {
+        bongocat_log_warning("Cannot write frame cache %s: %s", path, strerror(errno));
+        if (fd >= 0) {
+            close(fd);
+            unlink(tmp_path);
+        }
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+
+    const size_t count = (size_t)width * height;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(pixels, sizeof(uint32_t), count, file) == count;
+    ok = (fclose(file) == 0) && ok;
+
+    // Readers only ever see complete files
+    if (!ok || rename(tmp_path, path) != 0) {
+        bongocat_log_warning("Cannot write frame cache %s: %s", path, strerror(errno));
+        unlink(tmp_path);
+        return BONGOCAT_ERROR_FILE_IO;
+    }
+
+    bongocat_log_debug("Frame cache stored: %s", path);
+    return BONGOCAT_SUCCESS;
+}
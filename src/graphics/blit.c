@@ -0,0 +1,222 @@
+#define _POSIX_C_SOURCE 200809L
+#include "graphics/blit.h"
+#include "utils/error.h"
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BLIT_HAVE_X86 1
+#endif
+
+#if defined(__aarch64__) || (defined(__ARM_NEON) && defined(__arm__))
+#include <arm_neon.h>
+#define BLIT_HAVE_NEON 1
+#endif
+
+// =============================================================================
+// SCALAR REFERENCE KERNELS
+// =============================================================================
+
+// Rounded x / 255 for x in [0, 255 * 255]
+static inline uint32_t blit_div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+static void fill_scalar(uint32_t *dest, uint32_t value, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        dest[i] = value;
+    }
+}
+
+static void blend_over_scalar(uint32_t *dest, const uint32_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t px = src[i];
+        uint32_t dst = dest[i];
+        uint32_t inv = 255 - (px >> 24);
+        uint32_t out = 0;
+
+        for (int shift = 0; shift < 32; shift += 8) {
+            uint32_t v = ((px >> shift) & 0xFF) + blit_div255(((dst >> shift) & 0xFF) * inv);
+            out |= (v > 255 ? 255 : v) << shift;
+        }
+        dest[i] = out;
+    }
+}
+
+static const blit_ops_t scalar_ops = {
+    .name = "scalar",
+    .fill = fill_scalar,
+    .blend_over = blend_over_scalar,
+};
+
+// =============================================================================
+// X86 KERNELS (SSE2 BASELINE, AVX2 SELECTED AT RUNTIME)
+// =============================================================================
+
+#ifdef BLIT_HAVE_X86
+
+__attribute__((target("sse2")))
+static void fill_sse2(uint32_t *dest, uint32_t value, size_t count) {
+    __m128i v = _mm_set1_epi32((int)value);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i *)(dest + i), v);
+    }
+    fill_scalar(dest + i, value, count - i);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i div255_sse2(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// Blends two pixels widened to 16-bit lanes (B, G, R, A, B, G, R, A)
+__attribute__((target("sse2")))
+static inline __m128i blend_over_wide_sse2(__m128i s, __m128i d) {
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+    return _mm_add_epi16(s, div255_sse2(_mm_mullo_epi16(d, inv)));
+}
+
+__attribute__((target("sse2")))
+static void blend_over_sse2(uint32_t *dest, const uint32_t *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i px = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i dst = _mm_loadu_si128((const __m128i *)(dest + i));
+
+        __m128i lo = blend_over_wide_sse2(_mm_unpacklo_epi8(px, zero), _mm_unpacklo_epi8(dst, zero));
+        __m128i hi = blend_over_wide_sse2(_mm_unpackhi_epi8(px, zero), _mm_unpackhi_epi8(dst, zero));
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_packus_epi16(lo, hi));
+    }
+    blend_over_scalar(dest + i, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void fill_avx2(uint32_t *dest, uint32_t value, size_t count) {
+    __m256i v = _mm256_set1_epi32((int)value);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i *)(dest + i), v);
+    }
+    fill_scalar(dest + i, value, count - i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i div255_avx2(__m256i x) {
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i blend_over_wide_avx2(__m256i s, __m256i d) {
+    __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+    __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+    return _mm256_add_epi16(s, div255_avx2(_mm256_mullo_epi16(d, inv)));
+}
+
+__attribute__((target("avx2")))
+static void blend_over_avx2(uint32_t *dest, const uint32_t *src, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i px = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i dst = _mm256_loadu_si256((const __m256i *)(dest + i));
+
+        // Unpack and pack both work per 128-bit lane, so pixel order is kept
+        __m256i lo = blend_over_wide_avx2(_mm256_unpacklo_epi8(px, zero), _mm256_unpacklo_epi8(dst, zero));
+        __m256i hi = blend_over_wide_avx2(_mm256_unpackhi_epi8(px, zero), _mm256_unpackhi_epi8(dst, zero));
+        _mm256_storeu_si256((__m256i *)(dest + i), _mm256_packus_epi16(lo, hi));
+    }
+    blend_over_scalar(dest + i, src + i, count - i);
+}
+
+static const blit_ops_t sse2_ops = {
+    .name = "sse2",
+    .fill = fill_sse2,
+    .blend_over = blend_over_sse2,
+};
+
+static const blit_ops_t avx2_ops = {
+    .name = "avx2",
+    .fill = fill_avx2,
+    .blend_over = blend_over_avx2,
+};
+
+#endif // BLIT_HAVE_X86
+
+// =============================================================================
+// ARM NEON KERNELS
+// =============================================================================
+
+#ifdef BLIT_HAVE_NEON
+
+static void fill_neon(uint32_t *dest, uint32_t value, size_t count) {
+    uint32x4_t v = vdupq_n_u32(value);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_u32(dest + i, v);
+    }
+    fill_scalar(dest + i, value, count - i);
+}
+
+static inline uint8x8_t div255_neon(uint16x8_t x) {
+    return vraddhn_u16(x, vrshrq_n_u16(x, 8));
+}
+
+static void blend_over_neon(uint32_t *dest, const uint32_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        // Planes are B, G, R, A for both source and destination
+        uint8x8x4_t s = vld4_u8((const uint8_t *)(src + i));
+        uint8x8x4_t d = vld4_u8((const uint8_t *)(dest + i));
+        uint8x8_t inv = vmvn_u8(s.val[3]);
+
+        for (int c = 0; c < 4; c++) {
+            d.val[c] = vqadd_u8(s.val[c], div255_neon(vmull_u8(d.val[c], inv)));
+        }
+        vst4_u8((uint8_t *)(dest + i), d);
+    }
+    blend_over_scalar(dest + i, src + i, count - i);
+}
+
+static const blit_ops_t neon_ops = {
+    .name = "neon",
+    .fill = fill_neon,
+    .blend_over = blend_over_neon,
+};
+
+#endif // BLIT_HAVE_NEON
+
+// =============================================================================
+// RUNTIME DISPATCH
+// =============================================================================
+
+static const blit_ops_t *selected_ops = &scalar_ops;
+static pthread_once_t select_once = PTHREAD_ONCE_INIT;
+
+static void blit_select_ops(void) {
+#ifdef BLIT_HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        selected_ops = &avx2_ops;
+    } else if (__builtin_cpu_supports("sse2")) {
+        selected_ops = &sse2_ops;
+    }
+#elif defined(BLIT_HAVE_NEON)
+    selected_ops = &neon_ops;
+#endif
+    bongocat_log_debug("Using %s pixel kernels", selected_ops->name);
+}
+
+const blit_ops_t *blit_get_ops(void) {
+    pthread_once(&select_once, blit_select_ops);
+    return selected_ops;
+}
+
+const blit_ops_t *blit_get_scalar_ops(void) {
+    return &scalar_ops;
+}
@@ -1,3352 +1,4807 @@
 #include "graphics/embedded_assets.h"
 
-const unsigned char bongo_cat_both_up_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x01, 0x68,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x06, 0x80, 0x68, 0xd2, 0x00, 0x00, 0x00,
-  0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x26, 0x00, 0x00, 0x80,
-  0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x80, 0xe8, 0x00, 0x00, 0x75,
-  0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17,
-  0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00, 0x00, 0xe7, 0x50, 0x4c, 0x54,
-  0x45, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
-  0x0f, 0x7f, 0x7f, 0x7f, 0xbf, 0xbf, 0xbf, 0xff, 0xff, 0xff, 0xef, 0xef,
-  0xef, 0x6f, 0x6f, 0x6f, 0x9f, 0x9f, 0x9f, 0xcf, 0xcf, 0xcf, 0x3f, 0x3f,
-  0x3f, 0x5f, 0x5f, 0x5f, 0xaf, 0xaf, 0xaf, 0x2f, 0x2f, 0x2f, 0xdf, 0xdf,
-  0xdf, 0x1f, 0x1f, 0x1f, 0x8f, 0x8f, 0x8f, 0x4f, 0x4f, 0x4f, 0x68, 0x68,
-  0x68, 0x15, 0x15, 0x15, 0x23, 0x23, 0x23, 0x95, 0x95, 0x95, 0x17, 0x17,
-  0x17, 0xfe, 0xf9, 0xf9, 0xfb, 0xd4, 0xd7, 0xf9, 0xb6, 0xba, 0xfa, 0xc8,
-  0xcc, 0xfe, 0xf3, 0xf4, 0xfc, 0xda, 0xdd, 0xf8, 0xb0, 0xb5, 0xf7, 0x9e,
-  0xa4, 0xf7, 0xa4, 0xa9, 0xfa, 0xc2, 0xc6, 0xfd, 0xed, 0xee, 0xf8, 0xaa,
-  0xaf, 0x07, 0x07, 0x07, 0xfc, 0xe1, 0xe2, 0xfb, 0xce, 0xd1, 0x53, 0x53,
-  0x53, 0x02, 0x02, 0x02, 0x13, 0x13, 0x13, 0xfd, 0xe7, 0xe8, 0x01, 0x01,
-  0x01, 0xf9, 0xbc, 0xc0, 0x09, 0x09, 0x09, 0x40, 0x40, 0x40, 0x59, 0x59,
-  0x59, 0x33, 0x33, 0x33, 0x20, 0x20, 0x20, 0x45, 0x45, 0x45, 0x37, 0x37,
-  0x37, 0x08, 0x08, 0x08, 0x77, 0x77, 0x77, 0xb3, 0xb3, 0xb3, 0x04, 0x04,
-  0x04, 0x3b, 0x3b, 0x3b, 0xf7, 0x04, 0x74, 0xaa, 0x00, 0x00, 0x00, 0x16,
-  0x74, 0x52, 0x4e, 0x53, 0x00, 0x30, 0x40, 0x20, 0xd0, 0xa0, 0x10, 0x90,
-  0xf0, 0x80, 0xe0, 0xc0, 0x50, 0xb0, 0x70, 0x60, 0xe8, 0x58, 0x64, 0xc8,
-  0xef, 0xe4, 0xfd, 0xe1, 0x31, 0xe2, 0x00, 0x00, 0x00, 0x01, 0x62, 0x4b,
-  0x47, 0x44, 0x00, 0x88, 0x05, 0x1d, 0x48, 0x00, 0x00, 0x00, 0x09, 0x70,
-  0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b, 0x12, 0x01,
-  0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45,
-  0x07, 0xe9, 0x08, 0x02, 0x06, 0x19, 0x13, 0x7c, 0xd5, 0xf7, 0xd4, 0x00,
-  0x00, 0x00, 0x01, 0x6f, 0x72, 0x4e, 0x54, 0x01, 0xcf, 0xa2, 0x77, 0x9a,
-  0x00, 0x00, 0x18, 0x87, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xdd,
-  0x79, 0x7b, 0xdb, 0xb6, 0x96, 0x80, 0xf1, 0xeb, 0x4d, 0xd6, 0x12, 0xdb,
-  0xb3, 0x6a, 0xdf, 0x2c, 0x4b, 0xea, 0xf4, 0x5e, 0xc7, 0x49, 0xbc, 0x24,
-  0x8d, 0xd3, 0xba, 0x69, 0x7b, 0x67, 0x6e, 0x67, 0xf9, 0xfe, 0x9f, 0x67,
-  0xbc, 0x10, 0x20, 0x40, 0x82, 0x14, 0xb8, 0x48, 0x20, 0xa8, 0xf7, 0xf7,
-  0x57, 0x9f, 0xc6, 0x56, 0x14, 0x82, 0x87, 0x00, 0x0e, 0x0e, 0xc0, 0xbf,
-  0xfc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x57, 0x0e, 0x0e,
-  0x8f, 0x5c, 0x7f, 0x05, 0xa0, 0xae, 0x0e, 0x8e, 0xbb, 0xdd, 0xee, 0x09,
-  0x21, 0x06, 0x6c, 0x43, 0xe3, 0x25, 0xbe, 0x9e, 0x9d, 0x36, 0x5c, 0x7f,
-  0x13, 0xa0, 0x86, 0x82, 0xf8, 0xea, 0x76, 0x9b, 0x2d, 0xd7, 0x5f, 0x05,
-  0xa8, 0x9d, 0x93, 0x6e, 0xa8, 0x7d, 0xe8, 0xfa, 0xdb, 0x00, 0xf5, 0xd2,
-  0xea, 0x6a, 0x3a, 0x4c, 0xc5, 0x80, 0xf2, 0xbc, 0xeb, 0x46, 0x31, 0x4e,
-  0x04, 0xca, 0x72, 0xd0, 0x8c, 0x05, 0x18, 0xe3, 0x44, 0xa0, 0x24, 0x8d,
-  0xe3, 0xae, 0x09, 0xf9, 0x44, 0xa0, 0x0c, 0x67, 0x22, 0xa4, 0x7a, 0xfd,
-  0x9e, 0x1a, 0x61, 0xcd, 0x77, 0xae, 0xbf, 0x19, 0xe0, 0xbf, 0x73, 0x19,
-  0x51, 0x83, 0xe1, 0x68, 0xac, 0x75, 0x62, 0x67, 0x74, 0x62, 0x40, 0x31,
-  0x07, 0x32, 0x9c, 0x26, 0xc3, 0x67, 0xd3, 0x19, 0x33, 0x31, 0xa0, 0x34,
-  0x8d, 0xb6, 0x08, 0xa6, 0xf9, 0xf0, 0xcd, 0xa5, 0x36, 0x4e, 0x64, 0x26,
-  0x06, 0x14, 0x20, 0x27, 0x60, 0x8b, 0xa1, 0xa0, 0x8f, 0x13, 0x8f, 0x0f,
-  0x5c, 0x7f, 0x45, 0xc0, 0x5b, 0x17, 0x32, 0xc1, 0x71, 0x35, 0x0c, 0x0d,
-  0x16, 0x6a, 0xae, 0xe3, 0xdc, 0xf5, 0x97, 0x04, 0x3c, 0x75, 0x24, 0x57,
-  0xc0, 0x2e, 0x87, 0x9a, 0x3e, 0xb9, 0x0e, 0xa0, 0xb0, 0x8e, 0x88, 0xa1,
-  0xf1, 0x30, 0x62, 0xaa, 0x76, 0x62, 0x6d, 0x86, 0x89, 0x40, 0x76, 0xe7,
-  0xf1, 0x09, 0x98, 0xb9, 0x13, 0x6b, 0x5e, 0xb8, 0xfe, 0xaa, 0x80, 0x77,
-  0xe4, 0x00, 0x51, 0x9b, 0x80, 0x85, 0x9d, 0xd8, 0x52, 0x09, 0xb1, 0x13,
-  0xd7, 0x5f, 0x16, 0xf0, 0x8d, 0x1c, 0x20, 0xae, 0x86, 0x46, 0xa3, 0xb9,
-  0x9a, 0x4d, 0x64, 0x22, 0x06, 0x64, 0x21, 0x07, 0x88, 0xeb, 0x61, 0x12,
-  0x75, 0x4d, 0xac, 0xc9, 0x44, 0x0c, 0xb0, 0xd7, 0x90, 0x03, 0xc4, 0x51,
-  0x62, 0x80, 0x0d, 0xaf, 0x16, 0x4c, 0xc4, 0x80, 0x3c, 0xe4, 0x26, 0xe6,
-  0xcb, 0x61, 0x1a, 0x75, 0x98, 0xc8, 0x8a, 0x18, 0x60, 0xe9, 0x70, 0xf3,
-  0x00, 0xf1, 0xcd, 0x44, 0x19, 0x26, 0x92, 0xea, 0x00, 0xec, 0x88, 0x1a,
-  0x44, 0x73, 0x06, 0x31, 0x29, 0x9b, 0xc8, 0x9a, 0x33, 0x60, 0x43, 0x66,
-  0x38, 0x56, 0x9b, 0xe2, 0x6b, 0x38, 0x1c, 0x29, 0x15, 0xf6, 0x24, 0x13,
-  0x81, 0xcd, 0x64, 0x86, 0x63, 0xb1, 0x39, 0xbe, 0xf4, 0x89, 0xd8, 0x31,
-  0x07, 0xe2, 0x00, 0x9b, 0x9c, 0x86, 0x9b, 0x2c, 0xad, 0x4c, 0x48, 0xd7,
-  0x03, 0xd6, 0x8e, 0xa2, 0x9b, 0xc0, 0x36, 0x1a, 0xf4, 0x88, 0x30, 0xc0,
-  0x92, 0x48, 0xd1, 0xa7, 0x2d, 0x81, 0x45, 0x53, 0x1d, 0x44, 0x18, 0x60,
-  0x47, 0xa6, 0xe8, 0xfb, 0xd6, 0xf1, 0x35, 0x1c, 0x8e, 0x16, 0x44, 0x18,
-  0x60, 0x43, 0x14, 0x21, 0x2e, 0x33, 0xc4, 0x17, 0x11, 0x06, 0xd8, 0x91,
-  0x1d, 0xd8, 0x24, 0x53, 0x80, 0xa9, 0xc5, 0xbf, 0x44, 0x18, 0x90, 0x44,
-  0x74, 0x60, 0xb3, 0x6c, 0xf1, 0x35, 0x54, 0xd3, 0xf5, 0x44, 0x18, 0x60,
-  0x26, 0x3b, 0x30, 0xcb, 0x14, 0x3d, 0x11, 0x06, 0x64, 0x90, 0xbf, 0x03,
-  0x23, 0xc2, 0x80, 0x4d, 0x0e, 0x0a, 0x74, 0x60, 0x7a, 0x84, 0x51, 0xd3,
-  0x01, 0xc4, 0x9c, 0x14, 0xe9, 0xc0, 0xb4, 0x08, 0x3b, 0x6e, 0x9d, 0x1f,
-  0x4a, 0x7b, 0x52, 0xa3, 0xd8, 0x38, 0x6f, 0x9d, 0x72, 0x18, 0x2b, 0x92,
-  0x1d, 0x15, 0xeb, 0xc0, 0x86, 0xfa, 0x0e, 0xb1, 0xa8, 0x66, 0xe7, 0x45,
-  0xeb, 0xd9, 0x4b, 0xec, 0xd5, 0x6f, 0x10, 0x79, 0xd1, 0xa6, 0xe2, 0x19,
-  0xa9, 0x8a, 0x76, 0x60, 0x1b, 0x22, 0x2c, 0xa6, 0xdd, 0xe9, 0x9c, 0x3d,
-  0xc7, 0x5b, 0x2d, 0xa2, 0xed, 0x50, 0xec, 0xf1, 0xe9, 0xb8, 0xfe, 0x26,
-  0xa8, 0x2a, 0x59, 0x46, 0x9f, 0xbb, 0x03, 0xcb, 0x1a, 0x61, 0x7a, 0xff,
-  0x76, 0xfa, 0x12, 0x6b, 0x7e, 0x76, 0x00, 0x87, 0x9d, 0xf0, 0x5f, 0xc2,
-  0x4b, 0x31, 0x60, 0x26, 0xf6, 0x81, 0x65, 0x2b, 0xe2, 0x28, 0x2b, 0xc2,
-  0xd4, 0x50, 0x6b, 0xb5, 0xde, 0xf9, 0x14, 0x69, 0x47, 0xea, 0x7b, 0xe2,
-  0xe9, 0xc2, 0x90, 0x40, 0x0c, 0x72, 0x32, 0x16, 0x71, 0x44, 0x8c, 0x16,
-  0x39, 0x82, 0x2a, 0x61, 0x04, 0x79, 0xd2, 0xba, 0xa8, 0x7e, 0xa0, 0x35,
-  0x4e, 0x23, 0xdf, 0x9b, 0x0c, 0x2a, 0x4c, 0xc4, 0x22, 0x73, 0xaf, 0x50,
-  0x7c, 0x95, 0x19, 0x61, 0x81, 0xe3, 0x4e, 0xeb, 0xfc, 0xb0, 0xaa, 0x77,
-  0x6d, 0xa3, 0x15, 0x7b, 0x8b, 0x35, 0xa7, 0x93, 0xc0, 0x44, 0xbc, 0xad,
-  0x28, 0x4b, 0x19, 0xbd, 0x39, 0xc2, 0x0a, 0x8f, 0x12, 0x93, 0xe3, 0xac,
-  0x6a, 0xfd, 0xd9, 0x45, 0x3b, 0xfe, 0x45, 0x9b, 0x55, 0xfb, 0x92, 0xa8,
-  0x82, 0x86, 0xb8, 0x3f, 0x36, 0x9e, 0x74, 0x63, 0xe7, 0x6a, 0x20, 0x5c,
-  0xf6, 0x5f, 0xcd, 0x67, 0xcf, 0x8a, 0xf7, 0x6e, 0xcf, 0xe3, 0xc6, 0xca,
-  0x74, 0x67, 0x87, 0x6d, 0xe3, 0x57, 0xe4, 0x90, 0x48, 0xc4, 0x89, 0x14,
-  0xc7, 0xa6, 0xa3, 0xda, 0x4a, 0x30, 0x7d, 0x8e, 0xba, 0x55, 0xbf, 0x3f,
-  0x7e, 0x0e, 0xb8, 0x9e, 0x7d, 0x64, 0x55, 0x2e, 0xcc, 0xd4, 0xd4, 0xe1,
-  0x8b, 0x99, 0x78, 0x3b, 0xe1, 0xb1, 0xeb, 0xb6, 0x44, 0xe5, 0x84, 0x53,
-  0x89, 0xcb, 0xe2, 0x01, 0x94, 0x39, 0xdc, 0x9e, 0xa3, 0x2d, 0x4f, 0xe7,
-  0xd6, 0xec, 0x9c, 0x5e, 0x38, 0x4b, 0x8a, 0xeb, 0xa9, 0xc3, 0x6e, 0x77,
-  0x31, 0x18, 0x0e, 0xc5, 0xe3, 0xa2, 0x06, 0xeb, 0x7a, 0x28, 0xd5, 0x85,
-  0x9c, 0xa9, 0x17, 0xcb, 0xd1, 0x17, 0x8e, 0xb5, 0xcb, 0x97, 0x50, 0xcb,
-  0xd6, 0xad, 0x1d, 0x9f, 0xb5, 0x76, 0x3f, 0x35, 0x8b, 0xa6, 0x0e, 0x97,
-  0xaf, 0xa9, 0x57, 0xd1, 0x85, 0x91, 0xe6, 0x80, 0x4a, 0x9d, 0x4a, 0x14,
-  0x4e, 0x71, 0x94, 0xe2, 0xea, 0x39, 0xd2, 0xc6, 0x59, 0xfa, 0xb4, 0xf6,
-  0x4e, 0xa3, 0x2c, 0x9a, 0x3a, 0xec, 0x05, 0x57, 0xed, 0x4a, 0x74, 0xad,
-  0xae, 0x5b, 0x14, 0x15, 0x72, 0xa4, 0x4d, 0x25, 0x4a, 0x4a, 0x71, 0x94,
-  0x64, 0x34, 0x98, 0xf4, 0xe7, 0xd6, 0x3d, 0xda, 0xae, 0xa2, 0x2c, 0x9a,
-  0x3a, 0xec, 0xcb, 0xf3, 0x81, 0xc4, 0x31, 0xac, 0xa4, 0x39, 0x10, 0x68,
-  0xb4, 0xb4, 0x7b, 0x65, 0x5c, 0x24, 0x1c, 0xb6, 0xe7, 0xb9, 0x43, 0xb3,
-  0x8d, 0xb3, 0xe3, 0x93, 0xf3, 0xed, 0x4e, 0x81, 0x0e, 0x8e, 0xf5, 0xbf,
-  0x70, 0xae, 0x3c, 0x93, 0xc4, 0x19, 0x91, 0x67, 0xae, 0x9b, 0x15, 0x15,
-  0x71, 0xa1, 0x8f, 0x75, 0xac, 0xcf, 0x42, 0x74, 0xe2, 0xa5, 0x3f, 0xb3,
-  0x1b, 0x37, 0x76, 0x4e, 0xdf, 0x6d, 0xab, 0x2b, 0x7b, 0xa7, 0x5f, 0xb1,
-  0xd9, 0x54, 0xfb, 0x86, 0xe2, 0x21, 0xc0, 0x52, 0x18, 0x9e, 0x1d, 0xe8,
-  0x89, 0xe6, 0x65, 0xb1, 0x22, 0xa9, 0x5d, 0x99, 0x5e, 0xf6, 0xd7, 0x16,
-  0x61, 0xd6, 0xde, 0x4a, 0x57, 0xa6, 0x27, 0x37, 0x16, 0xd1, 0xba, 0x68,
-  0xb1, 0xc6, 0xce, 0x18, 0x11, 0xd1, 0x4c, 0x58, 0xaf, 0x6f, 0x7f, 0xd4,
-  0x68, 0x05, 0xbc, 0xf4, 0x66, 0x1b, 0x07, 0x8d, 0xcd, 0xe7, 0x59, 0x59,
-  0x99, 0x97, 0xec, 0x48, 0x1b, 0x1e, 0x1a, 0x1e, 0x48, 0x97, 0x8c, 0x11,
-  0x11, 0x88, 0x8c, 0x75, 0xe6, 0x5e, 0x85, 0x57, 0x60, 0x34, 0xe8, 0xcf,
-  0x37, 0x76, 0x66, 0x9d, 0xd2, 0x82, 0xec, 0x50, 0xbd, 0x64, 0x3d, 0x63,
-  0xc2, 0x95, 0x31, 0x22, 0x5e, 0xe9, 0xb9, 0xc3, 0xc8, 0x54, 0xc2, 0x33,
-  0x83, 0xd5, 0x7c, 0xb6, 0x8b, 0x20, 0xd3, 0xf2, 0x41, 0x09, 0xfd, 0xbd,
-  0x18, 0x23, 0xbe, 0x73, 0xdd, 0xc0, 0x70, 0x4a, 0x5f, 0xc8, 0x59, 0xee,
-  0xbc, 0x7c, 0xa3, 0x7c, 0xd3, 0xd5, 0xa6, 0xbe, 0xac, 0xd3, 0x2a, 0x34,
-  0x27, 0x6b, 0xa8, 0x8f, 0xa4, 0x75, 0xd2, 0x72, 0x86, 0x18, 0x23, 0xb2,
-  0xd6, 0xbc, 0xcf, 0xf4, 0x4c, 0xb3, 0x67, 0x93, 0xaf, 0x34, 0x83, 0xd5,
-  0x7a, 0x99, 0x16, 0x63, 0xcd, 0xb3, 0xf3, 0xbc, 0x15, 0x8c, 0x07, 0xea,
-  0x23, 0x29, 0xe5, 0xd5, 0x84, 0xc1, 0x18, 0x91, 0xb5, 0xe6, 0x3d, 0xa6,
-  0x2f, 0x7d, 0xad, 0xab, 0xb5, 0xb6, 0x5c, 0xd8, 0xe8, 0xb2, 0x9f, 0x3a,
-  0x60, 0x6c, 0x9f, 0x5c, 0xe4, 0x98, 0x20, 0x9d, 0x2b, 0x9f, 0xb0, 0x4c,
-  0x1b, 0x4f, 0xaf, 0x83, 0x1f, 0xa2, 0x1e, 0x71, 0x5f, 0xe9, 0x7b, 0x2c,
-  0x96, 0x45, 0x0e, 0xe0, 0xa8, 0xae, 0xe7, 0x01, 0x63, 0x5a, 0x57, 0x76,
-  0x9c, 0x71, 0x4a, 0xd6, 0x38, 0x53, 0x7e, 0x79, 0x9d, 0xda, 0xe1, 0x8b,
-  0xb5, 0xe6, 0x73, 0xd7, 0xed, 0x0c, 0x27, 0x22, 0xb9, 0xf9, 0x6a, 0x94,
-  0x1e, 0x6e, 0xc7, 0xd5, 0x64, 0x9c, 0x32, 0x2b, 0x6b, 0x9e, 0x5d, 0x58,
-  0x8f, 0x16, 0x0f, 0xda, 0xf6, 0x97, 0x4c, 0xd4, 0x23, 0x72, 0x34, 0xc7,
-  0x5e, 0xd2, 0xbb, 0xaf, 0x59, 0xcd, 0x46, 0x87, 0x71, 0xa3, 0xcb, 0xb4,
-  0x20, 0x3b, 0x3e, 0xb5, 0x1a, 0xc8, 0xa9, 0xe5, 0x2e, 0xbd, 0x8d, 0x3d,
-  0xbe, 0xf8, 0xfb, 0x5c, 0x37, 0x35, 0x1c, 0xd0, 0x66, 0x5f, 0x3d, 0x3f,
-  0x0a, 0x37, 0x0a, 0x1b, 0x0d, 0x52, 0x82, 0xac, 0x79, 0xb2, 0xa9, 0xa8,
-  0xaa, 0xa1, 0x6e, 0xfc, 0x9a, 0x6d, 0xce, 0x07, 0x89, 0x3d, 0x2b, 0x4c,
-  0xc2, 0xf6, 0x8e, 0x9e, 0x3c, 0x5c, 0xd7, 0x26, 0x77, 0x68, 0x21, 0xb5,
-  0x27, 0x4b, 0x4d, 0x2d, 0x6a, 0x17, 0xcd, 0xa6, 0x16, 0x5a, 0x24, 0xea,
-  0x99, 0x84, 0xed, 0x1b, 0x35, 0x11, 0x56, 0xd7, 0xe4, 0x46, 0x9a, 0xd1,
-  0x65, 0x72, 0xe2, 0x23, 0x71, 0xb0, 0xa8, 0xd6, 0xbb, 0xf4, 0xac, 0x96,
-  0x0b, 0x47, 0x22, 0x6c, 0x5d, 0xb7, 0x37, 0x76, 0x4a, 0x2f, 0xdd, 0x18,
-  0xef, 0x53, 0xf7, 0xa5, 0xb8, 0x9a, 0xac, 0x93, 0x0a, 0x18, 0xdb, 0xa7,
-  0x86, 0xcc, 0xa2, 0x9a, 0x12, 0x5a, 0x58, 0xce, 0x58, 0x83, 0xae, 0xb2,
-  0xed, 0xba, 0xc5, 0xb1, 0x4b, 0x5a, 0xe5, 0xe1, 0x1e, 0x76, 0x5f, 0x8a,
-  0x69, 0x3f, 0x69, 0xb4, 0xf8, 0x3c, 0x21, 0xd3, 0x2e, 0x9a, 0x56, 0xdb,
-  0x6b, 0xbd, 0x95, 0x47, 0x54, 0x4b, 0x51, 0x8e, 0xb8, 0x3f, 0xb4, 0x89,
-  0xfa, 0xde, 0x76, 0x5f, 0xa1, 0xe4, 0xd1, 0xa2, 0x1a, 0x63, 0x6a, 0x6d,
-  0x6f, 0x86, 0x8c, 0xd0, 0x2a, 0xf8, 0x15, 0x0e, 0xa9, 0xdf, 0x1b, 0xda,
-  0x44, 0x7d, 0xbf, 0xbb, 0xaf, 0xd0, 0x74, 0xb5, 0x48, 0x8f, 0x31, 0x35,
-  0xe5, 0xba, 0xc8, 0x50, 0x0c, 0x3d, 0x08, 0x7e, 0xa7, 0xe5, 0xba, 0xd9,
-  0xb1, 0x23, 0x5a, 0x76, 0xc3, 0xcb, 0x6d, 0x29, 0x5b, 0x32, 0x9a, 0xcc,
-  0x7b, 0x49, 0x31, 0xa6, 0xd5, 0xf6, 0x66, 0xbb, 0x68, 0xc1, 0x2f, 0x51,
-  0xef, 0xbb, 0x1f, 0xb4, 0x32, 0x1f, 0xbb, 0x44, 0xd8, 0x3e, 0x19, 0x8c,
-  0x53, 0xcb, 0x83, 0x5f, 0xad, 0xb2, 0x7d, 0x64, 0xd0, 0x33, 0x52, 0xcb,
-  0xb1, 0x17, 0xb4, 0x32, 0x1f, 0x8b, 0x75, 0xd2, 0x3d, 0x94, 0x38, 0x58,
-  0x0c, 0xc6, 0xd4, 0x59, 0xf7, 0xca, 0xad, 0x83, 0x5f, 0x74, 0xdd, 0xf4,
-  0xd8, 0x81, 0x8b, 0x02, 0x4f, 0xe2, 0x3d, 0x72, 0x35, 0x59, 0x27, 0xc5,
-  0x57, 0xf6, 0x05, 0xf9, 0x3e, 0x69, 0xc4, 0x7d, 0xa1, 0x65, 0x0f, 0xb3,
-  0x4c, 0xd4, 0xf7, 0xd0, 0xc8, 0x1c, 0x63, 0x39, 0xca, 0xa1, 0x45, 0x41,
-  0x3d, 0x69, 0xc4, 0xba, 0xd3, 0xd7, 0x71, 0x18, 0x1e, 0x6e, 0x12, 0x4f,
-  0x7a, 0x6c, 0xae, 0xed, 0x35, 0x10, 0x69, 0x44, 0x8e, 0x96, 0xaa, 0xb9,
-  0xec, 0x65, 0x3e, 0x18, 0x5e, 0xaa, 0x31, 0x96, 0x6f, 0xce, 0x2a, 0x8a,
-  0xa5, 0xc8, 0xd3, 0xd7, 0x9b, 0xb6, 0x8e, 0x53, 0xfb, 0x8d, 0x29, 0x25,
-  0x92, 0x31, 0x96, 0xf7, 0x9c, 0xe3, 0xe0, 0xa2, 0x9f, 0xba, 0xbe, 0x03,
-  0xb0, 0x45, 0x5a, 0x76, 0xbe, 0xa2, 0x27, 0x62, 0x57, 0xd6, 0xeb, 0x7c,
-  0x6c, 0x91, 0xbb, 0xd3, 0x5f, 0x92, 0xa7, 0xaf, 0x3d, 0x75, 0xfa, 0xb5,
-  0x2f, 0x1b, 0xbf, 0x2a, 0x63, 0x46, 0x80, 0xd5, 0x9d, 0x5a, 0x46, 0x47,
-  0xf6, 0x70, 0xd7, 0x82, 0x00, 0xe3, 0x4d, 0x97, 0xb5, 0xa5, 0xae, 0x7e,
-  0x91, 0x3d, 0xdc, 0x39, 0xb1, 0xa9, 0xd9, 0xf5, 0x6d, 0x80, 0x2d, 0x51,
-  0x57, 0xbf, 0x58, 0x5c, 0xde, 0xbd, 0x3e, 0x01, 0x56, 0x67, 0x6a, 0x99,
-  0x6a, 0xae, 0x75, 0x1c, 0x14, 0x44, 0x80, 0xd5, 0x99, 0x9a, 0xde, 0x20,
-  0x3b, 0xef, 0x04, 0x01, 0x56, 0x63, 0xea, 0x11, 0xcf, 0x4c, 0xbf, 0xdc,
-  0xa0, 0x18, 0xb1, 0xbe, 0xd4, 0xea, 0x8d, 0x3a, 0x9f, 0x2a, 0x5a, 0x69,
-  0xa2, 0x56, 0x8a, 0x62, 0xc4, 0xda, 0x51, 0xd2, 0x87, 0xac, 0x7e, 0x39,
-  0x43, 0x80, 0xd5, 0x95, 0x72, 0x08, 0x52, 0x8f, 0xd5, 0x2f, 0x67, 0x08,
-  0xb0, 0x9a, 0x52, 0xd2, 0xf3, 0x0b, 0xa6, 0x5f, 0xee, 0x10, 0x60, 0xb5,
-  0xa4, 0x56, 0x1f, 0xee, 0xd5, 0xb1, 0xbd, 0x95, 0x23, 0xce, 0x95, 0xca,
-  0xfb, 0x2e, 0x32, 0x54, 0x51, 0x43, 0x49, 0xcf, 0x5b, 0x9f, 0xe1, 0x87,
-  0x6d, 0x20, 0x4d, 0x5f, 0x43, 0x6a, 0x7c, 0x91, 0xde, 0x70, 0x8b, 0x00,
-  0xab, 0x1f, 0xe5, 0xe8, 0x43, 0xd2, 0x87, 0xae, 0x11, 0x60, 0xb5, 0xa3,
-  0x2c, 0x2f, 0x93, 0x3e, 0x74, 0x8e, 0x00, 0xab, 0x1b, 0xe2, 0xab, 0x52,
-  0xa8, 0xa6, 0xaf, 0x19, 0x25, 0xbe, 0x48, 0xcf, 0x57, 0x00, 0xfb, 0xc1,
-  0xea, 0x85, 0xf8, 0xaa, 0x18, 0x76, 0x34, 0xd7, 0x8a, 0xb2, 0x7b, 0x99,
-  0x93, 0x7b, 0x2b, 0x81, 0x00, 0xab, 0x13, 0xa5, 0xfc, 0x90, 0xe5, 0xaf,
-  0x6a, 0xe0, 0xd0, 0x9b, 0x1a, 0x21, 0xbe, 0xaa, 0x27, 0x68, 0x0f, 0xce,
-  0x45, 0xac, 0x01, 0xe2, 0xab, 0x82, 0x08, 0xb0, 0xda, 0x20, 0xbe, 0xaa,
-  0x88, 0x00, 0xab, 0x8b, 0x43, 0xe2, 0xab, 0x82, 0x38, 0x9b, 0xbe, 0x2e,
-  0x94, 0xfc, 0x3c, 0x87, 0x47, 0x55, 0x07, 0xbb, 0x55, 0x6a, 0x42, 0x89,
-  0x2f, 0xca, 0x0f, 0x2b, 0x84, 0x00, 0xab, 0x07, 0xe2, 0xab, 0xa2, 0x78,
-  0x3f, 0x58, 0x2d, 0x10, 0x5f, 0x55, 0x45, 0xad, 0x6f, 0x1d, 0x30, 0xff,
-  0xaa, 0x2c, 0x02, 0xac, 0x06, 0x94, 0xfd, 0x95, 0xe4, 0x0f, 0x2b, 0x86,
-  0x00, 0xf3, 0x1f, 0xf1, 0x55, 0x61, 0x73, 0x02, 0xcc, 0x77, 0xc4, 0x57,
-  0x95, 0x51, 0xeb, 0xeb, 0xbd, 0x33, 0xe2, 0xab, 0xc2, 0x08, 0x30, 0xdf,
-  0x9d, 0x10, 0x5f, 0x55, 0x46, 0x80, 0x79, 0x2e, 0x3c, 0xbf, 0x77, 0xe1,
-  0xfa, 0x5e, 0x82, 0x01, 0x01, 0xe6, 0xb7, 0xb0, 0xc0, 0x97, 0xfd, 0xcb,
-  0x95, 0xd4, 0x7b, 0x6b, 0x9d, 0x33, 0xd7, 0x37, 0x0a, 0x72, 0x79, 0x47,
-  0x7c, 0x55, 0x1c, 0xc5, 0xf4, 0x3e, 0x0b, 0x17, 0x98, 0x7b, 0xc4, 0x57,
-  0x35, 0x11, 0x60, 0x1e, 0x3b, 0x0a, 0xe3, 0x8b, 0xf3, 0xd9, 0x2a, 0x8a,
-  0x00, 0xf3, 0x97, 0xb2, 0x00, 0x46, 0x7c, 0x55, 0x15, 0x01, 0xe6, 0xaf,
-  0xf0, 0xfd, 0xe6, 0x14, 0xf8, 0x56, 0x16, 0x01, 0xe6, 0xad, 0x13, 0xe2,
-  0xcb, 0x03, 0x04, 0x98, 0xaf, 0xc2, 0x04, 0x3d, 0x0b, 0xcc, 0xd5, 0x25,
-  0xf6, 0x5b, 0xbe, 0x73, 0x7d, 0xbb, 0x20, 0xa3, 0xf0, 0x04, 0x8e, 0xb5,
-  0xeb, 0x9b, 0x08, 0xc9, 0xd8, 0xd0, 0xec, 0xa9, 0x30, 0x81, 0xc8, 0x02,
-  0x58, 0x95, 0x11, 0x60, 0x7e, 0x0a, 0x13, 0x88, 0x2c, 0x80, 0x55, 0x1a,
-  0x01, 0xe6, 0x27, 0x59, 0x41, 0xcf, 0x02, 0x58, 0xb5, 0x11, 0x60, 0x5e,
-  0x6a, 0x91, 0x40, 0xf4, 0x04, 0x01, 0xe6, 0xa3, 0xb0, 0x02, 0xb1, 0xef,
-  0xfa, 0x06, 0x42, 0x3a, 0x02, 0xcc, 0x43, 0x61, 0x05, 0x22, 0x09, 0xfa,
-  0xaa, 0x23, 0xc0, 0xfc, 0x13, 0x26, 0x38, 0x48, 0x20, 0x56, 0x1e, 0x01,
-  0xe6, 0x1f, 0x59, 0xc1, 0xd1, 0xbb, 0x72, 0x7d, 0xfb, 0x60, 0x13, 0x02,
-  0xcc, 0x3b, 0xe7, 0x72, 0x02, 0x36, 0x70, 0x7d, 0xf7, 0x60, 0x23, 0x02,
-  0xcc, 0x37, 0x07, 0x32, 0xbe, 0x38, 0x62, 0xd4, 0x03, 0x04, 0x98, 0x67,
-  0x1a, 0x6d, 0x12, 0x1c, 0x3e, 0x21, 0xc0, 0x3c, 0x73, 0x46, 0x82, 0xc3,
-  0x2b, 0x04, 0x98, 0x5f, 0xe4, 0x04, 0x8c, 0x0a, 0x0e, 0x3f, 0x10, 0x60,
-  0xd5, 0x70, 0x70, 0xf8, 0xae, 0xf5, 0xe2, 0xfc, 0x30, 0xb5, 0x25, 0xc2,
-  0x09, 0xd8, 0xa5, 0xeb, 0x3b, 0x07, 0x56, 0x08, 0x30, 0xe7, 0x0e, 0x5b,
-  0x1d, 0x39, 0xaf, 0x7a, 0xd5, 0xee, 0xb4, 0x12, 0x9a, 0x23, 0x9c, 0x80,
-  0x8d, 0x5d, 0xdf, 0x38, 0xb0, 0x43, 0x80, 0x39, 0x75, 0x74, 0x7e, 0xd6,
-  0x35, 0x3b, 0x3b, 0x3f, 0x8a, 0xff, 0xb8, 0x5c, 0x01, 0xe3, 0x8c, 0x51,
-  0x5f, 0x10, 0x60, 0x0e, 0x5d, 0x24, 0x45, 0xd7, 0x9b, 0x4e, 0xf4, 0xbd,
-  0xd9, 0x72, 0x0f, 0x33, 0x2b, 0xcc, 0xde, 0x20, 0xc0, 0x5c, 0x69, 0xb4,
-  0xda, 0xdd, 0x4d, 0x9a, 0xad, 0x86, 0xf2, 0x1b, 0xe1, 0x1e, 0x4b, 0x26,
-  0x60, 0x25, 0xbb, 0x1a, 0x0c, 0x26, 0xfd, 0x67, 0x83, 0x41, 0xd9, 0xb9,
-  0x23, 0x02, 0xcc, 0x91, 0x56, 0x73, 0x63, 0x78, 0x45, 0x43, 0x4c, 0x96,
-  0x20, 0x32, 0x01, 0x2b, 0xd1, 0x74, 0x35, 0x5f, 0x68, 0x97, 0x7c, 0xb9,
-  0xee, 0x97, 0x58, 0x22, 0x43, 0x80, 0x39, 0x71, 0xb8, 0xb9, 0xf7, 0x92,
-  0x21, 0x76, 0x1e, 0xfc, 0x8e, 0xdc, 0x03, 0xc6, 0x04, 0xac, 0x2c, 0xa3,
-  0xc9, 0xba, 0x67, 0xbe, 0xea, 0xeb, 0x55, 0x49, 0xa3, 0x70, 0x02, 0xcc,
-  0x81, 0xc6, 0x99, 0x45, 0x60, 0x85, 0x8e, 0x0f, 0x5e, 0x7e, 0x49, 0x66,
-  0xe8, 0x59, 0x01, 0x2b, 0xc9, 0x60, 0x9e, 0x7a, 0xd9, 0xd7, 0xa5, 0xec,
-  0x65, 0x25, 0xc0, 0x76, 0xef, 0x30, 0x36, 0x3a, 0x9c, 0x8d, 0x57, 0x83,
-  0xc1, 0x6b, 0x65, 0xc6, 0x74, 0xb0, 0x1a, 0xcf, 0x62, 0x6d, 0xdd, 0x52,
-  0x33, 0xf4, 0x94, 0x20, 0x96, 0x62, 0xb2, 0xdc, 0xf8, 0x64, 0xeb, 0xf5,
-  0x8b, 0x57, 0xcb, 0x10, 0x60, 0x3b, 0x77, 0xae, 0xb7, 0xe2, 0x72, 0x1c,
-  0x1f, 0xf1, 0x5f, 0x8e, 0x23, 0xad, 0xdf, 0x69, 0xc8, 0xd7, 0x80, 0x71,
-  0x48, 0x5b, 0x19, 0x2c, 0xc2, 0xab, 0x9c, 0x10, 0x23, 0xc0, 0x76, 0xed,
-  0x44, 0x6b, 0xc0, 0x79, 0xd2, 0x78, 0x6f, 0x3a, 0xd7, 0x66, 0x07, 0xff,
-  0x24, 0x7f, 0x83, 0x12, 0xc4, 0xe2, 0xa6, 0x33, 0x8b, 0xe0, 0x12, 0x21,
-  0x56, 0xec, 0xaf, 0x22, 0xc0, 0x76, 0xab, 0xd1, 0xd1, 0x1a, 0x2f, 0x2d,
-  0x5a, 0x46, 0x7d, 0xd3, 0x53, 0x96, 0x3d, 0x60, 0x85, 0x8d, 0xc6, 0xd6,
-  0xe1, 0xf5, 0x62, 0x51, 0x68, 0xce, 0x3b, 0x0d, 0x3e, 0xe5, 0xbc, 0xf8,
-  0xbd, 0x83, 0xcd, 0x94, 0xf7, 0xa1, 0x74, 0xbb, 0xe3, 0x8d, 0x9d, 0x51,
-  0x3f, 0x96, 0xe3, 0x22, 0x43, 0x5f, 0xd8, 0x74, 0x11, 0xbd, 0xa8, 0xcb,
-  0x75, 0xff, 0x72, 0xf0, 0xf2, 0xe4, 0x1a, 0x0d, 0x06, 0xfd, 0x79, 0xec,
-  0x8f, 0x8b, 0x9d, 0x2c, 0x14, 0x7c, 0x06, 0x67, 0xd3, 0xef, 0x84, 0x12,
-  0x5f, 0x56, 0x0f, 0xc6, 0x51, 0x24, 0xd1, 0xc5, 0x1e, 0x95, 0xc2, 0x26,
-  0xfa, 0x43, 0xab, 0x37, 0xbf, 0x8c, 0x5e, 0xd3, 0x51, 0x6c, 0x0a, 0x5c,
-  0xe4, 0xb2, 0x13, 0x60, 0x3b, 0x74, 0x92, 0xfd, 0xa9, 0x38, 0xd0, 0xee,
-  0x07, 0x32, 0xf4, 0x45, 0xe9, 0xc3, 0xc3, 0x75, 0x52, 0x4d, 0x4c, 0x64,
-  0x0a, 0x5c, 0x60, 0x69, 0x84, 0x00, 0xdb, 0x9d, 0xf0, 0xb8, 0xd0, 0x9e,
-  0xfd, 0x54, 0x6a, 0xa4, 0x4c, 0xc8, 0x19, 0x20, 0x16, 0xa5, 0x8d, 0x08,
-  0xe6, 0x69, 0x8b, 0xc9, 0xa3, 0x95, 0xda, 0x8d, 0x65, 0x68, 0xb0, 0x08,
-  0x02, 0x6c, 0x67, 0xc2, 0xe3, 0x42, 0x97, 0x99, 0x1e, 0x88, 0xe1, 0x4d,
-  0xc1, 0x08, 0xb1, 0x20, 0x35, 0xbe, 0xd6, 0x1b, 0x6b, 0x35, 0x56, 0x6a,
-  0x2f, 0x96, 0x77, 0xd9, 0x39, 0xf8, 0xf5, 0xe6, 0x81, 0xeb, 0xdb, 0xaf,
-  0xf6, 0xf2, 0xbf, 0x0f, 0x85, 0x08, 0x2b, 0x89, 0x12, 0x5f, 0x4b, 0x9b,
-  0x2e, 0x49, 0xcb, 0x37, 0xe6, 0x1c, 0x25, 0xca, 0xdf, 0xbf, 0x28, 0x7e,
-  0x0b, 0x21, 0x4d, 0x27, 0x7f, 0x94, 0x10, 0x61, 0xa5, 0x50, 0xc2, 0x65,
-  0x6e, 0x79, 0x1d, 0x07, 0xe1, 0x38, 0x31, 0xe7, 0x3c, 0x2c, 0x4c, 0x4a,
-  0x9e, 0xba, 0xbe, 0x03, 0xeb, 0xad, 0xd0, 0x69, 0x1a, 0x44, 0x58, 0x09,
-  0x26, 0x79, 0xc6, 0x7b, 0xca, 0x14, 0x38, 0x5f, 0x84, 0x29, 0x51, 0x7d,
-  0xd2, 0x28, 0x7e, 0x1b, 0x21, 0x41, 0x43, 0x0e, 0x10, 0x73, 0x35, 0x13,
-  0x11, 0x56, 0xd8, 0x34, 0x67, 0xa4, 0x84, 0x97, 0x3e, 0x57, 0x15, 0xcd,
-  0x48, 0x59, 0x57, 0x3b, 0x26, 0xc2, 0xb6, 0x46, 0x66, 0xe8, 0xf3, 0xd5,
-  0xea, 0x2a, 0xcd, 0x44, 0x84, 0xe5, 0x32, 0x5a, 0xe6, 0xed, 0x89, 0x56,
-  0xc5, 0x2e, 0xfd, 0x68, 0xad, 0x44, 0x18, 0xa9, 0x8e, 0x2d, 0x39, 0x12,
-  0x97, 0x78, 0x96, 0xf7, 0xfe, 0x20, 0xc2, 0x8a, 0x99, 0xe7, 0x8d, 0xaf,
-  0xe1, 0xb0, 0x5f, 0xf0, 0xd2, 0x2b, 0xa3, 0x44, 0x92, 0x89, 0x5b, 0x22,
-  0x32, 0x1c, 0xf9, 0x4f, 0xd3, 0x50, 0x23, 0x8c, 0x23, 0x39, 0x32, 0x1b,
-  0xe4, 0x8f, 0xaf, 0xe2, 0x03, 0x74, 0x65, 0xf6, 0xd7, 0xa4, 0xea, 0x77,
-  0x1b, 0x0e, 0x8b, 0x0d, 0x10, 0x5f, 0x29, 0x11, 0xc6, 0x9e, 0xcb, 0xac,
-  0xc2, 0x01, 0x62, 0xae, 0xf5, 0xac, 0xa2, 0x11, 0x36, 0x55, 0x56, 0xd4,
-  0x48, 0xd7, 0x6f, 0x81, 0x98, 0x81, 0x2d, 0x0b, 0xdd, 0x24, 0xdb, 0x8d,
-  0xb0, 0xcb, 0x1f, 0x16, 0xcf, 0xfa, 0x93, 0x5a, 0x76, 0x8f, 0x72, 0x94,
-  0x97, 0xb3, 0x18, 0x66, 0x5d, 0x34, 0xc2, 0x16, 0x44, 0xd8, 0x16, 0xc9,
-  0x19, 0x58, 0xb1, 0xcd, 0x26, 0x6a, 0x42, 0xaa, 0xec, 0x77, 0x33, 0x0f,
-  0xfe, 0x43, 0x7e, 0xf4, 0x8f, 0xf5, 0x7b, 0xef, 0xf3, 0x48, 0xf4, 0x20,
-  0x79, 0xcf, 0x33, 0x29, 0x3c, 0x05, 0x1e, 0x11, 0x61, 0x5b, 0x24, 0xb6,
-  0x23, 0xe7, 0xcd, 0x70, 0x98, 0x5a, 0xa9, 0xdc, 0xb7, 0x33, 0xff, 0xb5,
-  0xab, 0xfa, 0x5b, 0xdd, 0x76, 0x9d, 0xc9, 0x21, 0x5e, 0xee, 0x9e, 0x5f,
-  0xb9, 0xf4, 0xd9, 0x0a, 0xdd, 0xe4, 0x07, 0x28, 0x65, 0x24, 0x27, 0xae,
-  0x6f, 0xc8, 0xba, 0x11, 0x6b, 0x60, 0x91, 0xfb, 0xf6, 0xfa, 0xfd, 0xcd,
-  0xcd, 0xcd, 0x87, 0x8f, 0xf9, 0x9a, 0xd9, 0xba, 0x18, 0xc1, 0xc6, 0xa4,
-  0x1b, 0xf1, 0xd7, 0xf2, 0x3e, 0xbb, 0x02, 0xae, 0x4c, 0x4f, 0xa5, 0x4f,
-  0xb7, 0x77, 0x77, 0xf7, 0x0f, 0x9f, 0x6d, 0x3f, 0xa3, 0xf8, 0x00, 0x9d,
-  0x08, 0xdb, 0x16, 0x71, 0x22, 0x6f, 0x64, 0x06, 0xf6, 0xf9, 0xcb, 0xdd,
-  0xab, 0x0f, 0x19, 0x1a, 0x49, 0x5d, 0x54, 0x29, 0x2f, 0x99, 0x78, 0xf5,
-  0x53, 0xb7, 0xd6, 0x11, 0x26, 0xf2, 0xe4, 0xea, 0x4a, 0xf1, 0xc3, 0xdb,
-  0xc5, 0xbf, 0xfb, 0x64, 0xfb, 0x21, 0x6a, 0x84, 0xe5, 0x3b, 0xf9, 0x75,
-  0x45, 0x84, 0x6d, 0x87, 0xc8, 0xd1, 0x47, 0xe6, 0x36, 0x41, 0x7c, 0x99,
-  0x23, 0xec, 0xfa, 0xeb, 0xe3, 0xe3, 0x27, 0x53, 0xe7, 0xa6, 0x3c, 0x07,
-  0xf3, 0xef, 0xa1, 0x88, 0xf8, 0xd6, 0x8d, 0xab, 0xd1, 0x28, 0x51, 0xce,
-  0xc0, 0x94, 0x06, 0x78, 0x14, 0x17, 0xff, 0xee, 0x6b, 0xfc, 0x17, 0xae,
-  0x3f, 0x3d, 0xdc, 0xdc, 0x3c, 0x46, 0x3b, 0xb7, 0xe2, 0x53, 0xe0, 0x09,
-  0x11, 0xb6, 0x0d, 0x22, 0xc5, 0x11, 0xa9, 0xb4, 0xf9, 0x24, 0x9b, 0xf8,
-  0x2e, 0x16, 0x48, 0xd7, 0x0f, 0xf7, 0xaf, 0x7f, 0x70, 0x63, 0x18, 0xc1,
-  0xf4, 0xbb, 0x45, 0xdb, 0x39, 0xea, 0xca, 0x10, 0x5f, 0xdd, 0xbf, 0x95,
-  0xf2, 0xd1, 0x95, 0x20, 0x7a, 0x0e, 0x75, 0x04, 0x21, 0x9f, 0x6e, 0x77,
-  0x5f, 0x62, 0x3f, 0xff, 0xf8, 0x76, 0xf1, 0xef, 0x6e, 0x22, 0xed, 0xa2,
-  0x46, 0x58, 0xbe, 0x6c, 0x24, 0x11, 0xb6, 0x0d, 0xa2, 0xcc, 0x37, 0xf2,
-  0xce, 0xd7, 0x87, 0x30, 0xc0, 0x1e, 0x22, 0xed, 0xf0, 0xf5, 0x5e, 0xfe,
-  0xd1, 0xa7, 0xd4, 0x56, 0x2a, 0xe7, 0x8c, 0xa9, 0xfe, 0xcf, 0xa6, 0x08,
-  0xab, 0xcf, 0x01, 0xf8, 0x62, 0x0d, 0x4c, 0x79, 0x1c, 0x5d, 0x87, 0x17,
-  0xff, 0x2e, 0xf2, 0x10, 0xbb, 0xbe, 0x95, 0x7f, 0x72, 0x1f, 0xf9, 0x23,
-  0x75, 0xf3, 0xeb, 0x3a, 0xd7, 0xa5, 0xbf, 0xec, 0x11, 0x61, 0xa5, 0x13,
-  0x07, 0x71, 0x44, 0xa6, 0xc6, 0x37, 0x61, 0x13, 0xdf, 0xe8, 0x7f, 0xa2,
-  0xf4, 0x6d, 0x77, 0xf7, 0xd7, 0xf1, 0x56, 0x52, 0x96, 0x2d, 0x4b, 0x19,
-  0xc8, 0xfd, 0x62, 0x8a, 0xaf, 0xee, 0xb7, 0x72, 0xee, 0x6e, 0xf7, 0x44,
-  0x11, 0x47, 0x4f, 0xf9, 0x7f, 0x4f, 0xca, 0x25, 0x7e, 0xaf, 0xfd, 0xf4,
-  0xf5, 0xfd, 0x5d, 0x62, 0xc3, 0x68, 0x03, 0xf4, 0x7c, 0x53, 0xe0, 0x29,
-  0x11, 0x56, 0x36, 0x31, 0x42, 0x8c, 0x2e, 0x32, 0x2b, 0x01, 0x76, 0xa7,
-  0xfd, 0xc1, 0xe7, 0xbb, 0xbb, 0xc4, 0xe6, 0x7f, 0x73, 0xb5, 0x28, 0x33,
-  0xc0, 0xa6, 0xc6, 0xf8, 0xea, 0xfe, 0x52, 0xc6, 0xcd, 0x5d, 0x05, 0x22,
-  0x28, 0xd4, 0x14, 0xa2, 0x7a, 0x8d, 0x1f, 0xb5, 0x9f, 0xbe, 0xd5, 0xae,
-  0x7e, 0xe2, 0x87, 0xe5, 0x9e, 0x02, 0x13, 0x61, 0x65, 0x13, 0x39, 0xc4,
-  0xe8, 0xa8, 0xfd, 0x21, 0xe9, 0x41, 0xf9, 0x45, 0x6b, 0xe2, 0x47, 0x53,
-  0x2b, 0xc9, 0x64, 0x62, 0x19, 0x89, 0xc4, 0xd5, 0xaf, 0xe6, 0x08, 0x2b,
-  0xe1, 0xa3, 0xab, 0x40, 0xa6, 0x38, 0xb4, 0x6b, 0xa5, 0x5c, 0x61, 0x6d,
-  0x14, 0xfe, 0xe9, 0x2e, 0x3d, 0xc0, 0xd4, 0x54, 0x60, 0xbe, 0x29, 0xb0,
-  0x12, 0x61, 0x6c, 0xc1, 0x2c, 0x83, 0x78, 0xd3, 0x43, 0x74, 0xf1, 0x44,
-  0x69, 0xca, 0x87, 0x84, 0xff, 0x9f, 0x92, 0x46, 0xee, 0x17, 0x98, 0x6a,
-  0x47, 0x7c, 0xeb, 0x6e, 0x21, 0xc0, 0x26, 0xeb, 0x59, 0x45, 0x0a, 0x42,
-  0xc4, 0x94, 0x55, 0x3f, 0x73, 0xfc, 0x7b, 0x42, 0x8a, 0x49, 0x7f, 0xba,
-  0x7d, 0x31, 0x7d, 0x9e, 0x52, 0x57, 0x58, 0x74, 0x94, 0x48, 0x4d, 0x47,
-  0x09, 0x9a, 0xe6, 0x11, 0xa2, 0xda, 0x96, 0x5a, 0x13, 0x3f, 0x68, 0x4d,
-  0x6c, 0x9a, 0x83, 0xbd, 0x1a, 0xac, 0x67, 0x25, 0xdd, 0xc2, 0x8b, 0x3c,
-  0x01, 0x36, 0x48, 0x1f, 0x1f, 0x8d, 0x4b, 0x0b, 0xff, 0xc2, 0x44, 0x67,
-  0xaf, 0x5f, 0xac, 0x70, 0x8c, 0xa8, 0x2f, 0x92, 0xe8, 0x4f, 0xb7, 0x47,
-  0xd3, 0x07, 0x2a, 0x01, 0x92, 0xaf, 0x76, 0x9b, 0x08, 0x2b, 0x93, 0x98,
-  0x82, 0xcd, 0x63, 0xd7, 0xf9, 0xb3, 0xb9, 0x93, 0xba, 0xd1, 0x9a, 0xf8,
-  0xbd, 0x6d, 0xab, 0xe5, 0xf7, 0x5b, 0xf6, 0x00, 0x9b, 0x2e, 0xd3, 0x2b,
-  0x86, 0x82, 0x5e, 0xa3, 0x12, 0x1b, 0xd7, 0x0c, 0x29, 0x8e, 0x17, 0x62,
-  0xa0, 0xf0, 0x5d, 0xff, 0xdf, 0xda, 0xc5, 0xbf, 0x35, 0x7f, 0x62, 0x98,
-  0xae, 0xcf, 0x59, 0xaf, 0x46, 0x84, 0x95, 0x48, 0x4c, 0xc1, 0x0c, 0xbd,
-  0xcd, 0x5b, 0x29, 0xc7, 0x97, 0x27, 0xfd, 0xff, 0xbe, 0x57, 0x9b, 0xf8,
-  0xc1, 0xae, 0xc5, 0xca, 0xb8, 0x03, 0xb3, 0x04, 0xd8, 0xcc, 0xdc, 0x27,
-  0x0b, 0x93, 0x62, 0xf7, 0x5f, 0xa9, 0x2e, 0x93, 0x1e, 0x70, 0x5f, 0x5f,
-  0xd2, 0x19, 0xb7, 0xd1, 0x11, 0xb8, 0xfa, 0x78, 0xbb, 0x4d, 0x1a, 0x3d,
-  0xc8, 0xba, 0xc2, 0xbc, 0xa5, 0x8d, 0x4a, 0x84, 0xb1, 0x03, 0xb3, 0x20,
-  0x71, 0xda, 0xa8, 0x71, 0xb8, 0xfe, 0xf9, 0xe9, 0x29, 0xb6, 0x94, 0xac,
-  0xac, 0xc3, 0x64, 0xaa, 0xa2, 0xca, 0x2d, 0x21, 0xbe, 0x16, 0x1b, 0x7f,
-  0x25, 0x69, 0x94, 0x28, 0xf3, 0x00, 0x3b, 0x78, 0x15, 0xcc, 0x68, 0xf5,
-  0xfb, 0x62, 0xf1, 0xfb, 0x24, 0xf9, 0x2f, 0x12, 0x65, 0x52, 0x96, 0xcb,
-  0x7a, 0x9f, 0xc3, 0x81, 0xfb, 0xcd, 0x75, 0xf2, 0x8f, 0xad, 0x12, 0x46,
-  0x25, 0xb6, 0xc2, 0x08, 0x63, 0x8f, 0x73, 0x41, 0x1d, 0xf3, 0x08, 0x25,
-  0xc5, 0xb5, 0xac, 0x24, 0x78, 0xb2, 0xff, 0xa5, 0x02, 0x12, 0xe6, 0x60,
-  0xbf, 0xa7, 0xfc, 0x4a, 0x37, 0xed, 0xfe, 0x52, 0x32, 0xd9, 0xdb, 0xee,
-  0xc2, 0x46, 0x7f, 0x74, 0x5f, 0x17, 0xc9, 0x7f, 0xfe, 0x2d, 0x71, 0x36,
-  0x24, 0xfe, 0x75, 0xb6, 0x1f, 0x79, 0xfd, 0xf8, 0x16, 0x62, 0xb7, 0xe9,
-  0x45, 0x8a, 0x83, 0x75, 0x6f, 0x56, 0xe4, 0x5f, 0x17, 0x56, 0x0b, 0x34,
-  0x8f, 0x5c, 0xdf, 0xa2, 0x7e, 0x0b, 0xde, 0x4c, 0x99, 0x6d, 0xa7, 0xca,
-  0xd3, 0xe3, 0xe3, 0xe3, 0xfb, 0x2c, 0x65, 0xf6, 0x45, 0xfc, 0x6e, 0x0e,
-  0xb0, 0xb4, 0xdb, 0x67, 0x9d, 0xdc, 0x2b, 0x5f, 0x69, 0xf1, 0xba, 0xdd,
-  0xad, 0xd7, 0xab, 0x9f, 0xc2, 0x1a, 0x94, 0x3f, 0x12, 0x7e, 0xa6, 0x9b,
-  0xfd, 0xfa, 0x7f, 0x7c, 0x7a, 0x7a, 0xba, 0xce, 0xf0, 0xf3, 0xb9, 0x84,
-  0x11, 0xc6, 0x59, 0x53, 0x85, 0x04, 0x57, 0xb1, 0x1a, 0x19, 0x35, 0xa3,
-  0x84, 0x75, 0xb0, 0xb4, 0x34, 0xe1, 0x24, 0xf1, 0xae, 0x8d, 0xbc, 0xbc,
-  0x64, 0xb9, 0xc5, 0x41, 0xe2, 0xe8, 0xef, 0xda, 0x5f, 0x65, 0x8e, 0x30,
-  0x51, 0xc6, 0x51, 0x85, 0xe9, 0x60, 0xe4, 0x4a, 0x85, 0x11, 0xe6, 0xfa,
-  0x1e, 0xf5, 0xd9, 0x51, 0x65, 0x1b, 0x58, 0x32, 0xd6, 0xfa, 0x6e, 0x28,
-  0xe4, 0xe8, 0x99, 0xff, 0x55, 0xf1, 0x57, 0x47, 0x6e, 0xef, 0x08, 0xac,
-  0xe9, 0x2f, 0x91, 0x12, 0x4a, 0xe3, 0xa2, 0x85, 0x98, 0x0f, 0x56, 0x70,
-  0x73, 0x40, 0x58, 0xb5, 0x4d, 0x49, 0x47, 0x7e, 0xe2, 0xb8, 0x9b, 0x2a,
-  0x97, 0xce, 0x7e, 0x33, 0x14, 0xfb, 0xfe, 0x9c, 0xfe, 0x44, 0x10, 0xf7,
-  0xad, 0xd6, 0x31, 0x4f, 0x95, 0xd9, 0xd7, 0x6a, 0x95, 0x1e, 0x61, 0x97,
-  0xb3, 0xd9, 0xbc, 0x50, 0x19, 0xca, 0xe8, 0x3f, 0xa3, 0x5f, 0xf9, 0x27,
-  0xd3, 0xe7, 0x89, 0xaf, 0xe4, 0xf8, 0x12, 0x1b, 0x85, 0x97, 0x8b, 0x77,
-  0xaf, 0xe4, 0x26, 0x02, 0xac, 0x82, 0x4f, 0x50, 0x69, 0x64, 0x58, 0x09,
-  0xfb, 0x71, 0xc3, 0xef, 0x88, 0x99, 0xd6, 0x42, 0x3c, 0x39, 0xae, 0x56,
-  0xca, 0xe4, 0xab, 0x37, 0x09, 0x52, 0xf9, 0xdd, 0x84, 0x37, 0x0d, 0xbe,
-  0x3e, 0xbd, 0x0b, 0x25, 0x19, 0xff, 0x2b, 0x3e, 0xb0, 0xfd, 0x87, 0xe1,
-  0xc7, 0x82, 0x6f, 0x51, 0xe8, 0xb4, 0xa1, 0xad, 0x09, 0x23, 0x8c, 0xe5,
-  0xb0, 0xbc, 0xc4, 0x3b, 0x8b, 0xaa, 0x1c, 0x60, 0xe1, 0xa1, 0x81, 0xd2,
-  0x6f, 0x9b, 0xb2, 0x13, 0xca, 0x41, 0xd4, 0xb3, 0x71, 0x7f, 0x3c, 0xd3,
-  0xa6, 0x5e, 0xaf, 0x31, 0x25, 0x6b, 0x00, 0x7b, 0xb1, 0x0c, 0xdf, 0x20,
-  0x88, 0xc5, 0x02, 0x87, 0xd8, 0xc5, 0xbf, 0xb2, 0xf9, 0x22, 0x07, 0x5f,
-  0xa2, 0xe8, 0x69, 0x28, 0xdb, 0x11, 0xae, 0x58, 0x93, 0xac, 0xcf, 0x4b,
-  0x2c, 0x83, 0xb9, 0x6e, 0xcb, 0x74, 0x83, 0x3f, 0xb5, 0x51, 0xe2, 0xaf,
-  0x3f, 0x6e, 0xce, 0xfe, 0x4d, 0xba, 0x89, 0x82, 0x97, 0x4f, 0x87, 0x6b,
-  0x3d, 0x4b, 0x6d, 0x7a, 0x34, 0x90, 0x13, 0xb5, 0x02, 0x13, 0x53, 0xe3,
-  0xda, 0x82, 0x61, 0x87, 0x4d, 0xf1, 0xbf, 0x69, 0x9b, 0xc2, 0xe3, 0x1a,
-  0xdb, 0xa4, 0x12, 0xf3, 0xf1, 0x23, 0xc0, 0x86, 0x57, 0xdf, 0xba, 0x32,
-  0xc4, 0x7e, 0xfe, 0xe9, 0xbf, 0x6d, 0xc6, 0x6e, 0x49, 0x11, 0x16, 0xbe,
-  0x79, 0x4b, 0xa9, 0x57, 0xe8, 0xcd, 0x2f, 0x5f, 0x67, 0x48, 0xfa, 0xfb,
-  0x8f, 0xf3, 0x77, 0xeb, 0x09, 0x5b, 0x6c, 0xe2, 0xff, 0xae, 0x6a, 0x07,
-  0x98, 0x72, 0x89, 0x48, 0x25, 0xe6, 0xe3, 0x49, 0x80, 0x3d, 0xdf, 0x8a,
-  0xe3, 0xb7, 0x4e, 0xe1, 0xcf, 0xbf, 0xaf, 0x2c, 0xa7, 0x46, 0xc6, 0x08,
-  0xd3, 0x3a, 0xab, 0x69, 0xaf, 0x9b, 0x26, 0x7f, 0x21, 0xc4, 0xf0, 0x07,
-  0xf3, 0x27, 0xc6, 0x22, 0x56, 0x8c, 0x24, 0x37, 0xe7, 0x98, 0x3e, 0x3f,
-  0x3d, 0xdb, 0xf5, 0x45, 0x57, 0x87, 0xba, 0xa4, 0x12, 0x73, 0x49, 0x0c,
-  0xb0, 0x68, 0x95, 0xd4, 0xc7, 0x0f, 0x6f, 0x95, 0x89, 0xdf, 0x3f, 0x6d,
-  0x7d, 0x8d, 0x33, 0xd1, 0x68, 0x90, 0xa9, 0x4f, 0x89, 0x27, 0xe5, 0x97,
-  0x91, 0x54, 0xf9, 0x55, 0x52, 0xa5, 0xfe, 0x8b, 0x02, 0x33, 0xb0, 0x84,
-  0xea, 0x93, 0x78, 0xea, 0x53, 0xdc, 0xbf, 0x91, 0x7f, 0xd7, 0xe7, 0xc7,
-  0xc7, 0x47, 0x35, 0x9a, 0x64, 0xf1, 0xcc, 0xed, 0xce, 0x96, 0xf7, 0x85,
-  0xf0, 0x31, 0x45, 0xa2, 0x23, 0x8f, 0x84, 0x00, 0xfb, 0xfa, 0x1a, 0x4d,
-  0xca, 0xa9, 0x2a, 0xca, 0x31, 0x1c, 0x77, 0x0f, 0xbb, 0x6e, 0xe4, 0xdc,
-  0x06, 0x6b, 0x35, 0xba, 0xc6, 0x86, 0x99, 0xdb, 0xb8, 0x9b, 0x60, 0x56,
-  0xa8, 0xc8, 0x23, 0xe1, 0x43, 0xed, 0x02, 0xec, 0xf3, 0x4d, 0xa4, 0xd6,
-  0x50, 0x2d, 0xff, 0xdc, 0xf9, 0xd5, 0x0f, 0x53, 0x89, 0x24, 0x3a, 0x72,
-  0x30, 0x07, 0x98, 0xd8, 0xf3, 0xf5, 0x45, 0xb4, 0xf1, 0x47, 0xf5, 0x24,
-  0x88, 0x84, 0x7d, 0x48, 0x95, 0x34, 0x1a, 0xf4, 0xc7, 0xb3, 0xd9, 0xac,
-  0xdf, 0x1f, 0x24, 0x0c, 0x2c, 0xe3, 0xdd, 0x9c, 0xa9, 0xab, 0xcb, 0xaa,
-  0x48, 0x80, 0xc9, 0x1d, 0xad, 0x72, 0xa7, 0x8a, 0xbe, 0x43, 0x68, 0xd7,
-  0x57, 0x5f, 0x5e, 0x20, 0x12, 0x1d, 0x39, 0x88, 0x23, 0xa5, 0xb4, 0xe7,
-  0x75, 0xb8, 0xa7, 0x52, 0x6c, 0x47, 0xf9, 0xae, 0x37, 0x71, 0xf2, 0x4e,
-  0x09, 0x0f, 0x0d, 0xe6, 0xd1, 0x38, 0x28, 0xbe, 0x53, 0xb4, 0x40, 0x80,
-  0x29, 0xe7, 0xdd, 0x3c, 0xc5, 0xfe, 0xcf, 0xe6, 0x3a, 0xfa, 0xf2, 0x85,
-  0xa9, 0xc4, 0x33, 0xd7, 0x77, 0xab, 0x87, 0x4c, 0x0b, 0xcd, 0x5f, 0x95,
-  0xb6, 0x7c, 0x6b, 0xca, 0xeb, 0x68, 0x13, 0xc7, 0x4e, 0x0c, 0xf3, 0xda,
-  0x68, 0xb2, 0x0e, 0xdf, 0x2f, 0xb9, 0x5e, 0x95, 0x70, 0x90, 0x48, 0x81,
-  0x00, 0x53, 0x0e, 0x05, 0x08, 0x1e, 0x6f, 0x1f, 0x62, 0x57, 0x7f, 0xb7,
-  0xcf, 0xb7, 0x30, 0x17, 0x44, 0x45, 0x47, 0x66, 0xa6, 0x00, 0x53, 0x47,
-  0xfc, 0x6f, 0x0f, 0xd1, 0xaf, 0x77, 0x8e, 0xdb, 0x78, 0xfb, 0x46, 0x83,
-  0x57, 0x25, 0x95, 0x26, 0x26, 0x24, 0x4f, 0x62, 0xc9, 0xc2, 0x78, 0x80,
-  0xa9, 0x97, 0x3a, 0x38, 0x72, 0xe3, 0x36, 0x7e, 0xf5, 0xbf, 0x5b, 0x7f,
-  0x93, 0x32, 0x84, 0x89, 0x0e, 0x5e, 0xcf, 0x97, 0x95, 0x08, 0x30, 0x65,
-  0x50, 0xf4, 0x51, 0x6d, 0xc9, 0xb7, 0x23, 0x01, 0x1e, 0xef, 0x5c, 0xb7,
-  0xb1, 0x67, 0xc6, 0xc6, 0xb3, 0x52, 0xe3, 0xfb, 0x67, 0xe2, 0x01, 0xa6,
-  0x75, 0x57, 0x6f, 0xff, 0xcb, 0x70, 0xf1, 0x77, 0x71, 0x54, 0x83, 0xfa,
-  0xcf, 0x61, 0x1a, 0x96, 0x5b, 0x7c, 0xf0, 0xa2, 0x0d, 0xf9, 0x1f, 0xe3,
-  0xad, 0x2e, 0x7c, 0xcd, 0xd7, 0x58, 0x7b, 0xc1, 0x76, 0x07, 0x40, 0x3c,
-  0xc0, 0x6e, 0xec, 0x02, 0xec, 0x7e, 0xb7, 0x03, 0x08, 0xd9, 0x23, 0x33,
-  0x0d, 0xcb, 0x2a, 0xb8, 0x70, 0xca, 0xa2, 0xaa, 0x16, 0x60, 0x4f, 0xf1,
-  0x56, 0x8f, 0x0c, 0x60, 0x60, 0xf2, 0x87, 0x61, 0x13, 0xdb, 0xaf, 0xf1,
-  0x7a, 0x8d, 0x78, 0x80, 0xa9, 0x87, 0x76, 0x05, 0x87, 0xda, 0x98, 0x2e,
-  0xfe, 0x4e, 0x4e, 0x43, 0x09, 0x5d, 0xc9, 0x69, 0xd8, 0xb9, 0xeb, 0x1b,
-  0xd6, 0x37, 0xc1, 0xc1, 0xd9, 0x4a, 0xb5, 0xa9, 0x96, 0xd1, 0xb8, 0x8e,
-  0xb5, 0x7a, 0xc8, 0xfa, 0xcd, 0x3a, 0x7b, 0xc8, 0xb4, 0x03, 0xe0, 0xcf,
-  0xf8, 0x04, 0x4f, 0x04, 0x58, 0x38, 0x42, 0x57, 0xcf, 0x14, 0x0a, 0x8e,
-  0x3c, 0x31, 0x5e, 0xfc, 0x1d, 0x77, 0x61, 0xb2, 0xa2, 0x83, 0xb2, 0xdf,
-  0x8c, 0x0c, 0x67, 0x72, 0x28, 0x93, 0xea, 0xe0, 0x39, 0xf9, 0x68, 0x6c,
-  0x63, 0x66, 0x61, 0x29, 0xa6, 0xf1, 0x08, 0x33, 0xd5, 0x43, 0xc5, 0x46,
-  0xe8, 0xea, 0x0c, 0x38, 0x58, 0x52, 0x36, 0x5e, 0xfc, 0x5d, 0x3f, 0xde,
-  0xe4, 0xf6, 0x4b, 0x8a, 0x12, 0xb3, 0x11, 0x2b, 0xcd, 0xca, 0xd3, 0x35,
-  0x4c, 0x64, 0xdd, 0x07, 0x4d, 0x6c, 0x0e, 0xb0, 0xbb, 0x7c, 0x4d, 0xb5,
-  0x27, 0xa6, 0xbf, 0x45, 0x12, 0x1d, 0x3f, 0x98, 0x7e, 0x2a, 0xf8, 0x33,
-  0x65, 0x63, 0xe8, 0x87, 0x58, 0x08, 0xdd, 0x1a, 0x2f, 0xfe, 0x6e, 0xc7,
-  0x88, 0xca, 0x34, 0x8c, 0x03, 0xb5, 0x33, 0x11, 0x2b, 0xcd, 0x6a, 0x9e,
-  0x5e, 0xc4, 0xd3, 0x17, 0xb1, 0xd8, 0xf5, 0x64, 0x0e, 0x30, 0x07, 0xc5,
-  0xa7, 0x1e, 0x19, 0x69, 0x67, 0x7e, 0xff, 0x64, 0x5e, 0xbc, 0x5e, 0xc6,
-  0x46, 0xe8, 0x62, 0x3c, 0x7e, 0x2f, 0xbb, 0xa8, 0xef, 0xc6, 0x8b, 0xbf,
-  0xeb, 0x29, 0x70, 0x38, 0x0d, 0x23, 0x57, 0x9f, 0x85, 0xc8, 0xd3, 0x6b,
-  0xa5, 0xad, 0x4f, 0x2f, 0x6d, 0x7a, 0x1b, 0xa6, 0x82, 0x3f, 0x9a, 0x03,
-  0x6c, 0xb7, 0xb9, 0x62, 0xff, 0x0c, 0x9e, 0x43, 0x2c, 0xe8, 0xc6, 0xbe,
-  0x25, 0xac, 0x5e, 0x07, 0x75, 0x48, 0xda, 0x21, 0x8f, 0x4f, 0x0f, 0x37,
-  0x37, 0xdf, 0xdf, 0x87, 0x73, 0xac, 0x8a, 0x8c, 0x1f, 0xc4, 0x11, 0xa9,
-  0xe4, 0xea, 0xb3, 0x89, 0xa7, 0x11, 0x0d, 0xbe, 0x18, 0x9b, 0xf8, 0x71,
-  0xd7, 0x6d, 0xec, 0x9f, 0x41, 0xff, 0x45, 0xf2, 0xfa, 0xb5, 0xcd, 0x99,
-  0x1c, 0x9f, 0xab, 0x11, 0x60, 0x61, 0xd9, 0x2f, 0x83, 0xc4, 0x2c, 0xda,
-  0x86, 0x67, 0x68, 0xcc, 0x07, 0x02, 0x6c, 0x3b, 0x44, 0xee, 0x20, 0xb5,
-  0x76, 0xff, 0xbe, 0x1a, 0x01, 0x16, 0x16, 0x25, 0x32, 0x48, 0xcc, 0x40,
-  0xbc, 0xbe, 0x28, 0xb5, 0x48, 0xe8, 0x89, 0x00, 0xdb, 0x0e, 0xab, 0x1d,
-  0x97, 0x0f, 0xd5, 0x08, 0xb0, 0x30, 0x57, 0xcf, 0x20, 0x31, 0x03, 0x91,
-  0x46, 0x4c, 0xdf, 0xcb, 0x68, 0x1c, 0x23, 0x92, 0xe4, 0x28, 0xcc, 0xea,
-  0xcc, 0x00, 0xe3, 0x18, 0xf1, 0xd6, 0xf6, 0xaf, 0x28, 0xd1, 0x98, 0x41,
-  0x62, 0x76, 0x87, 0x36, 0x4d, 0x6c, 0x9e, 0x68, 0xd7, 0xac, 0xde, 0xd7,
-  0x89, 0x6e, 0x3c, 0x8d, 0x18, 0x67, 0xaa, 0xa4, 0xd9, 0xc9, 0x8b, 0x37,
-  0xa2, 0x16, 0x0c, 0x12, 0xb3, 0xb3, 0x6a, 0xe2, 0x6b, 0xc3, 0x3c, 0x80,
-  0x85, 0xe6, 0x12, 0xcc, 0xe2, 0x0b, 0xfd, 0x71, 0xa6, 0x11, 0xba, 0x93,
-  0xfd, 0x42, 0xf2, 0x30, 0x9f, 0xb6, 0xeb, 0xbb, 0xd6, 0x23, 0xc7, 0x36,
-  0x4d, 0x6c, 0xea, 0xc2, 0x18, 0x21, 0x96, 0x40, 0x8c, 0xba, 0xd2, 0x37,
-  0xa1, 0xc5, 0xbb, 0xb0, 0x1b, 0xcb, 0xcf, 0x2f, 0x99, 0x2c, 0xe8, 0x60,
-  0x6b, 0x98, 0xb5, 0x53, 0x9b, 0x44, 0x96, 0xa1, 0x9e, 0x80, 0x0e, 0xac,
-  0x0c, 0x62, 0xaf, 0x55, 0xfa, 0x26, 0xea, 0xd8, 0x2c, 0xec, 0xde, 0xd5,
-  0xb9, 0x28, 0x32, 0x93, 0xc8, 0x5b, 0x8d, 0x6c, 0x89, 0xc3, 0x7d, 0x37,
-  0x9c, 0xa2, 0x14, 0x6d, 0xe3, 0x2f, 0xcc, 0xc0, 0xca, 0x20, 0x06, 0x5d,
-  0x1b, 0x5e, 0x6f, 0xf3, 0x3e, 0x72, 0xf5, 0x9d, 0x15, 0x5a, 0xcb, 0x4c,
-  0x62, 0xc7, 0xf5, 0x7d, 0xeb, 0x8d, 0x46, 0x70, 0xc5, 0xd6, 0x1b, 0x2e,
-  0xed, 0x27, 0xfd, 0x11, 0x5a, 0xa7, 0x33, 0x03, 0x5c, 0xea, 0xd9, 0xac,
-  0x43, 0x46, 0x53, 0xf5, 0x0e, 0x37, 0x32, 0xc8, 0x4c, 0x22, 0xc7, 0xb8,
-  0xd9, 0x6a, 0x5b, 0x4d, 0xc2, 0xf4, 0x08, 0xbb, 0x25, 0xbe, 0x4a, 0xb2,
-  0xb6, 0x59, 0x87, 0x1c, 0x6a, 0x11, 0x76, 0xef, 0x72, 0xaf, 0xab, 0x5c,
-  0x6e, 0x6e, 0xb2, 0x18, 0x66, 0xe9, 0xc4, 0x6e, 0x12, 0xa6, 0x1e, 0x8e,
-  0xf8, 0xc8, 0xf8, 0xb0, 0x2c, 0x22, 0x6d, 0xb0, 0xf1, 0x70, 0x5f, 0x79,
-  0xf5, 0x1f, 0xdc, 0x5e, 0x7c, 0x59, 0x93, 0xc8, 0x62, 0x98, 0xa5, 0x0b,
-  0xab, 0x95, 0xb0, 0x17, 0xd7, 0xef, 0x5f, 0x52, 0x1d, 0xb7, 0x8f, 0xde,
-  0x9c, 0x3c, 0xea, 0x01, 0xfb, 0x77, 0x5c, 0x5e, 0x7f, 0xfa, 0xfe, 0x52,
-  0x05, 0xec, 0xfc, 0xe2, 0x8b, 0x3e, 0x97, 0x93, 0x48, 0x2d, 0x89, 0x49,
-  0xd8, 0xa6, 0x69, 0x00, 0xb6, 0xc2, 0x6a, 0x1d, 0xb2, 0x4a, 0xe4, 0xc6,
-  0x15, 0xf2, 0x1c, 0x96, 0x8e, 0x2d, 0xa7, 0x01, 0xd8, 0x86, 0x99, 0x77,
-  0x57, 0x5f, 0x2e, 0x86, 0xbd, 0x73, 0x7d, 0xe7, 0x7a, 0x42, 0xac, 0x84,
-  0x15, 0x3e, 0xd0, 0x16, 0x39, 0x58, 0x4f, 0xc2, 0xaa, 0x43, 0xe4, 0x39,
-  0xa8, 0xe7, 0xb0, 0x73, 0x60, 0x99, 0xa8, 0xc7, 0x36, 0x88, 0x49, 0xd8,
-  0xb8, 0xf8, 0x47, 0xed, 0xfa, 0x2b, 0x53, 0xcf, 0x61, 0xa9, 0xe9, 0xdd,
-  0x28, 0xa5, 0x4e, 0x82, 0x8b, 0x5f, 0xcd, 0xf7, 0x34, 0x9b, 0x89, 0x61,
-  0x2d, 0xa9, 0x7a, 0x3b, 0x27, 0x8c, 0x11, 0x1d, 0x12, 0x59, 0xb9, 0x12,
-  0xce, 0xc4, 0xdf, 0x15, 0x79, 0xb0, 0x2a, 0xa9, 0x7a, 0x2b, 0xef, 0x18,
-  0x23, 0x3a, 0xb4, 0xb2, 0xab, 0x55, 0xab, 0x14, 0x59, 0xcf, 0x41, 0x49,
-  0xa2, 0x95, 0xa6, 0x7f, 0x0f, 0xd1, 0xfa, 0x10, 0xdd, 0x81, 0x4f, 0xcb,
-  0x24, 0x23, 0x91, 0xaa, 0xe7, 0xcd, 0xb2, 0x56, 0xc4, 0x18, 0xb1, 0xaa,
-  0x2f, 0xe3, 0xae, 0xb7, 0x85, 0x87, 0x8f, 0x37, 0x99, 0xaa, 0x67, 0xb5,
-  0xd9, 0x86, 0xc8, 0x23, 0xfa, 0x34, 0xd1, 0xae, 0x8f, 0xb1, 0x87, 0x63,
-  0x44, 0x99, 0xaa, 0x67, 0xb5, 0xd9, 0x4a, 0xdb, 0xbf, 0xc5, 0x98, 0xfa,
-  0x98, 0x7a, 0x38, 0x46, 0x0c, 0x5f, 0x1a, 0xc6, 0xe9, 0x01, 0x36, 0xc4,
-  0x01, 0xbf, 0xa4, 0x39, 0x5c, 0x10, 0xbd, 0x41, 0xa1, 0x17, 0xaf, 0xef,
-  0xda, 0x82, 0x2e, 0x2c, 0x83, 0xa3, 0xae, 0x87, 0xf3, 0x80, 0xda, 0x10,
-  0x13, 0x1a, 0x8f, 0xd6, 0x9a, 0x95, 0xd5, 0x66, 0xba, 0x30, 0x1b, 0xe2,
-  0x78, 0xc4, 0x79, 0xf1, 0x2b, 0x8f, 0xac, 0x44, 0x1e, 0x71, 0xe3, 0x96,
-  0xbc, 0x4a, 0x99, 0xd1, 0x85, 0x65, 0x20, 0x4e, 0x6f, 0xeb, 0x51, 0xcd,
-  0xe1, 0x80, 0x18, 0x6e, 0x79, 0xb5, 0xd2, 0x4f, 0x17, 0x96, 0x89, 0x48,
-  0x73, 0x90, 0xa9, 0x77, 0x40, 0x64, 0x0c, 0xbc, 0x4a, 0x73, 0xd0, 0x85,
-  0x65, 0x72, 0x41, 0x17, 0xe6, 0x8e, 0x5c, 0xb7, 0x1d, 0x14, 0xff, 0xac,
-  0xdd, 0xa1, 0x0b, 0xcb, 0xa4, 0x49, 0x17, 0xe6, 0x8e, 0x78, 0x73, 0x89,
-  0x5f, 0x53, 0x60, 0xd1, 0x85, 0xf1, 0x6a, 0x74, 0x1b, 0x2d, 0xba, 0x30,
-  0x77, 0x64, 0xf5, 0xac, 0x57, 0x59, 0x5c, 0xd9, 0x85, 0x51, 0x91, 0x68,
-  0xa1, 0x41, 0x17, 0xe6, 0xd0, 0xcc, 0xeb, 0x2e, 0x8c, 0x8a, 0x44, 0x1b,
-  0x74, 0x61, 0x0e, 0x5d, 0x7a, 0x79, 0xf1, 0xe9, 0xc2, 0xb2, 0x90, 0x5d,
-  0x98, 0x57, 0xeb, 0x9d, 0x75, 0xb1, 0xf4, 0x72, 0xfc, 0x20, 0xd6, 0x17,
-  0xd8, 0xda, 0x6c, 0xa3, 0xe5, 0xe5, 0x44, 0xa0, 0x26, 0x26, 0x5e, 0x76,
-  0x61, 0xe2, 0x5b, 0xb3, 0xb5, 0xd9, 0x86, 0xec, 0xc2, 0xfc, 0x39, 0x42,
-  0xac, 0x46, 0x96, 0x5e, 0x8e, 0x1f, 0xc4, 0xb7, 0x3e, 0x77, 0x7d, 0xf3,
-  0x7a, 0x41, 0x94, 0xfc, 0xfa, 0xb5, 0x1c, 0x53, 0x13, 0x13, 0x2f, 0xc7,
-  0x0f, 0xe2, 0x5b, 0x73, 0xc0, 0x94, 0x15, 0x51, 0xce, 0xb1, 0xf4, 0x6a,
-  0x9c, 0x52, 0x13, 0xa2, 0x33, 0xf0, 0x2a, 0x91, 0x28, 0x97, 0xc8, 0x39,
-  0x23, 0xd1, 0x86, 0x38, 0x9c, 0xc3, 0xb3, 0xa9, 0x76, 0x3d, 0x4c, 0xbc,
-  0x1c, 0x3f, 0x88, 0x9d, 0x00, 0xd4, 0x4b, 0x59, 0xe9, 0x88, 0x46, 0xf6,
-  0x6a, 0x6b, 0x52, 0x4d, 0x88, 0x2e, 0xcc, 0xab, 0x29, 0xb0, 0x5c, 0x22,
-  0x27, 0x53, 0x6f, 0x43, 0x9c, 0x1d, 0xe0, 0x59, 0xd9, 0x69, 0x3d, 0xc8,
-  0x2e, 0xcc, 0xab, 0xa2, 0x7a, 0x51, 0xe5, 0xc5, 0x09, 0x6e, 0x56, 0x4e,
-  0x19, 0x24, 0xba, 0x23, 0x56, 0x95, 0xbc, 0x4a, 0xd5, 0x8b, 0xc5, 0xe6,
-  0xa6, 0xeb, 0x5b, 0xd7, 0x0f, 0x0d, 0x91, 0xe7, 0xe8, 0xce, 0x22, 0xfa,
-  0xf9, 0x4c, 0x06, 0xf9, 0xf8, 0x74, 0x8f, 0x95, 0x7d, 0xaf, 0xfa, 0x95,
-  0xaa, 0x17, 0x8f, 0x05, 0x5e, 0x79, 0x69, 0x45, 0xe6, 0x39, 0xfc, 0xd4,
-  0x9b, 0xe5, 0x33, 0xcf, 0xf9, 0xfc, 0xb0, 0x78, 0x54, 0xfc, 0xcf, 0x2a,
-  0xb0, 0xf9, 0xb1, 0xb1, 0x16, 0xff, 0x0c, 0x9f, 0xf2, 0x1c, 0x62, 0x64,
-  0x4b, 0x9a, 0xc3, 0xce, 0x59, 0xbe, 0x3b, 0x1b, 0xc5, 0xf5, 0xfe, 0xf1,
-  0xbf, 0xc1, 0x7f, 0xfd, 0xf9, 0x7f, 0xd9, 0x1f, 0x02, 0xe9, 0x61, 0xbe,
-  0xbd, 0xac, 0x95, 0xcc, 0xd4, 0x93, 0xe6, 0xb0, 0x22, 0xeb, 0x39, 0xb0,
-  0x47, 0x96, 0xe9, 0x1d, 0x7c, 0x6a, 0x64, 0x8b, 0xec, 0x27, 0x69, 0x0e,
-  0x3b, 0x9e, 0x0f, 0x12, 0xe1, 0x0a, 0x69, 0x0e, 0x4b, 0x27, 0xc5, 0xaf,
-  0x35, 0xf6, 0x11, 0xd5, 0x1c, 0x76, 0x1a, 0xc7, 0xc5, 0xaf, 0x35, 0xf6,
-  0x10, 0xfb, 0x2e, 0x2d, 0x35, 0x5a, 0x9d, 0x18, 0x82, 0x0e, 0x9b, 0x90,
-  0x47, 0x74, 0xe0, 0xe0, 0x30, 0x9f, 0x56, 0x3e, 0x27, 0x9d, 0x7c, 0x5c,
-  0xdf, 0x9b, 0xb5, 0x40, 0x0f, 0x86, 0x92, 0x35, 0x2c, 0x1e, 0x15, 0xff,
-  0x7c, 0x1e, 0xf8, 0x97, 0xc3, 0x77, 0x36, 0x4f, 0x87, 0x7f, 0x6d, 0xff,
-  0xdb, 0xbf, 0x1f, 0x9b, 0x1e, 0x02, 0x95, 0x4f, 0xef, 0x92, 0xa7, 0x47,
-  0x7d, 0x6d, 0x88, 0xf5, 0x8b, 0xf4, 0xd8, 0x3e, 0x4b, 0xed, 0xdf, 0xad,
-  0xe6, 0x07, 0x6d, 0x8e, 0x47, 0x04, 0xb6, 0xe1, 0xe8, 0x25, 0x82, 0xe9,
-  0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xa8, 0x94, 0xff, 0x07, 0x59, 0x10, 0x45, 0x44, 0x60,
-  0x36, 0xaa, 0xf5, 0x00, 0x00, 0x00, 0x25, 0x74, 0x45, 0x58, 0x74, 0x64,
-  0x61, 0x74, 0x65, 0x3a, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x32,
-  0x30, 0x32, 0x35, 0x2d, 0x30, 0x38, 0x2d, 0x30, 0x32, 0x54, 0x30, 0x36,
-  0x3a, 0x32, 0x33, 0x3a, 0x35, 0x34, 0x2b, 0x30, 0x30, 0x3a, 0x30, 0x30,
-  0x66, 0x05, 0x5e, 0xbc, 0x00, 0x00, 0x00, 0x25, 0x74, 0x45, 0x58, 0x74,
-  0x64, 0x61, 0x74, 0x65, 0x3a, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x00,
-  0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x38, 0x2d, 0x30, 0x32, 0x54, 0x30,
-  0x36, 0x3a, 0x32, 0x33, 0x3a, 0x35, 0x34, 0x2b, 0x30, 0x30, 0x3a, 0x30,
-  0x30, 0x17, 0x58, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x28, 0x74, 0x45, 0x58,
-  0x74, 0x64, 0x61, 0x74, 0x65, 0x3a, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74,
-  0x61, 0x6d, 0x70, 0x00, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x38, 0x2d,
-  0x30, 0x32, 0x54, 0x30, 0x36, 0x3a, 0x32, 0x35, 0x3a, 0x31, 0x38, 0x2b,
-  0x30, 0x30, 0x3a, 0x30, 0x30, 0x0e, 0xb9, 0xd3, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+static const uint32_t bongo_cat_both_up_png_runs[] = {
+  0x3405, 0x00ffffff, 0x1, 0x30000000, 0x1, 0x40000000, 0x1, 0x20000000,
+  0x35b, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000, 0x3, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x20000000, 0x358, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x6, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000,
+  0x356, 0x00ffffff, 0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0x354, 0x00ffffff, 0x1, 0xa0000000, 0xb, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x40000000, 0x351, 0x00ffffff, 0x1, 0x80000000,
+  0xe, 0xff000000, 0x1, 0xc0000000, 0x1, 0x20000000, 0x34e, 0x00ffffff,
+  0x1, 0x50000000, 0x11, 0xff000000, 0x1, 0x80000000, 0x34c, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x12, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x40000000, 0x349, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x15, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000, 0x347, 0x00ffffff,
+  0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f,
+  0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x345, 0x00ffffff, 0x1, 0x70000000, 0x9, 0xff000000, 0x1, 0xffbfbfbf,
+  0x1, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0xd, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x10000000, 0x342, 0x00ffffff, 0x1, 0x30000000,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x4, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff3f3f3f, 0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000,
+  0x340, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x7, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff0f0f0f,
+  0xc, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000, 0x33e, 0x00ffffff,
+  0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x9, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0xc, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0x33c, 0x00ffffff, 0x1, 0x60000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0xb, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x70000000,
+  0x33a, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0xe, 0xffffffff, 0x1, 0xff7f7f7f, 0xc, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x10000000, 0x338, 0x00ffffff, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x10, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xe0000000, 0x1, 0x30000000,
+  0x336, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0x13, 0xffffffff, 0x1, 0xff7f7f7f, 0xb, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x60000000, 0x334, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x14, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xb, 0xff000000, 0x1, 0xa0000000,
+  0x333, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f,
+  0x16, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0xb, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x330, 0x00ffffff, 0x1, 0x70000000,
+  0x8, 0xff000000, 0x1, 0xff4f4f4f, 0x19, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x32e, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x1a, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000,
+  0x32d, 0x00ffffff, 0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x1d, 0xffffffff, 0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0x70000000,
+  0x32b, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1f, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x32a, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x20, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff1f1f1f, 0xa, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000,
+  0x327, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f,
+  0x22, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f, 0xa, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x325, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x25, 0xffffffff,
+  0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xd0000000, 0x1, 0x20000000,
+  0x324, 0x00ffffff, 0x1, 0x90000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x26, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x322, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x28, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000, 0x321, 0x00ffffff,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x29, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x31f, 0x00ffffff, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x2b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x31e, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0x2d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x31c, 0x00ffffff, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xff9f9f9f, 0x2e, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x31b, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x31, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x319, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x32, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x318, 0x00ffffff, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x34, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000, 0x316, 0x00ffffff,
+  0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x35, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xf0000000, 0x1, 0x20000000,
+  0x315, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x37, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x80000000, 0x1, 0x70000000, 0xa, 0x40000000, 0x1, 0x10000000,
+  0xe6, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x70000000, 0x1, 0x80000000,
+  0x2, 0x90000000, 0x1, 0x10000000, 0x21b, 0x00ffffff, 0x1, 0x20000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x38, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x1b, 0xff000000, 0x1, 0xf0000000, 0x5, 0xc0000000, 0x4, 0x80000000,
+  0x1, 0x70000000, 0x3, 0x40000000, 0x1, 0x30000000, 0xd1, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xe0000000, 0x4, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x21a, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x3a, 0xffffffff, 0x1, 0xff5f5f5f, 0x2c, 0xff000000,
+  0x1, 0xe0000000, 0x2, 0xc0000000, 0x1, 0xb0000000, 0x3, 0x80000000,
+  0x2, 0x40000000, 0x1, 0x30000000, 0xc2, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xc0000000, 0x219, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x3b, 0xffffffff, 0x1, 0xff5f5f5f, 0x37, 0xff000000, 0x1, 0xf0000000,
+  0x2, 0xc0000000, 0x1, 0x90000000, 0x2, 0x80000000, 0x2, 0x40000000,
+  0x1, 0x10000000, 0xb5, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xc0000000,
+  0xa, 0xff000000, 0x1, 0x40000000, 0x218, 0x00ffffff, 0x1, 0x70000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x3d, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x40, 0xff000000, 0x1, 0xf0000000, 0x2, 0xc0000000, 0x2, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x1, 0x10000000, 0xaa, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xa0000000, 0xc, 0xff000000, 0x1, 0xc0000000,
+  0x218, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0x3d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x48, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xc0000000, 0x1, 0xa0000000, 0x1, 0x80000000,
+  0x1, 0x60000000, 0x1, 0x40000000, 0x1, 0x10000000, 0xa0, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0x90000000, 0xf, 0xff000000, 0x1, 0x20000000,
+  0x216, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x3f, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x4f, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x70000000,
+  0x1, 0x40000000, 0x1, 0x20000000, 0x97, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x80000000, 0x1, 0xf0000000, 0x10, 0xff000000, 0x1, 0xa0000000,
+  0x216, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x40, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0x55, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x70000000,
+  0x1, 0x40000000, 0x1, 0x10000000, 0x8f, 0x00ffffff, 0x1, 0x60000000,
+  0x1, 0xe0000000, 0x12, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x214, 0x00ffffff, 0x1, 0x10000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0x46, 0xffffffff, 0x1, 0xffdfdfdf, 0x9, 0xffbfbfbf, 0x1, 0xffafafaf,
+  0x6, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x4, 0xff3f3f3f, 0x1, 0xff2f2f2f,
+  0x41, 0xff000000, 0x1, 0xc0000000, 0x1, 0xa0000000, 0x1, 0x80000000,
+  0x1, 0x40000000, 0x1, 0x20000000, 0x87, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xe0000000, 0x15, 0xff000000, 0x1, 0x60000000, 0x214, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x62, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x3, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x2, 0xff7f7f7f,
+  0x1, 0xff6f6f6f, 0x3, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x37, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0xa0000000, 0x1, 0x80000000, 0x1, 0x40000000,
+  0x1, 0x20000000, 0x7f, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xc0000000,
+  0xe, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xd0000000, 0x212, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffafafaf, 0x70, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x2, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x2, 0xff7f7f7f,
+  0x2, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x31, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xc0000000, 0x1, 0x90000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x78, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xa0000000, 0xe, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffbfbfbf, 0x2, 0xffffffff, 0x1, 0xff0f0f0f,
+  0x7, 0xff000000, 0x1, 0x30000000, 0x210, 0x00ffffff, 0x1, 0x60000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff1f1f1f, 0x7c, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf, 0x1, 0xffafafaf, 0x2, 0xff7f7f7f,
+  0x2, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x2d, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0xb0000000, 0x1, 0x80000000, 0x1, 0x40000000, 0x1, 0x10000000,
+  0x70, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x90000000, 0xe, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x4, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x7, 0xff000000, 0x1, 0xa0000000, 0x20e, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xe0000000, 0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x85, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xffbfbfbf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f,
+  0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x2a, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xb0000000, 0x1, 0x80000000, 0x1, 0x40000000,
+  0x1, 0x10000000, 0x69, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000,
+  0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f,
+  0x6, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xf0000000,
+  0x20c, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xc0000000, 0xc, 0xff000000,
+  0x1, 0xffdfdfdf, 0x8d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf,
+  0x1, 0xff9f9f9f, 0x1, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f,
+  0x1, 0xff0f0f0f, 0x27, 0xff000000, 0x1, 0xe0000000, 0x1, 0xb0000000,
+  0x1, 0x80000000, 0x1, 0x40000000, 0x1, 0x10000000, 0x63, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xe0000000, 0xe, 0xff000000, 0x1, 0xff7f7f7f,
+  0x1, 0xffefefef, 0x8, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x60000000, 0x209, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000,
+  0xd, 0xff000000, 0x1, 0xff6f6f6f, 0x96, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f,
+  0x1, 0xff0f0f0f, 0x25, 0xff000000, 0x1, 0xd0000000, 0x1, 0xa0000000,
+  0x1, 0x70000000, 0x1, 0x30000000, 0x5d, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xd0000000, 0xe, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf,
+  0xa, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xb0000000,
+  0x208, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000, 0xd, 0xff000000,
+  0x1, 0xff5f5f5f, 0x9d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf,
+  0x1, 0xff9f9f9f, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f,
+  0x24, 0xff000000, 0x1, 0xc0000000, 0x1, 0x90000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x57, 0x00ffffff, 0x1, 0x50000000, 0x1, 0xf0000000,
+  0xd, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffcfcfcf, 0xc, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x10000000,
+  0x205, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xc0000000, 0xd, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0xa5, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x1, 0xff2f2f2f,
+  0x22, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000, 0x1, 0x70000000,
+  0x1, 0x30000000, 0x52, 0x00ffffff, 0x1, 0x90000000, 0xd, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffbfbfbf, 0xf, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x1, 0x60000000, 0x203, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x90000000, 0xd, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f,
+  0x1, 0xffefefef, 0xac, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff9f9f9f,
+  0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x20, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xb0000000, 0x1, 0x80000000, 0x1, 0x40000000,
+  0x4c, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xd0000000, 0xc, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x11, 0xffffffff, 0x1, 0xffafafaf,
+  0x7, 0xff000000, 0x1, 0xb0000000, 0x202, 0x00ffffff, 0x1, 0x50000000,
+  0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0xb3, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff5f5f5f, 0x1, 0xff2f2f2f, 0x20, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x80000000, 0x1, 0x40000000, 0x47, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f,
+  0x14, 0xffffffff, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x10000000,
+  0x1ff, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xc0000000, 0xd, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffcfcfcf, 0xbb, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff8f8f8f, 0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f, 0x1f, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x40000000, 0x42, 0x00ffffff,
+  0x1, 0x80000000, 0xc, 0xff000000, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0x15, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0x50000000,
+  0x1fe, 0x00ffffff, 0x1, 0x80000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffafafaf, 0xc2, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff8f8f8f, 0x1, 0xff5f5f5f, 0x1, 0xff2f2f2f, 0x1e, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x30000000, 0x3c, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xc0000000, 0xb, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffdfdfdf, 0x17, 0xffffffff, 0x1, 0xffafafaf, 0x7, 0xff000000,
+  0x1, 0xa0000000, 0x1fc, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xc, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0xc8, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f,
+  0x1, 0xff1f1f1f, 0x1c, 0xff000000, 0x1, 0xf0000000, 0x1, 0xb0000000,
+  0x1, 0x70000000, 0x1, 0x20000000, 0x37, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff8f8f8f, 0x1a, 0xffffffff,
+  0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xf0000000, 0x1fb, 0x00ffffff,
+  0x1, 0x80000000, 0xd, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffdfdfdf,
+  0xce, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x1c, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000,
+  0x1, 0x60000000, 0x1, 0x10000000, 0x32, 0x00ffffff, 0x1, 0x70000000,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x1b, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0x30000000, 0x1f8, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xe0000000, 0xc, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0xd5, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f,
+  0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x1b, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x80000000, 0x1, 0x40000000, 0x2d, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xb0000000, 0xb, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef,
+  0x1c, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0x70000000,
+  0x1f6, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x90000000, 0xd, 0xff000000,
+  0x1, 0xff7f7f7f, 0xdb, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f,
+  0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f, 0x1a, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xb0000000, 0x1, 0x60000000, 0x1, 0x20000000, 0x28, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff7f7f7f,
+  0x1e, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x1f5, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xe0000000, 0xc, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0xe0, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f, 0x1a, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x90000000, 0x1, 0x30000000, 0x24, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffbfbfbf, 0x20, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000,
+  0x1f4, 0x00ffffff, 0x1, 0x80000000, 0xc, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0xe6, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf,
+  0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f, 0x19, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xa0000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x1e, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xa0000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x21, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0x30000000, 0x1f1, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xc, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0xeb, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f,
+  0x19, 0xff000000, 0x1, 0xb0000000, 0x1, 0x70000000, 0x1, 0x20000000,
+  0x1a, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000, 0xb, 0xff000000,
+  0x1, 0xff6f6f6f, 0x23, 0xffffffff, 0x1, 0xffafafaf, 0x7, 0xff000000,
+  0x1, 0x70000000, 0x1f0, 0x00ffffff, 0x1, 0x70000000, 0xc, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0xf1, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xffafafaf, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x18, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x90000000, 0x1, 0x30000000, 0x16, 0x00ffffff,
+  0x1, 0x50000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x24, 0xffffffff, 0x1, 0xffefefef, 0x7, 0xff000000,
+  0x1, 0xb0000000, 0x1ee, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xc0000000,
+  0xc, 0xff000000, 0x1, 0xff6f6f6f, 0x1, 0xffefefef, 0xf6, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f,
+  0x17, 0xff000000, 0x1, 0xe0000000, 0x1, 0x90000000, 0x1, 0x40000000,
+  0x12, 0x00ffffff, 0x1, 0x90000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffdfdfdf, 0x26, 0xffffffff, 0x1, 0xff2f2f2f, 0x6, 0xff000000,
+  0x1, 0xe0000000, 0x1ed, 0x00ffffff, 0x1, 0x50000000, 0x1, 0xf0000000,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0xfc, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff7f7f7f, 0x1, 0xff2f2f2f, 0x17, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x50000000, 0xd, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xd0000000, 0xb, 0xff000000, 0x1, 0xff5f5f5f,
+  0x28, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0x10000000,
+  0x1ea, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xa0000000, 0xc, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1, 0xffefefef, 0x100, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xffafafaf, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x16, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x50000000, 0x9, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x29, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1e9, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x106, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff2f2f2f, 0x16, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x50000000, 0x5, 0x00ffffff,
+  0x1, 0x80000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf,
+  0x2a, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1e8, 0x00ffffff, 0x1, 0x70000000, 0xc, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0x10a, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0x15, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xa0000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x1, 0xc0000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x2c, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xa0000000, 0x1e6, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xb0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf,
+  0x110, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f,
+  0x21, 0xff000000, 0x1, 0xff8f8f8f, 0x2e, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1e5, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x114, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff2f2f2f,
+  0x1c, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x2f, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1e4, 0x00ffffff, 0x1, 0x60000000,
+  0xc, 0xff000000, 0x1, 0xff8f8f8f, 0x119, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x18, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffefefef, 0x30, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x10000000, 0x1e1, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xa0000000,
+  0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x11d, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x14, 0xff000000,
+  0x1, 0xff7f7f7f, 0x32, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1e0, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xd0000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x121, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f,
+  0xe, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x33, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x60000000, 0x1df, 0x00ffffff,
+  0x1, 0x50000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x127, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x34, 0xffffffff, 0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1de, 0x00ffffff, 0x1, 0x80000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffdfdfdf, 0x12b, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xff6f6f6f, 0x37, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x90000000, 0x1dc, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xb0000000, 0xb, 0xff000000, 0x1, 0xff6f6f6f, 0x12f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x2, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffafafaf, 0x38, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1db, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f,
+  0x16f, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x1da, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xf0000000, 0xa, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x170, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xd0000000, 0x1d9, 0x00ffffff, 0x1, 0x60000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x171, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1d8, 0x00ffffff, 0x1, 0xa0000000,
+  0xb, 0xff000000, 0x1, 0xff8f8f8f, 0x173, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1d6, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xc0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x174, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1d5, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf,
+  0x175, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1d4, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0x176, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x10000000, 0x1d2, 0x00ffffff, 0x1, 0x50000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x178, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1d1, 0x00ffffff, 0x1, 0x60000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x179, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1d0, 0x00ffffff,
+  0x1, 0x90000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x17a, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1cf, 0x00ffffff, 0x1, 0xa0000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x17b, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1cd, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xb0000000,
+  0xa, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0x17c, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0x20000000, 0x1cc, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f,
+  0x17e, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1cc, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff9f9f9f,
+  0x17f, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1cb, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x180, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1ca, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x181, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1c9, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x182, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1c8, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x183, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xd0000000,
+  0x1c7, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x184, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1c6, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x185, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x1c5, 0x00ffffff, 0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f,
+  0x187, 0xffffffff, 0x1, 0xff1f1f1f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x1c4, 0x00ffffff, 0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f,
+  0x188, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1c3, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x189, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1c2, 0x00ffffff, 0x1, 0x60000000,
+  0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x18a, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1c1, 0x00ffffff, 0x1, 0x40000000, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x18a, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x60000000, 0x1c0, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x18b, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1bf, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x18c, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1be, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f,
+  0x18d, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1bd, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff9f9f9f, 0x18e, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1bd, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff8f8f8f, 0x18f, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1bc, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x190, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1bb, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x191, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000,
+  0x1ba, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x192, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1ba, 0x00ffffff, 0x1, 0xb0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x193, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1b9, 0x00ffffff, 0x1, 0xa0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x194, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1b8, 0x00ffffff, 0x1, 0x90000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x195, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1b7, 0x00ffffff, 0x1, 0x60000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x195, 0xffffffff, 0x1, 0xff0f0f0f,
+  0x6, 0xff000000, 0x1, 0xb0000000, 0x1b6, 0x00ffffff, 0x1, 0x50000000,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x196, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1b5, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x197, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1b4, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x198, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1b3, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xffcfcfcf, 0x199, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1b3, 0x00ffffff, 0x1, 0xc0000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f,
+  0x19a, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1b2, 0x00ffffff,
+  0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x19b, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1b1, 0x00ffffff, 0x1, 0x60000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x19b, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x50000000, 0x1b0, 0x00ffffff, 0x1, 0x40000000,
+  0x9, 0xff000000, 0x1, 0xff4f4f4f, 0x19c, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1af, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x19c, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1ae, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x19d, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1ae, 0x00ffffff, 0x1, 0xb0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x19e, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1ad, 0x00ffffff,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x19f, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1ac, 0x00ffffff,
+  0x1, 0x50000000, 0x9, 0xff000000, 0x1, 0xff7f7f7f, 0x1a0, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1ab, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1a1, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1aa, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x1a1, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1aa, 0x00ffffff, 0x1, 0xa0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1a2, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1a9, 0x00ffffff,
+  0x1, 0x70000000, 0x9, 0xff000000, 0x1, 0xffbfbfbf, 0x1a3, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1a8, 0x00ffffff,
+  0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x1a4, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1a7, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1a5, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1a7, 0x00ffffff, 0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x1a5, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1a6, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x1a6, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x17e, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0x40000000, 0x1, 0x50000000, 0x5, 0x80000000, 0x1, 0x70000000,
+  0x2, 0x40000000, 0x1c, 0x00ffffff, 0x1, 0x30000000, 0x9, 0xff000000,
+  0x1, 0xffafafaf, 0x1a7, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x179, 0x00ffffff, 0x1, 0x40000000, 0x1, 0x80000000,
+  0x1, 0xc0000000, 0x1, 0xe0000000, 0xd, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x40000000, 0x16, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f,
+  0x1a8, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x175, 0x00ffffff, 0x1, 0x20000000, 0x1, 0x70000000, 0x1, 0xb0000000,
+  0x17, 0xff000000, 0x1, 0xb0000000, 0x1, 0x70000000, 0x1, 0x20000000,
+  0x12, 0x00ffffff, 0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1a9, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x173, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xb0000000, 0x1d, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x60000000, 0xf, 0x00ffffff, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1a9, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x170, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0x80000000, 0x1, 0xe0000000, 0x21, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x80000000, 0x1, 0x10000000, 0xb, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x150, 0xffffffff, 0x1, 0xffdfdfdf, 0x2, 0xffbfbfbf, 0x1, 0xff9f9f9f,
+  0x4, 0xff7f7f7f, 0x2, 0xffbfbfbf, 0x1, 0xffcfcfcf, 0x4f, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x16f, 0x00ffffff,
+  0x1, 0x80000000, 0x1, 0xf0000000, 0x25, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0x1, 0x10000000, 0x9, 0x00ffffff, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x14c, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff8f8f8f, 0x1, 0xff5f5f5f, 0x1, 0xff2f2f2f, 0xd, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff4f4f4f, 0x1, 0xff7f7f7f, 0x1, 0xffbfbfbf,
+  0x4a, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x16d, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xe0000000, 0x29, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x70000000, 0x7, 0x00ffffff, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x149, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x16, 0xff000000,
+  0x1, 0xff4f4f4f, 0x1, 0xff8f8f8f, 0x1, 0xffdfdfdf, 0x46, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x16b, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xb0000000, 0x2d, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0x4, 0x00ffffff, 0x1, 0x30000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x147, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff5f5f5f, 0x1d, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xff9f9f9f,
+  0x44, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x16a, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xf0000000, 0x10, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x1, 0xff8f8f8f, 0x2, 0xffbfbfbf,
+  0x1, 0xffefefef, 0x4, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf,
+  0x1, 0xff8f8f8f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f, 0x11, 0xff000000,
+  0x1, 0x80000000, 0x2, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x146, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff1f1f1f, 0x21, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f,
+  0x1, 0xffefefef, 0x41, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x169, 0x00ffffff, 0x1, 0x70000000, 0xe, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff6f6f6f, 0x1, 0xffbfbfbf, 0x11, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0xe, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x10000000, 0x1, 0x90000000, 0x8, 0xff000000,
+  0x1, 0xff4f4f4f, 0x145, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f,
+  0x25, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0x3f, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x168, 0x00ffffff, 0x1, 0xa0000000, 0xc, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff5f5f5f, 0x1, 0xffcfcfcf, 0x17, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xe8000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x143, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f, 0x29, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff7f7f7f, 0x3e, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x166, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xc0000000,
+  0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0x1b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff7f7f7f, 0x1, 0xff1f1f1f,
+  0x13, 0xff000000, 0x1, 0xffbfbfbf, 0x142, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0x2d, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf,
+  0x3c, 0xffffffff, 0x1, 0xffcfcfcf, 0x7, 0xff000000, 0x1, 0x70000000,
+  0x165, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0xb, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1, 0xffefefef, 0x20, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x1, 0xff0f0f0f, 0x10, 0xff000000, 0x1, 0xff6f6f6f, 0x142, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0x10, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xff4f4f4f, 0x1, 0xff7f7f7f, 0x1, 0xffafafaf, 0x2, 0xffbfbfbf,
+  0x3, 0xffffffff, 0x1, 0xffefefef, 0x2, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff5f5f5f, 0x1, 0xff2f2f2f, 0x11, 0xff000000, 0x1, 0xff7f7f7f,
+  0x3c, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x165, 0x00ffffff,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf,
+  0x23, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0xe, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x141, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xd, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff5f5f5f,
+  0x1, 0xffafafaf, 0x1, 0xffefefef, 0xf, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0xe, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x3a, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x164, 0x00ffffff, 0x1, 0xa0000000, 0xa, 0xff000000,
+  0x1, 0xff7f7f7f, 0x27, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f,
+  0xc, 0xff000000, 0x1, 0xffcfcfcf, 0x141, 0xffffffff, 0x1, 0xff6f6f6f,
+  0xd, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffafafaf, 0x17, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0xc, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x39, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x163, 0x00ffffff, 0x1, 0x80000000, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x29, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff3f3f3f, 0xa, 0xff000000, 0x1, 0xff6f6f6f, 0x141, 0xffffffff,
+  0x1, 0xff5f5f5f, 0xc, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf,
+  0x1b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff8f8f8f, 0x1, 0xff1f1f1f,
+  0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x38, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x162, 0x00ffffff, 0x1, 0x50000000,
+  0x9, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x2c, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x13f, 0xffffffff, 0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffdfdfdf, 0x20, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff0f0f0f,
+  0xb, 0xff000000, 0x1, 0xff9f9f9f, 0x37, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x160, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x2e, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x13d, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x23, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0xb, 0xff000000, 0x1, 0xffcfcfcf, 0x36, 0xffffffff,
+  0x9, 0xff000000, 0x1, 0x60000000, 0x15f, 0x00ffffff, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x30, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x13b, 0xffffffff, 0x1, 0xff6f6f6f, 0xa, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0x26, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x35, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0x90000000, 0x15d, 0x00ffffff,
+  0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x32, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x139, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000,
+  0x1, 0xff9f9f9f, 0x29, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xa, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x15a, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xffcfcfcf, 0x34, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x137, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x2c, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x33, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x159, 0x00ffffff, 0x1, 0xa0000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x35, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x135, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x2e, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x33, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xa, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0x157, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x37, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x134, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x30, 0xffffffff, 0x1, 0xff7f7f7f, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x34, 0xffffffff, 0x1, 0xff6f6f6f, 0xa, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x156, 0x00ffffff, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x38, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffdfdfdf, 0x132, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x32, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x34, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x40000000,
+  0x154, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f,
+  0x3a, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x130, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xff9f9f9f, 0x34, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x34, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x153, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x3c, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x52, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff686868, 0x4, 0xff2f2f2f, 0x1, 0xff7f7f7f,
+  0x1, 0xff9f9f9f, 0x1, 0xffdfdfdf, 0xd4, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x36, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x34, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x151, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x3d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xff9f9f9f, 0x4f, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff151515,
+  0x9, 0xff000000, 0x1, 0xff232323, 0x1, 0xff9f9f9f, 0xd1, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0x37, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x34, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0x60000000, 0x150, 0x00ffffff,
+  0x1, 0x90000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x3f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xff7f7f7f,
+  0x4d, 0xffffffff, 0x1, 0xff959595, 0xd, 0xff000000, 0x1, 0xff171717,
+  0x1, 0xffbfbfbf, 0xcf, 0xffffffff, 0x1, 0xff5f5f5f, 0x8, 0xff000000,
+  0x1, 0xffcfcfcf, 0x38, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xa0000000,
+  0x14f, 0x00ffffff, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0xe, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffd7d4fb, 0x3, 0xffbab6f9,
+  0x1, 0xffccc8fa, 0x1, 0xfff4f3fe, 0x2b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0x4a, 0xffffffff, 0x1, 0xff9f9f9f, 0x10, 0xff000000, 0x1, 0xff959595,
+  0xcd, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0xb, 0xffffffff, 0x1, 0xffdddafc, 0x1, 0xffb5b0f8, 0x2, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xffc6c2fa, 0x1, 0xffeeedfd, 0x28, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x35, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x14d, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0xe, 0xffffffff, 0x1, 0xffeeedfd, 0x1, 0xffafaaf8,
+  0x6, 0xffa49ef7, 0x1, 0xffccc8fa, 0x2b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff4f4f4f, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf,
+  0x48, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff070707, 0x11, 0xff000000,
+  0x1, 0xff959595, 0xcc, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0xa, 0xffffffff, 0x1, 0xffc6c2fa,
+  0x7, 0xffa49ef7, 0x1, 0xffdddafc, 0x28, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf,
+  0x35, 0xffffffff, 0x1, 0xff8f8f8f, 0xa, 0xff000000, 0x1, 0xa0000000,
+  0x14c, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0xe, 0xffffffff, 0x1, 0xffafaaf8, 0x8, 0xffa49ef7, 0x1, 0xffccc8fa,
+  0x13, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffe2e1fc, 0x2, 0xffd1cefb,
+  0x1, 0xffdddafc, 0x1, 0xfff4f3fe, 0x13, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x47, 0xffffffff,
+  0x1, 0xff535353, 0x13, 0xff000000, 0x1, 0xffbfbfbf, 0xca, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0xa, 0xffffffff, 0x1, 0xffd1cefb, 0x9, 0xffa49ef7, 0x1, 0xffe2e1fc,
+  0x12, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffdddafc, 0x1, 0xffc6c2fa,
+  0x2, 0xffbab6f9, 0x1, 0xffd1cefb, 0x1, 0xffeeedfd, 0xf, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xff9f9f9f,
+  0x35, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xa0000000,
+  0x14a, 0x00ffffff, 0x1, 0x20000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0xd, 0xffffffff, 0x1, 0xffdddafc, 0xa, 0xffa49ef7,
+  0x1, 0xfff4f3fe, 0x10, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffc6c2fa,
+  0x1, 0xffa9a4f7, 0x5, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1, 0xffeeedfd,
+  0x12, 0xffffffff, 0x1, 0xff7f7f7f, 0xb, 0xff000000, 0x1, 0xff9f9f9f,
+  0x45, 0xffffffff, 0x1, 0xffdfdfdf, 0x14, 0xff000000, 0x1, 0xff171717,
+  0xca, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0xb, 0xffffffff, 0x1, 0xffafaaf8, 0x9, 0xffa49ef7, 0x1, 0xffafaaf8,
+  0x11, 0xffffffff, 0x1, 0xffd1cefb, 0x1, 0xffa9a4f7, 0x6, 0xffa49ef7,
+  0x1, 0xffbab6f9, 0x1, 0xfff4f3fe, 0xe, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xff6f6f6f, 0x35, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xa0000000, 0x149, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0xe, 0xffffffff,
+  0x1, 0xffc6c2fa, 0xa, 0xffa49ef7, 0x1, 0xffc6c2fa, 0xf, 0xffffffff,
+  0x1, 0xffe2e1fc, 0x1, 0xffa9a4f7, 0x9, 0xffa49ef7, 0x1, 0xffdddafc,
+  0x12, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x44, 0xffffffff, 0x1, 0xff7f7f7f, 0x1, 0xff020202,
+  0x14, 0xff000000, 0x1, 0xffafafaf, 0xc9, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0xff9f9f9f, 0xa, 0xffffffff, 0x1, 0xfff9f9fe,
+  0xb, 0xffa49ef7, 0x1, 0xffeeedfd, 0xe, 0xffffffff, 0x1, 0xfff9f9fe,
+  0x1, 0xffb5b0f8, 0x9, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffeeedfd,
+  0xe, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f, 0xa, 0xff000000,
+  0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0x34, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xa0000000, 0x148, 0x00ffffff,
+  0x1, 0xd0000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf, 0xe, 0xffffffff,
+  0x1, 0xffbab6f9, 0xa, 0xffa49ef7, 0x1, 0xffbab6f9, 0xe, 0xffffffff,
+  0x1, 0xffdddafc, 0xb, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xfff9f9fe,
+  0x12, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xffbfbfbf, 0x44, 0xffffffff, 0x1, 0xff131313, 0x15, 0xff000000,
+  0x1, 0xff535353, 0xc8, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0xb, 0xffffffff, 0x1, 0xffe8e7fd, 0xb, 0xffa49ef7,
+  0x1, 0xffd7d4fb, 0xd, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffa9a4f7,
+  0xb, 0xffa49ef7, 0x1, 0xffbab6f9, 0x10, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x34, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xa0000000,
+  0x146, 0x00ffffff, 0x1, 0x20000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0xf, 0xffffffff, 0x1, 0xffbab6f9, 0xb, 0xffa49ef7, 0xd, 0xffffffff,
+  0x1, 0xffeeedfd, 0xd, 0xffa49ef7, 0x1, 0xffd7d4fb, 0x13, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x43, 0xffffffff, 0x1, 0xffcfcfcf, 0x16, 0xff000000, 0x1, 0xff131313,
+  0xc8, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0xb, 0xffffffff, 0x1, 0xffeeedfd, 0xb, 0xffa49ef7, 0x1, 0xffd1cefb,
+  0xd, 0xffffffff, 0x1, 0xffb5b0f8, 0xd, 0xffa49ef7, 0x11, 0xffffffff,
+  0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf,
+  0x34, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xa0000000, 0x145, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0xf, 0xffffffff, 0x1, 0xffc6c2fa, 0xa, 0xffa49ef7,
+  0x1, 0xffbab6f9, 0xd, 0xffffffff, 0x1, 0xffafaaf8, 0xd, 0xffa49ef7,
+  0x1, 0xffd1cefb, 0x14, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f,
+  0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x43, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x1, 0xff010101, 0x16, 0xff000000, 0xc7, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xffdfdfdf, 0xc, 0xffffffff,
+  0xb, 0xffa49ef7, 0x1, 0xffdddafc, 0xc, 0xffffffff, 0x1, 0xffdddafc,
+  0xe, 0xffa49ef7, 0x12, 0xffffffff, 0x1, 0xff8f8f8f, 0xb, 0xff000000,
+  0x1, 0xff9f9f9f, 0x34, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0x90000000, 0x144, 0x00ffffff, 0x1, 0xb0000000,
+  0x7, 0xff000000, 0x1, 0xffcfcfcf, 0xf, 0xffffffff, 0x1, 0xffdddafc,
+  0xa, 0xffa49ef7, 0x1, 0xffc6c2fa, 0xc, 0xffffffff, 0x1, 0xffdddafc,
+  0xe, 0xffa49ef7, 0x1, 0xffdddafc, 0x16, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x5, 0xff000000, 0x1, 0xff6f6f6f, 0x44, 0xffffffff, 0x1, 0xff535353,
+  0x17, 0xff000000, 0x3d, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f,
+  0x1, 0xff3f3f3f, 0x1, 0xff9f9f9f, 0x86, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xff4f4f4f, 0xd, 0xffffffff, 0x1, 0xffc0bcf9,
+  0xa, 0xffa49ef7, 0x1, 0xfff4f3fe, 0xc, 0xffffffff, 0x1, 0xffafaaf8,
+  0xd, 0xffa49ef7, 0x1, 0xffafaaf8, 0x13, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xffdfdfdf, 0x34, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0x60000000,
+  0x143, 0x00ffffff, 0x1, 0xf0000000, 0x6, 0xff000000, 0x1, 0xff1f1f1f,
+  0x11, 0xffffffff, 0x1, 0xffafaaf8, 0x9, 0xffa49ef7, 0x1, 0xfff4f3fe,
+  0xc, 0xffffffff, 0x1, 0xffc6c2fa, 0xd, 0xffa49ef7, 0x1, 0xffa9a4f7,
+  0x1, 0xfff9f9fe, 0x17, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff4f4f4f,
+  0x2, 0xff3f3f3f, 0x1, 0xff9f9f9f, 0x45, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x17, 0xff000000, 0x1d, 0xffffffff, 0x2, 0xffbfbfbf, 0x1d, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x4, 0xff000000, 0x1, 0xff6f6f6f, 0x85, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0xd, 0xffffffff,
+  0x1, 0xffeeedfd, 0x9, 0xffa49ef7, 0x1, 0xffccc8fa, 0xd, 0xffffffff,
+  0xe, 0xffa49ef7, 0x1, 0xffd1cefb, 0x14, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x35, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0x60000000,
+  0x141, 0x00ffffff, 0x1, 0x20000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f,
+  0x11, 0xffffffff, 0x1, 0xffeeedfd, 0x8, 0xffa49ef7, 0x1, 0xffdddafc,
+  0xd, 0xffffffff, 0x1, 0xffbab6f9, 0xd, 0xffa49ef7, 0x1, 0xffd7d4fb,
+  0x62, 0xffffffff, 0x1, 0xff090909, 0x17, 0xff000000, 0x1b, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0x2, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffcfcfcf, 0x1a, 0xffffffff, 0x1, 0xff9f9f9f, 0x6, 0xff000000,
+  0x1, 0xffefefef, 0x84, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0xf, 0xffffffff, 0x1, 0xffdddafc, 0x7, 0xffa49ef7, 0x1, 0xffc0bcf9,
+  0xe, 0xffffffff, 0xd, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x16, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0x36, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0x60000000, 0x140, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x12, 0xffffffff, 0x1, 0xffeeedfd, 0x1, 0xffafaaf8,
+  0x4, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xffe8e7fd, 0xe, 0xffffffff,
+  0x1, 0xffd7d4fb, 0xc, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x63, 0xffffffff,
+  0x18, 0xff000000, 0x1b, 0xffffffff, 0x1, 0xff3f3f3f, 0x4, 0xff000000,
+  0x1, 0xff1f1f1f, 0x19, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x83, 0xffffffff, 0x1, 0xffafafaf, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x10, 0xffffffff, 0x1, 0xffe2e1fc, 0x1, 0xffb5b0f8,
+  0x3, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xffdddafc, 0xf, 0xffffffff,
+  0x1, 0xffbab6f9, 0xb, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xfff9f9fe,
+  0x17, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0x7, 0xff000000,
+  0x1, 0xffcfcfcf, 0x37, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0x30000000, 0x13f, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x14, 0xffffffff, 0x1, 0xffeeedfd,
+  0x2, 0xffe8e7fd, 0x1, 0xffeeedfd, 0x10, 0xffffffff, 0x1, 0xfff9f9fe,
+  0x1, 0xffb5b0f8, 0xa, 0xffa49ef7, 0x1, 0xffccc8fa, 0x64, 0xffffffff,
+  0x17, 0xff000000, 0x1, 0xff2f2f2f, 0x1b, 0xffffffff, 0x6, 0xff000000,
+  0x1, 0xffbfbfbf, 0x17, 0xffffffff, 0x1, 0xff8f8f8f, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x61, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff8f8f8f, 0x1, 0xff404040, 0x2, 0xff2f2f2f, 0x1, 0xff404040,
+  0x1, 0xff9f9f9f, 0x1, 0xffefefef, 0x19, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x26, 0xffffffff, 0x1, 0xffeeedfd,
+  0x1, 0xffafaaf8, 0x9, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1, 0xfff9f9fe,
+  0x1a, 0xffffffff, 0x1, 0xff8f8f8f, 0x5, 0xff000000, 0x1, 0xff5f5f5f,
+  0x39, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x13e, 0x00ffffff, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x2a, 0xffffffff, 0x1, 0xfff9f9fe,
+  0x1, 0xffd1cefb, 0x1, 0xffa9a4f7, 0x6, 0xffa49ef7, 0x1, 0xffbab6f9,
+  0x1, 0xffe8e7fd, 0x65, 0xffffffff, 0x1, 0xff2f2f2f, 0x16, 0xff000000,
+  0x1, 0xff404040, 0x1b, 0xffffffff, 0x6, 0xff000000, 0x1, 0xff5f5f5f,
+  0x16, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xff7f7f7f,
+  0x5f, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff595959, 0x1, 0xff000000,
+  0x1, 0xff020202, 0x4, 0xff000000, 0x1, 0xff020202, 0x1, 0xff090909,
+  0x1, 0xff8f8f8f, 0x18, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000,
+  0x28, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffd1cefb, 0x1, 0xffafaaf8,
+  0x5, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xffdddafc, 0x1d, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x1, 0xff3f3f3f,
+  0x1, 0xff7f7f7f, 0x3b, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x20000000, 0x13d, 0x00ffffff, 0x1, 0xe0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x2d, 0xffffffff, 0x1, 0xffe8e7fd,
+  0x3, 0xffd1cefb, 0x1, 0xffd7d4fb, 0x1, 0xfff4f3fe, 0x67, 0xffffffff,
+  0x1, 0xff404040, 0x16, 0xff000000, 0x1, 0xff7f7f7f, 0x1b, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x6, 0xff000000, 0x1, 0xffdfdfdf, 0x13, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0xc, 0xff000000, 0x1, 0xffcfcfcf,
+  0x5d, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff070707, 0x1, 0xff020202,
+  0x9, 0xff000000, 0x1, 0xff595959, 0x17, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x2b, 0xffffffff, 0x1, 0xfff4f3fe, 0x3, 0xffe8e7fd,
+  0x1, 0xfff9f9fe, 0x60, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x13c, 0x00ffffff, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0x9a, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff010101,
+  0x15, 0xff000000, 0x1, 0xffbfbfbf, 0x1b, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x12, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xd, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x5a, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff333333, 0xd, 0xff000000,
+  0x1, 0xff595959, 0x15, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x91, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0xd0000000, 0x13b, 0x00ffffff, 0x1, 0x20000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x9a, 0xffffffff, 0x1, 0xffdfdfdf, 0x15, 0xff000000,
+  0x1, 0xff131313, 0x1d, 0xffffffff, 0x1, 0xff0f0f0f, 0x6, 0xff000000,
+  0x1, 0xff7f7f7f, 0xf, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f,
+  0x10, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x58, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff131313, 0x1, 0xff020202, 0xe, 0xff000000,
+  0x1, 0xff9f9f9f, 0x14, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x92, 0xffffffff, 0x1, 0xff7f7f7f, 0x9, 0xff000000,
+  0x1, 0xa0000000, 0x13a, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xffafafaf, 0x9b, 0xffffffff, 0x1, 0xff535353, 0x1, 0xff020202,
+  0x12, 0xff000000, 0x1, 0xff020202, 0x1, 0xff7f7f7f, 0x1d, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0xc, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x2, 0xff8f8f8f,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x15, 0xffffffff,
+  0x1, 0xffafafaf, 0x2, 0xff3f3f3f, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf,
+  0x3c, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff202020, 0x10, 0xff000000,
+  0x1, 0xff070707, 0x1, 0xffdfdfdf, 0x13, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x94, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000,
+  0x1, 0x80000000, 0x139, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x9b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff090909,
+  0x12, 0xff000000, 0x1, 0xff232323, 0x1f, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffafafaf, 0x7, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x2, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x13, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x4, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x3b, 0xffffffff, 0x1, 0xff454545, 0x1, 0xff010101, 0x11, 0xff000000,
+  0x1, 0xff373737, 0x13, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xff1f1f1f, 0x95, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000,
+  0x1, 0x60000000, 0x138, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x9c, 0xffffffff, 0x1, 0xffbfbfbf, 0x11, 0xff000000,
+  0x1, 0xff090909, 0x1, 0xffcfcfcf, 0x1f, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff3f3f3f, 0x1, 0xff6f6f6f,
+  0x1, 0xff7f7f7f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f,
+  0xc, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x3, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff8f8f8f, 0x10, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff2f2f2f,
+  0x6, 0xff000000, 0x1, 0xff8f8f8f, 0x3a, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x14, 0xff000000, 0x1, 0xffbfbfbf, 0x12, 0xffffffff, 0x1, 0xff0f0f0f,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x95, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x8, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x137, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x9e, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff080808, 0x1, 0xff020202, 0xc, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff232323, 0x1, 0xffcfcfcf, 0x21, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1a, 0xff000000, 0x1, 0xff6f6f6f, 0x1, 0xffefefef,
+  0x5, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0xc, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x3a, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x14, 0xff000000, 0x1, 0xff535353, 0x12, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x96, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000,
+  0x136, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x9f, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff535353, 0x1, 0xff000000, 0x1, 0xff020202,
+  0x8, 0xff000000, 0x1, 0xff020202, 0x1, 0xff070707, 0x1, 0xff777777,
+  0x1, 0xffefefef, 0x23, 0xffffffff, 0x1, 0xff9f9f9f, 0x17, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x8, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff5f5f5f,
+  0x1, 0xffafafaf, 0x1, 0xffdfdfdf, 0x4, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0xa, 0xff000000,
+  0x1, 0xffbfbfbf, 0x39, 0xffffffff, 0x1, 0xffcfcfcf, 0x16, 0xff000000,
+  0x11, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x97, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xd0000000, 0x136, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0xa1, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f,
+  0x5, 0xff000000, 0x1, 0xff080808, 0x1, 0xff333333, 0x1, 0xff8f8f8f,
+  0x1, 0xffefefef, 0x26, 0xffffffff, 0x1, 0xff9f9f9f, 0x14, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0xb, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x1d, 0xff000000, 0x1, 0xff5f5f5f, 0x3a, 0xffffffff,
+  0x1, 0xff686868, 0x16, 0xff000000, 0x1, 0xffbfbfbf, 0x10, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffafafaf, 0x21, 0xffffffff,
+  0x1, 0xffeeedfd, 0x4, 0xffe8e7fd, 0x72, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x9, 0xff000000, 0x1, 0xa0000000, 0x135, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x11, 0xffffffff, 0x1, 0xffeeedfd, 0x2, 0xffe8e7fd,
+  0x1, 0xffeeedfd, 0xc, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffccc8fa,
+  0x1, 0xffafaaf8, 0x4, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xffc0bcf9,
+  0x1, 0xffdddafc, 0x1, 0xfff9f9fe, 0x79, 0xffffffff, 0x1, 0xffefefef,
+  0x2, 0xffbfbfbf, 0x2c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f,
+  0x10, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0xe, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0x1b, 0xff000000, 0x1, 0xff8f8f8f,
+  0x3b, 0xffffffff, 0x1, 0xff2f2f2f, 0x15, 0xff000000, 0x1, 0xff020202,
+  0x1, 0xff7f7f7f, 0x10, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0xe, 0xffffffff, 0x1, 0xffeeedfd, 0x3, 0xffd1cefb,
+  0x1, 0xffe8e7fd, 0xb, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffd1cefb,
+  0x1, 0xffa9a4f7, 0x6, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xffd7d4fb,
+  0x1, 0xfff4f3fe, 0x6f, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0x60000000, 0x134, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0xf, 0xffffffff, 0x1, 0xffe2e1fc, 0x1, 0xffafaaf8, 0x4, 0xffa49ef7,
+  0x1, 0xffbab6f9, 0x1, 0xfff4f3fe, 0x9, 0xffffffff, 0x1, 0xffe2e1fc,
+  0x1, 0xffa9a4f7, 0xa, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x1, 0xfff4f3fe,
+  0xa8, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff4f4f4f, 0xb, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff6f6f6f, 0x1, 0xffcfcfcf, 0x12, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x18, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffcfcfcf,
+  0x3c, 0xffffffff, 0x17, 0xff000000, 0x1, 0xff7f7f7f, 0x10, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xc, 0xffffffff,
+  0x1, 0xffeeedfd, 0x1, 0xffbab6f9, 0x5, 0xffa49ef7, 0x1, 0xffbab6f9,
+  0x1, 0xfff9f9fe, 0x8, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffb5b0f8,
+  0xb, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x1, 0xfff4f3fe, 0x6e, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0x30000000, 0x133, 0x00ffffff,
+  0x1, 0x80000000, 0x7, 0xff000000, 0xe, 0xffffffff, 0x1, 0xffc6c2fa,
+  0x7, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xfff9f9fe, 0x7, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x1, 0xffa9a4f7, 0xd, 0xffa49ef7, 0x1, 0xffd1cefb,
+  0xa9, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff6f6f6f, 0x3, 0xff3f3f3f, 0x2, 0xff7f7f7f, 0x1, 0xffbfbfbf,
+  0x1, 0xffefefef, 0x16, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f,
+  0x14, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x3e, 0xffffffff,
+  0x17, 0xff000000, 0x1, 0xff7f7f7f, 0x10, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xb, 0xffffffff, 0x1, 0xffdddafc,
+  0x8, 0xffa49ef7, 0x1, 0xffc0bcf9, 0x8, 0xffffffff, 0x1, 0xffbab6f9,
+  0xe, 0xffa49ef7, 0x1, 0xffd1cefb, 0x6e, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000, 0x132, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf, 0xc, 0xffffffff,
+  0x1, 0xffc6c2fa, 0x9, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x7, 0xffffffff,
+  0x1, 0xffc0bcf9, 0xf, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xfff9f9fe,
+  0xca, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff5f5f5f, 0x10, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xff9f9f9f, 0x40, 0xffffffff, 0x17, 0xff000000,
+  0x1, 0xff7f7f7f, 0x10, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0xa, 0xffffffff, 0x1, 0xffe8e7fd, 0xa, 0xffa49ef7,
+  0x1, 0xffe8e7fd, 0x6, 0xffffffff, 0x1, 0xffe8e7fd, 0x10, 0xffa49ef7,
+  0x1, 0xffbab6f9, 0x1, 0xfff9f9fe, 0x6c, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xb0000000, 0x132, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xb, 0xffffffff,
+  0x1, 0xffe2e1fc, 0xb, 0xffa49ef7, 0x1, 0xfff9f9fe, 0x5, 0xffffffff,
+  0x1, 0xfff9f9fe, 0x11, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffeeedfd,
+  0xcb, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff4f4f4f,
+  0x1, 0xff8f8f8f, 0x1, 0xffdfdfdf, 0x42, 0xffffffff, 0x17, 0xff000000,
+  0x1, 0xff7f7f7f, 0x10, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0xa, 0xffffffff, 0x1, 0xffafaaf8, 0xa, 0xffa49ef7,
+  0x1, 0xffc6c2fa, 0x6, 0xffffffff, 0x1, 0xffccc8fa, 0x11, 0xffa49ef7,
+  0x1, 0xffb5b0f8, 0x1, 0xfff9f9fe, 0x6c, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x80000000, 0x131, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xb, 0xffffffff,
+  0x1, 0xffb5b0f8, 0xb, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x5, 0xffffffff,
+  0x1, 0xffe2e1fc, 0x12, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xfff9f9fe,
+  0xce, 0xffffffff, 0x1, 0xffefefef, 0x6, 0xffbfbfbf, 0x1, 0xffefefef,
+  0x46, 0xffffffff, 0x1, 0xff2f2f2f, 0x16, 0xff000000, 0x1, 0xffafafaf,
+  0x10, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x9, 0xffffffff, 0x1, 0xffe2e1fc, 0xb, 0xffa49ef7, 0x1, 0xffafaaf8,
+  0x6, 0xffffffff, 0x1, 0xffb5b0f8, 0x12, 0xffa49ef7, 0x1, 0xffc0bcf9,
+  0x6d, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0x40000000,
+  0x130, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0xa, 0xffffffff, 0x1, 0xfff4f3fe, 0xc, 0xffa49ef7, 0x1, 0xffd7d4fb,
+  0x5, 0xffffffff, 0x1, 0xffd1cefb, 0x13, 0xffa49ef7, 0x1, 0xffc0bcf9,
+  0x11c, 0xffffffff, 0x1, 0xff6f6f6f, 0x1, 0xff020202, 0x15, 0xff000000,
+  0x1, 0xffdfdfdf, 0x10, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x9, 0xffffffff, 0x1, 0xffccc8fa, 0xc, 0xffa49ef7,
+  0x6, 0xffffffff, 0x14, 0xffa49ef7, 0x1, 0xffd7d4fb, 0x6d, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000,
+  0x130, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0xa, 0xffffffff,
+  0x1, 0xffe8e7fd, 0xc, 0xffa49ef7, 0x1, 0xffd1cefb, 0x5, 0xffffffff,
+  0x1, 0xffccc8fa, 0x14, 0xffa49ef7, 0x1, 0xffe2e1fc, 0x11b, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x15, 0xff000000, 0x1, 0xff131313, 0x11, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x9, 0xffffffff,
+  0x1, 0xffbab6f9, 0xc, 0xffa49ef7, 0x6, 0xffffffff, 0x14, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xfff9f9fe, 0x6d, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x8, 0xff000000, 0x1, 0xb0000000, 0x130, 0x00ffffff, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0xa, 0xffffffff, 0x1, 0xffe8e7fd, 0xc, 0xffa49ef7,
+  0x1, 0xffe8e7fd, 0x5, 0xffffffff, 0x1, 0xffbab6f9, 0x14, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x11c, 0xffffffff, 0x1, 0xff595959, 0x1, 0xff010101,
+  0x12, 0xff000000, 0x1, 0xff010101, 0x1, 0xff7f7f7f, 0x11, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x9, 0xffffffff,
+  0x1, 0xffc6c2fa, 0xb, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x6, 0xffffffff,
+  0x15, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x6d, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x70000000, 0x12f, 0x00ffffff,
+  0x1, 0xd0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0xa, 0xffffffff,
+  0x1, 0xfff9f9fe, 0xc, 0xffa49ef7, 0x1, 0xfff9f9fe, 0x5, 0xffffffff,
+  0x1, 0xffc6c2fa, 0x15, 0xffa49ef7, 0x1, 0xffdddafc, 0x11b, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff090909, 0x12, 0xff000000, 0x1, 0xff080808,
+  0x1, 0xffefefef, 0x11, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x9, 0xffffffff, 0x1, 0xffd7d4fb, 0xb, 0xffa49ef7,
+  0x1, 0xffccc8fa, 0x6, 0xffffffff, 0x15, 0xffa49ef7, 0x1, 0xffa9a4f7,
+  0x1, 0xfff9f9fe, 0x6d, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x12e, 0x00ffffff, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff0f0f0f, 0xb, 0xffffffff, 0x1, 0xffb5b0f8,
+  0xa, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x6, 0xffffffff, 0x1, 0xffd1cefb,
+  0x15, 0xffa49ef7, 0x1, 0xffc0bcf9, 0x11c, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff090909, 0x11, 0xff000000, 0x1, 0xffafafaf, 0x13, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x9, 0xffffffff, 0x1, 0xfff4f3fe,
+  0xb, 0xffa49ef7, 0x1, 0xfff4f3fe, 0x6, 0xffffffff, 0x16, 0xffa49ef7,
+  0x1, 0xffdddafc, 0x6e, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0xd0000000, 0x12e, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0xa, 0xffffffff, 0x1, 0xffe2e1fc, 0x9, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xfff4f3fe, 0x6, 0xffffffff, 0x1, 0xffd1cefb,
+  0x16, 0xffa49ef7, 0x11d, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff090909,
+  0x1, 0xff020202, 0xe, 0xff000000, 0x1, 0xff686868, 0x14, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff6f6f6f, 0xa, 0xffffffff, 0x1, 0xffccc8fa,
+  0x9, 0xffa49ef7, 0x1, 0xffdddafc, 0x7, 0xffffffff, 0x1, 0xffb5b0f8,
+  0x15, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x6f, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x8, 0xff000000, 0x1, 0x90000000, 0x12d, 0x00ffffff, 0x1, 0x70000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xb, 0xffffffff, 0x1, 0xffd1cefb,
+  0x7, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xffeeedfd, 0x7, 0xffffffff,
+  0x1, 0xffe8e7fd, 0x16, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x11d, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff535353, 0xc, 0xff000000, 0x1, 0xff070707,
+  0x1, 0xff9f9f9f, 0x15, 0xffffffff, 0x1, 0xff1f1f1f, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0xb, 0xffffffff, 0x1, 0xffc6c2fa, 0x6, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xffdddafc, 0x8, 0xffffffff, 0x1, 0xffc0bcf9,
+  0x15, 0xffa49ef7, 0x1, 0xffafaaf8, 0x6f, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x40000000, 0x12c, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff8f8f8f, 0xc, 0xffffffff,
+  0x1, 0xffe8e7fd, 0x1, 0xffc0bcf9, 0x3, 0xffa49ef7, 0x1, 0xffb5b0f8,
+  0x1, 0xffd7d4fb, 0x9, 0xffffffff, 0x1, 0xfff4f3fe, 0x16, 0xffa49ef7,
+  0x1, 0xffd7d4fb, 0x11f, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff535353,
+  0x2, 0xff000000, 0x1, 0xff020202, 0x6, 0xff000000, 0x1, 0xff535353,
+  0x1, 0xffdfdfdf, 0x16, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xff2f2f2f, 0xc, 0xffffffff, 0x1, 0xffe8e7fd, 0x1, 0xffc6c2fa,
+  0x2, 0xffbab6f9, 0x1, 0xffc0bcf9, 0x1, 0xffd7d4fb, 0x1, 0xfff9f9fe,
+  0x9, 0xffffffff, 0x1, 0xffd1cefb, 0x16, 0xffa49ef7, 0x70, 0xffffffff,
+  0x1, 0xffafafaf, 0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000,
+  0x12c, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x1d, 0xffffffff,
+  0x1, 0xffafaaf8, 0x15, 0xffa49ef7, 0x1, 0xffd1cefb, 0x122, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x5, 0xff7f7f7f, 0x1, 0xffbfbfbf, 0x1, 0xffefefef,
+  0x18, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1c, 0xffffffff,
+  0x1, 0xffeeedfd, 0x16, 0xffa49ef7, 0x71, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x8, 0xff000000, 0x1, 0x90000000, 0x12c, 0x00ffffff, 0x1, 0xe0000000,
+  0x6, 0xff000000, 0x1, 0xff2f2f2f, 0x1d, 0xffffffff, 0x1, 0xffccc8fa,
+  0x15, 0xffa49ef7, 0x1, 0xffd1cefb, 0x142, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xffcfcfcf, 0x1c, 0xffffffff, 0x1, 0xffa9a4f7,
+  0x15, 0xffa49ef7, 0x71, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x12b, 0x00ffffff, 0x1, 0xb0000000,
+  0x7, 0xff000000, 0x1, 0xffefefef, 0x1c, 0xffffffff, 0x1, 0xffe8e7fd,
+  0x15, 0xffa49ef7, 0x1, 0xffd1cefb, 0x142, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x1c, 0xffffffff, 0x1, 0xffc6c2fa,
+  0x15, 0xffa49ef7, 0x72, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x10000000, 0x12a, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x1d, 0xffffffff, 0x1, 0xffafaaf8,
+  0x14, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x142, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x1c, 0xffffffff, 0x1, 0xffeeedfd,
+  0x14, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x73, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x8, 0xff000000, 0x1, 0x90000000, 0x12a, 0x00ffffff, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x1d, 0xffffffff, 0x1, 0xffd1cefb,
+  0x14, 0xffa49ef7, 0x1, 0xfff9f9fe, 0x143, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1d, 0xffffffff, 0x1, 0xffbab6f9, 0x13, 0xffa49ef7,
+  0x1, 0xffccc8fa, 0x74, 0xffffffff, 0x1, 0xff2f2f2f, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x12a, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1d, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffa9a4f7, 0x12, 0xffa49ef7,
+  0x1, 0xffc0bcf9, 0x144, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1d, 0xffffffff, 0x1, 0xffe8e7fd, 0x13, 0xffa49ef7,
+  0x1, 0xffeeedfd, 0x74, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000,
+  0x1, 0xe0000000, 0x12a, 0x00ffffff, 0x1, 0xd0000000, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1e, 0xffffffff, 0x1, 0xffd1cefb, 0x12, 0xffa49ef7,
+  0x1, 0xffe8e7fd, 0x144, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x1d, 0xffffffff, 0x1, 0xffbab6f9, 0x11, 0xffa49ef7,
+  0x1, 0xffbab6f9, 0x76, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0x80000000, 0x129, 0x00ffffff, 0x1, 0x90000000, 0x7, 0xff000000,
+  0x1, 0xffcfcfcf, 0x1e, 0xffffffff, 0x1, 0xffb5b0f8, 0x10, 0xffa49ef7,
+  0x1, 0xffc0bcf9, 0x145, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x1d, 0xffffffff, 0x1, 0xffeeedfd, 0x10, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xfff4f3fe, 0x77, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x8, 0xff000000, 0x1, 0x20000000, 0x128, 0x00ffffff, 0x1, 0x50000000,
+  0x7, 0xff000000, 0x1, 0xff8f8f8f, 0x1e, 0xffffffff, 0x1, 0xffeeedfd,
+  0xf, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xfff9f9fe, 0x145, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x1e, 0xffffffff,
+  0x1, 0xffd7d4fb, 0xf, 0xffa49ef7, 0x1, 0xffdddafc, 0x78, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xc0000000, 0x128, 0x00ffffff,
+  0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x1f, 0xffffffff,
+  0x1, 0xffdddafc, 0xd, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffeeedfd,
+  0x147, 0xffffffff, 0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1f, 0xffffffff, 0x1, 0xffc6c2fa, 0xd, 0xffa49ef7, 0x1, 0xffdddafc,
+  0x7a, 0xffffffff, 0x1, 0xff6f6f6f, 0x8, 0xff000000, 0x1, 0x60000000,
+  0x128, 0x00ffffff, 0x1, 0xe0000000, 0x6, 0xff000000, 0x1, 0xff0f0f0f,
+  0x20, 0xffffffff, 0x1, 0xffdddafc, 0xb, 0xffa49ef7, 0x1, 0xffb5b0f8,
+  0x1, 0xffeeedfd, 0x148, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0x1f, 0xffffffff, 0x1, 0xffc6c2fa, 0xa, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xffe2e1fc, 0x7b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x127, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf,
+  0x20, 0xffffffff, 0x1, 0xffe2e1fc, 0x1, 0xffa9a4f7, 0x8, 0xffa49ef7,
+  0x1, 0xffd1cefb, 0x1, 0xfff9f9fe, 0x149, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x20, 0xffffffff, 0x1, 0xffe2e1fc,
+  0x1, 0xffa9a4f7, 0x7, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x1, 0xfff9f9fe,
+  0x7d, 0xffffffff, 0x1, 0xffafafaf, 0x8, 0xff000000, 0x1, 0x90000000,
+  0x127, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x21, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffd7d4fb, 0x1, 0xffb5b0f8,
+  0x3, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xffd1cefb, 0x1, 0xfff4f3fe,
+  0x14b, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x21, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffdddafc, 0x1, 0xffc0bcf9,
+  0x2, 0xffbab6f9, 0x1, 0xffc0bcf9, 0x1, 0xffd7d4fb, 0x1, 0xfff4f3fe,
+  0x80, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000, 0x1, 0x30000000,
+  0x126, 0x00ffffff, 0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0x176, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0xa9, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x127, 0x00ffffff, 0x1, 0xd0000000, 0x7, 0xff000000, 0x1, 0xffefefef,
+  0x175, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xffefefef,
+  0xa9, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000, 0x1, 0x50000000,
+  0x126, 0x00ffffff, 0x1, 0x90000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0x175, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xffafafaf,
+  0xaa, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xe0000000,
+  0x126, 0x00ffffff, 0x1, 0x30000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0x175, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xff6f6f6f,
+  0xaa, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0x80000000,
+  0x126, 0x00ffffff, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffefefef,
+  0x175, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0xab, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x125, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0x175, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0xffdfdfdf,
+  0xaa, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0x90000000,
+  0x125, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0x175, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0xff8f8f8f,
+  0xab, 0xffffffff, 0x1, 0xff6f6f6f, 0x8, 0xff000000, 0x1, 0x20000000,
+  0x125, 0x00ffffff, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf,
+  0x174, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0xab, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0xa0000000, 0x125, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x175, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0xab, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0x30000000, 0x124, 0x00ffffff, 0x1, 0x30000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x175, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xff8f8f8f, 0xac, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x125, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xffafafaf, 0x174, 0xffffffff, 0x1, 0xffcfcfcf, 0x7, 0xff000000,
+  0x1, 0xff2f2f2f, 0xac, 0xffffffff, 0x1, 0xff9f9f9f, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x124, 0x00ffffff, 0x1, 0x70000000, 0x7, 0xff000000,
+  0x1, 0xff4f4f4f, 0x175, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0xffcfcfcf, 0xac, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x124, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x174, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0xac, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x124, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x174, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0xad, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x124, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x174, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x7, 0xff000000, 0x1, 0xff9f9f9f, 0xac, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x124, 0x00ffffff, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x174, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0xad, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0xc0000000, 0x124, 0x00ffffff, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x173, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0xac, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0x40000000,
+  0x124, 0x00ffffff, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x174, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xff5f5f5f,
+  0xad, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xb0000000,
+  0x124, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x173, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0xac, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0x20000000, 0x123, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x174, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0xad, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0xa0000000, 0x124, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x173, 0xffffffff,
+  0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0xac, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0x20000000,
+  0x123, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0x174, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0xad, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x124, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x173, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0xac, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000, 0x123, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x174, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xff6f6f6f,
+  0xad, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0x70000000,
+  0x124, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x173, 0xffffffff, 0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0xac, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xe0000000,
+  0x125, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffefefef, 0x173, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0xac, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f,
+  0x7, 0xff000000, 0x1, 0x50000000, 0x124, 0x00ffffff, 0x1, 0x50000000,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x173, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0xac, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xc0000000, 0x125, 0x00ffffff, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xffcfcfcf, 0x173, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0xff3f3f3f, 0xac, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x8, 0xff000000, 0x1, 0x20000000, 0x124, 0x00ffffff, 0x1, 0x30000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x173, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xff9f9f9f, 0xac, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x1, 0x90000000, 0x125, 0x00ffffff, 0x1, 0x90000000,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x173, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0xab, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xf0000000, 0x125, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000, 0x10, 0xff3f3f3f,
+  0x37, 0xff7f7f7f, 0x1, 0xff9f9f9f, 0x37, 0xffbfbfbf, 0x1, 0xffefefef,
+  0xf3, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xff6f6f6f,
+  0xac, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0x60000000,
+  0x125, 0x00ffffff, 0x1, 0x50000000, 0xbe, 0xff000000, 0x1, 0xff0f0f0f,
+  0x37, 0xff3f3f3f, 0x1, 0xff5f5f5f, 0x37, 0xff7f7f7f, 0x23, 0xffbfbfbf,
+  0x1, 0xffb3b3b3, 0x8, 0xff8f8f8f, 0x3, 0xffbfbfbf, 0x1, 0xffefefef,
+  0x1e, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0xab, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x126, 0x00ffffff, 0x1, 0xb0000000, 0x17a, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff373737, 0x1, 0xff040404, 0x7, 0xff000000, 0x1, 0xff080808,
+  0x1, 0xff3b3b3b, 0x13, 0xff3f3f3f, 0x1, 0xff5f5f5f, 0x1e, 0xff7f7f7f,
+  0x1e, 0xffbfbfbf, 0x1, 0xffcfcfcf, 0x59, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x20000000, 0x125, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x1f4, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1e, 0xff3f3f3f, 0x1d, 0xff7f7f7f, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0x90000000, 0x126, 0x00ffffff, 0x1, 0x50000000, 0x238, 0xff000000,
+  0x1, 0xf0000000, 0x127, 0x00ffffff, 0x1, 0xa0000000, 0x238, 0xff000000,
+  0x1, 0x50000000, 0x126, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x237, 0xff000000, 0x1, 0xa0000000, 0x127, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x80000000, 0x12, 0xc0000000, 0x1, 0xd0000000, 0x223, 0xff000000,
+  0x1, 0xc0000000, 0x173, 0x00ffffff, 0x1, 0x30000000, 0x37, 0x40000000,
+  0x37, 0x80000000, 0x1, 0xa0000000, 0x37, 0xc0000000, 0x145, 0xff000000,
+  0x1, 0xa0000000, 0x251, 0x00ffffff, 0x1, 0x10000000, 0x23, 0x40000000,
+  0x1, 0x58000000, 0x8, 0x70000000, 0x1, 0x64000000, 0x1, 0x40000000,
+  0x1, 0x50000000, 0x1e, 0x80000000, 0x1, 0xa0000000, 0x5, 0xc0000000,
+  0x1, 0xc8000000, 0x1, 0xe0000000, 0x1, 0xef000000, 0x1, 0xe4000000,
+  0x1, 0xd0000000, 0x14, 0xc0000000, 0x1, 0xf0000000, 0xa0, 0xff000000,
+  0x1, 0x20000000, 0x2dc, 0x00ffffff, 0x1, 0x10000000, 0x1e, 0x40000000,
+  0x1, 0x60000000, 0x1e, 0x80000000, 0x1, 0xb0000000, 0x1d, 0xc0000000,
+  0x1, 0xd0000000, 0x24, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000,
+  0x358, 0x00ffffff, 0x1, 0x20000000, 0x4, 0x40000000, 0x1, 0x20000000,
+  0x12982, 0x00ffffff,
 };
-unsigned int assets_bongo_cat_both_up_png_len = 6873;
 
-const size_t bongo_cat_both_up_png_size = 6873;
+const embedded_asset_t bongo_cat_both_up_png = {
+    .width = 864,
+    .height = 360,
+    .runs = bongo_cat_both_up_png_runs,
+    .num_runs = 4789,
+};
 
-const unsigned char bongo_cat_left_down_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x01, 0x68,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x06, 0x80, 0x68, 0xd2, 0x00, 0x00, 0x00,
-  0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x26, 0x00, 0x00, 0x80,
-  0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x80, 0xe8, 0x00, 0x00, 0x75,
-  0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17,
-  0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00, 0x01, 0x17, 0x50, 0x4c, 0x54,
-  0x45, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e,
-  0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e,
-  0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e,
-  0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0x00, 0x00,
-  0x00, 0x7f, 0x7f, 0x7f, 0x1f, 0x1f, 0x1f, 0x8f, 0x8f, 0x8f, 0xff, 0xff,
-  0xff, 0x0f, 0x0f, 0x0f, 0x5f, 0x5f, 0x5f, 0xef, 0xef, 0xef, 0x6f, 0x6f,
-  0x6f, 0x2f, 0x2f, 0x2f, 0xcf, 0xcf, 0xcf, 0x3f, 0x3f, 0x3f, 0xdf, 0xdf,
-  0xdf, 0xbf, 0xbf, 0xbf, 0x4f, 0x4f, 0x4f, 0xaf, 0xaf, 0xaf, 0x9f, 0x9f,
-  0x9f, 0x08, 0x08, 0x08, 0x68, 0x68, 0x68, 0x01, 0x01, 0x01, 0x13, 0x13,
-  0x13, 0x77, 0x77, 0x77, 0x07, 0x07, 0x07, 0x53, 0x53, 0x53, 0xfc, 0xe1,
-  0xe2, 0xf8, 0xb0, 0xb5, 0xf7, 0x9e, 0xa4, 0xf9, 0xbc, 0xc0, 0x17, 0x17,
-  0x17, 0x4d, 0x4d, 0x4d, 0xfa, 0xc8, 0xcc, 0xfa, 0xc2, 0xc6, 0xfd, 0xe7,
-  0xe8, 0xf9, 0xb6, 0xba, 0xfe, 0xf3, 0xf4, 0xfc, 0xda, 0xdd, 0xf8, 0xaa,
-  0xaf, 0x02, 0x02, 0x02, 0xfb, 0xd4, 0xd7, 0xfe, 0xf9, 0xf9, 0xf7, 0xa4,
-  0xa9, 0x40, 0x40, 0x40, 0xfd, 0xed, 0xee, 0xfb, 0xce, 0xd1, 0x09, 0x09,
-  0x09, 0x33, 0x33, 0x33, 0x15, 0x15, 0x15, 0x26, 0x26, 0x26, 0x59, 0x59,
-  0x59, 0x45, 0x45, 0x45, 0x23, 0x23, 0x23, 0x3b, 0x3b, 0x3b, 0x10, 0x10,
-  0x10, 0xb8, 0x0e, 0x28, 0x7b, 0x16, 0xd4, 0xeb, 0x00, 0x00, 0x00, 0x27,
-  0x74, 0x52, 0x4e, 0x53, 0x00, 0x20, 0x40, 0x30, 0x10, 0xb0, 0xc0, 0xa0,
-  0x60, 0xf0, 0x80, 0x50, 0xe0, 0xd0, 0x70, 0x90, 0x4c, 0xf9, 0x4a, 0xef,
-  0x82, 0xf4, 0xc4, 0xdc, 0x80, 0xe0, 0xf0, 0x40, 0xd0, 0x10, 0x90, 0x50,
-  0x20, 0xb0, 0x70, 0x30, 0xc0, 0x60, 0xa0, 0x64, 0xd2, 0xbf, 0xae, 0x00,
-  0x00, 0x00, 0x01, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x88, 0x05, 0x1d, 0x48,
-  0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12,
-  0x00, 0x00, 0x0b, 0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x00,
-  0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe9, 0x08, 0x02, 0x06, 0x17, 0x26,
-  0xb4, 0xe5, 0x1e, 0x79, 0x00, 0x00, 0x00, 0x01, 0x6f, 0x72, 0x4e, 0x54,
-  0x01, 0xcf, 0xa2, 0x77, 0x9a, 0x00, 0x00, 0x1a, 0x48, 0x49, 0x44, 0x41,
-  0x54, 0x78, 0xda, 0xed, 0x9d, 0xe9, 0x62, 0x1b, 0x37, 0x96, 0x85, 0x2d,
-  0x89, 0x12, 0x45, 0x59, 0xcb, 0xcc, 0xf4, 0x4c, 0x77, 0x6c, 0xc7, 0x89,
-  0x93, 0x76, 0x42, 0x8a, 0xfb, 0xce, 0xc4, 0x4e, 0x62, 0x2b, 0xdd, 0x8e,
-  0xe5, 0x25, 0x4e, 0xdb, 0xbd, 0x4e, 0x8f, 0xde, 0xff, 0x39, 0x86, 0x12,
-  0x0b, 0x28, 0xa0, 0x16, 0xb2, 0x76, 0x14, 0xaa, 0xbe, 0xef, 0x4f, 0x77,
-  0x64, 0x92, 0x2a, 0x15, 0x71, 0xea, 0x5e, 0x9c, 0x7b, 0x01, 0xdc, 0xbb,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x56, 0xb1, 0xb7, 0x7f, 0x60, 0xfa, 0x12, 0x00, 0xaa, 0x4a,
-  0xe3, 0xb0, 0xdd, 0x6e, 0x1f, 0xed, 0x9b, 0xbe, 0x0c, 0x80, 0x6a, 0x72,
-  0xab, 0xaf, 0x5b, 0x89, 0x11, 0xc5, 0x00, 0xb2, 0xa7, 0xd9, 0x16, 0x34,
-  0x1b, 0xa6, 0xaf, 0x05, 0xa0, 0x6a, 0x1c, 0xb7, 0x5d, 0x5a, 0x27, 0xa6,
-  0xaf, 0x06, 0xa0, 0x5a, 0xdc, 0x6f, 0x6b, 0x9c, 0x32, 0x15, 0x03, 0xc8,
-  0x8e, 0x83, 0x56, 0xdb, 0xc3, 0x21, 0x79, 0x22, 0x40, 0x46, 0x34, 0xce,
-  0xda, 0x3e, 0x5a, 0xe7, 0xa6, 0xaf, 0x0a, 0xa0, 0x22, 0x1c, 0xb6, 0x83,
-  0xc0, 0x4f, 0x04, 0xc8, 0x82, 0x13, 0xa9, 0xa9, 0xce, 0xa5, 0x26, 0x31,
-  0xcc, 0x0e, 0x80, 0xd4, 0xec, 0x4b, 0x41, 0x75, 0x7b, 0xbd, 0x6e, 0x5f,
-  0x55, 0xd8, 0x19, 0x41, 0x0c, 0x20, 0x1d, 0x0d, 0x69, 0x70, 0x0c, 0x7a,
-  0x6b, 0x86, 0x23, 0x2d, 0x88, 0x31, 0x13, 0x03, 0x48, 0xc5, 0x91, 0xd0,
-  0xd2, 0x78, 0xd8, 0xbb, 0x63, 0x32, 0xd5, 0x66, 0x62, 0x7b, 0xa6, 0x2f,
-  0x10, 0xc0, 0x62, 0xce, 0x85, 0x92, 0xfa, 0xb3, 0x9e, 0x40, 0xcb, 0x13,
-  0x5b, 0xf7, 0x4d, 0x5f, 0x22, 0x80, 0xb5, 0x1c, 0x48, 0x21, 0xcd, 0x7b,
-  0x2e, 0xc3, 0x85, 0x1a, 0xc4, 0xe8, 0x9d, 0x02, 0x48, 0x88, 0xac, 0x80,
-  0x75, 0x7a, 0x1a, 0x4b, 0x35, 0x88, 0xe1, 0x75, 0x00, 0x24, 0xe2, 0x42,
-  0x68, 0x68, 0xda, 0xf3, 0xa0, 0x05, 0xb1, 0xd6, 0xb1, 0xe9, 0x0b, 0x05,
-  0xb0, 0x10, 0xe9, 0xd0, 0xf7, 0x87, 0x3d, 0x1f, 0x5a, 0x10, 0xbb, 0x30,
-  0x7d, 0xa9, 0x00, 0xd6, 0xd1, 0x38, 0x15, 0xfa, 0x59, 0xf6, 0x02, 0x18,
-  0xaa, 0x76, 0xe2, 0x19, 0x13, 0x31, 0x80, 0x78, 0xc8, 0x16, 0x8e, 0x51,
-  0x2f, 0x98, 0xae, 0x9a, 0x26, 0x32, 0x11, 0x03, 0x88, 0x83, 0x74, 0x10,
-  0x2f, 0x87, 0x21, 0x02, 0xeb, 0x4d, 0xc6, 0x8a, 0xc4, 0x98, 0x88, 0x01,
-  0xc4, 0x40, 0x3a, 0x88, 0xf3, 0x5e, 0x28, 0xc3, 0x01, 0x13, 0x31, 0x80,
-  0x24, 0x9c, 0xef, 0x4a, 0x10, 0x37, 0xac, 0x14, 0xaf, 0x83, 0x8a, 0x18,
-  0x40, 0x44, 0x64, 0x0f, 0x62, 0x78, 0x82, 0xe8, 0xa4, 0x89, 0x4a, 0x8b,
-  0x3d, 0x56, 0x07, 0x40, 0x34, 0x9a, 0x11, 0x12, 0x44, 0xbf, 0x9b, 0x48,
-  0xcd, 0x19, 0x20, 0x0a, 0xb2, 0x04, 0xb6, 0xd8, 0xa5, 0xaf, 0x35, 0x4a,
-  0x87, 0x3d, 0x66, 0x22, 0x40, 0x04, 0x44, 0x13, 0x7d, 0x7f, 0x18, 0x41,
-  0x60, 0xbd, 0x95, 0xa2, 0x30, 0x36, 0xc4, 0x01, 0xd8, 0x85, 0xdc, 0xa6,
-  0xad, 0x1b, 0x45, 0x5f, 0xeb, 0x89, 0x98, 0x62, 0x75, 0x60, 0xd7, 0x03,
-  0xec, 0x40, 0xf4, 0x70, 0x8c, 0xa3, 0xe9, 0xab, 0xd7, 0x9b, 0x8d, 0x51,
-  0x18, 0x40, 0x44, 0x64, 0x0f, 0xc7, 0x4e, 0x87, 0xc3, 0xb5, 0x3a, 0x50,
-  0x18, 0x40, 0x34, 0xa4, 0x45, 0x1f, 0xc5, 0xe1, 0x90, 0x0c, 0x50, 0x18,
-  0x40, 0x14, 0x64, 0x00, 0x9b, 0xc5, 0x11, 0x18, 0x0a, 0x03, 0x88, 0x82,
-  0x0c, 0x60, 0xa3, 0x58, 0xfa, 0xd2, 0x9a, 0x7f, 0x51, 0x18, 0x40, 0x08,
-  0x22, 0x80, 0x45, 0xb3, 0xe8, 0x55, 0x56, 0x28, 0x0c, 0x60, 0x07, 0x32,
-  0x80, 0x75, 0xe2, 0xea, 0x0b, 0x85, 0x01, 0xec, 0x24, 0x79, 0x00, 0x43,
-  0x61, 0x00, 0xbb, 0x48, 0x13, 0xc0, 0x74, 0x85, 0xb1, 0xa1, 0x1b, 0x80,
-  0x8f, 0xf3, 0x34, 0x01, 0x4c, 0x53, 0x58, 0xeb, 0xe4, 0xe4, 0xe4, 0xfe,
-  0xbe, 0xc0, 0xf4, 0xdf, 0x55, 0x10, 0xc7, 0x27, 0x17, 0x87, 0x6c, 0xc6,
-  0x0a, 0xe1, 0x9c, 0xa6, 0x0a, 0x60, 0x7a, 0x0c, 0xf3, 0x73, 0x7a, 0xb4,
-  0xe6, 0xf0, 0xc4, 0x91, 0x5e, 0xe5, 0x56, 0xb7, 0xec, 0x9f, 0xd1, 0xf1,
-  0x0c, 0x5b, 0x39, 0x4e, 0x19, 0xc0, 0x76, 0x29, 0xcc, 0x4b, 0x6b, 0x2d,
-  0xb8, 0x8b, 0x3b, 0xb9, 0xd9, 0xaf, 0xb6, 0x03, 0xd1, 0x22, 0xdd, 0xb2,
-  0xff, 0x6f, 0x81, 0x9c, 0x10, 0x63, 0x24, 0x71, 0x00, 0x8b, 0xab, 0x30,
-  0x95, 0xbb, 0xe0, 0x76, 0x7f, 0xdf, 0xce, 0x00, 0xb0, 0xd7, 0x74, 0xff,
-  0x10, 0x4e, 0x76, 0x82, 0x60, 0xe4, 0x3a, 0xb0, 0xe4, 0x01, 0x2c, 0x8d,
-  0xc2, 0x14, 0xa9, 0x5d, 0x9c, 0x1c, 0xdb, 0xa4, 0xb4, 0xc6, 0x89, 0x7a,
-  0xf9, 0x2d, 0xd3, 0x97, 0x03, 0x25, 0x45, 0x3c, 0x85, 0x07, 0x69, 0xf4,
-  0xa5, 0x75, 0x4d, 0xa5, 0xa3, 0xb5, 0x8e, 0x69, 0xe7, 0x16, 0x08, 0xed,
-  0xc4, 0x73, 0x8c, 0x35, 0x35, 0x0a, 0x08, 0xa2, 0x21, 0x06, 0x48, 0xbc,
-  0x2e, 0xc4, 0x1c, 0x15, 0xe6, 0x70, 0x7a, 0xd4, 0x5c, 0xe7, 0x8e, 0xa6,
-  0x6f, 0x4f, 0x18, 0xc7, 0xa7, 0xbe, 0xeb, 0x35, 0x7d, 0x49, 0x50, 0x4a,
-  0x84, 0x47, 0x3f, 0x4d, 0xa9, 0xaf, 0x5e, 0xaf, 0xd3, 0x8f, 0x29, 0xa1,
-  0x88, 0x01, 0xed, 0xe2, 0xa4, 0x74, 0xf1, 0x6c, 0x3f, 0xe0, 0x90, 0xf8,
-  0x76, 0x69, 0x1f, 0x06, 0x60, 0x12, 0xf1, 0x24, 0x5e, 0xa6, 0x16, 0x98,
-  0xc3, 0x5c, 0xb0, 0xec, 0xdc, 0x31, 0xbd, 0x25, 0xb5, 0xf6, 0xce, 0x0e,
-  0xcb, 0x13, 0xce, 0xa4, 0x75, 0xa8, 0xd3, 0x34, 0x7d, 0x5d, 0x50, 0x42,
-  0x84, 0xc5, 0x71, 0x99, 0x95, 0xbe, 0xc2, 0x19, 0x3a, 0xa2, 0x5b, 0x4c,
-  0xa7, 0xe3, 0xe8, 0xca, 0xd2, 0xd3, 0xb0, 0xb5, 0xcc, 0x4c, 0x47, 0x33,
-  0xd5, 0x3a, 0xbc, 0x65, 0xbc, 0x12, 0xff, 0x0f, 0xa7, 0x1e, 0xbc, 0x1c,
-  0xa7, 0xeb, 0x92, 0x4a, 0x27, 0xb7, 0xb5, 0xda, 0x06, 0x49, 0x82, 0xdb,
-  0x59, 0xf3, 0xc4, 0x58, 0x09, 0x4d, 0xb7, 0x0e, 0xd7, 0x0f, 0xa6, 0x55,
-  0xaf, 0x27, 0xce, 0x75, 0xe2, 0xf8, 0x6a, 0xd0, 0xd9, 0x77, 0x67, 0xea,
-  0x69, 0x2d, 0x8e, 0x94, 0x5a, 0xbb, 0x95, 0x5a, 0xbc, 0xb0, 0xd6, 0x3a,
-  0x3a, 0xb9, 0x5f, 0x7c, 0x83, 0x92, 0xc7, 0x3a, 0xec, 0xdf, 0x3d, 0x97,
-  0x96, 0x22, 0xbe, 0x9a, 0xfe, 0x3e, 0xa1, 0x54, 0xa8, 0x53, 0x89, 0x58,
-  0x3b, 0x05, 0xe4, 0xc7, 0xad, 0xd2, 0xa6, 0xd3, 0xe8, 0x2a, 0x6b, 0x1f,
-  0x5d, 0x1c, 0x17, 0x98, 0x32, 0x7a, 0xad, 0xc3, 0x8e, 0x53, 0x3a, 0x14,
-  0x3b, 0x1d, 0x9b, 0xce, 0x5e, 0xa1, 0x44, 0x34, 0x2e, 0xd4, 0xa1, 0xb2,
-  0x32, 0x2d, 0x2d, 0x9f, 0xd0, 0x46, 0xd1, 0x23, 0x5a, 0x41, 0xb1, 0xcc,
-  0x6b, 0x1d, 0x0e, 0x64, 0xd4, 0xef, 0x38, 0x3f, 0xe1, 0x2c, 0x0c, 0x10,
-  0x9c, 0x6b, 0xb9, 0x4e, 0x7a, 0x8f, 0x3e, 0x17, 0x66, 0xf3, 0x6e, 0x67,
-  0x7a, 0x19, 0x49, 0x64, 0xad, 0xc3, 0x9c, 0xe7, 0x65, 0x8d, 0x43, 0xfd,
-  0x17, 0x4e, 0x27, 0xca, 0x75, 0x8a, 0x8b, 0x30, 0xfd, 0xad, 0x42, 0x49,
-  0xf0, 0x3c, 0x8c, 0xc7, 0xa9, 0xba, 0xa4, 0x72, 0x67, 0xb2, 0x5c, 0xcf,
-  0xd0, 0xa2, 0xa8, 0xec, 0xac, 0x99, 0x5b, 0xc2, 0x78, 0xa0, 0x67, 0x87,
-  0x63, 0x7d, 0x77, 0x3b, 0x71, 0x75, 0xac, 0x87, 0x83, 0x7b, 0xbe, 0x87,
-  0x71, 0xbf, 0x53, 0x6e, 0x7d, 0x39, 0xcc, 0xe6, 0x91, 0x64, 0x76, 0x1b,
-  0xca, 0xb2, 0xbf, 0x65, 0xc7, 0xda, 0xef, 0xb8, 0xf4, 0x66, 0xd4, 0x2b,
-  0xe7, 0x1f, 0x28, 0x85, 0x81, 0x37, 0x3b, 0x6c, 0x0f, 0xac, 0x90, 0x97,
-  0x22, 0xb3, 0xc5, 0xee, 0xc9, 0xd9, 0xd1, 0xc5, 0xfd, 0x2c, 0xf3, 0xc5,
-  0x46, 0x53, 0x7f, 0x20, 0xf9, 0xae, 0x6a, 0x48, 0x8e, 0x08, 0x0e, 0x9e,
-  0xec, 0x70, 0x6a, 0xd2, 0x9f, 0x4f, 0xcc, 0x7c, 0x35, 0xda, 0x19, 0xcc,
-  0xce, 0x32, 0x13, 0xd9, 0x81, 0x76, 0xcb, 0x02, 0xe3, 0xbd, 0x28, 0x85,
-  0x95, 0xa5, 0xd9, 0x04, 0x0c, 0xa1, 0x7b, 0x87, 0xed, 0xcb, 0xe8, 0x1b,
-  0x65, 0x97, 0x8f, 0xf5, 0xd4, 0x6c, 0x57, 0x95, 0x3a, 0x13, 0x91, 0x1d,
-  0xab, 0x11, 0x7f, 0x10, 0xfc, 0x40, 0x12, 0x39, 0x22, 0x3e, 0x62, 0xbd,
-  0xb9, 0xaf, 0x65, 0x87, 0xfd, 0x88, 0x07, 0xa9, 0x94, 0x99, 0xd9, 0x5a,
-  0x65, 0xf9, 0x8a, 0x4c, 0x7d, 0x24, 0x8d, 0x27, 0x21, 0x97, 0x21, 0x72,
-  0x44, 0x6a, 0xcd, 0x75, 0x66, 0x4f, 0x37, 0x37, 0xec, 0x9a, 0x7c, 0x6d,
-  0x63, 0xb2, 0x1a, 0x6d, 0x9f, 0x97, 0x1d, 0x25, 0x36, 0x3e, 0xf6, 0xd4,
-  0xf4, 0x70, 0xcb, 0xbe, 0xc7, 0x22, 0x47, 0x64, 0xf7, 0x9b, 0xfa, 0xe2,
-  0x29, 0x7d, 0xd9, 0x9c, 0x1d, 0x06, 0x31, 0xef, 0x2e, 0xb6, 0x95, 0xcc,
-  0x5a, 0x87, 0xe7, 0x09, 0x06, 0xbf, 0x1a, 0xf2, 0xfb, 0xdb, 0xaa, 0xf1,
-  0x62, 0x0f, 0x71, 0xfa, 0x11, 0xeb, 0xca, 0x9e, 0xb6, 0xc6, 0xa2, 0x0a,
-  0xd9, 0x61, 0x00, 0xb3, 0xed, 0xa1, 0xec, 0xb4, 0x19, 0x33, 0x5b, 0x54,
-  0x3b, 0x7b, 0x43, 0xd3, 0xc3, 0xcd, 0x6f, 0x76, 0x5e, 0x75, 0x68, 0xfa,
-  0x7b, 0x06, 0x33, 0xe8, 0xe1, 0xab, 0x3a, 0xd9, 0xa1, 0x9f, 0xe1, 0x7c,
-  0xeb, 0xac, 0xec, 0xe8, 0x3c, 0x72, 0x2d, 0xba, 0x71, 0x14, 0xe3, 0x96,
-  0x39, 0xd1, 0x13, 0xa3, 0xbe, 0x96, 0xe8, 0xe1, 0xcb, 0x6a, 0xef, 0x30,
-  0x1a, 0xf3, 0xce, 0x22, 0xdc, 0x60, 0x8c, 0x18, 0xc8, 0xf6, 0xd5, 0x67,
-  0xd2, 0xce, 0x66, 0x4d, 0x71, 0x2c, 0x3c, 0x0d, 0xbf, 0x35, 0x44, 0x0f,
-  0x5f, 0x85, 0x2f, 0xfd, 0x32, 0xc4, 0xa4, 0xbb, 0x45, 0x64, 0xbb, 0x67,
-  0x64, 0xe7, 0xca, 0xab, 0x2f, 0x27, 0x3b, 0x7f, 0x9b, 0x58, 0xb3, 0xc2,
-  0x24, 0xac, 0x76, 0xe8, 0x9d, 0x51, 0x76, 0x56, 0x96, 0x93, 0x32, 0xe9,
-  0x86, 0xa7, 0x8b, 0x67, 0x17, 0x07, 0x11, 0x6f, 0xda, 0x22, 0x42, 0x46,
-  0x2d, 0x8c, 0x7a, 0x26, 0x61, 0x75, 0x43, 0xab, 0x7d, 0x55, 0xd4, 0xdc,
-  0xd8, 0xca, 0xbc, 0x13, 0x6a, 0x7c, 0xac, 0x93, 0xc5, 0xe0, 0x9b, 0xa6,
-  0xf5, 0xf6, 0x46, 0xbb, 0x67, 0x63, 0x26, 0x61, 0x75, 0x44, 0x6f, 0xdd,
-  0xa8, 0x57, 0xf8, 0x72, 0x19, 0x2e, 0x47, 0x61, 0x16, 0x7e, 0xab, 0x79,
-  0xec, 0x9f, 0x90, 0xa9, 0xbd, 0xbd, 0xfd, 0x88, 0x33, 0x56, 0xb1, 0x6d,
-  0x1d, 0x95, 0xb0, 0x3a, 0xa1, 0x3d, 0x89, 0xeb, 0x18, 0xbe, 0x5c, 0x66,
-  0xe1, 0x53, 0xb2, 0x43, 0x5d, 0x63, 0x5a, 0x6f, 0xef, 0x34, 0xaa, 0xe1,
-  0xba, 0x72, 0xde, 0xc0, 0x92, 0x95, 0x1a, 0xa1, 0x4e, 0xd4, 0x6b, 0x1b,
-  0xbe, 0x14, 0xe6, 0xa1, 0x65, 0x32, 0x45, 0x63, 0x5a, 0x6f, 0x6f, 0x74,
-  0x47, 0x68, 0xe2, 0xbc, 0x83, 0x4d, 0xea, 0x6b, 0x83, 0x56, 0xc7, 0xa9,
-  0x77, 0xf8, 0x72, 0x99, 0xad, 0xc2, 0x02, 0xd9, 0xd9, 0xc6, 0x58, 0x54,
-  0x7b, 0x7b, 0xfb, 0x71, 0x76, 0x8b, 0x74, 0xde, 0x73, 0x64, 0xfa, 0x6b,
-  0x87, 0x82, 0xd0, 0xea, 0x38, 0x84, 0x2f, 0x85, 0xd0, 0x19, 0xd9, 0x3a,
-  0x8e, 0x69, 0xbd, 0xbd, 0xb1, 0x6e, 0x9a, 0xe3, 0x57, 0xd2, 0xef, 0x5b,
-  0x13, 0xb4, 0x0d, 0xfc, 0x08, 0x5f, 0x1e, 0x26, 0xdd, 0xdd, 0xcb, 0x36,
-  0x47, 0xf1, 0x3e, 0x52, 0xb8, 0x1c, 0xa6, 0xbf, 0x78, 0x28, 0x02, 0x2d,
-  0x3d, 0x1c, 0xef, 0xae, 0x93, 0xd6, 0x90, 0xe1, 0x6a, 0xb1, 0x4d, 0x5e,
-  0xfd, 0xb8, 0x3b, 0x6d, 0x89, 0xbd, 0xa5, 0x58, 0x74, 0x59, 0x03, 0xb4,
-  0xf4, 0x70, 0x54, 0xe1, 0xce, 0xc3, 0x74, 0x0c, 0x97, 0x83, 0x30, 0x67,
-  0x31, 0xfe, 0x43, 0x69, 0x8e, 0x8d, 0x58, 0x1b, 0x54, 0xf7, 0x30, 0xd6,
-  0x44, 0xbd, 0x86, 0x2c, 0x07, 0x41, 0x13, 0xb2, 0x04, 0xed, 0xd0, 0xa2,
-  0xa1, 0x1e, 0x1b, 0xb1, 0xea, 0x68, 0x6d, 0x3e, 0x91, 0xeb, 0x38, 0x35,
-  0x66, 0xe2, 0x33, 0x3d, 0x12, 0x6d, 0xc4, 0xea, 0xbc, 0x97, 0x6d, 0x03,
-  0x2a, 0x4e, 0xc2, 0x3a, 0x4e, 0xbd, 0xd1, 0x34, 0x16, 0xa1, 0xb7, 0x37,
-  0x88, 0x4b, 0x7c, 0xfa, 0x3a, 0xa0, 0x2d, 0xc2, 0xad, 0xfe, 0xc2, 0x94,
-  0xec, 0x90, 0x1a, 0x8b, 0xd2, 0xdb, 0x1b, 0xc4, 0x14, 0x81, 0xd5, 0x80,
-  0x13, 0xd2, 0xc3, 0xe4, 0x4c, 0x06, 0xfd, 0xf6, 0x65, 0xe2, 0x92, 0x06,
-  0x3e, 0x7d, 0xf5, 0xd1, 0xa6, 0x5f, 0xa4, 0x87, 0xc5, 0xd2, 0x41, 0x60,
-  0x55, 0x47, 0x9d, 0x7e, 0x91, 0x1e, 0x16, 0x8d, 0x10, 0x18, 0x27, 0x5d,
-  0x56, 0x15, 0xb5, 0xfa, 0x15, 0xaf, 0xcd, 0x07, 0x32, 0x60, 0x45, 0xa5,
-  0xb9, 0xda, 0xa8, 0xab, 0x98, 0xaa, 0xbc, 0xad, 0x4d, 0x59, 0x99, 0x23,
-  0xb0, 0x4a, 0xa3, 0xb6, 0xa9, 0x96, 0xec, 0x40, 0xbd, 0x7a, 0x80, 0xc0,
-  0xaa, 0x8c, 0x6a, 0x6f, 0xf4, 0xe9, 0x3d, 0x34, 0x01, 0x02, 0xab, 0x30,
-  0x0d, 0xc5, 0xde, 0x28, 0xf9, 0x79, 0x7a, 0x95, 0x05, 0x81, 0x55, 0x17,
-  0x75, 0x6b, 0x00, 0xa6, 0x5f, 0x86, 0xa0, 0xdb, 0xb7, 0xb2, 0x1c, 0x28,
-  0xf6, 0x21, 0xd5, 0x2f, 0x63, 0xd0, 0xed, 0x5b, 0x51, 0x14, 0xfb, 0x30,
-  0xf6, 0x2a, 0x26, 0xc8, 0x0e, 0x04, 0x56, 0x4d, 0x54, 0x7d, 0x61, 0x6f,
-  0x98, 0x43, 0x6c, 0x7b, 0x73, 0x6c, 0x7a, 0x40, 0x40, 0xa6, 0x28, 0xf6,
-  0x3c, 0xd5, 0x65, 0x93, 0x60, 0x72, 0x54, 0x92, 0x26, 0xcd, 0xbd, 0x25,
-  0x01, 0x81, 0x55, 0x10, 0x75, 0x93, 0xcc, 0x81, 0xe9, 0x11, 0x56, 0x73,
-  0x10, 0x58, 0xf5, 0x50, 0xcb, 0x5f, 0xd8, 0x87, 0x86, 0x41, 0x60, 0x95,
-  0x43, 0xd5, 0x17, 0xf6, 0xa1, 0x69, 0x10, 0x58, 0xd5, 0x50, 0xf4, 0x85,
-  0x3d, 0x6f, 0x1e, 0xba, 0xe9, 0x2b, 0x86, 0xaa, 0x2f, 0xec, 0x79, 0xf3,
-  0xb0, 0xe0, 0xb2, 0x5a, 0x1c, 0xa0, 0xaf, 0x72, 0x81, 0xc0, 0x2a, 0x85,
-  0xd2, 0x1e, 0x45, 0xf9, 0xab, 0x14, 0x20, 0xb0, 0x2a, 0xa1, 0xea, 0x8b,
-  0xf2, 0x57, 0x29, 0x70, 0x76, 0xe2, 0xe6, 0x8c, 0xcb, 0x2a, 0x80, 0xbe,
-  0xca, 0x07, 0xdb, 0xb6, 0x55, 0x07, 0xf4, 0x55, 0x42, 0x10, 0x58, 0x65,
-  0x50, 0xf4, 0x45, 0x7b, 0x54, 0x69, 0x18, 0x23, 0xb0, 0x8a, 0xa0, 0xe8,
-  0x8b, 0xf6, 0xa8, 0xf2, 0xe0, 0x7c, 0x25, 0xec, 0x4d, 0x6f, 0x3b, 0xe8,
-  0xab, 0x9c, 0xb0, 0x1c, 0xac, 0x1a, 0x28, 0xf5, 0x65, 0xf4, 0x55, 0x26,
-  0x10, 0x58, 0x25, 0x40, 0x5f, 0x25, 0x45, 0xac, 0xb7, 0x3c, 0x37, 0x3d,
-  0x42, 0x20, 0x0d, 0xe8, 0xab, 0xac, 0xd0, 0xeb, 0x5b, 0x05, 0xd0, 0x57,
-  0x69, 0x41, 0x60, 0x55, 0xe0, 0x08, 0x7d, 0x95, 0x15, 0x04, 0x56, 0x01,
-  0xdc, 0xf5, 0xcb, 0xd4, 0x97, 0xcb, 0x46, 0xd7, 0xf9, 0x66, 0xf6, 0x4c,
-  0x0f, 0x12, 0x48, 0x0c, 0xfa, 0x2a, 0x31, 0xf4, 0xfa, 0x5a, 0xcf, 0x09,
-  0xfa, 0x2a, 0x31, 0x08, 0xcc, 0x76, 0x8e, 0xd1, 0x57, 0x99, 0x41, 0x60,
-  0x96, 0xe3, 0xea, 0xeb, 0x12, 0x7d, 0x95, 0x10, 0x04, 0x66, 0x37, 0x6e,
-  0x83, 0x14, 0xeb, 0x97, 0x4b, 0x89, 0xd3, 0x4c, 0x7f, 0x66, 0x7a, 0xa0,
-  0x40, 0x22, 0xd0, 0x57, 0xd9, 0x61, 0xb5, 0x8a, 0xcd, 0x28, 0x05, 0x66,
-  0xf4, 0x55, 0x4e, 0x10, 0x98, 0xc5, 0x28, 0xfa, 0x62, 0x7f, 0xb6, 0x92,
-  0x82, 0xc0, 0x2c, 0xa6, 0x89, 0xbe, 0x4a, 0x0f, 0x02, 0xb3, 0x17, 0xb7,
-  0x00, 0x36, 0x32, 0x3d, 0x8c, 0x20, 0x0c, 0x04, 0x66, 0x2d, 0xae, 0x41,
-  0x4f, 0x03, 0x62, 0x79, 0xe9, 0x6f, 0xbe, 0xa2, 0x43, 0xd3, 0xa3, 0x05,
-  0xe2, 0x72, 0xe0, 0x16, 0x98, 0x4d, 0x0f, 0x22, 0x08, 0x87, 0xf5, 0x96,
-  0x96, 0xb2, 0x27, 0x0d, 0x7a, 0x1a, 0x38, 0xca, 0x0c, 0x02, 0xb3, 0x13,
-  0xd7, 0x40, 0xa4, 0x00, 0x56, 0x6a, 0x10, 0x98, 0x9d, 0xb8, 0x06, 0x22,
-  0xfa, 0x2a, 0x35, 0x08, 0xcc, 0x4a, 0x5c, 0x03, 0x11, 0x83, 0xbe, 0xdc,
-  0x20, 0x30, 0x1b, 0xb9, 0x8f, 0x41, 0x6f, 0x0b, 0x08, 0xcc, 0x42, 0x5c,
-  0x83, 0x63, 0x61, 0x7a, 0xfc, 0xc0, 0x0e, 0x10, 0x98, 0x7d, 0xb8, 0x06,
-  0x07, 0x06, 0x62, 0xe9, 0x41, 0x60, 0xf6, 0x21, 0x0d, 0x8e, 0x3e, 0x27,
-  0x80, 0x95, 0x1e, 0x04, 0x66, 0x1d, 0xe7, 0x72, 0x02, 0x36, 0x37, 0x3d,
-  0x7a, 0x60, 0x27, 0x08, 0xcc, 0x36, 0xdc, 0x0e, 0x8e, 0xae, 0xe9, 0xc1,
-  0x03, 0xbb, 0x41, 0x60, 0x96, 0xd1, 0x38, 0xa5, 0x03, 0xd1, 0x26, 0x10,
-  0x98, 0x65, 0x1c, 0x61, 0x70, 0x58, 0x05, 0x02, 0xb3, 0x0b, 0x59, 0x61,
-  0xa6, 0x43, 0xca, 0x0e, 0x10, 0x98, 0x55, 0xec, 0xcb, 0x09, 0xd8, 0xd2,
-  0xf4, 0xc8, 0x81, 0x48, 0x20, 0x30, 0x9b, 0x70, 0x27, 0x60, 0x74, 0x70,
-  0x58, 0x02, 0x02, 0xb3, 0x89, 0x43, 0x96, 0x80, 0xd9, 0x06, 0x02, 0xb3,
-  0x08, 0x59, 0x01, 0xeb, 0x63, 0x70, 0xd8, 0x02, 0x02, 0xb3, 0x07, 0xb7,
-  0x02, 0x46, 0x85, 0xd9, 0x1a, 0x10, 0x98, 0x35, 0xb8, 0x2d, 0x88, 0x4c,
-  0xc0, 0x32, 0x66, 0x38, 0x9f, 0x77, 0x3b, 0x6b, 0xba, 0xf3, 0x79, 0xd6,
-  0xb9, 0x01, 0x02, 0xb3, 0x86, 0x0b, 0x26, 0x60, 0x39, 0x30, 0xe9, 0x0e,
-  0xa6, 0x6d, 0x95, 0xfe, 0x74, 0xb4, 0xcc, 0x50, 0x65, 0x08, 0xcc, 0x16,
-  0xa4, 0x43, 0x4f, 0x8b, 0x6f, 0x66, 0x2c, 0x07, 0x97, 0xed, 0x40, 0xc6,
-  0x9d, 0xac, 0xca, 0x8c, 0x08, 0xcc, 0x12, 0x1a, 0x72, 0x0d, 0x18, 0x15,
-  0xb0, 0x6c, 0x98, 0x0c, 0xfa, 0xed, 0x2d, 0x5c, 0x76, 0x33, 0x89, 0x63,
-  0x08, 0xcc, 0x12, 0xa4, 0x43, 0x4f, 0x0b, 0x62, 0x26, 0xcc, 0xa7, 0xed,
-  0x9d, 0x0c, 0x32, 0xc8, 0x15, 0x10, 0x98, 0x1d, 0xc8, 0x5d, 0x46, 0x39,
-  0x05, 0x2c, 0x0b, 0xa2, 0xc8, 0x2b, 0x1b, 0x89, 0x21, 0x30, 0x2b, 0x70,
-  0x37, 0x09, 0xa0, 0x05, 0x31, 0x3d, 0xb3, 0x45, 0x34, 0x79, 0xdd, 0x49,
-  0x2c, 0xe5, 0x03, 0x0d, 0x81, 0x59, 0x81, 0xec, 0xa1, 0xef, 0x98, 0x1e,
-  0x9c, 0x15, 0xa0, 0xdb, 0x8f, 0xae, 0xaf, 0x76, 0xbb, 0x9f, 0x6e, 0xdf,
-  0x2e, 0xe7, 0x53, 0x2e, 0x4c, 0x8f, 0x20, 0xd8, 0x86, 0x6c, 0xe1, 0x98,
-  0x9a, 0x1e, 0x9c, 0xf6, 0x33, 0xf4, 0x65, 0x87, 0x97, 0x8b, 0xce, 0x72,
-  0x7e, 0x97, 0x19, 0x4c, 0xe6, 0xab, 0x8e, 0x3f, 0x79, 0x5c, 0xa4, 0x09,
-  0x62, 0xe3, 0xcd, 0x67, 0x70, 0xf8, 0x43, 0x99, 0x91, 0x09, 0x22, 0x0e,
-  0x7d, 0x6a, 0x26, 0x9e, 0xf0, 0xb5, 0x58, 0xf9, 0xee, 0xe9, 0xa4, 0x33,
-  0xf6, 0x04, 0xb1, 0x14, 0x79, 0x39, 0xa7, 0xab, 0x58, 0x80, 0x4c, 0x10,
-  0xd9, 0x24, 0x20, 0x2d, 0x2b, 0x4d, 0x39, 0xd3, 0x55, 0x48, 0x70, 0x9a,
-  0x75, 0xf4, 0x02, 0x59, 0xf2, 0x34, 0x11, 0x81, 0x95, 0x1f, 0x12, 0xc4,
-  0xcc, 0xd0, 0xf4, 0x35, 0xdd, 0xda, 0xd2, 0xb9, 0xd2, 0x72, 0xc5, 0xc4,
-  0x8f, 0x36, 0x04, 0x56, 0x7a, 0x48, 0x10, 0x33, 0x63, 0x15, 0x59, 0x5e,
-  0xb7, 0xcc, 0xd5, 0x28, 0x96, 0xb4, 0xfc, 0x28, 0x64, 0x7a, 0x6c, 0x7a,
-  0x18, 0x41, 0x18, 0x87, 0xa9, 0x9f, 0xa2, 0xb0, 0x41, 0xd1, 0x57, 0x3f,
-  0xd2, 0xcd, 0x54, 0xfd, 0xc6, 0x84, 0x77, 0x5f, 0xc6, 0xc1, 0xa6, 0xe9,
-  0x71, 0x04, 0xc1, 0xc8, 0x7d, 0xe8, 0x49, 0x10, 0x53, 0xa2, 0xe8, 0x6b,
-  0x1a, 0x31, 0x19, 0x98, 0x29, 0x79, 0x62, 0xb2, 0x79, 0xd8, 0x40, 0xbe,
-  0xff, 0xa8, 0x61, 0x7a, 0x28, 0x41, 0x00, 0x0d, 0x12, 0xc4, 0x8c, 0x50,
-  0xfc, 0xc3, 0x18, 0xeb, 0x7d, 0x3a, 0x29, 0x15, 0xa6, 0xa8, 0xfa, 0x6c,
-  0xcf, 0xf4, 0x60, 0x02, 0x3f, 0x4d, 0x12, 0xc4, 0x6c, 0x18, 0x5e, 0x26,
-  0x53, 0x8a, 0xa2, 0x90, 0x44, 0xeb, 0x5c, 0xdd, 0x10, 0xd6, 0x6e, 0x1d,
-  0x98, 0x1e, 0x4d, 0xe0, 0xe5, 0x3f, 0x48, 0x10, 0x33, 0x62, 0x91, 0x34,
-  0x12, 0xcd, 0x65, 0xe4, 0x4b, 0x56, 0x0f, 0x53, 0x62, 0x60, 0xeb, 0xbe,
-  0xe9, 0xf1, 0x04, 0x3a, 0x8d, 0xff, 0x24, 0x41, 0xcc, 0x86, 0x6e, 0xf2,
-  0x4c, 0x6f, 0xde, 0x4e, 0xa7, 0xb0, 0x95, 0x62, 0x95, 0x60, 0x26, 0x96,
-  0x0b, 0x7a, 0x10, 0x33, 0x62, 0xd6, 0x4f, 0xac, 0x2f, 0x35, 0x4b, 0x4c,
-  0xa6, 0x30, 0xb5, 0x7b, 0xe4, 0xdc, 0xf4, 0x90, 0x02, 0x85, 0xff, 0x12,
-  0x5f, 0x0b, 0xbb, 0x04, 0xa4, 0x44, 0x26, 0x88, 0x89, 0xf6, 0x33, 0x49,
-  0xab, 0xb0, 0xa1, 0xd2, 0x7b, 0x85, 0x5d, 0x5f, 0x22, 0x7e, 0xe7, 0x7c,
-  0x29, 0xdf, 0x15, 0xb0, 0x8d, 0xd4, 0x64, 0x34, 0x5e, 0xf3, 0x7d, 0xb7,
-  0x92, 0xeb, 0x61, 0xe6, 0x29, 0x9f, 0x54, 0xdd, 0xb4, 0x0a, 0x5b, 0xa0,
-  0xb0, 0x12, 0xf2, 0xdf, 0xc5, 0x39, 0x88, 0x13, 0xf1, 0x8c, 0x7d, 0xd6,
-  0x7e, 0xfe, 0x43, 0xf5, 0xd6, 0x74, 0x0a, 0x07, 0x31, 0xf1, 0x54, 0x76,
-  0x90, 0x52, 0x61, 0xaa, 0x99, 0x88, 0xc2, 0x4a, 0x42, 0xe3, 0x7f, 0x9c,
-  0x6f, 0x24, 0xff, 0x55, 0xcc, 0xab, 0x1f, 0xdd, 0xef, 0xbf, 0xfd, 0xec,
-  0xc7, 0xaa, 0x95, 0x04, 0x56, 0xe9, 0x9f, 0x54, 0x8a, 0xc2, 0x92, 0x55,
-  0x9c, 0xd5, 0x82, 0x18, 0x25, 0xe7, 0x52, 0x20, 0x7b, 0xa4, 0x72, 0x4f,
-  0x10, 0x27, 0xaa, 0xbe, 0x6e, 0xf9, 0x29, 0xef, 0xdf, 0x58, 0x2c, 0x22,
-  0x80, 0xa9, 0xb5, 0x8e, 0x17, 0x2f, 0xaf, 0xae, 0xae, 0x7e, 0x7e, 0x11,
-  0xf9, 0x33, 0x94, 0x10, 0x84, 0xc2, 0x2a, 0x81, 0xdc, 0xa7, 0x6d, 0x91,
-  0xfb, 0x00, 0xfc, 0x93, 0x47, 0x5f, 0xed, 0x67, 0x7f, 0xce, 0xfd, 0x77,
-  0x16, 0x88, 0x1c, 0xda, 0x4a, 0x76, 0xf7, 0xea, 0x6a, 0xc3, 0x2f, 0x91,
-  0x3f, 0x45, 0x51, 0x58, 0x32, 0x4f, 0xd7, 0x2d, 0xa8, 0xa1, 0xb0, 0x32,
-  0x20, 0x4e, 0x52, 0xc9, 0x7f, 0x23, 0xfa, 0x55, 0xdb, 0xcf, 0x0f, 0x79,
-  0xff, 0xd2, 0x02, 0x11, 0x0d, 0x85, 0x4a, 0x47, 0xfc, 0xeb, 0x2b, 0xc1,
-  0xab, 0x80, 0x37, 0xbc, 0x78, 0x75, 0x7d, 0xfd, 0xca, 0x17, 0xdc, 0x14,
-  0x85, 0x25, 0xeb, 0xad, 0x9f, 0xa0, 0xb0, 0x12, 0x21, 0x8f, 0xda, 0xcb,
-  0x7f, 0x42, 0xf4, 0x3c, 0x40, 0x60, 0x3f, 0x56, 0xa7, 0xb2, 0x3d, 0x11,
-  0x7f, 0x93, 0xf2, 0x27, 0xfd, 0x22, 0x05, 0x76, 0xf5, 0xc6, 0xfb, 0xfa,
-  0xb7, 0xef, 0x36, 0xff, 0xf0, 0xee, 0xb5, 0xe7, 0x1f, 0x14, 0x85, 0x4d,
-  0x13, 0x3d, 0xf5, 0x50, 0x58, 0x79, 0xd8, 0x93, 0x5f, 0x65, 0xee, 0x03,
-  0x70, 0x19, 0xa0, 0xaf, 0xf6, 0xfb, 0xef, 0x73, 0xff, 0xbd, 0x45, 0x21,
-  0x74, 0xa1, 0x86, 0x9d, 0x77, 0xae, 0xc0, 0x7e, 0xd5, 0x5f, 0xfd, 0xe1,
-  0x67, 0xf7, 0x9f, 0xde, 0x7a, 0x3e, 0x69, 0xe4, 0xde, 0x9f, 0x71, 0xb2,
-  0x92, 0xf3, 0x18, 0x85, 0x95, 0x04, 0xd9, 0xc3, 0x91, 0x7f, 0x5d, 0xea,
-  0xa7, 0x20, 0x81, 0xb5, 0x9f, 0xe7, 0xfe, 0x7b, 0x0b, 0x62, 0x18, 0x10,
-  0xc0, 0x7a, 0xae, 0x88, 0xae, 0x7e, 0xd6, 0x5f, 0xfe, 0x52, 0xf9, 0xa7,
-  0xdf, 0xbc, 0x9f, 0xa5, 0x24, 0xd3, 0xfd, 0x44, 0x3b, 0x2c, 0x0f, 0x51,
-  0x58, 0x39, 0x90, 0xab, 0xc0, 0x0a, 0x38, 0x49, 0xe5, 0xbb, 0x40, 0x81,
-  0xb5, 0xab, 0x92, 0x23, 0x0a, 0x51, 0x68, 0xa9, 0xc0, 0x6f, 0xae, 0x8a,
-  0xae, 0xb5, 0x57, 0xbf, 0xba, 0x52, 0x79, 0x1d, 0xf6, 0x61, 0x89, 0xad,
-  0x0e, 0x14, 0x56, 0x0a, 0xe4, 0x59, 0xb1, 0x05, 0x6c, 0xe4, 0x3b, 0x09,
-  0xd6, 0x57, 0x65, 0x0e, 0x21, 0x13, 0x23, 0x5a, 0x33, 0xd7, 0xaf, 0x5d,
-  0x11, 0x69, 0x2e, 0xc7, 0xeb, 0xab, 0xed, 0x02, 0xd3, 0xfa, 0x0a, 0x13,
-  0x59, 0x1d, 0xaa, 0xc2, 0x4c, 0x0f, 0xb3, 0xfa, 0x22, 0x1d, 0x8e, 0x02,
-  0x4e, 0x7a, 0xe8, 0xbe, 0xcf, 0x41, 0x60, 0xf3, 0xc5, 0xb4, 0x53, 0x8e,
-  0x86, 0x90, 0x99, 0x48, 0xe9, 0xb4, 0x9f, 0xfe, 0xea, 0x8a, 0x48, 0x73,
-  0x0b, 0x7f, 0xd1, 0x05, 0xf6, 0xc6, 0xff, 0x79, 0x13, 0x65, 0xa7, 0x8e,
-  0x44, 0x05, 0x31, 0x45, 0x61, 0xf4, 0x74, 0x18, 0xa2, 0x40, 0x87, 0x43,
-  0x5b, 0xaf, 0x14, 0x5d, 0x60, 0x93, 0xed, 0x27, 0xd5, 0xdd, 0x65, 0x52,
-  0xe5, 0xe8, 0x50, 0x16, 0x6d, 0x84, 0x7a, 0xae, 0xfd, 0x41, 0xe6, 0x88,
-  0x2f, 0xb5, 0x9f, 0x5f, 0x6b, 0xfa, 0x0a, 0x2c, 0x92, 0x29, 0x02, 0x49,
-  0xe6, 0xd6, 0xa3, 0x30, 0xe3, 0x48, 0x87, 0xa3, 0x88, 0x79, 0xd0, 0x5f,
-  0xe2, 0x0b, 0xec, 0x76, 0x77, 0xdc, 0x6d, 0x1d, 0x43, 0x4e, 0x1e, 0x55,
-  0x8a, 0x83, 0x96, 0xc4, 0x68, 0xf6, 0x98, 0x45, 0x1f, 0x1d, 0x85, 0xbd,
-  0xfc, 0xa0, 0xfd, 0x58, 0x13, 0xd8, 0x6f, 0x6f, 0x82, 0x3f, 0x52, 0xda,
-  0xf5, 0x09, 0x5b, 0x00, 0x50, 0x98, 0x61, 0xa4, 0xc3, 0x51, 0xc8, 0x2a,
-  0xb0, 0x71, 0x88, 0xc0, 0xb6, 0xd8, 0x97, 0x9d, 0xed, 0xea, 0x17, 0xf3,
-  0x94, 0x32, 0xac, 0xc2, 0x16, 0x1e, 0xe2, 0xa5, 0xf7, 0x1f, 0xde, 0xdc,
-  0xda, 0xf1, 0xef, 0x3e, 0xe9, 0xfa, 0xea, 0x7d, 0x52, 0xf5, 0xf5, 0x31,
-  0xec, 0x43, 0x45, 0x54, 0x4c, 0x5a, 0xa2, 0x54, 0x14, 0xc6, 0xfa, 0xb0,
-  0xe2, 0x29, 0xd2, 0xe1, 0xe8, 0x85, 0x0b, 0x6c, 0xcb, 0x5b, 0xa6, 0x5b,
-  0xe5, 0xbf, 0x94, 0x3e, 0x40, 0xfe, 0x3e, 0xc9, 0x70, 0xf5, 0xd3, 0x78,
-  0x3c, 0xee, 0x84, 0x47, 0x7a, 0x51, 0xe4, 0x8b, 0xe8, 0xc6, 0x7e, 0x70,
-  0x43, 0xd8, 0xcb, 0x8f, 0xe1, 0x2f, 0xdb, 0x74, 0x3d, 0x8d, 0x13, 0x7f,
-  0x3f, 0x8a, 0xc2, 0x58, 0xe3, 0x5c, 0x38, 0x45, 0x3a, 0x1c, 0x6b, 0xbe,
-  0x0f, 0xd6, 0xd7, 0xf3, 0x2d, 0x6f, 0x99, 0x06, 0x07, 0x85, 0x0d, 0x2b,
-  0xf7, 0x33, 0xf2, 0x0e, 0x61, 0xc3, 0xce, 0x5f, 0xef, 0x7e, 0xcf, 0xfb,
-  0xf6, 0xf7, 0x61, 0x63, 0x5d, 0xd4, 0x86, 0x23, 0x97, 0x13, 0xdf, 0x6e,
-  0x0a, 0x61, 0xef, 0xde, 0x6e, 0x7d, 0xd5, 0x6c, 0x30, 0x9d, 0x8e, 0x52,
-  0x3c, 0xff, 0x14, 0x33, 0x92, 0x7d, 0x3a, 0x0a, 0xa6, 0x50, 0x87, 0xa3,
-  0x17, 0xea, 0x22, 0xfe, 0x6d, 0xcb, 0x5b, 0x1c, 0x5f, 0x24, 0x68, 0x16,
-  0x36, 0x1c, 0xa8, 0x1f, 0x92, 0x6f, 0x9b, 0xd7, 0xf2, 0xef, 0xf2, 0xd2,
-  0x9f, 0xfd, 0x23, 0x64, 0xb4, 0x3b, 0xa1, 0xa2, 0x1f, 0xe3, 0x63, 0x3f,
-  0xbc, 0x7e, 0xfd, 0xfa, 0x4d, 0x8c, 0xd7, 0x27, 0xc2, 0x55, 0x18, 0x7b,
-  0x4d, 0x15, 0x4c, 0xa1, 0x0e, 0x47, 0x2f, 0xac, 0x0e, 0xf6, 0x7e, 0x9b,
-  0x36, 0x1c, 0xeb, 0x3b, 0xa0, 0x0d, 0x79, 0xee, 0x39, 0x55, 0x3c, 0xcf,
-  0x3e, 0x94, 0x7f, 0xaa, 0xbf, 0x28, 0x4c, 0x61, 0xce, 0x3f, 0xe7, 0xbf,
-  0x22, 0x21, 0x2e, 0x8a, 0xc2, 0xd8, 0x2f, 0xb1, 0x48, 0xe4, 0x2a, 0x95,
-  0xc2, 0xf6, 0xb9, 0xf9, 0x7b, 0xa0, 0xc2, 0xb6, 0xca, 0x7b, 0x11, 0x1c,
-  0x63, 0x67, 0xca, 0xb2, 0x44, 0xe7, 0x7f, 0x72, 0x53, 0xd8, 0xf0, 0x1f,
-  0xcf, 0xb4, 0xeb, 0x7d, 0xf6, 0xcf, 0xa0, 0x57, 0xcd, 0x8b, 0xbe, 0x99,
-  0xd1, 0x71, 0x37, 0xab, 0xa2, 0xa5, 0xa3, 0x48, 0x8a, 0x75, 0x38, 0x6e,
-  0x59, 0x05, 0xe9, 0x6b, 0xfb, 0x92, 0x4b, 0x31, 0x38, 0xb4, 0xa6, 0xf2,
-  0xd9, 0xc0, 0x9d, 0x58, 0x0c, 0x44, 0x5c, 0x0c, 0x51, 0xd8, 0x64, 0x31,
-  0xdd, 0x7d, 0xfa, 0xc2, 0x56, 0xfe, 0xf5, 0xcc, 0x7b, 0xc9, 0x41, 0x53,
-  0x56, 0xf1, 0xb7, 0x95, 0xb1, 0x2d, 0xc5, 0xbd, 0xef, 0x87, 0xa6, 0x07,
-  0x5d, 0x8d, 0x28, 0xd8, 0xe1, 0xb8, 0xe3, 0x1f, 0x7e, 0x7d, 0x7d, 0xb7,
-  0x23, 0x3f, 0x15, 0xde, 0x41, 0xbf, 0xeb, 0x48, 0x6c, 0xb6, 0x52, 0x0f,
-  0x3e, 0xee, 0xb8, 0xf5, 0xeb, 0xc0, 0xa6, 0xd8, 0xcd, 0x56, 0x81, 0x69,
-  0x46, 0x7d, 0x40, 0x79, 0xfc, 0xaf, 0xc3, 0xf0, 0x97, 0x95, 0xa3, 0xab,
-  0xc4, 0x83, 0xbb, 0x95, 0x0e, 0xe5, 0xb0, 0xa2, 0x90, 0x5b, 0xd1, 0x17,
-  0x59, 0x43, 0x1a, 0xfe, 0xd5, 0x37, 0x58, 0x77, 0xc9, 0x5b, 0xd9, 0x88,
-  0x7a, 0xbc, 0xe8, 0x8c, 0xa6, 0xda, 0xd4, 0x6b, 0xa3, 0x29, 0x79, 0x6e,
-  0x82, 0xcf, 0x6d, 0x13, 0x87, 0x90, 0xa7, 0x98, 0x18, 0xcd, 0x7e, 0xf4,
-  0x5d, 0x72, 0xfb, 0x7d, 0x40, 0x1e, 0x28, 0x54, 0x5f, 0xe0, 0xdd, 0x8c,
-  0x81, 0x9b, 0x51, 0x63, 0xd6, 0x17, 0x44, 0x53, 0xdc, 0xf1, 0x42, 0x77,
-  0x4f, 0x9b, 0xfd, 0xaf, 0xe6, 0x24, 0xbe, 0xff, 0x6e, 0x77, 0xf8, 0x9c,
-  0x84, 0x9f, 0x24, 0xee, 0x1c, 0x5d, 0xe2, 0xd6, 0x7a, 0xfa, 0x5a, 0x5b,
-  0xe2, 0x44, 0x0e, 0xab, 0x14, 0x0f, 0x91, 0x7f, 0x06, 0x59, 0x9f, 0xcf,
-  0xfd, 0xaf, 0x9b, 0x16, 0xff, 0xb8, 0x8a, 0x83, 0x1b, 0xf5, 0xb1, 0x12,
-  0x0b, 0x41, 0x3a, 0x1c, 0x05, 0xac, 0x52, 0xd1, 0xf8, 0xe1, 0x47, 0x39,
-  0x62, 0xdf, 0xb7, 0x7f, 0x8a, 0xe2, 0x5f, 0x86, 0x29, 0xcc, 0x6d, 0xa1,
-  0x52, 0xb7, 0xdb, 0x5c, 0x74, 0xef, 0xf2, 0xc1, 0xe1, 0x5c, 0x3d, 0xff,
-  0x38, 0xb9, 0xf3, 0x30, 0x0c, 0x5e, 0x62, 0xe3, 0x7f, 0x2a, 0x95, 0xa8,
-  0xa7, 0x24, 0xf0, 0xef, 0x90, 0x77, 0x03, 0x2b, 0xb1, 0x10, 0x84, 0x45,
-  0x9f, 0xff, 0x3e, 0x1c, 0xbe, 0xaf, 0x7a, 0xf5, 0x97, 0xcd, 0xa0, 0x1d,
-  0x77, 0x23, 0x96, 0x07, 0x02, 0x15, 0xa6, 0x05, 0xab, 0x61, 0x58, 0x93,
-  0xc8, 0x86, 0xe4, 0x8d, 0x10, 0xc1, 0x8b, 0xb0, 0x83, 0x14, 0x1b, 0x59,
-  0xca, 0x6f, 0x5e, 0xaf, 0xf9, 0xb0, 0xf3, 0x65, 0x99, 0xdf, 0x76, 0x79,
-  0x13, 0xb1, 0x12, 0x0b, 0xe0, 0x58, 0xdc, 0x6d, 0x43, 0x1b, 0x13, 0x4e,
-  0x62, 0xd9, 0x0e, 0x7a, 0x4d, 0xf9, 0x96, 0x4b, 0xcf, 0x12, 0x15, 0xff,
-  0x2b, 0x14, 0xd2, 0x04, 0xe9, 0x90, 0xee, 0x93, 0xbf, 0xf8, 0x5e, 0x18,
-  0x2c, 0xb0, 0x37, 0xbf, 0x7e, 0xfa, 0xf4, 0x56, 0x55, 0x93, 0xdc, 0x86,
-  0xe3, 0xd5, 0xc7, 0x5e, 0xb1, 0xb8, 0x8f, 0x29, 0x8c, 0x8e, 0xdc, 0x91,
-  0x4d, 0x88, 0xe5, 0x58, 0xe8, 0xb1, 0x1b, 0xd5, 0x98, 0x6f, 0x5f, 0x0e,
-  0x02, 0x66, 0x6e, 0xcb, 0xb0, 0xa9, 0xda, 0x65, 0x2a, 0xe3, 0x3c, 0x24,
-  0x34, 0xfa, 0xef, 0x5b, 0x90, 0xc0, 0xde, 0x6c, 0x76, 0xdd, 0x78, 0xe7,
-  0x6a, 0x49, 0x5d, 0x05, 0x76, 0xfd, 0x7a, 0xf7, 0xaf, 0xcf, 0x92, 0x95,
-  0xbc, 0x7a, 0x8c, 0x8e, 0xbc, 0x91, 0x16, 0x7d, 0x19, 0xab, 0x36, 0x21,
-  0x4c, 0xba, 0x9d, 0xc5, 0x74, 0xda, 0xe9, 0x2c, 0x43, 0x12, 0xcb, 0xe0,
-  0x20, 0xd6, 0x4f, 0xb9, 0x1a, 0x33, 0xaa, 0xc0, 0x86, 0x01, 0x02, 0x13,
-  0x0b, 0x55, 0xae, 0xde, 0x89, 0x18, 0xa6, 0xb6, 0xd0, 0xdf, 0x6e, 0xd2,
-  0x51, 0x6c, 0xa6, 0xe8, 0x16, 0x1c, 0x30, 0x3a, 0xf2, 0x45, 0x5a, 0xf4,
-  0xe5, 0xeb, 0xeb, 0x49, 0xc3, 0x6c, 0xe4, 0x8d, 0x62, 0x97, 0xdd, 0xb4,
-  0x53, 0xcc, 0xa8, 0x02, 0x13, 0x05, 0x71, 0xe5, 0x89, 0xe5, 0x2e, 0xb5,
-  0xbc, 0xfa, 0xe4, 0xfb, 0xc9, 0x95, 0x37, 0xb6, 0x15, 0x81, 0xb4, 0x12,
-  0x4f, 0x99, 0x86, 0xe5, 0x4a, 0x53, 0xdc, 0xe8, 0xaa, 0x6c, 0x37, 0x23,
-  0x59, 0x8e, 0x5c, 0x45, 0x4c, 0x3b, 0x19, 0x54, 0x20, 0x52, 0x08, 0x4c,
-  0x49, 0x07, 0xdf, 0x6d, 0x7e, 0xf2, 0xf6, 0xca, 0xcb, 0x6f, 0x85, 0x2a,
-  0xcc, 0xf5, 0x82, 0xe8, 0xe8, 0xc8, 0x93, 0x03, 0x71, 0x9b, 0x4b, 0xd8,
-  0x37, 0x97, 0x01, 0x93, 0xf9, 0x2d, 0x19, 0x3d, 0x3b, 0x46, 0xc1, 0x02,
-  0xf3, 0xdd, 0x39, 0xb1, 0x21, 0x87, 0x6b, 0x1a, 0xbd, 0xf1, 0x6f, 0xb9,
-  0xf1, 0xca, 0x27, 0x30, 0x37, 0x7b, 0x2c, 0xe6, 0xd6, 0xc8, 0x10, 0xcf,
-  0xf2, 0xcb, 0x1c, 0x31, 0x67, 0xd1, 0xdb, 0x47, 0x88, 0x4d, 0xef, 0x5f,
-  0x3f, 0xe3, 0x53, 0xde, 0x0b, 0xff, 0xa6, 0x51, 0xd7, 0x7e, 0x81, 0x79,
-  0x37, 0x4b, 0x2c, 0xec, 0xcf, 0x61, 0x1a, 0x96, 0x1b, 0xfb, 0xe1, 0xa3,
-  0x04, 0x7c, 0x3c, 0x0f, 0x14, 0x98, 0x3f, 0x3e, 0xfa, 0x04, 0xf6, 0x29,
-  0x9a, 0xc0, 0xae, 0x8a, 0xf5, 0x12, 0x65, 0x44, 0x66, 0x1a, 0x96, 0x1b,
-  0xb2, 0x8b, 0xde, 0xec, 0xc8, 0xb5, 0x84, 0x55, 0x90, 0xbe, 0xfe, 0xe5,
-  0x7f, 0x9d, 0x4f, 0x60, 0xbf, 0xaa, 0x2a, 0xda, 0x24, 0x82, 0x81, 0x02,
-  0x7b, 0x19, 0xf5, 0x4a, 0xb2, 0x81, 0x69, 0x58, 0xde, 0xc8, 0x1a, 0xb3,
-  0x45, 0x16, 0xbd, 0x49, 0xfe, 0xf6, 0xcc, 0x2f, 0xb0, 0x80, 0x5b, 0xe7,
-  0xfc, 0x8b, 0x5b, 0xd4, 0xfe, 0xe8, 0x17, 0x51, 0xa0, 0xc0, 0x0a, 0x0e,
-  0x61, 0xee, 0x21, 0xed, 0x54, 0xc3, 0x72, 0xc1, 0x48, 0x17, 0xbd, 0xcd,
-  0x78, 0xd7, 0x5b, 0x86, 0x1c, 0x57, 0x31, 0xf6, 0xdd, 0x55, 0xe5, 0xd8,
-  0x07, 0x67, 0xcb, 0xd1, 0x60, 0x81, 0x45, 0x3f, 0x38, 0x2c, 0x13, 0xe4,
-  0x34, 0x8c, 0xa6, 0xc4, 0x5c, 0x90, 0x35, 0xe6, 0xca, 0x59, 0xf4, 0x79,
-  0x31, 0xf4, 0xac, 0x62, 0x7b, 0x1f, 0x78, 0x66, 0xa0, 0xbf, 0x9b, 0xfe,
-  0x85, 0x4f, 0x42, 0xbf, 0x04, 0x0a, 0xec, 0x5d, 0xc1, 0x7f, 0x8f, 0x9c,
-  0x86, 0xb1, 0xa1, 0x76, 0x0e, 0xec, 0x89, 0x00, 0x96, 0x6c, 0xaf, 0xd8,
-  0x7a, 0xa2, 0xac, 0x00, 0x58, 0x13, 0x7c, 0xdc, 0x52, 0xc0, 0x7a, 0x30,
-  0x51, 0xf6, 0xfa, 0x24, 0x7e, 0xf0, 0x29, 0x50, 0x60, 0x57, 0x45, 0x77,
-  0xfe, 0xca, 0x69, 0xd8, 0x89, 0xe9, 0xd1, 0x58, 0x41, 0x9a, 0x58, 0xf4,
-  0x09, 0x98, 0xfd, 0xf0, 0xbc, 0xed, 0x68, 0xec, 0x5f, 0x21, 0x53, 0xd7,
-  0xa0, 0x15, 0xcd, 0x6f, 0x5e, 0x5d, 0x5f, 0x5f, 0xff, 0xea, 0xee, 0x1b,
-  0xf5, 0x3a, 0x58, 0x60, 0x05, 0xf7, 0x24, 0x2a, 0xd3, 0x30, 0xbc, 0xfa,
-  0xac, 0x91, 0x3b, 0xb5, 0x55, 0xb3, 0xc6, 0x9c, 0x23, 0x93, 0x55, 0x67,
-  0xcd, 0x32, 0xf4, 0xb9, 0x24, 0xdc, 0xc6, 0xad, 0xd6, 0x51, 0x39, 0x04,
-  0xe6, 0x3a, 0xa3, 0x24, 0x89, 0x59, 0x23, 0x6a, 0xcc, 0xc5, 0x6d, 0x74,
-  0x53, 0x17, 0x44, 0xaf, 0xd4, 0xd6, 0xf5, 0x3f, 0x3f, 0x97, 0x43, 0x60,
-  0x6e, 0x53, 0x22, 0x49, 0x62, 0xb6, 0x50, 0x63, 0xce, 0x0d, 0xd1, 0x4e,
-  0xbf, 0x75, 0xf1, 0xd9, 0xdb, 0x92, 0x08, 0x6c, 0x48, 0x92, 0x98, 0x0f,
-  0x32, 0x80, 0x19, 0x1b, 0x87, 0xd5, 0x25, 0xca, 0x9e, 0x01, 0xbe, 0x76,
-  0xfa, 0x3b, 0x0c, 0x5c, 0xec, 0x92, 0x24, 0x31, 0x0f, 0xe4, 0x61, 0x2a,
-  0xd4, 0x98, 0xb3, 0x47, 0xec, 0x6d, 0xb5, 0xf5, 0x45, 0x41, 0x3e, 0x62,
-  0xc1, 0xad, 0x1c, 0x1b, 0x46, 0x24, 0x89, 0x39, 0x20, 0x9a, 0xa4, 0xa8,
-  0x31, 0xe7, 0x80, 0xb0, 0x11, 0xb7, 0xae, 0x91, 0x79, 0x13, 0x10, 0xc2,
-  0xde, 0x46, 0xfd, 0x0d, 0x59, 0xe2, 0xee, 0x86, 0x47, 0xb9, 0x39, 0x33,
-  0x68, 0x92, 0xca, 0x13, 0x91, 0x75, 0x6d, 0x9f, 0xde, 0xfa, 0x43, 0xd8,
-  0x3b, 0x33, 0x97, 0x2b, 0xf7, 0xd3, 0x3e, 0x32, 0x3d, 0x2c, 0xab, 0x83,
-  0x08, 0x60, 0xd5, 0x5a, 0xc7, 0x5c, 0x16, 0xc4, 0x8a, 0xb0, 0xed, 0x5b,
-  0xec, 0x7c, 0x78, 0xe7, 0x15, 0xd8, 0x8b, 0x88, 0x9f, 0x9f, 0x35, 0x72,
-  0x87, 0x05, 0x7a, 0x12, 0x33, 0x82, 0x26, 0xa9, 0x7c, 0x71, 0x5c, 0x8e,
-  0x1d, 0xfb, 0x08, 0x7d, 0xf4, 0xe8, 0xeb, 0x95, 0xa9, 0xcb, 0x95, 0x4e,
-  0x62, 0x8b, 0x85, 0x2b, 0x99, 0xd0, 0xa0, 0x49, 0x2a, 0x5f, 0x44, 0x71,
-  0x69, 0x47, 0x89, 0x51, 0xb7, 0xea, 0x0b, 0xee, 0xf4, 0x55, 0x91, 0x4e,
-  0x22, 0xdb, 0xb8, 0x65, 0x02, 0x01, 0x2c, 0x67, 0x84, 0xcb, 0xb1, 0x6b,
-  0x86, 0xab, 0x2a, 0xec, 0x53, 0xa4, 0x4f, 0xce, 0x09, 0x59, 0x6e, 0xde,
-  0x37, 0x3d, 0x36, 0xab, 0x80, 0x0c, 0x60, 0x45, 0xef, 0x95, 0x5d, 0x1b,
-  0x22, 0x9f, 0x10, 0xf6, 0xf1, 0xa5, 0x23, 0xaf, 0xeb, 0xa2, 0x37, 0x1f,
-  0xd5, 0x91, 0x3d, 0x89, 0x14, 0xc3, 0x32, 0x40, 0x04, 0x30, 0xba, 0x7c,
-  0x73, 0x23, 0x7a, 0x11, 0xe4, 0xc5, 0x2f, 0xd7, 0xd7, 0xd7, 0x9f, 0xcc,
-  0xca, 0xab, 0xa7, 0x6c, 0x94, 0x88, 0xcf, 0x91, 0x1a, 0x19, 0xc0, 0xe8,
-  0xf2, 0xcd, 0x8d, 0x48, 0xa5, 0xe6, 0x52, 0x21, 0x16, 0xae, 0xe0, 0x73,
-  0xa4, 0x86, 0x00, 0x96, 0x3f, 0x51, 0x27, 0x61, 0xe5, 0x41, 0x16, 0xc3,
-  0x2e, 0x4c, 0x8f, 0x4f, 0xdb, 0x21, 0x80, 0x15, 0x80, 0x18, 0xae, 0x16,
-  0xcd, 0x72, 0x65, 0x31, 0x8c, 0x7e, 0x8e, 0x74, 0x10, 0xc0, 0x8a, 0xa0,
-  0x1d, 0xa9, 0x12, 0x56, 0x26, 0xa4, 0xcf, 0x41, 0x3f, 0x47, 0x2a, 0x08,
-  0x60, 0x85, 0x20, 0x26, 0x61, 0x16, 0x15, 0x42, 0xa4, 0xcf, 0x81, 0x55,
-  0x9f, 0x06, 0x02, 0x58, 0x21, 0x88, 0xd1, 0x6a, 0xd3, 0x6a, 0x3b, 0xd1,
-  0xf4, 0x8b, 0x55, 0x9f, 0x02, 0x02, 0x58, 0x31, 0x4c, 0x2c, 0x6c, 0xf6,
-  0x94, 0xfd, 0x1c, 0x58, 0xf5, 0xc9, 0x21, 0x80, 0x15, 0x84, 0x08, 0x07,
-  0x36, 0xdd, 0x67, 0x91, 0xd7, 0x9e, 0x9a, 0x1e, 0xa5, 0x16, 0x73, 0x4a,
-  0x00, 0x2b, 0x86, 0x81, 0x85, 0x39, 0xe2, 0x9c, 0x10, 0x96, 0x96, 0x63,
-  0x02, 0x58, 0x41, 0x2c, 0x2d, 0xcc, 0x11, 0xe5, 0x53, 0x81, 0x6a, 0x73,
-  0x52, 0x08, 0x60, 0x85, 0xd1, 0xb7, 0x30, 0x47, 0x14, 0x0b, 0xd9, 0xd8,
-  0x3d, 0x20, 0x21, 0xf7, 0x09, 0x60, 0x85, 0x21, 0xa2, 0x41, 0x37, 0xfd,
-  0x47, 0x15, 0x7f, 0xd1, 0x84, 0xb0, 0x64, 0x88, 0xad, 0xa4, 0x58, 0x07,
-  0x96, 0x3f, 0x22, 0x47, 0xb4, 0xa8, 0xd6, 0xac, 0x2c, 0xbd, 0x24, 0x84,
-  0x25, 0x41, 0x1e, 0x18, 0x6b, 0x51, 0xf9, 0xd3, 0x5e, 0x84, 0x8f, 0x98,
-  0xc1, 0xf1, 0xd0, 0xc5, 0xd1, 0x21, 0x84, 0xa5, 0xa0, 0x49, 0x00, 0x2b,
-  0x90, 0x91, 0x8d, 0x77, 0x9b, 0x10, 0x96, 0x82, 0x86, 0x08, 0x60, 0xf6,
-  0xf4, 0x78, 0xdb, 0x8c, 0x70, 0x0c, 0xec, 0x9a, 0xf0, 0x12, 0xc2, 0x92,
-  0x73, 0xee, 0xdc, 0x3b, 0xf6, 0x42, 0x2c, 0x06, 0x51, 0xb7, 0xb5, 0xca,
-  0xe6, 0x20, 0x84, 0x25, 0x47, 0x78, 0xf4, 0x36, 0xd5, 0x3e, 0x6d, 0x66,
-  0xe5, 0xdc, 0x6f, 0xbb, 0x76, 0x27, 0x17, 0x21, 0x8c, 0x76, 0x8e, 0xb8,
-  0xec, 0x5b, 0xf9, 0x7d, 0xdb, 0x4c, 0xdf, 0xc6, 0x27, 0x9a, 0x0c, 0x61,
-  0xb4, 0x73, 0xc4, 0x44, 0x58, 0x1c, 0x14, 0x99, 0x8b, 0x42, 0x04, 0x03,
-  0xab, 0x9c, 0x7a, 0x42, 0x58, 0x42, 0x64, 0x1f, 0x3d, 0x1e, 0x7d, 0x51,
-  0x88, 0x73, 0x8c, 0xec, 0x72, 0x95, 0x08, 0x61, 0xc9, 0x10, 0x6d, 0x88,
-  0x56, 0x35, 0xc7, 0x59, 0x8e, 0x68, 0x8c, 0xb0, 0xcb, 0x56, 0x12, 0xf5,
-  0x05, 0x96, 0x36, 0xc7, 0xe2, 0xd0, 0xb9, 0x6d, 0x4b, 0xd3, 0xdf, 0x5f,
-  0x8d, 0x98, 0x59, 0x19, 0xc2, 0xe4, 0x55, 0xb3, 0xb4, 0x39, 0x06, 0xa2,
-  0x08, 0xd6, 0x37, 0xfd, 0xf5, 0xd5, 0x8a, 0x81, 0x95, 0xb3, 0x30, 0x71,
-  0xd5, 0x6c, 0xa4, 0x1d, 0x03, 0x91, 0x21, 0x5a, 0xd5, 0x57, 0x60, 0x3d,
-  0x72, 0x85, 0x95, 0x55, 0x46, 0xa2, 0x0c, 0x61, 0x6c, 0x30, 0x15, 0x1d,
-  0x32, 0x44, 0x23, 0x88, 0x62, 0xb3, 0x5d, 0xb5, 0x11, 0x71, 0xd5, 0xec,
-  0x91, 0x18, 0x9d, 0x16, 0x19, 0xa2, 0x09, 0xc4, 0xde, 0x1c, 0x76, 0x15,
-  0x47, 0x44, 0xe0, 0xa5, 0x5f, 0x2a, 0x32, 0xfb, 0x64, 0x88, 0x66, 0x10,
-  0xf3, 0x19, 0xbb, 0x3a, 0x12, 0xc5, 0x4a, 0x00, 0x9c, 0xfa, 0xa8, 0x9c,
-  0x90, 0x21, 0x9a, 0x41, 0xce, 0x67, 0xac, 0x7a, 0xb4, 0x89, 0x2e, 0x2f,
-  0x76, 0x70, 0x8b, 0x8a, 0x58, 0x6a, 0x69, 0xd5, 0x73, 0xb4, 0x12, 0x88,
-  0xaa, 0x92, 0x55, 0x56, 0xbd, 0x2c, 0x36, 0x1f, 0x98, 0x1e, 0xb8, 0xb6,
-  0xd0, 0x32, 0x6b, 0x17, 0xcf, 0xb7, 0x53, 0x65, 0xd9, 0xcb, 0xb1, 0x6a,
-  0x95, 0x55, 0x2f, 0x1e, 0x0b, 0x38, 0xf5, 0xd1, 0x10, 0x6b, 0x99, 0x8d,
-  0x1c, 0x46, 0x30, 0x1c, 0x89, 0x31, 0x96, 0x82, 0xfe, 0x74, 0x37, 0xa3,
-  0xce, 0x6e, 0xe6, 0xbb, 0xc9, 0xb8, 0x97, 0xac, 0x6b, 0xa3, 0xcf, 0x21,
-  0x32, 0x5b, 0x6c, 0x8e, 0x68, 0x88, 0xdd, 0x6e, 0x4c, 0x4c, 0xc1, 0x66,
-  0xe3, 0xf8, 0x72, 0x2a, 0x3d, 0xae, 0xaa, 0xff, 0x7d, 0xf9, 0x7f, 0x6b,
-  0x2e, 0xff, 0x1d, 0x2e, 0xf7, 0x3f, 0x89, 0x37, 0x8d, 0x12, 0x2a, 0x3e,
-  0x7b, 0xd1, 0xef, 0x46, 0x38, 0xf5, 0xd8, 0x1c, 0x91, 0x10, 0x1e, 0x87,
-  0x81, 0x46, 0xdf, 0x65, 0x06, 0xe1, 0x0b, 0x22, 0x32, 0x8e, 0x10, 0xe7,
-  0xd7, 0x44, 0x88, 0xf4, 0x42, 0x60, 0xd8, 0x1c, 0x91, 0x10, 0x65, 0xe6,
-  0xe2, 0xf5, 0x35, 0x4a, 0x3a, 0x56, 0xa0, 0x1c, 0x60, 0x73, 0x44, 0xc1,
-  0x31, 0x11, 0x0b, 0xef, 0xea, 0xae, 0x64, 0x7a, 0x58, 0x2f, 0xe8, 0xe6,
-  0x88, 0x82, 0x63, 0x22, 0x16, 0x2d, 0x30, 0xd2, 0x43, 0xfb, 0x61, 0xdd,
-  0x65, 0x14, 0x9c, 0x9b, 0x55, 0xb0, 0x8f, 0x45, 0x7a, 0x58, 0x05, 0x4c,
-  0x8f, 0x5d, 0x1b, 0x10, 0x6b, 0x55, 0x0a, 0x15, 0x98, 0x96, 0x1e, 0x36,
-  0xf7, 0xb7, 0x71, 0xb2, 0x9b, 0xe6, 0xd1, 0x6e, 0x4c, 0x0f, 0xc5, 0x4a,
-  0x82, 0xcb, 0x11, 0x01, 0xd1, 0x89, 0x58, 0xa4, 0x4b, 0xbf, 0x52, 0xd3,
-  0xc3, 0x73, 0xd3, 0x77, 0x40, 0xb0, 0xb7, 0xbf, 0x9b, 0xf3, 0xdd, 0x72,
-  0xbf, 0x70, 0x55, 0xfd, 0xfb, 0x3f, 0xfc, 0x6e, 0xcd, 0x1f, 0x7e, 0x5f,
-  0x55, 0xb9, 0xdf, 0x37, 0xfd, 0x95, 0xd9, 0x80, 0x10, 0x58, 0x71, 0xdd,
-  0x3a, 0xc3, 0x85, 0xf2, 0x1d, 0x9d, 0xe2, 0x44, 0x85, 0xd2, 0x88, 0xa0,
-  0xf8, 0x68, 0xa2, 0xbf, 0x25, 0x42, 0x98, 0x5f, 0x73, 0x16, 0x5d, 0x5e,
-  0x2d, 0xea, 0x60, 0x51, 0x38, 0x2e, 0x5a, 0x60, 0xf3, 0x4b, 0xe5, 0x4b,
-  0x3a, 0xa4, 0x1b, 0xc0, 0x4a, 0x0e, 0xf6, 0xf7, 0x79, 0x32, 0x46, 0x43,
-  0xd4, 0x99, 0x8b, 0x0a, 0x5f, 0x9a, 0xbb, 0x51, 0x9a, 0xf4, 0x10, 0x20,
-  0x27, 0x8a, 0x15, 0xd8, 0x44, 0x75, 0x37, 0x48, 0x0f, 0xa1, 0xfa, 0x14,
-  0x2a, 0xb0, 0x4e, 0x9b, 0xf4, 0x10, 0xea, 0x85, 0xd3, 0x29, 0x55, 0xc4,
-  0x7e, 0x01, 0x5a, 0xf8, 0x62, 0x8a, 0x0c, 0xb5, 0xa0, 0xb8, 0x4e, 0x29,
-  0x2d, 0x7c, 0x9d, 0xb1, 0x2b, 0x11, 0xd4, 0x82, 0xa2, 0x04, 0xa6, 0x85,
-  0x2f, 0x0e, 0xc0, 0x81, 0xba, 0x50, 0x8c, 0xc0, 0x74, 0xf3, 0xf0, 0x94,
-  0x7d, 0x61, 0xa1, 0x2e, 0x14, 0x22, 0x30, 0xad, 0xf6, 0xd5, 0xbe, 0xc0,
-  0xdd, 0x80, 0xda, 0x50, 0x80, 0xc0, 0xb4, 0xd6, 0x0d, 0xc2, 0x17, 0xd4,
-  0x8a, 0xfc, 0x05, 0xd6, 0xd5, 0x16, 0xa6, 0x60, 0xce, 0x43, 0xad, 0xc8,
-  0xdb, 0xa6, 0x9f, 0x4c, 0xb5, 0xf0, 0x45, 0x7f, 0x28, 0xd4, 0x8b, 0x7c,
-  0x0b, 0xcd, 0xba, 0xb9, 0xc1, 0xec, 0x0b, 0x6a, 0x47, 0xae, 0x02, 0xd3,
-  0xd6, 0xa5, 0x30, 0xfb, 0x82, 0x1a, 0x22, 0x04, 0x36, 0xc9, 0x5e, 0x5e,
-  0x73, 0x7d, 0xd7, 0x8d, 0x13, 0xc2, 0x17, 0xd4, 0x8f, 0xdc, 0xd6, 0x83,
-  0xcd, 0x06, 0x9a, 0xbc, 0xce, 0xe8, 0xec, 0x85, 0x3a, 0x22, 0x04, 0x96,
-  0xf1, 0x96, 0x01, 0xc3, 0x8e, 0x96, 0x1d, 0xb6, 0x58, 0x98, 0x02, 0x35,
-  0xc5, 0x91, 0x40, 0xb6, 0x27, 0x7c, 0xac, 0xb4, 0xca, 0x72, 0xfb, 0x90,
-  0xce, 0x43, 0xa8, 0x2b, 0xa7, 0x1b, 0x0d, 0x64, 0x79, 0xce, 0xa2, 0x67,
-  0xf2, 0x85, 0xb9, 0x01, 0x35, 0x46, 0xec, 0xec, 0x9b, 0xd9, 0xd6, 0xd9,
-  0x73, 0xad, 0xf2, 0xd5, 0x6e, 0xd1, 0xd8, 0x0b, 0x75, 0xe6, 0xdc, 0x11,
-  0x42, 0x46, 0x67, 0x71, 0x7b, 0xbc, 0x8d, 0x76, 0x93, 0xec, 0x10, 0x6a,
-  0x8d, 0x38, 0xbe, 0x68, 0x91, 0x87, 0xbc, 0xce, 0xc8, 0x0e, 0xa1, 0xee,
-  0xb4, 0x32, 0xcb, 0x11, 0xbd, 0xf2, 0x62, 0xd5, 0x32, 0xc0, 0xbd, 0x66,
-  0x46, 0x46, 0xbd, 0x4f, 0x5e, 0x54, 0x96, 0x01, 0xdc, 0x13, 0xf8, 0xd2,
-  0x1d, 0x76, 0xef, 0x95, 0x17, 0x93, 0x2f, 0x80, 0x0d, 0xa7, 0xe9, 0x43,
-  0xd8, 0xc4, 0x2b, 0xaf, 0x23, 0x1a, 0x37, 0x00, 0x36, 0x88, 0x76, 0xc4,
-  0xc4, 0xb3, 0x30, 0x8f, 0x31, 0xbf, 0x96, 0x17, 0xde, 0x06, 0x80, 0xa0,
-  0x21, 0x6c, 0x8e, 0x44, 0x87, 0xdd, 0x0f, 0x3d, 0x5d, 0x1b, 0xed, 0xf6,
-  0x29, 0xde, 0x06, 0x80, 0x82, 0x0c, 0x61, 0xf1, 0xfb, 0xa5, 0x66, 0xa3,
-  0x3e, 0xf2, 0x02, 0xd8, 0x4a, 0xe3, 0x34, 0x99, 0xc2, 0x86, 0x2b, 0x6f,
-  0x6e, 0x88, 0xbc, 0x00, 0xfc, 0xdc, 0x97, 0x02, 0x19, 0x44, 0xb7, 0x12,
-  0x97, 0x83, 0x3e, 0xf2, 0x02, 0x88, 0x42, 0x53, 0x6a, 0xe4, 0x32, 0xda,
-  0xc2, 0xb0, 0x00, 0x75, 0x21, 0x2f, 0x80, 0x10, 0x1a, 0xca, 0xc1, 0x6b,
-  0x83, 0x5d, 0x66, 0xe2, 0xa4, 0xbb, 0x68, 0xfb, 0x39, 0x42, 0x5e, 0x00,
-  0x61, 0x1c, 0xb4, 0x14, 0xad, 0x4c, 0x57, 0x61, 0x89, 0xe2, 0x6c, 0xde,
-  0x59, 0xf4, 0x03, 0xd4, 0xd5, 0x3e, 0xc4, 0x98, 0x07, 0xd0, 0xf8, 0xec,
-  0xc1, 0xcd, 0xcd, 0xc3, 0xcf, 0xc4, 0x7f, 0x69, 0x0a, 0x6b, 0xb7, 0xc7,
-  0x83, 0xce, 0x7c, 0x2e, 0xf6, 0xe9, 0x18, 0xce, 0xd7, 0x74, 0x3a, 0x8b,
-  0x69, 0x3b, 0x98, 0xd6, 0x05, 0x5d, 0x1b, 0x00, 0x1a, 0x8f, 0x3e, 0xbf,
-  0xb9, 0xe3, 0x73, 0xf1, 0x03, 0x8f, 0xc2, 0xa2, 0x73, 0x76, 0x4c, 0xcf,
-  0x21, 0x80, 0xc6, 0xe3, 0x2f, 0x6e, 0x04, 0x32, 0x86, 0xed, 0xc5, 0x38,
-  0x00, 0xdb, 0x0d, 0x5e, 0x4d, 0x7a, 0xa2, 0x00, 0x3c, 0x7c, 0xf9, 0x40,
-  0xea, 0xeb, 0xe6, 0x81, 0xfc, 0x69, 0xe3, 0x22, 0xae, 0xbc, 0x0e, 0x31,
-  0x36, 0x00, 0xbc, 0x3c, 0xf9, 0xea, 0x46, 0x45, 0xf9, 0x97, 0xfd, 0x38,
-  0x41, 0xec, 0x90, 0xd4, 0x10, 0xc0, 0xcf, 0xd7, 0x0f, 0x6f, 0xc2, 0x04,
-  0x76, 0xef, 0xde, 0x71, 0x34, 0x89, 0x9d, 0x5e, 0xb0, 0xc9, 0x3c, 0x40,
-  0x00, 0x7f, 0x7c, 0xaa, 0xcb, 0xcb, 0x75, 0x39, 0x1c, 0x0e, 0x9a, 0x3b,
-  0xdc, 0x8e, 0xb3, 0x8b, 0x63, 0x4c, 0x43, 0x80, 0x20, 0x1e, 0x7f, 0x76,
-  0xe3, 0xe5, 0x1b, 0xff, 0xab, 0x0e, 0xce, 0x0f, 0x4f, 0x83, 0xa4, 0x75,
-  0x74, 0x74, 0x72, 0x4c, 0xbd, 0x0b, 0x20, 0x8c, 0x47, 0x0f, 0x7c, 0xfa,
-  0xfa, 0x36, 0xec, 0xb5, 0x07, 0xfb, 0xfb, 0xe7, 0x27, 0x0e, 0xfb, 0x6b,
-  0x88, 0x5a, 0x00, 0x5b, 0x79, 0xfc, 0x95, 0x4f, 0x5e, 0x0f, 0xbe, 0x34,
-  0x7d, 0x51, 0x00, 0x15, 0xe1, 0x9b, 0x87, 0x3e, 0x7d, 0x7d, 0xf1, 0xd8,
-  0xf4, 0x45, 0x01, 0x54, 0x83, 0x27, 0x4f, 0x7d, 0xf2, 0xfa, 0xfc, 0x91,
-  0xe9, 0x8b, 0x02, 0xa8, 0x08, 0x7e, 0x73, 0xc3, 0x6d, 0x43, 0x04, 0x80,
-  0x74, 0xf8, 0x67, 0x5f, 0x4f, 0x9f, 0x98, 0xbe, 0x26, 0x80, 0xaa, 0xe0,
-  0x8b, 0x5f, 0x0f, 0x31, 0x37, 0x00, 0x32, 0xc3, 0xeb, 0xce, 0x7f, 0x8b,
-  0xb9, 0x01, 0x90, 0x1d, 0x1e, 0x6f, 0x1e, 0x73, 0x03, 0x20, 0x4b, 0x34,
-  0x7d, 0x61, 0x6e, 0x00, 0x64, 0xcb, 0xe7, 0x98, 0x1b, 0x00, 0xf9, 0xf1,
-  0x8d, 0x34, 0x37, 0xbe, 0x36, 0x7d, 0x29, 0x00, 0x15, 0xe4, 0xdb, 0x8d,
-  0xbe, 0xbe, 0xc2, 0xdc, 0x00, 0xc8, 0x83, 0x2f, 0x9f, 0xde, 0x3c, 0xfc,
-  0x0a, 0x73, 0x03, 0x00, 0x00, 0x2a, 0xc5, 0xa3, 0xcf, 0xbe, 0xfa, 0xec,
-  0x8f, 0xb1, 0xdf, 0xf3, 0xf4, 0x33, 0x02, 0x22, 0xc0, 0x4e, 0x1e, 0x3f,
-  0xdd, 0xbe, 0x2e, 0x2c, 0x90, 0xcd, 0x9c, 0xee, 0x29, 0x53, 0x3a, 0x80,
-  0x1d, 0x88, 0x2e, 0xfb, 0x2f, 0x62, 0xbc, 0x47, 0x6c, 0xfa, 0xf6, 0x95,
-  0xe9, 0x8b, 0x07, 0x28, 0x39, 0x6e, 0x9b, 0xe2, 0x93, 0xc8, 0xef, 0x79,
-  0x22, 0xdf, 0x13, 0x37, 0xb3, 0x04, 0xa8, 0x17, 0x8f, 0xb6, 0x6e, 0xce,
-  0x11, 0xc2, 0xd7, 0x74, 0x85, 0x00, 0x44, 0xe1, 0xb1, 0xb2, 0xca, 0x39,
-  0xba, 0x58, 0xdc, 0xa8, 0x47, 0x8e, 0x08, 0xb0, 0x05, 0x75, 0x99, 0x73,
-  0xf4, 0x15, 0x2c, 0xb2, 0x31, 0xe4, 0xe6, 0xa1, 0xe9, 0x3f, 0x00, 0xa0,
-  0xc4, 0xa8, 0xeb, 0xc4, 0x1e, 0x46, 0xb7, 0x04, 0xdd, 0x39, 0x58, 0x8c,
-  0x89, 0x1b, 0x40, 0xdd, 0x50, 0x26, 0x60, 0x71, 0xa6, 0x60, 0xf7, 0xee,
-  0x3d, 0x4c, 0xf4, 0x2e, 0x80, 0x5a, 0xa1, 0x4e, 0xc0, 0xe2, 0xd5, 0xc1,
-  0xdc, 0xcc, 0x32, 0x8e, 0xb9, 0x0f, 0x50, 0x2b, 0x94, 0x45, 0x2c, 0x37,
-  0x9f, 0xc7, 0xaa, 0x19, 0xbb, 0xa9, 0xe5, 0x53, 0xd3, 0x7f, 0x04, 0x40,
-  0x49, 0xd1, 0x26, 0x60, 0xf1, 0x0a, 0x5a, 0x4a, 0x6e, 0x69, 0xfa, 0xaf,
-  0x00, 0x28, 0x29, 0xea, 0x46, 0x1d, 0x31, 0xa7, 0x52, 0x8f, 0xdd, 0x77,
-  0xd2, 0x90, 0x08, 0x10, 0x48, 0xd2, 0x09, 0xd8, 0x2d, 0xae, 0x38, 0x59,
-  0xc1, 0x09, 0x10, 0x48, 0xd2, 0x09, 0xd8, 0x2d, 0xdf, 0x26, 0xd7, 0x26,
-  0x40, 0x3d, 0xf8, 0x3c, 0xe1, 0x04, 0xec, 0x16, 0xb7, 0x59, 0xea, 0x41,
-  0xec, 0xf7, 0x02, 0xd4, 0x82, 0x6f, 0x12, 0x4e, 0xc0, 0x6e, 0xf9, 0xa3,
-  0x1b, 0xfe, 0x58, 0xb2, 0x02, 0x10, 0xc8, 0xb7, 0x29, 0x1a, 0x76, 0x93,
-  0x74, 0x58, 0x01, 0xd4, 0x8b, 0x6f, 0x9e, 0xde, 0xdc, 0x24, 0xdc, 0xa8,
-  0xc3, 0x2d, 0x35, 0xd3, 0x50, 0x0f, 0x90, 0x39, 0x5f, 0x48, 0x81, 0x51,
-  0x6a, 0x06, 0xc8, 0x9c, 0x2f, 0x69, 0xa8, 0x07, 0xc8, 0x0f, 0xa5, 0xa1,
-  0xde, 0xf4, 0xa5, 0x00, 0x54, 0x90, 0x07, 0xf8, 0xf4, 0x00, 0xf9, 0xf1,
-  0x05, 0x26, 0x07, 0x40, 0x7e, 0x3c, 0x7e, 0x90, 0xb4, 0x0b, 0x04, 0x00,
-  0x76, 0xb3, 0xd9, 0x4f, 0x91, 0xad, 0x11, 0x01, 0x72, 0xe2, 0xc9, 0xa3,
-  0x47, 0x4f, 0x4c, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0xdd, 0xfc, 0x3f, 0x7a, 0x5d, 0x3b, 0xde, 0xaf, 0x55, 0xec,
-  0xbb, 0x00, 0x00, 0x00, 0x25, 0x74, 0x45, 0x58, 0x74, 0x64, 0x61, 0x74,
-  0x65, 0x3a, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x32, 0x30, 0x32,
-  0x35, 0x2d, 0x30, 0x38, 0x2d, 0x30, 0x32, 0x54, 0x30, 0x36, 0x3a, 0x32,
-  0x30, 0x3a, 0x35, 0x38, 0x2b, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x4a, 0x92,
-  0x8f, 0xcb, 0x00, 0x00, 0x00, 0x25, 0x74, 0x45, 0x58, 0x74, 0x64, 0x61,
-  0x74, 0x65, 0x3a, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x00, 0x32, 0x30,
-  0x32, 0x35, 0x2d, 0x30, 0x38, 0x2d, 0x30, 0x32, 0x54, 0x30, 0x36, 0x3a,
-  0x32, 0x30, 0x3a, 0x35, 0x38, 0x2b, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x3b,
-  0xcf, 0x37, 0x77, 0x00, 0x00, 0x00, 0x28, 0x74, 0x45, 0x58, 0x74, 0x64,
-  0x61, 0x74, 0x65, 0x3a, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d,
-  0x70, 0x00, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x38, 0x2d, 0x30, 0x32,
-  0x54, 0x30, 0x36, 0x3a, 0x32, 0x33, 0x3a, 0x33, 0x38, 0x2b, 0x30, 0x30,
-  0x3a, 0x30, 0x30, 0x41, 0x82, 0xa4, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x49,
-  0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+static const uint32_t bongo_cat_left_down_png_runs[] = {
+  0x3405, 0x00ffffff, 0x1, 0x20000000, 0x1, 0x40000000, 0x1, 0x30000000,
+  0x35b, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xb0000000, 0x3, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x40000000, 0x359, 0x00ffffff, 0x1, 0xb0000000,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000, 0x356, 0x00ffffff,
+  0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x353, 0x00ffffff, 0x1, 0x60000000, 0xb, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0x351, 0x00ffffff, 0x1, 0x50000000, 0xe, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x40000000, 0x34e, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x10, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000,
+  0x34b, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x12, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x70000000, 0x34a, 0x00ffffff, 0x1, 0xb0000000,
+  0x15, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000, 0x347, 0x00ffffff,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff7f7f7f, 0x1, 0xff1f1f1f,
+  0xd, 0xff000000, 0x1, 0x80000000, 0x345, 0x00ffffff, 0x1, 0x40000000,
+  0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x2, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000,
+  0x342, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x4, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f,
+  0xd, 0xff000000, 0x1, 0x70000000, 0x341, 0x00ffffff, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x6, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f, 0xc, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x20000000, 0x33e, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x9, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x33c, 0x00ffffff, 0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xffbfbfbf,
+  0xb, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xc, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x10000000, 0x33a, 0x00ffffff, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0xe, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000,
+  0x338, 0x00ffffff, 0x1, 0x90000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x10, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xb, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x336, 0x00ffffff, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x12, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0x90000000,
+  0x334, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x14, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x332, 0x00ffffff,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x17, 0xffffffff,
+  0x1, 0xff8f8f8f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x330, 0x00ffffff, 0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffefefef, 0x18, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f,
+  0xb, 0xff000000, 0x1, 0x60000000, 0x32f, 0x00ffffff, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x1a, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0x90000000, 0x32d, 0x00ffffff,
+  0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x1d, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xa0000000,
+  0x1, 0x10000000, 0x32a, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x1e, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xa, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x329, 0x00ffffff, 0x1, 0xa0000000, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x20, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0xa, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000, 0x327, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff4f4f4f, 0x23, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x326, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x24, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x40000000, 0x324, 0x00ffffff, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x26, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0x60000000, 0x323, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x28, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x321, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x29, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x31f, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x2c, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x31e, 0x00ffffff, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x2d, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x31c, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x2f, 0xffffffff,
+  0x1, 0xff8f8f8f, 0xa, 0xff000000, 0x1, 0x60000000, 0x31b, 0x00ffffff,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x30, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x319, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x32, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x318, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x33, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x316, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x35, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0x50000000, 0x315, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x36, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0xf0000000,
+  0x3, 0x80000000, 0x1, 0x50000000, 0x9, 0x40000000, 0xe7, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0x80000000, 0x1, 0x90000000, 0x1, 0xb0000000,
+  0x1, 0x20000000, 0x21c, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x38, 0xffffffff, 0x1, 0xff9f9f9f, 0x1c, 0xff000000,
+  0x1, 0xe0000000, 0x4, 0xc0000000, 0x1, 0xb0000000, 0x4, 0x80000000,
+  0x1, 0x50000000, 0x3, 0x40000000, 0x1, 0x10000000, 0xd0, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xd0000000, 0x4, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x21a, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x39, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x2c, 0xff000000, 0x1, 0xf0000000, 0x3, 0xc0000000, 0x1, 0x90000000,
+  0x2, 0x80000000, 0x1, 0x50000000, 0x2, 0x40000000, 0x1, 0x10000000,
+  0xc1, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x10000000, 0x219, 0x00ffffff, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x3b, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x38, 0xff000000, 0x2, 0xc0000000, 0x1, 0xb0000000, 0x2, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x1, 0x30000000, 0xb5, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xa0000000, 0xa, 0xff000000, 0x1, 0x80000000,
+  0x218, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xffefefef,
+  0x3c, 0xffffffff, 0x1, 0xff9f9f9f, 0x41, 0xff000000, 0x2, 0xc0000000,
+  0x1, 0x90000000, 0x1, 0x80000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x1, 0x30000000, 0xaa, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000,
+  0xc, 0xff000000, 0x1, 0xf0000000, 0x218, 0x00ffffff, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x3e, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x48, 0xff000000, 0x1, 0xf0000000, 0x1, 0xc0000000, 0x1, 0xb0000000,
+  0x1, 0x80000000, 0x1, 0x70000000, 0x1, 0x40000000, 0x1, 0x30000000,
+  0xa1, 0x00ffffff, 0x1, 0x80000000, 0x1, 0xf0000000, 0xe, 0xff000000,
+  0x1, 0x60000000, 0x216, 0x00ffffff, 0x1, 0x10000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x3f, 0xffffffff, 0x1, 0xff5f5f5f, 0x4f, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xc0000000, 0x1, 0xa0000000, 0x1, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x98, 0x00ffffff, 0x1, 0x60000000,
+  0x1, 0xe0000000, 0x10, 0xff000000, 0x1, 0xe0000000, 0x216, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x41, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f, 0x54, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xc0000000, 0x1, 0x90000000, 0x1, 0x80000000, 0x1, 0x40000000,
+  0x1, 0x30000000, 0x8f, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xd0000000,
+  0x13, 0xff000000, 0x1, 0x40000000, 0x215, 0x00ffffff, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x48, 0xffffffff, 0x9, 0xffbfbfbf,
+  0x1, 0xffafafaf, 0x6, 0xff7f7f7f, 0x5, 0xff3f3f3f, 0x1, 0xff0f0f0f,
+  0x40, 0xff000000, 0x1, 0xd0000000, 0x1, 0xb0000000, 0x1, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x87, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xc0000000, 0x15, 0xff000000, 0x1, 0xa0000000, 0x214, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x62, 0xffffffff,
+  0x1, 0xffefefef, 0x3, 0xffbfbfbf, 0x1, 0xffafafaf, 0x3, 0xff7f7f7f,
+  0x1, 0xff4f4f4f, 0x2, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x37, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xb0000000, 0x1, 0x80000000, 0x1, 0x50000000,
+  0x1, 0x30000000, 0x7f, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xa0000000,
+  0xe, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xff9f9f9f, 0x8, 0xff000000,
+  0x1, 0x10000000, 0x212, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x70, 0xffffffff, 0x1, 0xffefefef,
+  0x2, 0xffbfbfbf, 0x1, 0xffafafaf, 0x2, 0xff7f7f7f, 0x1, 0xff5f5f5f,
+  0x2, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x31, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0xa0000000, 0x1, 0x80000000, 0x1, 0x40000000, 0x1, 0x10000000,
+  0x77, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000, 0xe, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x2, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x7, 0xff000000, 0x1, 0x70000000, 0x210, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xe0000000, 0x9, 0xff000000, 0x1, 0xffdfdfdf, 0x7b, 0xffffffff,
+  0x1, 0xffefefef, 0x2, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff5f5f5f,
+  0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x2d, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x50000000, 0x1, 0x20000000,
+  0x71, 0x00ffffff, 0x1, 0x80000000, 0x1, 0xf0000000, 0xd, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x4, 0xffffffff, 0x1, 0xffafafaf,
+  0x7, 0xff000000, 0x1, 0xe0000000, 0x20e, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xc0000000, 0xa, 0xff000000, 0x1, 0xff4f4f4f, 0x86, 0xffffffff,
+  0x2, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x2, 0xff3f3f3f, 0x2b, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x90000000, 0x1, 0x60000000, 0x1, 0x30000000,
+  0x6a, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xe0000000, 0xe, 0xff000000,
+  0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x6, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0x30000000, 0x20b, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x90000000, 0xc, 0xff000000, 0x1, 0xff9f9f9f, 0x8e, 0xffffffff,
+  0x2, 0xffbfbfbf, 0x1, 0xff7f7f7f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f,
+  0x1, 0xff2f2f2f, 0x28, 0xff000000, 0x1, 0xc0000000, 0x1, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x20000000, 0x63, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xd0000000, 0xe, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf,
+  0x8, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0x90000000,
+  0x20a, 0x00ffffff, 0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff3f3f3f, 0x96, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xffbfbfbf,
+  0x1, 0xff8f8f8f, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff1f1f1f,
+  0x25, 0xff000000, 0x1, 0xf0000000, 0x1, 0xb0000000, 0x1, 0x80000000,
+  0x1, 0x40000000, 0x1, 0x10000000, 0x5c, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xb0000000, 0xe, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffcfcfcf,
+  0xa, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xf0000000,
+  0x208, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xd0000000, 0xd, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x9d, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f,
+  0x24, 0xff000000, 0x1, 0xd0000000, 0x1, 0xa0000000, 0x1, 0x60000000,
+  0x1, 0x30000000, 0x57, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xe0000000,
+  0xd, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffbfbfbf, 0xd, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x50000000, 0x205, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xb0000000, 0xd, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0xa4, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f,
+  0x22, 0xff000000, 0x1, 0xf0000000, 0x1, 0xb0000000, 0x1, 0x80000000,
+  0x1, 0x40000000, 0x52, 0x00ffffff, 0x1, 0x60000000, 0xd, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0xf, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xa0000000, 0x204, 0x00ffffff, 0x1, 0x70000000,
+  0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0xac, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff4f4f4f, 0x1, 0xff2f2f2f, 0x21, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x90000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x4b, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xa0000000, 0xc, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff7f7f7f, 0x11, 0xffffffff, 0x1, 0xffefefef, 0x7, 0xff000000,
+  0x1, 0xf0000000, 0x202, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xd0000000,
+  0xd, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0xb4, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff9f9f9f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f,
+  0x20, 0xff000000, 0x1, 0xd0000000, 0x1, 0x90000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x46, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xc, 0xff000000, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x13, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0x40000000, 0x1ff, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0x90000000, 0xd, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0xbb, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xffafafaf,
+  0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x1e, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x90000000, 0x1, 0x50000000, 0x1, 0x10000000,
+  0x41, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000, 0xb, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0x15, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0x90000000, 0x1fe, 0x00ffffff, 0x1, 0x50000000,
+  0x1, 0xf0000000, 0xc, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f,
+  0xc2, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x1e, 0xff000000, 0x1, 0xd0000000, 0x1, 0x90000000,
+  0x1, 0x50000000, 0x1, 0x10000000, 0x3c, 0x00ffffff, 0x1, 0x90000000,
+  0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x17, 0xffffffff,
+  0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xe0000000, 0x1fc, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xb0000000, 0xd, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0xc8, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff9f9f9f,
+  0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f, 0x1d, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x80000000, 0x1, 0x40000000, 0x37, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xd0000000, 0xb, 0xff000000, 0x1, 0xff6f6f6f, 0x1a, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0x20000000, 0x1fa, 0x00ffffff,
+  0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffbfbfbf, 0xcf, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f,
+  0x1, 0xff4f4f4f, 0x1, 0xff1f1f1f, 0x1b, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xb0000000, 0x1, 0x70000000, 0x1, 0x20000000, 0x32, 0x00ffffff,
+  0x1, 0x50000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x1b, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000,
+  0x1, 0x70000000, 0x1f8, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xc0000000,
+  0xc, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0xd5, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f,
+  0x1b, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x2d, 0x00ffffff, 0x1, 0x80000000, 0xb, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x1c, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x7, 0xff000000, 0x1, 0xb0000000, 0x1f7, 0x00ffffff, 0x1, 0x70000000,
+  0x1, 0xf0000000, 0xc, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0xda, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x1b, 0xff000000, 0x1, 0xc0000000, 0x1, 0x70000000,
+  0x1, 0x30000000, 0x28, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xc0000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x1e, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x6, 0xff000000, 0x1, 0xf0000000, 0x1f5, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xc0000000, 0xc, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0xe1, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x19, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0xa0000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x23, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff9f9f9f,
+  0x20, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1, 0x30000000,
+  0x1f3, 0x00ffffff, 0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff7f7f7f, 0xe7, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f,
+  0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x19, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x70000000, 0x1, 0x20000000, 0x1f, 0x00ffffff, 0x1, 0x70000000,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x21, 0xffffffff,
+  0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0x70000000, 0x1f1, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xb0000000, 0xc, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffdfdfdf, 0xec, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f,
+  0x1, 0xff3f3f3f, 0x19, 0xff000000, 0x1, 0xd0000000, 0x1, 0x90000000,
+  0x1, 0x30000000, 0x1a, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xb0000000,
+  0xb, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0x22, 0xffffffff,
+  0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xb0000000, 0x1f0, 0x00ffffff,
+  0x1, 0x50000000, 0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff8f8f8f, 0xf2, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff2f2f2f, 0x18, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000,
+  0x1, 0x50000000, 0x16, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xe0000000,
+  0xb, 0xff000000, 0x1, 0xff8f8f8f, 0x25, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x6, 0xff000000, 0x1, 0xf0000000, 0x1ee, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x90000000, 0xc, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf,
+  0xf6, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf, 0x1, 0xff6f6f6f,
+  0x1, 0xff1f1f1f, 0x17, 0xff000000, 0x1, 0xf0000000, 0x1, 0xa0000000,
+  0x1, 0x60000000, 0x1, 0x10000000, 0x11, 0x00ffffff, 0x1, 0x60000000,
+  0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x26, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0x20000000, 0x1ec, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff8f8f8f, 0xfc, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f,
+  0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x17, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x60000000, 0x1, 0x10000000, 0xc, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xa0000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x27, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0x50000000,
+  0x1eb, 0x00ffffff, 0x1, 0x70000000, 0xc, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffdfdfdf, 0x101, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff6f6f6f,
+  0x1, 0xff2f2f2f, 0x17, 0xff000000, 0x1, 0xb0000000, 0x1, 0x60000000,
+  0x1, 0x10000000, 0x8, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x29, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1e9, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xc0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f,
+  0x106, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f,
+  0x1, 0xff0f0f0f, 0x16, 0xff000000, 0x1, 0xd0000000, 0x1, 0x70000000,
+  0x1, 0x20000000, 0x4, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf, 0x2b, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xc0000000, 0x1e8, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf,
+  0x10b, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f,
+  0x16, 0xff000000, 0x1, 0xb0000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x1, 0x90000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf,
+  0x2c, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xe0000000,
+  0x1e7, 0x00ffffff, 0x1, 0x80000000, 0xc, 0xff000000, 0x1, 0xff8f8f8f,
+  0x110, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff2f2f2f,
+  0x21, 0xff000000, 0x1, 0xff6f6f6f, 0x2e, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x1e5, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xc0000000,
+  0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x114, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x1c, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x2f, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1e3, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff6f6f6f, 0x1, 0xffefefef,
+  0x118, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x17, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf,
+  0x30, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x50000000,
+  0x1e2, 0x00ffffff, 0x1, 0x70000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x11e, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff1f1f1f, 0x13, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0x31, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1e0, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xb0000000, 0xb, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffefefef, 0x122, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0xf, 0xff000000, 0x1, 0xff9f9f9f,
+  0x34, 0xffffffff, 0x7, 0xff000000, 0x1, 0x90000000, 0x1df, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xd0000000, 0xb, 0xff000000, 0x1, 0xff7f7f7f,
+  0x127, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f,
+  0xa, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x35, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1de, 0x00ffffff,
+  0x1, 0x50000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffbfbfbf, 0x12b, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff6f6f6f,
+  0x1, 0xff1f1f1f, 0x6, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef,
+  0x36, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x1dd, 0x00ffffff, 0x1, 0x80000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x12f, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x1, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff8f8f8f,
+  0x38, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1db, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xb0000000, 0xb, 0xff000000, 0x1, 0xff7f7f7f,
+  0x16f, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1da, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffbfbfbf, 0x170, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x10000000, 0x1d8, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x171, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0x40000000, 0x1d7, 0x00ffffff,
+  0x1, 0x60000000, 0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0x172, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1d6, 0x00ffffff, 0x1, 0x90000000, 0xb, 0xff000000, 0x1, 0xff9f9f9f,
+  0x174, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1d4, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xb0000000, 0xa, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x175, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1d3, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x176, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1d2, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xe0000000, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x177, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x50000000, 0x1d1, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x17a, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1d0, 0x00ffffff, 0x1, 0x60000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x17b, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1cf, 0x00ffffff, 0x1, 0x60000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x17b, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x7, 0xff000000, 0x1, 0x60000000, 0x1ce, 0x00ffffff,
+  0x1, 0x90000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf,
+  0x17c, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1cd, 0x00ffffff, 0x1, 0xa0000000, 0xa, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x17d, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1cb, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xa0000000,
+  0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x17f, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1ca, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x180, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1c9, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff9f9f9f,
+  0x181, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1c8, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x182, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1c7, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x183, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1c7, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x184, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1c6, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x185, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1c5, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x186, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x6, 0xff000000, 0x1, 0xf0000000, 0x1c4, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x187, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1c3, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x188, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1c2, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x189, 0xffffffff, 0x1, 0xff2f2f2f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1c1, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18b, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x90000000, 0x1c0, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18c, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1bf, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18d, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1be, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18d, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x7, 0xff000000, 0x1, 0x70000000, 0x1bd, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18e, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1bc, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f,
+  0x18f, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1bc, 0x00ffffff, 0x1, 0xc0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f,
+  0x190, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1bb, 0x00ffffff, 0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x190, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000,
+  0x1, 0x20000000, 0x1ba, 0x00ffffff, 0x1, 0xa0000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x191, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1ba, 0x00ffffff, 0x1, 0x80000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x192, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1b9, 0x00ffffff, 0x1, 0x60000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x193, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1b8, 0x00ffffff, 0x1, 0x60000000, 0x9, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x194, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1b7, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x195, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xd0000000, 0x1b6, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x196, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1b5, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xffcfcfcf, 0x197, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1b4, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x198, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1b4, 0x00ffffff,
+  0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x199, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1b3, 0x00ffffff,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff6f6f6f, 0x19a, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1b2, 0x00ffffff,
+  0x1, 0x60000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x19b, 0xffffffff,
+  0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xb0000000, 0x1b1, 0x00ffffff,
+  0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x19c, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1b0, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x19c, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1af, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x19d, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1af, 0x00ffffff, 0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xffcfcfcf,
+  0x19e, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1ae, 0x00ffffff,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x19f, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1ad, 0x00ffffff, 0x1, 0x50000000,
+  0x9, 0xff000000, 0x1, 0xff6f6f6f, 0x1a0, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1ac, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xf0000000,
+  0x8, 0xff000000, 0x1, 0xff4f4f4f, 0x1a1, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1ab, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x1a1, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1ab, 0x00ffffff, 0x1, 0xa0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1a2, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1aa, 0x00ffffff, 0x1, 0x70000000,
+  0x9, 0xff000000, 0x1, 0xffbfbfbf, 0x1a3, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a9, 0x00ffffff, 0x1, 0x30000000, 0x9, 0xff000000,
+  0x1, 0xff8f8f8f, 0x1a4, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a8, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1a5, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a8, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x1a5, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a7, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x1a6, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a6, 0x00ffffff, 0x1, 0x40000000, 0x9, 0xff000000, 0x1, 0xffafafaf,
+  0x1a7, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a5, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f,
+  0x1a8, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a5, 0x00ffffff,
+  0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1a9, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1a4, 0x00ffffff, 0x1, 0x70000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x1a9, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1a3, 0x00ffffff, 0x1, 0x30000000,
+  0x9, 0xff000000, 0x1, 0xffbfbfbf, 0x1aa, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a2, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x150, 0xffffffff, 0x1, 0xffefefef,
+  0x2, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x4, 0xff7f7f7f, 0x1, 0xff8f8f8f,
+  0x2, 0xffbfbfbf, 0x1, 0xffefefef, 0x4f, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a2, 0x00ffffff, 0x1, 0x90000000, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x14c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f,
+  0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f, 0xd, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x1, 0xffafafaf, 0x1, 0xffefefef,
+  0x4a, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a1, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf,
+  0x149, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f,
+  0x16, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xff7f7f7f, 0x1, 0xffcfcfcf,
+  0x47, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a0, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x147, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f,
+  0x1c, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff8f8f8f, 0x1, 0xffefefef,
+  0x44, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a0, 0x00ffffff,
+  0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x146, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0x22, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffdfdfdf, 0x42, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x19f, 0x00ffffff, 0x1, 0x60000000, 0x8, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffefefef, 0x144, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f,
+  0x26, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0x40, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x19e, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xffcfcfcf, 0x143, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff4f4f4f, 0x2a, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0x3e, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x19e, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0x143, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff0f0f0f, 0x2c, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x3d, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x90000000, 0x19d, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x142, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0x10, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff4f4f4f, 0x1, 0xff7f7f7f,
+  0x1, 0xffafafaf, 0x1, 0xffbfbfbf, 0x1, 0xffcfcfcf, 0x4, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf, 0x1, 0xff9f9f9f, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x11, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef,
+  0x3b, 0xffffffff, 0x1, 0xff2f2f2f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x19c, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x141, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0xe, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xff9f9f9f,
+  0x1, 0xffdfdfdf, 0x10, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff7f7f7f,
+  0x1, 0xff2f2f2f, 0xe, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x3a, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x19c, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f,
+  0x141, 0xffffffff, 0x1, 0xff9f9f9f, 0xd, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xff9f9f9f, 0x1, 0xffefefef, 0x16, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff7f7f7f, 0x1, 0xff1f1f1f, 0xd, 0xff000000, 0x1, 0xff9f9f9f,
+  0x39, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x19b, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x141, 0xffffffff, 0x1, 0xff9f9f9f, 0xc, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffbfbfbf, 0x1c, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff3f3f3f,
+  0xc, 0xff000000, 0x1, 0xff8f8f8f, 0x38, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x19a, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf,
+  0x140, 0xffffffff, 0x1, 0xff9f9f9f, 0xb, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffbfbfbf, 0x20, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x37, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x60000000, 0x199, 0x00ffffff, 0x1, 0xb0000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x140, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0x24, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xff8f8f8f,
+  0x36, 0xffffffff, 0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0xa0000000,
+  0x197, 0x00ffffff, 0x1, 0x50000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x140, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffdfdfdf, 0x26, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff3f3f3f,
+  0xa, 0xff000000, 0x1, 0xff9f9f9f, 0x35, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0xc0000000, 0x1, 0x10000000, 0x194, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffdfdfdf, 0x13f, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xff6f6f6f, 0x2a, 0xffffffff, 0x1, 0xff7f7f7f,
+  0xa, 0xff000000, 0x1, 0xff9f9f9f, 0x34, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0xd0000000, 0x1, 0x20000000, 0x193, 0x00ffffff,
+  0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x13f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000, 0x1, 0xff9f9f9f,
+  0x2c, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xffbfbfbf,
+  0x34, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x191, 0x00ffffff, 0x1, 0x4c000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x140, 0xffffffff, 0x1, 0xff4f4f4f, 0x9, 0xff000000,
+  0x1, 0xff9f9f9f, 0x2e, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff,
+  0x1, 0xff7f7f7f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x18f, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf9000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x13f, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x30, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x18e, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0x13f, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xff9f9f9f, 0x32, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0x70000000, 0x18c, 0x00ffffff,
+  0x1, 0x4a000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x140, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x34, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x34, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x18b, 0x00ffffff, 0x1, 0xef000000, 0x7, 0xff000000,
+  0x1, 0xff080808, 0x1, 0xffbfbfbf, 0x62, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff6f6f6f, 0x4, 0xff2f2f2f, 0x1, 0xff686868, 0x1, 0xff8f8f8f,
+  0x1, 0xffcfcfcf, 0xd4, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x36, 0xffffffff, 0x1, 0xff8f8f8f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff4f4f4f, 0xa, 0xff000000, 0x1, 0xa0000000, 0x189, 0x00ffffff,
+  0x1, 0x82000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x61, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0xff010101,
+  0x1, 0xff000000, 0x1, 0xff131313, 0x1, 0xff777777, 0x1, 0xffefefef,
+  0xd1, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffdfdfdf, 0x37, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x35, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0xa0000000, 0x187, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf4000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x60, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff070707, 0xb, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff070707, 0x1, 0xff8f8f8f, 0xcf, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x39, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f,
+  0x35, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x185, 0x00ffffff, 0x1, 0xb0000000, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x60, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff070707,
+  0xf, 0xff000000, 0x1, 0xff535353, 0xce, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0xff3f3f3f, 0xb, 0xffffffff, 0x1, 0xffe2e1fc,
+  0x1, 0xffb5b0f8, 0x3, 0xffa49ef7, 0x1, 0xffc0bcf9, 0x1, 0xffe2e1fc,
+  0x29, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xff9f9f9f,
+  0x35, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x183, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff4f4f4f, 0x61, 0xffffffff, 0x1, 0xff171717, 0x10, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff4d4d4d, 0xcc, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xffcfcfcf, 0xa, 0xffffffff, 0x1, 0xffccc8fa,
+  0x7, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x29, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x35, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000,
+  0x182, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x60, 0xffffffff, 0x1, 0xff9f9f9f, 0x13, 0xff000000,
+  0x1, 0xff777777, 0xcb, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0xa, 0xffffffff, 0x1, 0xffe8e7fd, 0x9, 0xffa49ef7,
+  0x1, 0xffccc8fa, 0x13, 0xffffffff, 0x1, 0xffe2e1fc, 0x1, 0xffccc8fa,
+  0x2, 0xffbab6f9, 0x1, 0xffccc8fa, 0x1, 0xffe2e1fc, 0x10, 0xffffffff,
+  0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x35, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x180, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xff8f8f8f, 0x61, 0xffffffff, 0x1, 0xff131313, 0x13, 0xff000000,
+  0x1, 0xff070707, 0x1, 0xffdfdfdf, 0xc9, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0xa, 0xffffffff, 0x1, 0xffc6c2fa,
+  0xa, 0xffa49ef7, 0x1, 0xfff4f3fe, 0x10, 0xffffffff, 0x1, 0xffdddafc,
+  0x1, 0xffafaaf8, 0x6, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xffe8e7fd,
+  0xf, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x34, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x17e, 0x00ffffff,
+  0x1, 0x20000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f, 0x61, 0xffffffff,
+  0x1, 0xffafafaf, 0x14, 0xff000000, 0x1, 0xff020202, 0x1, 0xff686868,
+  0xc9, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xff5f5f5f,
+  0xb, 0xffffffff, 0x1, 0xffafaaf8, 0xa, 0xffa49ef7, 0x1, 0xffd7d4fb,
+  0xe, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffc0bcf9, 0xa, 0xffa49ef7,
+  0x1, 0xffdddafc, 0xf, 0xffffffff, 0x1, 0xff6f6f6f, 0xa, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x34, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000,
+  0x17d, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xffcfcfcf,
+  0x61, 0xffffffff, 0x1, 0xff535353, 0x15, 0xff000000, 0x1, 0xff131313,
+  0xc8, 0xffffffff, 0x1, 0xffefefef, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0xb, 0xffffffff, 0xb, 0xffa49ef7, 0x1, 0xffc0bcf9, 0xe, 0xffffffff,
+  0x1, 0xffb5b0f8, 0xb, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x10, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf,
+  0x34, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x17b, 0x00ffffff, 0x1, 0x50000000,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x62, 0xffffffff, 0x1, 0xff080808,
+  0x16, 0xff000000, 0x1, 0xffdfdfdf, 0xc7, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xff3f3f3f, 0xc, 0xffffffff, 0x1, 0xffa9a4f7,
+  0xa, 0xffa49ef7, 0x1, 0xffbab6f9, 0xd, 0xffffffff, 0x1, 0xffccc8fa,
+  0xd, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x10, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x34, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000,
+  0x179, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x61, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x17, 0xff000000, 0x1, 0xffbfbfbf, 0xc7, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x7, 0xff000000, 0x1, 0xff9f9f9f, 0xc, 0xffffffff, 0x1, 0xffbab6f9,
+  0xa, 0xffa49ef7, 0x1, 0xffccc8fa, 0xc, 0xffffffff, 0x1, 0xffe8e7fd,
+  0xe, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x11, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x34, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xd0000000,
+  0x179, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x62, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff020202, 0x16, 0xff000000,
+  0x1, 0xffbfbfbf, 0x3c, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff4f4f4f,
+  0x1, 0xff3f3f3f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x85, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0xd, 0xffffffff,
+  0x1, 0xffd7d4fb, 0xa, 0xffa49ef7, 0x1, 0xffe2e1fc, 0xc, 0xffffffff,
+  0x1, 0xffc6c2fa, 0xe, 0xffa49ef7, 0x1, 0xfff4f3fe, 0x12, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xa, 0xff000000, 0x1, 0xff9f9f9f,
+  0x34, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xa0000000, 0x177, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x63, 0xffffffff, 0x1, 0xff7f7f7f, 0x17, 0xff000000,
+  0x1, 0xffbfbfbf, 0x1c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf,
+  0x1, 0xffefefef, 0x1c, 0xffffffff, 0x1, 0xff9f9f9f, 0x4, 0xff000000,
+  0x1, 0xff2f2f2f, 0x85, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0xd, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffa9a4f7,
+  0x8, 0xffa49ef7, 0x1, 0xffb5b0f8, 0xd, 0xffffffff, 0x1, 0xffbab6f9,
+  0xd, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x14, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x35, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xa0000000,
+  0x176, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0x63, 0xffffffff, 0x1, 0xff404040, 0x17, 0xff000000, 0x1, 0xffbfbfbf,
+  0x1a, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f, 0x2, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x1a, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x5, 0xff000000, 0x1, 0xffafafaf, 0x84, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0xffcfcfcf, 0xe, 0xffffffff,
+  0x1, 0xffeeedfd, 0x1, 0xffa9a4f7, 0x6, 0xffa49ef7, 0x1, 0xffb5b0f8,
+  0x1, 0xfff9f9fe, 0xd, 0xffffffff, 0x1, 0xffbab6f9, 0xc, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xfff4f3fe, 0x16, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x8, 0xff000000, 0x1, 0xff4f4f4f, 0x36, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xa0000000, 0x174, 0x00ffffff,
+  0x1, 0x50000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x64, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x17, 0xff000000, 0x1, 0xffcfcfcf, 0x1a, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x5, 0xff000000, 0x1, 0xffdfdfdf, 0x18, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x83, 0xffffffff, 0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0x10, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffc0bcf9, 0x3, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x1, 0xffd1cefb, 0x1, 0xfff9f9fe, 0xe, 0xffffffff,
+  0x1, 0xffd1cefb, 0xb, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffeeedfd,
+  0x18, 0xffffffff, 0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0xff8f8f8f,
+  0x37, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0x70000000, 0x172, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x64, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x17, 0xff000000, 0x1b, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x5, 0xff000000, 0x1, 0xff7f7f7f, 0x17, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x61, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff535353, 0x3, 0xff2f2f2f,
+  0x1, 0xff7f7f7f, 0x1, 0xffdfdfdf, 0x19, 0xffffffff, 0x1, 0xffafafaf,
+  0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x26, 0xffffffff, 0x1, 0xfff9f9fe,
+  0x1, 0xffbab6f9, 0x9, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xffeeedfd,
+  0x1a, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f, 0x4, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x38, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0x60000000, 0x171, 0x00ffffff,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffafafaf, 0x65, 0xffffffff,
+  0x1, 0xff686868, 0x16, 0xff000000, 0x1, 0xff131313, 0x1b, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x5, 0xff000000, 0x1, 0xff1f1f1f, 0x16, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xff3f3f3f, 0x5f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff7f7f7f, 0x1, 0xff090909, 0x5, 0xff000000,
+  0x1, 0xff020202, 0x1, 0xff000000, 0x1, 0xff686868, 0x1, 0xffefefef,
+  0x17, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1, 0xffcfcfcf,
+  0x28, 0xffffffff, 0x1, 0xffdddafc, 0x1, 0xffb5b0f8, 0x5, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x1, 0xffdddafc, 0x1d, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff5f5f5f, 0x2, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x1, 0xffefefef,
+  0x3a, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0x50000000, 0x16f, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x66, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff020202,
+  0x15, 0xff000000, 0x1, 0xff333333, 0x1b, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x6, 0xff000000, 0x1, 0xff9f9f9f, 0x13, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0xc, 0xff000000, 0x1, 0xff8f8f8f, 0x5d, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff151515, 0x1, 0xff020202, 0x8, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff262626, 0x1, 0xffefefef, 0x16, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x2b, 0xffffffff,
+  0x1, 0xfff9f9fe, 0x3, 0xffe8e7fd, 0x1, 0xfff4f3fe, 0x60, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x16e, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x66, 0xffffffff, 0x1, 0xffcfcfcf, 0x15, 0xff000000,
+  0x1, 0xff020202, 0x1, 0xff8f8f8f, 0x1b, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x11, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f, 0xe, 0xff000000, 0x1, 0xffcfcfcf,
+  0x5b, 0xffffffff, 0x1, 0xff595959, 0xc, 0xff000000, 0x1, 0xff010101,
+  0x1, 0xff262626, 0x1, 0xffefefef, 0x15, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0xff4f4f4f, 0x91, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0xf0000000, 0x1, 0x20000000, 0x16c, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x68, 0xffffffff,
+  0x1, 0xff151515, 0x15, 0xff000000, 0x1, 0xffdfdfdf, 0x1c, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0xf, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x58, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff262626, 0x1, 0xff010101, 0xd, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff595959, 0x14, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x92, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x16b, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x68, 0xffffffff, 0x1, 0xff9f9f9f, 0x14, 0xff000000, 0x1, 0xff535353,
+  0x1d, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0xb, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffcfcfcf,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x15, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff4f4f4f, 0x2, 0xff3f3f3f, 0x1, 0xffbfbfbf,
+  0x3d, 0xffffffff, 0x1, 0xff454545, 0x1, 0xff010101, 0x10, 0xff000000,
+  0x1, 0xffafafaf, 0x13, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x93, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0xb0000000, 0x16a, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x6a, 0xffffffff, 0x1, 0xff262626, 0x12, 0xff000000,
+  0x1, 0xff080808, 0x1, 0xffdfdfdf, 0x1e, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0x1, 0xffefefef,
+  0x6, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f,
+  0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x2, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf, 0x13, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0x4, 0xff000000, 0x1, 0xffbfbfbf,
+  0x3b, 0xffffffff, 0x1, 0xff7f7f7f, 0x12, 0xff000000, 0x1, 0xff090909,
+  0x1, 0xffefefef, 0x12, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0x94, 0xffffffff, 0x1, 0xff8f8f8f, 0x9, 0xff000000,
+  0x1, 0xa0000000, 0x168, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x6b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff090909, 0x11, 0xff000000, 0x1, 0xffafafaf, 0x1f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xff4f4f4f, 0x1, 0xff7f7f7f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f,
+  0x1, 0xff1f1f1f, 0xc, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf,
+  0x4, 0xffffffff, 0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0xff6f6f6f,
+  0x1, 0xffefefef, 0xf, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff4f4f4f,
+  0x6, 0xff000000, 0x1, 0xff4f4f4f, 0x3a, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff070707, 0x12, 0xff000000, 0x1, 0xff020202, 0x1, 0xff7f7f7f,
+  0x12, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x96, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0x60000000, 0x167, 0x00ffffff,
+  0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xffcfcfcf, 0x6c, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff232323, 0x1, 0xff020202, 0xc, 0xff000000,
+  0x1, 0xff020202, 0x1, 0xff080808, 0x1, 0xffafafaf, 0x21, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x19, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffdfdfdf, 0x5, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0xb, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x3a, 0xffffffff, 0x1, 0xff595959, 0x1, 0xff020202,
+  0x13, 0xff000000, 0x1, 0xff131313, 0x12, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x97, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x9, 0xff000000, 0x1, 0x30000000, 0x165, 0x00ffffff, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x6f, 0xffffffff, 0x1, 0xff777777,
+  0x1, 0xff070707, 0x1, 0xff020202, 0x8, 0xff000000, 0x1, 0xff020202,
+  0x1, 0xff000000, 0x1, 0xff535353, 0x1, 0xffdfdfdf, 0x23, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x16, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x8, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0xa, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xff8f8f8f, 0x1, 0xffbfbfbf,
+  0x4, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x39, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff080808, 0x15, 0xff000000, 0x1, 0xffcfcfcf,
+  0x11, 0xffffffff, 0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x97, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x8, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x20000000, 0x164, 0x00ffffff, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x70, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff404040, 0x1, 0xff080808,
+  0x5, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xff8f8f8f, 0x1, 0xffdfdfdf,
+  0x26, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x13, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0xa, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x1d, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x39, 0xffffffff, 0x1, 0xffafafaf, 0x16, 0xff000000,
+  0x1, 0xff7f7f7f, 0x11, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x21, 0xffffffff, 0x1, 0xfff4f3fe, 0x4, 0xffe8e7fd, 0x1, 0xfff9f9fe,
+  0x71, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x162, 0x00ffffff, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x76, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xffbfbfbf, 0x2c, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f,
+  0x10, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0xd, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0x1b, 0xff000000,
+  0x1, 0xff6f6f6f, 0x3b, 0xffffffff, 0x1, 0xff686868, 0x16, 0xff000000,
+  0x1, 0xff404040, 0x11, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0xe, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffd7d4fb, 0x2, 0xffd1cefb,
+  0x1, 0xffdddafc, 0x1, 0xfff9f9fe, 0xb, 0xffffffff, 0x1, 0xffdddafc,
+  0x1, 0xffafaaf8, 0x6, 0xffa49ef7, 0x1, 0xffafaaf8, 0x1, 0xffccc8fa,
+  0x1, 0xffeeedfd, 0x6f, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0xa0000000, 0x161, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0xa7, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff5f5f5f, 0x1, 0xffafafaf, 0x12, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0x17, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0x3c, 0xffffffff, 0x1, 0xff2f2f2f, 0x16, 0xff000000,
+  0x1, 0xff2f2f2f, 0x11, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0xc, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffc0bcf9, 0x5, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x1, 0xffeeedfd, 0x9, 0xffffffff, 0x1, 0xffc6c2fa,
+  0xb, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1, 0xffe8e7fd, 0x6e, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0x60000000, 0x160, 0x00ffffff,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0xaa, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x2, 0xff3f3f3f, 0x2, 0xff7f7f7f, 0x1, 0xffafafaf, 0x1, 0xffdfdfdf,
+  0x16, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0x14, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x3d, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x16, 0xff000000, 0x1, 0xff2f2f2f, 0x10, 0xffffffff,
+  0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0xb, 0xffffffff,
+  0x1, 0xffeeedfd, 0x1, 0xffa9a4f7, 0x7, 0xffa49ef7, 0x1, 0xffafaaf8,
+  0x1, 0xfff9f9fe, 0x7, 0xffffffff, 0x1, 0xffd1cefb, 0xe, 0xffa49ef7,
+  0x1, 0xffc0bcf9, 0x1, 0xfff9f9fe, 0x6d, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x9, 0xff000000, 0x1, 0x30000000, 0x15e, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0xcd, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff6f6f6f, 0x1, 0xff0f0f0f, 0xf, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff8f8f8f, 0x1, 0xffefefef, 0x3f, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x16, 0xff000000, 0x1, 0xff2f2f2f, 0x10, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xa, 0xffffffff,
+  0x1, 0xfff9f9fe, 0x1, 0xffa9a4f7, 0x9, 0xffa49ef7, 0x1, 0xffd1cefb,
+  0x6, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffa9a4f7, 0xf, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x1, 0xffeeedfd, 0x6d, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000, 0x15d, 0x00ffffff,
+  0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf, 0xd0, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xff7f7f7f, 0x1, 0xffcfcfcf, 0x42, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x16, 0xff000000, 0x1, 0xff2f2f2f, 0x10, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xa, 0xffffffff,
+  0x1, 0xffc6c2fa, 0xa, 0xffa49ef7, 0x1, 0xffafaaf8, 0x6, 0xffffffff,
+  0x1, 0xffdddafc, 0x11, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffeeedfd,
+  0x6c, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x8, 0xff000000,
+  0x1, 0xb0000000, 0x15c, 0x00ffffff, 0x1, 0x30000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0xd5, 0xffffffff, 0x1, 0xffcfcfcf, 0x5, 0xffbfbfbf,
+  0x1, 0xffdfdfdf, 0x46, 0xffffffff, 0x1, 0xff6f6f6f, 0x16, 0xff000000,
+  0x1, 0xff7f7f7f, 0x10, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000,
+  0x1, 0xff8f8f8f, 0x9, 0xffffffff, 0x1, 0xfff4f3fe, 0xc, 0xffa49ef7,
+  0x1, 0xfff4f3fe, 0x5, 0xffffffff, 0x1, 0xffccc8fa, 0x12, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x1, 0xfff9f9fe, 0x6c, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x70000000, 0x15b, 0x00ffffff,
+  0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x122, 0xffffffff, 0x1, 0xffafafaf, 0x16, 0xff000000, 0x1, 0xff9f9f9f,
+  0x11, 0xffffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x9, 0xffffffff,
+  0x1, 0xffe2e1fc, 0xc, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x5, 0xffffffff,
+  0x1, 0xffbab6f9, 0x13, 0xffa49ef7, 0x1, 0xffc0bcf9, 0x6d, 0xffffffff,
+  0x1, 0xffafafaf, 0x9, 0xff000000, 0x1, 0x30000000, 0x159, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff9f9f9f, 0x124, 0xffffffff,
+  0x1, 0xff131313, 0x15, 0xff000000, 0x1, 0xffdfdfdf, 0x11, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x9, 0xffffffff, 0x1, 0xffd1cefb,
+  0xc, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x5, 0xffffffff, 0x1, 0xffbab6f9,
+  0x14, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x6d, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000, 0x158, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x125, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x14, 0xff000000, 0x1, 0xff454545, 0x12, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x9, 0xffffffff, 0x1, 0xffd7d4fb,
+  0xc, 0xffa49ef7, 0x1, 0xfff9f9fe, 0x5, 0xffffffff, 0x1, 0xffbab6f9,
+  0x14, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x6e, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x8, 0xff000000, 0x1, 0xb0000000, 0x157, 0x00ffffff, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x126, 0xffffffff, 0x1, 0xff333333,
+  0x1, 0xff010101, 0x12, 0xff000000, 0x1, 0xffbfbfbf, 0x12, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x9, 0xffffffff, 0x1, 0xffeeedfd,
+  0xb, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x6, 0xffffffff, 0x1, 0xffbab6f9,
+  0x15, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x6d, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x60000000, 0x155, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x127, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff262626, 0x1, 0xff010101,
+  0xf, 0xff000000, 0x1, 0xff020202, 0x1, 0xff686868, 0x13, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0xa, 0xffffffff,
+  0x1, 0xffafaaf8, 0xa, 0xffa49ef7, 0x1, 0xffe2e1fc, 0x6, 0xffffffff,
+  0x1, 0xffbab6f9, 0x15, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x6e, 0xffffffff,
+  0x1, 0xffafafaf, 0x8, 0xff000000, 0x1, 0xf0000000, 0x1, 0x20000000,
+  0x154, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0x128, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff262626, 0xe, 0xff000000,
+  0x1, 0xff020202, 0x1, 0xff4d4d4d, 0x14, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0xa, 0xffffffff, 0x1, 0xffe2e1fc,
+  0x9, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x7, 0xffffffff, 0x1, 0xffc6c2fa,
+  0x15, 0xffa49ef7, 0x1, 0xffafaaf8, 0x6f, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x8, 0xff000000, 0x1, 0xd0000000, 0x153, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x12b, 0xffffffff,
+  0x1, 0xff777777, 0x1, 0xff070707, 0x1, 0xff020202, 0xb, 0xff000000,
+  0x1, 0xff686868, 0x15, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000,
+  0xb, 0xffffffff, 0x1, 0xffdddafc, 0x7, 0xffa49ef7, 0x1, 0xffd1cefb,
+  0x8, 0xffffffff, 0x1, 0xffd1cefb, 0x16, 0xffa49ef7, 0x1, 0xfff9f9fe,
+  0x6f, 0xffffffff, 0x1, 0xff2f2f2f, 0x8, 0xff000000, 0x1, 0x80000000,
+  0x152, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x12c, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff777777,
+  0x1, 0xff131313, 0x1, 0xff000000, 0x1, 0xff020202, 0x6, 0xff000000,
+  0x1, 0xff454545, 0x1, 0xffbfbfbf, 0x16, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xffefefef, 0xb, 0xffffffff, 0x1, 0xfff4f3fe,
+  0x1, 0xffccc8fa, 0x3, 0xffbab6f9, 0x1, 0xffd7d4fb, 0x1, 0xfff4f3fe,
+  0x9, 0xffffffff, 0x1, 0xffe8e7fd, 0x16, 0xffa49ef7, 0x1, 0xffe8e7fd,
+  0x6f, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0x30000000, 0x150, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0x130, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff9f9f9f,
+  0x4, 0xff7f7f7f, 0x1, 0xffafafaf, 0x1, 0xffefefef, 0x18, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x1c, 0xffffffff,
+  0x16, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x70, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xd0000000, 0x150, 0x00ffffff, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x150, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xff8f8f8f, 0x1c, 0xffffffff,
+  0x1, 0xffc0bcf9, 0x15, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x71, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x8, 0xff000000, 0x1, 0x80000000, 0x14e, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff9f9f9f, 0x151, 0xffffffff,
+  0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x1c, 0xffffffff,
+  0x1, 0xffdddafc, 0x15, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x71, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x30000000,
+  0x14d, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0x153, 0xffffffff, 0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1c, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffa9a4f7, 0x14, 0xffa49ef7,
+  0x73, 0xffffffff, 0x1, 0xffafafaf, 0x8, 0xff000000, 0x1, 0xd0000000,
+  0x14c, 0x00ffffff, 0x1, 0x50000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x153, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1d, 0xffffffff,
+  0x1, 0xffd1cefb, 0x13, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x74, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x8, 0xff000000, 0x1, 0x80000000, 0x14b, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x154, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xffcfcfcf, 0x1c, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x1, 0xffa9a4f7, 0x12, 0xffa49ef7, 0x1, 0xffdddafc,
+  0x74, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x8, 0xff000000,
+  0x1, 0x20000000, 0x149, 0x00ffffff, 0x1, 0x60000000, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x154, 0xffffffff, 0x1, 0xffafafaf, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x1d, 0xffffffff, 0x1, 0xffd1cefb, 0x11, 0xffa49ef7,
+  0x1, 0xffafaaf8, 0x76, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xc0000000, 0x149, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff4f4f4f, 0x155, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1d, 0xffffffff, 0x1, 0xfff9f9fe, 0x1, 0xffafaaf8,
+  0x10, 0xffa49ef7, 0x1, 0xffe2e1fc, 0x77, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x8, 0xff000000, 0x1, 0x60000000, 0x147, 0x00ffffff, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x156, 0xffffffff, 0x1, 0xff0f0f0f,
+  0x6, 0xff000000, 0x1, 0xff2f2f2f, 0x1e, 0xffffffff, 0x1, 0xffeeedfd,
+  0xf, 0xffa49ef7, 0x1, 0xffccc8fa, 0x78, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x145, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x157, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0x1e, 0xffffffff, 0x1, 0xffdddafc, 0xd, 0xffa49ef7,
+  0x1, 0xffc6c2fa, 0x7a, 0xffffffff, 0x1, 0xffafafaf, 0x8, 0xff000000,
+  0x1, 0xa0000000, 0x145, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x157, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x1f, 0xffffffff, 0x1, 0xffdddafc, 0xb, 0xffa49ef7,
+  0x1, 0xffd1cefb, 0x7c, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x143, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x158, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x20, 0xffffffff, 0x1, 0xffeeedfd,
+  0x1, 0xffb5b0f8, 0x7, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1, 0xffeeedfd,
+  0x7d, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0xd0000000, 0x143, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x159, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x22, 0xffffffff, 0x1, 0xffe2e1fc, 0x1, 0xffc6c2fa,
+  0x3, 0xffbab6f9, 0x1, 0xffd1cefb, 0x1, 0xffeeedfd, 0x80, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x8, 0xff000000, 0x1, 0x60000000, 0x141, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x15a, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0xaa, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x140, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x15a, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0xa9, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0x90000000, 0x13f, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x15b, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xff6f6f6f, 0xaa, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x8, 0xff000000, 0x1, 0x20000000, 0x13e, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x15c, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0xaa, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xc0000000, 0x13d, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x15d, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xffdfdfdf,
+  0xaa, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000, 0x1, 0x40000000,
+  0x13c, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x15d, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0xab, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0xd0000000, 0x13b, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x15e, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x7, 0xff000000, 0x1, 0xff4f4f4f, 0xab, 0xffffffff, 0x1, 0xffafafaf,
+  0x8, 0xff000000, 0x1, 0x60000000, 0x13a, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x15f, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xffefefef, 0xab, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xe0000000, 0x13a, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x160, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0xab, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0x60000000, 0x138, 0x00ffffff,
+  0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x160, 0xffffffff, 0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0xac, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x10000000, 0x137, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x162, 0xffffffff, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0xab, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000,
+  0x1, 0x80000000, 0x136, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x162, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x1, 0xff8f8f8f, 0xac, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000, 0x135, 0x00ffffff,
+  0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x163, 0xffffffff,
+  0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0xac, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x134, 0x00ffffff, 0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0x164, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xffcfcfcf,
+  0xac, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x10000000, 0x133, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x165, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0xac, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x132, 0x00ffffff, 0x1, 0x10000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x165, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0xac, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x131, 0x00ffffff, 0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x167, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xff8f8f8f,
+  0xac, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x131, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x167, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0xad, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xe0000000, 0x130, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x169, 0xffffffff, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0xac, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f,
+  0x7, 0xff000000, 0x1, 0x60000000, 0x12f, 0x00ffffff, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x169, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0xad, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xe0000000, 0x12e, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x169, 0xffffffff,
+  0x1, 0xffefefef, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0xac, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x60000000,
+  0x12d, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0x16b, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0xad, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x12d, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xffafafaf,
+  0x16b, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0xac, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0x40000000,
+  0x12b, 0x00ffffff, 0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x16d, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0xad, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xa0000000,
+  0x12b, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f,
+  0x16d, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xff9f9f9f,
+  0xac, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0x20000000,
+  0x12a, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xffafafaf,
+  0x16e, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0xad, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x90000000,
+  0x12a, 0x00ffffff, 0x1, 0xf0000000, 0x6, 0xff000000, 0x1, 0xff0f0f0f,
+  0x16f, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0xac, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x10000000, 0x128, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x170, 0xffffffff, 0x1, 0xff5f5f5f, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0xac, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0x60000000, 0x128, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x170, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x8, 0xff000000, 0x1, 0xff5f5f5f, 0xac, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xd0000000, 0x128, 0x00ffffff, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xffefefef, 0x171, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0xab, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x30000000, 0x127, 0x00ffffff,
+  0x1, 0xf0000000, 0x6, 0xff000000, 0x1, 0xff2f2f2f, 0x77, 0xffffffff,
+  0x1f, 0xffbfbfbf, 0x1, 0xffefefef, 0xdb, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0xac, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1, 0xa0000000, 0x126, 0x00ffffff,
+  0x1, 0x30000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x74, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0x1, 0xff0f0f0f, 0x42, 0xff000000,
+  0x1, 0xff0f0f0f, 0x23, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x23, 0xff7f7f7f,
+  0x23, 0xffbfbfbf, 0x1, 0xffdfdfdf, 0x4e, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0xab, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000, 0x125, 0x00ffffff,
+  0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xffafafaf, 0x73, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0xd3, 0xff000000, 0xa, 0xff3f3f3f,
+  0x1, 0xff3b3b3b, 0x1, 0xff1f1f1f, 0x4, 0xff101010, 0x1, 0xff1f1f1f,
+  0x1, 0xff3b3b3b, 0x11, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x8, 0xff7f7f7f,
+  0x1, 0xff171717, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x14, 0xff7f7f7f,
+  0x26, 0xffbfbfbf, 0x1, 0xffdfdfdf, 0x70, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x60000000, 0x125, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x72, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0x16b, 0xff000000, 0x1, 0xff2f2f2f, 0x26, 0xff3f3f3f,
+  0x23, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xd0000000,
+  0x125, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000, 0x72, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x1c0, 0xff000000, 0x1, 0x30000000, 0x124, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x70, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0x1c1, 0xff000000, 0x1, 0x90000000,
+  0x124, 0x00ffffff, 0x1, 0xf0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x6f, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0x1c2, 0xff000000,
+  0x1, 0xe0000000, 0x124, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x6e, 0xffffffff, 0x1, 0xff6f6f6f, 0x1c5, 0xff000000, 0x123, 0x00ffffff,
+  0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x6c, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xa0000000,
+  0x1d, 0x40000000, 0x23, 0x80000000, 0x1, 0xa0000000, 0x23, 0xc0000000,
+  0x155, 0xff000000, 0x1, 0xd0000000, 0x123, 0x00ffffff, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x6b, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0x70000000, 0x88, 0x00ffffff,
+  0x1, 0x20000000, 0x23, 0x40000000, 0x1, 0x70000000, 0x22, 0x80000000,
+  0x1, 0x90000000, 0xa, 0xc0000000, 0x1, 0xc4000000, 0x1, 0xdc000000,
+  0x4, 0xef000000, 0x1, 0xdc000000, 0x1, 0xc4000000, 0x11, 0xc0000000,
+  0xc7, 0xff000000, 0x1, 0x50000000, 0x123, 0x00ffffff, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x69, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff4f4f4f, 0xb, 0xff000000, 0x1, 0xe0000000, 0x1, 0x30000000,
+  0x11a, 0x00ffffff, 0x1, 0x10000000, 0x26, 0x40000000, 0x1, 0x70000000,
+  0x26, 0x80000000, 0x26, 0xc0000000, 0x1, 0xd0000000, 0x2a, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x124, 0x00ffffff, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x68, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff1f1f1f, 0xb, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000,
+  0x1b6, 0x00ffffff, 0x1, 0x30000000, 0x2, 0x40000000, 0x1, 0x30000000,
+  0x126, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x67, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0xc, 0xff000000, 0x1, 0x70000000,
+  0x2e2, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x66, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x30000000, 0x2e3, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x65, 0xffffffff, 0x1, 0xff7f7f7f, 0xc, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x10000000, 0x2e4, 0x00ffffff, 0x1, 0xb0000000, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x63, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f,
+  0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000, 0x2e6, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x62, 0xffffffff,
+  0x1, 0xff7f7f7f, 0xc, 0xff000000, 0x1, 0xd0000000, 0x1, 0x20000000,
+  0x2e7, 0x00ffffff, 0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x60, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xc, 0xff000000,
+  0x1, 0x80000000, 0x2e9, 0x00ffffff, 0x1, 0xc0000000, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0x5e, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f,
+  0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0x2ea, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x5d, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f, 0xc, 0xff000000, 0x1, 0x90000000,
+  0x1, 0x10000000, 0x2eb, 0x00ffffff, 0x1, 0xc0000000, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0x5b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f,
+  0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0x2ed, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x5a, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x10000000, 0x2ee, 0x00ffffff, 0x1, 0xb0000000, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x58, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f,
+  0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x50000000, 0x2f0, 0x00ffffff,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x56, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0xd, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000,
+  0x2f1, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x55, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x40000000, 0x2f3, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xffcfcfcf, 0x52, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff2f2f2f,
+  0xd, 0xff000000, 0x1, 0x80000000, 0x1, 0x10000000, 0x2f4, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x50, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xd, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0x2f6, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x4e, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff7f7f7f,
+  0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xf0000000, 0x1, 0x70000000,
+  0x2f9, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x4d, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f, 0xd, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x20000000, 0x2fa, 0x00ffffff, 0x1, 0xe0000000, 0x6, 0xff000000,
+  0x1, 0xff1f1f1f, 0x4b, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff2f2f2f,
+  0xd, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0x2fc, 0x00ffffff,
+  0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x48, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0xd, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0x2fe, 0x00ffffff, 0x1, 0x70000000, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x46, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0xe, 0xff000000, 0x1, 0xa0000000, 0x1, 0x20000000, 0x2ff, 0x00ffffff,
+  0x1, 0x30000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x44, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xe, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x40000000, 0x302, 0x00ffffff, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x41, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0xe, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000, 0x304, 0x00ffffff,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x3f, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xe, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0x1, 0x10000000, 0x305, 0x00ffffff, 0x1, 0x50000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x3c, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xf, 0xff000000, 0x1, 0xa0000000,
+  0x1, 0x20000000, 0x308, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x3a, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f,
+  0xf, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000, 0x30a, 0x00ffffff,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x37, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0xf, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x40000000, 0x30c, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x34, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f, 0xf, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x60000000, 0x30f, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x31, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff6f6f6f,
+  0x1, 0xff0f0f0f, 0xf, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000,
+  0x311, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x2d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f,
+  0x1, 0xff3f3f3f, 0x10, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000,
+  0x314, 0x00ffffff, 0x1, 0x50000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0x29, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x10, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000,
+  0x317, 0x00ffffff, 0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0x25, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x11, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000,
+  0x319, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0x1f, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f, 0x13, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x60000000, 0x31c, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0xb, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xff9f9f9f, 0x1, 0xffefefef,
+  0x17, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f,
+  0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x14, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x40000000, 0x311, 0x00ffffff, 0x1, 0x80280eb8, 0x1, 0xe0280eb8,
+  0x2, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x80280eb8, 0x8, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xff5f5f5f, 0x1, 0xff7f7f7f, 0x2, 0xffbfbfbf, 0x1, 0xffcfcfcf,
+  0x7, 0xffffffff, 0x1, 0xffefefef, 0x4, 0xffbfbfbf, 0x2, 0xff7f7f7f,
+  0x1, 0xff4f4f4f, 0x1, 0xff3f3f3f, 0x17, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x90000000, 0x1, 0x20000000, 0x311, 0x00ffffff, 0x1, 0x40280eb8,
+  0x1, 0xd0280eb8, 0x6, 0xff280eb8, 0x1, 0xd0280eb8, 0x8, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x37, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x60000000, 0x1, 0x10000000, 0x311, 0x00ffffff, 0x1, 0x10280eb8,
+  0x1, 0x90280eb8, 0x9, 0xff280eb8, 0x1, 0x80280eb8, 0x8, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xd0000000, 0x33, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xa0000000, 0x1, 0x30000000, 0x313, 0x00ffffff, 0x1, 0x50280eb8,
+  0x1, 0xe0280eb8, 0xa, 0xff280eb8, 0x1, 0xe0280eb8, 0x9, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0x90000000, 0x30, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x60000000, 0x314, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0xb0280eb8,
+  0xd, 0xff280eb8, 0xb, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xd0000000,
+  0x2b, 0xff000000, 0x1, 0xb0000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x315, 0x00ffffff, 0x1, 0x70280eb8, 0x1, 0xf0280eb8, 0xe, 0xff280eb8,
+  0xd, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xd0000000, 0x25, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x90000000, 0x1, 0x50000000, 0x317, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0xc0280eb8, 0xf, 0xff280eb8, 0x1, 0xd0280eb8,
+  0xf, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xa0000000, 0x1, 0xf0000000,
+  0x1e, 0xff000000, 0x1, 0xd0000000, 0x1, 0x90000000, 0x1, 0x60000000,
+  0x1, 0x20000000, 0x318, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0x80280eb8,
+  0x11, 0xff280eb8, 0x1, 0x60280eb8, 0x12, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0x70000000, 0x1, 0xb0000000, 0x1, 0xe0000000, 0x14, 0xff000000,
+  0x2, 0xc0000000, 0x1, 0x80000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x31c, 0x00ffffff, 0x1, 0x40280eb8, 0x1, 0xe0280eb8, 0x11, 0xff280eb8,
+  0x1, 0xa0280eb8, 0x18, 0x00ffffff, 0x1, 0x30000000, 0x2, 0x40000000,
+  0x1, 0x70000000, 0x8, 0x80000000, 0x4, 0x40000000, 0x1, 0x20000000,
+  0x321, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xb0280eb8, 0x11, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x1, 0x50280eb8, 0x34a, 0x00ffffff, 0x1, 0x60280eb8,
+  0x1, 0xf0280eb8, 0x11, 0xff280eb8, 0x1, 0x90280eb8, 0x1, 0x10280eb8,
+  0x349, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0xc0280eb8, 0x11, 0xff280eb8,
+  0x1, 0xd0280eb8, 0x1, 0x40280eb8, 0x34a, 0x00ffffff, 0x1, 0x80280eb8,
+  0x11, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x80280eb8, 0x34b, 0x00ffffff,
+  0x1, 0xb0280eb8, 0x11, 0xff280eb8, 0x1, 0xc0280eb8, 0x1, 0x20280eb8,
+  0x34b, 0x00ffffff, 0x1, 0x80280eb8, 0x10, 0xff280eb8, 0x1, 0xf0280eb8,
+  0x1, 0x50280eb8, 0x34d, 0x00ffffff, 0x1, 0xe0280eb8, 0xf, 0xff280eb8,
+  0x1, 0xa0280eb8, 0x1, 0x10280eb8, 0x34e, 0x00ffffff, 0xe, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x1, 0x40280eb8, 0x350, 0x00ffffff, 0xd, 0xff280eb8,
+  0x1, 0x80280eb8, 0x352, 0x00ffffff, 0x1, 0xd0280eb8, 0xa, 0xff280eb8,
+  0x1, 0xc0280eb8, 0x1, 0x20280eb8, 0x353, 0x00ffffff, 0x1, 0x60280eb8,
+  0x8, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x70280eb8, 0x356, 0x00ffffff,
+  0x1, 0xa0280eb8, 0x6, 0xff280eb8, 0x1, 0xb0280eb8, 0x1, 0x10280eb8,
+  0x358, 0x00ffffff, 0x1, 0x50280eb8, 0x1, 0xc0280eb8, 0x1, 0xff280eb8,
+  0x1, 0xf0280eb8, 0x1, 0xb0280eb8, 0x1, 0x40280eb8, 0x6d6, 0x00ffffff,
+  0x1, 0x40280eb8, 0x1, 0x80280eb8, 0x1, 0xb0280eb8, 0x1, 0x80280eb8,
+  0x1, 0x30280eb8, 0x2f, 0x00ffffff, 0x1, 0x40280eb8, 0x1, 0x80280eb8,
+  0x1, 0xc0280eb8, 0x1, 0x80280eb8, 0x1, 0x40280eb8, 0x325, 0x00ffffff,
+  0x1, 0x10280eb8, 0x1, 0xc0280eb8, 0x5, 0xff280eb8, 0x1, 0xa0280eb8,
+  0x2d, 0x00ffffff, 0x1, 0xa0280eb8, 0x5, 0xff280eb8, 0x1, 0xc0280eb8,
+  0x1, 0x10280eb8, 0x323, 0x00ffffff, 0x1, 0xc0280eb8, 0x7, 0xff280eb8,
+  0x1, 0x90280eb8, 0x2b, 0x00ffffff, 0x1, 0x90280eb8, 0x7, 0xff280eb8,
+  0x1, 0xb0280eb8, 0x322, 0x00ffffff, 0x1, 0x80280eb8, 0x9, 0xff280eb8,
+  0x1, 0x20280eb8, 0x29, 0x00ffffff, 0x1, 0x20280eb8, 0x9, 0xff280eb8,
+  0x1, 0x30280eb8, 0x320, 0x00ffffff, 0x1, 0x40280eb8, 0xa, 0xff280eb8,
+  0x1, 0x60280eb8, 0x29, 0x00ffffff, 0x1, 0x70280eb8, 0x9, 0xff280eb8,
+  0x1, 0x80280eb8, 0x31f, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xf0280eb8,
+  0xa, 0xff280eb8, 0x1, 0x80280eb8, 0x29, 0x00ffffff, 0x1, 0x80280eb8,
+  0x9, 0xff280eb8, 0x1, 0xb0280eb8, 0x31f, 0x00ffffff, 0x1, 0xc0280eb8,
+  0xb, 0xff280eb8, 0x1, 0x50280eb8, 0x29, 0x00ffffff, 0x1, 0x60280eb8,
+  0x9, 0xff280eb8, 0x1, 0xf0280eb8, 0x31e, 0x00ffffff, 0x1, 0x80280eb8,
+  0xb, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x10280eb8, 0x29, 0x00ffffff,
+  0x1, 0x20280eb8, 0xa, 0xff280eb8, 0x1, 0x20280eb8, 0x31c, 0x00ffffff,
+  0x1, 0x40280eb8, 0xc, 0xff280eb8, 0x1, 0x60280eb8, 0x2b, 0x00ffffff,
+  0x1, 0xf0280eb8, 0x9, 0xff280eb8, 0x1, 0x60280eb8, 0x31b, 0x00ffffff,
+  0x1, 0x10280eb8, 0x1, 0xf0280eb8, 0xb, 0xff280eb8, 0x1, 0xa0280eb8,
+  0x2c, 0x00ffffff, 0x1, 0xc0280eb8, 0x9, 0xff280eb8, 0x1, 0x90280eb8,
+  0x31b, 0x00ffffff, 0x1, 0xd0280eb8, 0xb, 0xff280eb8, 0x1, 0xd0280eb8,
+  0x1, 0x10280eb8, 0x2c, 0x00ffffff, 0x1, 0x80280eb8, 0x9, 0xff280eb8,
+  0x1, 0xc0280eb8, 0x31a, 0x00ffffff, 0x1, 0x80280eb8, 0xb, 0xff280eb8,
+  0x1, 0xf0280eb8, 0x1, 0x30280eb8, 0x2d, 0x00ffffff, 0x1, 0x40280eb8,
+  0xa, 0xff280eb8, 0x31a, 0x00ffffff, 0x1, 0xe0280eb8, 0xb, 0xff280eb8,
+  0x1, 0x60280eb8, 0x2e, 0x00ffffff, 0x1, 0x10280eb8, 0xa, 0xff280eb8,
+  0x1, 0x40280eb8, 0x319, 0x00ffffff, 0xb, 0xff280eb8, 0x1, 0xa0280eb8,
+  0x30, 0x00ffffff, 0x1, 0xe0280eb8, 0x9, 0xff280eb8, 0x1, 0x70280eb8,
+  0x319, 0x00ffffff, 0xa, 0xff280eb8, 0x1, 0xd0280eb8, 0x1, 0x10280eb8,
+  0x30, 0x00ffffff, 0x1, 0xa0280eb8, 0x9, 0xff280eb8, 0x1, 0xa0280eb8,
+  0x319, 0x00ffffff, 0x1, 0xd0280eb8, 0x8, 0xff280eb8, 0x1, 0xf0280eb8,
+  0x1, 0x30280eb8, 0x31, 0x00ffffff, 0x1, 0x70280eb8, 0x9, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x319, 0x00ffffff, 0x1, 0x60280eb8, 0x8, 0xff280eb8,
+  0x1, 0x60280eb8, 0x32, 0x00ffffff, 0x1, 0x30280eb8, 0xa, 0xff280eb8,
+  0x1, 0x10280eb8, 0x319, 0x00ffffff, 0x1, 0xa0280eb8, 0x6, 0xff280eb8,
+  0x1, 0x80280eb8, 0x34, 0x00ffffff, 0xa, 0xff280eb8, 0x1, 0x50280eb8,
+  0x31a, 0x00ffffff, 0x1, 0x60280eb8, 0x1, 0xc0280eb8, 0x2, 0xff280eb8,
+  0x1, 0xb0280eb8, 0x1, 0x40280eb8, 0x35, 0x00ffffff, 0x1, 0xc0280eb8,
+  0x9, 0xff280eb8, 0x1, 0x80280eb8, 0x355, 0x00ffffff, 0x1, 0x90280eb8,
+  0x9, 0xff280eb8, 0x1, 0xc0280eb8, 0x355, 0x00ffffff, 0x1, 0x50280eb8,
+  0x9, 0xff280eb8, 0x1, 0xf0280eb8, 0x355, 0x00ffffff, 0x1, 0x20280eb8,
+  0xa, 0xff280eb8, 0x356, 0x00ffffff, 0x1, 0xe0280eb8, 0x8, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x356, 0x00ffffff, 0x1, 0x90280eb8, 0x8, 0xff280eb8,
+  0x1, 0x80280eb8, 0x356, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xe0280eb8,
+  0x6, 0xff280eb8, 0x1, 0xd0280eb8, 0x1, 0x10280eb8, 0x357, 0x00ffffff,
+  0x1, 0x10280eb8, 0x1, 0xc0280eb8, 0x4, 0xff280eb8, 0x1, 0xc0280eb8,
+  0x1, 0x10280eb8, 0x35a, 0x00ffffff, 0x1, 0x20280eb8, 0x2, 0x40280eb8,
+  0x1, 0x20280eb8, 0x135d, 0x00ffffff,
 };
-unsigned int assets_bongo_cat_left_down_png_len = 7387;
 
-const size_t bongo_cat_left_down_png_size = 7387;
+const embedded_asset_t bongo_cat_left_down_png = {
+    .width = 864,
+    .height = 360,
+    .runs = bongo_cat_left_down_png_runs,
+    .num_runs = 5078,
+};
 
-const unsigned char bongo_cat_right_down_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x01, 0x68,
-  0x08, 0x03, 0x00, 0x00, 0x00, 0x06, 0x80, 0x68, 0xd2, 0x00, 0x00, 0x00,
-  0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x26, 0x00, 0x00, 0x80,
-  0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x80, 0xe8, 0x00, 0x00, 0x75,
-  0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17,
-  0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00, 0x01, 0x1d, 0x50, 0x4c, 0x54,
-  0x45, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e,
-  0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e,
-  0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e,
-  0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0xb8, 0x0e, 0x28, 0x00, 0x00,
-  0x00, 0x2f, 0x2f, 0x2f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0xdf, 0xdf,
-  0xdf, 0xef, 0xef, 0xef, 0x7f, 0x7f, 0x7f, 0xcf, 0xcf, 0xcf, 0xff, 0xff,
-  0xff, 0x5f, 0x5f, 0x5f, 0x9f, 0x9f, 0x9f, 0xbf, 0xbf, 0xbf, 0x3f, 0x3f,
-  0x3f, 0xaf, 0xaf, 0xaf, 0x4f, 0x4f, 0x4f, 0x6f, 0x6f, 0x6f, 0x8f, 0x8f,
-  0x8f, 0x53, 0x53, 0x53, 0x45, 0x45, 0x45, 0x09, 0x09, 0x09, 0x59, 0x59,
-  0x59, 0x37, 0x37, 0x37, 0xfe, 0xf3, 0xf4, 0xfa, 0xc8, 0xcc, 0xf9, 0xb6,
-  0xba, 0xfb, 0xd4, 0xd7, 0xfe, 0xf9, 0xf9, 0x03, 0x03, 0x03, 0x08, 0x08,
-  0x08, 0xfc, 0xda, 0xdd, 0xf7, 0xa4, 0xa9, 0xf7, 0x9e, 0xa4, 0x06, 0x06,
-  0x06, 0xfc, 0xe1, 0xe2, 0xfb, 0xce, 0xd1, 0x15, 0x15, 0x15, 0xfa, 0xc2,
-  0xc6, 0x01, 0x01, 0x01, 0xf8, 0xaa, 0xaf, 0xfd, 0xed, 0xee, 0x40, 0x40,
-  0x40, 0xf8, 0xb0, 0xb5, 0x02, 0x02, 0x02, 0xfd, 0xe7, 0xe8, 0xf9, 0xbc,
-  0xc0, 0x33, 0x33, 0x33, 0x17, 0x17, 0x17, 0x68, 0x68, 0x68, 0x07, 0x07,
-  0x07, 0x23, 0x23, 0x23, 0x77, 0x77, 0x77, 0x26, 0x26, 0x26, 0x86, 0x86,
-  0x86, 0x13, 0x13, 0x13, 0x0a, 0x0a, 0x0a, 0x63, 0x63, 0x63, 0x10, 0x10,
-  0x10, 0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x1d, 0xb8, 0x0e, 0x28, 0xf3, 0x9e,
-  0xa2, 0x83, 0x00, 0x00, 0x00, 0x23, 0x74, 0x52, 0x4e, 0x53, 0x00, 0x30,
-  0xc0, 0xb0, 0x40, 0xf0, 0xa0, 0x20, 0x10, 0x80, 0xd0, 0x60, 0x90, 0x70,
-  0xe0, 0x50, 0xfa, 0xf4, 0xf3, 0xc8, 0x20, 0x50, 0x70, 0x40, 0x10, 0xa0,
-  0xe0, 0x30, 0x60, 0xf0, 0xc0, 0x80, 0xd0, 0x90, 0xb0, 0xb8, 0x55, 0x4a,
-  0x9b, 0x00, 0x00, 0x00, 0x01, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x88, 0x05,
-  0x1d, 0x48, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00,
-  0x0b, 0x12, 0x00, 0x00, 0x0b, 0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00,
-  0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe9, 0x08, 0x02, 0x06,
-  0x1b, 0x3b, 0x7b, 0x56, 0x3d, 0xac, 0x00, 0x00, 0x00, 0x01, 0x6f, 0x72,
-  0x4e, 0x54, 0x01, 0xcf, 0xa2, 0x77, 0x9a, 0x00, 0x00, 0x18, 0xda, 0x49,
-  0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xdd, 0x79, 0x63, 0xdb, 0x36, 0x9a,
-  0xc7, 0xf1, 0x5a, 0x96, 0x64, 0x59, 0xb2, 0xe5, 0xdd, 0xd9, 0x34, 0x67,
-  0x93, 0xa6, 0xa1, 0xee, 0xd3, 0xb6, 0x9a, 0x76, 0x72, 0x74, 0xdb, 0x78,
-  0x93, 0xa6, 0xed, 0xa6, 0xc7, 0x4c, 0xdb, 0xbd, 0x66, 0x37, 0xef, 0xff,
-  0x65, 0xac, 0x6c, 0x0b, 0x20, 0xc0, 0x43, 0xe2, 0x25, 0x82, 0x20, 0xbf,
-  0x9f, 0xbf, 0x66, 0xda, 0x44, 0x95, 0x25, 0xfe, 0x0c, 0xe0, 0xc1, 0x43,
-  0xf0, 0x93, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
-  0xb5, 0x83, 0x9a, 0xe3, 0x1c, 0xd6, 0x4d, 0xbf, 0x0b, 0xa0, 0x9c, 0x0e,
-  0x1a, 0xce, 0xb5, 0xe6, 0x91, 0xe9, 0x37, 0x02, 0x94, 0x50, 0xeb, 0x36,
-  0x5f, 0x6b, 0xc7, 0x2d, 0xd3, 0xef, 0x05, 0x28, 0x9b, 0x56, 0xdb, 0x91,
-  0x1a, 0x1d, 0xd3, 0xef, 0x06, 0x28, 0x99, 0x43, 0x47, 0xd5, 0x66, 0x29,
-  0x06, 0x64, 0xe8, 0xc4, 0xf1, 0x38, 0x61, 0x9e, 0x08, 0x64, 0xa5, 0xe3,
-  0xf8, 0x30, 0x4f, 0x04, 0x32, 0x72, 0xd0, 0x70, 0x02, 0xd4, 0xa8, 0x27,
-  0x02, 0x19, 0x70, 0x0b, 0x1c, 0xbd, 0xbe, 0x36, 0x88, 0x9d, 0x9a, 0x7e,
-  0x67, 0x40, 0x09, 0xc8, 0x02, 0xc7, 0x60, 0x38, 0x1a, 0x0f, 0x18, 0xc4,
-  0x80, 0x2c, 0x9d, 0xca, 0x3c, 0x4d, 0xa6, 0xd3, 0xe9, 0x70, 0xc6, 0x20,
-  0x06, 0x64, 0xe7, 0x40, 0xa6, 0x69, 0x3e, 0xbd, 0xb1, 0xe8, 0x69, 0x83,
-  0x18, 0xe5, 0x44, 0x20, 0xb9, 0x56, 0x57, 0x44, 0x69, 0x36, 0x15, 0xb4,
-  0x79, 0x62, 0xe3, 0xcc, 0xf4, 0x5b, 0x04, 0xec, 0xd5, 0x94, 0x05, 0x8e,
-  0xa9, 0x6b, 0xb8, 0x64, 0x4f, 0x0c, 0xc8, 0xc0, 0x99, 0x5b, 0xe0, 0x98,
-  0xaa, 0xce, 0xd5, 0x41, 0xac, 0x7d, 0x60, 0xfa, 0x6d, 0x02, 0x56, 0x72,
-  0x5b, 0x7c, 0xcf, 0xa7, 0xba, 0xd1, 0x05, 0xbb, 0xce, 0x40, 0x4a, 0xb2,
-  0x42, 0x7f, 0x39, 0xf5, 0xd1, 0x06, 0xb1, 0x13, 0xd3, 0xef, 0x14, 0xb0,
-  0x8f, 0x9c, 0x20, 0xf6, 0x46, 0xfe, 0x80, 0xe9, 0x2b, 0xb1, 0x36, 0x0b,
-  0x31, 0x20, 0x1e, 0x77, 0x82, 0x38, 0x99, 0x06, 0x5a, 0xa9, 0xd3, 0x44,
-  0x16, 0x62, 0x40, 0x2c, 0x72, 0x82, 0xb8, 0x9a, 0x86, 0x98, 0xa8, 0x7b,
-  0x62, 0x2c, 0xc4, 0x80, 0x18, 0xea, 0x22, 0x39, 0xcb, 0x69, 0xa8, 0xd1,
-  0x8c, 0x85, 0x18, 0x90, 0x84, 0xdc, 0x62, 0xf6, 0x54, 0xe8, 0x3d, 0xe6,
-  0x4a, 0xad, 0xe3, 0x90, 0x85, 0x18, 0x10, 0xd1, 0xf1, 0xce, 0x09, 0xe2,
-  0x66, 0x9a, 0xa8, 0xb4, 0xd8, 0x53, 0xea, 0x00, 0xa2, 0x39, 0x0a, 0x6a,
-  0xe1, 0x08, 0x9e, 0x26, 0x2a, 0xd5, 0x44, 0x4a, 0x1d, 0x40, 0x24, 0xb5,
-  0x1d, 0x15, 0x44, 0xd5, 0x25, 0x09, 0x03, 0x62, 0x91, 0x15, 0x8e, 0xf1,
-  0xee, 0x7c, 0x69, 0x0b, 0x31, 0xba, 0x3a, 0x80, 0xdd, 0x44, 0x85, 0xa3,
-  0x3f, 0x8a, 0x12, 0xb0, 0xe9, 0x44, 0x29, 0x75, 0x90, 0x30, 0x60, 0x07,
-  0x79, 0xcc, 0xcd, 0x79, 0xa4, 0x7c, 0xad, 0x17, 0x62, 0x3d, 0x12, 0x06,
-  0x44, 0x24, 0x7b, 0x38, 0x96, 0x11, 0xf3, 0xa5, 0x97, 0x3a, 0x48, 0x18,
-  0xb0, 0x8d, 0x2c, 0xd1, 0x47, 0xa8, 0x70, 0x48, 0xca, 0x9e, 0x73, 0xd3,
-  0xf4, 0x0f, 0x00, 0x14, 0x98, 0x1c, 0xc0, 0x66, 0x31, 0xf2, 0xa5, 0x15,
-  0x13, 0x49, 0x18, 0x10, 0x4a, 0x0c, 0x60, 0xdb, 0x7b, 0x38, 0x02, 0x8a,
-  0x89, 0x24, 0x0c, 0xd8, 0x49, 0x0e, 0x60, 0x91, 0x4a, 0xf4, 0x24, 0x0c,
-  0x88, 0x45, 0x0e, 0x60, 0xd1, 0x4a, 0xf4, 0x21, 0x09, 0xa3, 0xd2, 0x01,
-  0x04, 0x49, 0x3e, 0x80, 0x4d, 0xb5, 0xfb, 0x9c, 0x49, 0x18, 0x10, 0x20,
-  0xc5, 0x00, 0x36, 0xd5, 0xb6, 0x9c, 0x49, 0x18, 0xe0, 0x93, 0x6a, 0x00,
-  0xd3, 0x13, 0x76, 0x5a, 0xaf, 0xe0, 0xd9, 0xda, 0xf5, 0xfa, 0x29, 0xfd,
-  0x98, 0x08, 0xd7, 0x49, 0x35, 0x80, 0xe9, 0x09, 0x53, 0x34, 0x6a, 0x37,
-  0x9a, 0xc7, 0x6b, 0xa7, 0xf5, 0xb5, 0x72, 0xde, 0xd9, 0xd2, 0xe9, 0xd2,
-  0xf1, 0x8c, 0xad, 0xba, 0xe9, 0x06, 0xb0, 0xa9, 0x56, 0xe9, 0xd8, 0xa1,
-  0xbd, 0x8e, 0xdc, 0x3a, 0x70, 0x67, 0xf5, 0x92, 0x0c, 0x75, 0xf5, 0xcd,
-  0x83, 0x68, 0x1a, 0x3c, 0x02, 0x14, 0x21, 0xc4, 0x49, 0x52, 0x89, 0x07,
-  0xb0, 0x58, 0x09, 0x53, 0x75, 0x6b, 0xb5, 0x93, 0xe3, 0x63, 0x8b, 0xb3,
-  0x76, 0x20, 0x6f, 0xf1, 0x71, 0x6a, 0xa6, 0xdf, 0x0b, 0x8a, 0x4a, 0x5c,
-  0x24, 0xc9, 0x07, 0xb0, 0xc4, 0x09, 0x73, 0x5d, 0x47, 0xad, 0x53, 0xb7,
-  0x6b, 0xa2, 0x75, 0xd4, 0x54, 0x7f, 0x02, 0xbb, 0xde, 0x3b, 0x72, 0x23,
-  0x6f, 0x64, 0x8e, 0xd9, 0xc4, 0x91, 0x71, 0xc2, 0xdc, 0xa4, 0x5d, 0x8f,
-  0x69, 0xa6, 0x3f, 0x94, 0x08, 0x5a, 0xc7, 0xfa, 0x1b, 0x67, 0x9f, 0x1d,
-  0x81, 0xc4, 0xaf, 0xe1, 0x78, 0x5d, 0x88, 0x7e, 0x97, 0xb1, 0xb3, 0xb4,
-  0x3d, 0x68, 0x87, 0xeb, 0x11, 0xad, 0xc0, 0x73, 0xc7, 0x63, 0xdf, 0x53,
-  0x76, 0xcb, 0x59, 0xc3, 0x41, 0x4a, 0xb2, 0x46, 0x1f, 0xa7, 0x8d, 0x3e,
-  0x8f, 0x84, 0xdd, 0x6a, 0xd7, 0xd6, 0x39, 0x2b, 0xde, 0xa5, 0xdb, 0xe9,
-  0xfa, 0xdf, 0xea, 0xb1, 0xe9, 0x37, 0x85, 0x22, 0x12, 0x35, 0xfa, 0x9d,
-  0x27, 0xdd, 0xec, 0x36, 0x5c, 0xac, 0xad, 0xc6, 0xc2, 0x6c, 0x79, 0x23,
-  0x9b, 0xf1, 0xac, 0x79, 0x5c, 0xa0, 0xe1, 0xac, 0xde, 0x0e, 0x7a, 0x8f,
-  0x5d, 0xd3, 0x6f, 0x0b, 0x45, 0x24, 0xae, 0x95, 0x79, 0xfa, 0x80, 0x6d,
-  0x31, 0x59, 0x47, 0xef, 0x7c, 0x1d, 0xba, 0xcb, 0x75, 0xe2, 0xfa, 0x31,
-  0x82, 0xe5, 0x19, 0xce, 0x0e, 0x8b, 0x10, 0x33, 0xa5, 0x74, 0x78, 0x43,
-  0xfe, 0x40, 0x3c, 0x98, 0x10, 0x5e, 0x72, 0xa5, 0x3e, 0xd8, 0x6b, 0xbe,
-  0xbc, 0x46, 0xeb, 0xbc, 0xdd, 0xa4, 0xad, 0x17, 0x27, 0x5f, 0x72, 0x34,
-  0x3b, 0x35, 0x38, 0x69, 0xd4, 0x4b, 0x87, 0x8e, 0xd3, 0x5f, 0x4c, 0xc7,
-  0x9b, 0xff, 0x79, 0x68, 0xfa, 0xdb, 0x44, 0xd1, 0x74, 0xe4, 0x4a, 0xfd,
-  0x32, 0x7d, 0x6a, 0x12, 0x0f, 0x6e, 0xeb, 0xa1, 0xed, 0x22, 0x6e, 0xd4,
-  0xba, 0xb5, 0xe3, 0x33, 0x03, 0x83, 0x99, 0xb7, 0x74, 0xd8, 0xbf, 0x1e,
-  0xf8, 0x47, 0xe2, 0xff, 0x99, 0x1f, 0x5d, 0x51, 0x24, 0xea, 0x52, 0x22,
-  0x75, 0x89, 0x23, 0x03, 0xd7, 0xa3, 0xda, 0xc5, 0x72, 0x10, 0x35, 0x63,
-  0xd7, 0xcd, 0x58, 0x27, 0x9d, 0x5c, 0xb7, 0x9f, 0x3c, 0xa5, 0xc3, 0xc1,
-  0xf8, 0x76, 0x6f, 0x5e, 0x1c, 0x9d, 0x70, 0x6a, 0xfa, 0x1b, 0x45, 0x81,
-  0x1c, 0x1d, 0x2a, 0x97, 0x4a, 0x06, 0x25, 0x8e, 0xec, 0x4c, 0x16, 0xab,
-  0x75, 0xd0, 0xa2, 0x4f, 0x19, 0x4f, 0x72, 0x1a, 0xcb, 0xbc, 0xa5, 0xc3,
-  0x4b, 0xd1, 0xfa, 0xb2, 0x10, 0xc3, 0xaa, 0xe9, 0xef, 0x14, 0x85, 0xe1,
-  0x99, 0xeb, 0x44, 0x3d, 0xab, 0x2d, 0x4f, 0xa3, 0xf5, 0xdc, 0x71, 0x16,
-  0x31, 0x67, 0x8d, 0xf5, 0x8c, 0x71, 0xcf, 0xeb, 0xb2, 0x03, 0x4f, 0xe9,
-  0x70, 0xa6, 0x6c, 0xcc, 0x8b, 0x32, 0x07, 0xdd, 0x1c, 0xb8, 0xd5, 0xd1,
-  0xe7, 0x3a, 0xab, 0xe4, 0x31, 0xc8, 0x21, 0x67, 0xf3, 0x71, 0xb4, 0x15,
-  0x5a, 0xb7, 0xb9, 0xc7, 0xdb, 0x46, 0x3c, 0x9f, 0xd8, 0x72, 0xa1, 0xbe,
-  0x47, 0x51, 0xe6, 0xe0, 0x71, 0x4e, 0xb8, 0xe6, 0x29, 0x34, 0x0f, 0xf6,
-  0x5b, 0xa2, 0xcf, 0xc6, 0xe4, 0x7c, 0x7c, 0x11, 0x25, 0x66, 0xfb, 0x19,
-  0xca, 0x5a, 0x7a, 0xed, 0xb0, 0xbf, 0xd0, 0xdf, 0xdc, 0x90, 0x39, 0x22,
-  0xa4, 0xd6, 0x89, 0x1e, 0xaf, 0x71, 0x8a, 0x2e, 0x7a, 0x13, 0x31, 0xdb,
-  0xbd, 0x8f, 0xd6, 0x3e, 0xe9, 0x64, 0xbb, 0x2a, 0xd3, 0xa7, 0x87, 0x7d,
-  0xff, 0x2f, 0x24, 0x11, 0x7d, 0xe6, 0x88, 0x38, 0xd3, 0xe7, 0x3a, 0xb3,
-  0x74, 0x3d, 0xbe, 0x46, 0x2c, 0x56, 0x97, 0x3b, 0xd7, 0x66, 0xdd, 0x66,
-  0x76, 0x21, 0xd3, 0x3e, 0xb2, 0xc0, 0x5f, 0x48, 0x2b, 0xe6, 0x88, 0xb8,
-  0x71, 0xa4, 0xcf, 0x0e, 0x97, 0x45, 0x28, 0xcf, 0x27, 0x33, 0x59, 0x2f,
-  0xcd, 0x06, 0xb9, 0x84, 0x4c, 0x1b, 0xf1, 0x2f, 0x03, 0xc7, 0x7b, 0x31,
-  0x47, 0x6c, 0x9b, 0xfe, 0x7e, 0x61, 0x96, 0xbe, 0x91, 0xd3, 0x2f, 0x62,
-  0xf1, 0x30, 0x96, 0xe1, 0xf9, 0xae, 0x94, 0xa5, 0x0e, 0xd9, 0x91, 0x3a,
-  0x3d, 0x0c, 0x1d, 0xef, 0xc5, 0x1c, 0x91, 0xbd, 0xe6, 0x2a, 0xd3, 0x97,
-  0x12, 0x56, 0x2d, 0xbe, 0xb6, 0xa6, 0x6c, 0xbe, 0x63, 0xc6, 0xd8, 0x6d,
-  0x26, 0x2f, 0x7c, 0xd4, 0x95, 0x5f, 0x49, 0x5b, 0xaa, 0x41, 0x62, 0x8e,
-  0xc8, 0x5e, 0x73, 0x75, 0x79, 0x8a, 0x1b, 0x17, 0x16, 0x2e, 0xbe, 0xb6,
-  0x58, 0xac, 0x66, 0x5b, 0xab, 0x1f, 0xed, 0x93, 0x44, 0x77, 0x71, 0xaa,
-  0xdb, 0x85, 0xbd, 0x2d, 0xf3, 0x69, 0x31, 0x47, 0xa4, 0x1f, 0xb1, 0xb2,
-  0xea, 0x5a, 0x1f, 0x82, 0xb7, 0xd0, 0x5c, 0x0a, 0xa3, 0xf5, 0x84, 0x71,
-  0x5b, 0xc8, 0x0e, 0x4f, 0x63, 0xce, 0xe0, 0x5a, 0xea, 0x8a, 0x75, 0xb6,
-  0x75, 0xc0, 0x17, 0xe9, 0x36, 0xfd, 0x35, 0xc3, 0x0c, 0xcf, 0xf0, 0x95,
-  0xea, 0xfc, 0x8d, 0x62, 0x5b, 0xac, 0x2e, 0xb6, 0xac, 0xca, 0xba, 0x27,
-  0x31, 0x6e, 0x2a, 0x39, 0x50, 0x57, 0xac, 0x3b, 0x36, 0x0b, 0xc5, 0xed,
-  0xa6, 0x36, 0x9c, 0x76, 0x80, 0xcc, 0xe9, 0xc3, 0xd7, 0xb2, 0x5c, 0xb3,
-  0x43, 0xbf, 0xc9, 0xd6, 0xf9, 0x62, 0xd4, 0x81, 0xec, 0x54, 0x1d, 0xf1,
-  0x77, 0x95, 0x5b, 0xcf, 0x37, 0x7f, 0x90, 0xfb, 0x9a, 0x2b, 0x48, 0x1f,
-  0xbe, 0x06, 0xd6, 0xd7, 0x0e, 0x23, 0x19, 0xce, 0xb7, 0x84, 0xac, 0xbb,
-  0x7b, 0x45, 0xd6, 0x3a, 0x54, 0x17, 0xac, 0x3b, 0xeb, 0x41, 0xe2, 0x9e,
-  0x15, 0x8e, 0x6f, 0xab, 0x1e, 0xbd, 0x78, 0x38, 0x2b, 0x49, 0xed, 0x30,
-  0x8a, 0x6d, 0x21, 0x6b, 0x34, 0x3b, 0xdb, 0x4a, 0x8b, 0x07, 0xea, 0x98,
-  0x1f, 0xa5, 0x57, 0x53, 0x14, 0xea, 0x4d, 0x7f, 0xdb, 0xc8, 0x9b, 0xd6,
-  0x37, 0x5f, 0xca, 0xe2, 0xc6, 0x56, 0x93, 0x2d, 0x6b, 0xb2, 0x5a, 0xe8,
-  0x64, 0x51, 0xed, 0xed, 0x1d, 0x44, 0xfa, 0xcc, 0xc4, 0x22, 0x8c, 0x6e,
-  0xa9, 0x6a, 0xd1, 0xf6, 0x49, 0x43, 0xfa, 0x10, 0x4a, 0x6f, 0x12, 0x5e,
-  0x5d, 0x6c, 0x1f, 0x07, 0x24, 0x42, 0xeb, 0xed, 0x5d, 0x46, 0xfb, 0xcc,
-  0xc4, 0x22, 0x8c, 0x9d, 0xb0, 0x4a, 0xd1, 0xee, 0xb2, 0xa8, 0xde, 0xf0,
-  0xe5, 0x1a, 0x9d, 0x5f, 0x86, 0xcd, 0x16, 0xbb, 0x27, 0x9e, 0x8c, 0x69,
-  0x73, 0xea, 0xa8, 0x05, 0x57, 0xb1, 0x08, 0xe3, 0x00, 0xd2, 0x0a, 0xd1,
-  0x16, 0xea, 0x55, 0x1d, 0xbe, 0x5c, 0xc3, 0xd5, 0x45, 0x58, 0xc6, 0x9a,
-  0x4a, 0xf5, 0x5e, 0x9b, 0x1e, 0x46, 0xaf, 0x08, 0x6d, 0xf2, 0x4b, 0x3b,
-  0x62, 0x75, 0x68, 0x0b, 0xf5, 0x2a, 0x0f, 0x5f, 0x8a, 0xd0, 0x81, 0xac,
-  0x21, 0x32, 0xa6, 0x96, 0x5c, 0x7b, 0x31, 0x36, 0x34, 0x44, 0x78, 0x4d,
-  0x7f, 0xeb, 0xc8, 0x8b, 0x56, 0xdd, 0xa8, 0xfc, 0xf0, 0xe5, 0x0a, 0x1d,
-  0xc8, 0xae, 0x33, 0xa6, 0xad, 0x59, 0x63, 0x9d, 0xb5, 0x25, 0x6e, 0x6b,
-  0xa6, 0xca, 0x51, 0x0d, 0x5a, 0x9b, 0x4f, 0xb4, 0x42, 0x58, 0x75, 0x8c,
-  0xce, 0x67, 0xc1, 0xa5, 0xc5, 0x46, 0xb4, 0xde, 0xde, 0x20, 0xe2, 0xe8,
-  0x1b, 0xce, 0x1f, 0xad, 0x04, 0xb5, 0x0b, 0x3c, 0xc2, 0x3e, 0x69, 0x05,
-  0x2d, 0x2e, 0xb7, 0xdf, 0x1b, 0xdd, 0x8b, 0x79, 0xaf, 0x9c, 0xe8, 0xf7,
-  0xa5, 0x97, 0xa3, 0x0a, 0xd4, 0x36, 0x1f, 0x2b, 0xce, 0xdc, 0x30, 0x62,
-  0xb2, 0x0a, 0x3f, 0xe6, 0x23, 0xfe, 0x86, 0xfc, 0xe6, 0x2f, 0xd2, 0x50,
-  0x5f, 0x7e, 0x5a, 0xf5, 0x30, 0xce, 0x42, 0xbd, 0x7a, 0x86, 0xab, 0xe0,
-  0x2d, 0xb2, 0x04, 0xbf, 0x94, 0x36, 0x2f, 0x44, 0xb3, 0x54, 0xe9, 0x69,
-  0xd5, 0x43, 0x73, 0x87, 0x62, 0xdb, 0x62, 0x34, 0xf7, 0x15, 0x3d, 0x76,
-  0xf6, 0xf6, 0x06, 0xd9, 0xbc, 0x4a, 0xc3, 0xf4, 0xd7, 0x8f, 0x3d, 0x4b,
-  0xb8, 0x8f, 0x53, 0x65, 0x9e, 0x8c, 0x25, 0x5b, 0xb3, 0x8a, 0x32, 0xa2,
-  0xe9, 0xef, 0x1f, 0xfb, 0xa5, 0xee, 0xe3, 0x44, 0x6c, 0xf3, 0x81, 0x96,
-  0xb1, 0x84, 0xe7, 0xb0, 0x52, 0xa7, 0xaf, 0x02, 0xad, 0x3a, 0x5f, 0xe2,
-  0xfb, 0x2a, 0xf7, 0xe1, 0x36, 0x63, 0x89, 0x77, 0xe4, 0x45, 0x9d, 0x9e,
-  0x7b, 0x2e, 0x4b, 0x4c, 0x5d, 0x7e, 0xb1, 0xf9, 0x15, 0xdf, 0x68, 0x91,
-  0xfc, 0x43, 0x63, 0x23, 0xac, 0xfc, 0xd4, 0xe5, 0x17, 0xd5, 0xc3, 0x9c,
-  0xb1, 0x11, 0x56, 0x7a, 0x6a, 0x73, 0xd4, 0xcc, 0xf4, 0xf5, 0x56, 0x3d,
-  0x04, 0xac, 0xdc, 0xd4, 0xbb, 0x98, 0xd8, 0x5c, 0x36, 0x80, 0x80, 0x95,
-  0x5a, 0x4b, 0x69, 0x53, 0x4d, 0xb4, 0x8f, 0x83, 0x94, 0x36, 0x1f, 0x3e,
-  0x07, 0xd4, 0x97, 0x92, 0x7a, 0xc6, 0x18, 0xd5, 0x79, 0x23, 0x68, 0xe5,
-  0x28, 0x31, 0xf5, 0x09, 0x20, 0x2c, 0xbf, 0xcc, 0x20, 0x60, 0xe5, 0xd5,
-  0x49, 0xd7, 0x46, 0x87, 0x2c, 0x10, 0xb0, 0xd2, 0x52, 0xba, 0x37, 0x06,
-  0x2c, 0xbf, 0x4c, 0x21, 0x60, 0x65, 0xa5, 0x94, 0x0f, 0xd9, 0xfd, 0x32,
-  0x87, 0x80, 0x95, 0x93, 0xda, 0x1d, 0x45, 0x79, 0xc3, 0x20, 0x02, 0x56,
-  0x4a, 0x6a, 0x79, 0x9e, 0xf2, 0x86, 0x49, 0x04, 0xac, 0x8c, 0xd4, 0x43,
-  0xfc, 0x12, 0xb6, 0x81, 0x23, 0x1b, 0x04, 0xac, 0x84, 0x94, 0xed, 0x2f,
-  0xba, 0x37, 0x0c, 0x23, 0x60, 0xe5, 0xa3, 0xe6, 0x8b, 0xf2, 0xa1, 0x61,
-  0x74, 0x72, 0x94, 0x8e, 0x92, 0x2f, 0xba, 0xa3, 0x8c, 0xa3, 0x17, 0xb1,
-  0x6c, 0x94, 0xed, 0xe5, 0x1e, 0xe5, 0x43, 0xe3, 0x08, 0x58, 0xc9, 0x90,
-  0xaf, 0x62, 0x21, 0x60, 0xe5, 0xa2, 0xe4, 0x8b, 0xf2, 0x7c, 0x01, 0x4c,
-  0x36, 0x5f, 0x06, 0x0f, 0x30, 0x2a, 0x07, 0xf2, 0x55, 0x30, 0x9c, 0xc9,
-  0x51, 0x2a, 0xe4, 0xab, 0x68, 0x08, 0x58, 0x99, 0x28, 0xf9, 0x62, 0x7b,
-  0xb9, 0x18, 0xce, 0x09, 0x58, 0x79, 0x28, 0xf9, 0x62, 0x7b, 0xb9, 0x20,
-  0xc4, 0xb9, 0x88, 0x47, 0xe9, 0xbf, 0x5e, 0x18, 0x46, 0xbe, 0x0a, 0x88,
-  0x93, 0x7d, 0x4b, 0x83, 0x7c, 0x15, 0x11, 0x01, 0x2b, 0x0b, 0xf2, 0x55,
-  0x48, 0x3c, 0xfc, 0xa1, 0x24, 0xc8, 0x57, 0x31, 0xd1, 0xeb, 0x5b, 0x0e,
-  0xe4, 0xab, 0xa0, 0x08, 0x58, 0x29, 0x90, 0xaf, 0xa2, 0x22, 0x60, 0x65,
-  0xa0, 0xf4, 0xcf, 0x93, 0xaf, 0x62, 0xd9, 0x7c, 0x2d, 0x4d, 0xd3, 0x97,
-  0x08, 0x52, 0x20, 0x5f, 0xc5, 0x45, 0xaf, 0xaf, 0xfd, 0xc8, 0x57, 0x81,
-  0x11, 0x30, 0xeb, 0xb5, 0xc8, 0x57, 0x81, 0x11, 0x30, 0xdb, 0x29, 0xe7,
-  0x47, 0x91, 0xaf, 0xc2, 0xe1, 0x6e, 0x15, 0xdb, 0x29, 0xf9, 0xba, 0x34,
-  0x7d, 0x35, 0xc1, 0x87, 0x66, 0x7a, 0xdb, 0x1d, 0x72, 0x7f, 0x4a, 0x91,
-  0x11, 0x30, 0xcb, 0x35, 0xc9, 0x57, 0xa1, 0x11, 0x30, 0xbb, 0xb9, 0x8f,
-  0x87, 0xbd, 0x30, 0x7d, 0x29, 0x21, 0x08, 0x01, 0xb3, 0x9a, 0xdb, 0xc0,
-  0xc1, 0xf9, 0x36, 0xc5, 0x34, 0x27, 0x60, 0x16, 0x3b, 0x20, 0x5f, 0x45,
-  0xc7, 0xdd, 0x2a, 0x16, 0x73, 0x37, 0x98, 0x07, 0x3c, 0x9e, 0xa8, 0xa0,
-  0x08, 0x98, 0xbd, 0xdc, 0x02, 0x3d, 0xe7, 0x63, 0x17, 0x16, 0x01, 0xb3,
-  0x97, 0xbb, 0x01, 0xb6, 0x30, 0x7d, 0x19, 0x21, 0x0c, 0x01, 0xb3, 0x96,
-  0x5b, 0xa0, 0xa7, 0x81, 0xa3, 0xb8, 0x08, 0x98, 0xad, 0x4e, 0x65, 0xbe,
-  0xc6, 0xa6, 0x2f, 0x22, 0x84, 0x23, 0x60, 0x96, 0x3a, 0x63, 0x83, 0xd9,
-  0x0a, 0x04, 0xcc, 0x4e, 0x6e, 0x01, 0xb1, 0x67, 0xfa, 0x12, 0xc2, 0x36,
-  0x9b, 0x33, 0x6f, 0xba, 0xa6, 0x2f, 0x18, 0xc4, 0xe2, 0x16, 0x10, 0xfb,
-  0x6c, 0x80, 0x15, 0x1a, 0x27, 0x06, 0x58, 0x49, 0x76, 0xf8, 0x52, 0xa0,
-  0x2f, 0x38, 0x02, 0x66, 0x23, 0xb7, 0x03, 0xf1, 0xdc, 0xf4, 0x05, 0x84,
-  0xed, 0x08, 0x98, 0x85, 0xdc, 0x02, 0x07, 0x4f, 0x78, 0x28, 0x3a, 0x02,
-  0x66, 0x1f, 0xb7, 0xc0, 0x41, 0x01, 0xb1, 0xf0, 0x08, 0x98, 0x75, 0xdc,
-  0x02, 0x07, 0x1d, 0xbe, 0xc5, 0x47, 0xc0, 0xac, 0x23, 0x3b, 0x38, 0x06,
-  0xe4, 0xab, 0xf8, 0x08, 0x98, 0x6d, 0xdc, 0x5b, 0xc0, 0xe8, 0x40, 0xb4,
-  0x00, 0x01, 0xb3, 0xcc, 0x01, 0x05, 0x0e, 0xab, 0x10, 0x30, 0xbb, 0xb4,
-  0xba, 0x14, 0x38, 0xac, 0x42, 0xc0, 0xec, 0x72, 0x48, 0x81, 0xc3, 0x2e,
-  0x04, 0xac, 0x18, 0xea, 0xf5, 0xb3, 0xe3, 0x6b, 0x67, 0xf5, 0x83, 0x6d,
-  0x7f, 0x4c, 0xb6, 0xd0, 0xd3, 0xc1, 0x61, 0x09, 0x02, 0x66, 0x5a, 0xeb,
-  0xec, 0xb8, 0xe6, 0x9e, 0x7d, 0x7d, 0xad, 0xdd, 0x3c, 0x0d, 0x49, 0x99,
-  0xbb, 0x00, 0xe3, 0x16, 0x30, 0x4b, 0x10, 0x30, 0xa3, 0x8e, 0x4e, 0xdb,
-  0x4e, 0xa0, 0x46, 0xb3, 0xd3, 0xf2, 0xfd, 0x69, 0x77, 0x07, 0x8c, 0x33,
-  0x7c, 0x6d, 0x41, 0xc0, 0xcc, 0x69, 0x75, 0x42, 0xd2, 0x25, 0x32, 0xe6,
-  0x3d, 0xea, 0x4b, 0xee, 0x80, 0x71, 0x8b, 0x8a, 0x35, 0x08, 0x98, 0x29,
-  0x47, 0xc7, 0x0d, 0x67, 0x97, 0x6e, 0x47, 0xfd, 0x1b, 0xb2, 0x05, 0x91,
-  0x33, 0xa4, 0xec, 0x41, 0xc0, 0xcc, 0x68, 0x1d, 0xef, 0x4c, 0x97, 0x37,
-  0x62, 0x47, 0x32, 0x90, 0xb4, 0xd0, 0xdb, 0x83, 0x80, 0x19, 0x71, 0xba,
-  0x7b, 0xf4, 0x92, 0x11, 0x13, 0x13, 0xc5, 0x1a, 0x3b, 0x60, 0x16, 0x22,
-  0x60, 0x06, 0x1c, 0xd5, 0x22, 0xc7, 0xeb, 0xda, 0xe1, 0x4d, 0xb9, 0x43,
-  0x56, 0xe8, 0xd9, 0x01, 0xb3, 0x09, 0x01, 0xcb, 0x5f, 0xc7, 0x37, 0x7c,
-  0x2d, 0x2f, 0x57, 0x8b, 0xc5, 0x75, 0x6e, 0x46, 0x8b, 0xc5, 0xf8, 0xa2,
-  0xef, 0x2b, 0x77, 0x9c, 0xa9, 0x15, 0x7a, 0x76, 0xc0, 0x6c, 0xb2, 0x09,
-  0x18, 0x67, 0x72, 0xe4, 0xa6, 0xd5, 0xd4, 0xd3, 0xd3, 0x1b, 0xfb, 0x12,
-  0x33, 0x9a, 0xcf, 0x06, 0xfa, 0x1f, 0x3a, 0x71, 0x4f, 0x19, 0xa5, 0x05,
-  0xd1, 0x2a, 0x9c, 0x2a, 0x95, 0xb3, 0x96, 0x56, 0x9a, 0x1f, 0x5c, 0x86,
-  0x15, 0x04, 0xcf, 0x2f, 0xf4, 0x95, 0x98, 0x1c, 0xec, 0x4c, 0x5f, 0x31,
-  0x88, 0x85, 0x80, 0xe5, 0xeb, 0x40, 0xcd, 0x57, 0x7f, 0x6b, 0x3f, 0xc6,
-  0x70, 0x16, 0xb0, 0x1e, 0xe3, 0x1e, 0x30, 0xcb, 0x10, 0xb0, 0x5c, 0x1d,
-  0x28, 0xcb, 0xaf, 0xc1, 0xce, 0x13, 0x79, 0x03, 0x22, 0x46, 0x85, 0xde,
-  0x32, 0x04, 0x2c, 0x4f, 0xee, 0xcd, 0x26, 0x8e, 0x73, 0x11, 0x65, 0x2c,
-  0x9a, 0x2c, 0xf5, 0x7c, 0x51, 0xa1, 0xb7, 0x0d, 0x01, 0xcb, 0x91, 0xb2,
-  0xfe, 0x1a, 0x44, 0xed, 0xd6, 0x5d, 0xa9, 0xf9, 0xe2, 0x94, 0x51, 0xeb,
-  0x10, 0xb0, 0x1c, 0xb9, 0xdb, 0x5f, 0xbd, 0xe8, 0xb5, 0xf6, 0x89, 0x52,
-  0xb5, 0xe7, 0x90, 0x00, 0xeb, 0x10, 0xb0, 0xfc, 0xb8, 0xdd, 0x51, 0xb1,
-  0xf6, 0x8a, 0x47, 0x3d, 0x66, 0x88, 0xf6, 0x12, 0xcf, 0x68, 0x3e, 0x35,
-  0x7d, 0xf5, 0x95, 0x5f, 0xdd, 0xcd, 0x49, 0xbc, 0x99, 0x1e, 0x09, 0xb3,
-  0xd8, 0x42, 0x7c, 0x75, 0x4d, 0xd3, 0xd7, 0x5f, 0xd9, 0xb5, 0x64, 0x01,
-  0xf1, 0x22, 0xee, 0x97, 0x44, 0xc2, 0xec, 0x25, 0x03, 0xe6, 0xd4, 0x5a,
-  0xe9, 0x2f, 0x22, 0x84, 0x6b, 0x26, 0x9a, 0x1f, 0xde, 0x22, 0x61, 0xd6,
-  0x1a, 0xba, 0x2b, 0xe8, 0xf6, 0x41, 0xfa, 0xab, 0x08, 0x61, 0xe4, 0x04,
-  0x31, 0xd1, 0x56, 0x31, 0x09, 0xb3, 0xd6, 0xa5, 0x9b, 0xb0, 0x06, 0x09,
-  0xdb, 0x1f, 0x59, 0xa1, 0x4f, 0x56, 0x09, 0x9c, 0x0c, 0x48, 0x98, 0xa5,
-  0xc6, 0x4a, 0xc2, 0x3a, 0xe9, 0x2f, 0x24, 0x04, 0x92, 0xe7, 0xf1, 0x26,
-  0x7d, 0xa0, 0x32, 0x09, 0xb3, 0xd6, 0xb9, 0xd2, 0xb9, 0x4d, 0xc2, 0xf6,
-  0x44, 0xb4, 0x70, 0x24, 0x3f, 0x4d, 0x83, 0x84, 0x59, 0x4b, 0xdd, 0xca,
-  0x3c, 0x31, 0x7d, 0x25, 0x96, 0x93, 0x1c, 0xc0, 0x52, 0xdc, 0xcc, 0xa5,
-  0x24, 0x8c, 0x7b, 0x2e, 0xed, 0xa2, 0x2c, 0xa1, 0x29, 0xd7, 0xef, 0x45,
-  0x37, 0x8b, 0xb1, 0x67, 0xbf, 0x09, 0x1b, 0xcd, 0xbf, 0xec, 0xf5, 0x7a,
-  0xcf, 0xc7, 0x0b, 0xc2, 0x9b, 0xbd, 0xd1, 0x8c, 0x84, 0xed, 0x93, 0x18,
-  0xc0, 0x52, 0x1e, 0x07, 0xa5, 0x24, 0x2c, 0xf3, 0x93, 0x7d, 0x57, 0x5f,
-  0xc9, 0xd7, 0x7e, 0x4e, 0x47, 0x56, 0xf6, 0x94, 0x62, 0x62, 0x9b, 0x0d,
-  0xb1, 0xac, 0x89, 0x26, 0xc4, 0xa4, 0x15, 0x0e, 0x41, 0x4d, 0x58, 0xb6,
-  0x37, 0xae, 0x7c, 0xed, 0xa8, 0xfe, 0xca, 0xb9, 0x70, 0x99, 0x9b, 0x93,
-  0xb0, 0xbd, 0x91, 0xe7, 0x69, 0x78, 0xae, 0xdb, 0x17, 0x2f, 0x5f, 0xbd,
-  0x7a, 0xf5, 0xfa, 0x9b, 0x18, 0xdf, 0x92, 0x92, 0xb0, 0x4c, 0xcf, 0x0e,
-  0xf8, 0xfa, 0x5f, 0xb5, 0x80, 0x39, 0xdf, 0x72, 0xf0, 0x47, 0xe6, 0xe6,
-  0x03, 0x12, 0xb6, 0x27, 0xa2, 0x89, 0xc3, 0xb3, 0x02, 0xfb, 0xee, 0xcd,
-  0xd5, 0xb5, 0x37, 0xdf, 0xc5, 0xf8, 0x96, 0x26, 0xca, 0x72, 0x39, 0x66,
-  0x4b, 0xe3, 0x16, 0xe7, 0x8e, 0xd7, 0xbf, 0x91, 0xb0, 0xcc, 0x4d, 0x48,
-  0xd8, 0x9e, 0x88, 0x2e, 0x44, 0xfd, 0xa2, 0x7d, 0x71, 0x9b, 0xaf, 0xb5,
-  0xb7, 0x01, 0xdf, 0xc6, 0x37, 0x6f, 0xdf, 0xbd, 0x7b, 0x1b, 0x30, 0xb8,
-  0xa9, 0x05, 0xa9, 0x5e, 0x56, 0x33, 0xb9, 0xef, 0x7d, 0x01, 0x73, 0xbe,
-  0xa2, 0xd6, 0x91, 0x39, 0x12, 0xb6, 0x1f, 0xa2, 0xc4, 0xe1, 0x39, 0xaf,
-  0xe6, 0xbd, 0xc8, 0xd7, 0xd5, 0x1b, 0xdf, 0x57, 0xf1, 0x62, 0xf3, 0x2f,
-  0xdf, 0xfb, 0x23, 0x36, 0x52, 0x4e, 0xc3, 0xc9, 0xa8, 0xd4, 0x31, 0xf7,
-  0xe7, 0xcb, 0xf9, 0xe1, 0x6b, 0xd3, 0x97, 0x63, 0x09, 0x29, 0xf3, 0x0f,
-  0x12, 0x96, 0x9d, 0xc3, 0xcd, 0x67, 0xea, 0xb9, 0x89, 0xf9, 0x47, 0x19,
-  0xb0, 0x2b, 0xef, 0x24, 0xf1, 0xb5, 0x9b, 0xbd, 0x9f, 0xfc, 0x5f, 0x93,
-  0x52, 0xf2, 0xcd, 0xe6, 0x8c, 0xa9, 0x7f, 0x77, 0x82, 0x30, 0x84, 0x65,
-  0x6f, 0x44, 0xc2, 0xb2, 0xd7, 0x12, 0xc3, 0x8d, 0xe7, 0x8a, 0x75, 0xf3,
-  0x75, 0xf5, 0x52, 0xff, 0x37, 0xef, 0x95, 0x7f, 0xf5, 0x21, 0xe0, 0x6b,
-  0x52, 0x46, 0x9c, 0x2c, 0xbe, 0xf5, 0x61, 0x60, 0xbe, 0x7e, 0xe6, 0x11,
-  0x64, 0x7b, 0x40, 0xc2, 0xb2, 0x27, 0x1e, 0x8a, 0xe2, 0xdd, 0x64, 0x56,
-  0x52, 0xf4, 0x4a, 0xfb, 0x17, 0xaf, 0xaf, 0x54, 0x01, 0x43, 0xd8, 0x74,
-  0x31, 0xc8, 0x32, 0x60, 0xf3, 0x9f, 0x03, 0x13, 0xf6, 0xa5, 0xe9, 0x8b,
-  0xb1, 0x94, 0x48, 0x58, 0xe6, 0x44, 0x0d, 0xd1, 0xbb, 0x71, 0xf5, 0x21,
-  0x64, 0x04, 0x73, 0x8b, 0x1f, 0x37, 0x7e, 0x09, 0xfa, 0x9a, 0xc4, 0x64,
-  0xbe, 0x9f, 0xc5, 0x77, 0xfe, 0x3c, 0x30, 0x5f, 0x3c, 0x84, 0x6c, 0x3f,
-  0x48, 0x58, 0xd6, 0x36, 0x6d, 0x52, 0x03, 0xef, 0x27, 0xfd, 0x32, 0x64,
-  0x0d, 0xf6, 0x52, 0xcb, 0xd7, 0xd5, 0x8b, 0xe0, 0xaf, 0xe9, 0x22, 0x30,
-  0xb4, 0x89, 0x7c, 0xbf, 0x8f, 0x80, 0xad, 0x96, 0x17, 0x34, 0x84, 0x04,
-  0x22, 0x61, 0xd9, 0x3a, 0xda, 0x7c, 0x98, 0xbe, 0x83, 0x02, 0x5e, 0xc8,
-  0x0c, 0xfd, 0xa8, 0xfd, 0xf3, 0x0f, 0x5a, 0xbe, 0x5e, 0x85, 0x7d, 0x4f,
-  0xf3, 0x65, 0x56, 0x97, 0xb0, 0x93, 0x24, 0x60, 0x8b, 0xed, 0x05, 0xcc,
-  0x65, 0x66, 0xf1, 0x2f, 0x1f, 0x25, 0x61, 0x3c, 0x74, 0x25, 0x3d, 0x51,
-  0xa4, 0xf7, 0xd7, 0x0c, 0xc4, 0x5a, 0xcb, 0x53, 0x29, 0x8c, 0x30, 0x43,
-  0xcc, 0xf6, 0xfb, 0x4e, 0x10, 0xb0, 0xeb, 0x45, 0xe0, 0x72, 0x4b, 0x99,
-  0x71, 0x96, 0xdd, 0x04, 0xb6, 0x84, 0x94, 0x84, 0xd1, 0xf9, 0x9b, 0xda,
-  0xc9, 0xe6, 0xa3, 0x0c, 0xd8, 0x14, 0xbe, 0x6d, 0xe5, 0x78, 0xe5, 0x29,
-  0x63, 0xfc, 0xaa, 0xe6, 0x2b, 0x4e, 0x97, 0x47, 0x42, 0x8b, 0xf8, 0x01,
-  0x1b, 0x0d, 0x82, 0xaa, 0x36, 0x2e, 0xb1, 0x91, 0xc0, 0x24, 0x31, 0x18,
-  0x09, 0xcb, 0x50, 0x2d, 0x64, 0x09, 0x76, 0xe3, 0x97, 0x5f, 0x7e, 0xf1,
-  0xad, 0xb1, 0x7e, 0x72, 0x87, 0xb0, 0x58, 0x5d, 0x54, 0x49, 0x85, 0x05,
-  0x6c, 0xbc, 0xf3, 0xaf, 0x84, 0x0d, 0x61, 0x72, 0xa3, 0x2e, 0x87, 0x47,
-  0xc1, 0x0c, 0x57, 0xbf, 0xf5, 0x7a, 0x5f, 0xda, 0x36, 0x19, 0x55, 0x12,
-  0x76, 0x6c, 0xfa, 0x02, 0xb5, 0x5d, 0xfc, 0x6b, 0x4d, 0xb4, 0x71, 0x5c,
-  0xbd, 0x7f, 0x11, 0xfd, 0x2f, 0xa5, 0x10, 0x9c, 0xaf, 0x9f, 0x77, 0x07,
-  0x2c, 0x78, 0xa7, 0x4c, 0x6d, 0xe6, 0xda, 0xf7, 0x85, 0x3f, 0xfc, 0xd2,
-  0xb9, 0xdd, 0x63, 0xf8, 0x9b, 0x65, 0x83, 0xa5, 0xf2, 0x21, 0x71, 0x8a,
-  0x40, 0x2a, 0x62, 0x9b, 0x39, 0xd6, 0x9d, 0x2a, 0xd7, 0x8d, 0x88, 0xef,
-  0xbe, 0xcb, 0x27, 0x5e, 0xd3, 0xe9, 0xb7, 0xc1, 0x09, 0xdb, 0x76, 0xc9,
-  0x0e, 0xc2, 0xd7, 0x58, 0xea, 0xfd, 0xf1, 0x7b, 0x3e, 0x4c, 0x7f, 0xf4,
-  0x77, 0xe5, 0x3f, 0x65, 0xd9, 0xbe, 0xf8, 0xc8, 0xfd, 0x98, 0xce, 0x4c,
-  0x5f, 0xa3, 0x56, 0xab, 0x17, 0xff, 0xfb, 0x0f, 0xd9, 0x07, 0xdb, 0xf6,
-  0x57, 0x66, 0xa1, 0xbf, 0x35, 0xc6, 0xfa, 0x8b, 0xc4, 0x3e, 0x64, 0x35,
-  0x86, 0xc9, 0xf7, 0x3f, 0x38, 0xf6, 0x26, 0xcc, 0xed, 0xfc, 0xe5, 0x34,
-  0xb7, 0x34, 0x44, 0x1f, 0x47, 0x81, 0xa7, 0x30, 0xf3, 0xc0, 0x7c, 0x3d,
-  0xdf, 0xf6, 0x57, 0x44, 0x77, 0x95, 0x77, 0x0a, 0xb8, 0xf0, 0x3d, 0x5f,
-  0x7a, 0x7f, 0x07, 0xf4, 0x4c, 0x7e, 0xd7, 0xff, 0x4b, 0xbf, 0x5b, 0x76,
-  0x87, 0x8d, 0x92, 0x30, 0xb6, 0xc3, 0x92, 0x13, 0x4f, 0x7c, 0x28, 0xf2,
-  0x3d, 0xc2, 0x81, 0x3b, 0xcd, 0xdb, 0x7f, 0x23, 0x6c, 0x86, 0x30, 0xfd,
-  0x29, 0x4c, 0x0b, 0xf7, 0x69, 0x66, 0x03, 0xf9, 0x08, 0xdc, 0x90, 0x84,
-  0xcd, 0x97, 0xcb, 0x71, 0xaa, 0xf9, 0xa3, 0x37, 0x5f, 0x8e, 0xf3, 0x87,
-  0xe9, 0xcf, 0x31, 0x26, 0xb7, 0xba, 0xc4, 0x86, 0x73, 0x72, 0x22, 0x60,
-  0xa6, 0xbf, 0xcd, 0x68, 0xdf, 0xb4, 0xb4, 0xeb, 0x6e, 0x95, 0xa1, 0xf8,
-  0xf5, 0x7b, 0x21, 0xc6, 0x8d, 0xc9, 0xa5, 0x32, 0x7a, 0x0d, 0x26, 0x9b,
-  0x52, 0xbe, 0x13, 0x7c, 0x5f, 0xe8, 0x6d, 0x23, 0x4a, 0x9a, 0x22, 0xe3,
-  0xc8, 0xff, 0x5b, 0xe1, 0xe7, 0xb4, 0x27, 0x32, 0xe4, 0xcd, 0x9d, 0x3a,
-  0x1c, 0x9a, 0xbe, 0x4c, 0xed, 0x65, 0x43, 0xc0, 0xa6, 0x7f, 0xfa, 0xf2,
-  0xf5, 0x1f, 0xbb, 0x46, 0x97, 0x95, 0xfc, 0xb3, 0xfd, 0xe5, 0x78, 0x7c,
-  0xb9, 0x1c, 0xa8, 0x7f, 0xfd, 0x66, 0x0f, 0x5a, 0xc6, 0xb6, 0xef, 0x1b,
-  0x0c, 0xe7, 0x9b, 0x2c, 0xa6, 0x98, 0xd4, 0xfd, 0x19, 0xd0, 0xa1, 0xfc,
-  0xbb, 0x6d, 0x77, 0xd8, 0xb8, 0x1f, 0x22, 0xc7, 0x25, 0x26, 0xb5, 0xd9,
-  0x06, 0x2b, 0x78, 0x53, 0xc3, 0x7f, 0x7a, 0x2e, 0xd5, 0xdf, 0x76, 0x5f,
-  0xaa, 0x41, 0x8f, 0x68, 0xdf, 0xd8, 0x9c, 0x16, 0xe2, 0xfe, 0x82, 0x5e,
-  0x6a, 0x11, 0x9b, 0xcb, 0x99, 0x64, 0xf2, 0x85, 0xe9, 0xe8, 0xf7, 0x80,
-  0xff, 0xae, 0x7d, 0x77, 0xd8, 0xb8, 0x1f, 0x22, 0xc5, 0xfa, 0x84, 0x36,
-  0x01, 0xcb, 0x61, 0xcb, 0x35, 0x95, 0x85, 0xb2, 0x79, 0xe5, 0x7c, 0x15,
-  0xe9, 0x3c, 0x9d, 0xb0, 0x84, 0x2d, 0xe5, 0x72, 0x53, 0xa9, 0x9e, 0xf4,
-  0x2f, 0x6f, 0xcf, 0x5b, 0x1c, 0x9e, 0xcf, 0x94, 0xb1, 0x2e, 0xf9, 0x88,
-  0xb3, 0x0a, 0xbc, 0xc5, 0xe6, 0x37, 0xd3, 0x1f, 0x63, 0x6c, 0xf2, 0xf6,
-  0x74, 0x4a, 0x89, 0x09, 0x59, 0x12, 0xb0, 0x75, 0xc4, 0xbe, 0xfe, 0xaf,
-  0x9b, 0x77, 0xfa, 0xed, 0xf3, 0xa8, 0xe3, 0x40, 0x60, 0xc2, 0xfa, 0x6a,
-  0x61, 0x31, 0xb8, 0x3e, 0x29, 0xa5, 0x18, 0x70, 0xfe, 0x08, 0x7e, 0x45,
-  0xd3, 0x1f, 0x62, 0x6c, 0xee, 0x86, 0x73, 0x97, 0x42, 0x47, 0x22, 0xa1,
-  0x01, 0xfb, 0xc9, 0xd3, 0x25, 0xf5, 0xe2, 0xfd, 0xcd, 0x19, 0x02, 0x1f,
-  0x5e, 0xbe, 0x8d, 0xfc, 0xed, 0x64, 0x6e, 0xb2, 0x88, 0x35, 0x69, 0x3b,
-  0xf7, 0x15, 0xe5, 0x97, 0x9e, 0xba, 0xfd, 0x62, 0xe0, 0x84, 0x1a, 0xa4,
-  0xd9, 0xb9, 0x08, 0x79, 0xcd, 0x02, 0x6f, 0x86, 0x84, 0x90, 0xd5, 0x22,
-  0x3a, 0xeb, 0x93, 0x09, 0x09, 0xd8, 0xeb, 0x9b, 0x34, 0xbd, 0x74, 0xcf,
-  0xb4, 0xf9, 0xce, 0x6d, 0xf0, 0x7d, 0xf3, 0x2e, 0xce, 0x51, 0x89, 0x46,
-  0xcd, 0xd5, 0x99, 0x65, 0x6f, 0xe5, 0xdf, 0x8b, 0x18, 0x2d, 0xc3, 0xf2,
-  0x75, 0x91, 0xa6, 0x22, 0xb1, 0x28, 0x4d, 0xc0, 0xa6, 0x13, 0xf9, 0xe6,
-  0x29, 0x74, 0x24, 0x11, 0x18, 0xb0, 0x6f, 0xc4, 0x3d, 0x5f, 0xbf, 0x8a,
-  0x7f, 0xf2, 0x56, 0xbb, 0x47, 0xe5, 0x8d, 0xc1, 0x51, 0x2c, 0xa6, 0xe1,
-  0x7c, 0x7c, 0xb1, 0x5c, 0x2e, 0xc7, 0xa1, 0x67, 0xda, 0xfb, 0x87, 0xb9,
-  0x9b, 0xcf, 0x23, 0x5d, 0x14, 0x4a, 0x14, 0x30, 0x65, 0x1e, 0x4d, 0xcf,
-  0x54, 0x02, 0xe2, 0xc0, 0x00, 0xf5, 0x23, 0xfd, 0xe6, 0x83, 0xef, 0x76,
-  0x94, 0x1f, 0xaf, 0x74, 0xef, 0x4d, 0x7f, 0xed, 0x59, 0x5e, 0x41, 0x3d,
-  0x6f, 0x0e, 0x52, 0xdf, 0x29, 0x5a, 0xa6, 0x80, 0xb9, 0xc7, 0xd6, 0x53,
-  0xe8, 0x48, 0x20, 0x68, 0x1f, 0xec, 0x9d, 0xef, 0xd0, 0xa8, 0xb7, 0x57,
-  0x5e, 0x1f, 0xac, 0x99, 0x26, 0x46, 0x30, 0x5c, 0xb9, 0x33, 0xc5, 0xfe,
-  0xc5, 0x3c, 0xfd, 0x76, 0x55, 0xa9, 0x02, 0x36, 0x95, 0x1f, 0x0e, 0x1d,
-  0x1d, 0xf1, 0x05, 0x04, 0xec, 0x1b, 0x35, 0x48, 0xb7, 0xff, 0xe8, 0xa5,
-  0x2f, 0x60, 0xa5, 0x1a, 0xc3, 0xae, 0x0d, 0x17, 0x37, 0x32, 0xda, 0x0b,
-  0x0e, 0x09, 0x58, 0x91, 0x1b, 0xd2, 0xc2, 0xb9, 0x9d, 0xf5, 0xdc, 0x7e,
-  0x19, 0xdb, 0xe9, 0xe6, 0xa3, 0x53, 0x9a, 0x16, 0xb4, 0xe1, 0xea, 0xf6,
-  0x48, 0x80, 0x57, 0xfe, 0x80, 0x5d, 0xbd, 0x36, 0xfd, 0xbd, 0x17, 0x59,
-  0xf0, 0x59, 0xa9, 0x5f, 0x99, 0x7e, 0x5b, 0x09, 0xb9, 0x85, 0x0e, 0xf6,
-  0x9b, 0xe3, 0x12, 0xb7, 0xab, 0x28, 0x93, 0x97, 0x77, 0xd1, 0x02, 0xf6,
-  0x26, 0xaf, 0xfb, 0xc1, 0x6c, 0x14, 0xbc, 0xc3, 0x66, 0xed, 0x51, 0x8e,
-  0xf2, 0xc7, 0x69, 0x1c, 0x99, 0xbe, 0x60, 0x6d, 0x13, 0x70, 0x3f, 0x98,
-  0x16, 0xb0, 0xdb, 0xa5, 0x56, 0x50, 0xc0, 0x4a, 0x37, 0x49, 0xcc, 0xd4,
-  0xdf, 0xca, 0xb3, 0x04, 0xbb, 0x26, 0x37, 0xed, 0xdb, 0xa6, 0x2f, 0x58,
-  0xeb, 0x6c, 0x3e, 0x38, 0xa5, 0xd3, 0x5b, 0x9d, 0x22, 0x6e, 0x4e, 0x6c,
-  0x0b, 0x0c, 0xd8, 0x15, 0x43, 0x58, 0xb8, 0xa0, 0x32, 0x87, 0x7d, 0x9d,
-  0x52, 0x92, 0xdb, 0xd1, 0xc1, 0x6e, 0x58, 0x4c, 0xa2, 0x32, 0xed, 0x7e,
-  0x98, 0x6a, 0x91, 0x63, 0xb3, 0xd0, 0x0a, 0x0e, 0x18, 0xab, 0xb0, 0x2d,
-  0xfc, 0x93, 0x44, 0xdb, 0xee, 0xb8, 0xd4, 0xb8, 0xb7, 0x5f, 0xd6, 0x4d,
-  0x5f, 0xb1, 0x96, 0xd9, 0xec, 0x34, 0xab, 0x87, 0xa0, 0xb9, 0x35, 0x43,
-  0xf1, 0x68, 0x87, 0xe0, 0x80, 0x7d, 0x48, 0xf2, 0x4d, 0x55, 0x86, 0x2f,
-  0x61, 0xd6, 0xf5, 0xd2, 0x07, 0xff, 0x38, 0x34, 0x25, 0xc6, 0x13, 0xb4,
-  0xd3, 0x2c, 0xf2, 0xf4, 0x4a, 0x6c, 0x76, 0xbd, 0x0b, 0x0c, 0xd8, 0x95,
-  0xe9, 0x2f, 0xbd, 0xd8, 0x26, 0x6a, 0xc7, 0xef, 0x0f, 0xff, 0x6d, 0xef,
-  0x02, 0xec, 0x96, 0x6c, 0xac, 0xe7, 0xee, 0xcb, 0x58, 0xc4, 0x46, 0x98,
-  0xf6, 0xfd, 0xdf, 0xb4, 0x22, 0xfe, 0xea, 0x9e, 0x7a, 0xf8, 0x36, 0x38,
-  0x60, 0x3f, 0xc5, 0xfe, 0x96, 0xaa, 0x65, 0xfe, 0x9b, 0x2c, 0xd0, 0xff,
-  0x69, 0xdb, 0xcd, 0x96, 0x3e, 0xee, 0x6e, 0x18, 0x2d, 0x53, 0x71, 0x44,
-  0x3a, 0x56, 0xea, 0x45, 0x70, 0xc0, 0xf6, 0x7f, 0x6e, 0xb6, 0xed, 0x46,
-  0xe7, 0xe3, 0x6b, 0xb6, 0x8f, 0x5e, 0x37, 0x64, 0xdd, 0x86, 0x43, 0x70,
-  0xe2, 0x10, 0x07, 0x23, 0x6e, 0x3f, 0x5e, 0xe9, 0x03, 0x01, 0xc3, 0x98,
-  0x49, 0x62, 0x12, 0x5d, 0x7f, 0x95, 0xc3, 0xef, 0x35, 0x01, 0xc3, 0xb4,
-  0xc7, 0x24, 0x31, 0x81, 0xc3, 0x80, 0x2a, 0x87, 0x4f, 0xf0, 0x1c, 0xd1,
-  0xf4, 0x17, 0x8e, 0x7c, 0xc9, 0x5a, 0x3d, 0x93, 0xc4, 0x18, 0x02, 0xab,
-  0x1c, 0x3e, 0xbf, 0x06, 0xe4, 0x8b, 0x32, 0x7d, 0xd5, 0xac, 0x98, 0x24,
-  0xc6, 0x27, 0xaa, 0x1c, 0xdb, 0x4f, 0xed, 0xfb, 0x85, 0x8d, 0x66, 0x28,
-  0x77, 0xae, 0x30, 0x49, 0x8c, 0x6e, 0xf3, 0x91, 0xed, 0x38, 0xf7, 0xc6,
-  0xbf, 0xd7, 0xfc, 0xa6, 0x4c, 0xb7, 0x84, 0x21, 0x12, 0x79, 0x44, 0x07,
-  0xdb, 0xcd, 0xd1, 0xb5, 0xa3, 0x2c, 0xc2, 0xbc, 0xcf, 0x3e, 0x5f, 0x7b,
-  0x67, 0xfa, 0xdb, 0x46, 0xfe, 0xe4, 0x24, 0x91, 0x9e, 0xc4, 0xc8, 0xc4,
-  0x33, 0x2e, 0x77, 0xb4, 0xca, 0x79, 0x0b, 0x89, 0xaf, 0x4c, 0x7f, 0xd7,
-  0x30, 0x41, 0x56, 0x12, 0x39, 0x3f, 0x20, 0x2a, 0xf1, 0x80, 0x95, 0x5d,
-  0xc7, 0x79, 0xbe, 0xd7, 0xf2, 0x55, 0xaa, 0x33, 0x03, 0x10, 0x99, 0xbc,
-  0xf9, 0x92, 0x63, 0xdc, 0xa2, 0x12, 0x5b, 0xcd, 0x3b, 0x9f, 0x95, 0xa5,
-  0x26, 0xec, 0x57, 0xf2, 0x55, 0x51, 0x72, 0xbb, 0xf9, 0xd4, 0xf4, 0x85,
-  0x6b, 0x8d, 0xcd, 0x22, 0x6c, 0xb0, 0xf3, 0xb3, 0x95, 0x3d, 0xbf, 0x6f,
-  0x28, 0x20, 0x56, 0x96, 0xec, 0x49, 0x64, 0x33, 0x2c, 0x2a, 0xb1, 0x08,
-  0xdb, 0xdd, 0x31, 0x77, 0x7b, 0xbc, 0xef, 0xab, 0xd7, 0x0c, 0x5f, 0x15,
-  0x26, 0x7b, 0x12, 0x39, 0x02, 0x27, 0x22, 0xb1, 0x08, 0xbb, 0x34, 0xfd,
-  0xd5, 0xc1, 0x0a, 0x17, 0xd4, 0x39, 0xe2, 0x11, 0x8b, 0xb0, 0x5e, 0xfa,
-  0xcf, 0x1e, 0x15, 0x20, 0x37, 0xc3, 0xa8, 0x73, 0x44, 0xb4, 0xb9, 0xab,
-  0xd9, 0xd2, 0x63, 0xfb, 0x90, 0x37, 0x59, 0xe7, 0xa0, 0x9f, 0x23, 0x1a,
-  0x71, 0x38, 0x62, 0xa4, 0xe7, 0x6e, 0x01, 0xa2, 0xce, 0xd1, 0x35, 0x7d,
-  0xe5, 0x5a, 0xe2, 0x88, 0x39, 0x22, 0xe2, 0x90, 0x75, 0x8e, 0x63, 0xd3,
-  0x97, 0xae, 0x25, 0xba, 0xcc, 0x11, 0x11, 0x87, 0xa8, 0x73, 0x50, 0xaa,
-  0x8f, 0x46, 0x14, 0xea, 0xc7, 0xe9, 0x3f, 0x7a, 0x54, 0xc1, 0x90, 0x96,
-  0xc4, 0x58, 0x0e, 0x36, 0x1f, 0x57, 0xc1, 0x9f, 0x85, 0x8e, 0xc2, 0x90,
-  0xcf, 0x34, 0xe2, 0x2c, 0xed, 0x48, 0x44, 0x47, 0x7d, 0x29, 0x4e, 0x67,
-  0xc1, 0xfe, 0x8d, 0x44, 0xa9, 0x9e, 0xdd, 0xe6, 0x48, 0x44, 0x1d, 0x71,
-  0x96, 0xfe, 0xa3, 0x47, 0x25, 0x8c, 0x19, 0xc2, 0xe2, 0x10, 0x75, 0x44,
-  0xc7, 0xfa, 0xe3, 0xfb, 0x90, 0x93, 0x3e, 0x43, 0x58, 0x1c, 0xe2, 0xe8,
-  0x1b, 0xb6, 0xc2, 0x10, 0x8d, 0x3c, 0x4b, 0x9b, 0xc3, 0xea, 0xa3, 0x38,
-  0xa3, 0xcc, 0x91, 0xab, 0xe1, 0xc2, 0xfa, 0x2d, 0x11, 0x31, 0x84, 0xd1,
-  0x30, 0x15, 0x89, 0xd8, 0x0a, 0xb3, 0xfb, 0x11, 0x05, 0x96, 0x18, 0x5d,
-  0x17, 0xe1, 0x96, 0x96, 0x57, 0x94, 0xce, 0x19, 0xc2, 0xe2, 0x10, 0xa7,
-  0xb7, 0x2d, 0xd3, 0x7f, 0xf2, 0xd8, 0x61, 0xd8, 0x2b, 0xc5, 0x6c, 0x61,
-  0xc9, 0x10, 0x16, 0x83, 0x68, 0xa9, 0xa7, 0x52, 0xbf, 0x77, 0xf2, 0xfc,
-  0xce, 0x73, 0xd3, 0xef, 0x24, 0x9d, 0x05, 0x43, 0x58, 0x1c, 0x4d, 0x86,
-  0xb0, 0x7c, 0xb8, 0xcf, 0xb2, 0xb3, 0x7d, 0x53, 0x44, 0x0c, 0x61, 0x14,
-  0x12, 0xa3, 0x38, 0x62, 0x08, 0xcb, 0x85, 0x9b, 0x2f, 0xeb, 0x3b, 0xd3,
-  0xe4, 0x10, 0xc6, 0x5e, 0x58, 0x14, 0x35, 0x86, 0xb0, 0x1c, 0x0c, 0xdd,
-  0x7c, 0x0d, 0xac, 0x2f, 0x24, 0x32, 0x84, 0xc5, 0x51, 0x67, 0x08, 0xdb,
-  0x3f, 0xf7, 0x69, 0xe2, 0xce, 0xc0, 0xe6, 0x67, 0x36, 0xdf, 0x62, 0x08,
-  0x8b, 0x85, 0x21, 0x6c, 0xff, 0x96, 0x65, 0xca, 0x97, 0x7b, 0x0c, 0x29,
-  0x4d, 0xf5, 0x51, 0xc8, 0x21, 0xcc, 0xf2, 0xea, 0x56, 0x81, 0x8d, 0xcb,
-  0x95, 0x2f, 0xd9, 0xce, 0xc1, 0x7d, 0x61, 0x91, 0x88, 0x21, 0xcc, 0xf6,
-  0x0d, 0x9a, 0xc2, 0x5a, 0x94, 0x2c, 0x5f, 0x6e, 0x3b, 0x07, 0xb7, 0x36,
-  0x47, 0x21, 0x87, 0x30, 0xdb, 0xcb, 0x5b, 0x05, 0x25, 0xef, 0xf1, 0x28,
-  0x4d, 0xbe, 0xe4, 0x10, 0xc6, 0xe9, 0x1c, 0x91, 0x88, 0x96, 0x5f, 0xfb,
-  0xeb, 0x5b, 0x85, 0x34, 0x73, 0xca, 0x37, 0x09, 0x17, 0xbf, 0x33, 0x3a,
-  0xa6, 0xaf, 0x5d, 0x2b, 0xc8, 0xbd, 0xb0, 0x9d, 0xe7, 0xd4, 0x23, 0x3e,
-  0x77, 0x82, 0x58, 0xa2, 0x86, 0x4f, 0xb1, 0xaa, 0xa4, 0x5f, 0x2a, 0x12,
-  0x71, 0x38, 0x07, 0xa5, 0xfa, 0x3d, 0x10, 0xeb, 0x15, 0xeb, 0x3b, 0x38,
-  0x54, 0x23, 0xf1, 0x43, 0x71, 0xcc, 0x6f, 0x14, 0xad, 0x86, 0xa8, 0x73,
-  0x70, 0xe7, 0x65, 0xd6, 0xe4, 0x0d, 0x54, 0xbd, 0x52, 0x7d, 0xb6, 0x62,
-  0xde, 0xcb, 0x66, 0x73, 0x24, 0x1d, 0x71, 0x15, 0x70, 0x50, 0x7d, 0xc6,
-  0xe4, 0x53, 0x49, 0x76, 0x3d, 0xe9, 0xd0, 0x32, 0xf2, 0x81, 0x61, 0x54,
-  0xea, 0x23, 0xa9, 0x31, 0x49, 0xdc, 0x8f, 0x55, 0x59, 0x4b, 0xb4, 0x62,
-  0xef, 0x9c, 0xe7, 0x85, 0x45, 0x22, 0x4e, 0x70, 0x73, 0x06, 0x4b, 0xd7,
-  0xc5, 0x38, 0x99, 0xf3, 0x45, 0x22, 0xe5, 0xfa, 0x15, 0xbf, 0x21, 0x06,
-  0xb0, 0xd2, 0x6d, 0x32, 0x52, 0xa9, 0x8f, 0x47, 0xdc, 0x79, 0x69, 0xa1,
-  0xfe, 0x32, 0x99, 0x84, 0xbf, 0x3e, 0xc6, 0xf3, 0x18, 0xbf, 0x34, 0xfe,
-  0x2c, 0xef, 0xcc, 0x40, 0xfc, 0xea, 0xe0, 0xb6, 0xb0, 0x48, 0x5a, 0xdd,
-  0x84, 0x97, 0x37, 0xa2, 0x28, 0x61, 0xa3, 0xa7, 0xa8, 0xd4, 0x53, 0xe6,
-  0x88, 0xa6, 0x9e, 0xea, 0x02, 0xc2, 0x76, 0x39, 0x0f, 0x60, 0xff, 0xf3,
-  0x8f, 0x7f, 0xfc, 0xef, 0x5f, 0x03, 0x06, 0xed, 0x59, 0xa4, 0x21, 0x7a,
-  0x15, 0x69, 0x70, 0x96, 0xe5, 0x51, 0xca, 0x1c, 0xd1, 0x9c, 0xa4, 0xb9,
-  0x80, 0xb0, 0x55, 0xbe, 0x03, 0xd8, 0xe8, 0xff, 0x72, 0xfd, 0xe1, 0x28,
-  0x73, 0x44, 0xd3, 0x6a, 0xa7, 0xff, 0xac, 0x11, 0x2c, 0xd7, 0x1e, 0xa9,
-  0xe1, 0x1f, 0xf9, 0xfe, 0x70, 0x6d, 0xd3, 0x57, 0xae, 0x2d, 0x0e, 0x1a,
-  0xe9, 0x3f, 0x6c, 0x04, 0xf9, 0x36, 0xcf, 0x7c, 0x2d, 0xfe, 0x29, 0xef,
-  0x1f, 0x8f, 0x6e, 0x8e, 0x88, 0x8e, 0x9a, 0x35, 0x0d, 0x75, 0x8f, 0x8c,
-  0x3c, 0xcf, 0x31, 0x5f, 0xab, 0xfc, 0x7f, 0x3c, 0xea, 0x88, 0x39, 0xab,
-  0x27, 0xd3, 0x39, 0x4e, 0xe6, 0xb0, 0x96, 0x48, 0x8e, 0x33, 0xe2, 0xfc,
-  0x76, 0xf8, 0x46, 0xb3, 0xf4, 0xef, 0x96, 0x80, 0xc1, 0xa4, 0x83, 0xe8,
-  0xbf, 0x32, 0xfe, 0xf9, 0xf6, 0x02, 0xcc, 0x6f, 0x93, 0x79, 0xd2, 0x4b,
-  0x17, 0x95, 0x44, 0xd8, 0x6a, 0x86, 0x19, 0xa2, 0x3d, 0x26, 0xb7, 0x06,
-  0xcf, 0xb9, 0x7b, 0x76, 0x95, 0xf3, 0x97, 0x7f, 0x09, 0x18, 0xb5, 0xf7,
-  0x92, 0x2f, 0x96, 0x60, 0x30, 0x43, 0xb4, 0x50, 0xe7, 0x54, 0x43, 0xd4,
-  0xa6, 0x87, 0xcd, 0x14, 0xbb, 0x53, 0x47, 0xd1, 0xc6, 0xe7, 0xdb, 0x09,
-  0xfa, 0x99, 0xe9, 0x4f, 0x19, 0x95, 0x25, 0xda, 0xcf, 0xf2, 0xb9, 0x51,
-  0x5c, 0x9b, 0x1e, 0x72, 0x58, 0x06, 0xca, 0xef, 0x70, 0x73, 0xb5, 0xe7,
-  0x92, 0x2f, 0x75, 0x7a, 0xd8, 0x60, 0x58, 0x41, 0x05, 0x6c, 0x96, 0x3c,
-  0x79, 0xb4, 0x71, 0x8c, 0x2e, 0x94, 0xe1, 0xab, 0xcd, 0x81, 0xa0, 0xa8,
-  0x82, 0xcd, 0xf5, 0x9e, 0xc3, 0x49, 0x27, 0x8b, 0x7e, 0x46, 0xcb, 0x2f,
-  0xc0, 0x1e, 0x9b, 0x0b, 0x7e, 0xff, 0xb7, 0x5a, 0x8e, 0x95, 0x78, 0x35,
-  0x38, 0xe8, 0x09, 0x15, 0x91, 0x53, 0xc0, 0xb4, 0xea, 0x46, 0x9b, 0xa2,
-  0x39, 0x2a, 0xe2, 0x28, 0x9f, 0x80, 0xa9, 0xc3, 0x17, 0xd3, 0x43, 0x54,
-  0x87, 0xb8, 0xc3, 0x6e, 0xaf, 0xf7, 0x82, 0x69, 0xc3, 0x17, 0xd3, 0x43,
-  0x54, 0x48, 0x1e, 0x01, 0xd3, 0x86, 0x2f, 0xa6, 0x87, 0xa8, 0x92, 0xfd,
-  0x07, 0x4c, 0x6f, 0x3d, 0xe4, 0x61, 0x42, 0xa8, 0x94, 0x7d, 0x07, 0x6c,
-  0x74, 0xa9, 0xb5, 0x04, 0xd2, 0xd3, 0x8e, 0x6a, 0x69, 0xed, 0xb7, 0xc8,
-  0x71, 0xae, 0xee, 0x7d, 0x51, 0xdd, 0x40, 0xf5, 0xec, 0x33, 0x60, 0x43,
-  0xb5, 0x75, 0x83, 0xde, 0x28, 0x54, 0xd1, 0x1e, 0x03, 0x36, 0x1e, 0xa8,
-  0xf9, 0x3a, 0x64, 0xf8, 0x42, 0x05, 0x75, 0xf7, 0xd5, 0x8b, 0xa8, 0xcf,
-  0x0e, 0x19, 0xbe, 0x50, 0x4d, 0x9b, 0x66, 0xdf, 0xac, 0x6f, 0x68, 0x1e,
-  0x2e, 0x1d, 0x56, 0x5f, 0xc0, 0x27, 0xcd, 0x4d, 0x04, 0x32, 0x7d, 0x6e,
-  0x91, 0x5e, 0x3b, 0xa4, 0x78, 0x88, 0xea, 0x3a, 0xdd, 0x43, 0x9d, 0x5e,
-  0x5f, 0x7c, 0x39, 0xc7, 0x0c, 0x5f, 0xa8, 0x2c, 0xb1, 0x11, 0x96, 0x5d,
-  0x95, 0x63, 0xae, 0x2d, 0xbe, 0x9c, 0x1a, 0xad, 0x1b, 0xa8, 0xb2, 0x4d,
-  0x0e, 0x7a, 0x19, 0xc5, 0x4b, 0xaf, 0x6d, 0xd0, 0x79, 0x88, 0xaa, 0x13,
-  0xa7, 0x38, 0x65, 0x72, 0x28, 0xc7, 0x42, 0xaf, 0x6d, 0x38, 0x27, 0xcc,
-  0x0e, 0x51, 0x71, 0xc7, 0xd9, 0xcd, 0x11, 0xbd, 0xf1, 0xaa, 0x71, 0x2c,
-  0x00, 0x2a, 0x4f, 0x1c, 0x8c, 0x38, 0xc8, 0x3a, 0x5e, 0x5d, 0xb6, 0xbe,
-  0x00, 0xb9, 0xd5, 0xec, 0xcc, 0xd3, 0xad, 0xbd, 0x3c, 0xf1, 0x6a, 0xf0,
-  0xc0, 0x20, 0xe0, 0x9a, 0x28, 0xd4, 0x0f, 0x52, 0x6c, 0x85, 0x79, 0x2a,
-  0x87, 0x94, 0xe6, 0x01, 0xa1, 0x25, 0x9e, 0x08, 0x95, 0xf4, 0xf4, 0xec,
-  0x91, 0x67, 0xdf, 0xcb, 0x71, 0x9a, 0x2c, 0xbe, 0x00, 0x41, 0x3e, 0x5b,
-  0x3e, 0xd1, 0xf1, 0xd9, 0x13, 0xdf, 0xb3, 0x52, 0x0e, 0x89, 0x17, 0xe0,
-  0x92, 0x43, 0xd8, 0x20, 0xf6, 0x23, 0x8c, 0x46, 0x73, 0xdf, 0xa3, 0x52,
-  0x6a, 0xf4, 0x45, 0x01, 0x1a, 0x39, 0x84, 0xc5, 0x4c, 0xd8, 0x64, 0x36,
-  0x20, 0x5e, 0xc0, 0x4e, 0xf2, 0x39, 0x7f, 0x83, 0xe8, 0x2d, 0x89, 0x93,
-  0x4b, 0x6f, 0x61, 0x83, 0x78, 0x01, 0x81, 0x0e, 0xdc, 0x8c, 0x44, 0xdb,
-  0x6f, 0x0e, 0x4a, 0x97, 0xd3, 0xa4, 0xeb, 0x10, 0x08, 0xd4, 0x71, 0x63,
-  0xd2, 0xdf, 0xb5, 0x1f, 0x36, 0x9a, 0xcf, 0x02, 0xd2, 0xd5, 0xa0, 0x72,
-  0x08, 0x84, 0x6a, 0x2a, 0x59, 0xe9, 0xaf, 0x42, 0xfb, 0x12, 0x17, 0x81,
-  0xe1, 0x72, 0x9c, 0x2e, 0xfb, 0x5e, 0xc0, 0x36, 0x4d, 0x2d, 0x30, 0xfd,
-  0xd9, 0x78, 0xa1, 0x2c, 0xc7, 0x46, 0x8b, 0xc5, 0x62, 0x3c, 0x5e, 0x86,
-  0x3d, 0x5c, 0xb9, 0x46, 0xcb, 0x3c, 0xb0, 0x43, 0xd3, 0x49, 0xa6, 0xc1,
-  0xd2, 0x0b, 0x88, 0xe0, 0x34, 0x49, 0xbc, 0x0e, 0x19, 0xbc, 0x80, 0x68,
-  0xea, 0xdd, 0x98, 0xe9, 0x6a, 0x9f, 0x52, 0xd8, 0x00, 0x22, 0x6b, 0x9d,
-  0x90, 0x2e, 0x60, 0x8f, 0x8e, 0xa2, 0xad, 0xc4, 0x1a, 0xcd, 0x0e, 0x55,
-  0x43, 0x20, 0x81, 0xa3, 0xd3, 0xf6, 0xf6, 0x70, 0x75, 0x0f, 0x4f, 0xa9,
-  0x6a, 0x00, 0xc9, 0x1d, 0x9d, 0x36, 0x03, 0x43, 0xd6, 0xa8, 0x35, 0x8f,
-  0xeb, 0x8c, 0x5c, 0x40, 0x06, 0x0e, 0xea, 0x9d, 0x63, 0x57, 0xa7, 0x5e,
-  0x67, 0xd8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xe5, 0xce,
-  0xa7, 0x77, 0xef, 0x99, 0x7e, 0x0f, 0x40, 0x49, 0xdd, 0x7f, 0xf0, 0x71,
-  0xed, 0xe1, 0x23, 0xd3, 0xef, 0x03, 0x28, 0xa3, 0xcf, 0x1e, 0x7f, 0xbc,
-  0x45, 0xc2, 0x80, 0xac, 0xdd, 0x79, 0xf2, 0x51, 0x78, 0x62, 0xfa, 0xbd,
-  0x00, 0x65, 0xf3, 0xf9, 0x47, 0xc5, 0x1d, 0xd3, 0xef, 0x06, 0x28, 0x95,
-  0x7b, 0x4f, 0xd5, 0x7c, 0x7d, 0xa4, 0xd0, 0x01, 0x64, 0xe7, 0xfe, 0x17,
-  0x1f, 0x75, 0x2c, 0xc2, 0x80, 0xcc, 0x7c, 0xfa, 0xd8, 0x93, 0xaf, 0x87,
-  0xa6, 0xdf, 0x11, 0x50, 0x1a, 0x4a, 0x71, 0x43, 0xf8, 0x34, 0xe5, 0x4b,
-  0xde, 0xbf, 0xfb, 0xec, 0xd9, 0x5d, 0xd6, 0x71, 0xc0, 0x27, 0x9f, 0xdc,
-  0x7d, 0xec, 0xcb, 0xd7, 0x67, 0x29, 0x5f, 0xf2, 0x76, 0x44, 0x7c, 0x9c,
-  0xf6, 0x65, 0x00, 0xeb, 0x3d, 0x7a, 0xea, 0x8b, 0xd7, 0x93, 0xb4, 0x43,
-  0xcf, 0x1d, 0x11, 0xd9, 0xcf, 0x4d, 0xff, 0x74, 0x80, 0x51, 0xbe, 0xe2,
-  0xc6, 0x7a, 0xdc, 0xb9, 0x9b, 0xfa, 0x55, 0x1f, 0xc8, 0x17, 0x7b, 0x70,
-  0xdf, 0xf4, 0x4f, 0x08, 0x98, 0xf3, 0xe9, 0x43, 0x5f, 0xbe, 0x9e, 0x65,
-  0x10, 0x09, 0xe5, 0x55, 0x9f, 0x92, 0x30, 0x54, 0xd5, 0xfd, 0x67, 0xbe,
-  0x78, 0x3d, 0xcc, 0x64, 0xff, 0x4b, 0x7b, 0x45, 0x0a, 0xfe, 0xa8, 0x28,
-  0xff, 0xea, 0xeb, 0x8b, 0x6c, 0xc6, 0x1b, 0xed, 0x85, 0x1f, 0xb3, 0x67,
-  0x8d, 0x4a, 0xba, 0xeb, 0x8d, 0xd7, 0xd3, 0xac, 0x06, 0x9b, 0xcf, 0xf5,
-  0xd7, 0xa5, 0x98, 0x88, 0x2a, 0xf2, 0xec, 0x7e, 0x65, 0x50, 0xdc, 0x10,
-  0xee, 0x7b, 0xc6, 0xc6, 0x2f, 0x4c, 0xff, 0xa8, 0x40, 0xfe, 0xf4, 0xed,
-  0xaf, 0x67, 0x59, 0x6e, 0x0b, 0x7b, 0x13, 0x46, 0x31, 0x11, 0xd5, 0xa3,
-  0x86, 0xe0, 0x71, 0x68, 0xeb, 0xc6, 0xfd, 0x7b, 0xf7, 0x92, 0x2c, 0xa2,
-  0x1e, 0xe8, 0x09, 0xa3, 0x98, 0x88, 0xca, 0x51, 0x32, 0x10, 0x5e, 0xdc,
-  0xb8, 0x69, 0xf3, 0x78, 0x98, 0xa0, 0x73, 0xca, 0xb3, 0x0e, 0x7b, 0x4c,
-  0x31, 0x11, 0x15, 0x23, 0xfb, 0x2d, 0x9e, 0x86, 0x0f, 0x51, 0x22, 0x26,
-  0x09, 0x12, 0xf6, 0x99, 0x27, 0x61, 0x69, 0xdb, 0x1b, 0x01, 0xcb, 0x3c,
-  0x7a, 0xbc, 0xab, 0x9f, 0xe9, 0x8e, 0x8c, 0x47, 0xf2, 0x97, 0xa7, 0x98,
-  0x88, 0xaa, 0xba, 0x7f, 0xf7, 0xc1, 0xf6, 0x9e, 0x77, 0x77, 0x9e, 0x97,
-  0x64, 0x1d, 0xe6, 0x6d, 0x73, 0x7c, 0x60, 0xfa, 0xe7, 0x05, 0x8a, 0xc5,
-  0x0d, 0x58, 0xa2, 0xb6, 0xdd, 0xfb, 0x9e, 0x9d, 0x80, 0x2c, 0xda, 0xb0,
-  0x80, 0xf2, 0x70, 0x03, 0xf6, 0x2c, 0xd9, 0x0b, 0x50, 0x4c, 0x04, 0xc2,
-  0x7d, 0xea, 0xb6, 0x14, 0x26, 0x7c, 0x05, 0x4f, 0xbb, 0x08, 0xa7, 0x55,
-  0x01, 0xae, 0x47, 0x6e, 0x34, 0x92, 0x8e, 0x3d, 0x9f, 0xe9, 0xa5, 0x0e,
-  0x1a, 0x13, 0x01, 0x57, 0x06, 0xc9, 0xd0, 0x8b, 0x89, 0xdc, 0x82, 0x09,
-  0xb8, 0x9e, 0x64, 0x90, 0x8c, 0x3b, 0x4f, 0x09, 0x18, 0x10, 0xc8, 0xbd,
-  0xe1, 0x39, 0x45, 0x8d, 0x5d, 0x2d, 0x26, 0x66, 0xd7, 0x51, 0x0c, 0xd8,
-  0xcf, 0x6d, 0xc7, 0x78, 0x9a, 0xe6, 0x65, 0x64, 0x31, 0xf1, 0x31, 0x27,
-  0x4d, 0x01, 0xae, 0x7b, 0xee, 0xd8, 0x93, 0xea, 0x75, 0x44, 0x50, 0xe9,
-  0xe6, 0x00, 0x54, 0x59, 0xd5, 0xff, 0xee, 0x3d, 0x4c, 0xd8, 0x34, 0x0c,
-  0x94, 0xd9, 0xd3, 0xcc, 0x56, 0x4f, 0x8f, 0xee, 0xd1, 0x50, 0x0f, 0x78,
-  0xb8, 0xad, 0x18, 0xdc, 0x96, 0x0c, 0x64, 0xce, 0xed, 0xc4, 0xa0, 0x09,
-  0x03, 0xc8, 0xdc, 0x3d, 0x02, 0x06, 0xec, 0xcf, 0x7d, 0x02, 0x06, 0xec,
-  0xd1, 0x93, 0xac, 0x8a, 0x1c, 0x00, 0xfc, 0x44, 0x2b, 0x21, 0x77, 0x9a,
-  0x00, 0xfb, 0xf0, 0xe8, 0xe6, 0xa4, 0xf9, 0x27, 0xe4, 0x6b, 0x4f, 0xfe,
-  0x1f, 0x41, 0x02, 0xdb, 0x08, 0x98, 0x9a, 0x2a, 0x91, 0x00, 0x00, 0x00,
-  0x25, 0x74, 0x45, 0x58, 0x74, 0x64, 0x61, 0x74, 0x65, 0x3a, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x00, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x38,
-  0x2d, 0x30, 0x32, 0x54, 0x30, 0x36, 0x3a, 0x32, 0x37, 0x3a, 0x32, 0x36,
-  0x2b, 0x30, 0x30, 0x3a, 0x30, 0x30, 0xf2, 0xb4, 0xe6, 0xf6, 0x00, 0x00,
-  0x00, 0x25, 0x74, 0x45, 0x58, 0x74, 0x64, 0x61, 0x74, 0x65, 0x3a, 0x6d,
-  0x6f, 0x64, 0x69, 0x66, 0x79, 0x00, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30,
-  0x38, 0x2d, 0x30, 0x32, 0x54, 0x30, 0x36, 0x3a, 0x32, 0x37, 0x3a, 0x32,
-  0x36, 0x2b, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x83, 0xe9, 0x5e, 0x4a, 0x00,
-  0x00, 0x00, 0x28, 0x74, 0x45, 0x58, 0x74, 0x64, 0x61, 0x74, 0x65, 0x3a,
-  0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x00, 0x32, 0x30,
-  0x32, 0x35, 0x2d, 0x30, 0x38, 0x2d, 0x30, 0x32, 0x54, 0x30, 0x36, 0x3a,
-  0x32, 0x37, 0x3a, 0x35, 0x39, 0x2b, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x28,
-  0x71, 0x06, 0x65, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae,
-  0x42, 0x60, 0x82
+static const uint32_t bongo_cat_right_down_png_runs[] = {
+  0x3763, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xc0000000, 0x2, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x40000000, 0x359, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x5, 0xff000000, 0x1, 0xa0000000, 0x1, 0x20000000,
+  0x356, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0x80000000, 0x1, 0x10000000, 0x353, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000,
+  0x352, 0x00ffffff, 0x1, 0xb0000000, 0xd, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x40000000, 0x34f, 0x00ffffff, 0x1, 0x90000000, 0x10, 0xff000000,
+  0x1, 0x90000000, 0x1, 0x10000000, 0x34c, 0x00ffffff, 0x1, 0x60000000,
+  0x12, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000, 0x34a, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x14, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x20000000, 0x347, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xff1f1f1f, 0xc, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x70000000, 0x346, 0x00ffffff, 0x1, 0xb0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1, 0xffefefef,
+  0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x20000000, 0x343, 0x00ffffff, 0x1, 0x70000000, 0x9, 0xff000000,
+  0x1, 0xffcfcfcf, 0x3, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0xc, 0xff000000, 0x1, 0xf0000000, 0x1, 0x70000000, 0x341, 0x00ffffff,
+  0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x6, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff2f2f2f, 0xc, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x10000000, 0x33e, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x9, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x33d, 0x00ffffff, 0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0xb, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff3f3f3f, 0xc, 0xff000000,
+  0x1, 0x90000000, 0x1, 0x10000000, 0x33a, 0x00ffffff, 0x1, 0x50000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0xd, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0x338, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x8, 0xff000000, 0x1, 0xffafafaf, 0xf, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff4f4f4f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000,
+  0x337, 0x00ffffff, 0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f,
+  0x12, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0xb, 0xff000000,
+  0x1, 0x90000000, 0x335, 0x00ffffff, 0x1, 0x50000000, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x13, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff3f3f3f, 0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000,
+  0x332, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xffcfcfcf, 0x16, 0xffffffff, 0x1, 0xff8f8f8f, 0xb, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x331, 0x00ffffff, 0x1, 0xb0000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x18, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0x60000000, 0x32f, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f, 0x1a, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0x90000000,
+  0x32d, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1c, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000,
+  0x32b, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f,
+  0x1e, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xa, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x329, 0x00ffffff, 0x1, 0x20000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x20, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff3f3f3f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x328, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xffcfcfcf,
+  0x22, 0xffffffff, 0x1, 0xff6f6f6f, 0xa, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x326, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0x24, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000, 0x325, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x25, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x323, 0x00ffffff, 0x1, 0x60000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x27, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x321, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x29, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff3f3f3f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x320, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffcfcfcf,
+  0x2b, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000, 0x1, 0xa0000000,
+  0x31e, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x2d, 0xffffffff, 0x1, 0xff6f6f6f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x31d, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x2e, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0xa0000000, 0x31b, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x30, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xa0000000, 0x31a, 0x00ffffff,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x31, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x318, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x33, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0x60000000, 0x317, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x34, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0x60000000,
+  0x315, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x36, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0x70000000, 0x1, 0x40000000, 0x1, 0x20000000,
+  0xf2, 0x00ffffff, 0x2, 0x40000000, 0x1, 0x70000000, 0x1, 0x30000000,
+  0x21c, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x37, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x14, 0xff000000, 0x1, 0xf0000000, 0x6, 0xc0000000, 0x1, 0xa0000000,
+  0x4, 0x80000000, 0x1, 0x70000000, 0x4, 0x40000000, 0x1, 0x10000000,
+  0xd5, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xe0000000, 0x3, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x30000000, 0x21b, 0x00ffffff, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x39, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x29, 0xff000000, 0x1, 0xd0000000, 0x3, 0xc0000000, 0x3, 0x80000000,
+  0x1, 0x50000000, 0x2, 0x40000000, 0x1, 0x20000000, 0xc5, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xd0000000, 0x6, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x40000000, 0x219, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x3a, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x35, 0xff000000, 0x1, 0xe0000000, 0x2, 0xc0000000, 0x1, 0x90000000,
+  0x2, 0x80000000, 0x2, 0x40000000, 0x1, 0x20000000, 0xb8, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xc0000000, 0x9, 0xff000000, 0x1, 0xc0000000,
+  0x219, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x3c, 0xffffffff, 0x1, 0xff9f9f9f, 0x3f, 0xff000000, 0x2, 0xc0000000,
+  0x1, 0x90000000, 0x1, 0x80000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x1, 0x30000000, 0xad, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xa0000000,
+  0xc, 0xff000000, 0x1, 0x30000000, 0x217, 0x00ffffff, 0x1, 0x20000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x3d, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x47, 0xff000000, 0x2, 0xc0000000, 0x2, 0x80000000, 0x2, 0x40000000,
+  0xa3, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000, 0xe, 0xff000000,
+  0x1, 0xa0000000, 0x217, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x3f, 0xffffffff, 0x1, 0xff6f6f6f, 0x4e, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0xb0000000, 0x1, 0x80000000, 0x1, 0x60000000,
+  0x1, 0x40000000, 0x1, 0x20000000, 0x9a, 0x00ffffff, 0x1, 0x80000000,
+  0x1, 0xf0000000, 0x10, 0xff000000, 0x1, 0x10000000, 0x215, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf,
+  0x40, 0xffffffff, 0x1, 0xff6f6f6f, 0x54, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x1, 0x10000000, 0x91, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xe0000000,
+  0x12, 0xff000000, 0x1, 0x80000000, 0x215, 0x00ffffff, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x42, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x4, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x9, 0xff7f7f7f, 0x1, 0xff5f5f5f,
+  0x6, 0xff3f3f3f, 0x45, 0xff000000, 0x1, 0xc0000000, 0x1, 0xa0000000,
+  0x1, 0x80000000, 0x1, 0x40000000, 0x1, 0x20000000, 0x89, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xd0000000, 0x14, 0xff000000, 0x1, 0xe0000000,
+  0x215, 0x00ffffff, 0x1, 0xd0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0x5d, 0xffffffff, 0x1, 0xffcfcfcf, 0x3, 0xffbfbfbf, 0x1, 0xffafafaf,
+  0x3, 0xff7f7f7f, 0x1, 0xff6f6f6f, 0x3, 0xff3f3f3f, 0x1, 0xff1f1f1f,
+  0x39, 0xff000000, 0x1, 0xd0000000, 0x1, 0xb0000000, 0x1, 0x80000000,
+  0x1, 0x40000000, 0x1, 0x20000000, 0x81, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xc0000000, 0xe, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0x50000000, 0x212, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x6d, 0xffffffff,
+  0x1, 0xffefefef, 0x3, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff6f6f6f,
+  0x2, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x33, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0xa0000000, 0x1, 0x70000000, 0x1, 0x40000000, 0x1, 0x10000000,
+  0x79, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xa0000000, 0xe, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x1, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xb0000000, 0x211, 0x00ffffff, 0x1, 0x60000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x79, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf, 0x1, 0xffafafaf, 0x2, 0xff7f7f7f,
+  0x1, 0xff4f4f4f, 0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x2e, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x50000000,
+  0x1, 0x20000000, 0x72, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000,
+  0xe, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x3, 0xffffffff,
+  0x1, 0xffefefef, 0x8, 0xff000000, 0x1, 0x20000000, 0x20e, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xffcfcfcf,
+  0x83, 0xffffffff, 0x2, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x2a, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xc0000000, 0x1, 0x90000000, 0x1, 0x60000000, 0x1, 0x30000000,
+  0x6c, 0x00ffffff, 0x1, 0x80000000, 0x1, 0xf0000000, 0xd, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x5, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0x70000000, 0x20c, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xb0000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f,
+  0x8c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f,
+  0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x1, 0xff3f3f3f, 0x29, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x90000000, 0x1, 0x50000000, 0x1, 0x20000000,
+  0x65, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xe0000000, 0xe, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1, 0xffefefef, 0x7, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xe0000000, 0x20a, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x80000000, 0xd, 0xff000000, 0x1, 0xffafafaf, 0x93, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xffbfbfbf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f,
+  0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f, 0x26, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xc0000000, 0x1, 0x80000000, 0x1, 0x50000000, 0x1, 0x10000000,
+  0x5e, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000, 0xe, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0xa, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0x30000000, 0x208, 0x00ffffff, 0x1, 0x60000000,
+  0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff8f8f8f, 0x9b, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xffbfbfbf, 0x1, 0xff9f9f9f, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x24, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0xa0000000, 0x1, 0x70000000, 0x1, 0x30000000, 0x59, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffbfbfbf, 0xc, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x90000000, 0x206, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xc0000000,
+  0xd, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0xa3, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff2f2f2f, 0x23, 0xff000000, 0x1, 0xc0000000, 0x1, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x10000000, 0x52, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xa0000000, 0xd, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf,
+  0xe, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xe0000000,
+  0x204, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x90000000, 0xd, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0xaa, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff1f1f1f, 0x21, 0xff000000, 0x1, 0xd0000000, 0x1, 0x90000000,
+  0x1, 0x60000000, 0x1, 0x20000000, 0x4d, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xd0000000, 0xc, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f,
+  0x11, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0x30000000,
+  0x202, 0x00ffffff, 0x1, 0x50000000, 0x1, 0xf0000000, 0xd, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0xb2, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff8f8f8f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f, 0x20, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xa0000000, 0x1, 0x60000000, 0x1, 0x20000000,
+  0x48, 0x00ffffff, 0x1, 0x50000000, 0x1, 0xf0000000, 0xb, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x12, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0x90000000, 0x200, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xc0000000, 0xd, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffcfcfcf, 0xb9, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff9f9f9f,
+  0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x1e, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0xa0000000, 0x1, 0x60000000, 0x1, 0x20000000,
+  0x43, 0x00ffffff, 0x1, 0x90000000, 0xc, 0xff000000, 0x1, 0xff6f6f6f,
+  0x1, 0xffefefef, 0x14, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000,
+  0x1, 0xd0000000, 0x1ff, 0x00ffffff, 0x1, 0x80000000, 0x1, 0xf0000000,
+  0xc, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffafafaf, 0xc0, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f,
+  0x1, 0xff0f0f0f, 0x1d, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000,
+  0x1, 0x60000000, 0x1, 0x20000000, 0x3d, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xd0000000, 0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf,
+  0x17, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0x20000000,
+  0x1fc, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000, 0xc, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0xc6, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f,
+  0x1d, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x38, 0x00ffffff, 0x1, 0x40000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x19, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x7, 0xff000000, 0x1, 0x70000000, 0x1fa, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0x90000000, 0xd, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffdfdfdf, 0xcd, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f,
+  0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x1c, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x90000000, 0x1, 0x40000000, 0x34, 0x00ffffff, 0x1, 0x80000000,
+  0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x1a, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xb0000000, 0x1f9, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xe0000000, 0xc, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0xd3, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf,
+  0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1c, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x70000000, 0x1, 0x20000000, 0x2e, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xc0000000, 0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0x1c, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1f7, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0x90000000, 0xd, 0xff000000, 0x1, 0xff7f7f7f,
+  0xda, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f,
+  0x1, 0xff0f0f0f, 0x1a, 0xff000000, 0x1, 0xe0000000, 0x1, 0x90000000,
+  0x1, 0x50000000, 0x2a, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0xb, 0xff000000, 0x1, 0xff9f9f9f, 0x1e, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1f5, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xe0000000, 0xc, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf,
+  0xdf, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff5f5f5f,
+  0x1, 0xff1f1f1f, 0x1a, 0xff000000, 0x1, 0xb0000000, 0x1, 0x70000000,
+  0x1, 0x20000000, 0x25, 0x00ffffff, 0x1, 0x70000000, 0xb, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x1f, 0xffffffff, 0x1, 0xffafafaf,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1f3, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0x90000000, 0xc, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf,
+  0xe5, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f,
+  0x1, 0xff1f1f1f, 0x19, 0xff000000, 0x1, 0xe0000000, 0x1, 0x90000000,
+  0x1, 0x40000000, 0x20, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xb0000000,
+  0xb, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0x20, 0xffffffff,
+  0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xc0000000, 0x1f2, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xd0000000, 0xc, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0xea, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f,
+  0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x18, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xa0000000, 0x1, 0x60000000, 0x1, 0x10000000, 0x1b, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff8f8f8f,
+  0x23, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1f1, 0x00ffffff,
+  0x1, 0x80000000, 0xc, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf,
+  0xf0, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f,
+  0x1, 0xff0f0f0f, 0x18, 0xff000000, 0x1, 0xc0000000, 0x1, 0x70000000,
+  0x1, 0x20000000, 0x17, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x24, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1, 0x30000000, 0x1ee, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xd0000000, 0xc, 0xff000000, 0x1, 0xff6f6f6f,
+  0x1, 0xffefefef, 0xf5, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x18, 0xff000000, 0x1, 0xd0000000, 0x1, 0x80000000,
+  0x1, 0x30000000, 0x12, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xa0000000,
+  0xb, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef, 0x25, 0xffffffff,
+  0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0x70000000, 0x1ed, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0xfa, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf,
+  0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0x17, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x90000000, 0x1, 0x30000000, 0xe, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xd0000000, 0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x27, 0xffffffff,
+  0x1, 0xffefefef, 0x7, 0xff000000, 0x1, 0xa0000000, 0x1eb, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xb0000000, 0xc, 0xff000000, 0x1, 0xff6f6f6f,
+  0x1, 0xffefefef, 0xff, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f,
+  0x1, 0xff4f4f4f, 0x17, 0xff000000, 0x1, 0xe0000000, 0x1, 0xa0000000,
+  0x1, 0x50000000, 0xa, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf, 0x29, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x6, 0xff000000, 0x1, 0xd0000000, 0x1ea, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0x105, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff6f6f6f,
+  0x1, 0xff1f1f1f, 0x16, 0xff000000, 0x1, 0xf0000000, 0x1, 0xa0000000,
+  0x1, 0x50000000, 0x6, 0x00ffffff, 0x1, 0x90000000, 0xb, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x2a, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x7, 0xff000000, 0x1e9, 0x00ffffff, 0x1, 0x80000000, 0xc, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1, 0xffefefef, 0x109, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f, 0x16, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xa0000000, 0x1, 0x50000000, 0x1, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xd0000000, 0xb, 0xff000000, 0x1, 0xff6f6f6f, 0x2c, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0x30000000, 0x1e6, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xc0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffbfbfbf, 0x10e, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0x15, 0xff000000, 0x2, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x2d, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x50000000, 0x1e5, 0x00ffffff,
+  0x1, 0x40000000, 0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffefefef, 0x113, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff6f6f6f,
+  0x1, 0xff1f1f1f, 0x1d, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf,
+  0x2e, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1e4, 0x00ffffff, 0x1, 0x70000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x118, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f,
+  0x1, 0xff2f2f2f, 0x19, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef,
+  0x30, 0xffffffff, 0x7, 0xff000000, 0x1, 0xb0000000, 0x1e2, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xb0000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffdfdfdf, 0x11c, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f,
+  0x1, 0xff3f3f3f, 0x15, 0xff000000, 0x1, 0xff9f9f9f, 0x32, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1e1, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff6f6f6f,
+  0x121, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f,
+  0x10, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x33, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x6, 0xff000000, 0x1, 0xf0000000, 0x1e0, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x125, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f,
+  0x1, 0xff4f4f4f, 0xc, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef,
+  0x34, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1df, 0x00ffffff,
+  0x1, 0x90000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x129, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x36, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0x30000000, 0x1dc, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xc0000000, 0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x12e, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x3, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x37, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0x40000000, 0x1db, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xe0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf,
+  0x132, 0xffffffff, 0x1, 0xffefefef, 0x2, 0xffbfbfbf, 0x39, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x50000000, 0x1da, 0x00ffffff,
+  0x1, 0x60000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffdfdfdf, 0x16f, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1d9, 0x00ffffff, 0x1, 0x80000000, 0xb, 0xff000000,
+  0x1, 0xff5f5f5f, 0x172, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1d7, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xa0000000, 0xa, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x173, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1d6, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0xa, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf, 0x174, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x90000000, 0x1d5, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x175, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x1d4, 0x00ffffff, 0x1, 0x50000000, 0x1, 0xf0000000, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x177, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1d3, 0x00ffffff, 0x1, 0x60000000, 0xb, 0xff000000,
+  0x1, 0xff9f9f9f, 0x178, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1d2, 0x00ffffff, 0x1, 0x90000000, 0xa, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x179, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1d1, 0x00ffffff, 0x1, 0xa0000000,
+  0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x17a, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1cf, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xc0000000, 0xa, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x17b, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1ce, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x17d, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1cd, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff8f8f8f, 0x17e, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1cc, 0x00ffffff,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x17f, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1cb, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x180, 0xffffffff,
+  0x7, 0xff000000, 0x1, 0x90000000, 0x1ca, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf,
+  0x181, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1c9, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x182, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1c8, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x183, 0xffffffff, 0x7, 0xff000000, 0x1, 0x80000000, 0x1c7, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x184, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x7, 0xff000000, 0x1, 0x70000000, 0x1c6, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x185, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1c5, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x186, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1c4, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff8f8f8f, 0x187, 0xffffffff,
+  0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1c3, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff9f9f9f, 0x188, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0x20000000, 0x1c2, 0x00ffffff,
+  0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff9f9f9f, 0x189, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1c2, 0x00ffffff, 0x1, 0x60000000,
+  0xa, 0xff000000, 0x1, 0xff9f9f9f, 0x18a, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1c1, 0x00ffffff, 0x1, 0x60000000, 0xa, 0xff000000,
+  0x1, 0xff9f9f9f, 0x18b, 0xffffffff, 0x1, 0xff4f4f4f, 0x6, 0xff000000,
+  0x1, 0xf0000000, 0x1c0, 0x00ffffff, 0x1, 0x60000000, 0xa, 0xff000000,
+  0x1, 0xff9f9f9f, 0x18c, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1bf, 0x00ffffff, 0x1, 0x60000000, 0xa, 0xff000000,
+  0x1, 0xff9f9f9f, 0x18d, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1be, 0x00ffffff, 0x1, 0x60000000, 0xa, 0xff000000,
+  0x1, 0xff9f9f9f, 0x18e, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1bd, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x18f, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0xa0000000, 0x1bc, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x190, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1bb, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x191, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1ba, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x192, 0xffffffff, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1b9, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x192, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x7, 0xff000000, 0x1, 0x70000000, 0x1b8, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff6f6f6f, 0x193, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1b8, 0x00ffffff,
+  0x1, 0xb0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x194, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1b7, 0x00ffffff,
+  0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x195, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1b6, 0x00ffffff,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff4f4f4f, 0x196, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0x40000000, 0x1b5, 0x00ffffff,
+  0x1, 0x60000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x196, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1b4, 0x00ffffff, 0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x197, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1b4, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x198, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1b3, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x199, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1b3, 0x00ffffff, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xffbfbfbf, 0x19a, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1b2, 0x00ffffff, 0x1, 0xa0000000, 0x9, 0xff000000,
+  0x1, 0xff9f9f9f, 0x19b, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1b1, 0x00ffffff, 0x1, 0x70000000, 0x9, 0xff000000, 0x1, 0xff7f7f7f,
+  0x19c, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1b0, 0x00ffffff,
+  0x1, 0x50000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x19d, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1af, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x19e, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x6, 0xff000000, 0x1, 0xe0000000, 0x1ae, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffefefef, 0x19e, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1ae, 0x00ffffff, 0x1, 0xb0000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x19f, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1ad, 0x00ffffff, 0x1, 0x80000000,
+  0x9, 0xff000000, 0x1, 0xffafafaf, 0x1a0, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1ac, 0x00ffffff, 0x1, 0x50000000,
+  0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x1a1, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1ab, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x1a2, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1aa, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x1a2, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x1aa, 0x00ffffff, 0x1, 0xa0000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x1a3, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1a9, 0x00ffffff, 0x1, 0x60000000,
+  0x9, 0xff000000, 0x1, 0xffbfbfbf, 0x1a4, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1a8, 0x00ffffff, 0x1, 0x30000000,
+  0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x1a5, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1a7, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xe0000000, 0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x1a6, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x1a7, 0x00ffffff,
+  0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x1a6, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x17f, 0x00ffffff, 0x2, 0x40000000, 0x1, 0x50000000, 0x5, 0x80000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x1, 0x30000000, 0x1c, 0x00ffffff,
+  0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x1a7, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x179, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x50000000, 0x1, 0x80000000,
+  0x1, 0xc0000000, 0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0xa0000000, 0x1, 0x70000000, 0x1, 0x30000000, 0x16, 0x00ffffff,
+  0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xff9f9f9f, 0x1a8, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000, 0x176, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0x70000000, 0x1, 0xd0000000, 0x16, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x11, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1a9, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x173, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x60000000,
+  0x1, 0xd0000000, 0x1c, 0xff000000, 0x1, 0xf0000000, 0x1, 0xa0000000,
+  0x1, 0x40000000, 0xf, 0x00ffffff, 0x1, 0xa0000000, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1aa, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x171, 0x00ffffff, 0x1, 0x20000000, 0x1, 0x80000000,
+  0x1, 0xf0000000, 0x21, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000,
+  0xc, 0x00ffffff, 0x1, 0x50000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffdfdfdf, 0x1aa, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x16f, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x80000000,
+  0x26, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000, 0x9, 0x00ffffff,
+  0x1, 0x20000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x1ab, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xc0000000,
+  0x16e, 0x00ffffff, 0x1, 0x70000000, 0x1, 0xf0000000, 0x29, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x40000000, 0x7, 0x00ffffff, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x1ac, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x16c, 0x00ffffff, 0x1, 0x20000000,
+  0x1, 0xc0000000, 0x2d, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000,
+  0x4, 0x00ffffff, 0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x1ac, 0xffffffff, 0x1, 0xff3f3f3f, 0x6, 0xff000000,
+  0x1, 0xc0000000, 0x16b, 0x00ffffff, 0x1, 0x60000000, 0x1, 0xf0000000,
+  0x10, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xff6f6f6f, 0x1, 0xff8f8f8f,
+  0x2, 0xffbfbfbf, 0x1, 0xffefefef, 0x3, 0xffffffff, 0x1, 0xffefefef,
+  0x2, 0xffbfbfbf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x1, 0xff1f1f1f,
+  0x10, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000, 0x2, 0x00ffffff,
+  0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xffcfcfcf, 0x1ad, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x6, 0xff000000, 0x1, 0xe0000000, 0x169, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xa0000000, 0xe, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xff7f7f7f, 0x1, 0xffcfcfcf, 0x10, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0xe, 0xff000000,
+  0x1, 0x90000000, 0x1, 0x00ffffff, 0x1, 0xd0000000, 0x8, 0xff000000,
+  0x1, 0xff8f8f8f, 0x1ae, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x168, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0xc, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff6f6f6f, 0x1, 0xffdfdfdf, 0x17, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff4f4f4f, 0xd, 0xff000000, 0x1, 0xe0000000,
+  0x8, 0xff000000, 0x1, 0xff3f3f3f, 0x1af, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x167, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x1c, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0x13, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x1af, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x166, 0x00ffffff, 0x1, 0x30000000, 0x1, 0xf0000000, 0xa, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x20, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff5f5f5f, 0x11, 0xff000000, 0x1, 0xffafafaf, 0x1b0, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x165, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xe0000000, 0xa, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef,
+  0x23, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f, 0xe, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1b1, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x164, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x27, 0xffffffff, 0x1, 0xff8f8f8f,
+  0xc, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x1b1, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x164, 0x00ffffff, 0x1, 0xc0000000,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x29, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xa, 0xff000000, 0x1, 0xffbfbfbf,
+  0x1b2, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x163, 0x00ffffff,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x2b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1b2, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000,
+  0x1, 0x70000000, 0x161, 0x00ffffff, 0x1, 0x40000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x2d, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x1b1, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xa0000000, 0x15f, 0x00ffffff,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff4f4f4f,
+  0x30, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1b0, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x10000000, 0x15d, 0x00ffffff, 0x1, 0xa0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x31, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1af, 0xffffffff, 0x1, 0xffdfdfdf, 0xa, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0x15b, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x33, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x1af, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x15a, 0x00ffffff, 0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x35, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1af, 0xffffffff, 0x1, 0xff7f7f7f, 0xa, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x158, 0x00ffffff, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x37, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x1af, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x157, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0x39, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1af, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f,
+  0xa, 0xff000000, 0x1, 0x90000000, 0x155, 0x00ffffff, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xffcfcfcf, 0x3a, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x1ae, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x154, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x3c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x51, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff535353, 0x3, 0xff2f2f2f,
+  0x1, 0xff454545, 0x1, 0xff7f7f7f, 0x1, 0xffbfbfbf, 0x1, 0xffefefef,
+  0x153, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x152, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x3d, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x4f, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff090909, 0x9, 0xff000000,
+  0x1, 0xff454545, 0x1, 0xffbfbfbf, 0x153, 0xffffffff, 0x1, 0xff6f6f6f,
+  0xa, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x150, 0x00ffffff,
+  0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x3f, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x4d, 0xffffffff, 0x1, 0xff595959, 0xd, 0xff000000,
+  0x1, 0xff373737, 0x1, 0xffdfdfdf, 0x152, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x14e, 0x00ffffff,
+  0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf, 0xe, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x1, 0xffccc8fa, 0x3, 0xffbab6f9, 0x1, 0xffd7d4fb,
+  0x1, 0xfff9f9fe, 0x2b, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0xa, 0xff000000, 0x1, 0xff8f8f8f, 0x4b, 0xffffffff, 0x1, 0xff595959,
+  0x1, 0xff030303, 0xe, 0xff000000, 0x1, 0xff080808, 0x1, 0xffcfcfcf,
+  0x152, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x14d, 0x00ffffff, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0xe, 0xffffffff, 0x1, 0xffdddafc,
+  0x1, 0xffa9a4f7, 0x5, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffdddafc,
+  0x2b, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x48, 0xffffffff, 0x1, 0xffafafaf,
+  0x11, 0xff000000, 0x1, 0xff060606, 0x1, 0xffcfcfcf, 0x152, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x14c, 0x00ffffff, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xffcfcfcf, 0xd, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffa9a4f7,
+  0x8, 0xffa49ef7, 0x1, 0xffe2e1fc, 0x13, 0xffffffff, 0x1, 0xfff9f9fe,
+  0x1, 0xffe2e1fc, 0x2, 0xffd1cefb, 0x1, 0xffe2e1fc, 0x1, 0xfff9f9fe,
+  0x12, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x47, 0xffffffff, 0x1, 0xff151515,
+  0x12, 0xff000000, 0x1, 0xff090909, 0x1, 0xffefefef, 0x152, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x14a, 0x00ffffff, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0xe, 0xffffffff, 0x1, 0xffc6c2fa, 0x9, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x11, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffc6c2fa,
+  0x6, 0xffa49ef7, 0x1, 0xffc6c2fa, 0x1, 0xfff9f9fe, 0x11, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x45, 0xffffffff, 0x1, 0xff9f9f9f, 0x13, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff595959, 0x153, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000,
+  0x149, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f,
+  0xe, 0xffffffff, 0x1, 0xffafaaf8, 0xa, 0xffa49ef7, 0x1, 0xffdddafc,
+  0xf, 0xffffffff, 0x1, 0xffd7d4fb, 0x9, 0xffa49ef7, 0x1, 0xffa9a4f7,
+  0x1, 0xffeeedfd, 0x12, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000,
+  0x1, 0xff3f3f3f, 0x45, 0xffffffff, 0x1, 0xff404040, 0x15, 0xff000000,
+  0x1, 0xffefefef, 0x153, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x147, 0x00ffffff,
+  0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0xe, 0xffffffff, 0xb, 0xffa49ef7, 0x1, 0xffccc8fa, 0xe, 0xffffffff,
+  0x1, 0xffc6c2fa, 0xb, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x13, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x44, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x15, 0xff000000, 0x1, 0xff020202, 0x1, 0xff9f9f9f, 0x154, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x146, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0xf, 0xffffffff, 0xb, 0xffa49ef7, 0x1, 0xffbab6f9,
+  0xd, 0xffffffff, 0x1, 0xffd7d4fb, 0xd, 0xffa49ef7, 0x1, 0xffeeedfd,
+  0x13, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x44, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff020202, 0x15, 0xff000000,
+  0x1, 0xff535353, 0x155, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x145, 0x00ffffff,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xffafafaf, 0xf, 0xffffffff,
+  0x1, 0xffb5b0f8, 0xa, 0xffa49ef7, 0x1, 0xffccc8fa, 0xc, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x1, 0xffa9a4f7, 0xd, 0xffa49ef7, 0x1, 0xffe8e7fd,
+  0x14, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0x6, 0xff000000,
+  0x1, 0xff1f1f1f, 0x44, 0xffffffff, 0x1, 0xff454545, 0x16, 0xff000000,
+  0x1, 0xff2f2f2f, 0x156, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x144, 0x00ffffff,
+  0x1, 0xe0000000, 0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x10, 0xffffffff,
+  0x1, 0xffccc8fa, 0xa, 0xffa49ef7, 0x1, 0xffdddafc, 0xc, 0xffffffff,
+  0x1, 0xffccc8fa, 0xe, 0xffa49ef7, 0x1, 0xfff4f3fe, 0x15, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0x5, 0xff000000, 0x1, 0xffafafaf,
+  0x44, 0xffffffff, 0x1, 0xff151515, 0x16, 0xff000000, 0x1, 0xff2f2f2f,
+  0x3d, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff3f3f3f, 0x1, 0xff4f4f4f,
+  0x1, 0xffbfbfbf, 0x116, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x142, 0x00ffffff,
+  0x1, 0x20000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x10, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x9, 0xffa49ef7, 0x1, 0xffafaaf8, 0xd, 0xffffffff,
+  0x1, 0xffb5b0f8, 0xd, 0xffa49ef7, 0x1, 0xffbab6f9, 0x18, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x2, 0xff3f3f3f, 0x1, 0xff4f4f4f, 0x1, 0xffbfbfbf,
+  0x45, 0xffffffff, 0x17, 0xff000000, 0x1, 0xff2f2f2f, 0x1d, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xffcfcfcf, 0x1d, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x4, 0xff000000, 0x1, 0xffafafaf, 0x116, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xc0000000, 0x142, 0x00ffffff,
+  0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x11, 0xffffffff,
+  0x1, 0xffd7d4fb, 0x7, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffeeedfd,
+  0xd, 0xffffffff, 0x1, 0xffa9a4f7, 0xd, 0xffa49ef7, 0x1, 0xffe8e7fd,
+  0x61, 0xffffffff, 0x1, 0xffefefef, 0x17, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1b, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f, 0x2, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffefefef, 0x1a, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x5, 0xff000000, 0x1, 0xff1f1f1f, 0x117, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xa0000000, 0x141, 0x00ffffff,
+  0x1, 0x90000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x12, 0xffffffff,
+  0x1, 0xffdddafc, 0x1, 0xffa9a4f7, 0x4, 0xffa49ef7, 0x1, 0xffbab6f9,
+  0x1, 0xffeeedfd, 0xe, 0xffffffff, 0x1, 0xffc0bcf9, 0xc, 0xffa49ef7,
+  0x1, 0xffdddafc, 0x62, 0xffffffff, 0x1, 0xffbfbfbf, 0x17, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1a, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f,
+  0x4, 0xff000000, 0x1, 0xff5f5f5f, 0x19, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x117, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xa0000000, 0x140, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x15, 0xffffffff,
+  0x3, 0xffe8e7fd, 0x1, 0xfff4f3fe, 0x10, 0xffffffff, 0x1, 0xffeeedfd,
+  0x1, 0xffa9a4f7, 0x9, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xffdddafc,
+  0x63, 0xffffffff, 0x1, 0xffbfbfbf, 0x17, 0xff000000, 0x1, 0xff7f7f7f,
+  0x1a, 0xffffffff, 0x1, 0xffbfbfbf, 0x6, 0xff000000, 0x1, 0xffefefef,
+  0x17, 0xffffffff, 0x1, 0xff5f5f5f, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x62, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f, 0x1, 0xff333333,
+  0x2, 0xff2f2f2f, 0x1, 0xff535353, 0x1, 0xffafafaf, 0xaf, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0x80000000,
+  0x13f, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x2a, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x1, 0xffc6c2fa, 0x7, 0xffa49ef7, 0x1, 0xffc6c2fa,
+  0x1, 0xfff4f3fe, 0x65, 0xffffffff, 0x16, 0xff000000, 0x1, 0xff020202,
+  0x1, 0xff7f7f7f, 0x1a, 0xffffffff, 0x1, 0xffbfbfbf, 0x6, 0xff000000,
+  0x1, 0xff9f9f9f, 0x15, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0xa, 0xff000000, 0x1, 0xffafafaf, 0x5f, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff535353, 0x1, 0xff000000, 0x1, 0xff020202, 0x5, 0xff000000,
+  0x1, 0xff171717, 0x1, 0xffbfbfbf, 0xae, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0x60000000, 0x13d, 0x00ffffff,
+  0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x2c, 0xffffffff,
+  0x1, 0xfff9f9fe, 0x1, 0xffe2e1fc, 0x3, 0xffd1cefb, 0x1, 0xffdddafc,
+  0x1, 0xfff4f3fe, 0x67, 0xffffffff, 0x1, 0xff080808, 0x16, 0xff000000,
+  0x1, 0xffbfbfbf, 0x1b, 0xffffffff, 0x1, 0xff0f0f0f, 0x5, 0xff000000,
+  0x1, 0xff1f1f1f, 0x14, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x5c, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff686868, 0xb, 0xff000000, 0x1, 0xff9f9f9f,
+  0xae, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000,
+  0x1, 0x50000000, 0x13c, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0x9a, 0xffffffff, 0x1, 0xff454545, 0x16, 0xff000000,
+  0x1c, 0xffffffff, 0x1, 0xff5f5f5f, 0x6, 0xff000000, 0x1, 0xff7f7f7f,
+  0x12, 0xffffffff, 0x1, 0xff7f7f7f, 0xe, 0xff000000, 0x1, 0xff4f4f4f,
+  0x5b, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff151515, 0x1, 0xff010101,
+  0xc, 0xff000000, 0x1, 0xff9f9f9f, 0xae, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x13b, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x9a, 0xffffffff, 0x1, 0xff9f9f9f, 0x15, 0xff000000, 0x1, 0xff454545,
+  0x1c, 0xffffffff, 0x1, 0xffdfdfdf, 0x7, 0xff000000, 0x1, 0xffafafaf,
+  0xf, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f, 0x10, 0xff000000,
+  0x1, 0xff5f5f5f, 0x59, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff070707,
+  0xe, 0xff000000, 0x1, 0xff070707, 0x1, 0xffcfcfcf, 0xae, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x10000000, 0x13a, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x9b, 0xffffffff, 0x1, 0xff151515, 0x14, 0xff000000,
+  0x1, 0xffbfbfbf, 0x1d, 0xffffffff, 0x1, 0xff5f5f5f, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0xc, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff3f3f3f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffafafaf,
+  0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x16, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x2, 0xff3f3f3f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef,
+  0x3c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff070707, 0x10, 0xff000000,
+  0x1, 0xff232323, 0xaf, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x10000000, 0x139, 0x00ffffff, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x9c, 0xffffffff, 0x1, 0xffbfbfbf, 0x12, 0xff000000,
+  0x1, 0xff010101, 0x1, 0xff595959, 0x1e, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffcfcfcf,
+  0x7, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x1, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0x12, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f,
+  0x4, 0xff000000, 0x1, 0xff3f3f3f, 0x3b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff151515, 0x11, 0xff000000, 0x1, 0xff020202, 0x1, 0xff7f7f7f,
+  0xaf, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0xb0000000,
+  0x139, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000, 0x9d, 0xffffffff,
+  0x1, 0xff777777, 0x10, 0xff000000, 0x1, 0xff010101, 0x1, 0xff262626,
+  0x1, 0xffefefef, 0x1f, 0xffffffff, 0x1, 0xff8f8f8f, 0x9, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff3f3f3f, 0x2, 0xff7f7f7f, 0x1, 0xff6f6f6f,
+  0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0x3, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x10, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff1f1f1f, 0x6, 0xff000000, 0x1, 0xffcfcfcf, 0x3a, 0xffffffff,
+  0x1, 0xff777777, 0x1, 0xff020202, 0x12, 0xff000000, 0x1, 0xff070707,
+  0x1, 0xffefefef, 0xaf, 0xffffffff, 0x1, 0xff8f8f8f, 0x9, 0xff000000,
+  0x1, 0x90000000, 0x138, 0x00ffffff, 0x1, 0xc0000000, 0x6, 0xff000000,
+  0x1, 0xff1f1f1f, 0x9e, 0xffffffff, 0x1, 0xff868686, 0xf, 0xff000000,
+  0x1, 0xff333333, 0x1, 0xffefefef, 0x21, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x1a, 0xff000000, 0x1, 0xff8f8f8f, 0x6, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x9, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf, 0xc, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x39, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff070707, 0x13, 0xff000000,
+  0x1, 0xff020202, 0x1, 0xff9f9f9f, 0xb0, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0x60000000, 0x137, 0x00ffffff, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x9f, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xff090909, 0x1, 0xff8f8f8f,
+  0x24, 0xffffffff, 0x1, 0xff5f5f5f, 0x17, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffdfdfdf, 0x8, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff6f6f6f, 0x1, 0xffbfbfbf, 0x1, 0xffefefef,
+  0x4, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xffafafaf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xffefefef, 0x39, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x1, 0xff020202, 0x14, 0xff000000, 0x1, 0xff333333,
+  0xb1, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x30000000, 0x136, 0x00ffffff, 0x1, 0xc0000000, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0xa1, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff595959,
+  0x1, 0xff131313, 0x5, 0xff000000, 0x1, 0xff080808, 0x1, 0xff454545,
+  0x1, 0xff9f9f9f, 0x27, 0xffffffff, 0x1, 0xff5f5f5f, 0x14, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffafafaf, 0xb, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1e, 0xff000000, 0x1, 0xff9f9f9f, 0x3a, 0xffffffff, 0x1, 0xff232323,
+  0x16, 0xff000000, 0xb1, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000, 0x135, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x11, 0xffffffff,
+  0x1, 0xffeeedfd, 0x2, 0xffe8e7fd, 0x1, 0xfff4f3fe, 0xc, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x1, 0xffc6c2fa, 0x1, 0xffafaaf8, 0x4, 0xffa49ef7,
+  0x1, 0xffb5b0f8, 0x1, 0xffccc8fa, 0x1, 0xffe2e1fc, 0x7a, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x2, 0xffbfbfbf, 0x2c, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff1f1f1f, 0x10, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffafafaf,
+  0xe, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f, 0x1a, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x3b, 0xffffffff, 0x17, 0xff000000,
+  0x1, 0xffbfbfbf, 0xb1, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0xc0000000, 0x135, 0x00ffffff, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0xf, 0xffffffff, 0x1, 0xffd7d4fb,
+  0x1, 0xffafaaf8, 0x4, 0xffa49ef7, 0x1, 0xffccc8fa, 0x1, 0xfff9f9fe,
+  0x9, 0xffffffff, 0x1, 0xffdddafc, 0xa, 0xffa49ef7, 0x1, 0xffa9a4f7,
+  0x1, 0xffd1cefb, 0x1, 0xfff9f9fe, 0xa8, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xff8f8f8f,
+  0x1, 0xffdfdfdf, 0x11, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0x18, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0x3b, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x17, 0xff000000, 0x1, 0xffbfbfbf, 0xb2, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x9, 0xff000000, 0x1, 0x90000000, 0x134, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0xd, 0xffffffff,
+  0x1, 0xfff9f9fe, 0x1, 0xffb5b0f8, 0x7, 0xffa49ef7, 0x1, 0xffc0bcf9,
+  0x8, 0xffffffff, 0x1, 0xffe2e1fc, 0xd, 0xffa49ef7, 0x1, 0xffa9a4f7,
+  0x1, 0xffe2e1fc, 0xa9, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f,
+  0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x3, 0xff3f3f3f, 0x2, 0xff7f7f7f,
+  0x1, 0xffbfbfbf, 0x1, 0xffefefef, 0x16, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff1f1f1f, 0x14, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf,
+  0x3d, 0xffffffff, 0x1, 0xffbfbfbf, 0x17, 0xff000000, 0x1, 0xffbfbfbf,
+  0xb3, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0x50000000,
+  0x133, 0x00ffffff, 0x1, 0xa0000000, 0x7, 0xff000000, 0xc, 0xffffffff,
+  0x1, 0xfff9f9fe, 0x1, 0xffb5b0f8, 0x9, 0xffa49ef7, 0x1, 0xffdddafc,
+  0x7, 0xffffffff, 0x1, 0xffafaaf8, 0xf, 0xffa49ef7, 0x1, 0xffc6c2fa,
+  0xcb, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff2f2f2f, 0x10, 0xff000000,
+  0x1, 0xff4f4f4f, 0x1, 0xffbfbfbf, 0x3f, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x17, 0xff000000, 0x1, 0xffbfbfbf, 0xb4, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x8, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000, 0x132, 0x00ffffff,
+  0x1, 0x80000000, 0x7, 0xff000000, 0xc, 0xffffffff, 0x1, 0xffd1cefb,
+  0xa, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x6, 0xffffffff, 0x1, 0xffe2e1fc,
+  0x11, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xfff9f9fe, 0xcb, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f, 0x1, 0xff3f3f3f, 0x9, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff4f4f4f, 0x1, 0xff9f9f9f, 0x1, 0xffefefef,
+  0x41, 0xffffffff, 0x1, 0xffbfbfbf, 0x17, 0xff000000, 0x1, 0xffbfbfbf,
+  0xb5, 0xffffffff, 0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x131, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0xb, 0xffffffff, 0x1, 0xfff9f9fe, 0xc, 0xffa49ef7, 0x6, 0xffffffff,
+  0x1, 0xffccc8fa, 0x12, 0xffa49ef7, 0x1, 0xffc6c2fa, 0xcf, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x6, 0xffbfbfbf, 0x1, 0xffefefef, 0x46, 0xffffffff,
+  0x17, 0xff000000, 0x1, 0xffdfdfdf, 0xb5, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xa0000000, 0x131, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf, 0xa, 0xffffffff,
+  0x1, 0xffe2e1fc, 0xc, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x5, 0xffffffff,
+  0x1, 0xffbab6f9, 0x13, 0xffa49ef7, 0x1, 0xffd7d4fb, 0x11c, 0xffffffff,
+  0x1, 0xff404040, 0x15, 0xff000000, 0x1, 0xff090909, 0xb7, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x9, 0xff000000, 0x1, 0x60000000, 0x130, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0xa, 0xffffffff,
+  0x1, 0xffd1cefb, 0xc, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x5, 0xffffffff,
+  0x1, 0xffbab6f9, 0x13, 0xffa49ef7, 0x1, 0xffa9a4f7, 0x1, 0xfff4f3fe,
+  0x11b, 0xffffffff, 0x1, 0xff9f9f9f, 0x15, 0xff000000, 0x1, 0xff535353,
+  0xb8, 0xffffffff, 0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x20000000, 0x12f, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff9f9f9f, 0xa, 0xffffffff, 0x1, 0xffd1cefb, 0xc, 0xffa49ef7,
+  0x1, 0xfff9f9fe, 0x5, 0xffffffff, 0x1, 0xffbab6f9, 0x14, 0xffa49ef7,
+  0x1, 0xffc6c2fa, 0x11c, 0xffffffff, 0x1, 0xff171717, 0x14, 0xff000000,
+  0x1, 0xffbfbfbf, 0xb9, 0xffffffff, 0x1, 0xff5f5f5f, 0x8, 0xff000000,
+  0x1, 0xd0000000, 0x130, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0xa, 0xffffffff, 0x1, 0xffe2e1fc, 0xb, 0xffa49ef7, 0x1, 0xffafaaf8,
+  0x6, 0xffffffff, 0x1, 0xffbab6f9, 0x15, 0xffa49ef7, 0x1, 0xfff4f3fe,
+  0x11b, 0xffffffff, 0x1, 0xffbfbfbf, 0x13, 0xff000000, 0x1, 0xff333333,
+  0xba, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x8, 0xff000000,
+  0x1, 0x90000000, 0x12f, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0xa, 0xffffffff, 0x1, 0xfff9f9fe, 0xb, 0xffa49ef7, 0x1, 0xffd7d4fb,
+  0x6, 0xffffffff, 0x1, 0xffbab6f9, 0x15, 0xffa49ef7, 0x1, 0xffd7d4fb,
+  0x11c, 0xffffffff, 0x1, 0xff9f9f9f, 0x11, 0xff000000, 0x1, 0xff070707,
+  0x1, 0xffcfcfcf, 0xbb, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x12e, 0x00ffffff, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff2f2f2f, 0xb, 0xffffffff, 0x1, 0xffccc8fa,
+  0x9, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x7, 0xffffffff, 0x1, 0xffbab6f9,
+  0x15, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x11d, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x10, 0xff000000, 0x1, 0xff9f9f9f, 0xbd, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000, 0x12d, 0x00ffffff,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0xc, 0xffffffff, 0x1, 0xffbab6f9,
+  0x7, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1, 0xfff9f9fe, 0x7, 0xffffffff,
+  0x1, 0xffd1cefb, 0x16, 0xffa49ef7, 0x11e, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff232323, 0xb, 0xff000000, 0x1, 0xff010101, 0x1, 0xff0a0a0a,
+  0x1, 0xffbfbfbf, 0xbf, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000,
+  0x1, 0xb0000000, 0x12d, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0xc, 0xffffffff, 0x1, 0xffd7d4fb, 0x1, 0xffafaaf8,
+  0x3, 0xffa49ef7, 0x1, 0xffc0bcf9, 0x1, 0xffdddafc, 0x9, 0xffffffff,
+  0x1, 0xffe2e1fc, 0x16, 0xffa49ef7, 0x1, 0xffeeedfd, 0x11f, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff333333, 0x8, 0xff000000, 0x1, 0xff090909,
+  0x1, 0xff777777, 0x1, 0xffefefef, 0xc0, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0x50000000, 0x12c, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x1c, 0xffffffff,
+  0x1, 0xfff4f3fe, 0x16, 0xffa49ef7, 0x1, 0xffe8e7fd, 0x121, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xffafafaf, 0x5, 0xff7f7f7f, 0x1, 0xffbfbfbf,
+  0xc4, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x10000000, 0x12b, 0x00ffffff, 0x1, 0x10000000, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1d, 0xffffffff, 0x1, 0xffb5b0f8, 0x15, 0xffa49ef7,
+  0x1, 0xffe8e7fd, 0x1ee, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0xb0000000, 0x12c, 0x00ffffff, 0x1, 0xe0000000, 0x6, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1d, 0xffffffff, 0x1, 0xffd7d4fb, 0x15, 0xffa49ef7,
+  0x1, 0xffe8e7fd, 0x1ef, 0xffffffff, 0x1, 0xff2f2f2f, 0x8, 0xff000000,
+  0x1, 0x50000000, 0x12b, 0x00ffffff, 0x1, 0xb0000000, 0x7, 0xff000000,
+  0x1d, 0xffffffff, 0x1, 0xfff4f3fe, 0x15, 0xffa49ef7, 0x1f0, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x10000000, 0x12a, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x1d, 0xffffffff, 0x1, 0xffc0bcf9, 0x13, 0xffa49ef7,
+  0x1, 0xffb5b0f8, 0x1f1, 0xffffffff, 0x1, 0xff8f8f8f, 0x8, 0xff000000,
+  0x1, 0xb0000000, 0x12a, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x1d, 0xffffffff, 0x1, 0xffe8e7fd, 0x13, 0xffa49ef7,
+  0x1, 0xffd7d4fb, 0x1f2, 0xffffffff, 0x1, 0xff3f3f3f, 0x8, 0xff000000,
+  0x1, 0x50000000, 0x12a, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1e, 0xffffffff, 0x1, 0xffbab6f9, 0x11, 0xffa49ef7, 0x1, 0xffa9a4f7,
+  0x1, 0xfff9f9fe, 0x1f2, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f,
+  0x7, 0xff000000, 0x1, 0xe0000000, 0x1, 0x10000000, 0x129, 0x00ffffff,
+  0x1, 0xd0000000, 0x7, 0xff000000, 0x1e, 0xffffffff, 0x1, 0xfff4f3fe,
+  0x1, 0xffa9a4f7, 0x10, 0xffa49ef7, 0x1, 0xffd1cefb, 0x1f4, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x8, 0xff000000, 0x1, 0x90000000, 0x129, 0x00ffffff,
+  0x1, 0x90000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf, 0x1e, 0xffffffff,
+  0x1, 0xffd7d4fb, 0xf, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1f6, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x8, 0xff000000, 0x1, 0x30000000, 0x128, 0x00ffffff,
+  0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xff8f8f8f, 0x1f, 0xffffffff,
+  0x1, 0xffc6c2fa, 0xd, 0xffa49ef7, 0x1, 0xffb5b0f8, 0x1, 0xfff9f9fe,
+  0x1f6, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000, 0x1, 0xc0000000,
+  0x128, 0x00ffffff, 0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0x20, 0xffffffff, 0x1, 0xffc6c2fa, 0xb, 0xffa49ef7, 0x1, 0xffc0bcf9,
+  0x1, 0xfff9f9fe, 0x1f8, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0x70000000, 0x128, 0x00ffffff, 0x1, 0xd0000000, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x21, 0xffffffff, 0x1, 0xffd1cefb, 0x8, 0xffa49ef7,
+  0x1, 0xffa9a4f7, 0x1, 0xffd7d4fb, 0x1fa, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x127, 0x00ffffff, 0x1, 0x90000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x21, 0xffffffff, 0x1, 0xfff4f3fe, 0x1, 0xffc6c2fa, 0x1, 0xffafaaf8,
+  0x3, 0xffa49ef7, 0x1, 0xffbab6f9, 0x1, 0xffd7d4fb, 0x1, 0xfff9f9fe,
+  0x1fc, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xa0000000,
+  0x127, 0x00ffffff, 0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f,
+  0x227, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000, 0x1, 0x30000000,
+  0x126, 0x00ffffff, 0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0x227, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x127, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x227, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0x50000000, 0x126, 0x00ffffff, 0x1, 0x70000000, 0x7, 0xff000000,
+  0x1, 0xff8f8f8f, 0x228, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0xe0000000, 0x126, 0x00ffffff, 0x1, 0x20000000, 0x7, 0xff000000,
+  0x1, 0xff2f2f2f, 0x228, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0x80000000, 0x126, 0x00ffffff, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x228, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x10000000, 0x125, 0x00ffffff, 0x1, 0x90000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x228, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x8, 0xff000000, 0x1, 0x90000000, 0x125, 0x00ffffff, 0x1, 0x30000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x229, 0xffffffff, 0x1, 0xff6f6f6f,
+  0x8, 0xff000000, 0x1, 0x20000000, 0x125, 0x00ffffff, 0x1, 0xd0000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x228, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xa0000000, 0x125, 0x00ffffff,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x229, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x8, 0xff000000, 0x1, 0x20000000, 0x124, 0x00ffffff,
+  0x1, 0x20000000, 0x8, 0xff000000, 0x1, 0xffefefef, 0x229, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xa0000000, 0x125, 0x00ffffff,
+  0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xff8f8f8f, 0x229, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0x40000000, 0x124, 0x00ffffff,
+  0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x167, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xffbfbfbf, 0x1, 0xffdfdfdf, 0xc0, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xc0000000, 0x125, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x164, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0x3, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffbfbfbf, 0xbe, 0xffffffff, 0x1, 0xffafafaf, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x124, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x163, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f,
+  0x5, 0xff000000, 0x1, 0xff1f1f1f, 0xbf, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0xc0000000, 0x124, 0x00ffffff, 0x1, 0x10000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x161, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xffafafaf, 0xbe, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0x40000000, 0x124, 0x00ffffff,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x160, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xff5f5f5f,
+  0xbf, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xa0000000,
+  0x124, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x15e, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xff7f7f7f, 0xbf, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0x20000000, 0x124, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x15d, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0xc0, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0xa0000000, 0x124, 0x00ffffff,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x15b, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0xc1, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0x20000000, 0x124, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xff3f3f3f, 0x15b, 0xffffffff, 0x1, 0xff3f3f3f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0xc3, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x7, 0xff000000, 0x1, 0x90000000, 0x124, 0x00ffffff, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xffafafaf, 0x159, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0xc4, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xf0000000, 0x1, 0x10000000,
+  0x124, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0x158, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0xc6, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x124, 0x00ffffff, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0x156, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0xc7, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xe0000000, 0x125, 0x00ffffff,
+  0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf,
+  0x155, 0xffffffff, 0x1, 0xff5f5f5f, 0x9, 0xff000000, 0x1, 0xffafafaf,
+  0xc9, 0xffffffff, 0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0x60000000,
+  0x124, 0x00ffffff, 0x1, 0x20000000, 0x8, 0xff000000, 0x1, 0xff4f4f4f,
+  0x154, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000, 0x1, 0xff9f9f9f,
+  0xca, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x125, 0x00ffffff, 0x1, 0x90000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x153, 0xffffffff, 0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xff5f5f5f,
+  0xcb, 0xffffffff, 0x1, 0xffefefef, 0x8, 0xff000000, 0x1, 0x30000000,
+  0x124, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x151, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0xcc, 0xffffffff,
+  0x1, 0xff5f5f5f, 0x7, 0xff000000, 0x1, 0xa0000000, 0x125, 0x00ffffff,
+  0x1, 0x60000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x150, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xffcfcfcf,
+  0xcd, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000, 0x1, 0x10000000,
+  0x125, 0x00ffffff, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x14f, 0xffffffff, 0x1, 0xff8f8f8f, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0xcf, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x70000000,
+  0x125, 0x00ffffff, 0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0xb, 0xff3f3f3f, 0x1, 0xff4f4f4f, 0x37, 0xff7f7f7f, 0x1, 0xffafafaf,
+  0x36, 0xffbfbfbf, 0x1, 0xffcfcfcf, 0xd4, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0xd0, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x7, 0xff000000, 0x1, 0xe0000000, 0x126, 0x00ffffff, 0x1, 0x80000000,
+  0xba, 0xff000000, 0x1, 0xff1f1f1f, 0x37, 0xff3f3f3f, 0x38, 0xff7f7f7f,
+  0x1, 0xff9f9f9f, 0x2b, 0xffbfbfbf, 0x1, 0xff777777, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0xd1, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x125, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x15d, 0xff000000, 0x1, 0xff3f3f3f, 0xd2, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xa0000000, 0x126, 0x00ffffff, 0x1, 0x40000000,
+  0x15d, 0xff000000, 0x1, 0xffbfbfbf, 0x6e, 0xffffffff, 0x1, 0xff636363,
+  0x2, 0xff101010, 0x1, 0xff1b1b1b, 0x1, 0xff373737, 0x13, 0xff3f3f3f,
+  0x1, 0xff5f5f5f, 0x25, 0xff7f7f7f, 0x1, 0xff8f8f8f, 0x25, 0xffbfbfbf,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0x10000000, 0x126, 0x00ffffff,
+  0x1, 0x90000000, 0x15b, 0xff000000, 0x1, 0xff3f3f3f, 0x6d, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1d1d1d, 0x6d, 0xff000000, 0x1, 0x70000000,
+  0x126, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xd0000000, 0x15a, 0xff000000,
+  0x1, 0xffafafaf, 0x6c, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff232323,
+  0x6e, 0xff000000, 0x1, 0xd0000000, 0x127, 0x00ffffff, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x158, 0xff000000, 0x1, 0xff080808, 0x6c, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xfa0a0a0a, 0x70, 0xff000000, 0x1, 0x30000000,
+  0x127, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xa0000000, 0xe, 0xc0000000,
+  0x1, 0xe0000000, 0x148, 0xff000000, 0x1, 0xff454545, 0x6b, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x72, 0xff000000, 0x1, 0x40000000, 0x16f, 0x00ffffff,
+  0x37, 0x40000000, 0x1, 0x60000000, 0x37, 0x80000000, 0x1, 0xb0000000,
+  0x36, 0xc0000000, 0x1, 0xd0000000, 0x6a, 0xff000000, 0x1, 0xffcfcfcf,
+  0x69, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0x73, 0xff000000,
+  0x1, 0x40000000, 0x24d, 0x00ffffff, 0x1, 0x30000000, 0x2a, 0x40000000,
+  0x1, 0xf4000000, 0x6, 0xff000000, 0x1, 0xff1f1f1f, 0x69, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0x73, 0xff000000, 0x1, 0xe0000000,
+  0x278, 0x00ffffff, 0x1, 0x30000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f,
+  0x68, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0xf3000000, 0x1, 0xc8000000, 0x13, 0xc0000000, 0x54, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x30000000, 0x278, 0x00ffffff, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x66, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x3a, 0x00ffffff, 0x1, 0x20000000, 0x26, 0x40000000, 0x6, 0x80000000,
+  0x1, 0x50000000, 0x27a, 0x00ffffff, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x65, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f,
+  0xb, 0xff000000, 0x1, 0x80000000, 0x2e4, 0x00ffffff, 0x1, 0xb0000000,
+  0x7, 0xff000000, 0x65, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f,
+  0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000, 0x2e5, 0x00ffffff,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x63, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xb, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x20000000, 0x2e6, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0x62, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f, 0xb, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x10000000, 0x2e7, 0x00ffffff, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x61, 0xffffffff, 0x1, 0xff7f7f7f, 0xb, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x2e9, 0x00ffffff, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x5f, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f,
+  0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000, 0x2e9, 0x00ffffff,
+  0x1, 0x20000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x5e, 0xffffffff,
+  0x1, 0xff7f7f7f, 0xc, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x2ea, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x5c, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x2ec, 0x00ffffff, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x5b, 0xffffffff, 0x1, 0xff7f7f7f,
+  0xc, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000, 0x2ed, 0x00ffffff,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x59, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xc, 0xff000000, 0x1, 0x90000000,
+  0x2ef, 0x00ffffff, 0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x57, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0xc, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x40000000, 0x2f0, 0x00ffffff, 0x1, 0x10000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x56, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff1f1f1f, 0xc, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x2f2, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x54, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff4f4f4f, 0xc, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x50000000, 0x2f4, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x53, 0xffffffff, 0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f, 0xc, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x10000000, 0x2f5, 0x00ffffff, 0x1, 0xe0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x51, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff1f1f1f, 0xc, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x2f7, 0x00ffffff, 0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff1f1f1f,
+  0x4f, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff3f3f3f, 0xd, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x10000000, 0x2f8, 0x00ffffff, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xffefefef, 0x4c, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0xd, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000,
+  0x2fa, 0x00ffffff, 0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x4b, 0xffffffff, 0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f, 0xd, 0xff000000,
+  0x1, 0x80000000, 0x1, 0x10000000, 0x2fb, 0x00ffffff, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x49, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff1f1f1f, 0xd, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000,
+  0x2fe, 0x00ffffff, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x47, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff1f1f1f, 0xd, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x60000000, 0x300, 0x00ffffff, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x44, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f,
+  0xe, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000, 0x301, 0x00ffffff,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x42, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0xe, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x20000000, 0x303, 0x00ffffff, 0x1, 0x30000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x40, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f,
+  0xe, 0xff000000, 0x1, 0xe0000000, 0x1, 0x50000000, 0x306, 0x00ffffff,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x3d, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff3f3f3f, 0xe, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x70000000, 0x308, 0x00ffffff, 0x1, 0x70000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x3a, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff1f1f1f, 0xf, 0xff000000, 0x1, 0x80000000, 0x1, 0x10000000,
+  0x309, 0x00ffffff, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff6f6f6f, 0x37, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff7f7f7f,
+  0x1, 0xff0f0f0f, 0xf, 0xff000000, 0x1, 0xa0000000, 0x1, 0x20000000,
+  0x30c, 0x00ffffff, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x34, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0x10, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x20000000, 0x30e, 0x00ffffff, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x30, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff2f2f2f,
+  0x10, 0xff000000, 0x1, 0xc0000000, 0x1, 0x40000000, 0x311, 0x00ffffff,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x2d, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f,
+  0x10, 0xff000000, 0x1, 0xc0000000, 0x1, 0x40000000, 0x314, 0x00ffffff,
+  0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf,
+  0x29, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f,
+  0x11, 0xff000000, 0x1, 0xc0000000, 0x1, 0x40000000, 0x316, 0x00ffffff,
+  0x1, 0x30000000, 0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x25, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0x12, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x30000000, 0x319, 0x00ffffff, 0x1, 0x60000000,
+  0xa, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x1f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f,
+  0x12, 0xff000000, 0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x20000000,
+  0x31c, 0x00ffffff, 0x1, 0xa0000000, 0xb, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xff8f8f8f, 0x1, 0xffdfdfdf, 0x18, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x14, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x80000000, 0x1, 0x10000000, 0x31f, 0x00ffffff,
+  0x1, 0xa0000000, 0xd, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff5f5f5f,
+  0x1, 0xff7f7f7f, 0x2, 0xffbfbfbf, 0xa, 0xffffffff, 0x1, 0xffefefef,
+  0x3, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f,
+  0x17, 0xff000000, 0x1, 0xc0000000, 0x1, 0x60000000, 0x323, 0x00ffffff,
+  0x1, 0xa0000000, 0x37, 0xff000000, 0x1, 0xf0000000, 0x1, 0xa0000000,
+  0x1, 0x30000000, 0x326, 0x00ffffff, 0x1, 0x70000000, 0x34, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x60000000, 0x32a, 0x00ffffff, 0x1, 0x40000000,
+  0x1, 0xe0000000, 0x2f, 0xff000000, 0x1, 0xd0000000, 0x1, 0x70000000,
+  0x1, 0x20000000, 0x32d, 0x00ffffff, 0x1, 0x10000000, 0x1, 0x90000000,
+  0x2b, 0xff000000, 0x1, 0xd0000000, 0x1, 0x70000000, 0x1, 0x20000000,
+  0x332, 0x00ffffff, 0x1, 0x20000000, 0x1, 0xa0000000, 0x25, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x337, 0x00ffffff, 0x1, 0x20000000, 0x1, 0x70000000, 0x1, 0xd0000000,
+  0x1e, 0xff000000, 0x1, 0xe0000000, 0x1, 0xb0000000, 0x1, 0x70000000,
+  0x1, 0x30000000, 0x33e, 0x00ffffff, 0x1, 0x20000000, 0x1, 0x70000000,
+  0x1, 0xa0000000, 0x1, 0xd0000000, 0x14, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xc0000000, 0x1, 0xa0000000, 0x1, 0x80000000, 0x1, 0x40000000,
+  0x1, 0x10000000, 0x347, 0x00ffffff, 0x1, 0x30000000, 0x1, 0x40000000,
+  0x1, 0x60000000, 0xb, 0x80000000, 0x1, 0x60000000, 0x2, 0x40000000,
+  0x1, 0x30000000, 0x140d, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0x50280eb8,
+  0x1, 0x70280eb8, 0x1, 0x40280eb8, 0x35a, 0x00ffffff, 0x1, 0x10280eb8,
+  0x1, 0xa0280eb8, 0x4, 0xff280eb8, 0x1, 0xe0280eb8, 0x1, 0x30280eb8,
+  0x357, 0x00ffffff, 0x1, 0x60280eb8, 0x1, 0xf0280eb8, 0x7, 0xff280eb8,
+  0x1, 0x30280eb8, 0x354, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0xc0280eb8,
+  0x9, 0xff280eb8, 0x1, 0xc0280eb8, 0x353, 0x00ffffff, 0x1, 0x80280eb8,
+  0xc, 0xff280eb8, 0x1, 0x20280eb8, 0x350, 0x00ffffff, 0x1, 0x40280eb8,
+  0x1, 0xd0280eb8, 0xd, 0xff280eb8, 0x1, 0x40280eb8, 0x34e, 0x00ffffff,
+  0x1, 0x10280eb8, 0x1, 0x90280eb8, 0xf, 0xff280eb8, 0x1, 0x30280eb8,
+  0x34d, 0x00ffffff, 0x1, 0x50280eb8, 0x1, 0xf0280eb8, 0xf, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x34c, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0xc0280eb8,
+  0x11, 0xff280eb8, 0x1, 0x50280eb8, 0x3f, 0x00ffffff, 0x1, 0x10280eb8,
+  0x1, 0x70280eb8, 0x2, 0xb0280eb8, 0x1, 0x70280eb8, 0x1, 0x20280eb8,
+  0x306, 0x00ffffff, 0x1, 0x70280eb8, 0x1, 0xf0280eb8, 0x11, 0xff280eb8,
+  0x1, 0x60280eb8, 0x3f, 0x00ffffff, 0x1, 0x50280eb8, 0x1, 0xf0280eb8,
+  0x4, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x60280eb8, 0x303, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0xd0280eb8, 0x11, 0xff280eb8, 0x1, 0xc0280eb8,
+  0x1, 0x20280eb8, 0x3f, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0xf0280eb8,
+  0x7, 0xff280eb8, 0x1, 0x80280eb8, 0x300, 0x00ffffff, 0x1, 0x10280eb8,
+  0x1, 0x90280eb8, 0x11, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x70280eb8,
+  0x41, 0x00ffffff, 0x1, 0xa0280eb8, 0x9, 0xff280eb8, 0x1, 0xa0280eb8,
+  0x1, 0x10280eb8, 0x2fd, 0x00ffffff, 0x1, 0x50280eb8, 0x1, 0xe0280eb8,
+  0x11, 0xff280eb8, 0x1, 0xb0280eb8, 0x1, 0x10280eb8, 0x42, 0x00ffffff,
+  0x1, 0xe0280eb8, 0xa, 0xff280eb8, 0x1, 0xd0280eb8, 0x1, 0x10280eb8,
+  0x2fa, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xb0280eb8, 0x11, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x1, 0x40280eb8, 0x44, 0x00ffffff, 0xc, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x1, 0x30280eb8, 0x2f9, 0x00ffffff, 0x1, 0xd0280eb8,
+  0x11, 0xff280eb8, 0x1, 0x90280eb8, 0x1, 0x10280eb8, 0x45, 0x00ffffff,
+  0x1, 0xd0280eb8, 0xc, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x40280eb8,
+  0x2f7, 0x00ffffff, 0x1, 0x70280eb8, 0x10, 0xff280eb8, 0x1, 0xd0280eb8,
+  0x1, 0x30280eb8, 0x47, 0x00ffffff, 0x1, 0x80280eb8, 0xe, 0xff280eb8,
+  0x1, 0x60280eb8, 0x2f6, 0x00ffffff, 0x1, 0xc0280eb8, 0xe, 0xff280eb8,
+  0x1, 0xf0280eb8, 0x1, 0x70280eb8, 0x49, 0x00ffffff, 0x1, 0x10280eb8,
+  0x1, 0xd0280eb8, 0xe, 0xff280eb8, 0x1, 0x90280eb8, 0x2f5, 0x00ffffff,
+  0x1, 0xf0280eb8, 0xd, 0xff280eb8, 0x1, 0xb0280eb8, 0x1, 0x20280eb8,
+  0x4b, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xd0280eb8, 0xe, 0xff280eb8,
+  0x1, 0xa0280eb8, 0x1, 0x10280eb8, 0x2f3, 0x00ffffff, 0x1, 0xd0280eb8,
+  0xb, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x50280eb8, 0x18, 0x00ffffff,
+  0x1, 0x10280eb8, 0x3, 0x40280eb8, 0x33, 0x00ffffff, 0x1, 0xa0280eb8,
+  0xe, 0xff280eb8, 0x1, 0xd0280eb8, 0x1, 0x10280eb8, 0x2f2, 0x00ffffff,
+  0x1, 0xa0280eb8, 0xa, 0xff280eb8, 0x1, 0x90280eb8, 0x1, 0x10280eb8,
+  0x18, 0x00ffffff, 0x1, 0x70280eb8, 0x1, 0xf0280eb8, 0x3, 0xff280eb8,
+  0x1, 0xe0280eb8, 0x1, 0x50280eb8, 0x32, 0x00ffffff, 0x1, 0x80280eb8,
+  0xe, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x30280eb8, 0x2f1, 0x00ffffff,
+  0x1, 0x20280eb8, 0x1, 0xf0280eb8, 0x7, 0xff280eb8, 0x1, 0xd0280eb8,
+  0x1, 0x40280eb8, 0x19, 0x00ffffff, 0x1, 0x80280eb8, 0x7, 0xff280eb8,
+  0x1, 0x50280eb8, 0x32, 0x00ffffff, 0x1, 0x60280eb8, 0xe, 0xff280eb8,
+  0x1, 0xf0280eb8, 0x1, 0x50280eb8, 0x2f1, 0x00ffffff, 0x1, 0x30280eb8,
+  0x1, 0xf0280eb8, 0x5, 0xff280eb8, 0x1, 0x80280eb8, 0x1a, 0x00ffffff,
+  0x1, 0x20280eb8, 0x8, 0xff280eb8, 0x1, 0xf0280eb8, 0x33, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0xf0280eb8, 0xe, 0xff280eb8, 0x1, 0x60280eb8,
+  0x2f1, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0x70280eb8, 0x1, 0xa0280eb8,
+  0x1, 0xb0280eb8, 0x1, 0x70280eb8, 0x1, 0x20280eb8, 0x1b, 0x00ffffff,
+  0x1, 0x80280eb8, 0x9, 0xff280eb8, 0x1, 0x40280eb8, 0x33, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0xd0280eb8, 0xe, 0xff280eb8, 0x1, 0xa0280eb8,
+  0x311, 0x00ffffff, 0x1, 0x80280eb8, 0x9, 0xff280eb8, 0x1, 0x80280eb8,
+  0x34, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xc0280eb8, 0xe, 0xff280eb8,
+  0x1, 0xb0280eb8, 0x1, 0x10280eb8, 0x30f, 0x00ffffff, 0x1, 0x80280eb8,
+  0x9, 0xff280eb8, 0x1, 0xb0280eb8, 0x36, 0x00ffffff, 0x1, 0xa0280eb8,
+  0xe, 0xff280eb8, 0x1, 0xd0280eb8, 0x1, 0x10280eb8, 0x30e, 0x00ffffff,
+  0x1, 0x50280eb8, 0x9, 0xff280eb8, 0x1, 0xe0280eb8, 0x37, 0x00ffffff,
+  0x1, 0x70280eb8, 0xe, 0xff280eb8, 0x1, 0xc0280eb8, 0x30e, 0x00ffffff,
+  0x1, 0x30280eb8, 0xa, 0xff280eb8, 0x1, 0x10280eb8, 0x37, 0x00ffffff,
+  0x1, 0x60280eb8, 0x1, 0xf0280eb8, 0xd, 0xff280eb8, 0x1, 0x40280eb8,
+  0x30e, 0x00ffffff, 0xa, 0xff280eb8, 0x1, 0x40280eb8, 0x38, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0xf0280eb8, 0xc, 0xff280eb8, 0x1, 0x80280eb8,
+  0x30e, 0x00ffffff, 0x1, 0xc0280eb8, 0x9, 0xff280eb8, 0x1, 0x80280eb8,
+  0x39, 0x00ffffff, 0x1, 0x20280eb8, 0x1, 0xd0280eb8, 0xb, 0xff280eb8,
+  0x1, 0x80280eb8, 0x30e, 0x00ffffff, 0x1, 0x90280eb8, 0x9, 0xff280eb8,
+  0x1, 0xa0280eb8, 0x3a, 0x00ffffff, 0x1, 0x10280eb8, 0x1, 0xc0280eb8,
+  0xa, 0xff280eb8, 0x1, 0x70280eb8, 0x30e, 0x00ffffff, 0x1, 0x60280eb8,
+  0x9, 0xff280eb8, 0x1, 0xd0280eb8, 0x3c, 0x00ffffff, 0x1, 0xa0280eb8,
+  0x8, 0xff280eb8, 0x1, 0xf0280eb8, 0x1, 0x20280eb8, 0x30e, 0x00ffffff,
+  0x1, 0x40280eb8, 0xa, 0xff280eb8, 0x3d, 0x00ffffff, 0x1, 0x60280eb8,
+  0x7, 0xff280eb8, 0x1, 0x60280eb8, 0x310, 0x00ffffff, 0xa, 0xff280eb8,
+  0x1, 0x40280eb8, 0x3d, 0x00ffffff, 0x1, 0x40280eb8, 0x1, 0xe0280eb8,
+  0x3, 0xff280eb8, 0x1, 0xe0280eb8, 0x1, 0x50280eb8, 0x311, 0x00ffffff,
+  0x1, 0xd0280eb8, 0x9, 0xff280eb8, 0x1, 0x70280eb8, 0x3f, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0x40280eb8, 0x1, 0x30280eb8, 0x313, 0x00ffffff,
+  0x1, 0xa0280eb8, 0x9, 0xff280eb8, 0x1, 0x90280eb8, 0x355, 0x00ffffff,
+  0x1, 0x70280eb8, 0x9, 0xff280eb8, 0x1, 0xc0280eb8, 0x355, 0x00ffffff,
+  0x1, 0x40280eb8, 0x9, 0xff280eb8, 0x1, 0xc0280eb8, 0x355, 0x00ffffff,
+  0x1, 0x10280eb8, 0x9, 0xff280eb8, 0x1, 0xc0280eb8, 0x356, 0x00ffffff,
+  0x1, 0xc0280eb8, 0x8, 0xff280eb8, 0x1, 0x70280eb8, 0x356, 0x00ffffff,
+  0x1, 0x30280eb8, 0x1, 0xf0280eb8, 0x6, 0xff280eb8, 0x1, 0xd0280eb8,
+  0x1, 0x10280eb8, 0x357, 0x00ffffff, 0x1, 0x30280eb8, 0x1, 0xe0280eb8,
+  0x4, 0xff280eb8, 0x1, 0xc0280eb8, 0x1, 0x10280eb8, 0x158, 0x00ffffff,
 };
-unsigned int assets_bongo_cat_right_down_png_len = 7023;
 
-const size_t bongo_cat_right_down_png_size = 7023;
+const embedded_asset_t bongo_cat_right_down_png = {
+    .width = 864,
+    .height = 360,
+    .runs = bongo_cat_right_down_png_runs,
+    .num_runs = 4736,
+};
 
-const unsigned char bongo_cat_both_down_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x01, 0x68,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x31, 0x5e, 0x98, 0xe0, 0x00, 0x00, 0x00,
-  0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x0b,
-  0x12, 0x01, 0xd2, 0xdd, 0x7e, 0xfc, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44,
-  0x41, 0x54, 0x78, 0x5e, 0xed, 0xdd, 0x7f, 0x8c, 0x65, 0x67, 0x7d, 0xdf,
-  0xf1, 0xb3, 0x3f, 0x30, 0x8e, 0x31, 0xcc, 0x9a, 0x44, 0xb1, 0x31, 0x86,
-  0xb9, 0xab, 0x58, 0x80, 0x1c, 0xc3, 0xac, 0x49, 0x9a, 0x80, 0x88, 0x35,
-  0x77, 0x85, 0x92, 0x00, 0x2d, 0x99, 0xd9, 0xa8, 0xa2, 0x26, 0xff, 0xcc,
-  0xac, 0x82, 0x52, 0x45, 0x4d, 0x34, 0x63, 0x11, 0xa5, 0x28, 0x89, 0x98,
-  0xd9, 0xa6, 0x7f, 0xb4, 0x89, 0xd4, 0x9d, 0x55, 0x11, 0xa1, 0x89, 0xd4,
-  0xb9, 0x5b, 0x68, 0x04, 0x4a, 0xdc, 0x9d, 0x25, 0x04, 0x39, 0xb4, 0x74,
-  0xef, 0x06, 0x53, 0x6a, 0x7e, 0x74, 0x66, 0x84, 0x21, 0x40, 0x20, 0x7b,
-  0x37, 0x50, 0x63, 0xd3, 0x86, 0xdd, 0x49, 0xed, 0xc8, 0xeb, 0x5f, 0xd3,
-  0xef, 0xe7, 0x7a, 0x2f, 0x1e, 0xcf, 0xce, 0x3d, 0xe7, 0x39, 0xf7, 0x9e,
-  0x7b, 0xcf, 0xf3, 0xe3, 0xfd, 0x48, 0x47, 0x3b, 0xf6, 0x7d, 0xce, 0x39,
-  0xcf, 0xf3, 0x7a, 0xce, 0xdc, 0x39, 0xdf, 0xf3, 0x3c, 0xe7, 0x79, 0xb2,
-  0x8c, 0x84, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x24, 0x2d,
-  0x70, 0x20, 0xe9, 0xda, 0x53, 0x79, 0x04, 0x10, 0x40, 0xc0, 0x3f, 0x81,
-  0x86, 0x15, 0xe9, 0x88, 0x6d, 0x87, 0x6c, 0x7b, 0xc4, 0xbf, 0xe2, 0x51,
-  0x22, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x20, 0x7c, 0x01, 0x05, 0x5c, 0x6b, 0xb6, 0x6d, 0xef, 0xd8,
-  0xda, 0xf6, 0x73, 0x33, 0xfc, 0xaa, 0x51, 0x03, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0xc0, 0x2f, 0x81,
-  0xdd, 0xc1, 0xd7, 0xee, 0x40, 0x4c, 0xbd, 0x62, 0x24, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x81,
-  0x21, 0x05, 0x5a, 0xb6, 0xff, 0xce, 0x80, 0xab, 0xdf, 0xcf, 0xca, 0xa7,
-  0x9e, 0x32, 0x12, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0xc0, 0x00, 0x02, 0xf3, 0x8e, 0xc1, 0x57,
-  0x2f, 0x28, 0xbb, 0x6c, 0xf9, 0x97, 0x07, 0x38, 0x0f, 0xbb, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x49, 0x0b, 0xcc, 0x96, 0x0c, 0xbe, 0x76, 0xf6, 0x8c, 0x75, 0x6c, 0xdf,
-  0x66, 0xd2, 0x7a, 0x54, 0x1e, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x70, 0x14, 0xd0, 0x3b, 0x5d, 0xea,
-  0xcd, 0x72, 0x19, 0x7a, 0x98, 0x97, 0x47, 0xef, 0x8e, 0x31, 0x2c, 0xd1,
-  0x11, 0x9d, 0x6c, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x90, 0x9e, 0x80, 0x02, 0xa6, 0x8d, 0x0a, 0x82, 0xaf,
-  0x9d, 0xc3, 0x12, 0x17, 0xd3, 0x63, 0xa4, 0xc6, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x40, 0xb1, 0x40,
-  0xde, 0x8c, 0x87, 0xc3, 0xf4, 0x88, 0xb5, 0xed, 0xd4, 0xcc, 0x96, 0x58,
-  0xec, 0x4f, 0x0e, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x48, 0x44, 0x60, 0xd9, 0xa5, 0xe7, 0x6b, 0x69, 0x69,
-  0x69, 0x7b, 0x72, 0x72, 0x72, 0xd0, 0x60, 0x4c, 0xe7, 0x20, 0x21, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x49, 0x0b, 0x34, 0x5d, 0x82, 0xaf, 0x93, 0x27, 0x4f, 0x6e, 0xf7, 0x92,
-  0x7e, 0x9e, 0x98, 0x98, 0x18, 0x24, 0x10, 0xd3, 0x10, 0x47, 0x7a, 0xc3,
-  0x92, 0xbe, 0xdc, 0xa8, 0x3c, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0xe9, 0x0a, 0xe8, 0xbd, 0xaf, 0xc2, 0x49, 0x37,
-  0xe6, 0xe6, 0xe6, 0x7e, 0x10, 0x7c, 0xf5, 0x7e, 0xb8, 0x74, 0xe9, 0xd2,
-  0xf6, 0xc2, 0xc2, 0xc2, 0x20, 0x41, 0x98, 0xf6, 0xe1, 0xdd, 0xb0, 0x74,
-  0xaf, 0x39, 0x6a, 0x8e, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x40, 0xb2, 0x02, 0xed, 0xa2, 0xde, 0xaf, 0xa9, 0xa9, 0xa9,
-  0x6d, 0x05, 0x5b, 0xfd, 0xd2, 0xfa, 0xfa, 0xfa, 0xf6, 0xf4, 0xf4, 0xf4,
-  0x20, 0x81, 0x98, 0xce, 0xdd, 0x48, 0x56, 0x9e, 0x8a, 0x23, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x40, 0x52, 0x02,
-  0xea, 0x85, 0xca, 0x0d, 0x9c, 0x34, 0xcc, 0xf0, 0xc2, 0x85, 0x0b, 0x7d,
-  0x83, 0xaf, 0x9d, 0x1f, 0x0c, 0x38, 0x2c, 0x51, 0xbd, 0x6f, 0x5a, 0x77,
-  0x8c, 0x84, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x44, 0x2b, 0xa0, 0xf7, 0xb0, 0x0a, 0x7b, 0xad, 0xce,
-  0x9d, 0x3b, 0xe7, 0x14, 0x7c, 0xed, 0x1c, 0x96, 0x38, 0x33, 0x33, 0x53,
-  0x78, 0xdc, 0x3d, 0xce, 0xdd, 0xb2, 0xff, 0xc7, 0xba, 0x61, 0xd1, 0x5e,
-  0x6e, 0x54, 0x0c, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x81, 0xb4, 0x05, 0x0a, 0xd7, 0xfb, 0xd2, 0x8c, 0x87, 0x83, 0xa6,
-  0x33, 0x67, 0xce, 0x0c, 0x32, 0x49, 0x07, 0x13, 0x74, 0xa4, 0x7d, 0x4d,
-  0x52, 0x7b, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0xa2, 0x14, 0x58, 0x29, 0xea, 0xfd, 0xd2, 0x3b, 0x5d, 0xc3, 0x26,
-  0xbd, 0x37, 0x36, 0x40, 0x6f, 0x98, 0x86, 0x24, 0xce, 0x47, 0xa9, 0x4e,
-  0xa5, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x20, 0x39, 0x81, 0x66, 0x51, 0xf0, 0xa5, 0xf7, 0xbe, 0xf2, 0x26,
-  0xdd, 0x28, 0x1b, 0x98, 0x0d, 0xd8, 0x1b, 0xa6, 0x20, 0x91, 0x84, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x04, 0x2b, 0xa0, 0x77, 0xac, 0x3a, 0x45, 0x01, 0x98, 0x02, 0xa6, 0xaa,
-  0x93, 0x02, 0xba, 0x01, 0x66, 0x4a, 0xd4, 0x90, 0x44, 0xde, 0x0b, 0x0b,
-  0xf6, 0x72, 0xa3, 0xe0, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0xa4, 0x2d, 0xb0, 0x5c, 0x14, 0x7c, 0x69, 0x5d, 0xaf,
-  0x51, 0x26, 0xcd, 0x94, 0x58, 0x54, 0x86, 0x5d, 0x9f, 0x6b, 0x48, 0x22,
-  0x0b, 0x37, 0xa7, 0x7d, 0xdd, 0x52, 0x7b, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x82, 0x13, 0x28, 0x9c, 0xf5, 0x70,
-  0x72, 0x72, 0xb2, 0xd2, 0xa1, 0x87, 0x79, 0xeb, 0x86, 0x69, 0x6d, 0xb1,
-  0x92, 0x81, 0xd8, 0x7c, 0x70, 0xe2, 0x14, 0x18, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x92, 0x15, 0x28, 0x9c,
-  0xf5, 0xb0, 0xec, 0x94, 0xf3, 0xc3, 0xf4, 0x94, 0x69, 0x48, 0xe2, 0xdc,
-  0xdc, 0x5c, 0xd9, 0x20, 0x8c, 0xf7, 0xc2, 0x92, 0xbd, 0x7c, 0xa9, 0x38,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0xe1,
-  0x08, 0x14, 0x2e, 0xb8, 0x3c, 0xea, 0xa1, 0x87, 0xfd, 0x82, 0xb5, 0xd5,
-  0xd5, 0xd5, 0xb2, 0xd3, 0xd5, 0xb7, 0x8c, 0x9d, 0xf7, 0xc2, 0xc2, 0xb9,
-  0xf6, 0x28, 0x29, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x49, 0x09, 0x28, 0x58, 0xd1, 0x7b, 0x54, 0x7d, 0x7b, 0x9b,
-  0xc6, 0x35, 0xf4, 0x30, 0x6f, 0x48, 0xa2, 0xca, 0x90, 0x57, 0xc6, 0x5d,
-  0x9f, 0x31, 0x39, 0x47, 0x52, 0x97, 0x30, 0x95, 0x45, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x20, 0x1c, 0x01, 0xf5, 0x18,
-  0xe5, 0x06, 0x37, 0xe3, 0x1c, 0x7a, 0xd8, 0x2f, 0x08, 0x1b, 0x60, 0x96,
-  0x44, 0x16, 0x6d, 0x0e, 0xe7, 0x1a, 0xa4, 0xa4, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x24, 0x21, 0xd0, 0x2c, 0x0a,
-  0xbe, 0xb4, 0x50, 0xb2, 0x4f, 0x49, 0x43, 0x21, 0x8b, 0xca, 0xbc, 0xe3,
-  0x73, 0x66, 0x48, 0x4c, 0xe2, 0x32, 0xa6, 0x92, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x84, 0x21, 0xd0, 0xce, 0x0b,
-  0x66, 0xaa, 0x5e, 0x70, 0xb9, 0xaa, 0x40, 0x4e, 0xef, 0x85, 0x95, 0x0c,
-  0xc2, 0x14, 0x68, 0x92, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x81, 0xda, 0x04, 0xe6, 0x8b, 0x82, 0x18,
-  0xad, 0xc9, 0xe5, 0x6b, 0x5a, 0x5f, 0x5f, 0x2f, 0x3b, 0x39, 0x87, 0xea,
-  0x4b, 0x42, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x6a, 0x11, 0xe8, 0xe4, 0x05, 0x60, 0x5a, 0x87, 0xcb,
-  0xf7, 0x74, 0xe1, 0xc2, 0x85, 0xed, 0x92, 0xeb, 0x85, 0x11, 0x84, 0xd5,
-  0x72, 0xa9, 0x71, 0x52, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0xd2, 0x16, 0x58, 0xce, 0x0b, 0xbe, 0xf4, 0x99, 0x0f,
-  0x13, 0x6f, 0xb8, 0x04, 0x80, 0x9a, 0x9c, 0x83, 0x20, 0x2c, 0xed, 0x8b,
-  0x99, 0xda, 0x23, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0xe0, 0xb3, 0x40, 0xe1, 0xb4, 0xf3, 0xbe, 0x4d, 0xbc, 0xe1, 0x12,
-  0x88, 0x95, 0x5c, 0xb4, 0x99, 0x9e, 0x30, 0x9f, 0xaf, 0x50, 0xca, 0x86,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x40, 0x44,
-  0x02, 0x85, 0xbd, 0x5f, 0x1a, 0xda, 0x17, 0x62, 0x22, 0x08, 0x8b, 0xe8,
-  0x2a, 0xa5, 0x2a, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x44, 0x20, 0x50, 0xd8, 0xfb, 0xa5, 0x69, 0xde, 0x43, 0x4e,
-  0x9a, 0x38, 0xc4, 0xda, 0xc9, 0x75, 0xa3, 0x27, 0x2c, 0x82, 0x8b, 0x9a,
-  0x2a, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0xe0, 0xab, 0x40, 0x6e, 0xef, 0x97, 0xaf, 0xd3, 0xce, 0x97, 0x0d, 0x08,
-  0x4b, 0x4e, 0x53, 0x4f, 0x10, 0xe6, 0xeb, 0xd5, 0x4a, 0xb9, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x08, 0x58, 0xa0,
-  0xb0, 0xf7, 0x6b, 0x69, 0x69, 0xa9, 0x6c, 0xac, 0xe3, 0x6d, 0x7e, 0x82,
-  0xb0, 0x80, 0xaf, 0x54, 0x8a, 0x8e, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x40, 0x04, 0x02, 0x49, 0xf4, 0x7e, 0xed, 0x8c,
-  0x08, 0x09, 0xc2, 0x22, 0xb8, 0x6a, 0xa9, 0x02, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x01, 0x0a, 0x24, 0xd5, 0xfb,
-  0x35, 0x44, 0x10, 0x36, 0x1b, 0x60, 0xdb, 0x52, 0x64, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0xc6, 0x22, 0xb0, 0x6f, 0x2c, 0x67, 0xe1, 0x24, 0x08,
-  0x20, 0x80, 0x40, 0x1c, 0x02, 0x8b, 0x56, 0x8d, 0x93, 0xfd, 0xaa, 0x62,
-  0xef, 0x7e, 0x65, 0x9d, 0x4e, 0x27, 0x3b, 0x74, 0x48, 0x71, 0x5a, 0x7c,
-  0xa9, 0xd5, 0x6a, 0x65, 0xc7, 0x8f, 0x1f, 0x77, 0xa9, 0xd8, 0x13, 0x96,
-  0xe9, 0x63, 0xb6, 0x5d, 0xbe, 0xba, 0x6d, 0x5c, 0xfd, 0xb7, 0x68, 0xdf,
-  0x76, 0x51, 0x06, 0x3e, 0x47, 0x00, 0x81, 0x5a, 0x04, 0xfe, 0x8d, 0x9d,
-  0xf5, 0x16, 0xdb, 0x0e, 0xdb, 0xf6, 0xac, 0x6d, 0xfa, 0x22, 0xe8, 0xd4,
-  0x52, 0x12, 0x4e, 0x8a, 0x40, 0x04, 0x02, 0x04, 0x60, 0x11, 0x34, 0x22,
-  0x55, 0x40, 0x00, 0x81, 0xb1, 0x09, 0xe8, 0x86, 0x63, 0xb2, 0xdf, 0xd9,
-  0xec, 0xdd, 0xaf, 0x6c, 0x79, 0x79, 0x79, 0x6c, 0x85, 0xa9, 0xe3, 0x44,
-  0x0a, 0x2e, 0xb7, 0xb6, 0xb6, 0xc6, 0x7d, 0x6a, 0x9d, 0x50, 0xc1, 0x5c,
-  0x2f, 0x3d, 0x6d, 0x3f, 0x3c, 0x62, 0xdb, 0x37, 0x77, 0xfc, 0x3f, 0xfd,
-  0xf7, 0xff, 0xdc, 0x95, 0xcf, 0x35, 0xf0, 0x1b, 0x77, 0x7d, 0x38, 0x1f,
-  0x02, 0xa1, 0x08, 0x28, 0xf0, 0xba, 0xd7, 0xb6, 0xeb, 0x76, 0x15, 0xf8,
-  0x31, 0xfb, 0xef, 0xbb, 0x6d, 0xd3, 0xef, 0x18, 0x09, 0x01, 0x04, 0x4a,
-  0x0a, 0x10, 0x80, 0x95, 0x04, 0x23, 0x3b, 0x02, 0x08, 0x24, 0x2b, 0x30,
-  0x6f, 0x35, 0x5f, 0xed, 0x57, 0xfb, 0xd8, 0x7b, 0xbf, 0x7a, 0xf5, 0x2e,
-  0xd1, 0x0b, 0xe6, 0xdb, 0x85, 0x72, 0xe5, 0x6a, 0xd0, 0xa6, 0x72, 0xe9,
-  0xe6, 0xf1, 0x6b, 0x57, 0xff, 0x55, 0x60, 0xd7, 0xb6, 0xad, 0x17, 0xe0,
-  0x11, 0xb4, 0xf9, 0xd6, 0x72, 0x94, 0xa7, 0x0e, 0x81, 0xf7, 0xd8, 0x49,
-  0xd5, 0xdb, 0x7f, 0x63, 0xce, 0xc9, 0x1f, 0xb7, 0xcf, 0x6e, 0xdb, 0xf1,
-  0xbb, 0x53, 0x47, 0x39, 0x39, 0x27, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x44, 0x2c, 0xa0, 0x9b, 0xf4, 0xbe, 0xeb, 0x62, 0xc5, 0x34, 0xf3,
-  0x61, 0xd1, 0x94, 0x8c, 0x25, 0x27, 0xe5, 0x70, 0x5d, 0x4b, 0xcc, 0xc7,
-  0x7c, 0x1d, 0x6b, 0x73, 0x6d, 0x0f, 0xd8, 0xd6, 0xb2, 0x6d, 0xc5, 0x36,
-  0xbd, 0xdf, 0xd6, 0xb4, 0xed, 0x48, 0xc4, 0xd7, 0x3a, 0x55, 0x4b, 0x57,
-  0xe0, 0x1d, 0x56, 0x75, 0xf5, 0x26, 0xbb, 0xfe, 0x3e, 0x2e, 0xa7, 0x4b,
-  0x45, 0xcd, 0x11, 0x18, 0x5c, 0x80, 0x1e, 0xb0, 0xc1, 0xed, 0xd8, 0x13,
-  0x01, 0x04, 0xd2, 0x11, 0xd0, 0x0d, 0xf7, 0xb9, 0xbc, 0xea, 0x5e, 0xba,
-  0x74, 0x29, 0xda, 0x77, 0xbf, 0xf6, 0xaa, 0x77, 0xc0, 0x3d, 0x61, 0xa3,
-  0xb8, 0x6a, 0x2f, 0xda, 0x41, 0xf5, 0xde, 0xdb, 0x43, 0xb6, 0xfd, 0x5f,
-  0xdb, 0x34, 0x14, 0xb2, 0x63, 0x9b, 0x7a, 0xd5, 0x18, 0xa2, 0x35, 0x0a,
-  0x71, 0x8e, 0x59, 0xb5, 0xc0, 0x1b, 0xec, 0x80, 0xff, 0xc9, 0xb6, 0xa9,
-  0x92, 0x07, 0x56, 0x6f, 0xf2, 0x4b, 0x4b, 0xee, 0x43, 0x76, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0xa0, 0x50, 0xa0, 0x65, 0x39, 0xfa,
-  0x3e, 0x11, 0x9e, 0x9b, 0x9b, 0x2b, 0xea, 0x34, 0x8a, 0xf2, 0xf3, 0x84,
-  0x7a, 0xc2, 0x5c, 0x7b, 0x03, 0xfa, 0xe5, 0x53, 0x70, 0xa6, 0x80, 0xac,
-  0xd7, 0x93, 0xa6, 0xc9, 0x5c, 0x9a, 0xb6, 0xd1, 0x8b, 0x56, 0xf8, 0xab,
-  0x47, 0x86, 0x11, 0x0b, 0x68, 0xc6, 0xa0, 0x76, 0xde, 0xf7, 0x9b, 0xc3,
-  0x67, 0xf3, 0x23, 0x2e, 0x23, 0x87, 0x47, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x81, 0xc4, 0x04, 0x74, 0x83, 0x92, 0x7b, 0x03, 0x7e, 0xe1, 0xc2,
-  0x85, 0x28, 0x03, 0x2c, 0x97, 0x4a, 0x2d, 0x2c, 0x2c, 0x0c, 0x1b, 0x9c,
-  0xb0, 0xff, 0x73, 0x3d, 0x65, 0x7a, 0x27, 0xed, 0x7e, 0xdb, 0x76, 0x0e,
-  0x73, 0x4c, 0xec, 0x57, 0x8d, 0xea, 0x8e, 0x59, 0x60, 0xcd, 0xce, 0xf7,
-  0x4c, 0xd1, 0xf7, 0x9b, 0xc3, 0xe7, 0x7f, 0x3b, 0xe6, 0x72, 0x73, 0x3a,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x88, 0x5c, 0x40, 0xbd, 0x15,
-  0x7d, 0x83, 0x84, 0xe9, 0xe9, 0x69, 0x97, 0x38, 0x25, 0xea, 0x3c, 0x04,
-  0x61, 0xce, 0xef, 0xcb, 0x0c, 0x12, 0x6c, 0xaa, 0xf7, 0x4c, 0xc1, 0xd9,
-  0x9f, 0xda, 0xa6, 0x19, 0xe9, 0x9a, 0xb6, 0xd1, 0x73, 0x16, 0xf9, 0x97,
-  0xce, 0x88, 0xab, 0xa7, 0xeb, 0x48, 0x93, 0xd2, 0x0c, 0x72, 0x3d, 0xf6,
-  0xdb, 0x47, 0xd7, 0x25, 0x09, 0x01, 0x04, 0x1c, 0x05, 0x78, 0x07, 0xcc,
-  0x11, 0x8a, 0x6c, 0x08, 0x20, 0x90, 0xac, 0x40, 0xc7, 0x6a, 0xde, 0x77,
-  0xea, 0xf9, 0x33, 0x67, 0xce, 0x64, 0xb3, 0xb3, 0xac, 0x3b, 0xac, 0xf5,
-  0xcf, 0xb4, 0xed, 0x4c, 0x1b, 0x1b, 0x1b, 0xd9, 0xe5, 0xcb, 0x3b, 0x67,
-  0x8f, 0xdf, 0xfb, 0x1a, 0xda, 0x6b, 0xdf, 0x5e, 0xce, 0xf3, 0xe7, 0xcf,
-  0x27, 0x7b, 0xe1, 0x39, 0x54, 0xfc, 0x51, 0xcb, 0xa3, 0xa9, 0xf8, 0xbf,
-  0x68, 0x5b, 0xdb, 0xb6, 0xde, 0x8c, 0x8e, 0x0e, 0xbb, 0x92, 0x25, 0x41,
-  0x01, 0x97, 0x99, 0x0d, 0x07, 0x65, 0x39, 0x6d, 0x3b, 0xce, 0x0f, 0xba,
-  0x33, 0xfb, 0x21, 0x90, 0x9a, 0x00, 0x01, 0x58, 0x6a, 0x2d, 0x4e, 0x7d,
-  0x11, 0x40, 0xa0, 0x8c, 0x40, 0xd3, 0x32, 0xf7, 0x9d, 0x7c, 0x63, 0x72,
-  0x72, 0xf2, 0x9a, 0xa0, 0xa3, 0xcc, 0xc1, 0xc9, 0x3b, 0x98, 0xc0, 0xee,
-  0xc0, 0x4e, 0x41, 0x9e, 0xfe, 0x5f, 0x2f, 0xed, 0xfe, 0x6f, 0x05, 0x78,
-  0x17, 0x2f, 0x6a, 0x9e, 0x8c, 0x64, 0x92, 0xd6, 0x4d, 0xd3, 0x84, 0x20,
-  0xbd, 0xc0, 0xac, 0x63, 0x3f, 0x33, 0x19, 0x48, 0x32, 0xcd, 0x7f, 0x4d,
-  0x45, 0x35, 0xb3, 0xe1, 0x7f, 0xb4, 0xed, 0xe6, 0x41, 0x08, 0xac, 0x97,
-  0xbf, 0xfb, 0x3d, 0xe7, 0xf0, 0x3b, 0x74, 0x93, 0x1d, 0xbf, 0xf8, 0x89,
-  0xcb, 0x20, 0x85, 0x60, 0x1f, 0x04, 0x22, 0x13, 0x20, 0x00, 0x8b, 0xac,
-  0x41, 0xa9, 0x0e, 0x02, 0x08, 0x54, 0x26, 0x30, 0x6f, 0x47, 0xd2, 0xfb,
-  0x38, 0x13, 0xfd, 0x8e, 0x98, 0xc2, 0xc2, 0xcb, 0x95, 0x69, 0x7a, 0x72,
-  0xa0, 0xdd, 0xc1, 0x59, 0xbb, 0xdd, 0xee, 0x96, 0x6c, 0xe7, 0xff, 0xd7,
-  0xcf, 0x9b, 0x9b, 0x9b, 0x9e, 0x94, 0xb8, 0xd2, 0x62, 0x3c, 0x6c, 0x47,
-  0xfb, 0xf2, 0xd5, 0x60, 0x4c, 0xef, 0x9b, 0xb1, 0xe6, 0x59, 0xa5, 0xbc,
-  0xde, 0x1d, 0x6c, 0xd0, 0x99, 0x0d, 0xbb, 0x15, 0xd1, 0x03, 0x26, 0xcd,
-  0x76, 0xda, 0x6c, 0x36, 0xbb, 0x0b, 0xcc, 0x9f, 0x38, 0x71, 0xa2, 0xa8,
-  0x82, 0x5a, 0xb0, 0x59, 0xdf, 0x99, 0x24, 0x04, 0x10, 0x28, 0x10, 0x20,
-  0x00, 0xe3, 0x12, 0x41, 0x00, 0x01, 0x04, 0x5e, 0x28, 0xd0, 0xb4, 0xff,
-  0x6c, 0xe9, 0xfe, 0xa3, 0x08, 0xc6, 0x26, 0xdf, 0xc8, 0x1a, 0x8d, 0x46,
-  0x51, 0x36, 0x3e, 0x0f, 0x58, 0xa0, 0xd7, 0xdb, 0xb6, 0x33, 0x40, 0xdb,
-  0xf9, 0xff, 0x22, 0x08, 0xd4, 0xf4, 0x2e, 0x90, 0x86, 0x31, 0xfe, 0x37,
-  0xdb, 0xda, 0xb6, 0x29, 0x28, 0xeb, 0x04, 0xdc, 0x64, 0x14, 0x3d, 0xcb,
-  0x34, 0x71, 0x90, 0x26, 0xd8, 0x98, 0x1e, 0x04, 0x43, 0x81, 0x97, 0x02,
-  0xae, 0xf9, 0xf9, 0xf9, 0x1f, 0xec, 0xae, 0xeb, 0xff, 0xa6, 0x9b, 0xd4,
-  0xc1, 0x95, 0x9b, 0xfe, 0xb7, 0x7d, 0xaa, 0x85, 0x99, 0x49, 0x08, 0x20,
-  0x50, 0x20, 0x40, 0x00, 0xc6, 0x25, 0x82, 0x00, 0x02, 0x08, 0x3c, 0x27,
-  0xa0, 0x89, 0x0d, 0xf4, 0xf4, 0xd6, 0xe9, 0xa6, 0x65, 0x66, 0x66, 0x26,
-  0x5b, 0x5b, 0xd3, 0x3d, 0x0e, 0x09, 0x01, 0x8b, 0x5c, 0xae, 0xf6, 0xa4,
-  0xf5, 0xfe, 0xed, 0x05, 0x69, 0xfa, 0x77, 0x6b, 0x4b, 0x23, 0x02, 0x83,
-  0x4b, 0x5f, 0xb7, 0x12, 0x7f, 0xc9, 0xb6, 0xff, 0x6a, 0x9b, 0x82, 0x32,
-  0x86, 0x30, 0x86, 0xd1, 0x84, 0xfa, 0x52, 0x7a, 0xa7, 0x6d, 0xfb, 0xcb,
-  0x16, 0x77, 0x62, 0x62, 0x22, 0x5b, 0x5c, 0x5c, 0xec, 0x6e, 0x87, 0x0e,
-  0x29, 0x86, 0x7b, 0x61, 0x52, 0x40, 0x76, 0xfa, 0xb4, 0x5e, 0xf5, 0xca,
-  0x4d, 0x77, 0x71, 0xad, 0x14, 0x11, 0xf1, 0x39, 0x02, 0x59, 0x46, 0x00,
-  0xc6, 0x55, 0x80, 0x00, 0x02, 0xa9, 0x0b, 0xe8, 0x4e, 0x63, 0xd9, 0xb6,
-  0x85, 0x32, 0x10, 0xb6, 0x06, 0xd6, 0x0b, 0x9e, 0x10, 0x97, 0xd9, 0x97,
-  0xbc, 0xe9, 0x09, 0xec, 0x0c, 0xc8, 0x7a, 0xbd, 0x69, 0xfa, 0x37, 0xb0,
-  0x49, 0x46, 0xbe, 0x62, 0x2d, 0x47, 0x4f, 0x99, 0x9f, 0x97, 0xaf, 0x66,
-  0x36, 0xd4, 0x10, 0xc0, 0xeb, 0x06, 0x29, 0x9e, 0xcd, 0x64, 0xda, 0xed,
-  0xf5, 0xda, 0x2b, 0xf0, 0xea, 0x1d, 0x4f, 0x0f, 0x17, 0x8e, 0x1e, 0x3d,
-  0x5a, 0x74, 0xf8, 0x53, 0x96, 0x41, 0x33, 0xc7, 0x92, 0x10, 0x40, 0x20,
-  0x47, 0x80, 0x00, 0x8c, 0xcb, 0x03, 0x01, 0x04, 0x52, 0x16, 0xd0, 0x8d,
-  0x82, 0x82, 0xaf, 0xbe, 0xef, 0x79, 0xed, 0x85, 0xa3, 0x97, 0xd2, 0x7b,
-  0x3d, 0x1d, 0x29, 0xe3, 0x51, 0xf7, 0x6a, 0x04, 0x76, 0x06, 0x64, 0x0a,
-  0xd4, 0x7a, 0xb3, 0x42, 0x06, 0x10, 0x9c, 0x69, 0xf8, 0xa2, 0x5e, 0x96,
-  0xd3, 0x44, 0x35, 0xbc, 0x53, 0x56, 0xcd, 0xe5, 0x50, 0xf6, 0x28, 0x77,
-  0xdb, 0x0e, 0x7f, 0x56, 0xf6, 0x3b, 0xac, 0x77, 0x12, 0x5b, 0x44, 0xbe,
-  0x1b, 0x78, 0xb9, 0x0e, 0xa5, 0x56, 0xbe, 0x82, 0xc9, 0x38, 0x1e, 0xb3,
-  0x63, 0xbf, 0xb4, 0x6c, 0x25, 0xc8, 0x8f, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0xf1, 0x0b, 0x34, 0xad, 0x8a, 0x1a, 0x52, 0x55, 0x7a, 0x1d,
-  0x9c, 0xa9, 0xa9, 0xa9, 0xed, 0x4b, 0x97, 0x2e, 0x45, 0xbd, 0xae, 0x17,
-  0x95, 0xf3, 0x47, 0x40, 0xd7, 0xda, 0xb9, 0x73, 0xe7, 0xb6, 0xad, 0xc7,
-  0x75, 0xdb, 0x26, 0x7d, 0xd9, 0xd6, 0xba, 0x73, 0xba, 0x06, 0x07, 0xb9,
-  0x76, 0xc7, 0xb4, 0x8f, 0xde, 0x03, 0xfa, 0xb8, 0x6d, 0xf3, 0xb6, 0xb1,
-  0x5e, 0xd9, 0x68, 0xbf, 0x4b, 0xdf, 0x6f, 0x87, 0x1f, 0x68, 0x21, 0x65,
-  0x5d, 0x47, 0xba, 0xae, 0xca, 0x26, 0x5d, 0x83, 0x0e, 0xd7, 0x11, 0xeb,
-  0x72, 0x8c, 0xb6, 0xdd, 0x39, 0x7a, 0x04, 0x02, 0xf4, 0x80, 0x45, 0xd0,
-  0x88, 0x54, 0x01, 0x01, 0x04, 0x9c, 0x05, 0x34, 0xdc, 0xb0, 0x65, 0xdb,
-  0x8c, 0xf3, 0x1e, 0x57, 0x33, 0x16, 0xbd, 0x1f, 0x51, 0xf6, 0x78, 0xe4,
-  0x47, 0x60, 0x58, 0x81, 0x5e, 0x6f, 0x99, 0xfe, 0xed, 0xfd, 0xec, 0xe1,
-  0xa4, 0x20, 0xbb, 0x7b, 0xc9, 0xda, 0xc3, 0xd6, 0x9b, 0xfd, 0xbb, 0x93,
-  0x6c, 0x7c, 0xc2, 0xb6, 0xb7, 0x94, 0xb5, 0xd8, 0x39, 0xb3, 0x61, 0xd9,
-  0x7d, 0x95, 0x5f, 0xbd, 0xb3, 0x87, 0x0f, 0x1f, 0x2e, 0xda, 0x95, 0x35,
-  0xc1, 0x8a, 0x84, 0xf8, 0x3c, 0x79, 0x01, 0x02, 0xb0, 0xe4, 0x2f, 0x01,
-  0x00, 0x10, 0x48, 0x46, 0x60, 0xa0, 0xe1, 0x86, 0xd2, 0xd1, 0x30, 0x9d,
-  0x95, 0x95, 0x95, 0xdc, 0xf7, 0x23, 0x92, 0x51, 0xa4, 0xa2, 0xde, 0x0b,
-  0xec, 0x0e, 0xcc, 0xf4, 0xdf, 0x0e, 0x6b, 0x38, 0x8d, 0xb3, 0x5e, 0x9a,
-  0xe0, 0xe3, 0x7f, 0xd8, 0xa6, 0x9e, 0x32, 0x05, 0x64, 0xac, 0x1d, 0xe5,
-  0xae, 0xaf, 0x21, 0x87, 0x9a, 0x68, 0xe3, 0xe5, 0xee, 0xbb, 0x3c, 0x37,
-  0xa5, 0xfc, 0xee, 0x99, 0x0d, 0xcb, 0xec, 0xbf, 0x33, 0xef, 0x91, 0x23,
-  0x47, 0x8a, 0x96, 0x69, 0x60, 0x18, 0xe2, 0xa0, 0xb8, 0xec, 0x87, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x40, 0x24, 0x02, 0x4d, 0xab, 0xc7, 0x40, 0xc3,
-  0x0d, 0x35, 0x4c, 0xc7, 0xa6, 0x9a, 0x2f, 0x3b, 0x4a, 0x87, 0xfc, 0x08,
-  0x78, 0x29, 0xa0, 0x21, 0x67, 0x27, 0x4f, 0x9e, 0xdc, 0xb6, 0x09, 0x17,
-  0xba, 0x43, 0x19, 0xed, 0xf7, 0xc2, 0x97, 0xed, 0x6f, 0xad, 0x2c, 0x5a,
-  0x28, 0x58, 0x43, 0xd7, 0xae, 0x9d, 0x7e, 0x2f, 0x92, 0x2f, 0xa2, 0x0a,
-  0xaa, 0xa1, 0x49, 0x36, 0x9e, 0x2e, 0xd3, 0x6e, 0xd6, 0x73, 0xdf, 0x1d,
-  0xba, 0x5a, 0xe5, 0xb0, 0x69, 0x5d, 0x43, 0x0e, 0x65, 0xd0, 0xf7, 0x2e,
-  0x09, 0x01, 0x04, 0xfa, 0x08, 0xd0, 0x03, 0xc6, 0xa5, 0x81, 0x00, 0x02,
-  0xb1, 0x0a, 0x0c, 0x34, 0xbb, 0xa1, 0x30, 0x86, 0x1d, 0xa6, 0x13, 0x2b,
-  0x28, 0xf5, 0x8a, 0x4f, 0x60, 0xe7, 0xf0, 0x45, 0x4d, 0x2c, 0xe3, 0xc9,
-  0xb4, 0xf9, 0xdf, 0x36, 0x69, 0xcd, 0xb6, 0x48, 0x0f, 0xd9, 0xf3, 0x97,
-  0xdc, 0xa7, 0xec, 0xc7, 0x9f, 0x2d, 0x73, 0x05, 0xba, 0xcc, 0x6c, 0x58,
-  0xe6, 0x78, 0xbd, 0xbc, 0x8e, 0xc3, 0x10, 0x99, 0x0d, 0x71, 0x10, 0x5c,
-  0xf6, 0x49, 0x46, 0x80, 0x00, 0x2c, 0x99, 0xa6, 0xa6, 0xa2, 0x08, 0x24,
-  0x25, 0xa0, 0x27, 0xe9, 0x2d, 0xdb, 0x4a, 0xcd, 0x6e, 0xa8, 0xf7, 0xbc,
-  0x34, 0x4c, 0x47, 0xeb, 0xe0, 0x90, 0x10, 0x48, 0x55, 0x40, 0x37, 0xd8,
-  0xbd, 0xc0, 0xcc, 0x93, 0xa0, 0x2c, 0xe5, 0x80, 0xac, 0x61, 0xd7, 0xe1,
-  0x17, 0x6c, 0xfb, 0x11, 0xd7, 0xeb, 0xb1, 0xec, 0xcc, 0x86, 0xae, 0xc7,
-  0xdd, 0x99, 0xcf, 0x61, 0x18, 0x22, 0x8b, 0x32, 0x0f, 0x02, 0xcb, 0x3e,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x04, 0x28, 0xa0, 0x9b, 0x15, 0xbd,
-  0x1f, 0xe1, 0x32, 0x44, 0xe6, 0x05, 0x79, 0xec, 0xa6, 0xa5, 0xd2, 0x61,
-  0x3a, 0x5e, 0x8e, 0x41, 0xa3, 0x50, 0x08, 0x0c, 0x28, 0xa0, 0xa1, 0xb8,
-  0x9a, 0x89, 0xd1, 0x93, 0xe1, 0x8b, 0x0f, 0xd9, 0xef, 0xb8, 0xd6, 0xbd,
-  0x6a, 0x06, 0xf8, 0x1d, 0x55, 0xa6, 0xc8, 0xf7, 0x58, 0x66, 0xe7, 0x21,
-  0x87, 0x1a, 0x6e, 0xa8, 0x36, 0x1a, 0x47, 0x72, 0x1c, 0x86, 0xa8, 0xef,
-  0x63, 0x12, 0x02, 0x08, 0xec, 0x21, 0x40, 0x0f, 0x18, 0x97, 0x05, 0x02,
-  0x08, 0xc4, 0x22, 0x30, 0xd0, 0x24, 0x1b, 0x5a, 0xd3, 0x4b, 0xbd, 0x5e,
-  0xcd, 0x66, 0xec, 0xf7, 0x72, 0xb1, 0x34, 0x33, 0xf5, 0xf0, 0x45, 0xa0,
-  0xd7, 0x3b, 0xa6, 0xde, 0x32, 0xfd, 0x5c, 0xd3, 0x44, 0x1f, 0x9a, 0x65,
-  0xf1, 0x8b, 0xb6, 0xfd, 0xe9, 0xd5, 0x87, 0x2f, 0x1d, 0x5f, 0x7c, 0x86,
-  0x2c, 0xc7, 0x47, 0x6d, 0xff, 0x7f, 0xe6, 0x7a, 0x0c, 0x5b, 0x9a, 0x20,
-  0x6b, 0xb5, 0x5a, 0x99, 0x7a, 0xa6, 0xc6, 0x91, 0x1c, 0x87, 0x21, 0xea,
-  0x9d, 0xb5, 0x95, 0x71, 0x94, 0x87, 0x73, 0x20, 0x10, 0x9a, 0x00, 0x01,
-  0x58, 0x68, 0x2d, 0x46, 0x79, 0x11, 0x40, 0x60, 0xb7, 0x40, 0xc3, 0xfe,
-  0x47, 0xcb, 0xb6, 0xe9, 0x32, 0x34, 0x0c, 0x37, 0x2c, 0xa3, 0x45, 0x5e,
-  0x04, 0x8a, 0x05, 0xb4, 0xa0, 0x74, 0x2f, 0x28, 0xd3, 0xbf, 0x35, 0x2d,
-  0x24, 0x7d, 0xc9, 0x4a, 0xfa, 0xdf, 0x6d, 0xfb, 0x88, 0x6d, 0x6d, 0xdb,
-  0x42, 0x9b, 0x61, 0x51, 0xef, 0xae, 0x6a, 0xd2, 0xa0, 0xc9, 0x62, 0xf1,
-  0xe7, 0x72, 0xd4, 0x35, 0x4b, 0xab, 0xc3, 0xa2, 0xcc, 0x67, 0xad, 0x78,
-  0xac, 0x09, 0xe6, 0xda, 0x90, 0xe4, 0x43, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x20, 0x10, 0x01, 0xf5, 0x7a, 0xe9, 0x06, 0xab, 0xd4, 0x90, 0x43, 0x86,
-  0x1b, 0x8e, 0x63, 0x90, 0x12, 0xe7, 0x40, 0x60, 0xbb, 0xbb, 0xd8, 0xaf,
-  0x86, 0xab, 0xcd, 0xcc, 0xcc, 0x6c, 0x6b, 0x88, 0x5c, 0xd9, 0xdf, 0xd5,
-  0x0a, 0xf2, 0x6b, 0xb8, 0xa2, 0xbe, 0x27, 0xc6, 0xd3, 0x35, 0x34, 0xdc,
-  0x17, 0xa7, 0xa6, 0x98, 0x7f, 0xaa, 0x4c, 0x9d, 0xc7, 0x35, 0xe4, 0x70,
-  0xaf, 0x6b, 0x59, 0xc3, 0x51, 0x0b, 0xca, 0xaa, 0xe9, 0xe8, 0x49, 0x08,
-  0x20, 0xb0, 0x87, 0x00, 0x3d, 0x60, 0x5c, 0x16, 0x08, 0x20, 0x10, 0xa2,
-  0x40, 0xc3, 0x0a, 0xdd, 0xb2, 0xad, 0x54, 0xaf, 0x17, 0xb3, 0x1b, 0x86,
-  0xd8, 0xd4, 0x94, 0x39, 0x26, 0x81, 0xde, 0x70, 0xc5, 0x9a, 0x86, 0x2d,
-  0xfa, 0xdc, 0x3b, 0xf6, 0x01, 0x6b, 0xe7, 0x7f, 0xe1, 0xda, 0xd6, 0xfa,
-  0x2e, 0x5b, 0x5b, 0x5b, 0x1b, 0xdb, 0x90, 0xc3, 0xbd, 0xca, 0xa5, 0xf3,
-  0x1f, 0x3b, 0x76, 0xac, 0xa8, 0xc8, 0x77, 0x59, 0x06, 0xf5, 0xe8, 0x91,
-  0x10, 0x40, 0x60, 0x87, 0x00, 0x01, 0x18, 0x97, 0x03, 0x02, 0x08, 0x84,
-  0x26, 0x30, 0xd0, 0xbb, 0x5e, 0xb6, 0x16, 0x4e, 0xf7, 0x5d, 0x2f, 0x12,
-  0x02, 0x08, 0xf8, 0x23, 0xa0, 0x77, 0x89, 0x34, 0x5c, 0xb1, 0xb7, 0x8d,
-  0xf9, 0x3d, 0xb2, 0xcf, 0x9a, 0x44, 0xdd, 0xef, 0x8e, 0x69, 0xc8, 0xe1,
-  0x67, 0x6c, 0xbb, 0xd3, 0xb5, 0x55, 0xac, 0x37, 0xb1, 0xfb, 0xbe, 0xd7,
-  0xa1, 0x43, 0xf5, 0x2e, 0x99, 0xa6, 0x21, 0xa7, 0x37, 0xdd, 0x74, 0x53,
-  0x51, 0xb1, 0x79, 0x0f, 0xac, 0x48, 0x88, 0xcf, 0x93, 0x14, 0x20, 0x00,
-  0x4b, 0xb2, 0xd9, 0xa9, 0x34, 0x02, 0x41, 0x0a, 0xe8, 0x6e, 0xa3, 0x65,
-  0xdb, 0x4c, 0x99, 0xd2, 0x6b, 0x92, 0x0d, 0xdd, 0xac, 0xe8, 0x7d, 0x05,
-  0x12, 0x02, 0x08, 0xf8, 0x2d, 0x50, 0x63, 0x40, 0xa6, 0xa9, 0xee, 0xff,
-  0xdc, 0xb6, 0xff, 0x60, 0xdb, 0xb8, 0x7a, 0x6c, 0x34, 0xe4, 0xf0, 0x7e,
-  0xdb, 0x6e, 0x70, 0x6d, 0x15, 0x1b, 0xce, 0xe9, 0xd5, 0x32, 0x19, 0x0e,
-  0xd3, 0xd1, 0xf3, 0x1e, 0x98, 0x6b, 0xe3, 0x92, 0x0f, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0xcf, 0x04, 0xf4, 0x22, 0x77, 0xa9, 0x77, 0xbd, 0xf4,
-  0xbe, 0x89, 0xde, 0x3d, 0x21, 0x21, 0x80, 0x40, 0xb8, 0x02, 0xeb, 0xeb,
-  0xeb, 0x75, 0xbc, 0x43, 0xf6, 0x7d, 0xfb, 0xbe, 0x51, 0xcf, 0xd8, 0x28,
-  0x27, 0x90, 0x78, 0xbf, 0x1d, 0xff, 0x19, 0xdb, 0x8a, 0xde, 0xa3, 0xea,
-  0x7e, 0xae, 0xef, 0x33, 0xbd, 0x4f, 0xe7, 0x5b, 0x72, 0x78, 0x0f, 0xec,
-  0xff, 0x79, 0xf6, 0xb7, 0x84, 0xe2, 0x20, 0xe0, 0x85, 0x00, 0x3d, 0x60,
-  0x5e, 0x34, 0x03, 0x85, 0x40, 0x00, 0x81, 0x3e, 0x02, 0xea, 0xf5, 0x5a,
-  0xb6, 0x6d, 0xa1, 0x8c, 0x10, 0xbd, 0x5e, 0x65, 0xb4, 0xc8, 0x8b, 0x40,
-  0x38, 0x02, 0x7a, 0x77, 0x4c, 0xef, 0x1e, 0x8d, 0x71, 0x96, 0x45, 0x4d,
-  0x73, 0xff, 0x29, 0xdb, 0xfe, 0x8b, 0x6d, 0x5a, 0x63, 0x70, 0xd8, 0x59,
-  0x15, 0xf5, 0x9d, 0xf6, 0x09, 0xdb, 0xde, 0xe2, 0xaa, 0xae, 0xef, 0x33,
-  0xd5, 0xb9, 0xee, 0x21, 0x87, 0x7b, 0x95, 0xd7, 0xf1, 0x3d, 0xb0, 0xc3,
-  0xb6, 0x6f, 0xc7, 0xb5, 0xbe, 0xe4, 0x43, 0x20, 0x05, 0x01, 0x02, 0xb0,
-  0x14, 0x5a, 0x99, 0x3a, 0x22, 0x10, 0xa6, 0x80, 0x66, 0x2d, 0xd3, 0x0d,
-  0x8f, 0xf3, 0x74, 0xcc, 0x4c, 0x2d, 0x1f, 0x66, 0x43, 0x53, 0x6a, 0x04,
-  0x06, 0x11, 0xe8, 0x4d, 0x7b, 0xaf, 0x60, 0x4c, 0x81, 0xc0, 0x98, 0xde,
-  0x1f, 0x6b, 0x5b, 0x59, 0x4f, 0x0f, 0x18, 0x8c, 0x69, 0xc8, 0xa1, 0xbe,
-  0xd3, 0x5e, 0xee, 0x5a, 0x5f, 0xdf, 0xdf, 0x5d, 0x75, 0x7c, 0x0f, 0x4c,
-  0x33, 0x75, 0xa8, 0xde, 0x24, 0x04, 0x10, 0xb8, 0x2a, 0x40, 0x00, 0xc6,
-  0xa5, 0x80, 0x00, 0x02, 0x3e, 0x0a, 0x68, 0xa2, 0x8d, 0x93, 0x65, 0x0a,
-  0x46, 0xaf, 0x57, 0x19, 0x2d, 0xf2, 0x22, 0x10, 0x9f, 0x80, 0xde, 0x1f,
-  0xeb, 0xf5, 0x8e, 0x9d, 0x3d, 0xab, 0x57, 0x8f, 0x46, 0x9e, 0x3e, 0x6f,
-  0x67, 0xf8, 0x03, 0xc7, 0x60, 0x4c, 0x43, 0x0e, 0xb5, 0x1d, 0x70, 0x29,
-  0x95, 0x1e, 0x26, 0xe9, 0xdd, 0xd5, 0xd9, 0xd9, 0x51, 0x8e, 0x82, 0x74,
-  0x29, 0x49, 0x71, 0x1e, 0x87, 0xf5, 0xc0, 0x4e, 0xd8, 0x51, 0x96, 0x8b,
-  0x8f, 0x44, 0x0e, 0x04, 0xd2, 0x11, 0x20, 0x00, 0x4b, 0xa7, 0xad, 0xa9,
-  0x29, 0x02, 0x21, 0x08, 0x68, 0x78, 0x8e, 0x9e, 0x94, 0x3a, 0x4f, 0x2f,
-  0x4f, 0xaf, 0x57, 0x08, 0xcd, 0x4a, 0x19, 0x11, 0x18, 0xbf, 0x40, 0x2f,
-  0x18, 0x1b, 0x53, 0xef, 0x58, 0xc7, 0x6a, 0x78, 0xea, 0xea, 0xf7, 0x97,
-  0x7e, 0xde, 0x99, 0x34, 0x84, 0xf1, 0x67, 0x5d, 0x05, 0xa6, 0xa6, 0xa6,
-  0xba, 0x81, 0x64, 0x28, 0x13, 0x07, 0x29, 0x48, 0x2c, 0x08, 0x78, 0xcf,
-  0x5b, 0xdd, 0x9b, 0xae, 0xf5, 0x27, 0x1f, 0x02, 0x29, 0x08, 0x10, 0x80,
-  0xa5, 0xd0, 0xca, 0xd4, 0x11, 0x81, 0x30, 0x04, 0xf4, 0x07, 0x5a, 0xc1,
-  0xd7, 0x84, 0x6b, 0x71, 0xe9, 0xf5, 0x72, 0x95, 0x22, 0x1f, 0x02, 0x69,
-  0x0b, 0x8c, 0xb9, 0x77, 0xac, 0xd7, 0x33, 0xf6, 0xbf, 0x4c, 0xfd, 0xd3,
-  0xb6, 0xfd, 0x88, 0xab, 0xbe, 0x4d, 0x6a, 0x91, 0xad, 0xac, 0xac, 0xb8,
-  0x66, 0xf7, 0x22, 0x9f, 0x96, 0xf7, 0x38, 0x71, 0x42, 0x9d, 0x5c, 0x7d,
-  0xd3, 0x77, 0xed, 0x93, 0x5b, 0xbd, 0x28, 0x2c, 0x85, 0x40, 0xc0, 0x13,
-  0x01, 0x02, 0x30, 0x4f, 0x1a, 0x82, 0x62, 0x20, 0x90, 0xb8, 0xc0, 0xb2,
-  0xd5, 0x7f, 0xa9, 0x8c, 0x81, 0x6f, 0xd3, 0x31, 0x97, 0x29, 0x3b, 0x79,
-  0x11, 0x40, 0xa0, 0x3e, 0x81, 0xde, 0xbb, 0x63, 0xea, 0x65, 0xd2, 0xb6,
-  0xb5, 0xb5, 0x55, 0x5f, 0x61, 0xae, 0x9e, 0x59, 0x3d, 0xf9, 0x0a, 0xbc,
-  0xe6, 0xe7, 0xe7, 0x6b, 0x2f, 0x4b, 0xd9, 0x02, 0xe8, 0x1d, 0xbc, 0xa3,
-  0x47, 0x8f, 0x16, 0xed, 0xc6, 0xfd, 0x66, 0x91, 0x10, 0x9f, 0x27, 0x25,
-  0xc0, 0x2f, 0x44, 0x52, 0xcd, 0x4d, 0x65, 0x11, 0xf0, 0x4e, 0xa0, 0xf4,
-  0x90, 0x43, 0x0d, 0xcf, 0xd1, 0xbb, 0x11, 0x5a, 0x7f, 0x86, 0x84, 0x00,
-  0x02, 0x08, 0x0c, 0x2b, 0xd0, 0x9b, 0xc4, 0x63, 0x4c, 0x43, 0x15, 0xaf,
-  0x29, 0x6e, 0xe8, 0xdf, 0x69, 0xea, 0x5d, 0x3c, 0x7c, 0x58, 0x13, 0x1d,
-  0xe6, 0x26, 0x45, 0x68, 0xed, 0xa2, 0x4c, 0x7c, 0x8e, 0x40, 0x2a, 0x02,
-  0x04, 0x60, 0xa9, 0xb4, 0x34, 0xf5, 0x44, 0xc0, 0x3f, 0x81, 0xa6, 0x15,
-  0xa9, 0xd4, 0x90, 0x43, 0x0d, 0xcf, 0xd1, 0x70, 0x17, 0x1f, 0xa7, 0x63,
-  0xf6, 0x8f, 0x97, 0x12, 0x21, 0x80, 0x40, 0x59, 0x01, 0x4d, 0x73, 0xaf,
-  0x80, 0x4c, 0x0f, 0x79, 0x36, 0x37, 0x37, 0xcb, 0xee, 0x5e, 0x3a, 0xff,
-  0xdc, 0xdc, 0x5c, 0xb7, 0xe7, 0x2b, 0xf4, 0xef, 0xb4, 0x7d, 0xfb, 0x0a,
-  0x6f, 0x27, 0x99, 0x09, 0xb1, 0xf4, 0xd5, 0xc1, 0x0e, 0x31, 0x0b, 0x14,
-  0xfe, 0xc6, 0xc4, 0x5c, 0x79, 0xea, 0x86, 0x00, 0x02, 0xb5, 0x09, 0x94,
-  0x9a, 0xe5, 0x30, 0xa4, 0x19, 0xc1, 0x6a, 0x13, 0xe5, 0xc4, 0x08, 0x20,
-  0x50, 0xa9, 0x40, 0xef, 0xbd, 0x31, 0xf5, 0x8c, 0x9d, 0x3f, 0xaf, 0x79,
-  0x24, 0xaa, 0x4d, 0xab, 0xab, 0xab, 0x41, 0x0e, 0x39, 0xdc, 0x4b, 0xa1,
-  0xd9, 0x6c, 0x16, 0x19, 0x31, 0x13, 0x62, 0xb5, 0x97, 0x0f, 0x47, 0x0b,
-  0x5c, 0x60, 0x7f, 0xe0, 0xe5, 0xa7, 0xf8, 0x08, 0x20, 0x10, 0x96, 0x40,
-  0x6f, 0xc8, 0xa1, 0xf3, 0x14, 0xf3, 0x9a, 0x68, 0x43, 0x37, 0x42, 0x21,
-  0x4c, 0xc7, 0x1c, 0x56, 0x53, 0x50, 0x5a, 0x04, 0x10, 0xc8, 0x13, 0xd0,
-  0x2c, 0x84, 0x8b, 0x8b, 0x8b, 0xdd, 0x1e, 0xb1, 0x4b, 0x97, 0x2e, 0x65,
-  0x0a, 0x98, 0x66, 0x66, 0x66, 0x86, 0x46, 0x9b, 0x9c, 0x9c, 0xcc, 0xd6,
-  0xd7, 0xd7, 0xa3, 0x09, 0xbe, 0x04, 0xe2, 0xd0, 0x83, 0xa7, 0xef, 0x7e,
-  0x12, 0x02, 0x08, 0x5c, 0x15, 0x20, 0x00, 0xe3, 0x52, 0x40, 0x00, 0x81,
-  0x71, 0x09, 0xe8, 0xa5, 0xad, 0xb6, 0x6d, 0xce, 0x77, 0x30, 0x5a, 0x84,
-  0x54, 0x37, 0x3f, 0x0e, 0x7f, 0xdc, 0xc7, 0x55, 0x07, 0xce, 0x83, 0x00,
-  0x02, 0x09, 0x0a, 0xe8, 0x3b, 0x48, 0x13, 0x64, 0xa8, 0x37, 0x6c, 0x98,
-  0x60, 0x4c, 0x01, 0x9c, 0x86, 0x39, 0xc6, 0xf6, 0x0e, 0xab, 0x43, 0x7d,
-  0x78, 0x69, 0x37, 0xc1, 0xdf, 0x1b, 0xaa, 0xdc, 0x5f, 0x80, 0x00, 0x8c,
-  0xab, 0x03, 0x01, 0x04, 0xc6, 0x21, 0xa0, 0xd5, 0x44, 0x15, 0x7c, 0x4d,
-  0xb9, 0x9c, 0x4c, 0x43, 0x0e, 0xcf, 0x9d, 0x3b, 0xd7, 0x7d, 0xdf, 0x8b,
-  0x84, 0x00, 0x02, 0x08, 0xf8, 0x24, 0x30, 0x68, 0x30, 0xa6, 0x99, 0x5b,
-  0x15, 0xc0, 0x25, 0xfa, 0x40, 0xe9, 0x46, 0x9f, 0xda, 0x90, 0xb2, 0x20,
-  0x50, 0xb7, 0x00, 0xef, 0x80, 0xd5, 0xdd, 0x02, 0x9c, 0x1f, 0x81, 0xf8,
-  0x05, 0x14, 0x45, 0x39, 0x4f, 0x31, 0xaf, 0x21, 0x87, 0x09, 0xdf, 0xa4,
-  0xc4, 0x7f, 0x35, 0x50, 0x43, 0x04, 0x22, 0x15, 0xd0, 0xf4, 0xf6, 0xbd,
-  0xa9, 0xed, 0x77, 0x2e, 0x4c, 0xac, 0x21, 0x87, 0x9a, 0xd4, 0x43, 0xef,
-  0x49, 0xc5, 0x9a, 0x98, 0x8a, 0x3e, 0xd6, 0x96, 0xa5, 0x5e, 0xa3, 0x12,
-  0x20, 0x00, 0x1b, 0x95, 0x2c, 0xc7, 0x45, 0x00, 0x01, 0x8d, 0xf9, 0x6f,
-  0xd9, 0x56, 0x6a, 0xc8, 0x21, 0xbd, 0x5e, 0x5c, 0x38, 0x08, 0x20, 0x10,
-  0xba, 0x80, 0x82, 0x31, 0x0d, 0x35, 0x54, 0x8a, 0x39, 0xf0, 0xea, 0xb5,
-  0x13, 0x01, 0x58, 0xe8, 0x57, 0x2c, 0xe5, 0x1f, 0xb7, 0x00, 0x01, 0xd8,
-  0xb8, 0xc5, 0x39, 0x1f, 0x02, 0x69, 0x08, 0x68, 0xbc, 0xbf, 0x82, 0x2f,
-  0xe7, 0x21, 0x87, 0x7a, 0x72, 0x9c, 0xc2, 0x8d, 0x4a, 0x1a, 0xcd, 0x4f,
-  0x2d, 0x11, 0x40, 0x20, 0x25, 0x01, 0xc7, 0xb5, 0xc0, 0x6e, 0x32, 0x93,
-  0xcb, 0x29, 0xb9, 0x50, 0x57, 0x04, 0xfa, 0x09, 0x10, 0x80, 0x71, 0x6d,
-  0x20, 0x80, 0x40, 0xd5, 0x02, 0x4d, 0x3b, 0xa0, 0xf3, 0xfa, 0x5e, 0x5a,
-  0x84, 0x54, 0xc1, 0x97, 0x66, 0x1c, 0x23, 0x21, 0x80, 0x00, 0x02, 0x08,
-  0x84, 0x29, 0xe0, 0xb0, 0x16, 0x18, 0x8b, 0x31, 0x87, 0xd9, 0xb4, 0x94,
-  0x7a, 0x04, 0x02, 0x4c, 0xc2, 0x31, 0x02, 0x54, 0x0e, 0x89, 0x40, 0xc2,
-  0x02, 0xf3, 0x56, 0xf7, 0x73, 0xb6, 0x4d, 0xb8, 0x18, 0x68, 0x11, 0x52,
-  0x0d, 0x5d, 0x21, 0xf8, 0x72, 0xd1, 0x22, 0x0f, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0xc4, 0x20, 0x70, 0x30, 0x86, 0x4a, 0x50, 0x07, 0x04,
-  0x10, 0xf0, 0x42, 0x60, 0xc5, 0x4a, 0xb1, 0xe0, 0x5a, 0x92, 0x98, 0x16,
-  0x21, 0x75, 0xad, 0x33, 0xf9, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x7a, 0xc0, 0xb8, 0x06, 0x10, 0x40, 0x60, 0x58, 0x81, 0xde,
-  0xe2, 0xca, 0x4e, 0xc1, 0x97, 0xa6, 0x98, 0x8f, 0x6d, 0x11, 0xd2, 0x61,
-  0x01, 0xd9, 0x1f, 0x01, 0x04, 0x10, 0x08, 0x5d, 0x40, 0x33, 0xd8, 0x92,
-  0x10, 0x40, 0xc0, 0x4d, 0x80, 0x1e, 0x30, 0x37, 0x27, 0x72, 0x21, 0x80,
-  0xc0, 0xde, 0x02, 0x0a, 0xbe, 0xda, 0xb6, 0x39, 0x4d, 0xb6, 0xa1, 0xf7,
-  0xbd, 0x58, 0x58, 0x99, 0x4b, 0x09, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x52, 0x16, 0xa0, 0x07, 0x2c, 0xe5, 0xd6, 0xa7, 0xee, 0x08, 0x0c,
-  0x27, 0xa0, 0x99, 0x0e, 0x35, 0xcf, 0xb2, 0x53, 0xf0, 0xd5, 0x7b, 0xdf,
-  0x2b, 0xd1, 0x45, 0x48, 0x87, 0x93, 0x66, 0x6f, 0x04, 0x10, 0x40, 0x20,
-  0x7c, 0x01, 0x3d, 0xb0, 0x23, 0x21, 0x80, 0x80, 0x09, 0x10, 0x80, 0x71,
-  0x19, 0x20, 0x80, 0xc0, 0x20, 0x02, 0x0a, 0xbe, 0xda, 0xb6, 0x4d, 0xba,
-  0xec, 0xbc, 0xb4, 0xb4, 0xd4, 0x5d, 0x88, 0x94, 0xe0, 0xcb, 0x45, 0x8b,
-  0x3c, 0x08, 0x20, 0x80, 0x40, 0x94, 0x02, 0xfa, 0xbb, 0x41, 0x42, 0x00,
-  0x01, 0x13, 0x60, 0x08, 0x22, 0x97, 0x01, 0x02, 0x08, 0x94, 0x15, 0x98,
-  0xb7, 0x1d, 0x56, 0x5d, 0x76, 0xd2, 0xfb, 0x5e, 0x2b, 0x2b, 0x2b, 0xd9,
-  0xfc, 0xbc, 0x76, 0x21, 0x21, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x10, 0x80, 0x71, 0x0d, 0x20, 0x80, 0x40, 0x19, 0x81, 0x52,
-  0xc1, 0x97, 0xde, 0xf7, 0x3a, 0x72, 0x84, 0x87, 0x9e, 0x65, 0x80, 0xc9,
-  0x8b, 0x00, 0x02, 0x08, 0x44, 0x2a, 0xd0, 0x89, 0xb4, 0x5e, 0x54, 0x0b,
-  0x81, 0xd2, 0x02, 0x0c, 0x41, 0x2c, 0x4d, 0xc6, 0x0e, 0x08, 0x24, 0x2b,
-  0xa0, 0x69, 0xe6, 0x9d, 0x7a, 0xbe, 0x34, 0xd9, 0xc6, 0xc6, 0xc6, 0x06,
-  0xc1, 0x57, 0xb2, 0x97, 0x0a, 0x15, 0x47, 0x00, 0x01, 0x04, 0xae, 0x11,
-  0x20, 0x00, 0xe3, 0xa2, 0x40, 0xe0, 0xaa, 0x00, 0x3d, 0x60, 0x5c, 0x0a,
-  0x08, 0x20, 0xe0, 0x22, 0xd0, 0xb2, 0x4c, 0x73, 0x2e, 0x19, 0x35, 0x15,
-  0xf1, 0xda, 0xda, 0x1a, 0xef, 0x7b, 0xb9, 0x60, 0x91, 0x07, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x92, 0x13, 0xa0, 0x07, 0x2c, 0xb9, 0x26,
-  0xa7, 0xc2, 0x08, 0x94, 0x12, 0xd0, 0xac, 0x55, 0xce, 0xc1, 0x17, 0x33,
-  0x1d, 0x96, 0xb2, 0x25, 0x33, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x24, 0x28, 0xb0, 0x2f, 0xc1, 0x3a, 0x53, 0x65, 0x04, 0x10, 0x70, 0x13,
-  0x28, 0xb5, 0xc6, 0x97, 0x66, 0x3a, 0x5c, 0x5e, 0x5e, 0x76, 0x3b, 0x32,
-  0xb9, 0x10, 0x40, 0x00, 0x01, 0x04, 0xa2, 0x12, 0xd8, 0xb7, 0xaf, 0xf0,
-  0x96, 0xf2, 0xa8, 0x55, 0xb8, 0x1d, 0x55, 0xa5, 0xa9, 0x0c, 0x02, 0x03,
-  0x0a, 0x30, 0x04, 0x71, 0x40, 0x38, 0x76, 0x43, 0x20, 0x72, 0x81, 0x52,
-  0xc1, 0xd7, 0xea, 0xea, 0x2a, 0x33, 0x1d, 0x46, 0x7e, 0x41, 0x50, 0x3d,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0xa8, 0x46, 0x80, 0x21, 0x88,
-  0xd5, 0x38, 0x72, 0x14, 0x04, 0x62, 0x12, 0x70, 0x0e, 0xbe, 0x34, 0xcd,
-  0x3c, 0xc1, 0x57, 0x4c, 0x4d, 0x4f, 0x5d, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x60, 0xd4, 0x02, 0x85, 0xfd, 0xc5, 0xa3, 0x2e, 0x00, 0xc7,
-  0x47, 0x00, 0x01, 0xaf, 0x04, 0x4a, 0x05, 0x5f, 0x4c, 0x33, 0xef, 0x55,
-  0xdb, 0x51, 0x18, 0x04, 0x10, 0x40, 0xa0, 0x36, 0x01, 0x87, 0x21, 0x88,
-  0xdc, 0x73, 0xd6, 0xd6, 0x3a, 0x9c, 0xd8, 0x37, 0x01, 0x7a, 0xc0, 0x7c,
-  0x6b, 0x11, 0xca, 0x83, 0x40, 0x7d, 0x02, 0x5a, 0xb0, 0xab, 0x6d, 0xdb,
-  0x54, 0x51, 0x11, 0xd4, 0xf3, 0x45, 0xf0, 0x55, 0xa4, 0xc4, 0xe7, 0x08,
-  0x20, 0x80, 0x40, 0x1a, 0x02, 0x5a, 0x76, 0x84, 0x84, 0x00, 0x02, 0xee,
-  0x02, 0x04, 0x60, 0xee, 0x56, 0xe4, 0x44, 0x20, 0x66, 0x01, 0xe7, 0xe0,
-  0x8b, 0x35, 0xbe, 0x62, 0xbe, 0x0c, 0xa8, 0x1b, 0x02, 0x08, 0x20, 0x50,
-  0x5e, 0xe0, 0xf2, 0xe5, 0xcb, 0xe5, 0x77, 0x62, 0x0f, 0x04, 0x12, 0x16,
-  0x60, 0x12, 0x8e, 0x84, 0x1b, 0x9f, 0xaa, 0x23, 0x70, 0x55, 0xa0, 0x17,
-  0x7c, 0x4d, 0x14, 0x89, 0x28, 0xf8, 0x52, 0xcf, 0xd7, 0xa1, 0x43, 0x1a,
-  0xa9, 0x48, 0x42, 0x00, 0x01, 0x04, 0x10, 0x40, 0xc0, 0x49, 0xe0, 0x71,
-  0xa7, 0x5c, 0x64, 0x42, 0x20, 0x11, 0x01, 0x7a, 0xc0, 0x12, 0x69, 0x68,
-  0xaa, 0x89, 0x40, 0x1f, 0x01, 0x82, 0x2f, 0x2e, 0x0d, 0x04, 0x10, 0x40,
-  0x00, 0x81, 0xa1, 0x04, 0x1c, 0x7a, 0xc0, 0xbe, 0x39, 0xd4, 0x09, 0xd8,
-  0x19, 0x81, 0xc8, 0x04, 0x08, 0xc0, 0x22, 0x6b, 0x50, 0xaa, 0x83, 0x40,
-  0x09, 0x01, 0x82, 0xaf, 0x12, 0x58, 0x64, 0x45, 0x00, 0x01, 0x04, 0x10,
-  0xd8, 0x5b, 0xc0, 0xe1, 0x1d, 0xb0, 0x27, 0xb0, 0x43, 0x00, 0x81, 0xe7,
-  0x05, 0x08, 0xc0, 0xb8, 0x1a, 0x10, 0x48, 0x53, 0xc0, 0x39, 0xf8, 0x9a,
-  0x9e, 0x9e, 0x66, 0xd8, 0x61, 0x9a, 0xd7, 0x08, 0xb5, 0x46, 0x00, 0x01,
-  0x04, 0xaa, 0x12, 0x20, 0x00, 0xab, 0x4a, 0x92, 0xe3, 0x44, 0x21, 0x40,
-  0x00, 0x16, 0x45, 0x33, 0x52, 0x09, 0x04, 0x4a, 0x09, 0x38, 0x07, 0x5f,
-  0x73, 0x73, 0x73, 0x04, 0x5f, 0xa5, 0x68, 0xc9, 0x8c, 0x00, 0x02, 0x08,
-  0x20, 0xb0, 0x87, 0x00, 0xd3, 0x24, 0x72, 0x59, 0x20, 0xb0, 0x43, 0x80,
-  0x00, 0x8c, 0xcb, 0x01, 0x81, 0xb4, 0x04, 0x4a, 0x05, 0x5f, 0xad, 0x56,
-  0x2b, 0x2d, 0x1d, 0x6a, 0x8b, 0x00, 0x02, 0x08, 0x20, 0x50, 0x5a, 0xc0,
-  0x61, 0x08, 0x22, 0xd3, 0x24, 0x96, 0x56, 0x65, 0x87, 0x98, 0x05, 0x08,
-  0xc0, 0x62, 0x6e, 0x5d, 0xea, 0x86, 0xc0, 0x0b, 0x05, 0x34, 0x75, 0xa1,
-  0x22, 0xaa, 0xc2, 0xd9, 0x0e, 0xd5, 0xf3, 0x45, 0xf0, 0xc5, 0xe5, 0x83,
-  0x00, 0x02, 0x08, 0x20, 0xe0, 0x22, 0xe0, 0x30, 0x09, 0x87, 0xcb, 0x61,
-  0xc8, 0x83, 0x40, 0x32, 0x02, 0x04, 0x60, 0xc9, 0x34, 0x35, 0x15, 0x4d,
-  0x5c, 0x40, 0xc1, 0x57, 0xdb, 0xb6, 0xc2, 0x45, 0x96, 0x09, 0xbe, 0x12,
-  0xbf, 0x52, 0xa8, 0x3e, 0x02, 0x08, 0x20, 0x50, 0xbd, 0x00, 0x3d, 0x60,
-  0xd5, 0x9b, 0x72, 0xc4, 0x80, 0x05, 0x08, 0xc0, 0x02, 0x6e, 0x3c, 0x8a,
-  0x8e, 0x80, 0xa3, 0x00, 0xc1, 0x97, 0x23, 0x14, 0xd9, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x46, 0x22, 0xc0, 0x3b, 0x60, 0x23, 0x61, 0xe5, 0xa0, 0xa1,
-  0x0a, 0xec, 0x0b, 0xb5, 0xe0, 0x94, 0x1b, 0x01, 0x04, 0x9c, 0x04, 0x08,
-  0xbe, 0x9c, 0x98, 0xc8, 0x84, 0x00, 0x02, 0x08, 0x20, 0x30, 0xa8, 0xc0,
-  0xbe, 0x7d, 0x85, 0xb7, 0x93, 0x47, 0xed, 0xd8, 0xed, 0x41, 0x8f, 0xcf,
-  0x7e, 0x08, 0xc4, 0x26, 0x40, 0x0f, 0x58, 0x6c, 0x2d, 0x4a, 0x7d, 0x10,
-  0x78, 0xa1, 0xc0, 0x9a, 0xfd, 0x27, 0xc3, 0x0e, 0xb9, 0x2a, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x4f, 0x04, 0x0a, 0x1f, 0x59,
-  0x78, 0x52, 0x4e, 0x8a, 0x81, 0x00, 0x02, 0xe5, 0x05, 0x5a, 0xb6, 0xcb,
-  0x5c, 0xd1, 0x6e, 0x53, 0x53, 0x53, 0x4c, 0x35, 0x5f, 0x84, 0xc4, 0xe7,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x7d, 0x05, 0x1c, 0x7a, 0xc0, 0x0e, 0xdb,
-  0xce, 0x1d, 0x08, 0x11, 0x40, 0xe0, 0x39, 0x01, 0x02, 0x30, 0xae, 0x04,
-  0x04, 0xe2, 0x14, 0x20, 0xf8, 0x8a, 0xb3, 0x5d, 0xa9, 0x15, 0x02, 0x08,
-  0x20, 0xe0, 0x9d, 0x80, 0x43, 0x00, 0xc6, 0xfd, 0xa6, 0x77, 0xad, 0x46,
-  0x81, 0xea, 0x14, 0x60, 0x08, 0x62, 0x9d, 0xfa, 0x9c, 0x1b, 0x81, 0xd1,
-  0x08, 0x2c, 0xdb, 0x61, 0xe9, 0xf9, 0x1a, 0x8d, 0x2d, 0x47, 0x45, 0x00,
-  0x01, 0x04, 0x10, 0xd8, 0x21, 0xe0, 0xb0, 0x06, 0x18, 0x5e, 0x08, 0x20,
-  0xb0, 0x4b, 0x80, 0x00, 0x8c, 0x4b, 0x02, 0x81, 0xb8, 0x04, 0xe6, 0xad,
-  0x3a, 0x4b, 0x45, 0x55, 0x62, 0xd8, 0x61, 0x91, 0x10, 0x9f, 0x23, 0x80,
-  0x00, 0x02, 0x08, 0xb8, 0x08, 0xb0, 0x06, 0x98, 0x8b, 0x12, 0x79, 0x10,
-  0x78, 0xa1, 0x00, 0x01, 0x18, 0x57, 0x04, 0x02, 0xf1, 0x08, 0x28, 0xf8,
-  0x5a, 0x2d, 0xaa, 0xce, 0xe4, 0xe4, 0x24, 0xef, 0x7c, 0x15, 0x21, 0xf1,
-  0x39, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x30, 0x22, 0x01,
-  0x02, 0xb0, 0x11, 0xc1, 0x72, 0x58, 0x04, 0xc6, 0x2c, 0x70, 0xc4, 0xce,
-  0xb7, 0x52, 0x74, 0xce, 0x89, 0x89, 0x89, 0x6c, 0x6d, 0x6d, 0x2d, 0x3b,
-  0x74, 0x48, 0xb3, 0xd3, 0x93, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x18,
-  0xb9, 0xc0, 0xb7, 0x46, 0x7e, 0x06, 0x4e, 0x80, 0x40, 0x60, 0x02, 0x04,
-  0x60, 0x81, 0x35, 0x18, 0xc5, 0x45, 0x60, 0x0f, 0x01, 0x05, 0x5f, 0x6d,
-  0xdb, 0x26, 0xf2, 0x74, 0x14, 0x7c, 0xb5, 0xdb, 0xed, 0xec, 0xc8, 0x11,
-  0x65, 0x27, 0x21, 0x80, 0x00, 0x02, 0x08, 0x20, 0x30, 0x16, 0x81, 0xc7,
-  0xc6, 0x72, 0x16, 0x4e, 0x82, 0x40, 0x40, 0x02, 0x04, 0x60, 0x01, 0x35,
-  0x16, 0x45, 0x45, 0x60, 0x0f, 0x01, 0x75, 0x65, 0xb5, 0x8a, 0x82, 0x2f,
-  0xed, 0x47, 0xf0, 0xc5, 0xf5, 0x83, 0x00, 0x02, 0x08, 0x20, 0x50, 0xb5,
-  0x40, 0xa7, 0xd3, 0xa9, 0xfa, 0x90, 0x1c, 0x0f, 0x81, 0xe8, 0x05, 0x08,
-  0xc0, 0xa2, 0x6f, 0x62, 0x2a, 0x18, 0xb1, 0x80, 0x82, 0xaf, 0xb6, 0x6d,
-  0x85, 0x0b, 0x2d, 0xaf, 0xae, 0xae, 0xd2, 0xf3, 0x15, 0xf1, 0x85, 0x40,
-  0xd5, 0x10, 0x40, 0x00, 0x81, 0xba, 0x04, 0x1c, 0x02, 0xb0, 0xcb, 0x75,
-  0x95, 0x8d, 0xf3, 0x22, 0xe0, 0xab, 0x00, 0x01, 0x98, 0xaf, 0x2d, 0x43,
-  0xb9, 0x10, 0x28, 0x16, 0xd0, 0x3b, 0x5f, 0x4e, 0xc1, 0xd7, 0xfc, 0xfc,
-  0x7c, 0xf1, 0xd1, 0xc8, 0x81, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x30, 0x72, 0x01, 0x02, 0xb0, 0x91, 0x13, 0x73, 0x02, 0x04,
-  0x46, 0x22, 0xb0, 0x6c, 0x47, 0x2d, 0x5c, 0xeb, 0x6b, 0x61, 0x61, 0x21,
-  0x23, 0xf8, 0x1a, 0x89, 0x3f, 0x07, 0x45, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x06, 0x12, 0x20, 0x00, 0x1b, 0x88, 0x8d, 0x9d, 0x10,
-  0xa8, 0x55, 0x40, 0xdd, 0x59, 0x85, 0x6b, 0x7d, 0xcd, 0xcd, 0xcd, 0x65,
-  0x2b, 0x2b, 0x85, 0x13, 0x23, 0xd6, 0x5a, 0x11, 0x4e, 0x8e, 0x00, 0x02,
-  0x08, 0x20, 0x10, 0xbd, 0x00, 0x43, 0x10, 0xa3, 0x6f, 0x62, 0x2a, 0x58,
-  0x56, 0x80, 0x00, 0xac, 0xac, 0x18, 0xf9, 0x11, 0xa8, 0x57, 0x40, 0x53,
-  0x18, 0x16, 0xae, 0xf5, 0xa5, 0x85, 0x96, 0x5b, 0xad, 0x56, 0xbd, 0x25,
-  0xe5, 0xec, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x64, 0xd9, 0x06, 0x08,
-  0x08, 0x20, 0xf0, 0x42, 0x01, 0x02, 0x30, 0xae, 0x08, 0x04, 0xc2, 0x11,
-  0x68, 0x58, 0x51, 0xdb, 0x45, 0xc5, 0x55, 0xf0, 0xa5, 0x19, 0x0f, 0x49,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0xfe, 0x09,
-  0x10, 0x80, 0xf9, 0xd7, 0x26, 0x94, 0x08, 0x81, 0xbd, 0x04, 0x34, 0xe3,
-  0xe1, 0x9a, 0x6d, 0x85, 0x6b, 0x7d, 0xa9, 0xe7, 0x8b, 0x85, 0x96, 0xb9,
-  0x88, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x3f, 0x05,
-  0x08, 0xc0, 0xfc, 0x6c, 0x17, 0x4a, 0x85, 0xc0, 0x6e, 0x01, 0xa7, 0x19,
-  0x0f, 0x59, 0xeb, 0x8b, 0x0b, 0x07, 0x01, 0x04, 0x10, 0x40, 0x60, 0x9c,
-  0x02, 0x1b, 0x1b, 0x8c, 0x30, 0x1c, 0xa7, 0x37, 0xe7, 0x8a, 0x43, 0x80,
-  0x00, 0x2c, 0x8e, 0x76, 0xa4, 0x16, 0x71, 0x0b, 0x2c, 0x5b, 0xf5, 0x0a,
-  0x67, 0x3c, 0x64, 0xad, 0xaf, 0xb8, 0x2f, 0x02, 0x6a, 0x87, 0x00, 0x02,
-  0x08, 0xf8, 0x28, 0x70, 0xf9, 0x32, 0x73, 0x6c, 0xf8, 0xd8, 0x2e, 0x94,
-  0xc9, 0x6f, 0x01, 0x02, 0x30, 0xbf, 0xdb, 0x87, 0xd2, 0x21, 0x30, 0x6b,
-  0x04, 0x85, 0x33, 0x1e, 0x32, 0xdd, 0x3c, 0x17, 0x0a, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x10, 0x86, 0x00, 0x01, 0x58, 0x18, 0xed,
-  0x44, 0x29, 0xd3, 0x14, 0x68, 0x58, 0xb5, 0x5b, 0x45, 0x55, 0x9f, 0x99,
-  0x99, 0x61, 0xba, 0xf9, 0x22, 0x24, 0x3e, 0x47, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x3c, 0x11, 0x20, 0x00, 0xf3, 0xa4, 0x21, 0x28,
-  0x06, 0x02, 0xbb, 0x04, 0x9c, 0x26, 0xdd, 0x60, 0xba, 0x79, 0xae, 0x1b,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x20, 0x2c, 0x01, 0x02,
-  0xb0, 0xb0, 0xda, 0x8b, 0xd2, 0xa6, 0x23, 0x50, 0x38, 0xe9, 0xc6, 0xc4,
-  0xc4, 0x44, 0xb6, 0xb6, 0xb6, 0xc6, 0x8c, 0x87, 0xe9, 0x5c, 0x13, 0xd4,
-  0x14, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x22, 0x10, 0x20, 0x00,
-  0x8b, 0xa0, 0x11, 0xa9, 0x42, 0x74, 0x02, 0x8b, 0x56, 0xa3, 0xc2, 0x49,
-  0x37, 0x14, 0x7c, 0x35, 0x1a, 0x8d, 0xe8, 0x2a, 0x4f, 0x85, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x81, 0x98, 0x05, 0x08, 0xc0, 0x62,
-  0x6e, 0x5d, 0xea, 0x16, 0xa2, 0xc0, 0x11, 0x2b, 0xf4, 0xc9, 0xa2, 0x82,
-  0x9f, 0x3c, 0x79, 0x32, 0x6b, 0x36, 0x9b, 0x45, 0xd9, 0xf8, 0x1c, 0x01,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0xc0, 0x33, 0x01, 0x02,
-  0x30, 0xcf, 0x1a, 0x84, 0xe2, 0x24, 0x2d, 0xd0, 0x7b, 0xef, 0x2b, 0x17,
-  0x61, 0x6e, 0x6e, 0x2e, 0x5b, 0x5c, 0x54, 0x27, 0x19, 0x09, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x20, 0x34, 0x01, 0x02, 0xb0,
-  0xd0, 0x5a, 0x8c, 0xf2, 0xc6, 0x2c, 0xb0, 0x66, 0x95, 0x9b, 0xcc, 0xab,
-  0xa0, 0x26, 0xdd, 0x58, 0x59, 0xd1, 0xeb, 0x61, 0x24, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x81, 0x10, 0x05, 0x08, 0xc0, 0x42,
-  0x6c, 0x35, 0xca, 0x1c, 0xa3, 0xc0, 0xb2, 0x55, 0x6a, 0x3a, 0xaf, 0x62,
-  0x9a, 0x74, 0xa3, 0xd5, 0x6a, 0x31, 0xe9, 0x46, 0x8c, 0xad, 0x4f, 0x9d,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x20, 0x19, 0x01, 0x02, 0xb0,
-  0x64, 0x9a, 0x9a, 0x8a, 0x7a, 0x2c, 0xd0, 0xb4, 0xb2, 0x15, 0x2e, 0xb6,
-  0xac, 0xe0, 0xeb, 0xc8, 0x11, 0xbd, 0x22, 0x46, 0x42, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x08, 0x55, 0x80, 0x00, 0x2c, 0xd4,
-  0x96, 0xa3, 0xdc, 0xb1, 0x08, 0xe8, 0xbd, 0xaf, 0x56, 0x51, 0x65, 0x16,
-  0x16, 0x16, 0xb2, 0xd9, 0xd9, 0xd9, 0xa2, 0x6c, 0x7c, 0x8e, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0xe0, 0xb9, 0x00, 0x01, 0x98,
-  0xe7, 0x0d, 0x44, 0xf1, 0xa2, 0x17, 0x50, 0xf0, 0xc5, 0x7b, 0x5f, 0xd1,
-  0x37, 0x33, 0x15, 0x44, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x9e, 0x13, 0x20, 0x00, 0xe3, 0x4a, 0x40, 0xa0, 0x3e, 0x01, 0x4d, 0x65,
-  0x38, 0x93, 0x77, 0x7a, 0xbd, 0xf7, 0xd5, 0x6e, 0xb7, 0xeb, 0x2b, 0x21,
-  0x67, 0x46, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0xa8,
-  0x54, 0x80, 0x00, 0xac, 0x52, 0x4e, 0x0e, 0x86, 0x80, 0xb3, 0x80, 0xd3,
-  0x7a, 0x5f, 0x5a, 0x6c, 0xf9, 0xd0, 0x21, 0x8d, 0x52, 0x24, 0x21, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0xc4, 0x20, 0x40, 0x00,
-  0x16, 0x43, 0x2b, 0x52, 0x87, 0xd0, 0x04, 0x9c, 0xdf, 0xfb, 0x62, 0xb1,
-  0xe5, 0xd0, 0x9a, 0x96, 0xf2, 0x22, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0xf9, 0x02, 0x04, 0x60, 0x5c, 0x21, 0x08, 0x8c, 0x5f, 0x60,
-  0xd9, 0x4e, 0x39, 0x95, 0x77, 0x5a, 0xd6, 0xfb, 0x1a, 0x7f, 0xa3, 0x70,
-  0x46, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x60, 0x1c, 0x02,
-  0x04, 0x60, 0xe3, 0x50, 0xe6, 0x1c, 0x08, 0x3c, 0x2f, 0xd0, 0xb4, 0x1f,
-  0x17, 0xf2, 0x40, 0xf4, 0xde, 0x97, 0x86, 0x1e, 0x92, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0xe2, 0x13, 0x20, 0x00, 0x8b,
-  0xaf, 0x4d, 0xa9, 0x91, 0xbf, 0x02, 0x1a, 0x7a, 0x58, 0x18, 0x59, 0x69,
-  0xbd, 0xaf, 0x46, 0xa3, 0xe1, 0x6f, 0x2d, 0x28, 0x19, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0xc0, 0xc0, 0x02, 0x04, 0x60, 0x03,
-  0xd3, 0xb1, 0x23, 0x02, 0xa5, 0x05, 0x5a, 0xb6, 0xc7, 0x44, 0xde, 0x5e,
-  0x73, 0x73, 0x73, 0xac, 0xf7, 0x55, 0x9a, 0x95, 0x1d, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x81, 0x70, 0x04, 0x08, 0xc0, 0xc2, 0x69,
-  0x2b, 0x4a, 0x1a, 0xb6, 0xc0, 0xbc, 0x15, 0x3f, 0x77, 0xca, 0xf9, 0xc9,
-  0xc9, 0xc9, 0x6c, 0x65, 0x65, 0x25, 0xec, 0x5a, 0x52, 0x7a, 0x04, 0x10,
-  0x40, 0x00, 0x81, 0xa4, 0x04, 0x98, 0x2c, 0x2a, 0xa9, 0xe6, 0xa6, 0xb2,
-  0x15, 0x09, 0x10, 0x80, 0x55, 0x04, 0xc9, 0x61, 0x10, 0xc8, 0x11, 0x68,
-  0xd8, 0x67, 0x85, 0x91, 0x15, 0x53, 0xce, 0x73, 0x0d, 0x21, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0xf1, 0x0b, 0x10, 0x80, 0xc5, 0xdf,
-  0xc6, 0xd4, 0xb0, 0x7e, 0x81, 0x96, 0x15, 0x21, 0x77, 0xe8, 0xe1, 0xd2,
-  0xd2, 0x52, 0x76, 0xe4, 0x88, 0x96, 0x06, 0x23, 0x21, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x10, 0x95, 0x00, 0x8b, 0x59, 0x46, 0xd5, 0x9c, 0x54, 0xa6,
-  0x0a, 0x01, 0x02, 0xb0, 0x2a, 0x14, 0x39, 0x06, 0x02, 0xfd, 0x05, 0x16,
-  0xed, 0xa3, 0xe9, 0x3c, 0xa0, 0xe9, 0xe9, 0xe9, 0x6c, 0x79, 0x79, 0x19,
-  0x43, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x62, 0x14, 0xe0, 0xe9, 0x62,
-  0x8c, 0xad, 0x4a, 0x9d, 0x86, 0x12, 0x20, 0x00, 0x1b, 0x8a, 0x8f, 0x9d,
-  0x11, 0xc8, 0x15, 0x68, 0xd8, 0xa7, 0xb9, 0x91, 0x95, 0xa6, 0x9c, 0xd7,
-  0xac, 0x87, 0x24, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x81, 0x34, 0x04, 0x08, 0xc0, 0xd2, 0x68, 0x67, 0x6a, 0x59, 0x8f, 0x80,
-  0x22, 0xab, 0xdc, 0xa1, 0x87, 0xea, 0xf9, 0x62, 0xca, 0xf9, 0x7a, 0x1a,
-  0x87, 0xb3, 0x22, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x75,
-  0x08, 0x10, 0x80, 0xd5, 0xa1, 0xce, 0x39, 0x53, 0x10, 0x70, 0x1a, 0x7a,
-  0xb8, 0xb8, 0xa8, 0x6c, 0x24, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x81, 0x54, 0x04, 0x08, 0xc0, 0x52, 0x69, 0x69, 0xea, 0x39,
-  0x4e, 0x81, 0x86, 0x9d, 0x6c, 0x39, 0xef, 0x84, 0x0c, 0x3d, 0x1c, 0x67,
-  0x73, 0x70, 0x2e, 0x04, 0x10, 0x40, 0x00, 0x81, 0x51, 0x09, 0x38, 0x8c,
-  0xe2, 0xd0, 0x7b, 0xd0, 0xf3, 0xa3, 0x3a, 0x3f, 0xc7, 0x45, 0x20, 0x44,
-  0x01, 0x02, 0xb0, 0x10, 0x5b, 0x8d, 0x32, 0xfb, 0x2e, 0xa0, 0x29, 0xe7,
-  0x19, 0x7a, 0xe8, 0x7b, 0x2b, 0x51, 0x3e, 0x04, 0x10, 0x40, 0x00, 0x81,
-  0xa1, 0x05, 0x1c, 0x02, 0x30, 0x9d, 0x63, 0xd5, 0xb6, 0xd6, 0xd0, 0x27,
-  0xe3, 0x00, 0x08, 0x44, 0x22, 0x40, 0x00, 0x16, 0x49, 0x43, 0x52, 0x0d,
-  0x6f, 0x04, 0x66, 0xad, 0x24, 0xb9, 0x0b, 0x2e, 0x6b, 0xd6, 0x43, 0x86,
-  0x1e, 0x7a, 0xd3, 0x5e, 0x14, 0x04, 0x01, 0x04, 0x10, 0x40, 0x60, 0x3c,
-  0x02, 0x73, 0x76, 0x9a, 0x07, 0x6c, 0x63, 0x5a, 0xfa, 0xf1, 0x78, 0x73,
-  0x16, 0x8f, 0x05, 0xf6, 0x79, 0x5c, 0x36, 0x8a, 0x86, 0x40, 0x68, 0x02,
-  0xfa, 0xa3, 0xd2, 0xb1, 0xad, 0x6f, 0xef, 0x97, 0x86, 0x1e, 0x6e, 0x6c,
-  0x6c, 0x30, 0xf1, 0x46, 0x68, 0x2d, 0x4b, 0x79, 0x11, 0x40, 0x00, 0x01,
-  0x04, 0xf6, 0x14, 0xe8, 0x74, 0x3a, 0xd9, 0xe1, 0xc3, 0x87, 0xcb, 0xe8,
-  0x7c, 0xc3, 0x32, 0xff, 0xfc, 0xd5, 0xbf, 0x97, 0x65, 0xf6, 0x23, 0x2f,
-  0x02, 0xd1, 0x08, 0xd0, 0x03, 0x16, 0x4d, 0x53, 0x52, 0x11, 0x0f, 0x04,
-  0x18, 0x7a, 0xe8, 0x41, 0x23, 0x50, 0x04, 0x04, 0x10, 0x40, 0x00, 0x81,
-  0xf1, 0x09, 0x68, 0x08, 0xe2, 0xc2, 0xc2, 0x42, 0x99, 0x13, 0xbe, 0xc6,
-  0x32, 0x7f, 0xd9, 0x36, 0xd6, 0x07, 0x2b, 0xa3, 0x46, 0xde, 0xa8, 0x04,
-  0x0e, 0x44, 0x55, 0x1b, 0x2a, 0x83, 0x40, 0x7d, 0x02, 0xff, 0xc4, 0x4e,
-  0xfd, 0x6f, 0xf3, 0x4e, 0xaf, 0xa1, 0x87, 0x1f, 0xfa, 0xd0, 0x87, 0xea,
-  0x2b, 0x21, 0x67, 0x46, 0x00, 0x01, 0x04, 0x10, 0x40, 0x60, 0x04, 0x02,
-  0x6f, 0x7b, 0xdb, 0xdb, 0xba, 0x47, 0x3d, 0x7f, 0xfe, 0xbc, 0xeb, 0xd1,
-  0xaf, 0xb3, 0x8c, 0x1a, 0x92, 0xf8, 0x15, 0xdb, 0xbe, 0xe6, 0xba, 0x13,
-  0xf9, 0x10, 0x88, 0x45, 0x80, 0x21, 0x88, 0xb1, 0xb4, 0x24, 0xf5, 0xa8,
-  0x53, 0x40, 0x43, 0x0f, 0x1f, 0xb5, 0x4d, 0x7f, 0x50, 0xf6, 0x4c, 0x0c,
-  0x3d, 0xac, 0xb3, 0x79, 0x38, 0x37, 0x02, 0x08, 0x20, 0x80, 0xc0, 0x38,
-  0x04, 0xd6, 0xd6, 0xd6, 0xb2, 0xf9, 0xf9, 0xf9, 0x6c, 0x6b, 0x6b, 0xab,
-  0xcc, 0xe9, 0x8e, 0x5b, 0xe6, 0x56, 0x99, 0x1d, 0xc8, 0x8b, 0x40, 0xe8,
-  0x02, 0x07, 0x43, 0xaf, 0x00, 0xe5, 0x47, 0xc0, 0x03, 0x81, 0xb5, 0xbc,
-  0xe0, 0x4b, 0xe5, 0xd3, 0xa4, 0x1b, 0x8e, 0x33, 0x45, 0x79, 0x50, 0x9d,
-  0x30, 0x8b, 0xf0, 0xf0, 0xc3, 0x0f, 0x77, 0x0b, 0x7e, 0xeb, 0xad, 0xb7,
-  0x66, 0xdf, 0xfb, 0xde, 0xf7, 0xb2, 0x2b, 0x57, 0xae, 0x64, 0x3f, 0xf4,
-  0x43, 0x3f, 0x94, 0x9d, 0x3b, 0x77, 0x2e, 0xfb, 0xf4, 0xa7, 0x3f, 0x9d,
-  0xe9, 0x3d, 0x85, 0xef, 0x7e, 0xf7, 0xbb, 0xd9, 0xe3, 0x8f, 0x3f, 0x9e,
-  0xed, 0xdb, 0xb7, 0x2f, 0x7b, 0xf6, 0xd9, 0x67, 0xb3, 0xed, 0xed, 0xed,
-  0xec, 0xe0, 0xc1, 0x83, 0xdd, 0x9f, 0x9f, 0x7e, 0xfa, 0xe9, 0xec, 0x45,
-  0x2f, 0x7a, 0x51, 0xf7, 0x18, 0x4f, 0x3c, 0xf1, 0x44, 0x76, 0xfd, 0xf5,
-  0xd7, 0x77, 0x7f, 0xd6, 0x71, 0xae, 0xbb, 0xee, 0xba, 0x6c, 0xff, 0xfe,
-  0xfd, 0xd9, 0x33, 0xcf, 0x3c, 0x93, 0xdd, 0x7c, 0xf3, 0xcd, 0xd9, 0x1d,
-  0x77, 0xdc, 0x91, 0xa9, 0x47, 0xf3, 0xdd, 0xef, 0x7e, 0x77, 0x77, 0x7f,
-  0x12, 0x02, 0x08, 0x20, 0x80, 0x40, 0x96, 0xcd, 0xce, 0xce, 0x49, 0xd2,
-  0x1e, 0xc9, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x66, 0xed,
-  0x76, 0xbb, 0xfb, 0xef, 0xc5, 0x8b, 0x17, 0x5d, 0x49, 0x34, 0x43, 0xa2,
-  0x1e, 0x64, 0x6a, 0x18, 0x3f, 0x09, 0x81, 0x24, 0x04, 0xe8, 0x01, 0x4b,
-  0xa2, 0x99, 0xa9, 0xe4, 0x08, 0x05, 0xde, 0x61, 0xc7, 0xfe, 0xf3, 0xbc,
-  0xe3, 0x4f, 0x4d, 0x4d, 0x75, 0x27, 0xde, 0x20, 0x55, 0x2f, 0xf0, 0xa9,
-  0x4f, 0x7d, 0x2a, 0x3b, 0x73, 0xe6, 0x4c, 0xf6, 0xd9, 0xcf, 0x7e, 0x36,
-  0xfb, 0xab, 0xbf, 0xfa, 0xab, 0x6e, 0x20, 0xa5, 0xc0, 0x49, 0x41, 0x93,
-  0x82, 0xa5, 0x03, 0x07, 0x0e, 0x74, 0xff, 0x1d, 0x55, 0x7a, 0xfb, 0xdb,
-  0xdf, 0x9e, 0xfd, 0xca, 0xaf, 0xfc, 0x4a, 0xf7, 0x66, 0x83, 0x84, 0x00,
-  0x02, 0x08, 0x20, 0xf0, 0x9c, 0xc0, 0xe5, 0xcb, 0x97, 0xb3, 0x66, 0xb3,
-  0x99, 0x6d, 0x6e, 0x6e, 0x96, 0x21, 0x39, 0x6d, 0x99, 0xe7, 0xcb, 0xec,
-  0x40, 0x5e, 0x04, 0x42, 0x15, 0xe0, 0x1d, 0xb0, 0x50, 0x5b, 0x8e, 0x72,
-  0xfb, 0x22, 0xf0, 0x79, 0x2b, 0xc8, 0x73, 0x5d, 0x25, 0x7b, 0x24, 0x05,
-  0x03, 0x1f, 0xf9, 0xc8, 0x47, 0xe8, 0xfd, 0xaa, 0xb8, 0xb5, 0xd4, 0x43,
-  0xf5, 0x3b, 0xbf, 0xf3, 0x3b, 0xd9, 0x89, 0x13, 0x27, 0xba, 0x4f, 0x5b,
-  0xd5, 0xe3, 0xd5, 0xeb, 0xd1, 0x7a, 0xea, 0xa9, 0xa7, 0xba, 0x3d, 0x5b,
-  0x4a, 0xbd, 0x7f, 0x2b, 0x3e, 0xfd, 0x0f, 0x0e, 0xf7, 0xcd, 0x6f, 0x7e,
-  0x33, 0xfb, 0xd2, 0x97, 0xbe, 0x94, 0xdd, 0x70, 0xc3, 0x0d, 0xd9, 0x1b,
-  0xdf, 0xf8, 0xc6, 0x51, 0x9d, 0x86, 0xe3, 0x22, 0x80, 0x00, 0x02, 0x41,
-  0x09, 0xe8, 0x6f, 0xdf, 0x3d, 0xf7, 0xdc, 0x93, 0x3d, 0xf2, 0xc8, 0x23,
-  0x65, 0x82, 0x30, 0x4d, 0xca, 0xa1, 0xe9, 0x14, 0x35, 0xaa, 0x84, 0x84,
-  0x40, 0xd4, 0x02, 0x04, 0x60, 0x51, 0x37, 0x2f, 0x95, 0x1b, 0xb1, 0xc0,
-  0xbf, 0xb2, 0xe3, 0x6b, 0x2a, 0xdd, 0xbe, 0xe9, 0xf7, 0x7f, 0xff, 0xf7,
-  0xbb, 0x7f, 0x84, 0x48, 0xd5, 0x09, 0x28, 0xa8, 0xfa, 0xf5, 0x5f, 0xff,
-  0xf5, 0xec, 0xd4, 0xa9, 0x53, 0xd9, 0x63, 0x8f, 0x3d, 0x56, 0xdd, 0x81,
-  0x07, 0x3c, 0xd2, 0xf7, 0xbf, 0xff, 0xfd, 0xec, 0x1b, 0xdf, 0xf8, 0x46,
-  0x76, 0xfb, 0xed, 0xb7, 0x77, 0x37, 0x12, 0x02, 0x08, 0x20, 0x80, 0x80,
-  0x3d, 0x99, 0xb4, 0x20, 0x4c, 0xa3, 0x03, 0xd4, 0x1b, 0xf6, 0xe0, 0x83,
-  0x0f, 0xba, 0x92, 0x28, 0x08, 0x7b, 0xad, 0x6d, 0xf7, 0xb9, 0xee, 0x40,
-  0x3e, 0x04, 0x42, 0x14, 0x60, 0x08, 0x62, 0x88, 0xad, 0x46, 0x99, 0x7d,
-  0x10, 0xd0, 0x78, 0xf5, 0xef, 0xd8, 0xf6, 0x92, 0x7e, 0x85, 0x99, 0x9c,
-  0x9c, 0xec, 0x0e, 0x3d, 0x3c, 0x74, 0x88, 0x35, 0x27, 0xab, 0x6c, 0xb0,
-  0xdf, 0xfd, 0xdd, 0xdf, 0xcd, 0xde, 0xff, 0xfe, 0xf7, 0x57, 0x79, 0xc8,
-  0x4a, 0x8e, 0xf5, 0x8b, 0xbf, 0xf8, 0x8b, 0xd9, 0x7d, 0xf7, 0x71, 0xcf,
-  0x50, 0x09, 0x26, 0x07, 0x41, 0x00, 0x81, 0xa8, 0x04, 0x5a, 0xad, 0x56,
-  0x76, 0xfc, 0xb8, 0xe6, 0xda, 0x70, 0x4e, 0x0f, 0x59, 0xce, 0xbb, 0x6d,
-  0xbb, 0xec, 0xbc, 0x07, 0x19, 0x11, 0x08, 0x48, 0x80, 0x75, 0xc0, 0x02,
-  0x6a, 0x2c, 0x8a, 0xea, 0x95, 0x40, 0x2b, 0x2f, 0xf8, 0x52, 0x49, 0xf5,
-  0x07, 0x87, 0xe0, 0xab, 0xda, 0x36, 0xfb, 0xca, 0x57, 0xbe, 0x92, 0xfd,
-  0xf1, 0x1f, 0xff, 0x71, 0xb5, 0x07, 0xad, 0xe8, 0x68, 0x9f, 0xfc, 0xe4,
-  0x27, 0xb3, 0xfb, 0xef, 0xbf, 0xbf, 0xa2, 0xa3, 0x71, 0x18, 0x04, 0x10,
-  0x40, 0x20, 0x1e, 0x01, 0xcd, 0x8c, 0xb8, 0xba, 0xba, 0x9a, 0x69, 0x46,
-  0x60, 0xc7, 0x74, 0xa7, 0xe5, 0xfb, 0x8c, 0x6d, 0x3c, 0xc1, 0x74, 0x04,
-  0x23, 0x5b, 0x58, 0x02, 0x04, 0x60, 0x61, 0xb5, 0x17, 0xa5, 0xf5, 0x43,
-  0xa0, 0x69, 0xc5, 0x98, 0xc9, 0x2b, 0xca, 0xcc, 0xcc, 0x4c, 0xf7, 0x05,
-  0x64, 0x52, 0xb5, 0x02, 0x1f, 0xff, 0xf8, 0xc7, 0xb3, 0xaf, 0x7d, 0xcd,
-  0xcf, 0x25, 0x63, 0xf4, 0x5e, 0xda, 0x03, 0x0f, 0x3c, 0x50, 0x6d, 0x85,
-  0x39, 0x1a, 0x02, 0x08, 0x20, 0x10, 0x89, 0x80, 0x82, 0x30, 0xbd, 0xb3,
-  0x4b, 0x10, 0x16, 0x49, 0x83, 0x52, 0x8d, 0xa1, 0x04, 0x08, 0xc0, 0x86,
-  0xe2, 0x63, 0xe7, 0x44, 0x05, 0x5a, 0x79, 0xf5, 0xd6, 0x1f, 0x17, 0xf5,
-  0x7e, 0x91, 0xaa, 0x17, 0xf8, 0xfc, 0xe7, 0x35, 0xe7, 0x89, 0xbf, 0x49,
-  0xef, 0x82, 0x91, 0x10, 0x40, 0x00, 0x01, 0x04, 0xf6, 0x16, 0x38, 0x72,
-  0xe4, 0x08, 0x41, 0x18, 0x17, 0x07, 0x02, 0x26, 0x40, 0x00, 0xc6, 0x65,
-  0x80, 0x40, 0x39, 0x81, 0x65, 0xcb, 0x3e, 0x99, 0xb7, 0xcb, 0xf2, 0xf2,
-  0x32, 0x43, 0x0f, 0xcb, 0x99, 0x3a, 0xe7, 0xfe, 0x9b, 0xbf, 0xf9, 0x1b,
-  0xe7, 0xbc, 0x64, 0x44, 0x00, 0x01, 0x04, 0x10, 0xf0, 0x4f, 0xa0, 0x17,
-  0x84, 0x69, 0x89, 0x16, 0xc7, 0xc4, 0x70, 0x44, 0x47, 0x28, 0xb2, 0x85,
-  0x23, 0x40, 0x00, 0x16, 0x4e, 0x5b, 0x51, 0xd2, 0xfa, 0x05, 0x1a, 0x56,
-  0x84, 0xa5, 0xbc, 0x62, 0x68, 0x71, 0x5e, 0x2d, 0xba, 0x4c, 0x1a, 0x8d,
-  0x40, 0x89, 0xa1, 0x2b, 0xa3, 0x29, 0x40, 0xc1, 0x51, 0x5f, 0xf3, 0x9a,
-  0xd7, 0xd4, 0x72, 0x5e, 0x4e, 0x8a, 0x00, 0x02, 0x08, 0x84, 0x24, 0x40,
-  0x10, 0x16, 0x52, 0x6b, 0x51, 0xd6, 0x51, 0x08, 0x1c, 0x1c, 0xc5, 0x41,
-  0x39, 0x26, 0x02, 0x91, 0x0a, 0xb4, 0x8a, 0xea, 0xb5, 0xb2, 0xb2, 0x52,
-  0x94, 0x85, 0xcf, 0x87, 0x10, 0xb8, 0xf3, 0xce, 0x3b, 0xb3, 0xcf, 0x7c,
-  0x46, 0xef, 0x65, 0xfb, 0x97, 0x34, 0xe5, 0xf2, 0xcf, 0xfc, 0xcc, 0xcf,
-  0xf8, 0x57, 0x30, 0x4a, 0x14, 0xac, 0xc0, 0x57, 0xbf, 0xfa, 0xd5, 0x4c,
-  0xdb, 0xe3, 0x8f, 0x3f, 0x9e, 0x5d, 0x77, 0xdd, 0x75, 0xdd, 0x85, 0xc5,
-  0xf5, 0xb3, 0xd6, 0x9d, 0xd3, 0x72, 0x0c, 0x7a, 0xef, 0xf0, 0xc6, 0x1b,
-  0x6f, 0xcc, 0x9e, 0x7c, 0xf2, 0xc9, 0xee, 0x82, 0xe3, 0xca, 0xf3, 0xf4,
-  0xd3, 0x4f, 0x67, 0xfb, 0xf7, 0xef, 0xef, 0xae, 0x8b, 0xb7, 0x6f, 0xdf,
-  0xbe, 0xee, 0xff, 0xdb, 0xbd, 0xff, 0xcd, 0x37, 0xdf, 0x9c, 0xdd, 0x75,
-  0xd7, 0x5d, 0xd9, 0x2b, 0x5e, 0xf1, 0x8a, 0x60, 0x6d, 0x28, 0x78, 0xf8,
-  0x02, 0x9a, 0xa4, 0x4a, 0xef, 0x84, 0x95, 0x58, 0xb0, 0xb9, 0xd7, 0x13,
-  0xc6, 0xec, 0x88, 0xe1, 0x37, 0x7f, 0xf2, 0x35, 0x20, 0x00, 0x4b, 0xfe,
-  0x12, 0x00, 0xc0, 0x51, 0x60, 0xd6, 0xf2, 0x4d, 0xe7, 0xe5, 0x5d, 0x58,
-  0x58, 0xc8, 0xf4, 0x54, 0x8f, 0x34, 0x3a, 0x81, 0xa3, 0x47, 0x8f, 0x66,
-  0x7f, 0xf4, 0x47, 0x7f, 0xd4, 0xbd, 0xc9, 0xf4, 0x2d, 0xbd, 0xe3, 0x1d,
-  0xef, 0xc8, 0xde, 0xf6, 0xb6, 0xb7, 0xf9, 0x56, 0x2c, 0xca, 0x13, 0xa0,
-  0x80, 0x16, 0x6f, 0xff, 0x93, 0x3f, 0xf9, 0x93, 0xec, 0x2f, 0xff, 0xf2,
-  0x2f, 0xbb, 0x6b, 0x28, 0x8d, 0x22, 0xbd, 0xf4, 0xa5, 0x2f, 0xcd, 0x14,
-  0x88, 0xbd, 0xfa, 0xd5, 0xaf, 0xce, 0x6e, 0xb9, 0xe5, 0x96, 0xec, 0x65,
-  0x2f, 0x7b, 0x59, 0xf6, 0x63, 0x3f, 0xf6, 0x63, 0xd9, 0x9b, 0xdf, 0xfc,
-  0xe6, 0xec, 0x2d, 0x6f, 0x79, 0xcb, 0x28, 0x4e, 0xc9, 0x31, 0x11, 0xb8,
-  0x46, 0x80, 0x20, 0x8c, 0x8b, 0x22, 0x55, 0x01, 0xd6, 0x01, 0x4b, 0xb5,
-  0xe5, 0xa9, 0x77, 0x19, 0x01, 0x4d, 0x83, 0xbb, 0x61, 0x5b, 0xdf, 0x77,
-  0xbf, 0x58, 0xf3, 0xab, 0x0c, 0xe7, 0x70, 0x79, 0xb5, 0xde, 0xd6, 0x99,
-  0x33, 0x67, 0x86, 0x3b, 0x48, 0xc5, 0x7b, 0xbf, 0xf6, 0xb5, 0xaf, 0xcd,
-  0xd4, 0xfb, 0x49, 0x00, 0x56, 0x31, 0x6c, 0x62, 0x87, 0x53, 0x4f, 0xd5,
-  0x6f, 0xff, 0xf6, 0x6f, 0x77, 0xa7, 0xeb, 0xfe, 0xfb, 0xbf, 0xff, 0xfb,
-  0x5a, 0x6a, 0xaf, 0x1b, 0xe2, 0xb7, 0xbf, 0xfd, 0xed, 0xd9, 0x2f, 0xff,
-  0xf2, 0x2f, 0x67, 0x6f, 0x7d, 0xeb, 0x5b, 0x6b, 0x29, 0x03, 0x27, 0x4d,
-  0x4f, 0x40, 0x0f, 0x1a, 0x4a, 0xf4, 0x84, 0x09, 0x48, 0xeb, 0x84, 0xbd,
-  0x3e, 0x3d, 0x29, 0x6a, 0x1c, 0x8b, 0xc0, 0x81, 0x58, 0x2a, 0x42, 0x3d,
-  0x10, 0x18, 0xa1, 0xc0, 0xfb, 0xec, 0xd8, 0xb9, 0xd3, 0xce, 0x6b, 0xd6,
-  0x43, 0x7a, 0xbf, 0x46, 0xd8, 0x02, 0x3b, 0x0e, 0xfd, 0xc3, 0x3f, 0xfc,
-  0xc3, 0xd9, 0xe6, 0xe6, 0x66, 0xf6, 0xe8, 0xa3, 0x8f, 0x8e, 0xe7, 0x84,
-  0x05, 0x67, 0xb9, 0xfd, 0xf6, 0xdb, 0xb3, 0xdf, 0xfc, 0xcd, 0xdf, 0xcc,
-  0xde, 0xf5, 0xae, 0x77, 0x79, 0x51, 0x9e, 0x51, 0x14, 0x42, 0xc3, 0x84,
-  0xf4, 0x6e, 0xe3, 0x87, 0x3e, 0xf4, 0xa1, 0xac, 0xd1, 0x68, 0x74, 0x37,
-  0x52, 0xf5, 0x02, 0x32, 0xfe, 0xc0, 0x07, 0x3e, 0x90, 0x5d, 0xb9, 0x72,
-  0xa5, 0xfa, 0x83, 0x3b, 0x1e, 0x51, 0xc3, 0x1a, 0x1f, 0x7a, 0xe8, 0xa1,
-  0xec, 0x0b, 0x5f, 0xf8, 0x42, 0xf6, 0xe2, 0x17, 0xbf, 0x38, 0x7b, 0xe3,
-  0x1b, 0xdf, 0xe8, 0xb8, 0x27, 0xd9, 0x10, 0x18, 0x5c, 0x40, 0x43, 0xb8,
-  0xef, 0xb9, 0xe7, 0x9e, 0xee, 0x5a, 0x8a, 0x8e, 0xdf, 0xed, 0x3f, 0x6a,
-  0x67, 0x7b, 0xad, 0x6d, 0xf7, 0x0d, 0x7e, 0x56, 0xf6, 0x44, 0x00, 0x01,
-  0x04, 0x10, 0xf0, 0x55, 0x40, 0x77, 0x9a, 0xdb, 0x79, 0x9b, 0x4d, 0xbc,
-  0x61, 0xaf, 0x63, 0x90, 0xc6, 0x29, 0xf0, 0xb1, 0x8f, 0x7d, 0x6c, 0xfb,
-  0x27, 0x7e, 0xe2, 0x27, 0x72, 0xdb, 0xa5, 0xa8, 0xdd, 0xaa, 0xf8, 0xdc,
-  0x7a, 0x0a, 0xb6, 0xad, 0x37, 0x6e, 0xe4, 0x55, 0x5f, 0x5f, 0x5f, 0xdf,
-  0x3e, 0x77, 0xee, 0xdc, 0xf6, 0xa5, 0x4b, 0x97, 0x46, 0x7e, 0xae, 0xdd,
-  0x27, 0xb0, 0xde, 0x98, 0x6b, 0x9c, 0xc7, 0x51, 0xe7, 0xb1, 0x57, 0xb4,
-  0xe6, 0x13, 0x9e, 0x3a, 0x75, 0x6a, 0xdb, 0xde, 0xd7, 0xaa, 0xfd, 0x9a,
-  0xde, 0xf9, 0x7b, 0x61, 0x43, 0x12, 0xb7, 0x6d, 0x28, 0x64, 0xcd, 0x32,
-  0x9c, 0x3e, 0x25, 0x01, 0x7d, 0xc7, 0xd9, 0xec, 0x88, 0x65, 0x7e, 0x0f,
-  0x5a, 0xbe, 0xde, 0x3c, 0x50, 0x2e, 0x04, 0xf2, 0x04, 0x18, 0x82, 0xc8,
-  0xf5, 0x81, 0x40, 0xbe, 0x40, 0xdb, 0x3e, 0xce, 0x7d, 0xf7, 0xeb, 0xc2,
-  0x85, 0x0b, 0xf4, 0x08, 0xd4, 0x70, 0x15, 0x3d, 0xf8, 0xe0, 0x83, 0xd9,
-  0x1f, 0xfe, 0xe1, 0x1f, 0x66, 0x9f, 0xf8, 0xc4, 0x27, 0xb2, 0xef, 0x7d,
-  0xef, 0x7b, 0x4e, 0x25, 0xd0, 0x84, 0x04, 0x7a, 0xd2, 0xaa, 0xf7, 0x5d,
-  0xf4, 0xb3, 0x26, 0x32, 0x38, 0x78, 0xf0, 0x60, 0x77, 0xc2, 0x02, 0xbd,
-  0x57, 0xf6, 0xa2, 0x17, 0xbd, 0xa8, 0x7b, 0x1c, 0xf5, 0x02, 0x28, 0x9f,
-  0x92, 0x7a, 0x23, 0x94, 0x57, 0x13, 0x1b, 0x68, 0xa2, 0x03, 0xbd, 0x37,
-  0x73, 0xc7, 0x1d, 0x77, 0x64, 0x9a, 0xf1, 0xf2, 0xdd, 0xef, 0x7e, 0x77,
-  0x77, 0xff, 0x51, 0x25, 0x0d, 0xcb, 0x99, 0x9d, 0x9d, 0xcd, 0xce, 0x9f,
-  0x3f, 0xdf, 0x3d, 0x85, 0x66, 0x81, 0xd4, 0x50, 0x47, 0x2d, 0x68, 0x3a,
-  0x8e, 0xb4, 0xb1, 0xb1, 0xd1, 0x1d, 0x16, 0xb4, 0xb5, 0xb5, 0xf5, 0x82,
-  0xd3, 0x69, 0xc8, 0x6d, 0xa7, 0xd3, 0x19, 0x47, 0x11, 0x92, 0x38, 0xc7,
-  0x63, 0x8f, 0x3d, 0x96, 0xfd, 0xdc, 0xcf, 0xfd, 0x5c, 0xf6, 0xb9, 0xcf,
-  0x7d, 0xce, 0xbb, 0xfa, 0x6a, 0x18, 0xe2, 0x7d, 0xf7, 0xdd, 0x57, 0x66,
-  0xf1, 0x5c, 0xef, 0xea, 0x40, 0x81, 0xc2, 0x12, 0x18, 0x60, 0x38, 0xe2,
-  0x69, 0xab, 0xe1, 0x78, 0xbe, 0x14, 0xc3, 0xa2, 0xa4, 0xb4, 0x1e, 0x0b,
-  0x10, 0x80, 0x79, 0xdc, 0x38, 0x14, 0xad, 0x76, 0x01, 0x4d, 0xbc, 0x91,
-  0xfb, 0xb2, 0xd1, 0xd2, 0xd2, 0x52, 0xa6, 0x75, 0xbf, 0x48, 0xf5, 0x09,
-  0x7c, 0xf1, 0x8b, 0x5f, 0xcc, 0x1e, 0x78, 0xe0, 0x81, 0xec, 0xaf, 0xff,
-  0xfa, 0xaf, 0xbb, 0x81, 0xc2, 0x53, 0x4f, 0x3d, 0xd5, 0x9d, 0x2d, 0x4e,
-  0xb3, 0xc3, 0x29, 0xb0, 0xd2, 0x8c, 0x71, 0xaf, 0x7c, 0xe5, 0x2b, 0xb3,
-  0x57, 0xbd, 0xea, 0x55, 0xd9, 0x4f, 0xff, 0xf4, 0x4f, 0x77, 0x27, 0x1a,
-  0x08, 0x25, 0xe9, 0xda, 0x3a, 0x71, 0xe2, 0xc4, 0x35, 0xc5, 0x1d, 0x47,
-  0xd0, 0xdf, 0x2f, 0xf8, 0xea, 0x15, 0xc6, 0x7a, 0xe4, 0xba, 0xc1, 0x19,
-  0x69, 0x78, 0x01, 0x4d, 0xb8, 0xe1, 0xf3, 0x10, 0xd6, 0x0f, 0x7e, 0xf0,
-  0x83, 0xd9, 0xaf, 0xfe, 0xea, 0xaf, 0x0e, 0x5f, 0x51, 0x8e, 0x80, 0x80,
-  0xa3, 0xc0, 0x00, 0x41, 0xd8, 0xbd, 0x76, 0x68, 0xa6, 0x21, 0x76, 0xf4,
-  0x25, 0x1b, 0x02, 0x08, 0x20, 0xe0, 0xab, 0x80, 0x26, 0xde, 0xe8, 0xd8,
-  0xd6, 0x77, 0x28, 0x84, 0xf5, 0x02, 0xd4, 0x32, 0x24, 0x2c, 0xa5, 0xe1,
-  0x28, 0xa9, 0xd7, 0x55, 0xc3, 0x5b, 0xf7, 0xba, 0x06, 0x2d, 0xf0, 0x1f,
-  0x29, 0x8d, 0x86, 0x18, 0x5a, 0x6f, 0x1b, 0x43, 0x6f, 0x47, 0xaa, 0xfc,
-  0xfc, 0xc1, 0x7f, 0xeb, 0xb7, 0x7e, 0xab, 0xcc, 0x90, 0xab, 0xb1, 0xe7,
-  0xb5, 0xe0, 0x70, 0x4c, 0x12, 0x9c, 0x06, 0x81, 0xe7, 0x05, 0x06, 0x18,
-  0x8e, 0x38, 0xef, 0xeb, 0x0d, 0x05, 0xe5, 0x42, 0x60, 0xb7, 0x00, 0x0b,
-  0x31, 0x73, 0x4d, 0x20, 0xb0, 0xb7, 0x80, 0x56, 0x53, 0xee, 0x3b, 0xeb,
-  0xa1, 0x76, 0xd1, 0x50, 0x30, 0xcd, 0x18, 0x46, 0x42, 0x60, 0xdc, 0x02,
-  0x9a, 0xf4, 0x65, 0x54, 0x49, 0xc7, 0x3e, 0x76, 0xec, 0xd8, 0x35, 0xc3,
-  0x0e, 0x77, 0x9f, 0x4f, 0xc3, 0x22, 0xd7, 0xd6, 0xd6, 0x46, 0x55, 0x8c,
-  0xa4, 0x8e, 0xfb, 0xf0, 0xc3, 0x0f, 0x7b, 0x5d, 0xdf, 0x2f, 0x7f, 0xf9,
-  0xcb, 0x5e, 0x97, 0x8f, 0xc2, 0xc5, 0x29, 0xd0, 0x9b, 0xa2, 0xde, 0xde,
-  0x09, 0x73, 0xad, 0xe0, 0xaa, 0x65, 0xd4, 0xc8, 0x15, 0x12, 0x02, 0xde,
-  0x0b, 0x10, 0x80, 0x79, 0xdf, 0x44, 0x14, 0xb0, 0x06, 0x81, 0x86, 0x9d,
-  0x73, 0x29, 0xef, 0xbc, 0x7a, 0xff, 0x47, 0xef, 0xe6, 0x90, 0x10, 0x18,
-  0xa5, 0x40, 0xbf, 0x21, 0x7e, 0x17, 0x2f, 0x5e, 0xcc, 0xaa, 0x0e, 0xc2,
-  0x34, 0xe4, 0x47, 0xef, 0x96, 0x1d, 0x3f, 0x7e, 0xdc, 0xb9, 0x4a, 0x9a,
-  0xb5, 0x6f, 0x54, 0xeb, 0x54, 0x39, 0x17, 0x22, 0x82, 0x8c, 0xb7, 0xde,
-  0x7a, 0xab, 0xd7, 0xb5, 0xd8, 0xfd, 0x0e, 0xa0, 0xd7, 0x85, 0xa5, 0x70,
-  0x51, 0x09, 0xf4, 0x82, 0x30, 0xbd, 0x77, 0xea, 0x98, 0xfe, 0xb3, 0xe5,
-  0x63, 0x41, 0x4e, 0x47, 0x2c, 0xb2, 0xd5, 0x27, 0x40, 0x00, 0x56, 0x9f,
-  0x3d, 0x67, 0xf6, 0x57, 0xa0, 0x55, 0x54, 0xb4, 0xaa, 0x6f, 0x7e, 0x8b,
-  0xce, 0xc7, 0xe7, 0x69, 0x0a, 0xe4, 0x4d, 0xb6, 0x51, 0x65, 0xf0, 0xa3,
-  0x69, 0xe6, 0xb5, 0x8c, 0xc2, 0xe9, 0xd3, 0x7a, 0x97, 0xdd, 0x3d, 0x29,
-  0x10, 0x1c, 0xd7, 0x84, 0x20, 0xee, 0xa5, 0x0a, 0x2f, 0xa7, 0xef, 0x4b,
-  0x58, 0x84, 0xf4, 0xde, 0x64, 0x78, 0xad, 0x4f, 0x89, 0x8b, 0x04, 0x14,
-  0x84, 0xa9, 0xb7, 0x5d, 0x93, 0x10, 0x39, 0xa4, 0x1b, 0x2c, 0xcf, 0x67,
-  0x6c, 0x6b, 0x38, 0xe4, 0x25, 0x0b, 0x02, 0xb5, 0x09, 0x10, 0x80, 0xd5,
-  0x46, 0xcf, 0x89, 0x3d, 0x15, 0x68, 0x5a, 0xb9, 0x72, 0x67, 0x3d, 0xd4,
-  0xc4, 0x1b, 0xac, 0x83, 0xe4, 0x69, 0xeb, 0x45, 0x56, 0x2c, 0x5d, 0x67,
-  0x33, 0x33, 0x7b, 0x2f, 0x41, 0xa7, 0x5e, 0x89, 0x61, 0x7b, 0x61, 0x35,
-  0x93, 0xa1, 0x02, 0xa8, 0xa3, 0x47, 0x8f, 0x66, 0x0a, 0xa6, 0xf2, 0x52,
-  0xbf, 0x9b, 0x9f, 0xb3, 0x67, 0xcf, 0x12, 0x84, 0x0d, 0x79, 0xdd, 0x69,
-  0xe1, 0xe3, 0x37, 0xbf, 0xf9, 0xcd, 0x43, 0x1e, 0x65, 0x74, 0xbb, 0xff,
-  0xd4, 0x4f, 0xfd, 0xd4, 0xe8, 0x0e, 0xce, 0x91, 0x11, 0x70, 0x10, 0xd0,
-  0x43, 0x0a, 0x3d, 0x28, 0x72, 0x0c, 0xc2, 0x6e, 0xb4, 0x43, 0xfe, 0x99,
-  0x6d, 0xbc, 0x23, 0xe0, 0x60, 0x4b, 0x96, 0x7a, 0x04, 0x08, 0xc0, 0xea,
-  0x71, 0xe7, 0xac, 0xfe, 0x0a, 0xb4, 0xf2, 0x8a, 0xa6, 0x61, 0x10, 0xea,
-  0x79, 0x20, 0x21, 0x30, 0x2e, 0x81, 0xbc, 0xeb, 0x4d, 0xef, 0x61, 0x69,
-  0x98, 0x62, 0xd9, 0x61, 0x80, 0xbd, 0xc0, 0xcb, 0xb5, 0xd7, 0x6b, 0x6e,
-  0x6e, 0xae, 0x7b, 0xf3, 0xd3, 0x2f, 0xa9, 0xe7, 0x6c, 0x94, 0x3d, 0x61,
-  0xea, 0x71, 0x56, 0x3d, 0xb5, 0x69, 0x66, 0xc8, 0xb2, 0xf5, 0x1d, 0x57,
-  0x5b, 0x0d, 0x7a, 0x1e, 0xcd, 0xd8, 0xa9, 0x45, 0x68, 0xb5, 0xdc, 0x81,
-  0x6f, 0x49, 0xc3, 0x23, 0xdf, 0xf9, 0xce, 0x77, 0xfa, 0x56, 0x2c, 0xca,
-  0x93, 0xa0, 0x80, 0xbe, 0xaf, 0x4a, 0xbc, 0x77, 0x7a, 0xa7, 0x11, 0x69,
-  0x38, 0x22, 0x09, 0x01, 0x04, 0x10, 0x40, 0xc0, 0x73, 0x81, 0x65, 0x2b,
-  0x5f, 0xee, 0x0c, 0x63, 0x2c, 0x40, 0xcb, 0x1c, 0x5d, 0x75, 0x08, 0x2c,
-  0x2c, 0x2c, 0xe4, 0x5e, 0x97, 0x9a, 0xb1, 0xf0, 0xe4, 0xc9, 0x93, 0xb9,
-  0xb3, 0x72, 0xda, 0xd4, 0xf5, 0xdb, 0x5a, 0x54, 0xd9, 0x7a, 0xd4, 0x4a,
-  0xcd, 0xa2, 0xb7, 0x73, 0xc6, 0x45, 0xfd, 0x9c, 0xf7, 0x3b, 0x62, 0x81,
-  0x5a, 0xa5, 0x33, 0x83, 0x6a, 0x16, 0xb4, 0xbd, 0xca, 0x1b, 0xeb, 0xe2,
-  0xe7, 0x36, 0xd5, 0x7b, 0xa9, 0xb6, 0x29, 0xfa, 0xbe, 0xaa, 0xe2, 0xf3,
-  0xf7, 0xbe, 0xf7, 0xbd, 0x75, 0x5c, 0xf2, 0x9c, 0x13, 0x81, 0xbe, 0x02,
-  0x7b, 0x2d, 0x0e, 0x9f, 0x73, 0xad, 0xe7, 0x3e, 0x54, 0xf5, 0xfc, 0x9e,
-  0x84, 0xe2, 0x21, 0x80, 0x00, 0x02, 0xd1, 0x0b, 0x68, 0xa8, 0xc2, 0xe5,
-  0xbc, 0x1b, 0x96, 0x58, 0x6f, 0xfa, 0xf8, 0x3b, 0xef, 0xbf, 0x80, 0x02,
-  0x11, 0x2d, 0x7b, 0xe0, 0x72, 0x43, 0x6d, 0x33, 0x86, 0x75, 0x83, 0x16,
-  0x05, 0x4b, 0x0a, 0xdc, 0x74, 0xdd, 0xba, 0xee, 0xbb, 0xf3, 0xf8, 0x0a,
-  0xea, 0xf6, 0x7a, 0xe0, 0x50, 0x54, 0x06, 0x9d, 0xcb, 0xd6, 0x08, 0x1b,
-  0x1a, 0x55, 0x37, 0x59, 0x79, 0xe5, 0x5e, 0x5f, 0x5f, 0x1f, 0xfa, 0x1c,
-  0xbe, 0x1d, 0xc0, 0x16, 0x64, 0xee, 0xb6, 0x99, 0x2d, 0x14, 0xee, 0xd4,
-  0xd6, 0x45, 0x6d, 0x31, 0xec, 0xe7, 0xbf, 0xf4, 0x4b, 0xbf, 0xb4, 0xfd,
-  0x77, 0x7f, 0xf7, 0x77, 0xbe, 0x31, 0x51, 0x1e, 0x04, 0xba, 0x0f, 0x9c,
-  0x4a, 0x5c, 0xdf, 0xf3, 0xd1, 0xdf, 0xc1, 0x50, 0x41, 0x04, 0x10, 0x40,
-  0x20, 0x50, 0x01, 0x3d, 0x25, 0xcb, 0xfd, 0x42, 0x8f, 0xf1, 0x86, 0x8f,
-  0xbf, 0xe3, 0xe1, 0x08, 0xe8, 0xfa, 0x2b, 0x5a, 0x9b, 0xab, 0xe8, 0x1a,
-  0x76, 0xfd, 0x5c, 0x41, 0x9b, 0x7a, 0xcc, 0xf6, 0x4a, 0xae, 0x4f, 0x9f,
-  0x75, 0x8c, 0x41, 0x02, 0x31, 0x1d, 0xbf, 0xdf, 0xfa, 0x67, 0x3b, 0xcb,
-  0x3f, 0xc8, 0xb1, 0x43, 0x69, 0xed, 0x0f, 0x7f, 0xf8, 0xc3, 0xdb, 0xbf,
-  0xf0, 0x0b, 0xbf, 0xb0, 0x6d, 0x93, 0x0f, 0x94, 0xb9, 0xc9, 0xac, 0x2c,
-  0xef, 0xcb, 0x5f, 0xfe, 0xf2, 0xed, 0x5f, 0xfb, 0xb5, 0x5f, 0xdb, 0x7e,
-  0xf4, 0xd1, 0x47, 0x43, 0x21, 0xa3, 0x9c, 0x09, 0x0a, 0xa8, 0xc7, 0xdd,
-  0xf5, 0x3b, 0xcd, 0xf2, 0x31, 0x33, 0x62, 0xa0, 0x37, 0x67, 0xb1, 0x16,
-  0x7b, 0x5f, 0xac, 0x15, 0xa3, 0x5e, 0x08, 0x94, 0x10, 0x68, 0x5a, 0xde,
-  0x73, 0x79, 0xf9, 0xed, 0xa9, 0x74, 0x77, 0xdd, 0x2f, 0x12, 0x02, 0x75,
-  0x0a, 0x6c, 0x6c, 0x6c, 0x74, 0xdf, 0x83, 0x1a, 0xd5, 0xb4, 0xe0, 0x7a,
-  0xc1, 0x5d, 0xd7, 0x79, 0xd1, 0xfb, 0x5c, 0x7a, 0x27, 0xcb, 0x75, 0xba,
-  0x7a, 0xbd, 0x37, 0xa9, 0xc9, 0x42, 0xb4, 0xe9, 0x1d, 0x8e, 0xdd, 0x6b,
-  0xe7, 0xe9, 0x7d, 0x34, 0xd5, 0x4b, 0xef, 0x76, 0x68, 0x73, 0xad, 0x9b,
-  0xf5, 0x0a, 0x46, 0xbf, 0x0e, 0xdf, 0x57, 0xbf, 0xfa, 0xd5, 0x4c, 0xdb,
-  0xe3, 0x8f, 0x3f, 0xde, 0x7d, 0x3f, 0xec, 0xc0, 0x81, 0x03, 0xdd, 0x9f,
-  0x6f, 0xb8, 0xe1, 0x86, 0xcc, 0xee, 0xb7, 0xb3, 0x27, 0x9e, 0x78, 0x22,
-  0xd3, 0xfb, 0x63, 0x4f, 0x3e, 0xf9, 0x64, 0xf6, 0xcc, 0x33, 0xcf, 0x74,
-  0xf3, 0x3c, 0xfd, 0xf4, 0xd3, 0xd9, 0xfe, 0xfd, 0xfb, 0xb3, 0x67, 0x9f,
-  0x7d, 0x36, 0xdb, 0xb7, 0x6f, 0x5f, 0xf7, 0xff, 0xf5, 0xf6, 0xb7, 0x20,
-  0x3e, 0xfb, 0xdc, 0xe7, 0x3e, 0xd7, 0x9d, 0x70, 0xe5, 0x3b, 0xdf, 0xf9,
-  0x4e, 0x37, 0xdf, 0x8b, 0x5f, 0xfc, 0xe2, 0xec, 0xca, 0x95, 0x2b, 0xdd,
-  0xfc, 0xaf, 0x7b, 0xdd, 0xeb, 0xb2, 0x37, 0xbd, 0xe9, 0x4d, 0xdd, 0x89,
-  0x5f, 0xfa, 0x4d, 0xfe, 0x52, 0xe7, 0xf5, 0xcf, 0xb9, 0x11, 0xd8, 0x2d,
-  0xa0, 0xef, 0x15, 0x4d, 0x04, 0xe4, 0x90, 0x1e, 0xb3, 0x3c, 0xaf, 0xb7,
-  0xad, 0xe3, 0x90, 0x97, 0x2c, 0x08, 0x8c, 0x5c, 0x80, 0x00, 0x6c, 0xe4,
-  0xc4, 0x9c, 0x20, 0x00, 0x81, 0xb6, 0x95, 0xb1, 0xef, 0xcc, 0x87, 0xba,
-  0x29, 0xd5, 0x4d, 0x22, 0x8b, 0x2e, 0x07, 0xd0, 0x92, 0x09, 0x14, 0x71,
-  0x14, 0x41, 0x98, 0xae, 0x71, 0x4d, 0xf6, 0xa1, 0xcd, 0xf5, 0x3a, 0x2f,
-  0x13, 0x84, 0x55, 0xdd, 0x2c, 0xd6, 0x4b, 0x56, 0x18, 0x24, 0x56, 0x7d,
-  0xce, 0xd8, 0x8e, 0xa7, 0x00, 0xec, 0xe0, 0xc1, 0x83, 0xd9, 0x2d, 0xb7,
-  0xdc, 0x92, 0x3d, 0xf2, 0xc8, 0x23, 0xdd, 0xc0, 0xed, 0xb6, 0xdb, 0x6e,
-  0x8b, 0xad, 0x9a, 0xd4, 0x27, 0x72, 0x01, 0x4d, 0xc8, 0xa3, 0x87, 0x52,
-  0x9b, 0x9b, 0x9b, 0x2e, 0x35, 0x7d, 0xc8, 0x32, 0xdd, 0x6d, 0x9b, 0x5e,
-  0x37, 0x20, 0x21, 0x50, 0xab, 0x00, 0x01, 0x58, 0xad, 0xfc, 0x9c, 0xdc,
-  0x03, 0x81, 0x79, 0x2b, 0xc3, 0x6a, 0x5e, 0x39, 0x6c, 0xac, 0x39, 0x33,
-  0x1f, 0x7a, 0xd0, 0x50, 0x14, 0xe1, 0x79, 0x01, 0xdd, 0x74, 0x28, 0x58,
-  0x2a, 0xbb, 0x6e, 0xd7, 0x6e, 0x43, 0xf5, 0x4e, 0xa9, 0xb7, 0xab, 0x4c,
-  0xe0, 0xb5, 0xf3, 0x18, 0x9a, 0x19, 0x51, 0x4f, 0xa0, 0x5d, 0x7b, 0xad,
-  0x86, 0x6d, 0x43, 0x05, 0x8a, 0xea, 0x25, 0xeb, 0xb7, 0x40, 0xf5, 0xb0,
-  0xc7, 0x67, 0x7f, 0x04, 0x10, 0x08, 0x4f, 0x40, 0x0f, 0x48, 0xd5, 0xbb,
-  0xee, 0xf8, 0x3d, 0xa4, 0xc5, 0x0e, 0xf5, 0x77, 0x9f, 0x84, 0x40, 0xad,
-  0x02, 0x04, 0x60, 0xb5, 0xf2, 0x73, 0xf2, 0x9a, 0x05, 0x34, 0xf1, 0xc6,
-  0x86, 0x6d, 0x93, 0xfd, 0xca, 0x61, 0x13, 0x1a, 0x74, 0x87, 0x47, 0x91,
-  0x10, 0xf0, 0x51, 0x40, 0x37, 0x1e, 0x9a, 0x96, 0xbd, 0xcc, 0xd0, 0x3d,
-  0x05, 0x5d, 0x0a, 0x60, 0x7a, 0xc3, 0x02, 0x87, 0xad, 0x97, 0x82, 0x41,
-  0x1d, 0x4b, 0x53, 0xe2, 0x8f, 0x32, 0x69, 0x48, 0x9c, 0x7a, 0xdd, 0x5c,
-  0x7b, 0xe8, 0x46, 0x59, 0x16, 0x8e, 0x8d, 0x00, 0x02, 0x7e, 0x09, 0xe8,
-  0xef, 0xf4, 0x5d, 0x77, 0xdd, 0xe5, 0x5a, 0xa8, 0xe3, 0x96, 0xb1, 0xe5,
-  0x9a, 0x99, 0x7c, 0x08, 0x8c, 0x42, 0x80, 0x00, 0x6c, 0x14, 0xaa, 0x1c,
-  0x33, 0x14, 0x81, 0x65, 0x2b, 0xe8, 0x52, 0x5e, 0x61, 0xed, 0x45, 0x7f,
-  0x9e, 0xb6, 0x87, 0xd2, 0x9a, 0x89, 0x97, 0x53, 0x37, 0x20, 0xea, 0x91,
-  0x52, 0x40, 0xa4, 0x9f, 0x7b, 0x6b, 0x65, 0xf5, 0x7a, 0x8b, 0xf4, 0x84,
-  0x58, 0xdb, 0xa8, 0x16, 0x11, 0x57, 0x10, 0xa8, 0x9e, 0xb4, 0xa2, 0x05,
-  0x9d, 0xcb, 0x36, 0x93, 0x4d, 0xc8, 0xd1, 0x0d, 0x32, 0xe9, 0xf5, 0x2a,
-  0x2b, 0x47, 0x7e, 0x04, 0xd2, 0x12, 0x28, 0x39, 0x2c, 0x5a, 0xd1, 0x1a,
-  0x4f, 0x57, 0xd3, 0xba, 0x44, 0xbc, 0xaa, 0x2d, 0x01, 0x98, 0x57, 0xcd,
-  0x41, 0x61, 0xc6, 0x28, 0xa0, 0xde, 0xaf, 0x8e, 0x6d, 0x13, 0xfd, 0xce,
-  0xa9, 0x27, 0xee, 0x25, 0x16, 0x7d, 0x1c, 0x63, 0xd1, 0x39, 0x15, 0x02,
-  0xfe, 0x0a, 0xe8, 0x26, 0x48, 0x13, 0x79, 0x38, 0xbe, 0x93, 0xd1, 0xb7,
-  0x22, 0xfa, 0xfd, 0x53, 0x40, 0x47, 0xe0, 0xe5, 0x6f, 0x5b, 0x53, 0x32,
-  0x04, 0x7c, 0x13, 0xd0, 0x77, 0xc6, 0xa9, 0x53, 0xa7, 0x5c, 0x8a, 0xf5,
-  0x5d, 0xcb, 0x74, 0x87, 0x6d, 0xbc, 0x0f, 0xe6, 0xa2, 0x45, 0x9e, 0xca,
-  0x05, 0x08, 0xc0, 0x2a, 0x27, 0xe5, 0x80, 0x81, 0x08, 0xb4, 0xac, 0x9c,
-  0x73, 0x79, 0x65, 0xb5, 0x69, 0xb8, 0x47, 0xd6, 0x5b, 0x10, 0x88, 0x11,
-  0xc5, 0x44, 0x60, 0x60, 0x01, 0x0d, 0x8f, 0xec, 0xcd, 0x6c, 0xe8, 0x32,
-  0x3c, 0x51, 0x43, 0x23, 0xd5, 0x43, 0xd7, 0x1b, 0x1a, 0xc9, 0x50, 0xc3,
-  0x81, 0xe9, 0xd9, 0x11, 0x81, 0xa4, 0x05, 0xf4, 0xd0, 0xc6, 0xe5, 0x3b,
-  0xc7, 0x90, 0x3e, 0x69, 0xdb, 0x3f, 0x4e, 0x1a, 0x8b, 0xca, 0xd7, 0x26,
-  0x40, 0x00, 0x56, 0x1b, 0x3d, 0x27, 0xae, 0x51, 0x40, 0xeb, 0x81, 0xac,
-  0xe7, 0x9d, 0xdf, 0x16, 0xb1, 0xed, 0x0e, 0x7b, 0x22, 0x21, 0x80, 0x40,
-  0x35, 0x02, 0x0a, 0xc8, 0xb4, 0xed, 0x95, 0xf6, 0x9a, 0x9e, 0xbe, 0x9a,
-  0xb3, 0x72, 0x14, 0x04, 0x10, 0x48, 0x4d, 0x40, 0xc3, 0xaf, 0xf5, 0x9d,
-  0xe2, 0x38, 0x1c, 0xfa, 0x5e, 0xf3, 0x61, 0x8d, 0x99, 0xd4, 0x2e, 0x12,
-  0x0f, 0xea, 0x4b, 0x00, 0xe6, 0x41, 0x23, 0x50, 0x84, 0xb1, 0x0b, 0xb4,
-  0xed, 0x8c, 0x4c, 0x3b, 0x3f, 0x76, 0x76, 0x4e, 0x88, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0xc0, 0xe8, 0x05, 0x4a, 0x4e, 0xca, 0xc1, 0xfb, 0x60, 0xa3,
-  0x6f, 0x12, 0xce, 0xb0, 0x4b, 0x60, 0x3f, 0x22, 0x08, 0x24, 0x26, 0xd0,
-  0xcc, 0x0b, 0xbe, 0x64, 0xa1, 0xf7, 0x57, 0x18, 0xfe, 0x94, 0xd8, 0x55,
-  0x41, 0x75, 0x11, 0x40, 0x00, 0x01, 0x04, 0xa2, 0x11, 0x50, 0x0f, 0x98,
-  0xd6, 0x0b, 0x74, 0x4c, 0x9f, 0xb0, 0x7c, 0x7a, 0x2f, 0x9c, 0x84, 0xc0,
-  0xd8, 0x04, 0xe8, 0x01, 0x1b, 0x1b, 0x35, 0x27, 0xf2, 0x44, 0xa0, 0x63,
-  0xe5, 0xe8, 0x3b, 0xed, 0xbc, 0xde, 0x43, 0xe9, 0x37, 0x4c, 0xca, 0x93,
-  0xf2, 0x53, 0x0c, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x70, 0x10,
-  0xd0, 0x3a, 0x87, 0x8e, 0xeb, 0x25, 0x9e, 0xb5, 0xc3, 0xcd, 0x3a, 0x1c,
-  0x92, 0x2c, 0x08, 0x54, 0x22, 0x40, 0x0f, 0x58, 0x25, 0x8c, 0x1c, 0x24,
-  0x10, 0x81, 0xf9, 0xbc, 0xe0, 0x4b, 0x75, 0xd0, 0x0c, 0x6e, 0x24, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x08, 0x5f, 0x40, 0x23, 0x5a, 0xb4,
-  0x9e, 0xa7, 0x43, 0x9a, 0xb1, 0x3c, 0xba, 0x47, 0x20, 0x21, 0x30, 0x16,
-  0x01, 0x7a, 0xc0, 0xc6, 0xc2, 0xcc, 0x49, 0x3c, 0x10, 0x28, 0x9c, 0x76,
-  0x5e, 0xeb, 0x0d, 0x69, 0x1d, 0x25, 0x12, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0xc4, 0x21, 0xa0, 0xf7, 0xc1, 0x34, 0x33, 0xe2, 0xd6, 0xd6,
-  0x56, 0x51, 0x85, 0x1e, 0xb7, 0x0c, 0x77, 0xda, 0xd6, 0x29, 0xca, 0xc8,
-  0xe7, 0x08, 0x0c, 0x2b, 0x40, 0x0f, 0xd8, 0xb0, 0x82, 0xec, 0x1f, 0x8a,
-  0xc0, 0xa2, 0x15, 0xb4, 0xef, 0x9a, 0x5f, 0xaa, 0x04, 0xbd, 0x5f, 0xa1,
-  0x34, 0x25, 0xe5, 0x44, 0x00, 0x01, 0x04, 0x10, 0x40, 0xc0, 0x4d, 0x40,
-  0xef, 0x83, 0xa9, 0x27, 0xcc, 0x21, 0xbd, 0xc4, 0xf2, 0xfc, 0x99, 0x43,
-  0x3e, 0xb2, 0x20, 0x30, 0xb4, 0xc0, 0x81, 0xa1, 0x8f, 0xc0, 0x01, 0x10,
-  0xf0, 0x5f, 0xa0, 0xa1, 0xf8, 0xca, 0xb6, 0xeb, 0xfb, 0x15, 0x75, 0x6e,
-  0x6e, 0x2e, 0xd3, 0x58, 0x71, 0x12, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0xc4, 0x25, 0xa0, 0x20, 0x4c, 0x3d, 0x61, 0x5f, 0xff, 0xfa, 0xd7,
-  0x8b, 0x2a, 0xf6, 0xa3, 0x96, 0x41, 0xa3, 0xc3, 0xda, 0x45, 0x19, 0xf9,
-  0x1c, 0x81, 0x61, 0x04, 0x18, 0x82, 0x38, 0x8c, 0x1e, 0xfb, 0x86, 0x22,
-  0xa0, 0xe0, 0xab, 0xef, 0xa2, 0xcb, 0x13, 0x13, 0x13, 0xdd, 0x89, 0x37,
-  0x98, 0xf9, 0x30, 0x94, 0xe6, 0xa4, 0x9c, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x94, 0x13, 0x28, 0xb9, 0x3e, 0x18, 0x53, 0xd3, 0x97, 0xe3, 0x25,
-  0x77, 0x49, 0x01, 0x86, 0x20, 0x96, 0x04, 0x23, 0x7b, 0x70, 0x02, 0x8d,
-  0xbc, 0xe0, 0x4b, 0xb5, 0x59, 0x5c, 0x5c, 0x24, 0xf8, 0x0a, 0xae, 0x59,
-  0x29, 0x30, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0xee, 0x02, 0x7a, 0xc8,
-  0x5a, 0xe2, 0x55, 0x83, 0x0f, 0xbb, 0x1f, 0x99, 0x9c, 0x08, 0x94, 0x17,
-  0x60, 0x08, 0x62, 0x79, 0x33, 0xf6, 0x08, 0x4b, 0x60, 0xcd, 0x8a, 0xab,
-  0x20, 0x6c, 0xcf, 0xa4, 0x69, 0xe7, 0xf5, 0x85, 0x7c, 0xfd, 0xf5, 0x7d,
-  0x47, 0x27, 0x86, 0x55, 0x5b, 0x4a, 0x8b, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x7b, 0x0a, 0x34, 0x1a, 0xcf, 0xdd, 0x0e, 0x9c, 0x3f, 0x7f,
-  0xbe, 0x48, 0x88, 0xa1, 0x88, 0x45, 0x42, 0x7c, 0x3e, 0x94, 0x00, 0x43,
-  0x10, 0x87, 0xe2, 0x63, 0x67, 0xcf, 0x05, 0x9a, 0x56, 0xbe, 0x73, 0x79,
-  0x65, 0xd4, 0x42, 0x8d, 0xbc, 0xfb, 0xe5, 0x79, 0x2b, 0x52, 0x3c, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x2a, 0x14, 0xd0, 0x3b, 0x61, 0x9b, 0x9b,
-  0x9b, 0x2e, 0x47, 0x64, 0x28, 0xa2, 0x8b, 0x12, 0x79, 0x4a, 0x0b, 0x10,
-  0x80, 0x95, 0x26, 0x63, 0x87, 0x80, 0x04, 0xda, 0x56, 0xd6, 0xe9, 0x7e,
-  0xe5, 0x65, 0xd1, 0xe5, 0x80, 0x5a, 0x92, 0xa2, 0x22, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x50, 0x91, 0x40, 0x89, 0xa9, 0xe9, 0x1f, 0xb2, 0x53, 0xbe,
-  0xbe, 0xa2, 0xd3, 0x72, 0x18, 0x04, 0x7e, 0x20, 0xc0, 0x10, 0x44, 0x2e,
-  0x86, 0x58, 0x05, 0xb4, 0xa2, 0xfd, 0xbf, 0xcc, 0xab, 0xdc, 0xda, 0xda,
-  0x5a, 0xd6, 0x1b, 0x8e, 0x10, 0x2b, 0x02, 0xf5, 0x42, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x81, 0x17, 0x0a, 0xdc, 0x72, 0xcb, 0x2d, 0xdd, 0x57,
-  0x0f, 0xfe, 0xe2, 0x2f, 0xfe, 0xa2, 0x88, 0x86, 0xa1, 0x88, 0x45, 0x42,
-  0x7c, 0x3e, 0x90, 0x00, 0x3d, 0x60, 0x03, 0xb1, 0xb1, 0x53, 0x00, 0x02,
-  0x1d, 0x2b, 0xe3, 0x64, 0xbf, 0x72, 0xb2, 0xe8, 0x72, 0x00, 0x2d, 0x48,
-  0x11, 0x11, 0x40, 0x00, 0x01, 0x04, 0x10, 0x18, 0xa1, 0x80, 0x16, 0x68,
-  0x76, 0x78, 0x1f, 0x4c, 0x25, 0x38, 0x6c, 0x9b, 0xee, 0x2b, 0x48, 0x08,
-  0x54, 0x22, 0xc0, 0x2c, 0x88, 0x95, 0x30, 0x72, 0x10, 0xcf, 0x04, 0xe6,
-  0xf3, 0x82, 0x2f, 0x95, 0x75, 0x79, 0x79, 0xd9, 0xb3, 0x22, 0x53, 0x1c,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x18, 0xa7, 0x80, 0x26, 0xe1,
-  0xd2, 0x52, 0x34, 0x0e, 0xe9, 0x23, 0x0e, 0x79, 0xc8, 0x82, 0x80, 0xb3,
-  0x00, 0x43, 0x10, 0x9d, 0xa9, 0xc8, 0x18, 0x90, 0x80, 0x66, 0x3e, 0x3c,
-  0xd4, 0xaf, 0xbc, 0x33, 0x33, 0x33, 0xd9, 0xfb, 0xde, 0xf7, 0xbe, 0x80,
-  0xaa, 0x43, 0x51, 0x11, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0xa0, 0x6a,
-  0x01, 0x4d, 0x4d, 0xef, 0x38, 0x14, 0xf1, 0xd5, 0x76, 0xee, 0x8b, 0xb6,
-  0x6d, 0x54, 0x5d, 0x06, 0x8e, 0x97, 0xa6, 0x00, 0x43, 0x10, 0xd3, 0x6c,
-  0xf7, 0x98, 0x6b, 0xbd, 0x6c, 0x95, 0x5b, 0xca, 0xab, 0xe0, 0x85, 0x0b,
-  0x17, 0x78, 0xf7, 0x2b, 0xe6, 0x2b, 0x80, 0xba, 0x21, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x50, 0x42, 0xc0, 0x71, 0x56, 0xc4, 0xc7, 0xec, 0x90, 0xaf,
-  0xb2, 0xed, 0x72, 0x89, 0x43, 0x93, 0x15, 0x81, 0x3d, 0x05, 0x18, 0x82,
-  0xc8, 0x85, 0x11, 0x93, 0x80, 0x7a, 0xbd, 0x16, 0xf3, 0x2a, 0x34, 0x37,
-  0x37, 0x47, 0xf0, 0x15, 0x53, 0x8b, 0x53, 0x17, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x86, 0x14, 0x70, 0x5c, 0xa0, 0xf9, 0x46, 0x3b, 0xcd, 0xca,
-  0x90, 0xa7, 0x62, 0x77, 0x04, 0xba, 0x02, 0x0c, 0x41, 0xe4, 0x42, 0x88,
-  0x49, 0x40, 0xe3, 0x0a, 0x7f, 0x3e, 0xaf, 0x42, 0x9a, 0xf9, 0x50, 0x43,
-  0x0e, 0x48, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x80, 0x04,
-  0x34, 0x2b, 0xa2, 0x92, 0xc3, 0x84, 0x1c, 0x47, 0x94, 0xcd, 0xb6, 0x0e,
-  0x72, 0x08, 0x0c, 0x23, 0x40, 0x0f, 0xd8, 0x30, 0x7a, 0xec, 0xeb, 0x93,
-  0x40, 0x61, 0xef, 0xd7, 0xc2, 0xc2, 0x02, 0xbd, 0x5f, 0x3e, 0xb5, 0x18,
-  0x65, 0x41, 0x00, 0x01, 0x04, 0x10, 0x40, 0xc0, 0x13, 0x81, 0xc5, 0xc5,
-  0xc5, 0x4c, 0xeb, 0x83, 0x3a, 0xa4, 0x7f, 0xef, 0x90, 0x87, 0x2c, 0x08,
-  0xe4, 0x0a, 0xf0, 0x0e, 0x18, 0x17, 0x48, 0x2c, 0x02, 0xcb, 0x56, 0x91,
-  0xbe, 0xef, 0x7e, 0x69, 0x96, 0xa3, 0x4e, 0xa7, 0x43, 0xef, 0x57, 0x2c,
-  0xad, 0x4d, 0x3d, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0xa8, 0x58, 0xa0,
-  0xdd, 0x6e, 0x67, 0x47, 0x8f, 0x1e, 0x75, 0x39, 0xea, 0x71, 0xcb, 0xd4,
-  0x72, 0xc9, 0x48, 0x1e, 0x04, 0xf6, 0x12, 0xa0, 0x07, 0x8c, 0xeb, 0x22,
-  0x06, 0x81, 0xc2, 0xde, 0x2f, 0x3d, 0xd9, 0x62, 0xe8, 0x61, 0x0c, 0x4d,
-  0x4d, 0x1d, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x18, 0x8d, 0x80, 0xd6,
-  0x05, 0xd3, 0x4c, 0xc9, 0x0e, 0x49, 0xbd, 0x60, 0xbc, 0xcf, 0xe0, 0x00,
-  0x45, 0x96, 0xbd, 0x05, 0xe8, 0x01, 0xe3, 0xca, 0x88, 0x41, 0x60, 0xd9,
-  0x2a, 0x41, 0xef, 0x57, 0x0c, 0x2d, 0x49, 0x1d, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0xa8, 0x51, 0x40, 0xa3, 0x65, 0x34, 0x2b, 0xe2, 0xd6, 0xd6,
-  0x56, 0x51, 0x29, 0x4e, 0x59, 0x86, 0xdc, 0x89, 0xbf, 0x8a, 0x0e, 0xc0,
-  0xe7, 0xe9, 0x0a, 0xd0, 0x03, 0x96, 0x6e, 0xdb, 0xc7, 0x52, 0x73, 0x7a,
-  0xbf, 0x62, 0x69, 0x49, 0xea, 0x81, 0x00, 0x02, 0x08, 0x20, 0x80, 0x40,
-  0xcd, 0x02, 0x8d, 0x46, 0x23, 0xd3, 0xa8, 0x19, 0x87, 0xb4, 0x60, 0x79,
-  0x1a, 0x0e, 0xf9, 0xc8, 0x82, 0xc0, 0x35, 0x02, 0xf4, 0x80, 0x71, 0x51,
-  0x84, 0x2e, 0xb0, 0x6c, 0x15, 0xa0, 0xf7, 0x2b, 0xf4, 0x56, 0xa4, 0xfc,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x78, 0x24, 0xa0, 0x40, 0xec, 0xe2,
-  0x45, 0xad, 0xbd, 0x9c, 0x9b, 0x34, 0x23, 0x62, 0xb3, 0x28, 0x13, 0x9f,
-  0x23, 0xb0, 0x5b, 0x80, 0x1e, 0x30, 0xae, 0x89, 0x90, 0x05, 0xe8, 0xfd,
-  0x0a, 0xb9, 0xf5, 0x28, 0x3b, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x9e,
-  0x0a, 0x38, 0xae, 0x0d, 0x36, 0x4d, 0x00, 0xe6, 0x69, 0x03, 0x7a, 0x5e,
-  0x2c, 0x7a, 0xc0, 0x3c, 0x6f, 0x20, 0x8a, 0x97, 0x2b, 0xb0, 0x6c, 0x9f,
-  0xd2, 0xfb, 0xc5, 0x45, 0x82, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x95, 0x0b, 0xcc, 0xce, 0xce, 0x66, 0x67, 0xcf, 0x9e, 0x2d, 0x3a, 0xee,
-  0x43, 0x96, 0xe1, 0xf5, 0x45, 0x99, 0xf8, 0x1c, 0x81, 0x9d, 0x02, 0xf4,
-  0x80, 0x71, 0x3d, 0x84, 0x2a, 0x40, 0xef, 0x57, 0xa8, 0x2d, 0x47, 0xb9,
-  0x11, 0x40, 0x00, 0x01, 0x04, 0x10, 0x08, 0x40, 0x60, 0x65, 0x65, 0xc5,
-  0xa5, 0x94, 0x77, 0x5a, 0xa6, 0x79, 0x97, 0x8c, 0xe4, 0x41, 0xa0, 0x27,
-  0x70, 0x00, 0x0a, 0x04, 0x02, 0x15, 0x78, 0x9f, 0x95, 0xfb, 0xe7, 0xfb,
-  0x95, 0x5d, 0xeb, 0x7e, 0x7d, 0xf4, 0xa3, 0x1f, 0xcd, 0xae, 0xbf, 0xfe,
-  0xfa, 0x40, 0xab, 0x47, 0xb1, 0x11, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0xa0, 0x4e, 0x01, 0x2d, 0x5f, 0x73, 0xf9, 0xf2, 0xe5, 0xec, 0xc1, 0x07,
-  0x1f, 0x2c, 0x2a, 0xc6, 0x3f, 0xb2, 0x0c, 0xff, 0xae, 0x28, 0x13, 0x9f,
-  0x23, 0xd0, 0x13, 0xa0, 0x07, 0x8c, 0x6b, 0x21, 0x54, 0x81, 0xdc, 0xa7,
-  0x4d, 0xac, 0xfb, 0x15, 0x6a, 0xb3, 0x52, 0x6e, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0xfc, 0x11, 0x58, 0x5e, 0x5e, 0xce, 0xf4, 0x50, 0xb7, 0x20,
-  0xbd, 0xd2, 0x3e, 0xcf, 0xbd, 0x2f, 0x29, 0x3a, 0x00, 0x9f, 0xa7, 0x25,
-  0x40, 0x0f, 0x58, 0x5a, 0xed, 0x1d, 0x4b, 0x6d, 0xf5, 0x25, 0x37, 0xd7,
-  0xaf, 0x32, 0xf4, 0x7e, 0xc5, 0xd2, 0xcc, 0xd4, 0x03, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x81, 0x7a, 0x05, 0x34, 0x92, 0xe6, 0x89, 0x27, 0x9e, 0xc8,
-  0xce, 0x9f, 0xd7, 0x84, 0x87, 0xb9, 0xe9, 0xad, 0xf6, 0xe9, 0x1f, 0xd8,
-  0xf6, 0x44, 0x51, 0x46, 0x3e, 0x47, 0x80, 0x1e, 0x30, 0xae, 0x81, 0x10,
-  0x05, 0x96, 0xf3, 0x0a, 0x4d, 0xef, 0x57, 0x88, 0x4d, 0x4a, 0x99, 0x11,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0xf0, 0x53, 0x40, 0xbd, 0x60, 0x93, 0x93,
-  0x93, 0x45, 0x85, 0x7b, 0xa9, 0x65, 0x70, 0x5a, 0x40, 0xac, 0xe8, 0x40,
-  0x7c, 0x1e, 0xbf, 0x00, 0x3d, 0x60, 0xf1, 0xb7, 0x71, 0x6c, 0x35, 0x9c,
-  0xb5, 0x0a, 0xfd, 0xf3, 0x7e, 0x95, 0xa2, 0xf7, 0x2b, 0xb6, 0xe6, 0xa6,
-  0x3e, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0xd4, 0x2f, 0xa0, 0xf7, 0xc1,
-  0x1c, 0x66, 0x44, 0xd4, 0xbb, 0x60, 0x1f, 0xb4, 0x8d, 0x5e, 0xb0, 0xfa,
-  0x9b, 0xcc, 0xeb, 0x12, 0xd0, 0x03, 0xe6, 0x75, 0xf3, 0x50, 0xb8, 0x3d,
-  0x04, 0x72, 0x9f, 0x2e, 0x69, 0xca, 0x58, 0x7d, 0x49, 0x92, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0xaa, 0x11, 0xe8, 0x74, 0x3a, 0x59, 0xbb, 0xdd, 0xce,
-  0xf4, 0x2f, 0x09, 0x81, 0x54, 0x05, 0xe6, 0xe7, 0xe7, 0x5d, 0x7a, 0xc1,
-  0x5e, 0x62, 0x3e, 0xf4, 0x82, 0xa5, 0x7a, 0x91, 0x94, 0xa8, 0x37, 0x01,
-  0x58, 0x09, 0x2c, 0xb2, 0xd6, 0x2e, 0x70, 0xc4, 0x4a, 0xa0, 0x45, 0x0f,
-  0xfb, 0x26, 0x0d, 0x13, 0x20, 0x21, 0x80, 0x00, 0x02, 0x08, 0x0c, 0x2f,
-  0xa0, 0xd9, 0xdf, 0x34, 0xa4, 0xfb, 0xf0, 0xe1, 0xc3, 0xd9, 0xd1, 0xa3,
-  0x47, 0xbb, 0xff, 0x36, 0x9b, 0xcd, 0x6e, 0x30, 0x46, 0x42, 0x20, 0x45,
-  0x01, 0xc7, 0x69, 0xe9, 0x7f, 0xc3, 0x6c, 0x78, 0x12, 0x9c, 0xe2, 0x05,
-  0x52, 0xa2, 0xce, 0x2c, 0xc4, 0x5c, 0x02, 0x8b, 0xac, 0xb5, 0x0b, 0xb4,
-  0xac, 0x04, 0x7d, 0x27, 0xdf, 0x98, 0x9b, 0x9b, 0xcb, 0x1c, 0x57, 0xae,
-  0xaf, 0xbd, 0x22, 0x14, 0x00, 0x01, 0x04, 0x10, 0xf0, 0x59, 0x40, 0xbd,
-  0x5d, 0x1a, 0x51, 0xb0, 0xb9, 0xb9, 0x79, 0x4d, 0x31, 0xf5, 0x2e, 0x0c,
-  0xbd, 0x61, 0x3e, 0xb7, 0x1e, 0x65, 0x1b, 0xa5, 0x80, 0x1e, 0x42, 0x38,
-  0x4c, 0xc8, 0x71, 0xc2, 0xca, 0xc0, 0x13, 0xe1, 0x51, 0x36, 0x44, 0xe0,
-  0xc7, 0xa6, 0x07, 0x2c, 0xf0, 0x06, 0x4c, 0xa8, 0xf8, 0x7a, 0x9a, 0xd4,
-  0x37, 0xf8, 0x92, 0x83, 0x86, 0x07, 0x90, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x86, 0x13, 0xd8, 0xd8, 0xd8, 0xc8, 0x8e, 0x1c, 0x39, 0xb2, 0x67, 0xf0,
-  0xa5, 0x23, 0x5f, 0xbc, 0x78, 0x31, 0x5b, 0x5b, 0x5b, 0x1b, 0xee, 0x24,
-  0xec, 0x8d, 0x40, 0xa0, 0x02, 0x8e, 0x23, 0x6d, 0xe8, 0x05, 0x0b, 0xb4,
-  0x7d, 0xc7, 0x55, 0x6c, 0x02, 0xb0, 0x71, 0x49, 0x73, 0x9e, 0x61, 0x05,
-  0x72, 0xa3, 0xab, 0xe9, 0xe9, 0xe9, 0xee, 0xd0, 0x18, 0x12, 0x02, 0x08,
-  0x20, 0x80, 0xc0, 0xe0, 0x02, 0x0a, 0xbe, 0xf4, 0x5d, 0xba, 0xb5, 0xb5,
-  0x95, 0x7b, 0x10, 0x02, 0xb0, 0xc1, 0x8d, 0xd9, 0x33, 0x6c, 0x01, 0xfd,
-  0x7e, 0xe8, 0x9e, 0xa3, 0x20, 0xf1, 0x2e, 0x58, 0x91, 0x50, 0xe2, 0x9f,
-  0x13, 0x80, 0x25, 0x7e, 0x01, 0x04, 0x54, 0xfd, 0xdc, 0x97, 0x5a, 0xe9,
-  0xfd, 0x0a, 0xa8, 0x25, 0x29, 0x2a, 0x02, 0x08, 0x78, 0x29, 0xe0, 0x1a,
-  0x7c, 0xa9, 0xf0, 0x8d, 0x46, 0xc3, 0xcb, 0x3a, 0x50, 0x28, 0x04, 0xc6,
-  0x21, 0xe0, 0xd8, 0x0b, 0xf6, 0x9e, 0x71, 0x94, 0x85, 0x73, 0x84, 0x29,
-  0xc0, 0x3b, 0x60, 0x61, 0xb6, 0x5b, 0x6a, 0xa5, 0x6e, 0x5a, 0x85, 0xcf,
-  0xf5, 0xab, 0x34, 0xef, 0x23, 0xa4, 0x76, 0x39, 0x50, 0x5f, 0x04, 0x10,
-  0xa8, 0x5a, 0x40, 0xef, 0x74, 0x69, 0xd8, 0x61, 0x51, 0xcf, 0x97, 0xce,
-  0xab, 0xe5, 0x3e, 0x14, 0xac, 0x11, 0x84, 0x55, 0xdd, 0x0a, 0x1c, 0x2f,
-  0x24, 0x01, 0xc7, 0x77, 0xc1, 0x8e, 0x5b, 0x9d, 0x5a, 0x21, 0xd5, 0x8b,
-  0xb2, 0x8e, 0x47, 0x80, 0x1e, 0xb0, 0xf1, 0x38, 0x73, 0x96, 0xe1, 0x04,
-  0xe6, 0xf3, 0x76, 0xa7, 0xf7, 0x6b, 0x38, 0x5c, 0xf6, 0x46, 0x00, 0x81,
-  0xb4, 0x05, 0x34, 0xdb, 0xa1, 0x26, 0xdc, 0x70, 0x0d, 0xbe, 0x34, 0x0b,
-  0x22, 0xc1, 0x57, 0xda, 0xd7, 0x0c, 0xb5, 0xb7, 0x19, 0x36, 0xdc, 0x66,
-  0x5d, 0xfe, 0xd7, 0x58, 0x21, 0xb0, 0x97, 0x00, 0x3d, 0x60, 0x5c, 0x17,
-  0xbe, 0x0b, 0x68, 0xf2, 0x8d, 0x8e, 0x1e, 0xba, 0xf6, 0x2b, 0xe8, 0x85,
-  0x0b, 0x17, 0xb8, 0x19, 0xf0, 0xbd, 0x15, 0x29, 0x1f, 0x02, 0x08, 0x78,
-  0x2b, 0xe0, 0xf8, 0x24, 0xbf, 0xdb, 0xf3, 0xa5, 0xe0, 0x4b, 0x3d, 0x65,
-  0x24, 0x04, 0x10, 0xc8, 0x72, 0x27, 0xab, 0xd9, 0xe1, 0x43, 0x2f, 0x18,
-  0x17, 0xcb, 0x35, 0x02, 0xf4, 0x80, 0x71, 0x51, 0xf8, 0x2e, 0x30, 0x9b,
-  0x17, 0x7c, 0xcd, 0xcc, 0xcc, 0x10, 0x7c, 0xf9, 0xde, 0x82, 0x94, 0x0f,
-  0x01, 0x04, 0xbc, 0x15, 0xd0, 0x53, 0x7c, 0x87, 0x29, 0xb5, 0x09, 0xbe,
-  0xbc, 0x6d, 0x41, 0x0a, 0x56, 0xa7, 0x80, 0xd6, 0xc9, 0x73, 0x48, 0xbc,
-  0x0b, 0xe6, 0x80, 0x94, 0x5a, 0x16, 0x7a, 0xc0, 0x52, 0x6b, 0xf1, 0xf0,
-  0xea, 0xab, 0xb9, 0x8e, 0x67, 0xfa, 0x15, 0xfb, 0xcc, 0x99, 0x33, 0xdd,
-  0xa1, 0x33, 0x24, 0x04, 0x10, 0x40, 0x00, 0x81, 0x72, 0x02, 0xea, 0xcd,
-  0xd2, 0x02, 0xcb, 0x45, 0x89, 0x9e, 0xaf, 0x22, 0x21, 0x3e, 0x4f, 0x59,
-  0x40, 0xc3, 0x71, 0xb5, 0x34, 0x43, 0x41, 0xd2, 0x2f, 0x5a, 0xbb, 0x28,
-  0x13, 0x9f, 0xa7, 0x23, 0x70, 0x20, 0x9d, 0xaa, 0x52, 0xd3, 0x00, 0x05,
-  0x34, 0xfc, 0x70, 0xb5, 0x5f, 0xb9, 0x75, 0x53, 0xc0, 0xc2, 0xcb, 0x01,
-  0xb6, 0x2a, 0x45, 0x46, 0x00, 0x81, 0xda, 0x05, 0xf4, 0xde, 0xd7, 0x9b,
-  0xde, 0xf4, 0xa6, 0xec, 0xca, 0x95, 0x2b, 0xb9, 0x65, 0x21, 0xf8, 0xaa,
-  0xbd, 0xa9, 0x28, 0x80, 0xe7, 0x02, 0x87, 0x0e, 0x1d, 0xca, 0xce, 0x9e,
-  0x3d, 0x5b, 0x54, 0x4a, 0x75, 0x78, 0xb0, 0x78, 0x5e, 0x91, 0x52, 0x42,
-  0x9f, 0x33, 0x04, 0x31, 0xa1, 0xc6, 0x0e, 0xb0, 0xaa, 0xb9, 0x5d, 0x5b,
-  0xf4, 0x7c, 0x05, 0xd8, 0xa2, 0x14, 0x19, 0x01, 0x04, 0xbc, 0x10, 0xd0,
-  0xd0, 0x29, 0x97, 0x49, 0x37, 0xf4, 0x90, 0x8b, 0x77, 0xbe, 0xbc, 0x68,
-  0x32, 0x0a, 0xe1, 0xa9, 0x80, 0x26, 0x02, 0xd3, 0x83, 0x8a, 0x82, 0x34,
-  0x67, 0x9f, 0x37, 0x8a, 0x32, 0xf1, 0x79, 0x3a, 0x02, 0x04, 0x60, 0xe9,
-  0xb4, 0x75, 0x88, 0x35, 0x25, 0x00, 0x0b, 0xb1, 0xd5, 0x28, 0x33, 0x02,
-  0x08, 0x78, 0x2d, 0xa0, 0xa1, 0x87, 0xa7, 0x4f, 0x9f, 0x2e, 0x2c, 0xe3,
-  0xea, 0xea, 0x2a, 0x43, 0xbc, 0x0b, 0x95, 0xc8, 0x80, 0x40, 0x96, 0x39,
-  0xbe, 0x0b, 0xe6, 0xf4, 0xc2, 0x18, 0x9e, 0x69, 0x08, 0xf0, 0x0e, 0x58,
-  0x1a, 0xed, 0x1c, 0x6a, 0x2d, 0x2f, 0x5b, 0xc1, 0xf7, 0x7c, 0xac, 0xa4,
-  0xa7, 0x4d, 0x1a, 0x42, 0x43, 0x42, 0x00, 0x01, 0x04, 0x10, 0x28, 0x27,
-  0xe0, 0xf2, 0xce, 0xca, 0xdc, 0xdc, 0x1c, 0x43, 0xbc, 0xcb, 0xb1, 0x92,
-  0x3b, 0x61, 0x01, 0xdd, 0x8f, 0xdc, 0x74, 0xd3, 0x4d, 0x45, 0x02, 0x8f,
-  0x59, 0x86, 0x57, 0xd9, 0xc6, 0xcd, 0x4b, 0x91, 0x54, 0x02, 0x9f, 0xd3,
-  0x03, 0x96, 0x40, 0x23, 0x07, 0x5a, 0xc5, 0x66, 0xbf, 0xe0, 0x4b, 0xf5,
-  0x61, 0xf8, 0x61, 0xa0, 0xad, 0x4a, 0xb1, 0x11, 0x40, 0xa0, 0x56, 0x01,
-  0x0d, 0x29, 0x2c, 0x9a, 0x30, 0x60, 0x6a, 0x6a, 0x2a, 0x5b, 0x59, 0x59,
-  0xa9, 0xb5, 0x9c, 0x9c, 0x1c, 0x81, 0x90, 0x04, 0xf4, 0x1e, 0x98, 0x1e,
-  0x5a, 0x14, 0xa4, 0x1b, 0x75, 0xfb, 0x52, 0x94, 0x89, 0xcf, 0xd3, 0x10,
-  0x20, 0x00, 0x4b, 0xa3, 0x9d, 0x43, 0xac, 0xa5, 0x02, 0xb0, 0xbe, 0x89,
-  0x00, 0x2c, 0xc4, 0x26, 0xa5, 0xcc, 0x08, 0x20, 0x50, 0xa7, 0x80, 0x9e,
-  0xd2, 0xbb, 0x2c, 0x1e, 0xab, 0x20, 0x4d, 0x37, 0x94, 0x24, 0x04, 0x10,
-  0x70, 0x17, 0x70, 0x1c, 0x86, 0xf8, 0x5e, 0xf7, 0x23, 0x92, 0x33, 0x66,
-  0x01, 0x02, 0xb0, 0x98, 0x5b, 0x37, 0xec, 0xba, 0xe5, 0x06, 0x60, 0x5a,
-  0x38, 0x94, 0x84, 0x00, 0x02, 0x08, 0x20, 0xe0, 0x2e, 0xe0, 0xd2, 0xfb,
-  0xb5, 0xb4, 0xb4, 0xc4, 0xa4, 0x1b, 0xee, 0xa4, 0xe4, 0x44, 0xe0, 0x07,
-  0x02, 0x9a, 0xac, 0x66, 0x7a, 0x7a, 0xba, 0x48, 0xe4, 0x4e, 0xcb, 0xc0,
-  0x4a, 0xe6, 0x45, 0x4a, 0x09, 0x7c, 0xce, 0x3b, 0x60, 0x09, 0x34, 0x72,
-  0xa0, 0x55, 0xec, 0xfb, 0xfe, 0x97, 0x86, 0xc7, 0x6c, 0x6c, 0x6c, 0x04,
-  0x5a, 0x2d, 0x8a, 0x5d, 0x24, 0xa0, 0x09, 0x02, 0xea, 0x4a, 0xfa, 0x03,
-  0xca, 0x93, 0xff, 0xba, 0xf4, 0x39, 0xef, 0xa8, 0x05, 0x8a, 0xde, 0xfd,
-  0x9a, 0x9c, 0x9c, 0xcc, 0x3a, 0x9d, 0xce, 0xa8, 0x8b, 0xc1, 0xf1, 0x11,
-  0x88, 0x56, 0x40, 0x0f, 0x39, 0x8e, 0x1f, 0x3f, 0x5e, 0x54, 0x3f, 0xcd,
-  0x80, 0x33, 0x5f, 0x94, 0x89, 0xcf, 0xe3, 0x16, 0x38, 0x18, 0x77, 0xf5,
-  0xa8, 0x5d, 0xa0, 0x02, 0x7a, 0x3a, 0xd4, 0x77, 0x4e, 0x57, 0x7a, 0xbf,
-  0x02, 0x6d, 0xd5, 0x9c, 0x62, 0xf7, 0x86, 0x46, 0xe9, 0x8f, 0x97, 0xcb,
-  0xd4, 0xd8, 0xf1, 0x09, 0x5c, 0x5b, 0x23, 0x4d, 0x34, 0xe3, 0xd3, 0xf4,
-  0xdf, 0xbd, 0xe0, 0xd4, 0x35, 0x40, 0x8e, 0xfd, 0xf7, 0x54, 0xc1, 0x8c,
-  0xb6, 0x50, 0xd2, 0xfd, 0xf7, 0xdf, 0x5f, 0xf8, 0xee, 0x17, 0xeb, 0x2a,
-  0x86, 0xd2, 0x9a, 0x94, 0xd3, 0x57, 0x01, 0x4d, 0x49, 0xaf, 0x61, 0xbe,
-  0x05, 0xef, 0x59, 0xfe, 0x53, 0x2b, 0xbf, 0x66, 0x44, 0x64, 0x32, 0x0e,
-  0x5f, 0x1b, 0x72, 0x0c, 0xe5, 0xa2, 0x07, 0x6c, 0x0c, 0xc8, 0x9c, 0xa2,
-  0xb4, 0x80, 0x5e, 0x52, 0x3d, 0xd3, 0x6f, 0xaf, 0x33, 0x67, 0xce, 0x30,
-  0x09, 0x47, 0x69, 0x52, 0x7f, 0x77, 0xd0, 0x13, 0x77, 0xbd, 0xd3, 0xb7,
-  0xb9, 0xb9, 0xe9, 0x6f, 0x21, 0x29, 0x19, 0x02, 0x91, 0x0b, 0x68, 0xe8,
-  0x94, 0x6b, 0x70, 0x1d, 0x39, 0x05, 0xd5, 0x43, 0x60, 0x28, 0x01, 0x05,
-  0x60, 0x27, 0x4e, 0x9c, 0x28, 0x3a, 0x86, 0xba, 0xc9, 0x5a, 0x45, 0x99,
-  0xf8, 0x3c, 0x5e, 0x01, 0x7a, 0xc0, 0xe2, 0x6d, 0xdb, 0x90, 0x6b, 0x96,
-  0x3b, 0x3e, 0xda, 0xa7, 0x5e, 0x81, 0x90, 0x91, 0x7d, 0x28, 0xfb, 0xda,
-  0xda, 0x5a, 0xa6, 0x27, 0x86, 0xf4, 0x7a, 0xf9, 0xd0, 0x1a, 0x94, 0x21,
-  0x65, 0x01, 0x97, 0xc9, 0x39, 0x52, 0xf6, 0xf1, 0xb9, 0xee, 0xef, 0x79,
-  0xcf, 0x7b, 0xb2, 0xfb, 0xee, 0xbb, 0xaf, 0x5b, 0xc4, 0x97, 0xbc, 0xe4,
-  0x25, 0xd9, 0x6d, 0xb7, 0xdd, 0x96, 0x5d, 0x7f, 0xfd, 0xf5, 0x95, 0x15,
-  0xd9, 0xd7, 0xde, 0x5e, 0x0d, 0x17, 0xf7, 0xf1, 0x7e, 0xc0, 0xb1, 0x67,
-  0x5c, 0x93, 0x71, 0x10, 0x80, 0x55, 0x76, 0x95, 0x86, 0x77, 0x20, 0x7a,
-  0xc0, 0xc2, 0x6b, 0xb3, 0x14, 0x4a, 0xbc, 0x66, 0x95, 0x9c, 0xe9, 0x57,
-  0xd1, 0xed, 0xed, 0xed, 0x14, 0x0c, 0xa2, 0xaf, 0xa3, 0x66, 0x8c, 0x3a,
-  0x75, 0xea, 0x54, 0xf4, 0xf5, 0xa4, 0x82, 0x08, 0xf8, 0x2e, 0x40, 0xef,
-  0x97, 0xef, 0x2d, 0xb4, 0x77, 0xf9, 0x34, 0x74, 0xfb, 0x0d, 0x6f, 0x78,
-  0x43, 0xf6, 0xed, 0x6f, 0x7f, 0x3b, 0xcc, 0x0a, 0x50, 0xea, 0xbb, 0x8c,
-  0x80, 0x17, 0xda, 0x13, 0xbd, 0x0e, 0x98, 0x05, 0x31, 0xd1, 0x86, 0xf7,
-  0xbc, 0xda, 0x7d, 0xe7, 0x3f, 0x76, 0x98, 0x61, 0xc8, 0xf3, 0xaa, 0x51,
-  0x3c, 0x0d, 0x39, 0xd4, 0x53, 0x4b, 0x82, 0x2f, 0xae, 0x05, 0x04, 0xfc,
-  0x10, 0x70, 0x9c, 0x3e, 0xdb, 0x8f, 0xc2, 0x52, 0x8a, 0xae, 0x80, 0xbe,
-  0x47, 0x7f, 0xf2, 0x27, 0x7f, 0x92, 0xe0, 0x2b, 0xec, 0xeb, 0x61, 0x3e,
-  0xec, 0xe2, 0x53, 0xfa, 0x61, 0x04, 0x08, 0xc0, 0x86, 0xd1, 0x63, 0xdf,
-  0x51, 0x09, 0x30, 0x45, 0xeb, 0xa8, 0x64, 0x6b, 0x3e, 0xae, 0x86, 0x1c,
-  0x2a, 0xf8, 0xe2, 0x7d, 0xaf, 0x9a, 0x1b, 0x82, 0xd3, 0x23, 0x70, 0x55,
-  0x40, 0x43, 0xd5, 0x58, 0x57, 0x31, 0xac, 0xcb, 0x41, 0xef, 0xea, 0xfd,
-  0xf8, 0x8f, 0xff, 0x78, 0xf6, 0xad, 0x6f, 0x7d, 0x2b, 0xac, 0x82, 0x53,
-  0xda, 0xdd, 0x02, 0xef, 0x82, 0x24, 0x5d, 0x01, 0x02, 0xb0, 0x74, 0xdb,
-  0xde, 0xe7, 0x9a, 0x33, 0x03, 0xa2, 0xcf, 0xad, 0x33, 0x60, 0xd9, 0xf4,
-  0x94, 0xfd, 0xd8, 0xb1, 0x63, 0xbc, 0xef, 0x35, 0xa0, 0x1f, 0xbb, 0x21,
-  0x30, 0x0a, 0x81, 0xbb, 0xef, 0xbe, 0x7b, 0x14, 0x87, 0xe5, 0x98, 0x23,
-  0x12, 0x58, 0x59, 0x59, 0xc9, 0x8e, 0x1e, 0x3d, 0x9a, 0xfd, 0xc3, 0x3f,
-  0xfc, 0xc3, 0x88, 0xce, 0xc0, 0x61, 0xc7, 0x28, 0xf0, 0x8a, 0x31, 0x9e,
-  0x8b, 0x53, 0x79, 0x26, 0xc0, 0x24, 0x1c, 0x9e, 0x35, 0x08, 0xc5, 0xc9,
-  0xfa, 0x0e, 0x3f, 0xc4, 0x26, 0x4c, 0x81, 0x01, 0x67, 0x39, 0xd4, 0x3a,
-  0x29, 0xad, 0x1a, 0x6a, 0xdc, 0xac, 0xe1, 0x9c, 0xfd, 0x4e, 0xd9, 0xb0,
-  0x0f, 0xb4, 0xf9, 0x92, 0x0a, 0x57, 0x18, 0xf5, 0xa5, 0xa0, 0x94, 0xc3,
-  0x5d, 0xe0, 0xf7, 0x7e, 0xef, 0xf7, 0xdc, 0x33, 0x93, 0xb3, 0x36, 0x01,
-  0xbd, 0xef, 0xa5, 0x87, 0x58, 0xa7, 0x4f, 0xeb, 0xab, 0x91, 0x14, 0x89,
-  0x00, 0x5d, 0x98, 0x91, 0x34, 0xe4, 0x20, 0xd5, 0x20, 0x00, 0x1b, 0x44,
-  0x8d, 0x7d, 0x46, 0x29, 0xc0, 0x0c, 0x88, 0xa3, 0xd4, 0x1d, 0xf3, 0xb1,
-  0xb5, 0xae, 0x90, 0x6e, 0x1a, 0x4a, 0xce, 0x72, 0x78, 0xaf, 0x15, 0x73,
-  0x65, 0xcc, 0x45, 0xed, 0x9d, 0xae, 0x5d, 0xd3, 0x79, 0x39, 0x6d, 0x39,
-  0x81, 0xba, 0x83, 0xd3, 0xdb, 0xad, 0xb8, 0x37, 0xee, 0x28, 0xf2, 0xee,
-  0xff, 0x2e, 0x57, 0x9b, 0x6a, 0x73, 0xab, 0x5c, 0x2a, 0x4f, 0x2f, 0xdd,
-  0x69, 0x3f, 0x1c, 0xd8, 0xeb, 0x14, 0x5a, 0x78, 0xd9, 0xc7, 0x59, 0xe4,
-  0xaa, 0xe5, 0x08, 0xff, 0x68, 0x1b, 0x1b, 0x1b, 0xdd, 0xd9, 0x62, 0x19,
-  0xba, 0x1d, 0x7e, 0x5b, 0xee, 0xaa, 0xc1, 0x6f, 0x44, 0x57, 0x23, 0x2a,
-  0xe4, 0x2c, 0x40, 0x00, 0xe6, 0x4c, 0x45, 0x46, 0x1f, 0x04, 0x34, 0xed,
-  0x2c, 0xc9, 0x7f, 0x01, 0x3d, 0xad, 0xd5, 0x0d, 0xc3, 0xd9, 0xb3, 0x67,
-  0xcb, 0x14, 0xf6, 0xa2, 0x65, 0xd6, 0x1a, 0x70, 0xcc, 0x0a, 0x55, 0x46,
-  0x2d, 0xcd, 0xbc, 0x1d, 0xab, 0xb6, 0xb6, 0xba, 0x52, 0xbb, 0xae, 0x13,
-  0x97, 0x3c, 0xaf, 0x1e, 0x68, 0xad, 0xf7, 0xdb, 0x87, 0x77, 0xbf, 0x4a,
-  0x6a, 0xd6, 0x90, 0x7d, 0x80, 0x87, 0x58, 0x4f, 0x5a, 0x31, 0xff, 0x8f,
-  0x6d, 0x4f, 0x57, 0x58, 0xdc, 0xc9, 0x0a, 0x8f, 0xc5, 0xa1, 0xb2, 0xec,
-  0x59, 0x43, 0xd0, 0x42, 0x61, 0x9a, 0xf1, 0x99, 0x94, 0xa8, 0x00, 0x01,
-  0x58, 0xa2, 0x0d, 0xef, 0x71, 0xb5, 0x1b, 0x1e, 0x97, 0x8d, 0xa2, 0x39,
-  0x08, 0xe8, 0x05, 0x71, 0x05, 0x5f, 0x17, 0x2f, 0x2a, 0x9e, 0x72, 0x4e,
-  0x8a, 0xd4, 0xe6, 0x6d, 0xbb, 0xec, 0xbc, 0x07, 0x19, 0x11, 0x40, 0xa0,
-  0x48, 0x20, 0x77, 0x44, 0x41, 0xb3, 0xd9, 0x2c, 0xda, 0x9f, 0xcf, 0x6b,
-  0x12, 0x18, 0x70, 0xc8, 0xa1, 0xc6, 0x27, 0x2e, 0x26, 0xf4, 0x3d, 0xaa,
-  0xfb, 0x05, 0x5f, 0xef, 0x19, 0x76, 0xfe, 0x72, 0xdd, 0x62, 0xe5, 0xec,
-  0x2d, 0xcc, 0xb6, 0x69, 0x3f, 0x9f, 0xac, 0xe9, 0xb2, 0xe2, 0xb4, 0x08,
-  0x20, 0x80, 0x40, 0x5f, 0x81, 0x65, 0xfb, 0x44, 0x0b, 0x7d, 0xed, 0xb9,
-  0xd9, 0x1a, 0x60, 0x24, 0x4f, 0x05, 0x2e, 0x5d, 0xba, 0xb4, 0xbd, 0xb0,
-  0xb0, 0xd0, 0xb7, 0xed, 0x72, 0xda, 0x55, 0x37, 0x0c, 0x24, 0x04, 0x10,
-  0xa8, 0x5e, 0x20, 0xf7, 0xfb, 0xf4, 0xc2, 0x85, 0x0b, 0x9e, 0x7e, 0x9b,
-  0xa4, 0x5d, 0xac, 0xf5, 0xf5, 0xf5, 0xed, 0xa9, 0xa9, 0xa9, 0xb2, 0xdf,
-  0xa5, 0x6a, 0x6b, 0x12, 0x02, 0x08, 0x04, 0x22, 0x40, 0x0f, 0x58, 0x20,
-  0x0d, 0x45, 0x31, 0x11, 0xf0, 0x59, 0x60, 0xc0, 0x77, 0x14, 0x18, 0x72,
-  0xe8, 0x73, 0xa3, 0x52, 0xb6, 0x18, 0x04, 0x72, 0x7b, 0xc0, 0x1a, 0x8d,
-  0x46, 0x0c, 0x75, 0x8c, 0xaa, 0x0e, 0x03, 0x0c, 0x39, 0xdc, 0x32, 0x80,
-  0x79, 0xdb, 0x18, 0xce, 0x16, 0xd5, 0x95, 0x40, 0x65, 0x62, 0x17, 0x60,
-  0x1a, 0xfa, 0xd8, 0x5b, 0x98, 0xfa, 0x21, 0x30, 0x62, 0x81, 0xe5, 0xe5,
-  0xe5, 0xec, 0xae, 0xbb, 0xee, 0x2a, 0xfb, 0x82, 0xb8, 0x86, 0x1c, 0xea,
-  0xe6, 0x90, 0xf7, 0xbd, 0x46, 0xdc, 0x3e, 0x1c, 0x3e, 0x69, 0x01, 0x16,
-  0xb5, 0x0f, 0xa4, 0xf9, 0x35, 0xe4, 0x50, 0xef, 0xe4, 0x1d, 0x3f, 0x7e,
-  0xbc, 0xcc, 0xa4, 0x45, 0x1a, 0xce, 0xa6, 0xef, 0x51, 0x82, 0xaf, 0x40,
-  0xda, 0x99, 0x62, 0x22, 0xd0, 0x13, 0xa0, 0x07, 0x8c, 0x6b, 0xc1, 0x37,
-  0x81, 0xbe, 0x4f, 0x6c, 0x27, 0x26, 0xfa, 0x2e, 0x0f, 0xe6, 0x5b, 0x1d,
-  0x92, 0x28, 0xcf, 0x80, 0xbd, 0x5e, 0x7a, 0x5a, 0xab, 0x21, 0x87, 0xad,
-  0x24, 0x90, 0xa8, 0x24, 0x02, 0xf5, 0x0a, 0xf4, 0x5d, 0x3a, 0x80, 0x09,
-  0x8d, 0xea, 0x6d, 0x98, 0x9d, 0x67, 0x1f, 0xf0, 0xbd, 0xd9, 0xd4, 0xde,
-  0xf7, 0xf2, 0xa7, 0xc1, 0x28, 0x09, 0x02, 0x15, 0x08, 0xd0, 0x03, 0x56,
-  0x01, 0x22, 0x87, 0xa8, 0x54, 0xa0, 0xef, 0x13, 0x5b, 0xa6, 0x4b, 0xae,
-  0xd4, 0x79, 0xa8, 0x83, 0x0d, 0xd8, 0xeb, 0xd5, 0x7b, 0x5a, 0x4b, 0xf0,
-  0x35, 0x94, 0x3e, 0x3b, 0x23, 0x30, 0xbc, 0x00, 0xdf, 0xa7, 0xc3, 0x1b,
-  0x56, 0x71, 0x04, 0x7d, 0x97, 0x6a, 0x61, 0xe5, 0x12, 0x93, 0x16, 0xe9,
-  0x21, 0xd6, 0x71, 0xdb, 0xe6, 0x6d, 0x63, 0xd2, 0xa2, 0x2a, 0x1a, 0x81,
-  0x63, 0x20, 0x50, 0x83, 0x00, 0x3d, 0x60, 0x35, 0xa0, 0x73, 0x4a, 0x04,
-  0x42, 0x15, 0x18, 0xb0, 0xd7, 0x4b, 0xd5, 0xd5, 0x94, 0xbb, 0xcb, 0xa1,
-  0xd6, 0x9b, 0x72, 0x23, 0x80, 0x00, 0x02, 0x55, 0x0a, 0x0c, 0xf8, 0x5d,
-  0xaa, 0x87, 0x58, 0x0a, 0xbc, 0x18, 0xba, 0x5d, 0x65, 0x63, 0x70, 0x2c,
-  0x04, 0x6a, 0x10, 0xa0, 0x07, 0xac, 0x06, 0x74, 0x4e, 0x89, 0x40, 0x68,
-  0x02, 0xbd, 0x29, 0x91, 0x07, 0x78, 0xd7, 0x4b, 0x13, 0x6d, 0x1c, 0x25,
-  0xf8, 0x0a, 0xad, 0xc5, 0x29, 0x6f, 0x04, 0x02, 0x8d, 0x08, 0xea, 0x10,
-  0x65, 0x15, 0x06, 0x1c, 0x41, 0xa0, 0x21, 0x87, 0x4d, 0x82, 0xaf, 0x28,
-  0x2f, 0x09, 0x2a, 0x95, 0xa0, 0x00, 0x3d, 0x60, 0x09, 0x36, 0x3a, 0x55,
-  0x46, 0xa0, 0x8c, 0xc0, 0x80, 0xef, 0x27, 0xe8, 0x14, 0xa7, 0xae, 0x06,
-  0x5e, 0x0c, 0x93, 0x29, 0x03, 0x4e, 0x5e, 0x04, 0xaa, 0x11, 0xc8, 0x0d,
-  0xc0, 0x58, 0x03, 0xac, 0x1a, 0xe4, 0x32, 0x47, 0x19, 0xb0, 0xd7, 0x8b,
-  0xf7, 0x66, 0xcb, 0x20, 0x93, 0x17, 0x81, 0x40, 0x04, 0xe8, 0x01, 0x0b,
-  0xa4, 0xa1, 0x28, 0x26, 0x02, 0xe3, 0x16, 0xe8, 0xcd, 0xca, 0x55, 0xf2,
-  0xfd, 0x04, 0x15, 0xb3, 0xd7, 0xeb, 0x95, 0xd2, 0x82, 0xa0, 0xe3, 0x6e,
-  0x1e, 0xce, 0x87, 0x00, 0x02, 0x01, 0x09, 0x0c, 0xd8, 0xeb, 0xa5, 0x21,
-  0x87, 0x4d, 0xdb, 0x5a, 0x01, 0x55, 0x95, 0xa2, 0x22, 0x80, 0x80, 0x83,
-  0x00, 0x01, 0x98, 0x03, 0x12, 0x59, 0x10, 0x48, 0x4d, 0x60, 0x65, 0x65,
-  0x25, 0xd3, 0x1a, 0x41, 0x67, 0xcf, 0x6a, 0xb6, 0xf8, 0x52, 0xa9, 0x37,
-  0xbd, 0x7c, 0xbb, 0xd4, 0x5e, 0x64, 0x46, 0x00, 0x01, 0x04, 0x22, 0x14,
-  0x50, 0xaf, 0x97, 0x26, 0x3c, 0x39, 0x71, 0x42, 0xaf, 0xc1, 0x96, 0x4a,
-  0x1a, 0x41, 0xc0, 0x52, 0x1d, 0xa5, 0xc8, 0xc8, 0x8c, 0x40, 0x38, 0x02,
-  0x04, 0x60, 0xe1, 0xb4, 0x55, 0x2a, 0x25, 0xed, 0x3b, 0x5c, 0x4d, 0x7f,
-  0xc8, 0x48, 0xa3, 0x15, 0x90, 0xb1, 0x86, 0x26, 0xdd, 0x7b, 0xef, 0xbd,
-  0x65, 0xd6, 0xa2, 0x51, 0xa1, 0xd4, 0xeb, 0x75, 0xcc, 0xb6, 0x59, 0xdb,
-  0x18, 0x72, 0x38, 0xda, 0x66, 0xe2, 0xe8, 0x08, 0x20, 0xe0, 0xb9, 0x40,
-  0x05, 0xef, 0xcd, 0x6a, 0x04, 0x01, 0x09, 0x01, 0x04, 0x22, 0x15, 0x20,
-  0x00, 0x8b, 0xb4, 0x61, 0x03, 0xae, 0x56, 0xdf, 0x28, 0x6b, 0x6b, 0x4b,
-  0x43, 0xe1, 0x49, 0xa3, 0x10, 0xd8, 0x79, 0xb3, 0x70, 0xfe, 0xfc, 0xf9,
-  0xb2, 0xa7, 0xe8, 0x3d, 0xa9, 0x65, 0x31, 0xd0, 0xb2, 0x72, 0xe4, 0x47,
-  0x60, 0x74, 0x02, 0xb9, 0x4f, 0xac, 0xf4, 0x6e, 0x27, 0x69, 0x34, 0x02,
-  0x6b, 0x6b, 0x6b, 0xdd, 0x5e, 0xaf, 0x53, 0xa7, 0xf4, 0xd5, 0x58, 0x2a,
-  0x69, 0xa2, 0x0d, 0xf5, 0x7a, 0xd1, 0x38, 0xa5, 0xd8, 0xc8, 0x8c, 0x40,
-  0x78, 0x02, 0x4c, 0xc2, 0x11, 0x5e, 0x9b, 0x51, 0x62, 0x04, 0x2a, 0x15,
-  0x68, 0xb5, 0x5a, 0xd9, 0xe2, 0xe2, 0x62, 0xd9, 0x1e, 0x2f, 0x95, 0x41,
-  0xbd, 0x5e, 0xf3, 0xdc, 0x2c, 0x54, 0xda, 0x1c, 0x1c, 0x0c, 0x81, 0xaa,
-  0x04, 0xe8, 0x89, 0xae, 0x4a, 0xd2, 0xf1, 0x38, 0x9d, 0x4e, 0xa7, 0xfb,
-  0x5d, 0x3a, 0xc0, 0xd0, 0x6d, 0x3d, 0x5d, 0xd4, 0x77, 0x29, 0x0f, 0xb1,
-  0x1c, 0xad, 0xc9, 0x86, 0x40, 0xe8, 0x02, 0xf4, 0x80, 0x85, 0xde, 0x82,
-  0x89, 0x95, 0x9f, 0x61, 0x88, 0xd5, 0x35, 0xb8, 0x9e, 0x80, 0xeb, 0x29,
-  0xed, 0xf1, 0xe3, 0xc7, 0x07, 0x09, 0xbe, 0xf4, 0x42, 0x03, 0x4f, 0x6a,
-  0xab, 0x6b, 0x0e, 0x8e, 0x84, 0x00, 0x02, 0x01, 0x0b, 0x68, 0x92, 0x0d,
-  0x7d, 0x9f, 0x0e, 0x10, 0x7c, 0xe9, 0xbd, 0xd9, 0x06, 0xc1, 0x57, 0xc0,
-  0x8d, 0x4f, 0xd1, 0x11, 0x40, 0x00, 0x81, 0x08, 0x04, 0x9a, 0x56, 0x87,
-  0xed, 0x7e, 0xdb, 0xb9, 0x73, 0xe7, 0xb6, 0x49, 0xc3, 0x09, 0x5c, 0xb8,
-  0x70, 0x61, 0x7b, 0x6e, 0x6e, 0xae, 0xaf, 0x71, 0x9e, 0xbf, 0x7d, 0xa6,
-  0x61, 0x4d, 0x0a, 0xbc, 0x48, 0x08, 0x20, 0xe0, 0xbf, 0x40, 0xa7, 0xdf,
-  0xef, 0xf3, 0xf4, 0xf4, 0xf4, 0x70, 0x5f, 0x24, 0xec, 0xdd, 0x15, 0x38,
-  0x73, 0xe6, 0xcc, 0xf6, 0xe4, 0xe4, 0xe4, 0x20, 0xdf, 0xa7, 0xea, 0xa1,
-  0xd4, 0x3b, 0xb3, 0x24, 0x04, 0x10, 0x48, 0x50, 0x80, 0x1e, 0xb0, 0x04,
-  0x1b, 0x3d, 0xe4, 0x2a, 0xf3, 0xde, 0xc2, 0xe0, 0xad, 0xa7, 0xf7, 0xbc,
-  0x7a, 0x4f, 0x69, 0x4f, 0x9f, 0xd6, 0xab, 0x06, 0xa5, 0x92, 0x86, 0xc8,
-  0xdc, 0x7b, 0x35, 0xf8, 0x62, 0x36, 0x94, 0x52, 0x74, 0x64, 0x46, 0xa0,
-  0x36, 0x01, 0x05, 0x60, 0x7b, 0x26, 0x0d, 0x97, 0x23, 0x0d, 0x2e, 0x20,
-  0x3f, 0x4d, 0x58, 0x74, 0xec, 0xd8, 0xb1, 0xec, 0xe2, 0x45, 0x8d, 0xc6,
-  0x2e, 0x95, 0xf4, 0x05, 0xdc, 0xb0, 0x8d, 0x21, 0x87, 0xa5, 0xd8, 0xc8,
-  0x8c, 0x00, 0x02, 0x08, 0x20, 0x30, 0x4a, 0x81, 0xbe, 0x4f, 0x13, 0xd5,
-  0x73, 0x43, 0x2a, 0x2f, 0xb0, 0xba, 0xba, 0x3a, 0xe8, 0x53, 0x5a, 0xb5,
-  0x85, 0x6e, 0x12, 0x74, 0xb3, 0x40, 0x42, 0x00, 0x81, 0xb0, 0x04, 0x5a,
-  0x56, 0xdc, 0xbe, 0xdf, 0xa7, 0x97, 0x2e, 0x5d, 0x2a, 0xff, 0x65, 0x92,
-  0xf8, 0x1e, 0x32, 0x5b, 0x58, 0x58, 0x18, 0xa4, 0xc7, 0x4b, 0xfb, 0x28,
-  0xea, 0x6d, 0x86, 0x75, 0x09, 0x51, 0x5a, 0x04, 0x10, 0x40, 0x00, 0x81,
-  0x54, 0x04, 0xf4, 0x47, 0x6a, 0xcf, 0x3f, 0x70, 0x1a, 0xea, 0x41, 0x72,
-  0x17, 0xd0, 0x90, 0xcd, 0xa9, 0xa9, 0x29, 0x6e, 0x16, 0x52, 0xf9, 0xcd,
-  0xa1, 0x9e, 0x08, 0xbc, 0x50, 0x40, 0x53, 0x99, 0x33, 0xa4, 0xdb, 0xfd,
-  0x2b, 0x33, 0x37, 0xe7, 0xd2, 0xd2, 0xd2, 0xf6, 0xc4, 0xc4, 0xc4, 0xa0,
-  0xdf, 0xa7, 0xcb, 0xd6, 0x16, 0x87, 0xb8, 0x40, 0x11, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0xf0, 0x55, 0x40, 0x3d, 0x2e, 0x7d, 0xff, 0xc8, 0xe9, 0x1d,
-  0x26, 0x52, 0xbe, 0x80, 0x02, 0x2f, 0xbd, 0xe3, 0x91, 0xe7, 0x98, 0xf3,
-  0x99, 0xde, 0x4d, 0xd0, 0xcd, 0x02, 0x09, 0x01, 0x04, 0xc2, 0x16, 0x68,
-  0xe6, 0x7d, 0x07, 0x28, 0xa0, 0x20, 0x15, 0x0b, 0x0c, 0x39, 0x82, 0xa0,
-  0x6d, 0x6d, 0xc0, 0x7b, 0xb3, 0x61, 0xff, 0x1e, 0x51, 0x7a, 0x04, 0x10,
-  0x40, 0x20, 0x09, 0x81, 0xdc, 0xa7, 0xb6, 0xfa, 0x63, 0x48, 0xda, 0x5b,
-  0x60, 0xc8, 0x09, 0x36, 0x14, 0xb0, 0xb5, 0x6c, 0x6b, 0x24, 0x71, 0x95,
-  0x51, 0x49, 0x04, 0xd2, 0x10, 0xe8, 0xfb, 0x20, 0x46, 0xbd, 0xe3, 0xa4,
-  0xfe, 0x02, 0x43, 0x4c, 0xb0, 0x21, 0x73, 0x3d, 0xc8, 0x9a, 0x4f, 0xe3,
-  0x12, 0xa3, 0x96, 0x08, 0x20, 0x80, 0x00, 0x02, 0x31, 0x08, 0xe8, 0x69,
-  0x61, 0xdf, 0x9b, 0x86, 0x99, 0x99, 0x19, 0xee, 0x19, 0x76, 0x09, 0x54,
-  0x10, 0x78, 0x69, 0x62, 0x0d, 0x3d, 0x2d, 0x27, 0x21, 0x80, 0x40, 0x5c,
-  0x02, 0xed, 0xbc, 0xef, 0x53, 0x46, 0x2a, 0x12, 0xdc, 0x8b, 0x00, 0x00,
-  0x08, 0x44, 0x49, 0x44, 0x41, 0x54, 0x14, 0x5c, 0xfb, 0xe7, 0x64, 0xc8,
-  0x11, 0x04, 0xfa, 0xdb, 0xb5, 0x62, 0x1b, 0xc3, 0x0d, 0xe3, 0xfa, 0x3d,
-  0xa2, 0x36, 0x08, 0x20, 0x80, 0x40, 0x12, 0x02, 0x7a, 0x7a, 0xc8, 0x30,
-  0xc4, 0x82, 0x50, 0xb3, 0x82, 0xc0, 0x8b, 0xa7, 0xb4, 0x49, 0xfc, 0x3a,
-  0x51, 0xc9, 0x84, 0x05, 0x96, 0xf3, 0xbe, 0x4b, 0x19, 0x86, 0xf8, 0xfc,
-  0x97, 0x6c, 0x05, 0x81, 0x97, 0x82, 0xdd, 0x46, 0xc2, 0xd7, 0x1a, 0x55,
-  0x47, 0x00, 0x01, 0x04, 0x10, 0x08, 0x5c, 0xa0, 0xc5, 0x4d, 0x43, 0xff,
-  0xe8, 0xab, 0xa2, 0xc0, 0x4b, 0x37, 0x66, 0x3c, 0xa5, 0x0d, 0xfc, 0x17,
-  0x85, 0xe2, 0x23, 0x50, 0x20, 0x90, 0x3b, 0xa2, 0x40, 0x93, 0x4a, 0xa4,
-  0x9e, 0x2a, 0x08, 0xbc, 0x3a, 0xd6, 0x06, 0xac, 0xe9, 0xc5, 0xaf, 0x22,
-  0x02, 0x08, 0x20, 0x80, 0x40, 0xf0, 0x02, 0xfa, 0x63, 0xd6, 0xb7, 0x07,
-  0x4c, 0x37, 0x0d, 0x29, 0x4e, 0xa1, 0x5c, 0x41, 0xe0, 0xc5, 0x7b, 0x5e,
-  0xc1, 0xff, 0x6a, 0x50, 0x01, 0x04, 0x4a, 0x0b, 0x28, 0x40, 0xe8, 0xfb,
-  0x7d, 0x9a, 0xea, 0x7b, 0xb5, 0x7a, 0xc7, 0x6b, 0x88, 0xc9, 0x8a, 0x7a,
-  0xef, 0x79, 0xe9, 0x9d, 0x65, 0x12, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0xd1, 0x08, 0xe4, 0xde, 0x34, 0xa4, 0x34, 0x74, 0x66, 0x7d, 0x7d, 0x7d,
-  0x5b, 0x6b, 0xa0, 0xe5, 0xdd, 0x44, 0x39, 0x7c, 0xd6, 0xb6, 0x3c, 0xcc,
-  0xc6, 0x15, 0xcd, 0xaf, 0x07, 0x15, 0x41, 0xc0, 0x59, 0x20, 0x77, 0x62,
-  0xa3, 0xd4, 0x1e, 0x68, 0x0d, 0x39, 0xab, 0x61, 0xef, 0x7b, 0x78, 0xd9,
-  0xf4, 0x19, 0x41, 0xe0, 0x7c, 0x09, 0x92, 0x11, 0x01, 0x04, 0x10, 0x40,
-  0x20, 0x14, 0x01, 0xfd, 0x81, 0xcb, 0x0d, 0x3a, 0x62, 0x7f, 0x81, 0xbc,
-  0x82, 0xa1, 0x31, 0xf2, 0x53, 0xe0, 0xd5, 0x0c, 0xa5, 0xd1, 0x29, 0x27,
-  0x02, 0x08, 0x54, 0x2e, 0xa0, 0x40, 0x21, 0xf7, 0xbd, 0x5a, 0x2d, 0x2e,
-  0x1c, 0x73, 0xd2, 0x88, 0x89, 0x21, 0xd7, 0xf1, 0xea, 0xfd, 0x2d, 0x6a,
-  0x99, 0x65, 0xa3, 0xf2, 0x16, 0xe2, 0x80, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x78, 0x22, 0x50, 0x78, 0xd3, 0x10, 0xe3, 0x34, 0xca, 0xba, 0x51,
-  0xa8, 0xe8, 0x09, 0x6d, 0xc7, 0xda, 0x71, 0xde, 0x93, 0xb6, 0xa4, 0x18,
-  0x08, 0x20, 0x50, 0xaf, 0x40, 0xe1, 0x03, 0x2d, 0x0d, 0xc9, 0x8b, 0x2d,
-  0x55, 0x34, 0x7a, 0x40, 0xc1, 0x97, 0xd6, 0xa7, 0x24, 0xf0, 0xaa, 0xf7,
-  0x1a, 0xe6, 0xec, 0x08, 0x20, 0x80, 0x00, 0x02, 0x63, 0x12, 0x28, 0xbc,
-  0x69, 0xd0, 0xd0, 0xbc, 0x18, 0x92, 0x7a, 0xf3, 0xf4, 0x14, 0x5a, 0xc3,
-  0x81, 0xcc, 0x76, 0x98, 0x8d, 0xc0, 0x6b, 0x4c, 0x17, 0x27, 0xa7, 0x41,
-  0x20, 0x20, 0x81, 0xc2, 0x07, 0x5a, 0xfa, 0xee, 0x51, 0xc0, 0x12, 0x7a,
-  0xea, 0x3d, 0xc4, 0xd2, 0x03, 0xba, 0x21, 0xbf, 0x4b, 0x19, 0x41, 0x10,
-  0xd0, 0x05, 0x4e, 0x51, 0x11, 0x40, 0x00, 0x01, 0x04, 0xaa, 0x13, 0xd0,
-  0x4d, 0x83, 0x02, 0x8a, 0xdc, 0x3f, 0xa4, 0xa1, 0x06, 0x61, 0xbd, 0x1b,
-  0x85, 0x21, 0x5f, 0x04, 0xef, 0xd9, 0x10, 0x78, 0x55, 0x77, 0xdd, 0x71,
-  0x24, 0x04, 0x62, 0x14, 0x28, 0x7c, 0xa0, 0x15, 0x72, 0x10, 0xd6, 0xeb,
-  0xed, 0xaa, 0xe0, 0x21, 0x16, 0x81, 0x57, 0x8c, 0x57, 0x3f, 0x75, 0x42,
-  0x00, 0x01, 0x04, 0x10, 0x28, 0x25, 0x90, 0x3b, 0x23, 0x62, 0x2f, 0x38,
-  0x53, 0x10, 0x16, 0xca, 0xcc, 0x88, 0x1a, 0xea, 0xa3, 0xf2, 0x56, 0x74,
-  0xa3, 0x40, 0xe0, 0x55, 0xea, 0x72, 0x22, 0x33, 0x02, 0x49, 0x0b, 0x68,
-  0xd1, 0xf5, 0xdc, 0x07, 0x5a, 0xfa, 0x5e, 0xd2, 0xfb, 0xa7, 0x21, 0x24,
-  0x05, 0x5d, 0x1a, 0x39, 0x30, 0x39, 0x39, 0x59, 0x45, 0x6f, 0x17, 0x81,
-  0x57, 0xd2, 0xbf, 0x1a, 0x54, 0x1e, 0x01, 0x04, 0x10, 0x40, 0x60, 0xb7,
-  0x40, 0xab, 0xe8, 0xa6, 0x41, 0x9f, 0xeb, 0x8f, 0xb0, 0xaf, 0x37, 0x0e,
-  0x15, 0x07, 0x5d, 0xba, 0x51, 0x20, 0xf0, 0xe2, 0xf7, 0x04, 0x01, 0x04,
-  0xca, 0x0a, 0xe4, 0xae, 0x0b, 0xb6, 0xf3, 0x7b, 0xd6, 0xd7, 0x99, 0x66,
-  0x47, 0x10, 0x74, 0xf5, 0x96, 0xe7, 0x60, 0x96, 0xd8, 0xb2, 0x57, 0x13,
-  0xf9, 0x11, 0x40, 0x00, 0x01, 0x04, 0xa2, 0x16, 0xd0, 0x50, 0xc4, 0xc2,
-  0x27, 0xb7, 0x3b, 0x7b, 0xc3, 0xea, 0x9e, 0x21, 0x51, 0x37, 0x09, 0x27,
-  0x4f, 0x9e, 0xdc, 0x9e, 0x99, 0x99, 0xa9, 0xea, 0xc9, 0x6c, 0xef, 0x38,
-  0x6d, 0xab, 0xe7, 0x7c, 0xd4, 0xad, 0x4d, 0xe5, 0x10, 0x40, 0x60, 0x94,
-  0x02, 0xfa, 0xfe, 0x70, 0xfa, 0x5e, 0xd2, 0x43, 0xad, 0xba, 0xd7, 0x09,
-  0xeb, 0x0d, 0xd5, 0xd6, 0xa8, 0x81, 0x0a, 0x7b, 0xba, 0x7a, 0xeb, 0x78,
-  0xe9, 0xe1, 0x5e, 0x63, 0x94, 0xd8, 0x1c, 0x1b, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x81, 0x90, 0x05, 0xf4, 0x74, 0x32, 0x77, 0x2a, 0xe5, 0xdd, 0x37,
-  0x15, 0x7a, 0xb7, 0x4a, 0x37, 0x0f, 0xa3, 0x1e, 0x9a, 0xa8, 0x60, 0x4f,
-  0x3d, 0x6f, 0x7a, 0x62, 0xac, 0x80, 0xab, 0xa2, 0xa1, 0x85, 0xbb, 0x6f,
-  0x90, 0x34, 0x0b, 0x57, 0x33, 0xe4, 0x06, 0xa4, 0xec, 0x08, 0x20, 0xe0,
-  0x8d, 0x80, 0x02, 0x0f, 0xa7, 0x20, 0x4c, 0xf9, 0x14, 0xf8, 0xe8, 0x81,
-  0xd2, 0x38, 0x1e, 0x6c, 0xe9, 0xbb, 0x54, 0xdf, 0xdb, 0x23, 0x08, 0xb8,
-  0x76, 0xbe, 0x2f, 0xbb, 0x6c, 0xf5, 0x62, 0x1d, 0x2f, 0x6f, 0x2e, 0x47,
-  0x0a, 0x82, 0x40, 0x5a, 0x02, 0xfb, 0xd2, 0xaa, 0x2e, 0xb5, 0x8d, 0x40,
-  0x40, 0x41, 0x58, 0xdb, 0xb6, 0x89, 0xb2, 0x75, 0xb1, 0x19, 0xb1, 0xb2,
-  0x23, 0x47, 0x8e, 0x64, 0x8d, 0x46, 0x23, 0x6b, 0x36, 0x9f, 0x8b, 0x63,
-  0x0e, 0x1d, 0x3a, 0xd4, 0xfd, 0x7f, 0xfd, 0xd2, 0xe5, 0xcb, 0x97, 0xb3,
-  0x8d, 0x0d, 0x75, 0xbc, 0x3d, 0x9f, 0xda, 0x6d, 0x9d, 0xde, 0xba, 0xe3,
-  0xec, 0xff, 0xeb, 0xf3, 0xf3, 0xe7, 0xcf, 0x97, 0x2d, 0x4a, 0x99, 0xfc,
-  0x5b, 0x96, 0xb9, 0x65, 0xdb, 0x8a, 0x6d, 0x9d, 0x32, 0x3b, 0x92, 0x17,
-  0x01, 0x04, 0x10, 0x28, 0x10, 0xd0, 0x77, 0xcb, 0x5c, 0x59, 0x25, 0x0b,
-  0xc6, 0xba, 0xdf, 0xa1, 0x3b, 0xbf, 0x4b, 0x7b, 0xdf, 0xa9, 0x45, 0xc7,
-  0xda, 0xfd, 0x9d, 0xda, 0xfb, 0x3e, 0xd5, 0xbf, 0xfa, 0x6c, 0x73, 0x73,
-  0xb3, 0xe8, 0x10, 0xc3, 0x7c, 0xae, 0x2f, 0x6b, 0xd5, 0x59, 0x1b, 0x09,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x4a, 0x08, 0x94, 0xee, 0x09,
-  0xb3, 0x63, 0x3b, 0x3f, 0xe9, 0xf5, 0x24, 0xaf, 0xa2, 0xbe, 0x79, 0xdb,
-  0x78, 0x42, 0x5b, 0xe2, 0xc2, 0x20, 0x2b, 0x02, 0x08, 0x94, 0x16, 0x50,
-  0x30, 0x12, 0xda, 0xf7, 0x63, 0x99, 0xf2, 0x6a, 0xd4, 0x84, 0xea, 0xc8,
-  0xfb, 0x5d, 0xa5, 0x2f, 0x0d, 0x76, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0xe0, 0x85, 0x02, 0x0d, 0xfb, 0x4f, 0xe7, 0x77, 0xc2, 0x02, 0xb9, 0xc1,
-  0xe0, 0x46, 0x81, 0xab, 0x1c, 0x01, 0x04, 0xea, 0x10, 0x58, 0x0c, 0xe4,
-  0x3b, 0xb2, 0x4c, 0xe0, 0xa5, 0x21, 0xdb, 0x7a, 0x88, 0x45, 0x42, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x81, 0x0a, 0x05, 0xd4, 0x3b, 0xa4, 0xa1,
-  0x79, 0x65, 0xfe, 0x28, 0xfb, 0x98, 0x97, 0x1b, 0x85, 0x0a, 0x2f, 0x0a,
-  0x0e, 0x85, 0x00, 0x02, 0x03, 0x09, 0x34, 0x6d, 0xaf, 0x4e, 0xe0, 0xdf,
-  0xa7, 0x7a, 0x28, 0xa7, 0x60, 0xb2, 0x31, 0x90, 0x00, 0x3b, 0x21, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x80, 0xb3, 0x80, 0x6e, 0x1c, 0x42, 0xeb,
-  0x0d, 0xeb, 0x05, 0x5d, 0x0c, 0x31, 0x74, 0x6e, 0x66, 0x32, 0x22, 0x80,
-  0xc0, 0x88, 0x05, 0x42, 0x7c, 0xa8, 0x45, 0xd0, 0x35, 0xe2, 0x8b, 0x82,
-  0xc3, 0x23, 0x80, 0x00, 0x02, 0x08, 0x20, 0x90, 0x27, 0x30, 0xef, 0x71,
-  0x20, 0xa6, 0x27, 0xcb, 0xea, 0xad, 0x9b, 0xa5, 0x09, 0x11, 0x40, 0x00,
-  0x01, 0xcf, 0x05, 0x1a, 0x56, 0xbe, 0x96, 0x6d, 0x3e, 0x8e, 0x18, 0xe8,
-  0x0d, 0xd5, 0xd6, 0xf7, 0x3d, 0x0f, 0xb0, 0x3c, 0xbf, 0x90, 0x28, 0x1e,
-  0x02, 0x08, 0x20, 0x80, 0x40, 0x3a, 0x02, 0x7a, 0xd9, 0x5a, 0x37, 0x0f,
-  0xa5, 0xa6, 0xac, 0xaf, 0xf8, 0x66, 0x43, 0x4f, 0x65, 0x15, 0x70, 0xe9,
-  0x26, 0x41, 0x37, 0x33, 0x24, 0x04, 0x10, 0x40, 0x20, 0x34, 0x01, 0x7d,
-  0x77, 0x69, 0x48, 0x5f, 0x9d, 0x23, 0x0c, 0x3a, 0x76, 0x7e, 0x8d, 0x18,
-  0x50, 0x39, 0x98, 0x48, 0x23, 0xb4, 0x2b, 0x88, 0xf2, 0x22, 0x80, 0xc0,
-  0x9e, 0x02, 0x4c, 0x43, 0xcf, 0x85, 0x11, 0xbb, 0x80, 0xfe, 0x60, 0x37,
-  0xaf, 0x6e, 0xfa, 0x79, 0xb2, 0xe2, 0x0a, 0xf7, 0xe6, 0xa0, 0x6f, 0xdb,
-  0x71, 0x75, 0xa3, 0xa0, 0x4d, 0x3f, 0x93, 0x10, 0x40, 0x00, 0x81, 0x98,
-  0x04, 0x1a, 0x56, 0x19, 0xf5, 0xe0, 0xeb, 0x7b, 0x54, 0xdb, 0x54, 0xc5,
-  0x95, 0xd3, 0x92, 0x1b, 0x0a, 0xf4, 0x76, 0x7e, 0x8f, 0xea, 0xbf, 0xf5,
-  0x20, 0x8d, 0x84, 0x00, 0x02, 0x08, 0x44, 0x25, 0x40, 0x00, 0x16, 0x55,
-  0x73, 0x52, 0x19, 0x47, 0x01, 0xdd, 0x3c, 0xf4, 0x86, 0xae, 0xec, 0xfc,
-  0xb9, 0xdf, 0xee, 0xbb, 0x03, 0xaa, 0xde, 0x0d, 0x82, 0xe3, 0xe9, 0xc8,
-  0x86, 0x00, 0x02, 0x08, 0x44, 0x29, 0xd0, 0xfb, 0xfe, 0x54, 0x70, 0xa6,
-  0xcd, 0x35, 0xed, 0xfc, 0x0e, 0x55, 0x80, 0xa5, 0x40, 0x8b, 0x84, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08,
-  0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,
-  0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x49,
-  0x08, 0xdc, 0xff, 0xb2, 0xd7, 0x65, 0xb6, 0xed, 0x4f, 0xa2, 0xb2, 0x54,
-  0x12, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01,
-  0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00,
-  0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x52, 0x16, 0xb8, 0xff,
-  0x65, 0xaf, 0xdb, 0x97, 0x72, 0xfd, 0xa9, 0x3b, 0x02, 0x08, 0x20, 0x50,
-  0xb7, 0xc0, 0xfe, 0xba, 0x0b, 0xc0, 0xf9, 0x11, 0x40, 0x00, 0x01, 0x04,
-  0x10, 0x40, 0x60, 0xac, 0x02, 0x2f, 0x1b, 0xeb, 0xd9, 0x38, 0x19, 0x02,
-  0x08, 0x20, 0x80, 0xc0, 0x0b, 0x04, 0x08, 0xc0, 0xb8, 0x20, 0x10, 0x40,
-  0x00, 0x01, 0x04, 0x10, 0x48, 0x4b, 0x60, 0xdb, 0x7a, 0xc1, 0xf8, 0xfb,
-  0x9f, 0x56, 0x9b, 0x53, 0x5b, 0x04, 0x10, 0x40, 0x00, 0x01, 0x04, 0x10,
-  0x40, 0x00, 0x01, 0x04, 0x10, 0xa8, 0x4b, 0x80, 0x00, 0xac, 0x2e, 0x79,
-  0xce, 0x8b, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
-  0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02,
-  0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20,
-  0x80, 0x40, 0x6c, 0x02, 0xff, 0x1f, 0xf6, 0x3c, 0xe9, 0xac, 0x37, 0x80,
-  0x64, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
-  0x60, 0x82
+static const uint32_t bongo_cat_both_down_png_runs[] = {
+  0x3405, 0x00000000, 0x1, 0x20000000, 0x1, 0x40000000, 0x1, 0x30000000,
+  0x35b, 0x00000000, 0x1, 0x10000000, 0x1, 0xb0000000, 0x3, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x40000000, 0x359, 0x00000000, 0x1, 0xb0000000,
+  0x6, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000, 0x356, 0x00000000,
+  0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x353, 0x00000000, 0x1, 0x60000000, 0xb, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0x351, 0x00000000, 0x1, 0x50000000, 0xe, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x40000000, 0x34e, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x10, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000,
+  0x34b, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000, 0x12, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x70000000, 0x34a, 0x00000000, 0x1, 0xb0000000,
+  0x15, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000, 0x347, 0x00000000,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff7f7f7f, 0x1, 0xff1f1f1f,
+  0xd, 0xff000000, 0x1, 0x80000000, 0x345, 0x00000000, 0x1, 0x40000000,
+  0x9, 0xff000000, 0x1, 0xff8f8f8f, 0x2, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x1, 0xff0f0f0f, 0xc, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000,
+  0x342, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x4, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f,
+  0xd, 0xff000000, 0x1, 0x70000000, 0x341, 0x00000000, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x6, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f, 0xc, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x20000000, 0x33e, 0x00000000, 0x1, 0x70000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x9, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x33c, 0x00000000, 0x1, 0x30000000, 0x9, 0xff000000, 0x1, 0xffbfbfbf,
+  0xb, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xc, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x10000000, 0x33a, 0x00000000, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xff7f7f7f, 0xe, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000,
+  0x338, 0x00000000, 0x1, 0x90000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x10, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xb, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x336, 0x00000000, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x12, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0x90000000,
+  0x334, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x14, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x10000000, 0x332, 0x00000000,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x17, 0xffffffff,
+  0x1, 0xff8f8f8f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x330, 0x00000000, 0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffefefef, 0x18, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f,
+  0xb, 0xff000000, 0x1, 0x60000000, 0x32f, 0x00000000, 0x1, 0xd0000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x1a, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0x90000000, 0x32d, 0x00000000,
+  0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x1d, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xa0000000,
+  0x1, 0x10000000, 0x32a, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x1e, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xa, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x10000000, 0x329, 0x00000000, 0x1, 0xa0000000, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x20, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0xa, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000, 0x327, 0x00000000,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff4f4f4f, 0x23, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xa, 0xff000000, 0x1, 0xf0000000, 0x1, 0x30000000,
+  0x326, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x24, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x40000000, 0x324, 0x00000000, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x26, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0x60000000, 0x323, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f, 0x28, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x321, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x29, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x31f, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x2c, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x31e, 0x00000000, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x2d, 0xffffffff, 0x1, 0xff5f5f5f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x31c, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x2f, 0xffffffff,
+  0x1, 0xff8f8f8f, 0xa, 0xff000000, 0x1, 0x60000000, 0x31b, 0x00000000,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x30, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x319, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x32, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x318, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x33, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0x60000000, 0x316, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x35, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0x50000000, 0x315, 0x00000000,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x36, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0xf7000000,
+  0x1, 0xa0000000, 0x1, 0x90000000, 0x1, 0x80000000, 0x1, 0x50000000,
+  0x9, 0x40000000, 0xe7, 0x00000000, 0x1, 0x88000000, 0x1, 0xa0000000,
+  0x1, 0xc1000000, 0x1, 0xbf000000, 0x1, 0x20000000, 0x21c, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x38, 0xffffffff,
+  0x1, 0xff0f0f0f, 0x1c, 0xff000000, 0x1, 0xf0000000, 0x3, 0xe0000000,
+  0x1, 0xdc000000, 0x1, 0xc4000000, 0x3, 0xa0000000, 0x1, 0x88000000,
+  0x1, 0x50000000, 0x3, 0x40000000, 0x1, 0x10000000, 0xd0, 0x00000000,
+  0x1, 0x88000000, 0x1, 0xf9000000, 0x4, 0xff000000, 0x1, 0xf3000000,
+  0x1, 0x30000000, 0x21a, 0x00000000, 0x1, 0x60000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x38, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x2d, 0xff000000, 0x1, 0xf8000000, 0x2, 0xe0000000, 0x1, 0xd4000000,
+  0x1, 0xac000000, 0x1, 0xa0000000, 0x1, 0x90000000, 0x1, 0x50000000,
+  0x2, 0x40000000, 0x1, 0x10000000, 0xc1, 0x00000000, 0x1, 0x64000000,
+  0x1, 0xf3000000, 0x7, 0xff000000, 0x1, 0xf4000000, 0x1, 0x10000000,
+  0x219, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x3a, 0xffffffff, 0x1, 0xff9f9f9f, 0x39, 0xff000000, 0x2, 0xe0000000,
+  0x1, 0xc4000000, 0x1, 0xa0000000, 0x1, 0x90000000, 0x1, 0x50000000,
+  0x1, 0x40000000, 0x1, 0x30000000, 0xb5, 0x00000000, 0x1, 0x4a000000,
+  0x1, 0xe8000000, 0xa, 0xff000000, 0x1, 0x80000000, 0x218, 0x00000000,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xffefefef, 0x3b, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x42, 0xff000000, 0x1, 0xe0000000, 0x1, 0xd8000000,
+  0x1, 0xac000000, 0x1, 0x98000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x1, 0x30000000, 0xaa, 0x00000000, 0x1, 0x2e000000, 0x1, 0xd0000000,
+  0xc, 0xff000000, 0x1, 0xf3000000, 0x218, 0x00000000, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x3d, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x49, 0xff000000, 0x1, 0xf8000000, 0x1, 0xe0000000, 0x1, 0xc4000000,
+  0x1, 0xa0000000, 0x1, 0x70000000, 0x1, 0x40000000, 0x1, 0x30000000,
+  0xa0, 0x00000000, 0x1, 0x10000000, 0x1, 0xc0000000, 0xf, 0xff000000,
+  0x1, 0x60000000, 0x216, 0x00000000, 0x1, 0x10000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x3e, 0xffffffff, 0x1, 0xff6f6f6f, 0x50, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xd8000000, 0x1, 0xb8000000, 0x1, 0x90000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x98, 0x00000000, 0x1, 0xb0000000,
+  0x1, 0xfd000000, 0x10, 0xff000000, 0x1, 0xe2000000, 0x216, 0x00000000,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x40, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x56, 0xff000000, 0x1, 0xf8000000, 0x1, 0xd8000000,
+  0x1, 0xac000000, 0x1, 0x88000000, 0x1, 0x40000000, 0x1, 0x30000000,
+  0x8f, 0x00000000, 0x1, 0x88000000, 0x1, 0xf9000000, 0x13, 0xff000000,
+  0x1, 0x40000000, 0x215, 0x00000000, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xffafafaf, 0x41, 0xffffffff, 0x1, 0xffdfdfdf, 0x4, 0xffbfbfbf,
+  0x1, 0xff8f8f8f, 0x9, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x6, 0xff3f3f3f,
+  0x47, 0xff000000, 0x1, 0xe8000000, 0x1, 0xc4000000, 0x1, 0x90000000,
+  0x1, 0x50000000, 0x1, 0x40000000, 0x87, 0x00000000, 0x1, 0x64000000,
+  0x1, 0xf3000000, 0x15, 0xff000000, 0x1, 0xa0000000, 0x214, 0x00000000,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x5d, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x3, 0xffbfbfbf, 0x1, 0xffafafaf, 0x3, 0xff7f7f7f,
+  0x1, 0xff6f6f6f, 0x3, 0xff3f3f3f, 0x1, 0xff1f1f1f, 0x3b, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xc4000000, 0x1, 0x90000000, 0x1, 0x50000000,
+  0x1, 0x30000000, 0x7f, 0x00000000, 0x1, 0x4a000000, 0x1, 0xe8000000,
+  0xe, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xff1f1f1f, 0x8, 0xff000000,
+  0x1, 0x10000000, 0x212, 0x00000000, 0x1, 0x60000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x6c, 0xffffffff, 0x1, 0xffefefef,
+  0x3, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff6f6f6f, 0x2, 0xff3f3f3f,
+  0x1, 0xff2f2f2f, 0x35, 0xff000000, 0x1, 0xe5000000, 0x1, 0xb8000000,
+  0x1, 0x88000000, 0x1, 0x40000000, 0x1, 0x10000000, 0x77, 0x00000000,
+  0x1, 0x2e000000, 0x1, 0xd0000000, 0xe, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0x1, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0x70000000, 0x210, 0x00000000, 0x1, 0x40000000, 0x1, 0xe0000000,
+  0x9, 0xff000000, 0x1, 0xffdfdfdf, 0x78, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xffbfbfbf, 0x1, 0xffafafaf, 0x2, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x30, 0xff000000, 0x1, 0xf8000000,
+  0x1, 0xd4000000, 0x1, 0x90000000, 0x1, 0x50000000, 0x1, 0x20000000,
+  0x70, 0x00000000, 0x1, 0x10000000, 0x1, 0xc0000000, 0xe, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x3, 0xffffffff, 0x1, 0xffefefef,
+  0x8, 0xff000000, 0x1, 0xe4000000, 0x20e, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xc0000000, 0xa, 0xff000000, 0x1, 0xff4f4f4f, 0x83, 0xffffffff,
+  0x2, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x1, 0xff3f3f3f,
+  0x1, 0xff0f0f0f, 0x2d, 0xff000000, 0x1, 0xd8000000, 0x1, 0xa5000000,
+  0x1, 0x60000000, 0x1, 0x30000000, 0x6a, 0x00000000, 0x1, 0xb0000000,
+  0x1, 0xfd000000, 0xd, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f,
+  0x1, 0xffefefef, 0x5, 0xffffffff, 0x1, 0xff5f5f5f, 0x8, 0xff000000,
+  0x1, 0x30000000, 0x20b, 0x00000000, 0x1, 0x10000000, 0x1, 0x90000000,
+  0xc, 0xff000000, 0x1, 0xff9f9f9f, 0x8b, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff3f3f3f, 0x2b, 0xff000000, 0x1, 0xd4000000, 0x1, 0x90000000,
+  0x1, 0x50000000, 0x1, 0x20000000, 0x63, 0x00000000, 0x1, 0x88000000,
+  0x1, 0xf9000000, 0xe, 0xff000000, 0x1, 0xff6f6f6f, 0x1, 0xffefefef,
+  0x7, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0x90000000,
+  0x20a, 0x00000000, 0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff3f3f3f, 0x93, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffbfbfbf,
+  0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff5f5f5f, 0x1, 0xff3f3f3f,
+  0x28, 0xff000000, 0x1, 0xf8000000, 0x1, 0xc9000000, 0x1, 0x88000000,
+  0x1, 0x40000000, 0x1, 0x10000000, 0x5c, 0x00000000, 0x1, 0x3d000000,
+  0x1, 0xf0000000, 0xe, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf,
+  0xa, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xf3000000,
+  0x208, 0x00000000, 0x1, 0x40000000, 0x1, 0xd0000000, 0xd, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x9a, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xffbfbfbf, 0x1, 0xff9f9f9f, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f,
+  0x1, 0xff2f2f2f, 0x26, 0xff000000, 0x1, 0xe5000000, 0x1, 0xb2000000,
+  0x1, 0x60000000, 0x1, 0x30000000, 0x57, 0x00000000, 0x1, 0x7e000000,
+  0x1, 0xfd000000, 0xd, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf,
+  0xc, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000, 0x1, 0x50000000,
+  0x205, 0x00000000, 0x1, 0x10000000, 0x1, 0xb0000000, 0xd, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0xa2, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff2f2f2f, 0x24, 0xff000000, 0x1, 0xf8000000, 0x1, 0xc9000000,
+  0x1, 0x88000000, 0x1, 0x40000000, 0x51, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xc4000000, 0xd, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf,
+  0xe, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0xa0000000,
+  0x204, 0x00000000, 0x1, 0x70000000, 0x1, 0xf0000000, 0xd, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0xaa, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x1, 0xff1f1f1f,
+  0x23, 0xff000000, 0x1, 0xd8000000, 0x1, 0x9e000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x4b, 0x00000000, 0x1, 0x3d000000, 0x1, 0xed000000,
+  0xc, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x11, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0xf3000000, 0x202, 0x00000000,
+  0x1, 0x40000000, 0x1, 0xd0000000, 0xd, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffdfdfdf, 0xb2, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f,
+  0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f, 0x22, 0xff000000, 0x1, 0xe2000000,
+  0x1, 0x9e000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x46, 0x00000000,
+  0x1, 0x71000000, 0x1, 0xfc000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x12, 0xffffffff, 0x1, 0xff8f8f8f,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x1ff, 0x00000000, 0x1, 0x10000000,
+  0x1, 0x90000000, 0xd, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf,
+  0xb9, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff9f9f9f, 0x1, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f, 0x20, 0xff000000, 0x1, 0xe2000000,
+  0x1, 0x9e000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x41, 0x00000000,
+  0x1, 0xba000000, 0xc, 0xff000000, 0x1, 0xff6f6f6f, 0x1, 0xffefefef,
+  0x14, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000, 0x1, 0x90000000,
+  0x1fe, 0x00000000, 0x1, 0x50000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0xc0, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x1, 0xff0f0f0f,
+  0x1f, 0xff000000, 0x1, 0xe2000000, 0x1, 0x9e000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x3b, 0x00000000, 0x1, 0x20000000, 0x1, 0xeb000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0x17, 0xffffffff,
+  0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0xe4000000, 0x1fc, 0x00000000,
+  0x1, 0x20000000, 0x1, 0xb0000000, 0xd, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0xc6, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f,
+  0x1, 0xff6f6f6f, 0x1, 0xff3f3f3f, 0x1f, 0xff000000, 0x1, 0xd4000000,
+  0x1, 0x88000000, 0x1, 0x40000000, 0x37, 0x00000000, 0x1, 0x58000000,
+  0x1, 0xfc000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f,
+  0x19, 0xffffffff, 0x1, 0xff8f8f8f, 0x8, 0xff000000, 0x1, 0x20000000,
+  0x1fa, 0x00000000, 0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf, 0xcd, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff8f8f8f, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x1d, 0xff000000,
+  0x1, 0xf8000000, 0x1, 0xc4000000, 0x1, 0x70000000, 0x1, 0x20000000,
+  0x32, 0x00000000, 0x1, 0xa8000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffcfcfcf, 0x1a, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000,
+  0x1, 0x70000000, 0x1f8, 0x00000000, 0x1, 0x20000000, 0x1, 0xc0000000,
+  0xc, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0xd3, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xffafafaf, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f,
+  0x1d, 0xff000000, 0x1, 0xee000000, 0x1, 0xac000000, 0x1, 0x50000000,
+  0x1, 0x10000000, 0x2c, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x1c, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xb0000000, 0x1f7, 0x00000000,
+  0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000, 0x1, 0xff5f5f5f,
+  0x1, 0xffefefef, 0xd9, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff8f8f8f,
+  0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x1c, 0xff000000, 0x1, 0xd4000000,
+  0x1, 0x70000000, 0x1, 0x30000000, 0x28, 0x00000000, 0x1, 0x3d000000,
+  0x1, 0xfb000000, 0xb, 0xff000000, 0x1, 0xff9f9f9f, 0x1e, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x7, 0xff000000, 0x1, 0xf4000000, 0x1f5, 0x00000000,
+  0x1, 0x20000000, 0x1, 0xc0000000, 0xc, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0xdf, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f,
+  0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x1b, 0xff000000, 0x1, 0xee000000,
+  0x1, 0xac000000, 0x1, 0x50000000, 0x1, 0x10000000, 0x23, 0x00000000,
+  0x1, 0x94000000, 0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffcfcfcf,
+  0x1f, 0xffffffff, 0x1, 0xffafafaf, 0x8, 0xff000000, 0x1, 0x30000000,
+  0x1f3, 0x00000000, 0x1, 0x70000000, 0x1, 0xf0000000, 0xc, 0xff000000,
+  0x1, 0xff7f7f7f, 0xe5, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f,
+  0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x1b, 0xff000000, 0x1, 0xc4000000,
+  0x1, 0x70000000, 0x1, 0x20000000, 0x1e, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xd3000000, 0xb, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef,
+  0x20, 0xffffffff, 0x1, 0xffefefef, 0x8, 0xff000000, 0x1, 0x70000000,
+  0x1f1, 0x00000000, 0x1, 0x10000000, 0x1, 0xb0000000, 0xc, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0xea, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x1a, 0xff000000,
+  0x1, 0xe2000000, 0x1, 0x97000000, 0x1, 0x30000000, 0x1a, 0x00000000,
+  0x1, 0x3d000000, 0x1, 0xf5000000, 0xb, 0xff000000, 0x1, 0xff8f8f8f,
+  0x23, 0xffffffff, 0x1, 0xff2f2f2f, 0x7, 0xff000000, 0x1, 0xb0000000,
+  0x1f0, 0x00000000, 0x1, 0x50000000, 0x1, 0xf0000000, 0xb, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0xf0, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f, 0x19, 0xff000000,
+  0x1, 0xee000000, 0x1, 0xac000000, 0x1, 0x50000000, 0x16, 0x00000000,
+  0x1, 0x7e000000, 0x1, 0xfd000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffbfbfbf, 0x24, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xf3000000, 0x1ee, 0x00000000, 0x1, 0x10000000, 0x1, 0x90000000,
+  0xc, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0xf5, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff7f7f7f, 0x1, 0xff3f3f3f, 0x19, 0xff000000,
+  0x1, 0xf8000000, 0x1, 0xb2000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x10, 0x00000000, 0x1, 0x10000000, 0x1, 0xc4000000, 0xb, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffefefef, 0x25, 0xffffffff, 0x1, 0xffafafaf,
+  0x8, 0xff000000, 0x1, 0x20000000, 0x1ec, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xe0000000, 0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f,
+  0xfa, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf, 0x1, 0xff6f6f6f,
+  0x1, 0xff1f1f1f, 0x19, 0xff000000, 0x1, 0xbf000000, 0x1, 0x60000000,
+  0x1, 0x10000000, 0xc, 0x00000000, 0x1, 0x3d000000, 0x1, 0xed000000,
+  0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x27, 0xffffffff, 0x1, 0xffefefef,
+  0x8, 0xff000000, 0x1, 0x50000000, 0x1eb, 0x00000000, 0x1, 0x70000000,
+  0xc, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0xff, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f, 0x19, 0xff000000,
+  0x1, 0xc9000000, 0x1, 0x60000000, 0x1, 0x10000000, 0x8, 0x00000000,
+  0x1, 0x7e000000, 0x1, 0xfc000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x29, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1e9, 0x00000000, 0x1, 0x10000000, 0x1, 0xc0000000,
+  0xb, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0x105, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0x18, 0xff000000,
+  0x1, 0xdf000000, 0x1, 0x70000000, 0x1, 0x20000000, 0x4, 0x00000000,
+  0x1, 0xba000000, 0xb, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf,
+  0x2a, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x1e8, 0x00000000, 0x1, 0x40000000, 0x1, 0xf0000000, 0xb, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0x109, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f, 0x18, 0xff000000, 0x1, 0xc9000000,
+  0x1, 0x60000000, 0x1, 0x2e000000, 0x1, 0xeb000000, 0xb, 0xff000000,
+  0x1, 0xff6f6f6f, 0x2c, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xe6000000, 0x1e7, 0x00000000, 0x1, 0x80000000, 0xc, 0xff000000,
+  0x1, 0xff8f8f8f, 0x10e, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xffafafaf,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0x21, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x2d, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1e5, 0x00000000, 0x1, 0x10000000, 0x1, 0xc0000000, 0xb, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffcfcfcf, 0x113, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0x1d, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffcfcfcf, 0x2e, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x1e3, 0x00000000, 0x1, 0x40000000, 0x1, 0xf0000000,
+  0xb, 0xff000000, 0x1, 0xff6f6f6f, 0x1, 0xffefefef, 0x117, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff2f2f2f, 0x19, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x30, 0xffffffff, 0x8, 0xff000000,
+  0x1, 0x50000000, 0x1e2, 0x00000000, 0x1, 0x70000000, 0xb, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffafafaf, 0x11c, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff8f8f8f, 0x1, 0xff3f3f3f, 0x15, 0xff000000, 0x1, 0xff9f9f9f,
+  0x32, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1e0, 0x00000000, 0x1, 0x10000000, 0x1, 0xb0000000, 0xb, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffefefef, 0x120, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x10, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffcfcfcf, 0x33, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000,
+  0x1, 0x90000000, 0x1df, 0x00000000, 0x1, 0x30000000, 0x1, 0xd0000000,
+  0xb, 0xff000000, 0x1, 0xff7f7f7f, 0x125, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0xc, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffefefef, 0x34, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x1de, 0x00000000, 0x1, 0x50000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x129, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x8, 0xff000000,
+  0x1, 0xff8f8f8f, 0x36, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xcc000000, 0x1dd, 0x00000000, 0x1, 0x80000000, 0xb, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffefefef, 0x12d, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0x3, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0x37, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1db, 0x00000000, 0x1, 0x10000000, 0x1, 0xb0000000, 0xb, 0xff000000,
+  0x1, 0xff7f7f7f, 0x132, 0xffffffff, 0x1, 0xffefefef, 0x2, 0xffbfbfbf,
+  0x39, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1da, 0x00000000,
+  0x1, 0x30000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffbfbfbf, 0x16f, 0xffffffff, 0x1, 0xffdfdfdf, 0x8, 0xff000000,
+  0x1, 0x10000000, 0x1d8, 0x00000000, 0x1, 0x40000000, 0x1, 0xf0000000,
+  0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x171, 0xffffffff,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x1d7, 0x00000000, 0x1, 0x60000000,
+  0xb, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x172, 0xffffffff,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x1d6, 0x00000000, 0x1, 0x90000000,
+  0xb, 0xff000000, 0x1, 0xff9f9f9f, 0x174, 0xffffffff, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x1d4, 0x00000000, 0x1, 0x10000000, 0x1, 0xb0000000,
+  0xa, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x175, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x40000000, 0x1d3, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0xa, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x176, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1d2, 0x00000000, 0x1, 0x30000000, 0x1, 0xe0000000,
+  0xa, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x177, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x50000000, 0x1d1, 0x00000000,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0xa, 0xff000000, 0x1, 0xff7f7f7f,
+  0x179, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1d0, 0x00000000, 0x1, 0x60000000, 0xa, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x17a, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1cf, 0x00000000, 0x1, 0x60000000, 0xa, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x17b, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x60000000, 0x1ce, 0x00000000, 0x1, 0x90000000,
+  0xa, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffdfdfdf, 0x17c, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x40000000, 0x1cd, 0x00000000,
+  0x1, 0xa0000000, 0xa, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x17d, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x40000000,
+  0x1cb, 0x00000000, 0x1, 0x10000000, 0x1, 0xa0000000, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x17f, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1ca, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0xa, 0xff000000, 0x1, 0xff7f7f7f, 0x180, 0xffffffff, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x1c9, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0xa, 0xff000000, 0x1, 0xff9f9f9f, 0x181, 0xffffffff, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x1c8, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x182, 0xffffffff,
+  0x8, 0xff000000, 0x1, 0x40000000, 0x1c7, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x183, 0xffffffff, 0x8, 0xff000000, 0x1c7, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x183, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000, 0x1c6, 0x00000000,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffdfdfdf, 0x184, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1c5, 0x00000000, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x185, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x7, 0xff000000, 0x1, 0xf4000000, 0x1c4, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x186, 0xffffffff, 0x1, 0xffafafaf, 0x7, 0xff000000, 0x1, 0xd0000000,
+  0x1c3, 0x00000000, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x187, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0xc8000000, 0x1c2, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0x9, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffefefef,
+  0x188, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xc0000000,
+  0x1c1, 0x00000000, 0x1, 0x30000000, 0x1, 0xf0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x18a, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x90000000, 0x1c0, 0x00000000, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18b, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1bf, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18c, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000, 0x1be, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xff5f5f5f,
+  0x18d, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x70000000,
+  0x1bd, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x18e, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x40000000, 0x1bc, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000,
+  0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x18f, 0xffffffff, 0x8, 0xff000000,
+  0x1, 0x40000000, 0x1bc, 0x00000000, 0x1, 0xc0000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x190, 0xffffffff, 0x8, 0xff000000, 0x1, 0x40000000,
+  0x1bb, 0x00000000, 0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x190, 0xffffffff, 0x8, 0xff000000, 0x1, 0x20000000,
+  0x1ba, 0x00000000, 0x1, 0xa0000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f,
+  0x1, 0xffefefef, 0x191, 0xffffffff, 0x8, 0xff000000, 0x1ba, 0x00000000,
+  0x1, 0x80000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x191, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000, 0x1b9, 0x00000000,
+  0x1, 0x60000000, 0x9, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x192, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1b8, 0x00000000,
+  0x1, 0x60000000, 0x9, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x193, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1b7, 0x00000000,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x194, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000,
+  0x1, 0xdc000000, 0x1b6, 0x00000000, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x195, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xd0000000, 0x1b5, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000, 0x1, 0xffcfcfcf,
+  0x196, 0xffffffff, 0x1, 0xff9f9f9f, 0x7, 0xff000000, 0x1, 0xd0000000,
+  0x1b4, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000, 0x9, 0xff000000,
+  0x1, 0xff9f9f9f, 0x197, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x1b4, 0x00000000, 0x1, 0xa0000000, 0x9, 0xff000000,
+  0x1, 0xff9f9f9f, 0x198, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x1b3, 0x00000000, 0x1, 0x80000000, 0x9, 0xff000000,
+  0x1, 0xff6f6f6f, 0x199, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x1b2, 0x00000000, 0x1, 0x60000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x19a, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xb0000000, 0x1b1, 0x00000000, 0x1, 0x30000000, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x19b, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1b0, 0x00000000, 0x1, 0x20000000, 0x1, 0xf0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x19b, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0x80000000, 0x1af, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffcfcfcf, 0x19c, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1af, 0x00000000, 0x1, 0xa0000000, 0x9, 0xff000000,
+  0x1, 0xffcfcfcf, 0x19d, 0xffffffff, 0x1, 0xff4f4f4f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1ae, 0x00000000, 0x1, 0x80000000, 0x9, 0xff000000,
+  0x1, 0xff9f9f9f, 0x19e, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1ad, 0x00000000, 0x1, 0x50000000, 0x9, 0xff000000,
+  0x1, 0xff6f6f6f, 0x19f, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1ac, 0x00000000, 0x1, 0x20000000, 0x1, 0xf0000000,
+  0x8, 0xff000000, 0x1, 0xff4f4f4f, 0x1a0, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1ab, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0x1a0, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1ab, 0x00000000, 0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffdfdfdf, 0x1a1, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1aa, 0x00000000, 0x1, 0x70000000, 0x9, 0xff000000,
+  0x1, 0xffbfbfbf, 0x1a2, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a9, 0x00000000, 0x1, 0x30000000, 0x9, 0xff000000,
+  0x1, 0xff8f8f8f, 0x1a3, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a8, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x1a4, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1a8, 0x00000000, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef, 0x1a4, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a7, 0x00000000,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0x1a5, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a6, 0x00000000, 0x1, 0x40000000, 0x9, 0xff000000, 0x1, 0xffafafaf,
+  0x1a6, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a5, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000, 0x8, 0xff000000,
+  0x1, 0xff6f6f6f, 0x1a7, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a5, 0x00000000, 0x1, 0xb0000000, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1a8, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a4, 0x00000000, 0x1, 0x70000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x1a8, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1a3, 0x00000000, 0x1, 0x30000000,
+  0x9, 0xff000000, 0x1, 0xffbfbfbf, 0x1a9, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x1a2, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xd0000000, 0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x1aa, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a2, 0x00000000,
+  0x1, 0x90000000, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1ab, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000, 0x1a1, 0x00000000,
+  0x1, 0x40000000, 0x8, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf,
+  0x1ab, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000, 0x1, 0x80000000,
+  0x1a0, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x1ac, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x1a0, 0x00000000, 0x1, 0xb0000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1ad, 0xffffffff, 0x1, 0xff3f3f3f, 0x7, 0xff000000,
+  0x1, 0x80000000, 0x19f, 0x00000000, 0x1, 0x60000000, 0x8, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x1ad, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x7, 0xff000000, 0x1, 0x80000000, 0x19e, 0x00000000, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x8, 0xff000000, 0x1, 0xffcfcfcf, 0x1ae, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0x80000000, 0x19e, 0x00000000,
+  0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f, 0x1af, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0x90000000, 0x19d, 0x00000000,
+  0x1, 0x70000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f, 0x1b0, 0xffffffff,
+  0x1, 0xff7f7f7f, 0x7, 0xff000000, 0x1, 0xc0000000, 0x19c, 0x00000000,
+  0x1, 0x20000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffdfdfdf, 0x1b0, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x19c, 0x00000000, 0x1, 0xc0000000, 0x8, 0xff000000,
+  0x1, 0xff8f8f8f, 0x1b1, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x19b, 0x00000000, 0x1, 0x70000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1b2, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xc0000000, 0x19a, 0x00000000, 0x1, 0x20000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1b2, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0x60000000, 0x199, 0x00000000,
+  0x1, 0xb0000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x1b3, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x9, 0xff000000, 0x1, 0xa0000000, 0x197, 0x00000000,
+  0x1, 0x50000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f, 0x1b4, 0xffffffff,
+  0x1, 0xffbfbfbf, 0xa, 0xff000000, 0x1, 0xc4000000, 0x1, 0x10000000,
+  0x194, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1b4, 0xffffffff, 0x1, 0xffdfdfdf,
+  0xb, 0xff000000, 0x1, 0xd9000000, 0x1, 0x20000000, 0x193, 0x00000000,
+  0x1, 0xa0000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x1b6, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xb, 0xff000000, 0x1, 0xf3000000, 0x1, 0x30000000,
+  0x191, 0x00000000, 0x1, 0x4c000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1b8, 0xffffffff, 0x1, 0xff7f7f7f, 0xb, 0xff000000, 0x1, 0xf6000000,
+  0x1, 0x50000000, 0x18f, 0x00000000, 0x1, 0x10000000, 0x1, 0xf9000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0x1b9, 0xffffffff,
+  0x1, 0xffafafaf, 0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0x60000000,
+  0x18e, 0x00000000, 0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f,
+  0x58, 0xffffffff, 0x2, 0xffe5e5e5, 0x1, 0xffffffff, 0x1, 0xffe9e9e9,
+  0x1, 0xffe2e2e2, 0x1, 0xffebebeb, 0x1, 0xffaaaaaa, 0x1, 0xff676767,
+  0x1, 0xff474747, 0x1, 0xff2e2e2e, 0x1, 0xff232323, 0x1, 0xff242424,
+  0x1, 0xff222222, 0x1, 0xff212121, 0x1, 0xff252525, 0x1, 0xff232323,
+  0x1, 0xff1f1f1f, 0x2, 0xff242424, 0x1, 0xff1c1c1c, 0x2, 0xff242424,
+  0x1, 0xff1d1d1d, 0x1, 0xff232323, 0x1, 0xff252525, 0x1, 0xff222222,
+  0x1, 0xff393939, 0x1, 0xff636363, 0x1, 0xffa2a2a2, 0x1, 0xfffbfbfb,
+  0x145, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff1f1f1f, 0xb, 0xff000000,
+  0x1, 0x70000000, 0x18c, 0x00000000, 0x1, 0x4a000000, 0x8, 0xff000000,
+  0x1, 0xff2f2f2f, 0x56, 0xffffffff, 0x1, 0xffb9b9b9, 0x1, 0xff686868,
+  0x1, 0xff2d2d2d, 0x1, 0xff040404, 0x1, 0xff020202, 0x1, 0xff0a0a0a,
+  0x1, 0xff030303, 0x1, 0xff000000, 0x1, 0xff030303, 0x17, 0xff000000,
+  0x1, 0xff494949, 0x1, 0xffafafaf, 0x145, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xa0000000, 0x18b, 0x00000000,
+  0x1, 0xef000000, 0x7, 0xff000000, 0x1, 0xff080808, 0x1, 0xffbfbfbf,
+  0x54, 0xffffffff, 0x1, 0xfff7f7f7, 0x1, 0xff777777, 0x1, 0xff191919,
+  0x20, 0xff000000, 0x1, 0xff242424, 0x1, 0xff9b9b9b, 0x145, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0xa0000000,
+  0x189, 0x00000000, 0x1, 0x82000000, 0x8, 0xff000000, 0x1, 0xff8f8f8f,
+  0x54, 0xffffffff, 0x1, 0xfffefefe, 0x1, 0xff676767, 0x23, 0xff000000,
+  0x1, 0xff272727, 0x1, 0xffb7b7b7, 0x146, 0xffffffff, 0x1, 0xff6f6f6f,
+  0xb, 0xff000000, 0x1, 0xa6000000, 0x187, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xf4000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x54, 0xffffffff, 0x1, 0xff828282, 0x25, 0xff000000, 0x1, 0xff525252,
+  0x147, 0xffffffff, 0x1, 0xff9f9f9f, 0xb, 0xff000000, 0x1, 0xd3000000,
+  0x1, 0x10000000, 0x185, 0x00000000, 0x1, 0xb0000000, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x54, 0xffffffff, 0x1, 0xffd4d4d4, 0x1, 0xff282828,
+  0x25, 0xff000000, 0x1, 0xff080808, 0x1, 0xffb7b7b7, 0x147, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xd3000000,
+  0x1, 0x10000000, 0x183, 0x00000000, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff4f4f4f, 0x55, 0xffffffff, 0x1, 0xff868686, 0x27, 0xff000000,
+  0x1, 0xff7b7b7b, 0x148, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0xa, 0xff000000, 0x1, 0xd3000000, 0x1, 0x10000000, 0x182, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x55, 0xffffffff, 0x1, 0xff505050, 0x27, 0xff000000, 0x1, 0xff555555,
+  0x149, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0xd3000000, 0x1, 0x10000000, 0x180, 0x00000000, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0x56, 0xffffffff, 0x1, 0xff2e2e2e,
+  0x27, 0xff000000, 0x1, 0xff555555, 0x14a, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xd3000000, 0x1, 0x10000000,
+  0x17e, 0x00000000, 0x1, 0x20000000, 0x8, 0xff000000, 0x1, 0xff3f3f3f,
+  0x57, 0xffffffff, 0x1, 0xff3d3d3d, 0x27, 0xff000000, 0x1, 0xff7b7b7b,
+  0x14b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xd3000000, 0x1, 0x10000000, 0x17d, 0x00000000, 0x1, 0xc0000000,
+  0x8, 0xff000000, 0x1, 0xffcfcfcf, 0x57, 0xffffffff, 0x1, 0xff696969,
+  0x26, 0xff000000, 0x1, 0xff080808, 0x1, 0xffb7b7b7, 0x93, 0xffffffff,
+  0x1, 0xffd5d5d5, 0x1, 0xffababab, 0x1, 0xffa0a0a0, 0x1, 0xffa6a6a6,
+  0x1, 0xffa9a9a9, 0x1, 0xff9e9e9e, 0x1, 0xffa8a8a8, 0x1, 0xffa7a7a7,
+  0x1, 0xff9f9f9f, 0x1, 0xffababab, 0x1, 0xffa5a5a5, 0x1, 0xffa2a2a2,
+  0x1, 0xffa8a8a8, 0x1, 0xffa4a4a4, 0x1, 0xffa6a6a6, 0x1, 0xffa4a4a4,
+  0x1, 0xffa5a5a5, 0x1, 0xffababab, 0x1, 0xffa0a0a0, 0x1, 0xffa6a6a6,
+  0x1, 0xffa9a9a9, 0x1, 0xff9e9e9e, 0x1, 0xffb5b5b5, 0x1, 0xffe6e6e6,
+  0xa1, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xd3000000, 0x1, 0x10000000, 0x17b, 0x00000000, 0x1, 0x50000000,
+  0x8, 0xff000000, 0x1, 0xff6f6f6f, 0x58, 0xffffffff, 0x1, 0xffaaaaaa,
+  0x1, 0xff040404, 0x25, 0xff000000, 0x1, 0xff525252, 0x92, 0xffffffff,
+  0x1, 0xffa3a3a3, 0x1, 0xff4e4e4e, 0x1, 0xff101010, 0x16, 0xff000000,
+  0x1, 0xff0d0d0d, 0x1, 0xff242424, 0x1, 0xff424242, 0x1, 0xff5a5a5a,
+  0x1, 0xff686868, 0x1, 0xff8b8b8b, 0x1, 0xffc4c4c4, 0x9c, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xd3000000,
+  0x1, 0x10000000, 0x179, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x59, 0xffffffff,
+  0x1, 0xff515151, 0x24, 0xff000000, 0x1, 0xff272727, 0x1, 0xffb7b7b7,
+  0x90, 0xffffffff, 0x1, 0xfff4f4f4, 0x1, 0xff6f6f6f, 0x1, 0xff0e0e0e,
+  0x1e, 0xff000000, 0x1, 0xff101010, 0x1, 0xff595959, 0x1, 0xffbcbcbc,
+  0x9b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xd3000000, 0x179, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x5a, 0xffffffff, 0x1, 0xffbbbbbb, 0x1, 0xff2e2e2e,
+  0x22, 0xff000000, 0x1, 0xff242424, 0x1, 0xff9b9b9b, 0x37, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff4f4f4f, 0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf,
+  0x56, 0xffffffff, 0x1, 0xff696969, 0x22, 0xff000000, 0x1, 0xff292929,
+  0x1, 0xff9b9b9b, 0x9b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f,
+  0xa, 0xff000000, 0x1, 0xa6000000, 0x177, 0x00000000, 0x1, 0x20000000,
+  0x8, 0xff000000, 0x1, 0xff3f3f3f, 0x5c, 0xffffffff, 0x1, 0xffa9a9a9,
+  0x1, 0xff333333, 0x20, 0xff000000, 0x1, 0xff494949, 0x1, 0xffafafaf,
+  0x18, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xffbfbfbf, 0x1, 0xffefefef,
+  0x1c, 0xffffffff, 0x1, 0xff9f9f9f, 0x4, 0xff000000, 0x1, 0xffafafaf,
+  0x54, 0xffffffff, 0x1, 0xff919191, 0x1, 0xff060606, 0x23, 0xff000000,
+  0x1, 0xff232323, 0x1, 0xffababab, 0x9b, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0xa0000000, 0x176, 0x00000000,
+  0x1, 0xc0000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x5d, 0xffffffff,
+  0x1, 0xffc8c8c8, 0x1, 0xff626262, 0x1, 0xff161616, 0xa, 0xff000000,
+  0x1, 0xff060606, 0x1, 0xff0e0e0e, 0x1, 0xff1c1c1c, 0x1, 0xff222222,
+  0x1, 0xff212121, 0x1, 0xff252525, 0x1, 0xff232323, 0x1, 0xff1f1f1f,
+  0x2, 0xff242424, 0x1, 0xff1c1c1c, 0x2, 0xff242424, 0x1, 0xff1d1d1d,
+  0x1, 0xff232323, 0x1, 0xff252525, 0x1, 0xff222222, 0x1, 0xff393939,
+  0x1, 0xff636363, 0x1, 0xffa2a2a2, 0x1, 0xfffbfbfb, 0x17, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff3f3f3f, 0x2, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff9f9f9f, 0x1a, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x4, 0xff000000, 0x1, 0xff1f1f1f, 0x53, 0xffffffff, 0x1, 0xfff3f3f3,
+  0x1, 0xff393939, 0x25, 0xff000000, 0x1, 0xff434343, 0x1, 0xfff0f0f0,
+  0x9b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0xa0000000, 0x174, 0x00000000, 0x1, 0x50000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0x60, 0xffffffff, 0x1, 0xffcbcbcb, 0x1, 0xff8f8f8f,
+  0x1, 0xff6a6a6a, 0x1, 0xff5b5b5b, 0x1, 0xff565656, 0x1, 0xff595959,
+  0x1, 0xff656565, 0x1, 0xff636363, 0x1, 0xff6d6d6d, 0x1, 0xff888888,
+  0x1, 0xffa5a5a5, 0x1, 0xffdcdcdc, 0x2b, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x5, 0xff000000, 0x1, 0xffdfdfdf, 0x18, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xffbfbfbf, 0x52, 0xffffffff,
+  0x1, 0xffaaaaaa, 0x27, 0xff000000, 0x1, 0xff969696, 0x9c, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0x70000000,
+  0x172, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x97, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x5, 0xff000000, 0x1, 0xff7f7f7f, 0x17, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x52, 0xffffffff,
+  0x1, 0xff7a7a7a, 0x27, 0xff000000, 0x1, 0xff565656, 0x9d, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000, 0x1, 0x60000000,
+  0x171, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffafafaf,
+  0x98, 0xffffffff, 0x1, 0xff3f3f3f, 0x5, 0xff000000, 0x1, 0xff1f1f1f,
+  0x16, 0xffffffff, 0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xffafafaf,
+  0x51, 0xffffffff, 0x1, 0xff606060, 0x27, 0xff000000, 0x1, 0xff292929,
+  0x9e, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0xa, 0xff000000,
+  0x1, 0x50000000, 0x16f, 0x00000000, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff3f3f3f, 0x99, 0xffffffff, 0x1, 0xff7f7f7f, 0x6, 0xff000000,
+  0x1, 0xff9f9f9f, 0x13, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f,
+  0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x50, 0xffffffff,
+  0x1, 0xff7a7a7a, 0x27, 0xff000000, 0x1, 0xff1a1a1a, 0x9f, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000, 0x1, 0xf5000000,
+  0x1, 0x30000000, 0x16e, 0x00000000, 0x1, 0xc0000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x99, 0xffffffff, 0x1, 0xffdfdfdf, 0x6, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x11, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x1, 0xff1f1f1f, 0xd, 0xff000000, 0x1, 0xff4f4f4f, 0x50, 0xffffffff,
+  0x1, 0xffaaaaaa, 0x27, 0xff000000, 0x1, 0xff3d3d3d, 0xa0, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xf3000000,
+  0x1, 0x20000000, 0x16c, 0x00000000, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0x9b, 0xffffffff, 0x1, 0xff4f4f4f, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0xf, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x6, 0xff000000, 0x1, 0xff5f5f5f,
+  0x4f, 0xffffffff, 0x1, 0xfff3f3f3, 0x1, 0xff393939, 0x26, 0xff000000,
+  0x1, 0xff737373, 0xa1, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x9, 0xff000000, 0x1, 0xd3000000, 0x1, 0x10000000, 0x16b, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xffefefef,
+  0x9b, 0xffffffff, 0x1, 0xffbfbfbf, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xffefefef, 0xb, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff5f5f5f, 0x1, 0xffcfcfcf,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x16, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x2, 0xff3f3f3f, 0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0x34, 0xffffffff,
+  0x1, 0xff919191, 0x1, 0xff060606, 0x24, 0xff000000, 0x1, 0xff1a1a1a,
+  0x1, 0xffc0c0c0, 0xa2, 0xffffffff, 0x1, 0xffbfbfbf, 0xa, 0xff000000,
+  0x1, 0xb5000000, 0x16a, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xffafafaf, 0x9d, 0xffffffff, 0x1, 0xff6f6f6f, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xff8f8f8f, 0x1, 0xffefefef, 0x6, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff9f9f9f, 0x1, 0xff4f4f4f, 0xb, 0xff000000,
+  0x1, 0xff7f7f7f, 0x2, 0xffffffff, 0x1, 0xff7f7f7f, 0x7, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x12, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff4f4f4f, 0x4, 0xff000000, 0x1, 0xff3f3f3f, 0x35, 0xffffffff,
+  0x1, 0xff696969, 0x24, 0xff000000, 0x1, 0xff737373, 0xa4, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xa0000000, 0x168, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x9e, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000,
+  0x1, 0xff2f2f2f, 0x1, 0xff4f4f4f, 0x1, 0xff7f7f7f, 0x1, 0xff6f6f6f,
+  0x1, 0xff3f3f3f, 0x1, 0xff1f1f1f, 0xc, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffafafaf, 0x4, 0xffffffff, 0x8, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xffbfbfbf, 0x10, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f,
+  0x6, 0xff000000, 0x1, 0xffcfcfcf, 0x34, 0xffffffff, 0x1, 0xfff4f4f4,
+  0x1, 0xff6f6f6f, 0x1, 0xff0e0e0e, 0x21, 0xff000000, 0x1, 0xff5a5a5a,
+  0x1, 0xffededed, 0xa5, 0xffffffff, 0x1, 0xff8f8f8f, 0xa, 0xff000000,
+  0x1, 0x60000000, 0x167, 0x00000000, 0x1, 0xa0000000, 0x8, 0xff000000,
+  0x1, 0xffcfcfcf, 0x9f, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x19, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffdfdfdf, 0x5, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x9, 0xff000000, 0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf,
+  0xc, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff3f3f3f, 0x8, 0xff000000,
+  0x1, 0xffbfbfbf, 0x36, 0xffffffff, 0x1, 0xffa3a3a3, 0x1, 0xff4e4e4e,
+  0x1, 0xff101010, 0x1d, 0xff000000, 0x1, 0xff121212, 0x1, 0xff6c6c6c,
+  0x1, 0xffe9e9e9, 0xa7, 0xffffffff, 0x1, 0xff5f5f5f, 0xa, 0xff000000,
+  0x1, 0x30000000, 0x165, 0x00000000, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff6f6f6f, 0xa1, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f,
+  0x16, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xff9f9f9f, 0x8, 0xffffffff,
+  0x1, 0xff9f9f9f, 0xa, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff6f6f6f,
+  0x1, 0xffbfbfbf, 0x1, 0xffefefef, 0x4, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xffafafaf, 0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0xffefefef, 0x38, 0xffffffff, 0x1, 0xffd5d5d5, 0x1, 0xffababab,
+  0x1, 0xffa0a0a0, 0x1, 0xffa6a6a6, 0x1, 0xffa9a9a9, 0x1, 0xff9e9e9e,
+  0x1, 0xffa8a8a8, 0x1, 0xffa7a7a7, 0x1, 0xff9f9f9f, 0x1, 0xffababab,
+  0x1, 0xffa5a5a5, 0x1, 0xffa2a2a2, 0x1, 0xffa8a8a8, 0x1, 0xffa4a4a4,
+  0x1, 0xffa6a6a6, 0x1, 0xffa4a4a4, 0x1, 0xffa5a5a5, 0x1, 0xffababab,
+  0x1, 0xffa0a0a0, 0x1, 0xffa6a6a6, 0x1, 0xff757575, 0x1, 0xff3c3c3c,
+  0x1, 0xff1d1d1d, 0x1, 0xff010101, 0x1, 0xff030303, 0x1, 0xff0a0a0a,
+  0x1, 0xff030303, 0x1, 0xff010101, 0x1, 0xff292929, 0x1, 0xff616161,
+  0x1, 0xffb0b0b0, 0xaa, 0xffffffff, 0x1, 0xff4f4f4f, 0x9, 0xff000000,
+  0x1, 0xf3000000, 0x1, 0x20000000, 0x164, 0x00000000, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0xa2, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x13, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xff7f7f7f, 0x1, 0xffefefef, 0xa, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1e, 0xff000000, 0x1, 0xff9f9f9f, 0x50, 0xffffffff, 0x1, 0xffe3e3e3,
+  0x1, 0xffe7e7e7, 0x1, 0xffffffff, 0x1, 0xffe7e7e7, 0x1, 0xffe3e3e3,
+  0xad, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff2f2f2f, 0x9, 0xff000000,
+  0x1, 0xd3000000, 0x1, 0x10000000, 0x162, 0x00000000, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xff8f8f8f, 0xa4, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0x10, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff7f7f7f,
+  0x1, 0xffefefef, 0xd, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff0f0f0f,
+  0x1a, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x104, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xa0000000,
+  0x161, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000, 0x7, 0xff000000,
+  0x1, 0xff2f2f2f, 0xa7, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff5f5f5f,
+  0x1, 0xffafafaf, 0x11, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff3f3f3f,
+  0x18, 0xff000000, 0x1, 0xff4f4f4f, 0x1, 0xffefefef, 0x106, 0xffffffff,
+  0x1, 0xffcfcfcf, 0xa, 0xff000000, 0x1, 0x60000000, 0x160, 0x00000000,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0xaa, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff8f8f8f, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x2, 0xff3f3f3f, 0x2, 0xff7f7f7f, 0x1, 0xffafafaf, 0x1, 0xffdfdfdf,
+  0x16, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff1f1f1f, 0x14, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf, 0x109, 0xffffffff, 0x1, 0xff9f9f9f,
+  0xa, 0xff000000, 0x1, 0x30000000, 0x15e, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f, 0xcd, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff2f2f2f, 0x10, 0xff000000, 0x1, 0xff4f4f4f,
+  0x1, 0xffbfbfbf, 0x10c, 0xffffffff, 0x1, 0xff6f6f6f, 0x9, 0xff000000,
+  0x1, 0xe6000000, 0x1, 0x10000000, 0x15d, 0x00000000, 0x1, 0xa0000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0xcf, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff8f8f8f, 0x1, 0xff3f3f3f, 0x9, 0xff000000, 0x1, 0xff1f1f1f,
+  0x1, 0xff4f4f4f, 0x1, 0xff9f9f9f, 0x1, 0xffefefef, 0x10f, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x9, 0xff000000, 0x1, 0xb5000000, 0x15c, 0x00000000,
+  0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xff7f7f7f, 0xd4, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x6, 0xffbfbfbf, 0x1, 0xffefefef, 0x113, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000, 0x1, 0x70000000,
+  0x15b, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x1f0, 0xffffffff, 0x1, 0xffcfcfcf, 0xa, 0xff000000,
+  0x1, 0x30000000, 0x159, 0x00000000, 0x1, 0x40000000, 0x8, 0xff000000,
+  0x1, 0xff9f9f9f, 0x1f2, 0xffffffff, 0x1, 0xff9f9f9f, 0x9, 0xff000000,
+  0x1, 0xe4000000, 0x1, 0x10000000, 0x158, 0x00000000, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1f4, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0xb0000000, 0x157, 0x00000000, 0x1, 0x60000000,
+  0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x1f4, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0x60000000, 0x155, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1f6, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xf4000000, 0x1, 0x20000000, 0x154, 0x00000000, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x1f7, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x9, 0xff000000, 0x1, 0xd3000000, 0x153, 0x00000000, 0x1, 0x20000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x1f9, 0xffffffff,
+  0x1, 0xff4f4f4f, 0x9, 0xff000000, 0x1, 0x80000000, 0x152, 0x00000000,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x1f9, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x9, 0xff000000,
+  0x1, 0x30000000, 0x150, 0x00000000, 0x1, 0x20000000, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0x1fb, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000,
+  0x1, 0xd3000000, 0x150, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffefefef, 0x1fc, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x9, 0xff000000, 0x1, 0x80000000, 0x14e, 0x00000000, 0x1, 0x40000000,
+  0x8, 0xff000000, 0x1, 0xff9f9f9f, 0x1fe, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x9, 0xff000000, 0x1, 0x30000000, 0x14d, 0x00000000, 0x1, 0xc0000000,
+  0x7, 0xff000000, 0x1, 0xff1f1f1f, 0x1ff, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xd3000000, 0x14c, 0x00000000,
+  0x1, 0x50000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x200, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x9, 0xff000000, 0x1, 0x80000000, 0x14b, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x202, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x9, 0xff000000, 0x1, 0x20000000, 0x149, 0x00000000,
+  0x1, 0x60000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf, 0x202, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xc4000000,
+  0x149, 0x00000000, 0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff4f4f4f,
+  0x204, 0xffffffff, 0x1, 0xff8f8f8f, 0x9, 0xff000000, 0x1, 0x60000000,
+  0x147, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0x205, 0xffffffff, 0x1, 0xff2f2f2f, 0x8, 0xff000000, 0x1, 0xf3000000,
+  0x1, 0x10000000, 0x145, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x206, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x9, 0xff000000, 0x1, 0xa0000000, 0x145, 0x00000000, 0x1, 0x80000000,
+  0x8, 0xff000000, 0x1, 0xffdfdfdf, 0x207, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x9, 0xff000000, 0x1, 0x40000000, 0x143, 0x00000000, 0x1, 0x10000000,
+  0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x208, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xd3000000,
+  0x143, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x209, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000,
+  0x1, 0x60000000, 0x141, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x20b, 0xffffffff, 0x1, 0xff4f4f4f,
+  0x8, 0xff000000, 0x1, 0xf3000000, 0x1, 0x10000000, 0x140, 0x00000000,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x20b, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0x90000000, 0x13f, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x20d, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x9, 0xff000000, 0x1, 0x20000000, 0x13e, 0x00000000, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x20e, 0xffffffff,
+  0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0xc0000000, 0x13d, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x20f, 0xffffffff, 0x1, 0xffbfbfbf, 0x9, 0xff000000, 0x1, 0x40000000,
+  0x13c, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x210, 0xffffffff, 0x1, 0xff4f4f4f, 0x8, 0xff000000,
+  0x1, 0xd3000000, 0x13b, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x211, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x9, 0xff000000, 0x1, 0x60000000, 0x13a, 0x00000000, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x212, 0xffffffff,
+  0x1, 0xff6f6f6f, 0x8, 0xff000000, 0x1, 0xe4000000, 0x13a, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x213, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0x60000000,
+  0x138, 0x00000000, 0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x1, 0xffefefef, 0x214, 0xffffffff, 0x1, 0xff7f7f7f, 0x8, 0xff000000,
+  0x1, 0xf2000000, 0x1, 0x10000000, 0x137, 0x00000000, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x216, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x8, 0xff000000, 0x1, 0x80000000, 0x136, 0x00000000, 0x1, 0x50000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x216, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xf4000000, 0x1, 0x10000000,
+  0x135, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f,
+  0x155, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xffbfbfbf, 0x1, 0xffdfdfdf,
+  0xc0, 0xffffffff, 0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0x80000000,
+  0x134, 0x00000000, 0x1, 0x30000000, 0x8, 0xff000000, 0x1, 0xffdfdfdf,
+  0x153, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0x3, 0xff000000,
+  0x1, 0xff3f3f3f, 0x1, 0xffbfbfbf, 0xbe, 0xffffffff, 0x1, 0xffafafaf,
+  0x8, 0xff000000, 0x1, 0xf4000000, 0x1, 0x10000000, 0x133, 0x00000000,
+  0x1, 0xa0000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x153, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0x5, 0xff000000, 0x1, 0xff1f1f1f,
+  0xbf, 0xffffffff, 0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0x80000000,
+  0x132, 0x00000000, 0x1, 0x10000000, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0x152, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x7, 0xff000000,
+  0x1, 0xffafafaf, 0xbe, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000,
+  0x1, 0xf4000000, 0x1, 0x10000000, 0x131, 0x00000000, 0x1, 0x70000000,
+  0x7, 0xff000000, 0x1, 0xff3f3f3f, 0x152, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff0f0f0f, 0x8, 0xff000000, 0x1, 0xff5f5f5f, 0xbf, 0xffffffff,
+  0x1, 0xff3f3f3f, 0x8, 0xff000000, 0x1, 0x80000000, 0x131, 0x00000000,
+  0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x151, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff0f0f0f, 0x9, 0xff000000, 0x1, 0xff7f7f7f,
+  0xbf, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xe4000000,
+  0x130, 0x00000000, 0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0x151, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff0f0f0f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffdfdfdf, 0xc0, 0xffffffff, 0x1, 0xff3f3f3f,
+  0x8, 0xff000000, 0x1, 0x60000000, 0x12f, 0x00000000, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x150, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff2f2f2f, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0xc1, 0xffffffff, 0x1, 0xffbfbfbf, 0x8, 0xff000000, 0x1, 0xe4000000,
+  0x12e, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xffdfdfdf, 0x150, 0xffffffff, 0x1, 0xff3f3f3f, 0x9, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0xc3, 0xffffffff, 0x1, 0xff2f2f2f,
+  0x8, 0xff000000, 0x1, 0x60000000, 0x12d, 0x00000000, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x150, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0xc4, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xc4000000, 0x12d, 0x00000000,
+  0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xffafafaf, 0x14f, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x9, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf,
+  0xc6, 0xffffffff, 0x1, 0xff1f1f1f, 0x8, 0xff000000, 0x1, 0x40000000,
+  0x12b, 0x00000000, 0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f,
+  0x14f, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff0f0f0f, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0xc7, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x8, 0xff000000, 0x1, 0xa0000000, 0x12b, 0x00000000, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x14f, 0xffffffff, 0x1, 0xff5f5f5f,
+  0x9, 0xff000000, 0x1, 0xffafafaf, 0xc9, 0xffffffff, 0x1, 0xff0f0f0f,
+  0x8, 0xff000000, 0x1, 0x20000000, 0x12a, 0x00000000, 0x1, 0xb0000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x14e, 0xffffffff, 0x1, 0xffbfbfbf,
+  0x9, 0xff000000, 0x1, 0xff9f9f9f, 0xca, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x8, 0xff000000, 0x1, 0x90000000, 0x12a, 0x00000000, 0x1, 0xf0000000,
+  0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x14f, 0xffffffff, 0x1, 0xff1f1f1f,
+  0x8, 0xff000000, 0x1, 0xff5f5f5f, 0xcb, 0xffffffff, 0x1, 0xffefefef,
+  0x8, 0xff000000, 0x1, 0xf3000000, 0x1, 0x10000000, 0x128, 0x00000000,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x14e, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xffefefef,
+  0xcc, 0xffffffff, 0x1, 0xff5f5f5f, 0x8, 0xff000000, 0x1, 0x60000000,
+  0x128, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xffafafaf,
+  0x14d, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff1f1f1f, 0x8, 0xff000000,
+  0x1, 0xffcfcfcf, 0xcd, 0xffffffff, 0x1, 0xffcfcfcf, 0x8, 0xff000000,
+  0x1, 0xd3000000, 0x128, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0x14d, 0xffffffff, 0x1, 0xff8f8f8f, 0x8, 0xff000000,
+  0x1, 0xff7f7f7f, 0xcf, 0xffffffff, 0x1, 0xff3f3f3f, 0x8, 0xff000000,
+  0x1, 0x30000000, 0x127, 0x00000000, 0x1, 0xf0000000, 0x6, 0xff000000,
+  0x1, 0xff2f2f2f, 0x77, 0xffffffff, 0x1f, 0xffbfbfbf, 0x1, 0xffefefef,
+  0xb7, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xff1f1f1f,
+  0xd0, 0xffffffff, 0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xa0000000,
+  0x126, 0x00000000, 0x1, 0x30000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f,
+  0x74, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f, 0x1, 0xff0f0f0f,
+  0x42, 0xff000000, 0x1, 0xff0f0f0f, 0x23, 0xff3f3f3f, 0x1, 0xff6f6f6f,
+  0x1, 0xff7f7f7f, 0xa, 0xff3f3f3f, 0x38, 0xff7f7f7f, 0x1, 0xff9f9f9f,
+  0x2b, 0xffbfbfbf, 0x1, 0xff777777, 0x8, 0xff000000, 0x1, 0xffbfbfbf,
+  0xd1, 0xffffffff, 0x1, 0xff1f1f1f, 0x7, 0xff000000, 0x1, 0xf4000000,
+  0x1, 0x10000000, 0x125, 0x00000000, 0x1, 0x50000000, 0x7, 0xff000000,
+  0x1, 0xffafafaf, 0x73, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f,
+  0xe0, 0xff000000, 0x1, 0xff3f3f3f, 0xd2, 0xffffffff, 0x1, 0xff7f7f7f,
+  0x8, 0xff000000, 0x1, 0x60000000, 0x125, 0x00000000, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x72, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0xe1, 0xff000000, 0x1, 0xffbfbfbf, 0x6e, 0xffffffff,
+  0x1, 0xff636363, 0x2, 0xff101010, 0x1, 0xff1b1b1b, 0x1, 0xff373737,
+  0x13, 0xff3f3f3f, 0x1, 0xff5f5f5f, 0x25, 0xff7f7f7f, 0x1, 0xff8f8f8f,
+  0x25, 0xffbfbfbf, 0x1, 0xff9f9f9f, 0x8, 0xff000000, 0x1, 0xd3000000,
+  0x125, 0x00000000, 0x1, 0xb0000000, 0x7, 0xff000000, 0x72, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xe2, 0xff000000, 0x1, 0xff3f3f3f, 0x6d, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff1d1d1d, 0x6e, 0xff000000, 0x1, 0x30000000,
+  0x124, 0x00000000, 0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x70, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff2f2f2f, 0xe3, 0xff000000,
+  0x1, 0xffafafaf, 0x6c, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff232323,
+  0x6f, 0xff000000, 0x1, 0x90000000, 0x124, 0x00000000, 0x1, 0xf0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x6f, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff0f0f0f, 0xe3, 0xff000000, 0x1, 0xff080808, 0x6c, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff0a0a0a, 0x70, 0xff000000, 0x1, 0xe6000000,
+  0x124, 0x00000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x6e, 0xffffffff,
+  0x1, 0xff6f6f6f, 0xe5, 0xff000000, 0x1, 0xff454545, 0x6b, 0xffffffff,
+  0x1, 0xff8f8f8f, 0x73, 0xff000000, 0x123, 0x00000000, 0x1, 0x10000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x6c, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xa0000000, 0x1d, 0x40000000,
+  0x23, 0x80000000, 0x1, 0xa0000000, 0x23, 0xc0000000, 0x76, 0xff000000,
+  0x1, 0xffcfcfcf, 0x69, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff5f5f5f,
+  0x73, 0xff000000, 0x1, 0xdc000000, 0x123, 0x00000000, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x6b, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xb, 0xff000000, 0x1, 0x70000000, 0x88, 0x00000000,
+  0x1, 0x20000000, 0x1f, 0x40000000, 0x1, 0x64000000, 0x3, 0x70000000,
+  0x1, 0x94000000, 0x22, 0xa0000000, 0x1, 0xac000000, 0x3, 0xd0000000,
+  0x1, 0xfc000000, 0x6, 0xff000000, 0x1, 0xff1f1f1f, 0x69, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0x74, 0xff000000, 0x1, 0x50000000,
+  0x123, 0x00000000, 0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x69, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f, 0xb, 0xff000000,
+  0x1, 0xe0000000, 0x1, 0x30000000, 0xd3, 0x00000000, 0x1, 0x30000000,
+  0x7, 0xff000000, 0x1, 0xff6f6f6f, 0x68, 0xffffffff, 0x1, 0xff9f9f9f,
+  0x1, 0xff0f0f0f, 0xa, 0xff000000, 0x1, 0xf9000000, 0x1, 0xe4000000,
+  0x13, 0xe0000000, 0x54, 0xff000000, 0x1, 0xfd000000, 0x1, 0x7e000000,
+  0x124, 0x00000000, 0x1, 0x60000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf,
+  0x68, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f, 0xb, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x10000000, 0xd4, 0x00000000, 0x1, 0x60000000,
+  0x7, 0xff000000, 0x1, 0xffafafaf, 0x66, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff5f5f5f, 0xb, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x3a, 0x00000000, 0x1, 0x20000000, 0x26, 0x40000000, 0x3, 0x80000000,
+  0x1, 0x98000000, 0x2, 0xa0000000, 0x1, 0x71000000, 0x126, 0x00000000,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x67, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0xc, 0xff000000, 0x1, 0x70000000, 0xd6, 0x00000000,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x65, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0x80000000,
+  0x190, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000, 0x66, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x30000000, 0xd7, 0x00000000, 0x1, 0xb0000000, 0x7, 0xff000000,
+  0x65, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f, 0xa, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x50000000, 0x191, 0x00000000, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x65, 0xffffffff, 0x1, 0xff7f7f7f, 0xc, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x10000000, 0xd8, 0x00000000, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x63, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff4f4f4f, 0xb, 0xff000000, 0x1, 0xd0000000, 0x1, 0x20000000,
+  0x192, 0x00000000, 0x1, 0xb0000000, 0x6, 0xff000000, 0x1, 0xff0f0f0f,
+  0x63, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0xda, 0x00000000, 0x7, 0xff000000,
+  0x1, 0xff4f4f4f, 0x62, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f,
+  0xb, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000, 0x193, 0x00000000,
+  0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x62, 0xffffffff,
+  0x1, 0xff7f7f7f, 0xc, 0xff000000, 0x1, 0xd0000000, 0x1, 0x20000000,
+  0xdb, 0x00000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x61, 0xffffffff,
+  0x1, 0xff7f7f7f, 0xb, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000,
+  0x195, 0x00000000, 0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x60, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xc, 0xff000000,
+  0x1, 0x80000000, 0xdd, 0x00000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x5f, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x30000000, 0x196, 0x00000000, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff3f3f3f, 0x5e, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000,
+  0xdd, 0x00000000, 0x1, 0x20000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x5e, 0xffffffff, 0x1, 0xff7f7f7f, 0xc, 0xff000000, 0x1, 0xa0000000,
+  0x1, 0x10000000, 0x197, 0x00000000, 0x1, 0xc0000000, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0x5d, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff1f1f1f,
+  0xc, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000, 0xde, 0x00000000,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x5c, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff2f2f2f, 0xb, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x60000000, 0x199, 0x00000000, 0x1, 0xc0000000, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0x5b, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff4f4f4f,
+  0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0xe0, 0x00000000,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x5b, 0xffffffff,
+  0x1, 0xff7f7f7f, 0xc, 0xff000000, 0x1, 0xd0000000, 0x1, 0x30000000,
+  0x19a, 0x00000000, 0x1, 0xc0000000, 0x6, 0xff000000, 0x1, 0xff3f3f3f,
+  0x5a, 0xffffffff, 0x1, 0xff8f8f8f, 0x1, 0xff0f0f0f, 0xc, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x10000000, 0xe1, 0x00000000, 0x1, 0x40000000,
+  0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x59, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff2f2f2f, 0xc, 0xff000000, 0x1, 0x90000000, 0x19c, 0x00000000,
+  0x1, 0xb0000000, 0x6, 0xff000000, 0x1, 0xff0f0f0f, 0x58, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff3f3f3f, 0xc, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x50000000, 0xe3, 0x00000000, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x57, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f,
+  0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0x19d, 0x00000000,
+  0x1, 0x80000000, 0x7, 0xff000000, 0x56, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff6f6f6f, 0xd, 0xff000000, 0x1, 0x90000000, 0x1, 0x10000000,
+  0xe4, 0x00000000, 0x1, 0x10000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x56, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff1f1f1f, 0xc, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x10000000, 0x19e, 0x00000000, 0x1, 0x80000000,
+  0x7, 0xff000000, 0x55, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff0f0f0f,
+  0xc, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0xe7, 0x00000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x54, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff4f4f4f, 0xc, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000,
+  0x1a0, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xffcfcfcf,
+  0x52, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff2f2f2f, 0xd, 0xff000000,
+  0x1, 0x80000000, 0x1, 0x10000000, 0xe8, 0x00000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x53, 0xffffffff, 0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f,
+  0xc, 0xff000000, 0x1, 0xb0000000, 0x1, 0x10000000, 0x1a1, 0x00000000,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xffbfbfbf, 0x50, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xd, 0xff000000, 0x1, 0xd0000000,
+  0x1, 0x30000000, 0xea, 0x00000000, 0x1, 0xe0000000, 0x6, 0xff000000,
+  0x1, 0xff3f3f3f, 0x51, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff1f1f1f,
+  0xc, 0xff000000, 0x1, 0xf0000000, 0x1, 0x50000000, 0x1a3, 0x00000000,
+  0x1, 0x40000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x4e, 0xffffffff,
+  0x1, 0xffefefef, 0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f, 0xc, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x70000000, 0xec, 0x00000000, 0x1, 0xc0000000,
+  0x6, 0xff000000, 0x1, 0xff1f1f1f, 0x4f, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff3f3f3f, 0xd, 0xff000000, 0x1, 0xa0000000, 0x1, 0x10000000,
+  0x1a5, 0x00000000, 0x7, 0xff000000, 0x1, 0xff5f5f5f, 0x4d, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f, 0xd, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x20000000, 0xed, 0x00000000, 0x1, 0xa0000000, 0x7, 0xff000000,
+  0x1, 0xffefefef, 0x4c, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff6f6f6f,
+  0xd, 0xff000000, 0x1, 0xe0000000, 0x1, 0x40000000, 0x1a7, 0x00000000,
+  0x1, 0xe0000000, 0x6, 0xff000000, 0x1, 0xff1f1f1f, 0x4b, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff2f2f2f, 0xd, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x40000000, 0xef, 0x00000000, 0x1, 0x70000000, 0x7, 0xff000000,
+  0x1, 0xffbfbfbf, 0x4b, 0xffffffff, 0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f,
+  0xd, 0xff000000, 0x1, 0x80000000, 0x1, 0x10000000, 0x1a8, 0x00000000,
+  0x1, 0xb0000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x48, 0xffffffff,
+  0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0xd, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0x80000000, 0xf1, 0x00000000, 0x1, 0x40000000, 0x7, 0xff000000,
+  0x1, 0xff7f7f7f, 0x49, 0xffffffff, 0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f,
+  0xd, 0xff000000, 0x1, 0xc0000000, 0x1, 0x30000000, 0x1aa, 0x00000000,
+  0x1, 0x70000000, 0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x46, 0xffffffff,
+  0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xe, 0xff000000, 0x1, 0xa0000000,
+  0x1, 0x20000000, 0xf3, 0x00000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0x47, 0xffffffff, 0x1, 0xffafafaf, 0x1, 0xff1f1f1f, 0xd, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0x60000000, 0x1ac, 0x00000000, 0x1, 0x30000000,
+  0x7, 0xff000000, 0x1, 0xff4f4f4f, 0x44, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff5f5f5f, 0xe, 0xff000000, 0x1, 0xd0000000, 0x1, 0x40000000,
+  0xf5, 0x00000000, 0x1, 0xc0000000, 0x7, 0xff000000, 0x1, 0xffdfdfdf,
+  0x44, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0xe, 0xff000000,
+  0x1, 0x90000000, 0x1, 0x10000000, 0x1ae, 0x00000000, 0x1, 0xf0000000,
+  0x7, 0xff000000, 0x1, 0xffdfdfdf, 0x41, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff5f5f5f, 0xe, 0xff000000, 0x1, 0xf0000000, 0x1, 0x60000000,
+  0xf7, 0x00000000, 0x1, 0x80000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x42, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f, 0xe, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x20000000, 0x1b0, 0x00000000, 0x1, 0xa0000000,
+  0x7, 0xff000000, 0x1, 0xff7f7f7f, 0x3f, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xff5f5f5f, 0xe, 0xff000000, 0x1, 0xf0000000, 0x1, 0x80000000,
+  0x1, 0x10000000, 0xf8, 0x00000000, 0x1, 0x30000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x40, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f,
+  0xe, 0xff000000, 0x1, 0xe0000000, 0x1, 0x50000000, 0x1b2, 0x00000000,
+  0x1, 0x50000000, 0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef,
+  0x3c, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff5f5f5f, 0xf, 0xff000000,
+  0x1, 0xa0000000, 0x1, 0x20000000, 0xfb, 0x00000000, 0x1, 0xe0000000,
+  0x7, 0xff000000, 0x1, 0xff9f9f9f, 0x3d, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff3f3f3f, 0xe, 0xff000000, 0x1, 0xf0000000, 0x1, 0x70000000,
+  0x1b5, 0x00000000, 0x1, 0xe0000000, 0x7, 0xff000000, 0x1, 0xff7f7f7f,
+  0x3a, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0xf, 0xff000000,
+  0x1, 0xc0000000, 0x1, 0x30000000, 0xfd, 0x00000000, 0x1, 0x70000000,
+  0x7, 0xff000000, 0x1, 0xff0f0f0f, 0x1, 0xffefefef, 0x3a, 0xffffffff,
+  0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f, 0xf, 0xff000000, 0x1, 0x80000000,
+  0x1, 0x10000000, 0x1b6, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xffdfdfdf, 0x37, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff3f3f3f,
+  0xf, 0xff000000, 0x1, 0xc0000000, 0x1, 0x40000000, 0xff, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff6f6f6f,
+  0x37, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff7f7f7f, 0x1, 0xff0f0f0f,
+  0xf, 0xff000000, 0x1, 0xa0000000, 0x1, 0x20000000, 0x1b8, 0x00000000,
+  0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000, 0x1, 0xff2f2f2f,
+  0x34, 0xffffffff, 0x1, 0xffefefef, 0x1, 0xff9f9f9f, 0x1, 0xff1f1f1f,
+  0xf, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000, 0x102, 0x00000000,
+  0x1, 0x80000000, 0x8, 0xff000000, 0x1, 0xffafafaf, 0x34, 0xffffffff,
+  0x1, 0xffcfcfcf, 0x1, 0xff5f5f5f, 0x10, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x20000000, 0x1bb, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xff5f5f5f, 0x31, 0xffffffff, 0x1, 0xffdfdfdf, 0x1, 0xff6f6f6f,
+  0x1, 0xff0f0f0f, 0xf, 0xff000000, 0x1, 0xe0000000, 0x1, 0x60000000,
+  0x104, 0x00000000, 0x1, 0x10000000, 0x1, 0xf0000000, 0x7, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x30, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff2f2f2f, 0x10, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x40000000, 0x1bd, 0x00000000, 0x1, 0x10000000, 0x1, 0xe0000000,
+  0x8, 0xff000000, 0x1, 0xff5f5f5f, 0x2d, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff3f3f3f, 0x10, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x60000000, 0x107, 0x00000000, 0x1, 0x80000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffcfcfcf, 0x2d, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0x10, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x40000000, 0x1c0, 0x00000000, 0x1, 0x50000000, 0x9, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffefefef, 0x29, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0x10, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x60000000, 0x10a, 0x00000000, 0x1, 0xd0000000, 0x8, 0xff000000,
+  0x1, 0xff0f0f0f, 0x1, 0xffbfbfbf, 0x29, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff6f6f6f, 0x1, 0xff1f1f1f, 0x11, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x40000000, 0x1c3, 0x00000000, 0x1, 0xa0000000, 0x9, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xffbfbfbf, 0x25, 0xffffffff, 0x1, 0xffafafaf,
+  0x1, 0xff5f5f5f, 0x1, 0xff0f0f0f, 0x11, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x60000000, 0x10c, 0x00000000, 0x1, 0x30000000, 0xa, 0xff000000,
+  0x1, 0xff7f7f7f, 0x25, 0xffffffff, 0x1, 0xffcfcfcf, 0x1, 0xff6f6f6f,
+  0x1, 0xff1f1f1f, 0x12, 0xff000000, 0x1, 0xa0000000, 0x1, 0x30000000,
+  0x1c5, 0x00000000, 0x1, 0x10000000, 0x1, 0xd0000000, 0xa, 0xff000000,
+  0x1, 0xff5f5f5f, 0x1, 0xffdfdfdf, 0x1f, 0xffffffff, 0x1, 0xffcfcfcf,
+  0x1, 0xff8f8f8f, 0x1, 0xff4f4f4f, 0x13, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x60000000, 0x10f, 0x00000000, 0x1, 0x60000000, 0xa, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff9f9f9f, 0x1f, 0xffffffff, 0x1, 0xffefefef,
+  0x1, 0xff9f9f9f, 0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x12, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x20000000, 0x1c8, 0x00000000,
+  0x1, 0x30000000, 0x1, 0xf0000000, 0xb, 0xff000000, 0x1, 0xff3f3f3f,
+  0x1, 0xff9f9f9f, 0x1, 0xffefefef, 0x17, 0xffffffff, 0x1, 0xffdfdfdf,
+  0x1, 0xffbfbfbf, 0x1, 0xff7f7f7f, 0x1, 0xff4f4f4f, 0x1, 0xff0f0f0f,
+  0x14, 0xff000000, 0x1, 0xb0000000, 0x1, 0x40000000, 0x112, 0x00000000,
+  0x1, 0xa0000000, 0xb, 0xff000000, 0x1, 0xff1f1f1f, 0x1, 0xff8f8f8f,
+  0x1, 0xffdfdfdf, 0x18, 0xffffffff, 0x1, 0xffbfbfbf, 0x1, 0xff9f9f9f,
+  0x1, 0xff5f5f5f, 0x1, 0xff1f1f1f, 0x14, 0xff000000, 0x1, 0xe0000000,
+  0x1, 0x80000000, 0x1, 0x10000000, 0x1cb, 0x00000000, 0x1, 0x30000000,
+  0x1, 0xf0000000, 0xd, 0xff000000, 0x1, 0xff2f2f2f, 0x1, 0xff5f5f5f,
+  0x1, 0xff7f7f7f, 0x2, 0xffbfbfbf, 0x1, 0xffcfcfcf, 0x7, 0xffffffff,
+  0x1, 0xffefefef, 0x4, 0xffbfbfbf, 0x2, 0xff7f7f7f, 0x1, 0xff4f4f4f,
+  0x1, 0xff3f3f3f, 0x17, 0xff000000, 0x1, 0xf0000000, 0x1, 0x90000000,
+  0x1, 0x20000000, 0x115, 0x00000000, 0x1, 0xa0000000, 0xd, 0xff000000,
+  0x1, 0xff1f1f1f, 0x1, 0xff5f5f5f, 0x1, 0xff7f7f7f, 0x2, 0xffbfbfbf,
+  0xa, 0xffffffff, 0x1, 0xffefefef, 0x3, 0xffbfbfbf, 0x2, 0xff7f7f7f,
+  0x1, 0xff3f3f3f, 0x1, 0xff2f2f2f, 0x17, 0xff000000, 0x1, 0xc0000000,
+  0x1, 0x60000000, 0x1cf, 0x00000000, 0x1, 0x30000000, 0x1, 0xf0000000,
+  0x37, 0xff000000, 0x1, 0xd0000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x118, 0x00000000, 0x1, 0xa0000000, 0x37, 0xff000000, 0x1, 0xf0000000,
+  0x1, 0xa0000000, 0x1, 0x30000000, 0x1d2, 0x00000000, 0x1, 0x20000000,
+  0x1, 0xd0000000, 0x33, 0xff000000, 0x1, 0xf0000000, 0x1, 0xa0000000,
+  0x1, 0x30000000, 0x11c, 0x00000000, 0x1, 0x70000000, 0x34, 0xff000000,
+  0x1, 0xb0000000, 0x1, 0x60000000, 0x1d6, 0x00000000, 0x1, 0x10000000,
+  0x1, 0x90000000, 0x30, 0xff000000, 0x1, 0xb0000000, 0x1, 0x60000000,
+  0x120, 0x00000000, 0x1, 0x40000000, 0x1, 0xe0000000, 0x2f, 0xff000000,
+  0x1, 0xd0000000, 0x1, 0x70000000, 0x1, 0x20000000, 0x1da, 0x00000000,
+  0x1, 0x40000000, 0x1, 0xd0000000, 0x2b, 0xff000000, 0x1, 0xb0000000,
+  0x1, 0x60000000, 0x1, 0x10000000, 0x123, 0x00000000, 0x1, 0x10000000,
+  0x1, 0x90000000, 0x2b, 0xff000000, 0x1, 0xd0000000, 0x1, 0x70000000,
+  0x1, 0x20000000, 0x1df, 0x00000000, 0x1, 0x60000000, 0x1, 0xd0000000,
+  0x25, 0xff000000, 0x1, 0xe0000000, 0x1, 0x90000000, 0x1, 0x50000000,
+  0x129, 0x00000000, 0x1, 0x20000000, 0x1, 0xa0000000, 0x25, 0xff000000,
+  0x1, 0xf0000000, 0x1, 0xa0000000, 0x1, 0x60000000, 0x1, 0x10000000,
+  0x1e4, 0x00000000, 0x1, 0x30000000, 0x1, 0xa0000000, 0x1, 0xf0000000,
+  0x1e, 0xff000000, 0x1, 0xd0000000, 0x1, 0x90000000, 0x1, 0x60000000,
+  0x1, 0x20000000, 0x12e, 0x00000000, 0x1, 0x20000000, 0x1, 0x70000000,
+  0x1, 0xd0000000, 0x1e, 0xff000000, 0x1, 0xe0000000, 0x1, 0xb0000000,
+  0x1, 0x70000000, 0x1, 0x30000000, 0x1eb, 0x00000000, 0x1, 0x30000000,
+  0x1, 0x70000000, 0x1, 0xb0000000, 0x1, 0xe0000000, 0x14, 0xff000000,
+  0x2, 0xc0000000, 0x1, 0x80000000, 0x1, 0x60000000, 0x1, 0x40000000,
+  0x136, 0x00000000, 0x1, 0x20000000, 0x1, 0x70000000, 0x1, 0xa0000000,
+  0x1, 0xd0000000, 0x14, 0xff000000, 0x1, 0xf0000000, 0x1, 0xc0000000,
+  0x1, 0xa0000000, 0x1, 0x80000000, 0x1, 0x40000000, 0x1, 0x10000000,
+  0x1f4, 0x00000000, 0x1, 0x30000000, 0x2, 0x40000000, 0x1, 0x70000000,
+  0x8, 0x80000000, 0x4, 0x40000000, 0x1, 0x20000000, 0x142, 0x00000000,
+  0x1, 0x30000000, 0x1, 0x40000000, 0x1, 0x60000000, 0xb, 0x80000000,
+  0x1, 0x60000000, 0x2, 0x40000000, 0x1, 0x30000000, 0x57a2, 0x00000000,
+  0x1, 0x00280eb8, 0x1, 0x02280eb8, 0x3298, 0x00000000, 0x1, 0x01280eb8,
+  0x35f, 0x00000000, 0x1, 0x0f280eb8, 0x35f, 0x00000000, 0x1, 0x0e280eb8,
+  0x1, 0x02280eb8, 0x35f, 0x00000000, 0x1, 0x02280eb8, 0x820, 0x00000000,
 };
-unsigned int assets_bongo_cat_both_down_png_len = 18602;
 
-const size_t bongo_cat_both_down_png_size = 18602;
+const embedded_asset_t bongo_cat_both_down_png = {
+    .width = 864,
+    .height = 360,
+    .runs = bongo_cat_both_down_png_runs,
+    .num_runs = 4452,
+};
 
@@ -0,0 +1,182 @@
+// The stb_image implementation lives here: streaming needs its GIF internals,
+// everything else only uses the public API
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_NO_STDIO
+#include "../lib/stb_image.h"
+#include "graphics/gif_stream.h"
+#include "utils/memory.h"
+#include <limits.h>
+#include <string.h>
+
+// Browsers show frames with a delay of 0 or 1 centiseconds for 100 ms
+#define GIF_MIN_DELAY_CS 2
+#define GIF_DEFAULT_DELAY_US 100000L
+
+struct gif_stream_decoder {
+    stbi__context context;
+    stbi__gif gif;
+};
+
+// =============================================================================
+// BLOCK SCANNING
+// =============================================================================
+
+static unsigned int gif_read_le16(const unsigned char *p) {
+    return (unsigned int)p[0] | (unsigned int)p[1] << 8;
+}
+
+// Skips a chain of data sub-blocks; returns the position after the terminator
+static size_t gif_skip_sub_blocks(const unsigned char *data, size_t size, size_t pos) {
+    while (pos < size) {
+        const size_t length = data[pos++];
+        if (length == 0) {
+            return pos;
+        }
+        pos += length;
+    }
+    return SIZE_MAX;
+}
+
+// Returns the number of frames, filling durations_us when given
+static int gif_scan_frames(const unsigned char *data, size_t size, long *durations_us) {
+    const unsigned int flags = data[10];
+    size_t pos = 13;
+    unsigned int delay_cs = 0;
+    int count = 0;
+
+    if (flags & 0x80) {
+        pos += 3 * ((size_t)2 << (flags & 7));  // Global colour table
+    }
+
+    // A truncated file keeps the frames before the damage
+    while (pos < size) {
+        const unsigned char block = data[pos++];
+
+        if (block == 0x21) {
+            if (pos >= size) {
+                break;
+            }
+            const unsigned char label = data[pos++];
+            if (label == 0xF9 && pos + 5 <= size && data[pos] >= 4) {
+                delay_cs = gif_read_le16(data + pos + 2);  // Graphic control extension
+            }
+            pos = gif_skip_sub_blocks(data, size, pos);
+        } else if (block == 0x2C) {
+            if (pos + 10 > size) {
+                break;
+            }
+            const unsigned int local_flags = data[pos + 8];
+            pos += 9;
+            if (local_flags & 0x80) {
+                pos += 3 * ((size_t)2 << (local_flags & 7));
+            }
+            pos = gif_skip_sub_blocks(data, size, pos + 1);  // After the LZW code size
+            if (pos == SIZE_MAX) {
+                break;
+            }
+
+            if (durations_us) {
+                durations_us[count] = delay_cs < GIF_MIN_DELAY_CS ? GIF_DEFAULT_DELAY_US
+                                                                  : delay_cs * 10000L;
+            }
+            count++;
+            delay_cs = 0;  // A control extension only applies to the next image
+        } else {
+            break;  // Trailer, or garbage after the last frame
+        }
+    }
+
+    return count;
+}
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+static void gif_decoder_rewind(gif_stream_t *stream) {
+    struct gif_stream_decoder *decoder = stream->decoder;
+    STBI_FREE(decoder->gif.out);
+    STBI_FREE(decoder->gif.background);
+    STBI_FREE(decoder->gif.history);
+    memset(&decoder->gif, 0, sizeof(decoder->gif));
+    stbi__start_mem(&decoder->context, stream->data, (int)stream->size);
+    stream->next_frame = 0;
+}
+
+// =============================================================================
+// PUBLIC API IMPLEMENTATION
+// =============================================================================
+
+bool gif_stream_is_gif(const unsigned char *data, size_t size) {
+    return size >= 6 && (memcmp(data, "GIF87a", 6) == 0 || memcmp(data, "GIF89a", 6) == 0);
+}
+
+bongocat_error_t gif_stream_open(gif_stream_t *stream, const unsigned char *data, size_t size) {
+    BONGOCAT_CHECK_NULL(stream, BONGOCAT_ERROR_INVALID_PARAM);
+    *stream = (gif_stream_t){ .data = data, .size = size };
+    if (!data || size < 13 || size > INT_MAX || !gif_stream_is_gif(data, size)) {
+        return BONGOCAT_ERROR_INVALID_PARAM;
+    }
+
+    stream->width = (int)gif_read_le16(data + 6);
+    stream->height = (int)gif_read_le16(data + 8);
+    if (stream->width == 0 || stream->height == 0) {
+        return BONGOCAT_ERROR_INVALID_PARAM;
+    }
+
+    stream->num_frames = gif_scan_frames(data, size, NULL);
+    if (stream->num_frames == 0) {
+        return BONGOCAT_ERROR_INVALID_PARAM;
+    }
+
+    // The decoder holds 8k LZW codes, so it lives on the heap
+    stream->frame_duration_us = BONGOCAT_MALLOC((size_t)stream->num_frames * sizeof(long));
+    stream->decoder = BONGOCAT_MALLOC(sizeof(*stream->decoder));
+    if (stream->decoder) {
+        memset(stream->decoder, 0, sizeof(*stream->decoder));
+    }
+    if (!stream->frame_duration_us || !stream->decoder) {
+        gif_stream_close(stream);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+    gif_scan_frames(data, size, stream->frame_duration_us);
+
+    gif_decoder_rewind(stream);
+    return BONGOCAT_SUCCESS;
+}
+
+void gif_stream_close(gif_stream_t *stream) {
+    if (stream->decoder) {
+        gif_decoder_rewind(stream);
+        BONGOCAT_FREE(stream->decoder);
+    }
+    if (stream->frame_duration_us) {
+        BONGOCAT_FREE(stream->frame_duration_us);
+    }
+    *stream = (gif_stream_t){0};
+}
+
+const unsigned char *gif_stream_decode(gif_stream_t *stream, int index) {
+    if (!stream->decoder || index < 0 || index >= stream->num_frames) {
+        return NULL;
+    }
+
+    // Frames are deltas over the canvas, so going back means starting over
+    if (index < stream->next_frame - 1) {
+        gif_decoder_rewind(stream);
+    }
+
+    struct gif_stream_decoder *decoder = stream->decoder;
+    while (stream->next_frame <= index) {
+        int comp;
+        stbi_uc *canvas = stbi__gif_load_next(&decoder->context, &decoder->gif, &comp, 4, NULL);
+        if (!canvas || canvas == (stbi_uc *)&decoder->context) {
+            bongocat_log_warning("Cannot decode GIF frame %d: %s", stream->next_frame,
+                                 canvas ? "unexpected end of file" : stbi_failure_reason());
+            gif_decoder_rewind(stream);
+            return NULL;
+        }
+        stream->next_frame++;
+    }
+    return decoder->gif.out;
+}
@@ -0,0 +1,263 @@
+#include "graphics/timeline.h"
+#include "utils/memory.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *const timeline_state_names[TIMELINE_NUM_STATES] = {
+    [TIMELINE_STATE_IDLE] = "idle",
+    [TIMELINE_STATE_TYPING] = "typing",
+    [TIMELINE_STATE_SLEEP] = "sleep",
+};
+
+// State entered on each event; a key press while typing advances the sequence
+static const timeline_state_t timeline_transitions[TIMELINE_NUM_STATES][TIMELINE_NUM_EVENTS] = {
+    [TIMELINE_STATE_IDLE] = {
+        [TIMELINE_EVENT_KEY] = TIMELINE_STATE_TYPING,
+        [TIMELINE_EVENT_RELEASE] = TIMELINE_STATE_IDLE,
+        [TIMELINE_EVENT_SLEEP] = TIMELINE_STATE_SLEEP,
+        [TIMELINE_EVENT_WAKE] = TIMELINE_STATE_IDLE,
+    },
+    [TIMELINE_STATE_TYPING] = {
+        [TIMELINE_EVENT_KEY] = TIMELINE_STATE_TYPING,
+        [TIMELINE_EVENT_RELEASE] = TIMELINE_STATE_IDLE,
+        [TIMELINE_EVENT_SLEEP] = TIMELINE_STATE_SLEEP,
+        [TIMELINE_EVENT_WAKE] = TIMELINE_STATE_TYPING,
+    },
+    [TIMELINE_STATE_SLEEP] = {
+        [TIMELINE_EVENT_KEY] = TIMELINE_STATE_TYPING,
+        [TIMELINE_EVENT_RELEASE] = TIMELINE_STATE_SLEEP,
+        [TIMELINE_EVENT_SLEEP] = TIMELINE_STATE_SLEEP,
+        [TIMELINE_EVENT_WAKE] = TIMELINE_STATE_IDLE,
+    },
+};
+
+// =============================================================================
+// SEQUENCE PARSING
+// =============================================================================
+
+static const char *timeline_sequence_spec(const config_t *config, timeline_state_t state) {
+    switch (state) {
+        case TIMELINE_STATE_IDLE: return config->idle_sequence;
+        case TIMELINE_STATE_TYPING: return config->typing_sequence;
+        case TIMELINE_STATE_SLEEP: return config->sleep_sequence;
+        default: return NULL;
+    }
+}
+
+static int timeline_count_entries(const char *spec) {
+    int count = 1;
+    for (const char *p = spec; *p; p++) {
+        if (*p == ',') {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Parses "frame[:ms],..." into out; returns the number of steps kept
+static int timeline_parse_sequence(const char *spec, timeline_state_t state, int num_frames,
+                                   const long *frame_duration_us, timeline_step_t *out) {
+    const char *name = timeline_state_names[state];
+    const char *p = spec;
+    int count = 0;
+
+    while (*p) {
+        char *end;
+        long frame = strtol(p, &end, 10);
+        long ms = -1;
+        if (end == p) {
+            bongocat_log_warning("Invalid %s_sequence '%s', expected frame[:ms],...", name, spec);
+            break;
+        }
+        if (*end == ':') {
+            p = end + 1;
+            ms = strtol(p, &end, 10);
+            if (end == p || ms < 0) {
+                bongocat_log_warning("Invalid duration in %s_sequence '%s'", name, spec);
+                break;
+            }
+        }
+        if (*end != ',' && *end != '\0') {
+            bongocat_log_warning("Invalid %s_sequence '%s', expected frame[:ms],...", name, spec);
+            break;
+        }
+
+        if (frame < 0 || frame >= num_frames) {
+            bongocat_log_warning("Frame %ld in %s_sequence out of range [0-%d], skipping",
+                                 frame, name, num_frames - 1);
+        } else {
+            // Without a duration the frame keeps its own, if the animation has one
+            long duration_us = ms >= 0 ? ms * 1000 : 0;
+            if (ms < 0 && frame_duration_us) {
+                duration_us = frame_duration_us[frame];
+            }
+            out[count++] = (timeline_step_t){ .frame = (int)frame, .duration_us = duration_us };
+        }
+        p = *end ? end + 1 : end;
+    }
+
+    return count;
+}
+
+// The classic bongo cat: idle_frame, alternating paws, both paws down asleep.
+// Animations with their own timing instead type through every frame and rest
+// on idle_frame otherwise.
+static int timeline_default_sequence(const config_t *config, timeline_state_t state,
+                                     int num_frames, const long *frame_duration_us,
+                                     timeline_step_t *out) {
+    int frames[2];
+    int count = 1;
+
+    if (frame_duration_us && state == TIMELINE_STATE_TYPING) {
+        for (int i = 0; i < num_frames; i++) {
+            out[i] = (timeline_step_t){ .frame = i, .duration_us = frame_duration_us[i] };
+        }
+        return num_frames;
+    }
+    if (frame_duration_us) {
+        state = TIMELINE_STATE_IDLE;
+    }
+
+    switch (state) {
+        case TIMELINE_STATE_TYPING:
+            frames[0] = BONGOCAT_FRAME_LEFT_DOWN;
+            frames[1] = BONGOCAT_FRAME_RIGHT_DOWN;
+            count = 2;
+            break;
+        case TIMELINE_STATE_SLEEP:
+            frames[0] = BONGOCAT_FRAME_BOTH_DOWN;
+            break;
+        default:
+            frames[0] = config->idle_frame;
+            break;
+    }
+
+    for (int i = 0; i < count; i++) {
+        out[i] = (timeline_step_t){
+            .frame = frames[i] < num_frames ? frames[i] : num_frames - 1,
+            .duration_us = 0,
+        };
+    }
+    return count;
+}
+
+// =============================================================================
+// PUBLIC API IMPLEMENTATION
+// =============================================================================
+
+bongocat_error_t timeline_build(timeline_t *timeline, const config_t *config, int num_frames,
+                                const long *frame_duration_us) {
+    BONGOCAT_CHECK_NULL(timeline, BONGOCAT_ERROR_INVALID_PARAM);
+    BONGOCAT_CHECK_NULL(config, BONGOCAT_ERROR_INVALID_PARAM);
+    *timeline = (timeline_t){0};
+    if (num_frames <= 0) {
+        return BONGOCAT_ERROR_INVALID_PARAM;
+    }
+
+    // Upper bound: every entry of every sequence, or its default
+    const int default_length = frame_duration_us ? num_frames : 2;
+    int capacity = 0;
+    for (int s = 0; s < TIMELINE_NUM_STATES; s++) {
+        const char *spec = timeline_sequence_spec(config, s);
+        capacity += (spec ? timeline_count_entries(spec) : 0) + default_length;
+    }
+
+    timeline->steps = BONGOCAT_MALLOC((size_t)capacity * sizeof(timeline_step_t));
+    timeline->next = BONGOCAT_MALLOC((size_t)capacity * sizeof(int));
+    if (!timeline->steps || !timeline->next) {
+        timeline_free(timeline);
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
+    for (int s = 0; s < TIMELINE_NUM_STATES; s++) {
+        const char *spec = timeline_sequence_spec(config, s);
+        timeline_step_t *out = timeline->steps + timeline->num_steps;
+        int length = spec ? timeline_parse_sequence(spec, s, num_frames, frame_duration_us, out) : 0;
+        if (length == 0) {
+            length = timeline_default_sequence(config, s, num_frames, frame_duration_us, out);
+        }
+
+        timeline->first[s] = timeline->num_steps;
+        timeline->length[s] = length;
+        timeline->cycle_us[s] = 0;
+        for (int k = 0; k < length; k++) {
+            const int step = timeline->first[s] + k;
+            timeline->next[step] = timeline->first[s] + (k + 1) % length;
+            timeline->cycle_us[s] += out[k].duration_us;
+        }
+        for (int k = 0; k < length; k++) {
+            if (out[k].duration_us == 0) {
+                timeline->cycle_us[s] = 0;
+            }
+        }
+        timeline->num_steps += length;
+
+        bongocat_log_debug("Timeline %s: %d steps, %ld us cycle", timeline_state_names[s],
+                           length, timeline->cycle_us[s]);
+    }
+
+    return BONGOCAT_SUCCESS;
+}
+
+void timeline_free(timeline_t *timeline) {
+    if (timeline->steps) {
+        BONGOCAT_FREE(timeline->steps);
+    }
+    if (timeline->next) {
+        BONGOCAT_FREE(timeline->next);
+    }
+    *timeline = (timeline_t){0};
+}
+
+static void timeline_enter_step(const timeline_t *timeline, timeline_cursor_t *cursor,
+                                int step, long start_us) {
+    const long duration_us = timeline->steps[step].duration_us;
+    cursor->step = step;
+    cursor->step_until_us = duration_us > 0 ? start_us + duration_us : 0;
+    if (cursor->state == TIMELINE_STATE_TYPING) {
+        cursor->last_typing_step = step;
+    }
+}
+
+void timeline_reset(const timeline_t *timeline, timeline_cursor_t *cursor,
+                    timeline_state_t state, long now_us) {
+    const int typing = TIMELINE_STATE_TYPING;
+    cursor->state = state;
+    cursor->last_typing_step = timeline->first[typing] + timeline->length[typing] - 1;
+    timeline_enter_step(timeline, cursor, timeline->first[state], now_us);
+}
+
+void timeline_dispatch(const timeline_t *timeline, timeline_cursor_t *cursor,
+                       timeline_event_t event, long now_us) {
+    const timeline_state_t target = timeline_transitions[cursor->state][event];
+
+    if (event == TIMELINE_EVENT_KEY && target == TIMELINE_STATE_TYPING) {
+        // Each press shows the next typing frame, so paws alternate across bursts
+        cursor->state = target;
+        timeline_enter_step(timeline, cursor, timeline->next[cursor->last_typing_step], now_us);
+    } else if (target != cursor->state) {
+        cursor->state = target;
+        timeline_enter_step(timeline, cursor, timeline->first[target], now_us);
+    }
+}
+
+int timeline_tick(const timeline_t *timeline, timeline_cursor_t *cursor, long now_us) {
+    if (cursor->step_until_us > 0 && now_us >= cursor->step_until_us) {
+        // Skip whole loops at once if the wakeup came late
+        long start_us = cursor->step_until_us;
+        const long cycle_us = timeline->cycle_us[cursor->state];
+        if (cycle_us > 0) {
+            start_us += (now_us - start_us) / cycle_us * cycle_us;
+        }
+
+        int step = timeline->next[cursor->step];
+        while (timeline->steps[step].duration_us > 0 &&
+               start_us + timeline->steps[step].duration_us <= now_us) {
+            start_us += timeline->steps[step].duration_us;
+            step = timeline->next[step];
+        }
+        timeline_enter_step(timeline, cursor, step, start_us);
+    }
+
+    return timeline->steps[cursor->step].frame;
+}
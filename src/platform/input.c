@@ -4,394 +4,694 @@
 #include "graphics/animation.h"
 #include "utils/memory.h"
 #include <sys/stat.h>
-#include <sys/wait.h>
-#include <sys/types.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <dirent.h>
+#include <limits.h>
 #include <signal.h>
 #include <unistd.h>
 #include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <time.h>
 
-int *any_key_pressed;
-static pid_t input_child_pid = -1;
+#define INPUT_MAX_EPOLL_EVENTS 16
+#define INPUT_STOP_TAG UINT32_MAX  // epoll data of the stop eventfd; devices use their index
+#define INPUT_HOTPLUG_TAG (UINT32_MAX - 1)
+#define INPUT_STATS_INTERVAL_US 10000000L  // Debug wakeup rate reports
 
-// Child process signal handler - exits quietly without logging
-static void child_signal_handler(int sig) {
-    (void)sig; // Suppress unused parameter warning
-    exit(0);
+#ifndef INPUT_DEVICE_DIR
+#define INPUT_DEVICE_DIR "/dev/input"
+#endif
+#define INPUT_BY_ID_DIR INPUT_DEVICE_DIR "/by-id"
+
+#define INPUT_BITS_PER_LONG (sizeof(unsigned long) * 8)
+#define INPUT_NLONGS(bits) (((bits) + INPUT_BITS_PER_LONG - 1) / INPUT_BITS_PER_LONG)
+
+typedef struct {
+    char *path;         // As configured
+    char *stable_path;  // by-id link found for an eventN path; reconnects follow it
+    int fd;
+    bool monotonic;     // The kernel stamps events with CLOCK_MONOTONIC
+    bool identified;    // id and name below were read from the first device opened
+    struct input_id id;
+    char name[128];
+} input_device_t;
+
+// State of the monitoring thread. Device paths are copied so a config reload
+// can free its own while the thread still runs.
+typedef struct {
+    input_device_t *devices;
+    int num_devices;
+    int enable_debug;
+    int epoll_fd;
+    int stop_fd;
+    int inotify_fd;     // Device node and by-id link creation, -1 to poll instead
+    int device_dir_watch;
+    int by_id_watch;
+    pthread_t thread;
+    bool thread_started;
+} input_monitor_t;
+
+static input_monitor_t monitor = { .epoll_fd = -1, .stop_fd = -1, .inotify_fd = -1 };
+
+// Wakeups of the input thread, reported in debug mode
+typedef struct {
+    long window_start_us;
+    unsigned long wakeups;
+    unsigned long events;     // Evdev events read
+    unsigned long presses;
+} input_stats_t;
+
+// =============================================================================
+// KEY EVENT RING
+// =============================================================================
+
+// Lock-free single-producer/single-consumer queue from the input thread to
+// the animation thread. It holds only indices and plain records, so it would
+// work the same in shared memory. Indices run freely and wrap modulo 2^32.
+#define INPUT_RING_SIZE 256  // Power of two
+
+typedef struct {
+    alignas(64) atomic_uint head;  // Next slot to fill, written by the input thread
+    alignas(64) atomic_uint tail;  // Next slot to take, written by the consumer
+    alignas(64) input_key_event_t events[INPUT_RING_SIZE];
+} input_ring_t;
+
+static input_ring_t key_ring;
+
+static bool input_push_key_event(const input_key_event_t *event) {
+    const unsigned int head = atomic_load_explicit(&key_ring.head, memory_order_relaxed);
+    const unsigned int tail = atomic_load_explicit(&key_ring.tail, memory_order_acquire);
+    if (head - tail == INPUT_RING_SIZE) {
+        return false;
+    }
+
+    key_ring.events[head & (INPUT_RING_SIZE - 1)] = *event;
+    atomic_store_explicit(&key_ring.head, head + 1, memory_order_release);
+    return true;
+}
+
+// =============================================================================
+// DEVICE MANAGEMENT
+// =============================================================================
+
+static bool input_test_bit(unsigned int bit, const unsigned long *bits) {
+    return (bits[bit / INPUT_BITS_PER_LONG] >> (bit % INPUT_BITS_PER_LONG)) & 1;
+}
+
+// Asks the kernel to queue only key events for this reader. Mice, touchpads
+// and other noisy devices listed as keyboards then stop waking us for
+// motion: filtered packets leave only an empty SYN_REPORT, which evdev drops.
+// Releases and autorepeat are key events too and are still skipped here.
+static void input_filter_device(const input_device_t *device, int fd) {
+    unsigned long types[INPUT_NLONGS(EV_CNT)] = {0};
+    if (ioctl(fd, EVIOCGBIT(0, sizeof(types)), types) < 0) {
+        bongocat_log_debug("Cannot query event types of %s: %s", device->path, strerror(errno));
+        return;
+    }
+    if (!input_test_bit(EV_KEY, types)) {
+        bongocat_log_warning("Input device %s reports no key events", device->path);
+    }
+
+    // The EV_SYN mask selects event types; EV_SYN itself is never filtered
+    unsigned long mask[INPUT_NLONGS(EV_CNT)] = {0};
+    mask[EV_KEY / INPUT_BITS_PER_LONG] |= 1UL << (EV_KEY % INPUT_BITS_PER_LONG);
+    struct input_mask input_mask = {
+        .type = EV_SYN,
+        .codes_size = sizeof(mask),
+        .codes_ptr = (uintptr_t)mask,
+    };
+    if (ioctl(fd, EVIOCSMASK, &input_mask) < 0) {
+        // Kernels before 4.4 lack EVIOCSMASK; everything is filtered below instead
+        bongocat_log_debug("Kernel event filtering unavailable for %s: %s", device->path,
+                           strerror(errno));
+        return;
+    }
+    bongocat_log_debug("Kernel filters all but key events on %s", device->path);
+}
+
+// eventN numbers are handed out in plug order, so a reconnected keyboard may
+// come back under another one while its number goes to some other device.
+// Remembers the by-id link of the device that is open now to follow it later.
+static void input_find_stable_path(input_device_t *device, int fd) {
+    static const char by_id_prefix[] = INPUT_BY_ID_DIR "/";
+    if (device->stable_path || strncmp(device->path, by_id_prefix, sizeof(by_id_prefix) - 1) == 0) {
+        return;
+    }
+
+    struct stat opened;
+    DIR *dir = fstat(fd, &opened) == 0 ? opendir(INPUT_BY_ID_DIR) : NULL;
+    if (!dir) {
+        return;  // Devices without a serial or USB path have no link
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        char link[PATH_MAX];
+        struct stat st;
+        if (entry->d_name[0] == '.' ||
+            snprintf(link, sizeof(link), "%s/%s", INPUT_BY_ID_DIR, entry->d_name) >= (int)sizeof(link) ||
+            stat(link, &st) != 0 || !S_ISCHR(st.st_mode) || st.st_rdev != opened.st_rdev) {
+            continue;
+        }
+
+        device->stable_path = strdup(link);
+        if (device->stable_path) {
+            bongocat_log_debug("Following %s as %s", device->path, device->stable_path);
+        }
+        break;
+    }
+    closedir(dir);
+}
+
+// A path without a by-id link is only renumbering-safe after the device was
+// opened once: whatever takes its eventN number later must report the same
+// bus, vendor, product and name
+static bool input_check_identity(input_device_t *device, int fd) {
+    struct input_id id = {0};
+    char name[sizeof(device->name)] = "";
+    if (ioctl(fd, EVIOCGID, &id) < 0 || ioctl(fd, EVIOCGNAME(sizeof(name) - 1), name) < 0) {
+        return true;  // Nothing to compare; not an evdev node
+    }
+
+    if (!device->identified) {
+        device->id = id;
+        memcpy(device->name, name, sizeof(name));
+        device->identified = true;
+        return true;
+    }
+
+    if (id.bustype != device->id.bustype || id.vendor != device->id.vendor ||
+        id.product != device->id.product || strcmp(name, device->name) != 0) {
+        bongocat_log_warning("%s is now \"%s\" instead of \"%s\", waiting for the keyboard",
+                             device->path, name, device->name);
+        return false;
+    }
+    return true;
+}
+
+static bool input_open_device(input_device_t *device, uint32_t index) {
+    const char *path = device->stable_path ? device->stable_path : device->path;
+
+    // Validate device path exists and is readable
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return false;
+    }
+
+    if (!S_ISCHR(st.st_mode)) {
+        bongocat_log_warning("Input device is not a character device: %s", path);
+        return false;
+    }
+
+    int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        // udev sets the node's group just after creating it; the attribute change retries
+        bongocat_log_warning("Failed to open %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    if (!device->stable_path && !input_check_identity(device, fd)) {
+        close(fd);
+        return false;
+    }
+
+    struct epoll_event event = { .events = EPOLLIN, .data.u32 = index };
+    if (epoll_ctl(monitor.epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        bongocat_log_warning("Failed to watch %s: %s", device->path, strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    // Timestamps are compared with the animation's monotonic clock
+    int clock_id = CLOCK_MONOTONIC;
+    device->monotonic = ioctl(fd, EVIOCSCLOCKID, &clock_id) == 0;
+    input_filter_device(device, fd);
+    input_find_stable_path(device, fd);
+
+    device->fd = fd;
+    return true;
+}
+
+static void input_close_device(input_device_t *device) {
+    if (device->fd >= 0) {
+        // Closing the last reference removes it from the epoll set
+        close(device->fd);
+        device->fd = -1;
+    }
+}
+
+static void input_free_devices(void) {
+    for (int i = 0; i < monitor.num_devices; i++) {
+        input_close_device(&monitor.devices[i]);
+        BONGOCAT_SAFE_FREE(monitor.devices[i].path);
+        BONGOCAT_SAFE_FREE(monitor.devices[i].stable_path);
+    }
+    BONGOCAT_SAFE_FREE(monitor.devices);
+    monitor.num_devices = 0;
 }
 
-static void capture_input_multiple(char **device_paths, int num_devices, int enable_debug) {
-    // Set up child-specific signal handlers to avoid duplicate logging
-    struct sigaction sa;
-    sa.sa_handler = child_signal_handler;
-    sigemptyset(&sa.sa_mask);
-    sa.sa_flags = 0;
-    sigaction(SIGTERM, &sa, NULL);
-    sigaction(SIGINT, &sa, NULL);
-    
-    bongocat_log_debug("Starting input capture on %d devices", num_devices);
-    
-    int *fds = BONGOCAT_MALLOC(num_devices * sizeof(int));
-    char **unique_paths = BONGOCAT_MALLOC(num_devices * sizeof(char*));
-    if (!fds || !unique_paths) {
-        bongocat_log_error("Failed to allocate memory for file descriptors");
-        exit(1);
-    }
-    
-    int max_fd = -1;
-    int valid_devices = 0;
-    int unique_devices = 0;
-    
-    // First pass: deduplicate device paths
+// Copies the deduplicated device paths; nothing is opened yet
+static bongocat_error_t input_copy_devices(char **device_paths, int num_devices) {
+    monitor.devices = BONGOCAT_MALLOC((size_t)num_devices * sizeof(input_device_t));
+    if (!monitor.devices) {
+        bongocat_log_error("Failed to allocate memory for input devices");
+        return BONGOCAT_ERROR_MEMORY;
+    }
+
     for (int i = 0; i < num_devices; i++) {
         bool is_duplicate = false;
-        for (int j = 0; j < unique_devices; j++) {
-            if (strcmp(device_paths[i], unique_paths[j]) == 0) {
+        for (int j = 0; j < monitor.num_devices; j++) {
+            if (strcmp(device_paths[i], monitor.devices[j].path) == 0) {
                 is_duplicate = true;
                 break;
             }
         }
-        if (!is_duplicate) {
-            unique_paths[unique_devices] = device_paths[i];
-            unique_devices++;
+        if (is_duplicate) {
+            continue;
+        }
+
+        char *path = strdup(device_paths[i]);
+        if (!path) {
+            bongocat_log_error("Failed to allocate memory for input device path");
+            input_free_devices();
+            return BONGOCAT_ERROR_MEMORY;
         }
+        monitor.devices[monitor.num_devices++] = (input_device_t){ .path = path, .fd = -1 };
     }
-    
-    bongocat_log_debug("Deduplicated %d devices to %d unique devices", num_devices, unique_devices);
-    
-    // Open all unique devices
-    for (int i = 0; i < unique_devices; i++) {
-        fds[i] = -1;
-        
-        // Validate device path exists and is readable
-        struct stat st;
-        if (stat(unique_paths[i], &st) != 0) {
-            bongocat_log_warning("Input device does not exist: %s", unique_paths[i]);
+
+    bongocat_log_debug("Deduplicated %d devices to %d unique devices", num_devices, monitor.num_devices);
+    return BONGOCAT_SUCCESS;
+}
+
+// Opens devices that are not open yet; returns how many were opened
+static int input_open_missing_devices(bool initial) {
+    int opened = 0;
+    for (int i = 0; i < monitor.num_devices; i++) {
+        input_device_t *device = &monitor.devices[i];
+        if (device->fd >= 0) {
             continue;
         }
-        
-        if (!S_ISCHR(st.st_mode)) {
-            bongocat_log_warning("Input device is not a character device: %s", unique_paths[i]);
+
+        if (!input_open_device(device, (uint32_t)i)) {
+            if (initial) {
+                bongocat_log_warning("Input device does not exist: %s", device->path);
+                if (strncmp(device->path, INPUT_BY_ID_DIR "/", sizeof(INPUT_BY_ID_DIR)) != 0) {
+                    bongocat_log_warning("Until it is opened once, %s is matched by number only "
+                                         "and may open another device; use a %s path",
+                                         device->path, INPUT_BY_ID_DIR);
+                }
+            }
+            continue;
+        }
+
+        if (initial) {
+            bongocat_log_info("Input monitoring started on %s (fd=%d)", device->path, device->fd);
+        } else {
+            bongocat_log_info("Input device reconnected: %s (fd=%d)", device->path, device->fd);
+        }
+        opened++;
+    }
+    return opened;
+}
+
+// =============================================================================
+// HOTPLUG
+// =============================================================================
+
+static void input_watch_by_id(void) {
+    if (monitor.by_id_watch < 0) {
+        // Only exists while some device has an id; its creation is watched too
+        monitor.by_id_watch = inotify_add_watch(monitor.inotify_fd, INPUT_BY_ID_DIR,
+                                                IN_CREATE | IN_MOVED_TO | IN_DELETE_SELF);
+    }
+}
+
+// New nodes and links wake the thread, so it never polls for missing devices
+static bool input_watch_hotplug(void) {
+    monitor.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (monitor.inotify_fd < 0) {
+        bongocat_log_warning("Cannot watch for input hotplug, polling instead: %s", strerror(errno));
+        return false;
+    }
+
+    monitor.device_dir_watch = inotify_add_watch(monitor.inotify_fd, INPUT_DEVICE_DIR,
+                                                 IN_CREATE | IN_ATTRIB | IN_MOVED_TO);
+    monitor.by_id_watch = -1;
+    struct epoll_event event = { .events = EPOLLIN, .data.u32 = INPUT_HOTPLUG_TAG };
+    if (monitor.device_dir_watch < 0 ||
+        epoll_ctl(monitor.epoll_fd, EPOLL_CTL_ADD, monitor.inotify_fd, &event) < 0) {
+        bongocat_log_warning("Cannot watch %s for hotplug, polling instead: %s", INPUT_DEVICE_DIR,
+                             strerror(errno));
+        close(monitor.inotify_fd);
+        monitor.inotify_fd = -1;
+        return false;
+    }
+    input_watch_by_id();
+    return true;
+}
+
+// Drains the inotify queue; returns whether a missing device may have appeared
+static bool input_read_hotplug(void) {
+    alignas(struct inotify_event) char buffer[4096];
+    bool changed = false;
+
+    ssize_t length;
+    while ((length = read(monitor.inotify_fd, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t pos = 0; pos < length;) {
+            const struct inotify_event *event = (const struct inotify_event *)(buffer + pos);
+            pos += (ssize_t)(sizeof(struct inotify_event) + event->len);
+
+            // udev removes by-id with its last link and the kernel drops the
+            // watch; it is added again when the directory comes back
+            if (event->wd == monitor.by_id_watch && (event->mask & (IN_DELETE_SELF | IN_IGNORED))) {
+                monitor.by_id_watch = -1;
+            }
+            if (event->wd == monitor.device_dir_watch && (event->mask & IN_ISDIR) &&
+                event->len > 0 && strcmp(event->name, "by-id") == 0) {
+                input_watch_by_id();
+            }
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// =============================================================================
+// EVENT LOOP
+// =============================================================================
+
+static long input_now_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000L + now.tv_nsec / 1000;
+}
+
+static long input_event_time_us(const input_device_t *device, const struct input_event *ev) {
+    if (device->monotonic) {
+        return ev->time.tv_sec * 1000000L + ev->time.tv_usec;
+    }
+
+    // Realtime kernel stamps would jump with the wall clock, use the read time
+    return input_now_us();
+}
+
+// Logs the rate over the last window from a wakeup that happened anyway
+static void input_stats_wakeup(input_stats_t *stats) {
+    stats->wakeups++;
+
+    const long now_us = input_now_us();
+    const long elapsed_us = now_us - stats->window_start_us;
+    if (elapsed_us < INPUT_STATS_INTERVAL_US) {
+        return;
+    }
+    if (monitor.enable_debug) {
+        bongocat_log_debug("Input thread: %lu wakeups/s, %lu events/s, %lu key presses/s",
+                           stats->wakeups * 1000000UL / (unsigned long)elapsed_us,
+                           stats->events * 1000000UL / (unsigned long)elapsed_us,
+                           stats->presses * 1000000UL / (unsigned long)elapsed_us);
+    }
+    *stats = (input_stats_t){ .window_start_us = now_us };
+}
+
+// Returns false once the device has gone away
+static bool input_read_device(input_device_t *device, uint16_t index, int enable_debug,
+                              input_stats_t *stats) {
+    struct input_event ev[128];
+    ssize_t rd = read(device->fd, ev, sizeof(ev));
+    if (rd < 0) {
+        if (errno == EAGAIN || errno == EINTR) {
+            return true;
+        }
+        if (errno == ENODEV) {
+            bongocat_log_info("Input device disconnected: %s", device->path);
+        } else {
+            bongocat_log_warning("Read error on %s: %s", device->path, strerror(errno));
+        }
+        return false;
+    }
+
+    if (rd == 0) {
+        bongocat_log_warning("EOF on input device %s", device->path);
+        return false;
+    }
+
+    int num_events = (int)(rd / (ssize_t)sizeof(struct input_event));
+    bool key_pressed = false;
+    stats->events += (unsigned long)num_events;
+
+    for (int j = 0; j < num_events; j++) {
+        if (ev[j].type != EV_KEY || ev[j].value != 1) {
             continue;
         }
-        
-        fds[i] = open(unique_paths[i], O_RDONLY | O_NONBLOCK);
-        if (fds[i] < 0) {
-            bongocat_log_warning("Failed to open %s: %s", unique_paths[i], strerror(errno));
+
+        const input_key_event_t event = {
+            .time_us = input_event_time_us(device, &ev[j]),
+            .device = index,
+            .keycode = ev[j].code,
+        };
+        if (!input_push_key_event(&event)) {
+            bongocat_log_debug("Key event queue full, dropping key %d", ev[j].code);
             continue;
         }
-        
-        bongocat_log_info("Input monitoring started on %s (fd=%d)", unique_paths[i], fds[i]);
-        if (fds[i] > max_fd) {
-            max_fd = fds[i];
+        key_pressed = true;
+        stats->presses++;
+
+        if (enable_debug) {
+            bongocat_log_debug("Key event: device=%s, code=%d, time=%ld.%06ld",
+                               device->path, ev[j].code, ev[j].time.tv_sec, ev[j].time.tv_usec);
         }
-        valid_devices++;
     }
-    
-    // Update num_devices to reflect unique devices for the rest of the function
-    num_devices = unique_devices;
-    
-    if (valid_devices == 0) {
+
+    // Wake the animation once per batch, it drains the queue itself
+    if (key_pressed) {
+        animation_trigger();
+    }
+    return true;
+}
+
+// Leave shutdown signals to the main thread
+static void input_block_signals(void) {
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+}
+
+static void *input_thread_main(void *arg __attribute__((unused))) {
+    input_block_signals();
+
+    bongocat_log_debug("Starting input capture on %d devices", monitor.num_devices);
+
+    // Watch before the first open so nothing plugged in between is missed
+    const bool hotplug = input_watch_hotplug();
+
+    int valid_devices = input_open_missing_devices(true);
+    if (valid_devices == 0 && !hotplug) {
         bongocat_log_error("No valid input devices found");
-        BONGOCAT_SAFE_FREE(fds);
-        exit(1);
-    }
-    
-    bongocat_log_info("Successfully opened %d/%d input devices", valid_devices, num_devices);
-
-    struct input_event ev[128]; // Increased buffer size for better I/O efficiency
-    int rd;
-    fd_set readfds;
-    struct timeval timeout;
-    int check_counter = 0;
-    int adaptive_check_interval = 5; // Start with 5 seconds, can increase to 30
-    
-    while (1) {
-        FD_ZERO(&readfds);
-        
-        // Optimize: only rebuild fd_set when devices change, track current max_fd
-        int current_max_fd = -1;
-        for (int i = 0; i < num_devices; i++) {
-            if (fds[i] >= 0) {
-                FD_SET(fds[i], &readfds);
-                if (fds[i] > current_max_fd) {
-                    current_max_fd = fds[i];
-                }
-            }
-        }
-        max_fd = current_max_fd;
-        
-        timeout.tv_sec = 1;
-        timeout.tv_usec = 0;
-        
-        int select_result = select(max_fd + 1, &readfds, NULL, NULL, &timeout);
-        if (select_result < 0) {
-            if (errno == EINTR) continue; // Interrupted by signal
-            bongocat_log_error("Select error: %s", strerror(errno));
+        return NULL;
+    }
+    if (valid_devices == 0) {
+        bongocat_log_warning("No valid input devices found, waiting for them to be connected");
+    } else {
+        bongocat_log_info("Successfully opened %d/%d input devices", valid_devices, monitor.num_devices);
+    }
+
+    struct epoll_event events[INPUT_MAX_EPOLL_EVENTS];
+    input_stats_t stats = { .window_start_us = input_now_us() };
+    int check_interval = 5;  // Seconds between looks for missing devices, grows to 30
+    bool running = true;
+
+    while (running) {
+        // Only input, hotplug or the stop request wake us up; without inotify
+        // missing devices are looked for on a timer
+        int timeout_ms = !hotplug && valid_devices < monitor.num_devices ? check_interval * 1000 : -1;
+        int count = epoll_wait(monitor.epoll_fd, events, INPUT_MAX_EPOLL_EVENTS, timeout_ms);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            bongocat_log_error("Input epoll error: %s", strerror(errno));
             break;
         }
-        
-        if (select_result == 0) {
+        input_stats_wakeup(&stats);
+
+        if (count == 0) {
             // Adaptive device checking - start at 5 seconds, increase to 30 if no new devices found
-            check_counter++;
-            if (check_counter >= adaptive_check_interval) {
-                check_counter = 0;
-                bool found_new_device = false;
-                
-                // Check for devices that have become available
-                for (int i = 0; i < num_devices; i++) {
-                    if (fds[i] < 0) { // Device was not available before
-                        struct stat st;
-                        if (stat(unique_paths[i], &st) == 0 && S_ISCHR(st.st_mode)) {
-                            // Device is now available, try to open it
-                            int new_fd = open(unique_paths[i], O_RDONLY | O_NONBLOCK);
-                            if (new_fd >= 0) {
-                                fds[i] = new_fd;
-                                if (new_fd > max_fd) {
-                                    max_fd = new_fd;
-                                }
-                                valid_devices++;
-                                found_new_device = true;
-                                bongocat_log_info("New input device detected and opened: %s (fd=%d)", unique_paths[i], new_fd);
-                            }
-                        }
-                    }
-                }
-                
-                // Adaptive interval: if no new devices found, increase check interval up to 30 seconds
-                if (!found_new_device && adaptive_check_interval < 30) {
-                    adaptive_check_interval = (adaptive_check_interval < 15) ? 15 : 30;
-                    bongocat_log_debug("Increased device check interval to %d seconds", adaptive_check_interval);
-                } else if (found_new_device && adaptive_check_interval > 5) {
-                    // Reset to frequent checking when devices are being connected
-                    adaptive_check_interval = 5;
-                    bongocat_log_debug("Reset device check interval to 5 seconds");
-                }
+            int opened = input_open_missing_devices(false);
+            valid_devices += opened;
+            if (opened == 0 && check_interval < 30) {
+                check_interval = (check_interval < 15) ? 15 : 30;
+                bongocat_log_debug("Increased device check interval to %d seconds", check_interval);
+            } else if (opened > 0 && check_interval > 5) {
+                // Reset to frequent checking when devices are being connected
+                check_interval = 5;
+                bongocat_log_debug("Reset device check interval to 5 seconds");
             }
-            continue; // Continue to next iteration
+            continue;
         }
-        
-        // Check which devices have data
-        for (int i = 0; i < num_devices; i++) {
-            if (fds[i] >= 0 && FD_ISSET(fds[i], &readfds)) {
-                rd = read(fds[i], ev, sizeof(ev));
-                if (rd < 0) {
-                    if (errno == EAGAIN) continue;
-                    bongocat_log_warning("Read error on %s: %s", unique_paths[i], strerror(errno));
-                    close(fds[i]);
-                    fds[i] = -1;
-                    valid_devices--;
-                    continue;
-                }
-                
-                if (rd == 0) {
-                    bongocat_log_warning("EOF on input device %s", unique_paths[i]);
-                    close(fds[i]);
-                    fds[i] = -1;
-                    valid_devices--;
-                    continue;
-                }
 
-                // Batch process events for better performance
-                int num_events = rd / sizeof(struct input_event);
-                bool key_pressed = false;
-                
-                for (int j = 0; j < num_events; j++) {
-                    if (ev[j].type == EV_KEY && ev[j].value == 1) {
-                        key_pressed = true;
-                        if (enable_debug) {
-                            bongocat_log_debug("Key event: device=%s, code=%d, time=%ld.%06ld", 
-                                             unique_paths[i], ev[j].code, ev[j].time.tv_sec, ev[j].time.tv_usec);
-                        }
-                    }
-                }
-                
-                // Trigger animation only once per batch to reduce overhead
-                if (key_pressed) {
-                    animation_trigger();
+        for (int i = 0; i < count; i++) {
+            if (events[i].data.u32 == INPUT_STOP_TAG) {
+                running = false;
+                continue;
+            }
+            if (events[i].data.u32 == INPUT_HOTPLUG_TAG) {
+                if (input_read_hotplug() && valid_devices < monitor.num_devices) {
+                    valid_devices += input_open_missing_devices(false);
                 }
+                continue;
+            }
+
+            const uint32_t index = events[i].data.u32;
+            input_device_t *device = &monitor.devices[index];
+            if (device->fd < 0) {
+                continue;  // Closed earlier in this batch
+            }
+            if (!input_read_device(device, (uint16_t)index, monitor.enable_debug, &stats)) {
+                input_close_device(device);
+                valid_devices--;
             }
         }
-        
-        // Exit if no valid devices remain
-        if (valid_devices == 0) {
+
+        // Without hotplug events nobody would notice the devices coming back
+        if (running && valid_devices == 0 && !hotplug) {
             bongocat_log_error("All input devices became unavailable");
             break;
         }
     }
-    
-    // Close all file descriptors
-    for (int i = 0; i < num_devices; i++) {
-        if (fds[i] >= 0) {
-            close(fds[i]);
+
+    bongocat_log_info("Input monitoring stopped");
+    return NULL;
+}
+
+// =============================================================================
+// THREAD MANAGEMENT
+// =============================================================================
+
+static void input_stop_monitoring(void) {
+    if (monitor.thread_started) {
+        uint64_t one = 1;
+        if (write(monitor.stop_fd, &one, sizeof(one)) < 0) {
+            bongocat_log_warning("Failed to stop input thread: %s", strerror(errno));
         }
+        pthread_join(monitor.thread, NULL);
+        monitor.thread_started = false;
     }
-    
-    BONGOCAT_SAFE_FREE(fds);
-    BONGOCAT_SAFE_FREE(unique_paths);
-    bongocat_log_info("Input monitoring stopped");
+
+    input_free_devices();
+    if (monitor.epoll_fd >= 0) {
+        close(monitor.epoll_fd);
+        monitor.epoll_fd = -1;
+    }
+    if (monitor.stop_fd >= 0) {
+        close(monitor.stop_fd);
+        monitor.stop_fd = -1;
+    }
+    if (monitor.inotify_fd >= 0) {
+        close(monitor.inotify_fd);
+        monitor.inotify_fd = -1;
+    }
+}
+
+static bongocat_error_t input_spawn_monitoring(char **device_paths, int num_devices, int enable_debug) {
+    bongocat_error_t result = input_copy_devices(device_paths, num_devices);
+    if (result != BONGOCAT_SUCCESS) {
+        return result;
+    }
+    monitor.enable_debug = enable_debug;
+
+    monitor.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    monitor.stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (monitor.epoll_fd < 0 || monitor.stop_fd < 0) {
+        bongocat_log_error("Failed to create input event queue: %s", strerror(errno));
+        input_stop_monitoring();
+        return BONGOCAT_ERROR_INPUT;
+    }
+
+    struct epoll_event event = { .events = EPOLLIN, .data.u32 = INPUT_STOP_TAG };
+    if (epoll_ctl(monitor.epoll_fd, EPOLL_CTL_ADD, monitor.stop_fd, &event) < 0) {
+        bongocat_log_error("Failed to watch input stop event: %s", strerror(errno));
+        input_stop_monitoring();
+        return BONGOCAT_ERROR_INPUT;
+    }
+
+    int err = pthread_create(&monitor.thread, NULL, input_thread_main, NULL);
+    if (err != 0) {
+        bongocat_log_error("Failed to create input monitoring thread: %s", strerror(err));
+        input_stop_monitoring();
+        return BONGOCAT_ERROR_THREAD;
+    }
+    monitor.thread_started = true;
+    return BONGOCAT_SUCCESS;
 }
 
+// =============================================================================
+// PUBLIC API IMPLEMENTATION
+// =============================================================================
+
 bongocat_error_t input_start_monitoring(char **device_paths, int num_devices, int enable_debug) {
     BONGOCAT_CHECK_NULL(device_paths, BONGOCAT_ERROR_INVALID_PARAM);
-    
+
     if (num_devices <= 0) {
         bongocat_log_error("No input devices specified");
         return BONGOCAT_ERROR_INVALID_PARAM;
     }
-    
+
     bongocat_log_info("Initializing input monitoring system for %d devices", num_devices);
-    
-    // Initialize shared memory for key press flag
-    any_key_pressed = (int *)mmap(NULL, sizeof(int), PROT_READ | PROT_WRITE, 
-                                 MAP_SHARED | MAP_ANONYMOUS, -1, 0);
-    if (any_key_pressed == MAP_FAILED) {
-        bongocat_log_error("Failed to create shared memory for input monitoring: %s", strerror(errno));
-        return BONGOCAT_ERROR_MEMORY;
-    }
-    *any_key_pressed = 0;
 
-    // Fork process for input monitoring
-    input_child_pid = fork();
-    if (input_child_pid < 0) {
-        bongocat_log_error("Failed to fork input monitoring process: %s", strerror(errno));
-        munmap(any_key_pressed, sizeof(int));
-        any_key_pressed = NULL;
-        return BONGOCAT_ERROR_THREAD;
-    }
-    
-    if (input_child_pid == 0) {
-        // Child process - handle keyboard input from multiple devices
-        bongocat_log_debug("Input monitoring child process started (PID: %d)", getpid());
-        capture_input_multiple(device_paths, num_devices, enable_debug);
-        exit(0);
+    bongocat_error_t result = input_spawn_monitoring(device_paths, num_devices, enable_debug);
+    if (result != BONGOCAT_SUCCESS) {
+        return result;
     }
-    
-    bongocat_log_info("Input monitoring started (child PID: %d)", input_child_pid);
+
+    bongocat_log_info("Input monitoring started");
     return BONGOCAT_SUCCESS;
 }
 
 bongocat_error_t input_restart_monitoring(char **device_paths, int num_devices, int enable_debug) {
+    BONGOCAT_CHECK_NULL(device_paths, BONGOCAT_ERROR_INVALID_PARAM);
+
     bongocat_log_info("Restarting input monitoring system");
-    
+
     // Stop current monitoring
-    if (input_child_pid > 0) {
-        bongocat_log_debug("Stopping current input monitoring (PID: %d)", input_child_pid);
-        kill(input_child_pid, SIGTERM);
-        
-        // Wait for child to terminate with timeout
-        int status;
-        int wait_attempts = 0;
-        while (wait_attempts < 10) {
-            pid_t result = waitpid(input_child_pid, &status, WNOHANG);
-            if (result == input_child_pid) {
-                bongocat_log_debug("Previous input monitoring process terminated");
-                break;
-            } else if (result == -1) {
-                if (errno == ECHILD) {
-                    // Child already reaped by signal handler - this is normal
-                    bongocat_log_debug("Input child process already cleaned up by signal handler");
-                    break;
-                } else {
-                    bongocat_log_warning("Error waiting for input child process: %s", strerror(errno));
-                    break;
-                }
-            }
-            
-            usleep(100000); // Wait 100ms
-            wait_attempts++;
-        }
-        
-        // Force kill if still running
-        if (wait_attempts >= 10) {
-            bongocat_log_warning("Force killing previous input monitoring process");
-            kill(input_child_pid, SIGKILL);
-            waitpid(input_child_pid, &status, 0);
-        }
-        
-        input_child_pid = -1;
-    }
-    
-    // Start new monitoring (reuse shared memory if it exists)
-    bool need_new_shm = (any_key_pressed == NULL || any_key_pressed == MAP_FAILED);
-    
-    if (need_new_shm) {
-        any_key_pressed = (int *)mmap(NULL, sizeof(int), PROT_READ | PROT_WRITE, 
-                                     MAP_SHARED | MAP_ANONYMOUS, -1, 0);
-        if (any_key_pressed == MAP_FAILED) {
-            bongocat_log_error("Failed to create shared memory for input monitoring: %s", strerror(errno));
-            return BONGOCAT_ERROR_MEMORY;
-        }
-        *any_key_pressed = 0;
-    }
+    bongocat_log_debug("Stopping current input monitoring");
+    input_stop_monitoring();
 
-    // Fork new process for input monitoring
-    input_child_pid = fork();
-    if (input_child_pid < 0) {
-        bongocat_log_error("Failed to fork input monitoring process: %s", strerror(errno));
-        if (need_new_shm) {
-            munmap(any_key_pressed, sizeof(int));
-            any_key_pressed = NULL;
-        }
-        return BONGOCAT_ERROR_THREAD;
+    if (num_devices <= 0) {
+        bongocat_log_error("No input devices specified");
+        return BONGOCAT_ERROR_INVALID_PARAM;
     }
-    
-    if (input_child_pid == 0) {
-        // Child process - handle keyboard input from multiple devices
-        bongocat_log_debug("Input monitoring child process restarted (PID: %d)", getpid());
-        capture_input_multiple(device_paths, num_devices, enable_debug);
-        exit(0);
+
+    bongocat_error_t result = input_spawn_monitoring(device_paths, num_devices, enable_debug);
+    if (result != BONGOCAT_SUCCESS) {
+        return result;
     }
-    
-    bongocat_log_info("Input monitoring restarted (child PID: %d)", input_child_pid);
+
+    bongocat_log_info("Input monitoring restarted");
     return BONGOCAT_SUCCESS;
 }
 
+bool input_pop_key_event(input_key_event_t *event) {
+    const unsigned int tail = atomic_load_explicit(&key_ring.tail, memory_order_relaxed);
+    const unsigned int head = atomic_load_explicit(&key_ring.head, memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+
+    *event = key_ring.events[tail & (INPUT_RING_SIZE - 1)];
+    atomic_store_explicit(&key_ring.tail, tail + 1, memory_order_release);
+    return true;
+}
+
+bool input_has_key_events(void) {
+    return atomic_load_explicit(&key_ring.head, memory_order_acquire) !=
+           atomic_load_explicit(&key_ring.tail, memory_order_relaxed);
+}
+
 void input_cleanup(void) {
     bongocat_log_info("Cleaning up input monitoring system");
-    
-    // Terminate child process if it exists
-    if (input_child_pid > 0) {
-        bongocat_log_debug("Terminating input monitoring child process (PID: %d)", input_child_pid);
-        kill(input_child_pid, SIGTERM);
-        
-        // Wait for child to terminate with timeout
-        int status;
-        int wait_attempts = 0;
-        while (wait_attempts < 10) {
-            pid_t result = waitpid(input_child_pid, &status, WNOHANG);
-            if (result == input_child_pid) {
-                bongocat_log_debug("Input monitoring child process terminated gracefully");
-                break;
-            } else if (result == -1) {
-                if (errno == ECHILD) {
-                    // Child already reaped by signal handler - this is normal
-                    bongocat_log_debug("Input child process already cleaned up by signal handler");
-                    break;
-                } else {
-                    bongocat_log_warning("Error waiting for input child process: %s", strerror(errno));
-                    break;
-                }
-            }
-            
-            usleep(100000); // Wait 100ms
-            wait_attempts++;
-        }
-        
-        // Force kill if still running
-        if (wait_attempts >= 10) {
-            bongocat_log_warning("Force killing input monitoring child process");
-            kill(input_child_pid, SIGKILL);
-            waitpid(input_child_pid, &status, 0);
-        }
-        
-        input_child_pid = -1;
-    }
-    
-    // Cleanup shared memory
-    if (any_key_pressed && any_key_pressed != MAP_FAILED) {
-        munmap(any_key_pressed, sizeof(int));
-        any_key_pressed = NULL;
-    }
-    
+    input_stop_monitoring();
     bongocat_log_debug("Input monitoring cleanup complete");
-}
\ No newline at end of file
+}
@@ -3,8 +3,13 @@
 #include "graphics/animation.h"
 #include <poll.h>
 #include <sys/time.h>
+#include <time.h>
 #include "../protocols/wlr-foreign-toplevel-management-v1-client-protocol.h"
 #include "../protocols/xdg-output-unstable-v1-client-protocol.h"
+#include "../protocols/viewporter-client-protocol.h"
+#include "../protocols/fractional-scale-v1-client-protocol.h"
+#include "../protocols/presentation-time-client-protocol.h"
+#include "utils/latency.h"
 
 // =============================================================================
 // GLOBAL STATE AND CONFIGURATION
@@ -20,12 +25,13 @@ struct zwlr_layer_shell_v1 *layer_shell;
 struct xdg_wm_base *xdg_wm_base;
 struct wl_output *output;
 struct wl_surface *surface;
-struct wl_buffer *buffer;
 struct zwlr_layer_surface_v1 *layer_surface;
-uint8_t *pixels;
 
 static config_t *current_config;
 
+// Serializes drawing against buffer release and reallocation on config reload
+static pthread_mutex_t buffer_lock = PTHREAD_MUTEX_INITIALIZER;
+
 // =============================================================================
 // SCREEN DIMENSION MANAGEMENT
 // =============================================================================
@@ -59,8 +65,12 @@ static void handle_xdg_output_name(void *data, struct zxdg_output_v1 *xdg_output
 
 static void handle_xdg_output_logical_position(void *data, struct zxdg_output_v1 *xdg_output,
                                                int32_t x, int32_t y) {}
-static void handle_xdg_output_logical_size(void *data, struct zxdg_output_v1 *xdg_output,
-                                           int32_t width, int32_t height) {}
+static void handle_xdg_output_logical_size(void *data, struct zxdg_output_v1 *xdg_output __attribute__((unused)),
+                                           int32_t width, int32_t height) {
+    output_ref_t *oref = data;
+    oref->logical_width = width;
+    oref->logical_height = height;
+}
 static void handle_xdg_output_done(void *data, struct zxdg_output_v1 *xdg_output) {}
 
 static void handle_xdg_output_description(void *data, struct zxdg_output_v1 *xdg_output, const char *description) {
@@ -265,10 +275,249 @@ static void screen_calculate_dimensions(void) {
     }
 }
 
+static output_ref_t *output_find(const struct wl_output *wl_output) {
+    for (size_t i = 0; i < output_count; i++) {
+        if (outputs[i].wl_output == wl_output) {
+            return &outputs[i];
+        }
+    }
+    return NULL;
+}
+
+// Layout works in surface coordinates, which are the output's logical size
+static void screen_apply_logical_size(void) {
+    const output_ref_t *oref = output_find(output);
+    if (!oref || screen_info.screen_width <= 0) {
+        return;
+    }
+
+    if (oref->logical_width > 0 && oref->logical_height > 0) {
+        screen_info.screen_width = oref->logical_width;
+        screen_info.screen_height = oref->logical_height;
+    } else if (oref->scale > 1) {
+        screen_info.screen_width /= oref->scale;
+        screen_info.screen_height /= oref->scale;
+    } else {
+        return;
+    }
+    bongocat_log_info("Logical screen size: %dx%d", screen_info.screen_width,
+                      screen_info.screen_height);
+}
+
+// =============================================================================
+// OUTPUT SCALE MANAGEMENT
+// =============================================================================
+
+// Buffers are rendered at the scale of the outputs the surface is on.
+// Integer scales only need wl_surface.set_buffer_scale; fractional ones come
+// from wp_fractional_scale_v1 and need wp_viewporter to map the buffer back
+// onto the surface.
+static struct wp_viewporter *viewporter = NULL;
+static struct wl_subcompositor *subcompositor = NULL;
+static struct wp_fractional_scale_manager_v1 *fractional_scale_manager = NULL;
+static struct wp_viewport *viewport = NULL;
+static struct wp_fractional_scale_v1 *fractional_scale = NULL;
+static int preferred_scale = 0;            // From wp_fractional_scale_v1, 0 until received
+static bool surface_on_output[MAX_OUTPUTS];
+static int surface_scale = 0;              // Last scale handed to the animation
+
+// Guards the output list and the scale state above: output events update them
+// on the Wayland thread while a config reload runs scale_update() on the
+// watcher thread
+static pthread_mutex_t scale_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int scale_from_outputs(void) {
+    int scale = 0;
+    for (size_t i = 0; i < output_count; i++) {
+        if (surface_on_output[i] && outputs[i].scale > scale) {
+            scale = outputs[i].scale;
+        }
+    }
+
+    // Until the surface is mapped, assume the output it was created for
+    const output_ref_t *oref = output_find(output);
+    if (scale == 0 && oref) {
+        scale = oref->scale;
+    }
+    return scale > 0 ? scale : 1;
+}
+
+static void scale_update(void) {
+    pthread_mutex_lock(&scale_lock);
+    int scale = preferred_scale > 0 && viewport ? preferred_scale
+                                                : scale_from_outputs() * ANIM_SCALE_ONE;
+
+    // Frames the compositor scales are uploaded once, sharp on the densest output
+    if (current_config->enable_compositor_scaling && viewporter && subcompositor) {
+        scale = ANIM_SCALE_ONE;
+        for (size_t i = 0; i < output_count; i++) {
+            if (outputs[i].scale * ANIM_SCALE_ONE > scale) {
+                scale = outputs[i].scale * ANIM_SCALE_ONE;
+            }
+        }
+    }
+    // Still locked, so the animation ends up at the scale recorded last
+    if (scale != surface_scale) {
+        surface_scale = scale;
+        animation_set_scale(scale);
+    }
+    pthread_mutex_unlock(&scale_lock);
+}
+
+// =============================================================================
+// SURFACE LAYOUT MANAGEMENT
+// =============================================================================
+
+typedef struct {
+    int buffer_width;
+    int buffer_height;
+    uint32_t surface_width;   // 0 stretches the surface between left/right anchors
+    uint32_t surface_height;
+    uint32_t anchor;
+    int margin_top;
+    int margin_bottom;
+    int margin_left;
+    int cat_x;                // Cat position inside the buffer
+    int cat_y;
+    int scale;                // Buffer pixels per surface unit, in ANIM_SCALE_ONE
+    int logical_width;        // Surface size, also when stretched
+    int logical_height;
+    anim_rect_t cat_surface;  // Cat in surface coordinates
+} surface_layout_t;
+
+static surface_layout_t layout = {0};
+static int configured_width = 0;  // Width the compositor stretched the surface to
+
+static int layout_to_buffer(int logical, int scale) {
+    return (logical * scale + ANIM_SCALE_ONE / 2) / ANIM_SCALE_ONE;
+}
+
+// Called with anim_lock held. Positions are worked out in surface
+// coordinates, then scaled to the active frame cache's buffer pixels.
+static void layout_calculate_locked(const config_t *config, surface_layout_t *out) {
+    int screen_width = screen_info.screen_width > 0 ? screen_info.screen_width : config->screen_width;
+    int cat_height = config->cat_height;
+    int cat_width = (cat_height * CAT_IMAGE_WIDTH) / CAT_IMAGE_HEIGHT;
+    int scale = ANIM_SCALE_ONE;
+
+    // Loaded frames set the scale, and custom art keeps its aspect ratio
+    if (anim_frame_cache.width > 0) {
+        scale = anim_frame_cache.scale;
+        cat_width = (anim_frame_cache.width * ANIM_SCALE_ONE + scale - 1) / scale;
+    }
+    uint32_t edge = config->overlay_position == POSITION_TOP ? ZWLR_LAYER_SURFACE_V1_ANCHOR_TOP
+                                                             : ZWLR_LAYER_SURFACE_V1_ANCHOR_BOTTOM;
+
+    // Area the cat is positioned in: the whole output or the overlay bar
+    int area_height = config->overlay_height;
+    if (config->overlay_size == OVERLAY_SIZE_SCREEN && screen_info.screen_height > 0) {
+        area_height = screen_info.screen_height;
+    }
+    if (config->overlay_size != OVERLAY_SIZE_CAT && configured_width > 0) {
+        screen_width = configured_width;
+    }
+
+    int cat_x = 0;
+    switch (config->cat_align) {
+        case ALIGN_CENTER:
+            cat_x = (screen_width - cat_width) / 2 + config->cat_x_offset;
+            break;
+        case ALIGN_LEFT:
+            cat_x = config->cat_x_offset;
+            break;
+        case ALIGN_RIGHT:
+            cat_x = screen_width - cat_width - config->cat_x_offset;
+            break;
+    }
+    int cat_y = (area_height - cat_height) / 2 + config->cat_y_offset;
+
+    *out = (surface_layout_t){ .scale = scale };
+    if (config->overlay_size == OVERLAY_SIZE_CAT) {
+        // Surface covers only the cat, placed by margins from the anchored corner
+        out->logical_width = cat_width;
+        out->logical_height = cat_height;
+        out->surface_width = cat_width;
+        out->surface_height = cat_height;
+        out->anchor = edge | ZWLR_LAYER_SURFACE_V1_ANCHOR_LEFT;
+        out->cat_surface = (anim_rect_t){0, 0, cat_width, cat_height};
+        out->margin_left = cat_x;
+        if (edge == ZWLR_LAYER_SURFACE_V1_ANCHOR_TOP) {
+            out->margin_top = cat_y;
+        } else {
+            out->margin_bottom = area_height - cat_y - cat_height;
+        }
+    } else {
+        out->logical_width = screen_width;
+        out->logical_height = area_height;
+        out->surface_width = 0;
+        out->surface_height = area_height;
+        out->anchor = edge | ZWLR_LAYER_SURFACE_V1_ANCHOR_LEFT | ZWLR_LAYER_SURFACE_V1_ANCHOR_RIGHT;
+        out->cat_surface = (anim_rect_t){cat_x, cat_y, cat_width, cat_height};
+        out->cat_x = layout_to_buffer(cat_x, scale);
+        out->cat_y = layout_to_buffer(cat_y, scale);
+    }
+    out->buffer_width = layout_to_buffer(out->logical_width, scale);
+    out->buffer_height = layout_to_buffer(out->logical_height, scale);
+}
+
+static void layout_calculate(const config_t *config, surface_layout_t *out) {
+    pthread_mutex_lock(&anim_lock);
+    layout_calculate_locked(config, out);
+    pthread_mutex_unlock(&anim_lock);
+}
+
+static void layout_apply_to_surface(void) {
+    zwlr_layer_surface_v1_set_anchor(layer_surface, layout.anchor);
+    zwlr_layer_surface_v1_set_size(layer_surface, layout.surface_width, layout.surface_height);
+    zwlr_layer_surface_v1_set_margin(layer_surface, layout.margin_top, 0,
+                                     layout.margin_bottom, layout.margin_left);
+}
+
+// How buffer pixels map onto the surface; takes effect with the next commit
+static void layout_apply_scale(void) {
+    if (viewport) {
+        wp_viewport_set_destination(viewport, layout.logical_width, layout.logical_height);
+    } else {
+        wl_surface_set_buffer_scale(surface, layout.scale / ANIM_SCALE_ONE);
+    }
+}
+
 // =============================================================================
 // BUFFER AND DRAWING MANAGEMENT
 // =============================================================================
 
+#define NUM_BUFFERS 2
+#define MAX_PRERENDERED_FRAMES 8 // Longer animations draw into NUM_BUFFERS instead
+#define MAX_BUFFERS (MAX_PRERENDERED_FRAMES + 1) // Every frame plus the hidden state
+
+// What a buffer currently shows, so only the pixels that change are redrawn
+typedef struct {
+    bool valid;
+    int background_alpha;
+    bool cat_visible;
+    anim_rect_t cat_rect;
+    int frame;
+    unsigned int cache_generation;
+} render_state_t;
+
+typedef struct {
+    struct wl_buffer *wl_buffer;
+    uint8_t *pixels;
+    bool busy;              // Held by the compositor until wl_buffer.release
+    render_state_t state;
+} shm_buffer_t;
+
+static shm_buffer_t buffers[MAX_BUFFERS];
+static int num_buffers = 0;
+static bool pool_prerendered = false;      // Buffers hold fixed, fully rendered states
+static uint8_t *pool_data = NULL;
+static size_t pool_size = 0;
+static shm_buffer_t *last_committed = NULL;
+static render_state_t last_render = {0};   // What the surface currently shows
+static bool frame_skipped = false;         // A draw found every buffer busy
+static struct wl_callback *frame_callback = NULL;
+static bool redraw_pending = false;        // State changed while waiting for frame done
+
 int create_shm(int size) {
     char name[] = "/bar-shm-XXXXXX";
     int fd;
@@ -292,54 +541,819 @@ int create_shm(int size) {
     return fd;
 }
 
+static void buffer_handle_release(void *data, struct wl_buffer *wl_buffer __attribute__((unused))) {
+    shm_buffer_t *buf = data;
+
+    pthread_mutex_lock(&buffer_lock);
+    buf->busy = false;
+    bool redraw = frame_skipped;
+    frame_skipped = false;
+    pthread_mutex_unlock(&buffer_lock);
+
+    // Catch up on a frame that was dropped while all buffers were held
+    if (redraw) {
+        draw_bar();
+    }
+}
+
+static const struct wl_buffer_listener buffer_listener = {
+    .release = buffer_handle_release,
+};
+
+static void frame_handle_done(void *data __attribute__((unused)), struct wl_callback *callback,
+                              uint32_t time __attribute__((unused))) {
+    pthread_mutex_lock(&buffer_lock);
+    wl_callback_destroy(callback);
+    // A callback dropped by frame_throttle_reset_locked() is only destroyed
+    // here; the pending redraw belongs to whatever frame replaced it
+    bool redraw = false;
+    if (frame_callback == callback) {
+        frame_callback = NULL;
+        redraw = redraw_pending;
+        redraw_pending = false;
+    }
+    pthread_mutex_unlock(&buffer_lock);
+
+    // The compositor is ready for a new frame; render what changed meanwhile
+    if (redraw) {
+        draw_bar();
+    }
+}
+
+static const struct wl_callback_listener frame_listener = {
+    .done = frame_handle_done,
+};
+
+// Configures and layout changes cannot wait for frame done, which a hidden
+// surface never gets: forget the outstanding frame so the next draw commits.
+// The proxy is left to frame_handle_done(), which may already be waiting for
+// the lock on the Wayland thread while a reload calls this from the watcher.
+// Called with buffer_lock held.
+static void frame_throttle_reset_locked(void) {
+    frame_callback = NULL;
+    redraw_pending = false;
+}
+
+static void buffer_pool_destroy(void) {
+    for (int i = 0; i < MAX_BUFFERS; i++) {
+        if (buffers[i].wl_buffer) {
+            wl_buffer_destroy(buffers[i].wl_buffer);
+        }
+        buffers[i] = (shm_buffer_t){0};
+    }
+
+    if (pool_data) {
+        munmap(pool_data, pool_size);
+        pool_data = NULL;
+        pool_size = 0;
+    }
+
+    num_buffers = 0;
+    pool_prerendered = false;
+    last_committed = NULL;
+    last_render.valid = false;
+    frame_skipped = false;
+}
+
+// Maps size bytes of shared memory and hands them to the compositor as a pool
+static struct wl_shm_pool *shm_pool_create(size_t size, uint8_t **data) {
+    int fd = create_shm((int)size);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    *data = (uint8_t *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (*data == MAP_FAILED) {
+        bongocat_log_error("Failed to map shared memory: %s", strerror(errno));
+        *data = NULL;
+        close(fd);
+        return NULL;
+    }
+
+    struct wl_shm_pool *pool = wl_shm_create_pool(shm, fd, (int32_t)size);
+    close(fd);
+    if (!pool) {
+        bongocat_log_error("Failed to create shared memory pool");
+        munmap(*data, size);
+        *data = NULL;
+    }
+    return pool;
+}
+
+static bongocat_error_t buffer_pool_create(int count) {
+    int stride = layout.buffer_width * 4;
+    int buffer_size = stride * layout.buffer_height;
+    if (count <= 0 || count > MAX_BUFFERS || buffer_size <= 0 || buffer_size > INT32_MAX / count) {
+        bongocat_log_error("Invalid buffer size: %d x %d", buffer_size, count);
+        return BONGOCAT_ERROR_WAYLAND;
+    }
+    int size = buffer_size * count;
+
+    struct wl_shm_pool *pool = shm_pool_create((size_t)size, &pool_data);
+    if (!pool) {
+        return BONGOCAT_ERROR_WAYLAND;
+    }
+    pool_size = size;
+
+    // Carve all buffers out of the one pool
+    num_buffers = count;
+    for (int i = 0; i < count; i++) {
+        shm_buffer_t *buf = &buffers[i];
+        *buf = (shm_buffer_t){0};
+        buf->wl_buffer = wl_shm_pool_create_buffer(pool, i * buffer_size, layout.buffer_width,
+                                                   layout.buffer_height, stride,
+                                                   WL_SHM_FORMAT_ARGB8888);
+        if (!buf->wl_buffer) {
+            bongocat_log_error("Failed to create buffer %d", i);
+            wl_shm_pool_destroy(pool);
+            buffer_pool_destroy();
+            return BONGOCAT_ERROR_WAYLAND;
+        }
+        wl_buffer_add_listener(buf->wl_buffer, &buffer_listener, buf);
+        buf->pixels = pool_data + (size_t)i * buffer_size;
+    }
+
+    wl_shm_pool_destroy(pool);
+    bongocat_log_debug("Created %d shm buffers of %dx%d", count,
+                       layout.buffer_width, layout.buffer_height);
+    return BONGOCAT_SUCCESS;
+}
+
+static shm_buffer_t *buffer_pool_acquire(void) {
+    // Prefer the buffer just committed: it needs the smallest update
+    if (last_committed && !last_committed->busy) {
+        return last_committed;
+    }
+
+    for (int i = 0; i < num_buffers; i++) {
+        if (buffers[i].wl_buffer && !buffers[i].busy) {
+            return &buffers[i];
+        }
+    }
+    return NULL;
+}
+
+static bool render_state_equal(const render_state_t *a, const render_state_t *b) {
+    return a->valid && b->valid && a->background_alpha == b->background_alpha &&
+           a->cat_visible == b->cat_visible && a->frame == b->frame &&
+           a->cache_generation == b->cache_generation &&
+           memcmp(&a->cat_rect, &b->cat_rect, sizeof(a->cat_rect)) == 0;
+}
+
+// Collects the rectangles that differ between two states.
+// Returns the number of rectangles, or -1 when everything must be redrawn.
+static int render_state_diff(const render_state_t *from, const render_state_t *to, anim_rect_t rects[2]) {
+    if (!from->valid || from->background_alpha != to->background_alpha) {
+        return -1;
+    }
+
+    if (render_state_equal(from, to)) {
+        return 0;
+    }
+
+    int count = 0;
+    if (from->cat_visible != to->cat_visible || from->cache_generation != to->cache_generation ||
+        memcmp(&from->cat_rect, &to->cat_rect, sizeof(to->cat_rect)) != 0) {
+        if (from->cat_visible) {
+            rects[count++] = from->cat_rect;
+        }
+        if (to->cat_visible) {
+            rects[count++] = to->cat_rect;
+        }
+    } else if (to->cat_visible) {
+        // Only the frame changed: just the pixels that differ between the two frames
+        anim_rect_t diff = anim_frame_cache_diff(from->frame, to->frame);
+        diff.x += to->cat_rect.x;
+        diff.y += to->cat_rect.y;
+        rects[count++] = diff;
+    }
+    return count;
+}
+
+static void draw_repaint_rect(uint8_t *dest, const render_state_t *state, const anim_rect_t *rect) {
+    // Cached frames only hold the cat's own pixels, composited over the background
+    draw_rect(dest, layout.buffer_width, layout.buffer_height, rect->x, rect->y,
+              rect->width, rect->height, 0, 0, 0, state->background_alpha);
+
+    if (state->cat_visible) {
+        const anim_rect_t *cat = &state->cat_rect;
+        anim_rect_t region = {rect->x - cat->x, rect->y - cat->y, rect->width, rect->height};
+        blit_cached_frame_region(dest, layout.buffer_width, layout.buffer_height,
+                                 state->frame, cat->x, cat->y, &region);
+    }
+}
+
+static void draw_damage_rect(const anim_rect_t *rect) {
+    int x0 = rect->x, y0 = rect->y;
+    int x1 = x0 + rect->width, y1 = y0 + rect->height;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > layout.buffer_width) x1 = layout.buffer_width;
+    if (y1 > layout.buffer_height) y1 = layout.buffer_height;
+    if (x0 < x1 && y0 < y1) {
+        wl_surface_damage_buffer(surface, x0, y0, x1 - x0, y1 - y0);
+    }
+}
+
+static shm_buffer_t *buffer_pool_find_prerendered(const render_state_t *state) {
+    for (int i = 0; i < num_buffers; i++) {
+        if (render_state_equal(&buffers[i].state, state)) {
+            return &buffers[i];
+        }
+    }
+    return NULL;
+}
+
+// Renders every state the overlay can show into its own buffer, so switching
+// frames at runtime is only an attach. Called with anim_lock held.
+static shm_buffer_t *buffer_pool_prerender(const render_state_t *state) {
+    buffer_pool_destroy();
+    if (buffer_pool_create(anim_frame_cache.num_frames + 1) != BONGOCAT_SUCCESS) {
+        return NULL;
+    }
+    pool_prerendered = true;
+
+    anim_rect_t full = {0, 0, layout.buffer_width, layout.buffer_height};
+    for (int i = 0; i < num_buffers; i++) {
+        render_state_t *target = &buffers[i].state;
+        *target = *state;
+        if (i < anim_frame_cache.num_frames) {
+            target->background_alpha = current_config->overlay_opacity;
+            target->cat_visible = anim_frame_cache.width > 0;
+            target->frame = i;
+        } else {
+            target->background_alpha = 0;
+            target->cat_visible = false;
+            target->frame = 0;
+        }
+        draw_repaint_rect(buffers[i].pixels, target, &full);
+    }
+
+    bongocat_log_debug("Pre-rendered %d overlay states", num_buffers);
+    return buffer_pool_find_prerendered(state);
+}
+
+// =============================================================================
+// INPUT LATENCY
+// =============================================================================
+
+// Time from a key press to the commit that shows it and, with wp_presentation,
+// to the moment it reached the screen. Guarded by buffer_lock.
+#define MAX_PENDING_FEEDBACK 8
+#define LATENCY_REPORT_INTERVAL 256  // Debug summaries every this many commits
+
+typedef struct {
+    struct wp_presentation_feedback *feedback;
+    long input_time_us;
+} latency_feedback_t;
+
+static struct wp_presentation *presentation = NULL;
+static uint32_t presentation_clock = UINT32_MAX;  // Set by wp_presentation.clock_id
+static latency_feedback_t pending_feedback[MAX_PENDING_FEEDBACK];
+static latency_histogram_t commit_latency;
+static latency_histogram_t present_latency;
+
+static long latency_now_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000L + now.tv_nsec / 1000;
+}
+
+static void presentation_handle_clock_id(void *data __attribute__((unused)),
+                                         struct wp_presentation *wp_presentation __attribute__((unused)),
+                                         uint32_t clk_id) {
+    presentation_clock = clk_id;
+}
+
+static const struct wp_presentation_listener presentation_listener = {
+    .clock_id = presentation_handle_clock_id,
+};
+
+static void latency_feedback_release(latency_feedback_t *slot) {
+    wp_presentation_feedback_destroy(slot->feedback);
+    slot->feedback = NULL;
+}
+
+static void feedback_handle_sync_output(void *data __attribute__((unused)),
+                                        struct wp_presentation_feedback *feedback __attribute__((unused)),
+                                        struct wl_output *wl_output __attribute__((unused))) {}
+
+static void feedback_handle_presented(void *data,
+                                      struct wp_presentation_feedback *feedback __attribute__((unused)),
+                                      uint32_t tv_sec_hi, uint32_t tv_sec_lo, uint32_t tv_nsec,
+                                      uint32_t refresh __attribute__((unused)),
+                                      uint32_t seq_hi __attribute__((unused)),
+                                      uint32_t seq_lo __attribute__((unused)),
+                                      uint32_t flags __attribute__((unused))) {
+    latency_feedback_t *slot = data;
+    const long presented_us = (long)(((uint64_t)tv_sec_hi << 32 | tv_sec_lo) * 1000000u + tv_nsec / 1000);
+
+    pthread_mutex_lock(&buffer_lock);
+    // Input timestamps are monotonic; other presentation clocks cannot be compared
+    if (presentation_clock == CLOCK_MONOTONIC) {
+        latency_record(&present_latency, presented_us - slot->input_time_us);
+    }
+    latency_feedback_release(slot);
+    pthread_mutex_unlock(&buffer_lock);
+}
+
+static void feedback_handle_discarded(void *data,
+                                      struct wp_presentation_feedback *feedback __attribute__((unused))) {
+    pthread_mutex_lock(&buffer_lock);
+    latency_feedback_release(data);
+    pthread_mutex_unlock(&buffer_lock);
+}
+
+static const struct wp_presentation_feedback_listener feedback_listener = {
+    .sync_output = feedback_handle_sync_output,
+    .presented = feedback_handle_presented,
+    .discarded = feedback_handle_discarded,
+};
+
+// Called with both locks held; takes the press the next commit shows, if any
+static long latency_take_input_locked(void) {
+    const long input_time_us = anim_input_time_us;
+    anim_input_time_us = 0;
+    return input_time_us;
+}
+
+// Called with buffer_lock held right before committing target with a press on it
+static void latency_track_commit(struct wl_surface *target, long input_time_us) {
+    if (input_time_us <= 0) {
+        return;
+    }
+
+    latency_record(&commit_latency, latency_now_us() - input_time_us);
+    if (current_config->enable_debug && commit_latency.total % LATENCY_REPORT_INTERVAL == 0) {
+        latency_log_summary(&commit_latency, "commit");
+        latency_log_summary(&present_latency, "presentation");
+    }
+
+    if (!presentation) {
+        return;
+    }
+    for (int i = 0; i < MAX_PENDING_FEEDBACK; i++) {
+        latency_feedback_t *slot = &pending_feedback[i];
+        if (slot->feedback) {
+            continue;
+        }
+        slot->feedback = wp_presentation_feedback(presentation, target);
+        if (slot->feedback) {
+            slot->input_time_us = input_time_us;
+            wp_presentation_feedback_add_listener(slot->feedback, &feedback_listener, slot);
+        }
+        return;
+    }
+}
+
+static void latency_cleanup(void) {
+    latency_log_summary(&commit_latency, "commit");
+    latency_log_summary(&present_latency, "presentation");
+    latency_reset(&commit_latency);
+    latency_reset(&present_latency);
+
+    for (int i = 0; i < MAX_PENDING_FEEDBACK; i++) {
+        if (pending_feedback[i].feedback) {
+            latency_feedback_release(&pending_feedback[i]);
+        }
+    }
+    if (presentation) {
+        wp_presentation_destroy(presentation);
+        presentation = NULL;
+    }
+    presentation_clock = UINT32_MAX;
+}
+
+// =============================================================================
+// COMPOSITOR SCALING
+// =============================================================================
+
+// With enable_compositor_scaling the compositor does the scaling: the main
+// surface carries a single background pixel that its viewport stretches over
+// the bar, and the cat sits on a subsurface with a viewport of its own. Each
+// frame is uploaded once into its own buffer, so changing frames is an attach
+// and commit of the small surface and nothing is redrawn.
+typedef struct {
+    bool valid;
+    int background_alpha;
+    bool cat_visible;
+    int frame;
+    unsigned int cache_generation;
+    anim_rect_t cat_rect;              // Surface coordinates
+} scaled_state_t;
+
+static struct wl_surface *cat_surface = NULL;
+static struct wl_subsurface *cat_subsurface = NULL;
+static struct wp_viewport *cat_viewport = NULL;
+
+static struct wl_buffer *background_buffers[2];   // Transparent, then overlay_opacity
+static uint8_t *background_data = NULL;
+static int background_opacity = -1;               // What background_buffers[1] holds
+
+static struct wl_buffer *frame_buffers[MAX_FRAMES];
+static bool frame_uploaded[MAX_FRAMES];
+static uint8_t *frame_pool_data = NULL;
+static size_t frame_pool_size = 0;
+static int frame_pool_frames = 0;
+static unsigned int frame_pool_generation = 0;
+
+static scaled_state_t scaled_shown = {0};         // What the surfaces currently show
+static bool scaled_failed = false;                // Set up failed, retried on config reload
+
+static void scaled_frames_destroy(void) {
+    for (int i = 0; i < frame_pool_frames; i++) {
+        if (frame_buffers[i]) {
+            wl_buffer_destroy(frame_buffers[i]);
+        }
+        frame_buffers[i] = NULL;
+        frame_uploaded[i] = false;
+    }
+    if (frame_pool_data) {
+        munmap(frame_pool_data, frame_pool_size);
+    }
+    frame_pool_data = NULL;
+    frame_pool_size = 0;
+    frame_pool_frames = 0;
+}
+
+static void scaled_background_destroy(void) {
+    for (int i = 0; i < 2; i++) {
+        if (background_buffers[i]) {
+            wl_buffer_destroy(background_buffers[i]);
+            background_buffers[i] = NULL;
+        }
+    }
+    if (background_data) {
+        munmap(background_data, 2 * sizeof(uint32_t));
+        background_data = NULL;
+    }
+    background_opacity = -1;
+}
+
+// Back to drawing everything into the main surface's buffers
+static void scaled_destroy(void) {
+    scaled_frames_destroy();
+    scaled_background_destroy();
+    if (cat_viewport) {
+        wp_viewport_destroy(cat_viewport);
+        cat_viewport = NULL;
+    }
+    if (cat_subsurface) {
+        wl_subsurface_destroy(cat_subsurface);
+        cat_subsurface = NULL;
+    }
+    if (cat_surface) {
+        wl_surface_destroy(cat_surface);
+        cat_surface = NULL;
+    }
+    scaled_shown.valid = false;
+}
+
+static bool scaled_available(void) {
+    return current_config->enable_compositor_scaling && viewport && subcompositor;
+}
+
+// Called with anim_lock held. Streamed frames come and go, so those are
+// drawn on the CPU within the GIF's memory budget instead.
+static bool scaled_usable(void) {
+    return scaled_available() && !scaled_failed && !anim_frame_cache.stream &&
+           anim_frame_cache.width > 0;
+}
+
+static bool scaled_create_surface(void) {
+    if (cat_surface) {
+        return true;
+    }
+
+    cat_surface = wl_compositor_create_surface(compositor);
+    if (!cat_surface) {
+        return false;
+    }
+    cat_subsurface = wl_subcompositor_get_subsurface(subcompositor, cat_surface, surface);
+    cat_viewport = wp_viewporter_get_viewport(viewporter, cat_surface);
+    if (!cat_subsurface || !cat_viewport) {
+        scaled_destroy();
+        return false;
+    }
+
+    // Frame changes are shown without waiting for a commit of the bar
+    wl_subsurface_set_desync(cat_subsurface);
+
+    struct wl_region *input_region = wl_compositor_create_region(compositor);
+    if (input_region) {
+        wl_surface_set_input_region(cat_surface, input_region);
+        wl_region_destroy(input_region);
+    }
+    return true;
+}
+
+static bool scaled_create_background(int opacity) {
+    if (background_opacity == opacity) {
+        return true;
+    }
+    scaled_background_destroy();
+
+    struct wl_shm_pool *pool = shm_pool_create(2 * sizeof(uint32_t), &background_data);
+    if (!pool) {
+        return false;
+    }
+
+    // Premultiplied black, the same colour draw_rect fills the bar with
+    uint32_t *pixels = (uint32_t *)background_data;
+    pixels[0] = 0;
+    pixels[1] = (uint32_t)opacity << 24;
+    for (int i = 0; i < 2; i++) {
+        background_buffers[i] = wl_shm_pool_create_buffer(pool, i * (int32_t)sizeof(uint32_t),
+                                                          1, 1, 4, WL_SHM_FORMAT_ARGB8888);
+    }
+    wl_shm_pool_destroy(pool);
+
+    if (!background_buffers[0] || !background_buffers[1]) {
+        scaled_background_destroy();
+        return false;
+    }
+    background_opacity = opacity;
+    return true;
+}
+
+// One buffer per cached frame, filled the first time the frame is shown.
+// Called with anim_lock held.
+static bool scaled_create_frames(void) {
+    if (frame_pool_data && frame_pool_generation == anim_frame_cache.generation) {
+        return true;
+    }
+    scaled_frames_destroy();
+
+    const int stride = anim_frame_cache.width * 4;
+    const size_t frame_size = (size_t)stride * anim_frame_cache.height;
+    const size_t size = frame_size * (size_t)anim_frame_cache.num_frames;
+    if (anim_frame_cache.num_frames > MAX_FRAMES || size == 0 || size > INT32_MAX) {
+        return false;
+    }
+
+    struct wl_shm_pool *pool = shm_pool_create(size, &frame_pool_data);
+    if (!pool) {
+        return false;
+    }
+    frame_pool_size = size;
+    frame_pool_frames = anim_frame_cache.num_frames;
+    frame_pool_generation = anim_frame_cache.generation;
+
+    bool created = true;
+    for (int i = 0; i < frame_pool_frames; i++) {
+        frame_buffers[i] = wl_shm_pool_create_buffer(pool, (int32_t)(frame_size * (size_t)i),
+                                                     anim_frame_cache.width,
+                                                     anim_frame_cache.height, stride,
+                                                     WL_SHM_FORMAT_ARGB8888);
+        created = created && frame_buffers[i];
+    }
+    wl_shm_pool_destroy(pool);
+
+    if (!created) {
+        scaled_frames_destroy();
+        return false;
+    }
+    bongocat_log_debug("Created %d cat buffers of %dx%d for compositor scaling", frame_pool_frames,
+                       anim_frame_cache.width, anim_frame_cache.height);
+    return true;
+}
+
+// Fresh shared memory is zeroed, so the frame only needs compositing onto it
+static struct wl_buffer *scaled_upload_frame(int frame) {
+    if (!frame_uploaded[frame]) {
+        const size_t frame_size = (size_t)anim_frame_cache.width * anim_frame_cache.height * 4;
+        blit_cached_frame(frame_pool_data + frame_size * (size_t)frame, anim_frame_cache.width,
+                          anim_frame_cache.height, frame, 0, 0);
+        frame_uploaded[frame] = true;
+    }
+    return frame_buffers[frame];
+}
+
+// Called with both locks held. Returns false when the compositor path cannot
+// be set up, leaving drawing to the CPU path.
+static bool draw_scaled(long input_time_us) {
+    if (!scaled_create_surface() || !scaled_create_background(current_config->overlay_opacity) ||
+        !scaled_create_frames()) {
+        bongocat_log_warning("Compositor scaling unavailable, drawing on the CPU");
+        scaled_destroy();
+        scaled_failed = true;
+        return false;
+    }
+
+    // The bar's own buffers are no longer needed
+    if (num_buffers > 0) {
+        buffer_pool_destroy();
+    }
+
+    scaled_state_t next = {
+        .valid = true,
+        .background_alpha = fullscreen_detected ? 0 : current_config->overlay_opacity,
+        .cat_visible = !fullscreen_detected,
+        .frame = fullscreen_detected ? 0 : anim_index,
+        .cache_generation = anim_frame_cache.generation,
+        .cat_rect = layout.cat_surface,
+    };
+    if (scaled_shown.valid && memcmp(&scaled_shown, &next, sizeof(next)) == 0) {
+        return true;
+    }
+
+    bool commit_bar = !scaled_shown.valid || scaled_shown.background_alpha != next.background_alpha;
+    bool commit_cat = !scaled_shown.valid || scaled_shown.cat_visible != next.cat_visible ||
+                      scaled_shown.frame != next.frame ||
+                      scaled_shown.cache_generation != next.cache_generation;
+
+    if (commit_bar) {
+        wl_surface_attach(surface, background_buffers[next.background_alpha > 0], 0, 0);
+        wl_surface_damage_buffer(surface, 0, 0, 1, 1);
+    }
+
+    // The position belongs to the bar's state, the size to the cat's
+    const anim_rect_t *cat = &next.cat_rect;
+    if (!scaled_shown.valid || cat->x != scaled_shown.cat_rect.x ||
+        cat->y != scaled_shown.cat_rect.y) {
+        wl_subsurface_set_position(cat_subsurface, cat->x, cat->y);
+        commit_bar = true;
+    }
+    if (!scaled_shown.valid || cat->width != scaled_shown.cat_rect.width ||
+        cat->height != scaled_shown.cat_rect.height) {
+        wp_viewport_set_destination(cat_viewport, cat->width, cat->height);
+        commit_cat = true;
+    }
+
+    if (commit_cat) {
+        if (next.cat_visible) {
+            wl_surface_attach(cat_surface, scaled_upload_frame(next.frame), 0, 0);
+            wl_surface_damage_buffer(cat_surface, 0, 0, anim_frame_cache.width,
+                                     anim_frame_cache.height);
+        } else {
+            wl_surface_attach(cat_surface, NULL, 0, 0);
+        }
+    }
+
+    // Throttle on whichever surface changed; frame changes only touch the cat.
+    // A hidden cat has no buffer and never gets frame done, so the bar is
+    // committed and throttled on instead.
+    const bool throttle_cat = commit_cat && next.cat_visible;
+    if (!throttle_cat) {
+        commit_bar = true;
+    }
+    frame_callback = wl_surface_frame(throttle_cat ? cat_surface : surface);
+    if (frame_callback) {
+        wl_callback_add_listener(frame_callback, &frame_listener, NULL);
+    }
+    if (commit_cat) {
+        latency_track_commit(cat_surface, next.cat_visible ? input_time_us : 0);
+        wl_surface_commit(cat_surface);
+    }
+    if (commit_bar) {
+        wl_surface_commit(surface);
+    }
+
+    scaled_shown = next;
+    last_render.valid = false;  // The bar's buffers need a full redraw if used again
+    wl_display_flush(display);
+    return true;
+}
+
+// Called with both locks held once the frames changed scale or the surface
+// was resized; the new buffers are attached with the next commit
+static void layout_update_locked(void) {
+    layout_calculate_locked(current_config, &layout);
+    buffer_pool_destroy();
+    layout_apply_to_surface();
+    layout_apply_scale();
+    scaled_shown.valid = false;
+    bongocat_log_debug("Rendering %dx%d buffers at scale %d/%d", layout.buffer_width,
+                       layout.buffer_height, layout.scale, ANIM_SCALE_ONE);
+}
+
 void draw_bar(void) {
     if (!configured) {
         bongocat_log_debug("Surface not configured yet, skipping draw");
         return;
     }
 
-    int effective_opacity = fullscreen_detected ? 0 : current_config->overlay_opacity;
-    
-    // Clear buffer with transparency
-    for (int i = 0; i < current_config->screen_width * current_config->bar_height * 4; i += 4) {
-        pixels[i] = 0;       // B
-        pixels[i + 1] = 0;   // G
-        pixels[i + 2] = 0;   // R
-        pixels[i + 3] = effective_opacity; // A
-    }
-
-    // Draw cat if visible
-    if (!fullscreen_detected) {
-        pthread_mutex_lock(&anim_lock);
-        int cat_height = current_config->cat_height;
-        int cat_width = (cat_height * CAT_IMAGE_WIDTH) / CAT_IMAGE_HEIGHT;
-        int cat_y = (current_config->bar_height - cat_height) / 2 + current_config->cat_y_offset;
-
-        int cat_x = 0;
-        switch (current_config->cat_align) {
-            case ALIGN_CENTER:
-                cat_x = (current_config->screen_width - cat_width) / 2 + current_config->cat_x_offset;
-                break;
-            case ALIGN_LEFT:
-                cat_x = current_config->cat_x_offset;
-                break;
-            case ALIGN_RIGHT:
-                cat_x = current_config->screen_width - cat_width - current_config->cat_x_offset;
-                break;
-        }
+    pthread_mutex_lock(&buffer_lock);
+    if (frame_callback) {
+        // Previous frame not shown yet (or surface hidden): render on frame done
+        redraw_pending = true;
+        pthread_mutex_unlock(&buffer_lock);
+        return;
+    }
+
+    pthread_mutex_lock(&anim_lock);
+    const long input_time_us = latency_take_input_locked();
+
+    const int scale = anim_frame_cache.width > 0 ? anim_frame_cache.scale : ANIM_SCALE_ONE;
+    if (scale != layout.scale) {
+        layout_update_locked();
+    }
+
+    if (scaled_usable() && draw_scaled(input_time_us)) {
+        pthread_mutex_unlock(&anim_lock);
+        pthread_mutex_unlock(&buffer_lock);
+        return;
+    }
+    if (cat_surface) {
+        // Scaling went back to the CPU: drop the cat's surface and redraw the bar
+        scaled_destroy();
+        last_render.valid = false;
+    }
+
+    render_state_t next = {
+        .valid = true,
+        .background_alpha = fullscreen_detected ? 0 : current_config->overlay_opacity,
+        .cat_visible = !fullscreen_detected && anim_frame_cache.width > 0,
+        .cat_rect = {layout.cat_x, layout.cat_y, anim_frame_cache.width, anim_frame_cache.height},
+        .frame = anim_index,
+        .cache_generation = anim_frame_cache.generation,
+    };
+    if (!next.cat_visible) {
+        next.frame = 0; // The frame is irrelevant while the cat is hidden
+    }
 
-        blit_image_scaled(pixels, current_config->screen_width, current_config->bar_height,
-                          anim_imgs[anim_index], anim_width[anim_index], anim_height[anim_index],
-                          cat_x, cat_y, cat_width, cat_height);
+    if (render_state_equal(&last_render, &next)) {
+        // Nothing changed, skip the commit entirely
         pthread_mutex_unlock(&anim_lock);
+        pthread_mutex_unlock(&buffer_lock);
+        return;
+    }
+
+    anim_rect_t rects[2];
+    anim_rect_t full = {0, 0, layout.buffer_width, layout.buffer_height};
+    shm_buffer_t *buf = NULL;
+
+    if (current_config->enable_prerender && !anim_frame_cache.stream &&
+        anim_frame_cache.num_frames <= MAX_PRERENDERED_FRAMES) {
+        // Pre-rendered states are never written again; rebuild them only when
+        // the configuration, cache or layout no longer match
+        buf = pool_prerendered ? buffer_pool_find_prerendered(&next) : NULL;
+        if (!buf) {
+            buf = buffer_pool_prerender(&next);
+        }
+        if (!buf) {
+            pthread_mutex_unlock(&anim_lock);
+            pthread_mutex_unlock(&buffer_lock);
+            return;
+        }
     } else {
-        bongocat_log_debug("Cat hidden due to fullscreen detection");
+        if (pool_prerendered || num_buffers != NUM_BUFFERS) {
+            buffer_pool_destroy();
+            if (buffer_pool_create(NUM_BUFFERS) != BONGOCAT_SUCCESS) {
+                // No buffer means no release to redraw on; the next draw retries
+                bongocat_log_error("Failed to create overlay buffers, skipping frame");
+                pthread_mutex_unlock(&anim_lock);
+                pthread_mutex_unlock(&buffer_lock);
+                return;
+            }
+        }
+
+        buf = buffer_pool_acquire();
+        if (!buf) {
+            // Compositor holds every buffer: drop this frame, redraw on release
+            frame_skipped = true;
+            anim_input_time_us = input_time_us;
+            pthread_mutex_unlock(&anim_lock);
+            pthread_mutex_unlock(&buffer_lock);
+            return;
+        }
+
+        // Bring the buffer from whatever it showed last up to date
+        int count = render_state_diff(&buf->state, &next, rects);
+        if (count < 0) {
+            draw_repaint_rect(buf->pixels, &next, &full);
+        }
+        for (int i = 0; i < count; i++) {
+            draw_repaint_rect(buf->pixels, &next, &rects[i]);
+        }
     }
 
-    wl_surface_attach(surface, buffer, 0, 0);
-    wl_surface_damage_buffer(surface, 0, 0, current_config->screen_width, current_config->bar_height);
+    // Damage is relative to what the surface showed, not to this buffer
+    int count = render_state_diff(&last_render, &next, rects);
+    pthread_mutex_unlock(&anim_lock);
+
+    if (count < 0) {
+        draw_damage_rect(&full);
+    }
+    for (int i = 0; i < count; i++) {
+        draw_damage_rect(&rects[i]);
+    }
+
+    buf->state = next;
+    buf->busy = true;
+    last_committed = buf;
+    last_render = next;
+
+    frame_callback = wl_surface_frame(surface);
+    if (frame_callback) {
+        wl_callback_add_listener(frame_callback, &frame_listener, NULL);
+    }
+
+    wl_surface_attach(surface, buf->wl_buffer, 0, 0);
+    latency_track_commit(surface, next.cat_visible ? input_time_us : 0);
     wl_surface_commit(surface);
     wl_display_flush(display);
+    pthread_mutex_unlock(&buffer_lock);
 }
 
 // =============================================================================
@@ -352,6 +1366,25 @@ static void layer_surface_configure(void *data __attribute__((unused)),
     bongocat_log_debug("Layer surface configured: %dx%d", w, h);
     zwlr_layer_surface_v1_ack_configure(ls, serial);
     configured = true;
+
+    // Assets load while Wayland connects; the first frame needs them
+    if (animation_wait_ready() != BONGOCAT_SUCCESS) {
+        bongocat_log_warning("Drawing without the cat, assets failed to load");
+    }
+
+    // Always commit in response to a configure
+    pthread_mutex_lock(&buffer_lock);
+    frame_throttle_reset_locked();
+    last_render.valid = false;
+    scaled_shown.valid = false;
+    if (w > 0 && (int)w != configured_width) {
+        // A stretched surface is laid out across what the compositor gave it
+        configured_width = (int)w;
+        if (configured_width != layout.logical_width) {
+            layout.scale = 0;
+        }
+    }
+    pthread_mutex_unlock(&buffer_lock);
     draw_bar();
 }
 
@@ -404,10 +1437,16 @@ static void output_done(void *data __attribute__((unused)),
     bongocat_log_debug("Output configuration complete");
 }
 
-static void output_scale(void *data __attribute__((unused)),
-                        struct wl_output *wl_output __attribute__((unused)),
-                        int32_t factor __attribute__((unused))) {
-    // Scale not needed for our use case
+static void output_scale(void *data, struct wl_output *wl_output __attribute__((unused)),
+                         int32_t factor) {
+    output_ref_t *oref = data;
+    pthread_mutex_lock(&scale_lock);
+    oref->scale = factor;
+    pthread_mutex_unlock(&scale_lock);
+    bongocat_log_debug("Output scale: %d", factor);
+    if (surface) {
+        scale_update();
+    }
 }
 
 static struct wl_output_listener output_listener = {
@@ -417,6 +1456,48 @@ static struct wl_output_listener output_listener = {
     .scale = output_scale,
 };
 
+static void surface_set_output(struct wl_output *wl_output, bool entered) {
+    pthread_mutex_lock(&scale_lock);
+    const output_ref_t *oref = output_find(wl_output);
+    if (oref) {
+        surface_on_output[oref - outputs] = entered;
+    }
+    pthread_mutex_unlock(&scale_lock);
+    if (oref) {
+        scale_update();
+    }
+}
+
+static void surface_enter(void *data __attribute__((unused)),
+                          struct wl_surface *wl_surface __attribute__((unused)),
+                          struct wl_output *wl_output) {
+    surface_set_output(wl_output, true);
+}
+
+static void surface_leave(void *data __attribute__((unused)),
+                          struct wl_surface *wl_surface __attribute__((unused)),
+                          struct wl_output *wl_output) {
+    surface_set_output(wl_output, false);
+}
+
+static const struct wl_surface_listener surface_listener = {
+    .enter = surface_enter,
+    .leave = surface_leave,
+};
+
+static void fractional_scale_preferred(void *data __attribute__((unused)),
+                                       struct wp_fractional_scale_v1 *scale __attribute__((unused)),
+                                       uint32_t value) {
+    pthread_mutex_lock(&scale_lock);
+    preferred_scale = (int)value;
+    pthread_mutex_unlock(&scale_lock);
+    scale_update();
+}
+
+static const struct wp_fractional_scale_v1_listener fractional_scale_listener = {
+    .preferred_scale = fractional_scale_preferred,
+};
+
 // =============================================================================
 // WAYLAND PROTOCOL REGISTRY
 // =============================================================================
@@ -437,12 +1518,28 @@ static void registry_global(void *data __attribute__((unused)), struct wl_regist
     } else if (strcmp(iface, zxdg_output_manager_v1_interface.name) == 0) {
         xdg_output_manager = wl_registry_bind(reg, name, &zxdg_output_manager_v1_interface, 3);
     } else if (strcmp(iface, wl_output_interface.name) == 0) {
+        pthread_mutex_lock(&scale_lock);
         if (output_count < MAX_OUTPUTS) {
             outputs[output_count].name = name;
+            outputs[output_count].scale = 1;
             outputs[output_count].wl_output = wl_registry_bind(reg, name, &wl_output_interface, 2);
-            wl_output_add_listener(outputs[output_count].wl_output, &output_listener, NULL);
+            wl_output_add_listener(outputs[output_count].wl_output, &output_listener,
+                                   &outputs[output_count]);
             output_count++;
         }
+        pthread_mutex_unlock(&scale_lock);
+    } else if (strcmp(iface, wl_subcompositor_interface.name) == 0) {
+        subcompositor = wl_registry_bind(reg, name, &wl_subcompositor_interface, 1);
+    } else if (strcmp(iface, wp_viewporter_interface.name) == 0) {
+        viewporter = wl_registry_bind(reg, name, &wp_viewporter_interface, 1);
+    } else if (strcmp(iface, wp_fractional_scale_manager_v1_interface.name) == 0) {
+        fractional_scale_manager = wl_registry_bind(reg, name,
+                                                    &wp_fractional_scale_manager_v1_interface, 1);
+    } else if (strcmp(iface, wp_presentation_interface.name) == 0) {
+        presentation = wl_registry_bind(reg, name, &wp_presentation_interface, 1);
+        if (presentation) {
+            wp_presentation_add_listener(presentation, &presentation_listener, NULL);
+        }
     } else if (strcmp(iface, zwlr_foreign_toplevel_manager_v1_interface.name) == 0) {
         fs_detector.manager = (struct zwlr_foreign_toplevel_manager_v1 *)
             wl_registry_bind(reg, name, &zwlr_foreign_toplevel_manager_v1_interface, 3);
@@ -518,6 +1615,7 @@ static bongocat_error_t wayland_setup_protocols(void) {
     // Configure screen dimensions
     if (output) {
         wl_display_roundtrip(display);
+        screen_apply_logical_size();
         if (screen_info.screen_width > 0) {
             bongocat_log_info("Detected screen width: %d", screen_info.screen_width);
             current_config->screen_width = screen_info.screen_width;
@@ -526,7 +1624,7 @@ static bongocat_error_t wayland_setup_protocols(void) {
             current_config->screen_width = DEFAULT_SCREEN_WIDTH;
         }
 
-        if (screen_info.screen_height > 0) {
+        if (screen_info.screen_height > 0 && current_config->overlay_size == OVERLAY_SIZE_SCREEN) {
             current_config->bar_height = screen_info.screen_height;
             bongocat_log_info("Detected screen height: %d (expanding bar_height)", screen_info.screen_height);
         }
@@ -545,6 +1643,19 @@ static bongocat_error_t wayland_setup_surface(void) {
         bongocat_log_error("Failed to create surface");
         return BONGOCAT_ERROR_WAYLAND;
     }
+    wl_surface_add_listener(surface, &surface_listener, NULL);
+
+    // Fractional scales are only usable when the viewport can map them back
+    if (viewporter) {
+        viewport = wp_viewporter_get_viewport(viewporter, surface);
+    }
+    if (viewport && fractional_scale_manager) {
+        fractional_scale = wp_fractional_scale_manager_v1_get_fractional_scale(
+            fractional_scale_manager, surface);
+        if (fractional_scale) {
+            wp_fractional_scale_v1_add_listener(fractional_scale, &fractional_scale_listener, NULL);
+        }
+    }
 
     layer_surface = zwlr_layer_shell_v1_get_layer_surface(layer_shell, surface, output,
                                                       ZWLR_LAYER_SHELL_V1_LAYER_OVERLAY,
@@ -556,15 +1667,8 @@ static bongocat_error_t wayland_setup_surface(void) {
     }
 
     // Configure layer surface
-    uint32_t anchor = ZWLR_LAYER_SURFACE_V1_ANCHOR_LEFT | ZWLR_LAYER_SURFACE_V1_ANCHOR_RIGHT;
-    if (current_config->overlay_position == POSITION_TOP) {
-        anchor |= ZWLR_LAYER_SURFACE_V1_ANCHOR_TOP;
-    } else {
-        anchor |= ZWLR_LAYER_SURFACE_V1_ANCHOR_BOTTOM;
-    }
-    
-    zwlr_layer_surface_v1_set_anchor(layer_surface, anchor);
-    zwlr_layer_surface_v1_set_size(layer_surface, 0, current_config->bar_height);
+    layout_apply_to_surface();
+    layout_apply_scale();
     zwlr_layer_surface_v1_set_exclusive_zone(layer_surface, -1);
     zwlr_layer_surface_v1_set_keyboard_interactivity(layer_surface,
                                                      ZWLR_LAYER_SURFACE_V1_KEYBOARD_INTERACTIVITY_NONE);
@@ -581,52 +1685,6 @@ static bongocat_error_t wayland_setup_surface(void) {
     return BONGOCAT_SUCCESS;
 }
 
-static bongocat_error_t wayland_setup_buffer(void) {
-    int size = current_config->screen_width * current_config->bar_height * 4;
-    if (size <= 0) {
-        bongocat_log_error("Invalid buffer size: %d", size);
-        return BONGOCAT_ERROR_WAYLAND;
-    }
-
-    int fd = create_shm(size);
-    if (fd < 0) {
-        return BONGOCAT_ERROR_WAYLAND;
-    }
-
-    pixels = (uint8_t *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-    if (pixels == MAP_FAILED) {
-        bongocat_log_error("Failed to map shared memory: %s", strerror(errno));
-        close(fd);
-        return BONGOCAT_ERROR_MEMORY;
-    }
-
-    struct wl_shm_pool *pool = wl_shm_create_pool(shm, fd, size);
-    if (!pool) {
-        bongocat_log_error("Failed to create shared memory pool");
-        munmap(pixels, size);
-        pixels = NULL;
-        close(fd);
-        return BONGOCAT_ERROR_WAYLAND;
-    }
-
-    buffer = wl_shm_pool_create_buffer(pool, 0, current_config->screen_width, 
-                                      current_config->bar_height,
-                                      current_config->screen_width * 4, 
-                                      WL_SHM_FORMAT_ARGB8888);
-    if (!buffer) {
-        bongocat_log_error("Failed to create buffer");
-        wl_shm_pool_destroy(pool);
-        munmap(pixels, size);
-        pixels = NULL;
-        close(fd);
-        return BONGOCAT_ERROR_WAYLAND;
-    }
-
-    wl_shm_pool_destroy(pool);
-    close(fd);
-    return BONGOCAT_SUCCESS;
-}
-
 bongocat_error_t wayland_init(config_t *config) {
     BONGOCAT_CHECK_NULL(config, BONGOCAT_ERROR_INVALID_PARAM);
 
@@ -639,16 +1697,22 @@ bongocat_error_t wayland_init(config_t *config) {
         return BONGOCAT_ERROR_WAYLAND;
     }
 
-    bongocat_error_t result;
-    if ((result = wayland_setup_protocols()) != BONGOCAT_SUCCESS ||
+    bongocat_error_t result = wayland_setup_protocols();
+    if (result == BONGOCAT_SUCCESS) {
+        // Frames for the output's scale start building while the surface is set up
+        scale_update();
+        layout_calculate(current_config, &layout);
+    }
+
+    if (result != BONGOCAT_SUCCESS ||
         (result = wayland_setup_surface()) != BONGOCAT_SUCCESS ||
-        (result = wayland_setup_buffer()) != BONGOCAT_SUCCESS) {
+        (result = buffer_pool_create(NUM_BUFFERS)) != BONGOCAT_SUCCESS) {
         wayland_cleanup();
         return result;
     }
 
     bongocat_log_info("Wayland initialization complete (%dx%d buffer)",
-                     current_config->screen_width, current_config->bar_height);
+                     layout.buffer_width, layout.buffer_height);
     return BONGOCAT_SUCCESS;
 }
 
@@ -659,13 +1723,15 @@ bongocat_error_t wayland_run(volatile sig_atomic_t *running) {
     const int check_interval_ms = 100;
 
     while (*running && display) {
-        // Periodic fullscreen check for fallback detection
+        // Periodic fullscreen check for fallback detection; with the foreign
+        // toplevel protocol the state arrives as events and we can block
+        bool poll_fallback = fs_detector.manager == NULL;
         struct timeval now;
         gettimeofday(&now, NULL);
         long elapsed_ms = (now.tv_sec - fs_detector.last_check.tv_sec) * 1000 + 
                          (now.tv_usec - fs_detector.last_check.tv_usec) / 1000;
         
-        if (elapsed_ms >= check_interval_ms) {
+        if (poll_fallback && elapsed_ms >= check_interval_ms) {
             bool new_state = fs_check_status();
             if (new_state != fullscreen_detected) {
                 fs_update_state(new_state);
@@ -686,7 +1752,7 @@ bongocat_error_t wayland_run(volatile sig_atomic_t *running) {
             }
         }
         
-        int poll_result = poll(&pfd, 1, 100);
+        int poll_result = poll(&pfd, 1, poll_fallback ? check_interval_ms : -1);
         
         if (poll_result > 0) {
             if (wl_display_read_events(display) == -1 ||
@@ -726,6 +1792,46 @@ void wayland_update_config(config_t *config) {
     }
 
     current_config = config;
+
+    // Reloaded configs start from default dimensions, restore the detected ones
+    if (screen_info.screen_width > 0) {
+        config->screen_width = screen_info.screen_width;
+    }
+    if (screen_info.screen_height > 0 && config->overlay_size == OVERLAY_SIZE_SCREEN) {
+        config->bar_height = screen_info.screen_height;
+    }
+
+    surface_layout_t new_layout;
+    layout_calculate(config, &new_layout);
+
+    if (layer_surface && memcmp(&new_layout, &layout, sizeof(layout)) != 0) {
+        bongocat_log_info("Overlay layout changed, resizing surface to %dx%d",
+                          new_layout.buffer_width, new_layout.buffer_height);
+
+        pthread_mutex_lock(&buffer_lock);
+        bool resize_buffer = new_layout.buffer_width != layout.buffer_width ||
+                             new_layout.buffer_height != layout.buffer_height;
+        layout = new_layout;
+        scaled_shown.valid = false;
+        last_render.valid = false;
+        frame_throttle_reset_locked();
+        if (resize_buffer) {
+            // Recreated at the new size by the next draw
+            buffer_pool_destroy();
+        }
+        pthread_mutex_unlock(&buffer_lock);
+
+        // New size and margins are committed together with the next frame
+        layout_apply_to_surface();
+        layout_apply_scale();
+    }
+
+    // Compositor scaling may have been switched, which changes the frames' scale
+    pthread_mutex_lock(&buffer_lock);
+    scaled_failed = false;
+    pthread_mutex_unlock(&buffer_lock);
+    scale_update();
+
     if (configured) {
         draw_bar();
     }
@@ -761,22 +1867,31 @@ void wayland_cleanup(void) {
     
     output_count = 0;
 
-    if (buffer) {
-        wl_buffer_destroy(buffer);
-        buffer = NULL;
-    }
+    buffer_pool_destroy();
+    scaled_destroy();
+    latency_cleanup();
 
-    if (pixels && current_config) {
-        int size = current_config->screen_width * current_config->bar_height * 4;
-        munmap(pixels, size);
-        pixels = NULL;
+    if (frame_callback) {
+        wl_callback_destroy(frame_callback);
+        frame_callback = NULL;
     }
+    redraw_pending = false;
 
     if (layer_surface) {
         zwlr_layer_surface_v1_destroy(layer_surface);
         layer_surface = NULL;
     }
 
+    if (fractional_scale) {
+        wp_fractional_scale_v1_destroy(fractional_scale);
+        fractional_scale = NULL;
+    }
+
+    if (viewport) {
+        wp_viewport_destroy(viewport);
+        viewport = NULL;
+    }
+
     if (surface) {
         wl_surface_destroy(surface);
         surface = NULL;
@@ -801,6 +1916,21 @@ void wayland_cleanup(void) {
         fs_detector.manager = NULL;
     }
 
+    if (subcompositor) {
+        wl_subcompositor_destroy(subcompositor);
+        subcompositor = NULL;
+    }
+
+    if (fractional_scale_manager) {
+        wp_fractional_scale_manager_v1_destroy(fractional_scale_manager);
+        fractional_scale_manager = NULL;
+    }
+
+    if (viewporter) {
+        wp_viewporter_destroy(viewporter);
+        viewporter = NULL;
+    }
+
     if (shm) {
         wl_shm_destroy(shm);
         shm = NULL;
@@ -821,6 +1951,12 @@ void wayland_cleanup(void) {
     fullscreen_detected = false;
     memset(&fs_detector, 0, sizeof(fs_detector));
     memset(&screen_info, 0, sizeof(screen_info));
+    memset(&layout, 0, sizeof(layout));
+    memset(&last_render, 0, sizeof(last_render));
+    memset(surface_on_output, 0, sizeof(surface_on_output));
+    preferred_scale = 0;
+    surface_scale = 0;
+    configured_width = 0;
     
     bongocat_log_debug("Wayland cleanup complete");
 }
@@ -0,0 +1,78 @@
+#include "utils/latency.h"
+#include "utils/error.h"
+#include <string.h>
+
+// Magnitude 0 holds 0..2*SUB-1 in unit buckets; magnitude m >= 1 holds
+// [SUB << m, SUB << (m + 1)) in buckets 2^m wide, starting at (m + 1) * SUB.
+// The last magnitude that fits is LATENCY_MAGNITUDES - 1.
+static int latency_bucket(long value_us) {
+    if (value_us < 0) {
+        value_us = 0;
+    }
+
+    const unsigned long value = (unsigned long)value_us;
+    int magnitude = 0;
+    if (value >= 2 * LATENCY_SUB_BUCKETS) {
+        magnitude = (int)(sizeof(unsigned long) * 8) - 1 - __builtin_clzl(value) - LATENCY_SUB_BUCKET_BITS;
+    }
+    if (magnitude >= LATENCY_MAGNITUDES) {
+        return LATENCY_NUM_BUCKETS - 1;
+    }
+    return magnitude * LATENCY_SUB_BUCKETS + (int)(value >> magnitude);
+}
+
+static long latency_bucket_highest(int bucket) {
+    int magnitude = bucket / LATENCY_SUB_BUCKETS - 1;
+    if (magnitude < 0) {
+        magnitude = 0;
+    }
+    const long lowest = (long)(bucket - magnitude * LATENCY_SUB_BUCKETS) << magnitude;
+    return lowest + (1L << magnitude) - 1;
+}
+
+void latency_record(latency_histogram_t *histogram, long value_us) {
+    histogram->counts[latency_bucket(value_us)]++;
+    histogram->total++;
+    if (value_us > histogram->max_us) {
+        histogram->max_us = value_us;
+    }
+}
+
+void latency_reset(latency_histogram_t *histogram) {
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+long latency_percentile(const latency_histogram_t *histogram, int permille) {
+    if (histogram->total == 0) {
+        return 0;
+    }
+
+    // Smallest rank covering the requested fraction, at least the first sample
+    uint64_t rank = (histogram->total * (uint64_t)permille + 999) / 1000;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < LATENCY_NUM_BUCKETS; i++) {
+        seen += histogram->counts[i];
+        if (seen >= rank) {
+            // The exact maximum beats its bucket's upper edge, and the last
+            // bucket also holds everything past it
+            const long value = i < LATENCY_NUM_BUCKETS - 1 ? latency_bucket_highest(i)
+                                                           : histogram->max_us;
+            return value < histogram->max_us ? value : histogram->max_us;
+        }
+    }
+    return histogram->max_us;
+}
+
+void latency_log_summary(const latency_histogram_t *histogram, const char *name) {
+    if (histogram->total == 0) {
+        return;
+    }
+    bongocat_log_info("Input latency to %s: %llu samples, p50 %ld us, p99 %ld us, max %ld us",
+                      name, (unsigned long long)histogram->total,
+                      latency_percentile(histogram, 500), latency_percentile(histogram, 990),
+                      histogram->max_us);
+}
@@ -102,7 +102,7 @@ void bongocat_free(void *ptr) {
 }
 
 memory_pool_t* memory_pool_create(size_t size, size_t alignment) {
-    if (size == 0 || alignment == 0) {
+    if (size == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0) {
         bongocat_log_error("Invalid memory pool parameters");
         return NULL;
     }
@@ -110,12 +110,24 @@ memory_pool_t* memory_pool_create(size_t size, size_t alignment) {
     memory_pool_t *pool = bongocat_malloc(sizeof(memory_pool_t));
     if (!pool) return NULL;
     
-    pool->data = bongocat_malloc(size);
+    // Allocations are aligned relative to the start, so align the start too
+    size = (size + alignment - 1) & ~(alignment - 1);
+    pool->data = aligned_alloc(alignment < sizeof(void *) ? sizeof(void *) : alignment, size);
     if (!pool->data) {
+        bongocat_log_error("Failed to allocate %zu bytes", size);
         bongocat_free(pool);
         return NULL;
     }
     
+    pthread_mutex_lock(&memory_mutex);
+    g_memory_stats.total_allocated += size;
+    g_memory_stats.current_allocated += size;
+    if (g_memory_stats.current_allocated > g_memory_stats.peak_allocated) {
+        g_memory_stats.peak_allocated = g_memory_stats.current_allocated;
+    }
+    g_memory_stats.allocation_count++;
+    pthread_mutex_unlock(&memory_mutex);
+    
     pool->size = size;
     pool->used = 0;
     pool->alignment = alignment;
@@ -185,8 +197,10 @@ void* bongocat_malloc_debug(size_t size, const char *file, int line) {
         record->size = size;
         record->file = file;
         record->line = line;
+        pthread_mutex_lock(&memory_mutex);
         record->next = allocations;
         allocations = record;
+        pthread_mutex_unlock(&memory_mutex);
     }
     
     return ptr;
@@ -195,22 +209,28 @@ void* bongocat_malloc_debug(size_t size, const char *file, int line) {
 void bongocat_free_debug(void *ptr, const char *file, int line) {
     if (!ptr) return;
     
+    // Frame workers, the loader and the stream thread allocate concurrently
+    allocation_record_t *to_remove = NULL;
+    pthread_mutex_lock(&memory_mutex);
     allocation_record_t **current = &allocations;
     while (*current) {
         if ((*current)->ptr == ptr) {
-            allocation_record_t *to_remove = *current;
+            to_remove = *current;
             *current = (*current)->next;
-            free(to_remove);
             break;
         }
         current = &(*current)->next;
     }
+    pthread_mutex_unlock(&memory_mutex);
+    free(to_remove);
     
     bongocat_free(ptr);
 }
 
 void memory_leak_check(void) {
+    pthread_mutex_lock(&memory_mutex);
     if (!allocations) {
+        pthread_mutex_unlock(&memory_mutex);
         bongocat_log_info("No memory leaks detected");
         return;
     }
@@ -221,5 +241,6 @@ void memory_leak_check(void) {
         bongocat_log_error("  %zu bytes at %s:%d", current->size, current->file, current->line);
         current = current->next;
     }
+    pthread_mutex_unlock(&memory_mutex);
 }
 #endif
\ No newline at end of file